@@ -0,0 +1,520 @@
+const uint8_t Inter_Bold18pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xEF,
+  0xBE, 0x79, 0xE0, 0x00, 0x7B, 0xFF, 0xFF, 0xFD, 0xE0, 0xF8, 0xFB, 0xC3,
+  0xDE, 0x1E, 0xF0, 0xF7, 0x87, 0xBC, 0x3D, 0xE1, 0xEF, 0x0F, 0x78, 0x7B,
+  0xC3, 0xDE, 0x1E, 0x01, 0xE0, 0xF0, 0x07, 0x83, 0xC0, 0x1E, 0x0F, 0x00,
+  0xF0, 0x78, 0x03, 0xC1, 0xE0, 0x0F, 0x07, 0x83, 0xFF, 0xFF, 0xCF, 0xFF,
+  0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x78, 0x3C, 0x01, 0xE0, 0xF0,
+  0x07, 0x83, 0xC0, 0x1E, 0x0F, 0x00, 0x78, 0x3C, 0x1F, 0xFF, 0xFE, 0x7F,
+  0xFF, 0xF9, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x03, 0xC1, 0xE0, 0x0F, 0x07,
+  0x80, 0x38, 0x1C, 0x01, 0xE0, 0xF0, 0x07, 0x83, 0xC0, 0x1E, 0x0F, 0x00,
+  0x78, 0x3C, 0x00, 0x00, 0x30, 0x00, 0x01, 0x80, 0x00, 0x0C, 0x00, 0x00,
+  0x60, 0x00, 0x1F, 0xE0, 0x03, 0xFF, 0xC0, 0x7F, 0xFF, 0x07, 0xFF, 0xFC,
+  0x3F, 0xBF, 0xF3, 0xF1, 0x9F, 0x9F, 0x8C, 0x7C, 0xFC, 0x63, 0xE7, 0xE3,
+  0x00, 0x3F, 0x98, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0x80,
+  0x3F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0x3F, 0x00, 0x18,
+  0xFF, 0xF0, 0xC7, 0xEF, 0x86, 0x3F, 0x7E, 0x33, 0xF3, 0xFD, 0xBF, 0x8F,
+  0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xC0,
+  0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x1F, 0x00, 0x07, 0x80, 0xFF, 0x00,
+  0x1C, 0x07, 0xFE, 0x00, 0xF0, 0x3C, 0x78, 0x07, 0x80, 0xF0, 0xE0, 0x1C,
+  0x03, 0xC3, 0x80, 0xF0, 0x0F, 0x0E, 0x07, 0x80, 0x3C, 0x38, 0x1C, 0x00,
+  0xF1, 0xE0, 0xF0, 0x01, 0xFF, 0x87, 0x80, 0x03, 0xFC, 0x1C, 0x00, 0x07,
+  0xE0, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1C, 0x0F, 0x80, 0x00,
+  0xF0, 0xFF, 0x00, 0x07, 0x87, 0xFE, 0x00, 0x1C, 0x1E, 0x78, 0x00, 0xF0,
+  0x70, 0xE0, 0x07, 0x83, 0xC3, 0xC0, 0x1C, 0x0F, 0x0F, 0x00, 0xF0, 0x3C,
+  0x3C, 0x07, 0x80, 0xF0, 0xE0, 0x1C, 0x01, 0xE7, 0x80, 0xE0, 0x07, 0xFE,
+  0x07, 0x80, 0x0F, 0xF0, 0x3C, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x0F,
+  0xF8, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xF8, 0x01, 0xF1, 0xF0, 0x03, 0xC1,
+  0xE0, 0x07, 0x83, 0xC0, 0x0F, 0x07, 0x80, 0x1F, 0x1F, 0x00, 0x3E, 0x7C,
+  0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xFE, 0x0F,
+  0x0F, 0xFE, 0x1E, 0x3F, 0x7E, 0x7C, 0x7C, 0x7E, 0xF8, 0xF8, 0x7F, 0xE3,
+  0xE0, 0x7F, 0xC7, 0xE0, 0x7F, 0x87, 0xC0, 0x7E, 0x0F, 0xC3, 0xFC, 0x1F,
+  0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFE, 0xF8, 0x0F, 0xF0, 0xFC, 0xFB,
+  0xDE, 0xF7, 0xBD, 0xEF, 0x7B, 0xDE, 0x0F, 0x87, 0x87, 0xC3, 0xE3, 0xE1,
+  0xF0, 0xF8, 0xFC, 0x7C, 0x3E, 0x1F, 0x1F, 0x8F, 0xC7, 0xC3, 0xE1, 0xF0,
+  0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xE3, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F,
+  0x87, 0xC3, 0xE0, 0xF8, 0x7C, 0x3F, 0x0F, 0x80, 0xF8, 0x3E, 0x1F, 0x07,
+  0xC3, 0xE1, 0xF0, 0xFC, 0x3E, 0x1F, 0x0F, 0x87, 0xE1, 0xF0, 0xF8, 0x7C,
+  0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x3F, 0x1F,
+  0x0F, 0x87, 0xC7, 0xE3, 0xE1, 0xF1, 0xF0, 0xF8, 0xF8, 0x00, 0x07, 0x80,
+  0x1C, 0x04, 0x70, 0x99, 0xC6, 0xFF, 0x7B, 0xFF, 0xF3, 0xFF, 0x03, 0xF0,
+  0x3F, 0xE3, 0xFF, 0xEF, 0xF7, 0xD9, 0xCE, 0x47, 0x08, 0x1C, 0x00, 0x78,
+  0x00, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0,
+  0x00, 0x78, 0x00, 0x1E, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07,
+  0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x7E, 0xF9, 0xF3, 0xE7, 0x8F, 0x3E,
+  0x78, 0xF1, 0xE3, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xEF,
+  0xFF, 0xF9, 0xE0, 0x00, 0x78, 0x07, 0xC0, 0x3E, 0x01, 0xE0, 0x0F, 0x00,
+  0xF8, 0x07, 0xC0, 0x3C, 0x01, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0x80, 0x3C,
+  0x03, 0xE0, 0x1F, 0x00, 0xF0, 0x07, 0x80, 0x7C, 0x03, 0xE0, 0x1E, 0x01,
+  0xF0, 0x0F, 0x80, 0x78, 0x03, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x00, 0x78,
+  0x07, 0xC0, 0x3E, 0x01, 0xE0, 0x1F, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xE0,
+  0x1F, 0xFF, 0x83, 0xFF, 0xF8, 0x3F, 0x1F, 0xC7, 0xE0, 0x7E, 0x7C, 0x03,
+  0xEF, 0xC0, 0x3E, 0xF8, 0x03, 0xFF, 0x80, 0x3F, 0xF8, 0x01, 0xFF, 0x80,
+  0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8,
+  0x01, 0xFF, 0x80, 0x3F, 0xFC, 0x03, 0xE7, 0xC0, 0x3E, 0x7E, 0x07, 0xE3,
+  0xF0, 0xFC, 0x3F, 0xFF, 0xC1, 0xFF, 0xF8, 0x0F, 0xFE, 0x00, 0x3F, 0x80,
+  0x07, 0xE3, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF8, 0xFE, 0x1F, 0x83,
+  0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0,
+  0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C,
+  0x07, 0xF0, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xFF, 0xFE, 0x7E, 0x1F, 0xBF,
+  0x03, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00,
+  0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0,
+  0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F,
+  0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
+  0xF8, 0x01, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xFF, 0xC7, 0xE1, 0xFD, 0xF8,
+  0x0F, 0xBE, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x0F,
+  0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x00, 0x07, 0xF0, 0x00,
+  0x3F, 0x00, 0x07, 0xE0, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0xC0,
+  0x7F, 0xFC, 0x3F, 0x9F, 0xFF, 0xF1, 0xFF, 0xFC, 0x1F, 0xFE, 0x00, 0x7F,
+  0x00, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x7F, 0x80, 0x0F, 0xF8, 0x00,
+  0xFF, 0x80, 0x1F, 0xF8, 0x03, 0xFF, 0x80, 0x3E, 0xF8, 0x07, 0xCF, 0x80,
+  0xFC, 0xF8, 0x0F, 0x8F, 0x81, 0xF0, 0xF8, 0x1F, 0x0F, 0x83, 0xE0, 0xF8,
+  0x7E, 0x0F, 0x87, 0xC0, 0xF8, 0xF8, 0x0F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00,
+  0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x3F, 0xFF, 0xC7, 0xFF, 0xF8, 0xFF,
+  0xFF, 0x1F, 0xFF, 0xE3, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0,
+  0x00, 0x7C, 0xFC, 0x0F, 0xBF, 0xE1, 0xFF, 0xFE, 0x3F, 0xFF, 0xC7, 0xE1,
+  0xFC, 0x38, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00,
+  0x7F, 0xE0, 0x0F, 0xFE, 0x03, 0xF7, 0xC0, 0x7C, 0xFE, 0x3F, 0x8F, 0xFF,
+  0xE1, 0xFF, 0xF8, 0x0F, 0xFE, 0x00, 0x7F, 0x00, 0x01, 0xF8, 0x00, 0xFF,
+  0xE0, 0x7F, 0xFE, 0x1F, 0xFF, 0xE3, 0xF0, 0xFC, 0xFC, 0x0F, 0xDF, 0x00,
+  0xFF, 0xC0, 0x00, 0xF8, 0x7C, 0x1F, 0x3F, 0xE3, 0xEF, 0xFE, 0x7F, 0xFF,
+  0xEF, 0xF1, 0xFD, 0xFC, 0x0F, 0xFF, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03,
+  0xFF, 0x00, 0x7F, 0xF0, 0x0F, 0xFE, 0x01, 0xF7, 0xE0, 0x7E, 0xFE, 0x3F,
+  0x8F, 0xFF, 0xE0, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x7F, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xC0, 0x03, 0xF0,
+  0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x01,
+  0xF8, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x01, 0xF0,
+  0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x03, 0xF0, 0x00,
+  0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF8, 0x01,
+  0xFF, 0xC0, 0xFF, 0xFE, 0x3F, 0xFF, 0xE7, 0xE1, 0xFC, 0xF8, 0x0F, 0x9F,
+  0x01, 0xF3, 0xE0, 0x3E, 0x7C, 0x07, 0xCF, 0xC1, 0xF0, 0xFF, 0xFE, 0x07,
+  0xFF, 0x01, 0xFF, 0xF0, 0x7F, 0xFF, 0x1F, 0xC7, 0xF7, 0xE0, 0x3F, 0xF8,
+  0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x7F, 0xFC,
+  0x3F, 0xDF, 0xFF, 0xF1, 0xFF, 0xFC, 0x1F, 0xFF, 0x00, 0x7F, 0x00, 0x03,
+  0xF0, 0x01, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xFF, 0xC7, 0xE1, 0xFD, 0xF8,
+  0x1F, 0xBE, 0x01, 0xF7, 0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0x00, 0xFF, 0xE0,
+  0x1F, 0xFE, 0x07, 0xFF, 0xE1, 0xFE, 0xFF, 0xFF, 0xCF, 0xFE, 0xF8, 0xFF,
+  0x9F, 0x07, 0xC3, 0xE0, 0x00, 0x7C, 0x00, 0x1F, 0x7C, 0x03, 0xEF, 0xC0,
+  0xFC, 0xFC, 0x3F, 0x1F, 0xFF, 0xC1, 0xFF, 0xF0, 0x1F, 0xFC, 0x00, 0x7E,
+  0x00, 0x7B, 0xEF, 0xFF, 0xF9, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF,
+  0xBF, 0xFF, 0xE7, 0x80, 0x3C, 0xF9, 0xFB, 0xF7, 0xC7, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7C, 0xF9, 0xF3, 0xC7, 0x9F, 0x3C,
+  0x78, 0xF1, 0xE0, 0x00, 0x00, 0x80, 0x01, 0xC0, 0x07, 0xE0, 0x0F, 0xF0,
+  0x1F, 0xF8, 0x3F, 0xF8, 0xFF, 0xE1, 0xFF, 0xC0, 0xFF, 0x00, 0x7E, 0x00,
+  0x3F, 0x80, 0x1F, 0xF0, 0x07, 0xFF, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x01,
+  0xFF, 0x00, 0x3F, 0x80, 0x07, 0xC0, 0x00, 0x60, 0x00, 0x10, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x70, 0x00, 0x3F, 0x00, 0x1F, 0xE0,
+  0x0F, 0xFC, 0x03, 0xFF, 0x80, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0x7F, 0x80,
+  0x0F, 0xC0, 0x0F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF0, 0xFF, 0xC3, 0xFF, 0x81,
+  0xFF, 0x00, 0xFE, 0x00, 0x78, 0x00, 0x30, 0x00, 0x10, 0x00, 0x00, 0x07,
+  0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x8F, 0xFF, 0xE7, 0xE3, 0xFB, 0xE0, 0xFF,
+  0xE0, 0x3E, 0x00, 0x1F, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x1F, 0xC0, 0x1F,
+  0xC0, 0x1F, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x01,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x1F, 0x80,
+  0x0F, 0xC0, 0x07, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F,
+  0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x3E,
+  0x07, 0xCF, 0x7C, 0x7C, 0x1F, 0xEF, 0x3E, 0x7C, 0x3F, 0xFF, 0x1E, 0xF8,
+  0x7F, 0xFF, 0x1F, 0xF8, 0x7C, 0x7F, 0x1F, 0xF0, 0xF8, 0x1F, 0x0F, 0xF0,
+  0xF0, 0x1F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0,
+  0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0,
+  0xF0, 0x1F, 0x0F, 0xF0, 0xF8, 0x1F, 0x0F, 0xF8, 0x7C, 0x7F, 0x1E, 0xF8,
+  0x7F, 0xFF, 0x1E, 0x7C, 0x3F, 0xFF, 0xFC, 0x7C, 0x1F, 0xF7, 0xF8, 0x3E,
+  0x0F, 0xC3, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F,
+  0xF8, 0x07, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
+  0x80, 0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0, 0x07, 0xE7,
+  0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x0F, 0xC3, 0xF0, 0x0F, 0xC1,
+  0xF0, 0x0F, 0x81, 0xF8, 0x1F, 0x81, 0xF8, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF,
+  0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3E, 0x00, 0x7E, 0x7E, 0x00,
+  0x7E, 0x7E, 0x00, 0x7E, 0x7C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00,
+  0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFC,
+  0x0F, 0xEF, 0xC0, 0x7E, 0xFC, 0x07, 0xEF, 0xC0, 0x3E, 0xFC, 0x07, 0xEF,
+  0xC0, 0x7C, 0xFC, 0x0F, 0xCF, 0xFF, 0xF8, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xCF, 0xC0, 0xFE, 0xFC, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x01,
+  0xFF, 0xC0, 0x3F, 0xFC, 0x03, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF,
+  0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0x80,
+  0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x83, 0xF8, 0x3F, 0x8F, 0xE0, 0x3F, 0x9F,
+  0x80, 0x3F, 0x3E, 0x00, 0x3E, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xE0,
+  0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0xFF, 0xF0, 0x01,
+  0xF3, 0xF0, 0x07, 0xE7, 0xF0, 0x1F, 0x87, 0xF8, 0x7F, 0x07, 0xFF, 0xFC,
+  0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0xF8, 0x03,
+  0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0xFC, 0x0F, 0xE3, 0xF0,
+  0x0F, 0xCF, 0xC0, 0x1F, 0xBF, 0x00, 0x3E, 0xFC, 0x00, 0xFB, 0xF0, 0x03,
+  0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF,
+  0xC0, 0x07, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xEF, 0xC0,
+  0x0F, 0xBF, 0x00, 0x7E, 0xFC, 0x03, 0xF3, 0xF0, 0x3F, 0x8F, 0xFF, 0xFE,
+  0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xBF,
+  0xFF, 0xEF, 0xFF, 0xFB, 0xFF, 0xFE, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
+  0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xFE,
+  0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
+  0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8,
+  0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xFF, 0xF7,
+  0xFF, 0xFB, 0xFF, 0xFD, 0xFF, 0xFE, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00,
+  0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC,
+  0x00, 0x7E, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xFF,
+  0x80, 0xFF, 0xFF, 0x83, 0xF8, 0x3F, 0x8F, 0xE0, 0x1F, 0x9F, 0x80, 0x3F,
+  0x3E, 0x00, 0x3E, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07,
+  0xC0, 0x00, 0x0F, 0x80, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0x03, 0xFF, 0xFC,
+  0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xF0, 0x01, 0xF3, 0xF0,
+  0x03, 0xE7, 0xF0, 0x0F, 0xC7, 0xF8, 0x7F, 0x07, 0xFF, 0xFC, 0x07, 0xFF,
+  0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x7F, 0xF0, 0x01,
+  0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF,
+  0xC0, 0x07, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x07, 0xFF,
+  0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x00,
+  0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0,
+  0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07,
+  0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00,
+  0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x81, 0xFF, 0xC1, 0xFB,
+  0xF1, 0xFD, 0xFF, 0xFC, 0x7F, 0xFC, 0x1F, 0xFC, 0x03, 0xF8, 0x00, 0xFC,
+  0x01, 0xFF, 0xF0, 0x07, 0xEF, 0xC0, 0x3F, 0x3F, 0x01, 0xF8, 0xFC, 0x0F,
+  0xC3, 0xF0, 0x7F, 0x0F, 0xC3, 0xF8, 0x3F, 0x1F, 0xC0, 0xFC, 0x7E, 0x03,
+  0xF3, 0xF0, 0x0F, 0xDF, 0x80, 0x3F, 0xFE, 0x00, 0xFF, 0xF8, 0x03, 0xFF,
+  0xF0, 0x0F, 0xFF, 0xE0, 0x3F, 0xDF, 0x80, 0xFE, 0x3F, 0x03, 0xF8, 0x7E,
+  0x0F, 0xC1, 0xF8, 0x3F, 0x03, 0xF0, 0xFC, 0x07, 0xE3, 0xF0, 0x1F, 0x8F,
+  0xC0, 0x3F, 0x3F, 0x00, 0x7E, 0xFC, 0x01, 0xFB, 0xF0, 0x03, 0xF0, 0xFC,
+  0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03,
+  0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80,
+  0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E,
+  0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0x0F, 0xFF, 0xFC,
+  0x00, 0x7F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x01,
+  0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xEF, 0x80, 0xFF, 0xFF, 0x7C, 0x07, 0xFF,
+  0xFB, 0xE0, 0x3D, 0xFF, 0xCF, 0x83, 0xEF, 0xFE, 0x7C, 0x1F, 0x7F, 0xFB,
+  0xE1, 0xFB, 0xFF, 0xDF, 0x8F, 0x9F, 0xFE, 0x7C, 0x7C, 0xFF, 0xF3, 0xE3,
+  0xE7, 0xFF, 0x9F, 0x3E, 0x3F, 0xFC, 0x7D, 0xF1, 0xFF, 0xE3, 0xEF, 0x8F,
+  0xFF, 0x0F, 0x78, 0x7F, 0xF8, 0x7B, 0xC3, 0xFF, 0xC3, 0xFE, 0x1F, 0xFE,
+  0x0F, 0xE0, 0xFF, 0xF0, 0x7F, 0x07, 0xFF, 0x83, 0xF8, 0x3F, 0xFC, 0x0F,
+  0x81, 0xFF, 0xE0, 0x7C, 0x0F, 0xC0, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0xFF,
+  0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xF0, 0x1F, 0xFD, 0xF0, 0x3F, 0xFB, 0xE0, 0x7F, 0xFB, 0xE0, 0xFF, 0xF7,
+  0xE1, 0xFF, 0xE7, 0xC3, 0xFF, 0xCF, 0xC7, 0xFF, 0x8F, 0x8F, 0xFF, 0x0F,
+  0x9F, 0xFE, 0x1F, 0xBF, 0xFC, 0x1F, 0x7F, 0xF8, 0x3F, 0xFF, 0xF0, 0x3F,
+  0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0xFF,
+  0xFE, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00,
+  0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x3F, 0x83, 0xF8,
+  0x7F, 0x01, 0xFC, 0x7E, 0x00, 0xFC, 0x7C, 0x00, 0x7E, 0xFC, 0x00, 0x7E,
+  0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3F,
+  0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E,
+  0xFC, 0x00, 0x3E, 0xFC, 0x00, 0x7E, 0x7E, 0x00, 0xFC, 0x7F, 0x01, 0xFC,
+  0x3F, 0xC3, 0xF8, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xC0,
+  0x00, 0xFE, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x8F, 0xFF,
+  0xFC, 0xFC, 0x1F, 0xEF, 0xC0, 0x7E, 0xFC, 0x03, 0xEF, 0xC0, 0x3E, 0xFC,
+  0x03, 0xFF, 0xC0, 0x3E, 0xFC, 0x03, 0xEF, 0xC0, 0x7E, 0xFC, 0x0F, 0xEF,
+  0xFF, 0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0xFF, 0xFC, 0x0F, 0xC0, 0x00,
+  0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
+  0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x07,
+  0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x3F, 0x83, 0xF8, 0x7F,
+  0x01, 0xFC, 0x7E, 0x00, 0xFC, 0x7C, 0x00, 0x7E, 0xFC, 0x00, 0x7E, 0xF8,
+  0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3F, 0xF8,
+  0x00, 0x3F, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xFC,
+  0x3E, 0x7E, 0xFC, 0x1E, 0x7E, 0x7E, 0x0F, 0xFC, 0x7F, 0x0F, 0xFC, 0x3F,
+  0xC7, 0xF8, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00,
+  0xFE, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xFF, 0xFC, 0x0F, 0xFF,
+  0xF0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFC, 0x0F, 0xEF, 0xC0, 0x7E, 0xFC,
+  0x03, 0xEF, 0xC0, 0x3E, 0xFC, 0x03, 0xFF, 0xC0, 0x3E, 0xFC, 0x07, 0xEF,
+  0xC0, 0xFE, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0xFF, 0xFF, 0x0F, 0xFF, 0xE0,
+  0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x1F, 0x8F, 0xC1, 0xF8, 0xFC, 0x0F,
+  0xCF, 0xC0, 0xFC, 0xFC, 0x07, 0xEF, 0xC0, 0x7E, 0xFC, 0x03, 0xFF, 0xC0,
+  0x3F, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0xC3,
+  0xF0, 0x7F, 0x3F, 0x01, 0xF9, 0xF8, 0x07, 0xCF, 0xC0, 0x00, 0x7E, 0x00,
+  0x03, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xF8, 0x03,
+  0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x0F,
+  0xFF, 0x00, 0x7E, 0xF8, 0x03, 0xF7, 0xE0, 0x1F, 0x3F, 0x83, 0xF8, 0xFF,
+  0xFF, 0x83, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x80, 0x00,
+  0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
+  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03,
+  0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00,
+  0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F,
+  0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0xFF, 0xF0, 0x03,
+  0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
+  0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0,
+  0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F,
+  0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xEF, 0xC0, 0x0F, 0x9F,
+  0x00, 0x7E, 0x7E, 0x01, 0xF8, 0xFE, 0x1F, 0xC3, 0xFF, 0xFE, 0x07, 0xFF,
+  0xF8, 0x07, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0xFC, 0x00,
+  0x3F, 0x7C, 0x00, 0x3F, 0x7E, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x3E, 0x00,
+  0x7E, 0x3F, 0x00, 0x7C, 0x3F, 0x00, 0xFC, 0x1F, 0x00, 0xFC, 0x1F, 0x80,
+  0xF8, 0x1F, 0x81, 0xF8, 0x0F, 0x81, 0xF8, 0x0F, 0xC1, 0xF0, 0x07, 0xC3,
+  0xF0, 0x07, 0xC3, 0xF0, 0x07, 0xE3, 0xE0, 0x03, 0xE3, 0xE0, 0x03, 0xE7,
+  0xE0, 0x03, 0xE7, 0xC0, 0x01, 0xF7, 0xC0, 0x01, 0xF7, 0xC0, 0x01, 0xFF,
+  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7F,
+  0x00, 0xFC, 0x03, 0xF0, 0x07, 0xFF, 0x80, 0x7E, 0x00, 0xF9, 0xF0, 0x0F,
+  0xE0, 0x3F, 0x3E, 0x01, 0xFC, 0x07, 0xE7, 0xE0, 0x7F, 0x80, 0xFC, 0xFC,
+  0x0F, 0xF0, 0x1F, 0x0F, 0x81, 0xFF, 0x07, 0xE1, 0xF0, 0x3F, 0xE0, 0xFC,
+  0x3F, 0x0F, 0xBC, 0x1F, 0x07, 0xE1, 0xF7, 0x83, 0xE0, 0x7C, 0x3E, 0xF8,
+  0x7C, 0x0F, 0x87, 0x9F, 0x1F, 0x81, 0xF1, 0xF3, 0xE3, 0xE0, 0x3F, 0x3E,
+  0x3C, 0x7C, 0x03, 0xE7, 0xC7, 0xCF, 0x80, 0x7C, 0xF0, 0xFB, 0xF0, 0x0F,
+  0x9E, 0x1F, 0x7C, 0x01, 0xF7, 0xC1, 0xEF, 0x80, 0x1F, 0xF8, 0x3D, 0xF0,
+  0x03, 0xFE, 0x07, 0xBE, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x07, 0xF8, 0x0F,
+  0xF0, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x03, 0xF8,
+  0x07, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x3F, 0x00,
+  0xFC, 0x3F, 0x00, 0xFC, 0x1F, 0x81, 0xF8, 0x0F, 0xC3, 0xF0, 0x0F, 0xC3,
+  0xF0, 0x07, 0xE7, 0xE0, 0x03, 0xE7, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF,
+  0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xE7,
+  0xC0, 0x07, 0xE7, 0xE0, 0x0F, 0xC3, 0xF0, 0x0F, 0xC3, 0xF0, 0x1F, 0x81,
+  0xF8, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x7E, 0x00, 0x7E, 0xFC, 0x00,
+  0x3F, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x7E, 0x7E, 0x00, 0xFE, 0x3F, 0x00,
+  0xFC, 0x3F, 0x01, 0xF8, 0x1F, 0x81, 0xF8, 0x0F, 0x83, 0xF0, 0x0F, 0xC3,
+  0xF0, 0x07, 0xE7, 0xE0, 0x07, 0xE7, 0xC0, 0x03, 0xEF, 0xC0, 0x01, 0xFF,
+  0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x07, 0xE0,
+  0x00, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x7E, 0x00,
+  0x1F, 0x80, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01,
+  0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87,
+  0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0,
+  0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF8,
+  0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x07, 0xC0,
+  0x1E, 0x00, 0xF0, 0x07, 0xC0, 0x3E, 0x00, 0xF0, 0x07, 0x80, 0x3E, 0x01,
+  0xF0, 0x07, 0x80, 0x3C, 0x01, 0xF0, 0x0F, 0x80, 0x3C, 0x01, 0xE0, 0x0F,
+  0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x80, 0x7C, 0x01, 0xE0, 0x0F, 0x00, 0x7C,
+  0x03, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x80, 0x7F, 0x00, 0xEF, 0x03, 0xDE, 0x07,
+  0x9C, 0x1E, 0x3C, 0x3C, 0x78, 0xF0, 0x79, 0xE0, 0xF7, 0x80, 0xF0, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0xF1, 0xF1, 0xE3,
+  0xC3, 0xC0, 0x03, 0xF8, 0x07, 0xFF, 0x0F, 0xFF, 0xC7, 0xFF, 0xF7, 0xE1,
+  0xFB, 0xE0, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x01, 0xFF, 0x8F, 0xFF, 0xCF,
+  0xFF, 0xEF, 0xC1, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xE0, 0x7F, 0xF8, 0x7F,
+  0xFF, 0xFF, 0xBF, 0xFF, 0xCF, 0xFB, 0xE1, 0xF1, 0xF0, 0xF8, 0x00, 0x1F,
+  0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E,
+  0x3F, 0x07, 0xCF, 0xF0, 0xFB, 0xFF, 0x9F, 0x7F, 0xF3, 0xFC, 0x7F, 0x7E,
+  0x07, 0xEF, 0xC0, 0x7D, 0xF8, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x3F, 0xF8,
+  0x03, 0xFF, 0x00, 0xFF, 0xF0, 0x1F, 0xFE, 0x03, 0xEF, 0xE0, 0xFD, 0xFE,
+  0x3F, 0xBF, 0xFF, 0xE7, 0xDF, 0xFC, 0xF9, 0xFE, 0x1F, 0x1F, 0x80, 0x03,
+  0xF8, 0x03, 0xFF, 0x81, 0xFF, 0xF0, 0xFF, 0xFE, 0x3F, 0x1F, 0xDF, 0x81,
+  0xF7, 0xC0, 0x7D, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
+  0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x01, 0xF7, 0xE0, 0x7C, 0xFC, 0x3F, 0x3F,
+  0xFF, 0x87, 0xFF, 0xC0, 0xFF, 0xE0, 0x0F, 0xE0, 0x00, 0x03, 0xE0, 0x00,
+  0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0xF8,
+  0xF8, 0x7F, 0x9F, 0x1F, 0xFB, 0xE7, 0xFF, 0xFD, 0xFC, 0x7F, 0xBF, 0x03,
+  0xF7, 0xC0, 0x7E, 0xF8, 0x07, 0xFF, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x03,
+  0xFF, 0x80, 0x7D, 0xF0, 0x0F, 0xBE, 0x03, 0xF7, 0xE0, 0x7E, 0xFE, 0x3F,
+  0xCF, 0xFF, 0xF8, 0xFF, 0xDF, 0x0F, 0xF3, 0xE0, 0xFC, 0x7C, 0x03, 0xF8,
+  0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0xFF, 0xC3, 0xF1, 0xFC, 0xFC, 0x0F,
+  0x9F, 0x01, 0xF3, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x81, 0xF1, 0xF8, 0x7E,
+  0x3F, 0xFF, 0x83, 0xFF, 0xF0, 0x3F, 0xF8, 0x01, 0xFC, 0x00, 0x01, 0xFC,
+  0x1F, 0xE0, 0xFF, 0x83, 0xFE, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x3F, 0xFE,
+  0xFF, 0xFB, 0xFF, 0xEF, 0xFF, 0x83, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8,
+  0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E,
+  0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x00, 0x03, 0xE3,
+  0xE1, 0xFE, 0x7C, 0x7F, 0xEF, 0x9F, 0xFF, 0xF7, 0xF1, 0xFE, 0xFC, 0x0F,
+  0xDF, 0x01, 0xFB, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x0F,
+  0xFE, 0x01, 0xF7, 0xC0, 0x3E, 0xF8, 0x0F, 0xDF, 0x81, 0xFB, 0xF8, 0xFF,
+  0x3F, 0xFF, 0xE3, 0xFF, 0x7C, 0x3F, 0xCF, 0x83, 0xF1, 0xF0, 0x00, 0x3E,
+  0x08, 0x0F, 0xDF, 0x83, 0xF1, 0xFF, 0xFE, 0x3F, 0xFF, 0x81, 0xFF, 0xE0,
+  0x0F, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00,
+  0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x8F, 0xC3, 0xE7, 0xF8, 0xFB, 0xFF, 0x3F,
+  0xFF, 0xEF, 0xF1, 0xFB, 0xF0, 0x3F, 0xFC, 0x0F, 0xFE, 0x01, 0xFF, 0x80,
+  0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F,
+  0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE,
+  0x01, 0xF0, 0x7B, 0xFF, 0xFF, 0x78, 0x00, 0x3E, 0xFB, 0xEF, 0xBE, 0xFB,
+  0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0x80, 0x0F,
+  0x0F, 0xC7, 0xE3, 0xF0, 0xF0, 0x00, 0x00, 0x3E, 0x1F, 0x0F, 0x87, 0xC3,
+  0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8,
+  0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF1, 0xFB, 0xFD, 0xFC, 0xFC,
+  0x7C, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8,
+  0x00, 0x3E, 0x00, 0x0F, 0x80, 0xFF, 0xE0, 0x7E, 0xF8, 0x3F, 0x3E, 0x1F,
+  0x8F, 0x8F, 0xC3, 0xE3, 0xE0, 0xF9, 0xF8, 0x3E, 0xFC, 0x0F, 0xFE, 0x03,
+  0xFF, 0x80, 0xFF, 0xF0, 0x3F, 0xFE, 0x0F, 0xDF, 0x83, 0xF3, 0xF0, 0xF8,
+  0x7E, 0x3E, 0x1F, 0x8F, 0x83, 0xF3, 0xE0, 0x7E, 0xF8, 0x1F, 0xBE, 0x03,
+  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0xF8, 0x1F, 0x0F, 0x9F, 0xC7,
+  0xFC, 0xFB, 0xFE, 0x7F, 0xEF, 0xFF, 0xEF, 0xFE, 0xFE, 0x3F, 0xC7, 0xFF,
+  0xC1, 0xF8, 0x3F, 0xFC, 0x1F, 0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0x0F,
+  0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0x0F, 0x81, 0xFF, 0x80, 0xF8, 0x1F,
+  0xF8, 0x0F, 0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0x0F, 0x81, 0xFF, 0x80,
+  0xF8, 0x1F, 0xF8, 0x0F, 0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0x0F, 0x81,
+  0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0xFC, 0x3E, 0x7F, 0x8F, 0xBF, 0xF3, 0xFF,
+  0xFE, 0xFF, 0x1F, 0xBF, 0x03, 0xFF, 0xC0, 0xFF, 0xE0, 0x1F, 0xF8, 0x07,
+  0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF,
+  0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0,
+  0x1F, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0xFF, 0xC3, 0xF1,
+  0xFC, 0xFC, 0x0F, 0x9F, 0x01, 0xFB, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0x80,
+  0x7F, 0xF0, 0x0F, 0xFE, 0x01, 0xF7, 0xC0, 0x3E, 0xF8, 0x0F, 0xDF, 0x81,
+  0xF1, 0xF8, 0xFE, 0x3F, 0xFF, 0x83, 0xFF, 0xE0, 0x3F, 0xF8, 0x01, 0xFC,
+  0x00, 0xF8, 0xFC, 0x1F, 0x3F, 0xC3, 0xEF, 0xFE, 0x7F, 0xFF, 0xCF, 0xF1,
+  0xFD, 0xF8, 0x1F, 0xBF, 0x01, 0xF7, 0xE0, 0x3F, 0xF8, 0x07, 0xFF, 0x00,
+  0xFF, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xBF, 0x83,
+  0xF7, 0xF8, 0xFE, 0xFF, 0xFF, 0x9F, 0x7F, 0xF3, 0xE7, 0xF8, 0x7C, 0x7E,
+  0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00,
+  0x1F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE3, 0xE1, 0xFE, 0x7C, 0x7F,
+  0xEF, 0x9F, 0xFF, 0xF7, 0xF1, 0xFE, 0xFC, 0x0F, 0xDF, 0x01, 0xFB, 0xE0,
+  0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0xFE, 0x01, 0xF7, 0xC0,
+  0x3E, 0xF8, 0x0F, 0xDF, 0x81, 0xFB, 0xF8, 0xFF, 0x3F, 0xFF, 0xE3, 0xFF,
+  0x7C, 0x3F, 0xCF, 0x83, 0xF1, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00,
+  0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0xF8,
+  0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0x0F, 0xC0, 0xFC, 0x0F, 0x80, 0xF8,
+  0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8,
+  0x0F, 0x80, 0xF8, 0x0F, 0x80, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x8F,
+  0xFF, 0xE7, 0xE1, 0xFB, 0xE0, 0x7D, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xE0,
+  0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x3F, 0xF0, 0x01, 0xF8, 0x40, 0x7F, 0xF0,
+  0x3E, 0xFC, 0x3F, 0x7F, 0xFF, 0x9F, 0xFF, 0x87, 0xFF, 0x80, 0xFE, 0x00,
+  0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0,
+  0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x81, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x03, 0xF0, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8,
+  0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01,
+  0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFF, 0xC0, 0xFD,
+  0xF8, 0xFF, 0x7F, 0xFF, 0xCF, 0xFD, 0xF3, 0xFE, 0x7C, 0x3E, 0x1F, 0xF8,
+  0x03, 0xFF, 0xC0, 0x3E, 0xFC, 0x07, 0xE7, 0xC0, 0x7C, 0x7C, 0x07, 0xC7,
+  0xE0, 0xFC, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x1F, 0x0F, 0x81, 0xF1, 0xF0,
+  0x1F, 0x1F, 0x00, 0xF9, 0xF0, 0x0F, 0xBE, 0x00, 0xFB, 0xE0, 0x07, 0xBC,
+  0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F,
+  0x80, 0xF8, 0x1F, 0x01, 0xFF, 0x81, 0xF8, 0x1F, 0xFC, 0x1F, 0x83, 0xF7,
+  0xC1, 0xF8, 0x3E, 0x7C, 0x1F, 0x83, 0xE7, 0xC3, 0xFC, 0x3E, 0x7C, 0x3F,
+  0xC7, 0xE3, 0xE3, 0xFC, 0x7C, 0x3E, 0x3B, 0xC7, 0xC3, 0xE7, 0x9E, 0x7C,
+  0x1E, 0x79, 0xE7, 0x81, 0xE7, 0x9E, 0xF8, 0x1F, 0x79, 0xEF, 0x81, 0xFF,
+  0x0E, 0xF8, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xE0, 0xFF,
+  0x00, 0x7E, 0x07, 0xE0, 0x07, 0xE0, 0x7E, 0x00, 0x7E, 0x07, 0xE0, 0xFC,
+  0x07, 0xCF, 0x81, 0xF8, 0xF8, 0x3E, 0x1F, 0x8F, 0x81, 0xF1, 0xF0, 0x3F,
+  0x7C, 0x03, 0xEF, 0x80, 0x3F, 0xE0, 0x07, 0xF8, 0x00, 0x7F, 0x00, 0x0F,
+  0xE0, 0x03, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0x7C, 0x07, 0xCF, 0x81, 0xF8,
+  0xF8, 0x3E, 0x1F, 0x8F, 0xC1, 0xF1, 0xF0, 0x3F, 0x7E, 0x03, 0xF0, 0xF8,
+  0x03, 0xFF, 0xC0, 0x3E, 0xFC, 0x07, 0xE7, 0xC0, 0x7C, 0x7C, 0x07, 0xC3,
+  0xE0, 0xFC, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x1F, 0x1F, 0x81, 0xF1, 0xF0,
+  0x1F, 0x1F, 0x00, 0xFB, 0xE0, 0x0F, 0xBE, 0x00, 0xFB, 0xE0, 0x07, 0xBC,
+  0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x1F,
+  0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
+  0xC0, 0x07, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x7E, 0x00, 0x7C, 0x00, 0xFC, 0x01, 0xF8, 0x03,
+  0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x1F, 0x80, 0x3F,
+  0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0xF8, 0x1F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7E, 0x07, 0xC0, 0x3E, 0x01, 0xF0,
+  0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x0F, 0xC3, 0xFC, 0x1F,
+  0xC0, 0xF8, 0x07, 0xF0, 0x3F, 0xC0, 0x3F, 0x00, 0xF8, 0x07, 0xC0, 0x3E,
+  0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x80, 0xFE, 0x03, 0xFC,
+  0x1F, 0xE0, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0x0F, 0xC0, 0xFE,
+  0x0F, 0xF0, 0x3F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x80, 0xFC, 0x0F, 0xF0, 0x7F, 0x00, 0xF0, 0x3F, 0x0F,
+  0xF0, 0xFC, 0x0F, 0x80, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x1F,
+  0x01, 0xF0, 0x3F, 0x0F, 0xF0, 0xFE, 0x0F, 0xC0, 0xF0, 0x00, 0x1E, 0x00,
+  0x1F, 0xE0, 0xF7, 0xFC, 0x3F, 0xFF, 0x9F, 0xF9, 0xFF, 0xFC, 0x3F, 0xEF,
+  0x07, 0xF0, 0x00, 0x78 };
+
+const GFXglyph Inter_Bold18pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
+  {     1,   6,  26,  12,    3,  -25 },   // 0x21 '!'
+  {    21,  13,  11,  19,    3,  -25 },   // 0x22 '"'
+  {    39,  22,  26,  23,    0,  -25 },   // 0x23 '#'
+  {   111,  21,  33,  23,    1,  -29 },   // 0x24 '$'
+  {   198,  30,  26,  36,    3,  -25 },   // 0x25 '%'
+  {   296,  23,  26,  24,    1,  -25 },   // 0x26 '&'
+  {   371,   5,  11,  12,    3,  -25 },   // 0x27 '''
+  {   378,   9,  33,  13,    3,  -27 },   // 0x28 '('
+  {   416,   9,  33,  13,    1,  -27 },   // 0x29 ')'
+  {   454,  14,  15,  20,    3,  -25 },   // 0x2A '*'
+  {   481,  18,  18,  24,    3,  -19 },   // 0x2B '+'
+  {   522,   7,  11,  12,    2,   -3 },   // 0x2C ','
+  {   532,  12,   4,  16,    2,  -12 },   // 0x2D '-'
+  {   538,   6,   6,  12,    3,   -5 },   // 0x2E '.'
+  {   543,  13,  32,  14,    0,  -27 },   // 0x2F '/'
+  {   595,  20,  26,  24,    2,  -25 },   // 0x30 '0'
+  {   660,  11,  26,  15,    2,  -25 },   // 0x31 '1'
+  {   696,  18,  26,  22,    2,  -25 },   // 0x32 '2'
+  {   755,  19,  26,  23,    2,  -25 },   // 0x33 '3'
+  {   817,  20,  26,  24,    2,  -25 },   // 0x34 '4'
+  {   882,  19,  26,  23,    2,  -25 },   // 0x35 '5'
+  {   944,  19,  26,  23,    2,  -25 },   // 0x36 '6'
+  {  1006,  18,  26,  21,    1,  -25 },   // 0x37 '7'
+  {  1065,  19,  26,  23,    2,  -25 },   // 0x38 '8'
+  {  1127,  19,  26,  23,    2,  -25 },   // 0x39 '9'
+  {  1189,   6,  19,  12,    3,  -18 },   // 0x3A ':'
+  {  1204,   7,  26,  12,    2,  -18 },   // 0x3B ';'
+  {  1227,  17,  20,  24,    3,  -19 },   // 0x3C '<'
+  {  1270,  18,  13,  24,    3,  -16 },   // 0x3D '='
+  {  1300,  17,  20,  24,    4,  -19 },   // 0x3E '>'
+  {  1343,  17,  26,  20,    1,  -25 },   // 0x3F '?'
+  {  1399,  32,  33,  36,    2,  -25 },   // 0x40 '@'
+  {  1531,  24,  26,  26,    1,  -25 },   // 0x41 'A'
+  {  1609,  20,  26,  23,    2,  -25 },   // 0x42 'B'
+  {  1674,  23,  26,  26,    2,  -25 },   // 0x43 'C'
+  {  1749,  22,  26,  25,    2,  -25 },   // 0x44 'D'
+  {  1821,  18,  26,  21,    2,  -25 },   // 0x45 'E'
+  {  1880,  17,  26,  21,    2,  -25 },   // 0x46 'F'
+  {  1936,  23,  26,  26,    2,  -25 },   // 0x47 'G'
+  {  2011,  22,  26,  26,    2,  -25 },   // 0x48 'H'
+  {  2083,   6,  26,  10,    2,  -25 },   // 0x49 'I'
+  {  2103,  17,  26,  21,    1,  -25 },   // 0x4A 'J'
+  {  2159,  22,  26,  25,    2,  -25 },   // 0x4B 'K'
+  {  2231,  17,  26,  20,    2,  -25 },   // 0x4C 'L'
+  {  2287,  29,  26,  33,    2,  -25 },   // 0x4D 'M'
+  {  2382,  23,  26,  27,    2,  -25 },   // 0x4E 'N'
+  {  2457,  24,  26,  27,    2,  -25 },   // 0x4F 'O'
+  {  2535,  20,  26,  23,    2,  -25 },   // 0x50 'P'
+  {  2600,  24,  28,  27,    2,  -25 },   // 0x51 'Q'
+  {  2684,  20,  26,  23,    2,  -25 },   // 0x52 'R'
+  {  2749,  21,  26,  23,    1,  -25 },   // 0x53 'S'
+  {  2818,  21,  26,  24,    1,  -25 },   // 0x54 'T'
+  {  2887,  22,  26,  26,    2,  -25 },   // 0x55 'U'
+  {  2959,  24,  26,  26,    1,  -25 },   // 0x56 'V'
+  {  3037,  35,  26,  37,    1,  -25 },   // 0x57 'W'
+  {  3151,  24,  26,  26,    1,  -25 },   // 0x58 'X'
+  {  3229,  24,  26,  26,    1,  -25 },   // 0x59 'Y'
+  {  3307,  19,  26,  23,    2,  -25 },   // 0x5A 'Z'
+  {  3369,   9,  33,  13,    3,  -27 },   // 0x5B '['
+  {  3407,  13,  32,  14,    0,  -27 },   // 0x5C '\'
+  {  3459,   8,  33,  13,    2,  -27 },   // 0x5D ']'
+  {  3492,  15,  12,  17,    1,  -25 },   // 0x5E '^'
+  {  3515,  17,   4,  17,    0,    1 },   // 0x5F '_'
+  {  3524,   7,   6,  13,    3,  -27 },   // 0x60 '`'
+  {  3530,  17,  20,  20,    1,  -19 },   // 0x61 'a'
+  {  3573,  19,  26,  22,    2,  -25 },   // 0x62 'b'
+  {  3635,  18,  20,  21,    1,  -19 },   // 0x63 'c'
+  {  3680,  19,  26,  22,    1,  -25 },   // 0x64 'd'
+  {  3742,  19,  20,  21,    1,  -19 },   // 0x65 'e'
+  {  3790,  14,  27,  14,    0,  -26 },   // 0x66 'f'
+  {  3838,  19,  27,  22,    1,  -19 },   // 0x67 'g'
+  {  3903,  18,  26,  22,    2,  -25 },   // 0x68 'h'
+  {  3962,   6,  27,  10,    2,  -26 },   // 0x69 'i'
+  {  3983,   9,  34,  10,   -1,  -26 },   // 0x6A 'j'
+  {  4022,  18,  26,  20,    2,  -25 },   // 0x6B 'k'
+  {  4081,   5,  26,  10,    2,  -25 },   // 0x6C 'l'
+  {  4098,  28,  20,  32,    2,  -19 },   // 0x6D 'm'
+  {  4168,  18,  20,  22,    2,  -19 },   // 0x6E 'n'
+  {  4213,  19,  20,  22,    1,  -19 },   // 0x6F 'o'
+  {  4261,  19,  27,  22,    2,  -19 },   // 0x70 'p'
+  {  4326,  19,  27,  22,    1,  -19 },   // 0x71 'q'
+  {  4391,  12,  20,  14,    2,  -19 },   // 0x72 'r'
+  {  4421,  17,  20,  20,    1,  -19 },   // 0x73 's'
+  {  4464,  12,  25,  13,    0,  -24 },   // 0x74 't'
+  {  4502,  18,  20,  22,    2,  -19 },   // 0x75 'u'
+  {  4547,  20,  20,  21,    1,  -19 },   // 0x76 'v'
+  {  4597,  28,  20,  30,    1,  -19 },   // 0x77 'w'
+  {  4667,  19,  20,  20,    1,  -19 },   // 0x78 'x'
+  {  4715,  20,  27,  21,    1,  -19 },   // 0x79 'y'
+  {  4783,  16,  20,  20,    2,  -19 },   // 0x7A 'z'
+  {  4823,  13,  33,  17,    2,  -27 },   // 0x7B '{'
+  {  4877,   5,  43,  13,    4,  -34 },   // 0x7C '|'
+  {  4904,  12,  33,  17,    2,  -27 },   // 0x7D '}'
+  {  4954,  18,   8,  24,    3,  -14 } }; // 0x7E '~'
+
+const GFXfont Inter_Bold18pt7b PROGMEM = {
+  (uint8_t  *)Inter_Bold18pt7bBitmaps,
+  (GFXglyph *)Inter_Bold18pt7bGlyphs,
+  0x20, 0x7E, 43 };
+
+// Approx. 5644 bytes
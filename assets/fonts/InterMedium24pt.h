@@ -0,0 +1,772 @@
+const uint8_t Inter_Medium24pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFD, 0xFB, 0xF7, 0xEF, 0xDF, 0xBF, 0x7E, 0xFD, 0xF9, 0xF3, 0xE7,
+  0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x00, 0x00, 0x00,
+  0x03, 0xCF, 0xDF, 0xBF, 0xFE, 0xFC, 0xF0, 0xF8, 0x7F, 0xE1, 0xFF, 0x87,
+  0xFE, 0x1F, 0xF8, 0x7F, 0xE1, 0xFF, 0x87, 0xFE, 0x1F, 0xF8, 0x7F, 0xE1,
+  0xFF, 0x07, 0xBC, 0x1E, 0xF0, 0x78, 0x00, 0x78, 0x07, 0x80, 0x07, 0x80,
+  0x78, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00,
+  0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x1F, 0x01, 0xF0, 0x01, 0xE0,
+  0x1E, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+  0x3F, 0xFF, 0xFF, 0xF0, 0x3E, 0x01, 0xE0, 0x03, 0xC0, 0x3C, 0x00, 0x3C,
+  0x03, 0xC0, 0x03, 0xC0, 0x3C, 0x00, 0x3C, 0x03, 0xC0, 0x03, 0xC0, 0x3C,
+  0x00, 0x3C, 0x03, 0xC0, 0x07, 0x80, 0x78, 0x0F, 0xFF, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xC0, 0x78, 0x07,
+  0x80, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00,
+  0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x1E, 0x01,
+  0xE0, 0x01, 0xE0, 0x1E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x80, 0x00,
+  0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0xF0,
+  0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x07, 0xFB,
+  0xFF, 0xC3, 0xF8, 0xE3, 0xF8, 0xFC, 0x38, 0x7E, 0x3E, 0x0E, 0x0F, 0x9F,
+  0x83, 0x83, 0xE7, 0xE0, 0xE0, 0x01, 0xF8, 0x38, 0x00, 0x3E, 0x0E, 0x00,
+  0x0F, 0xC3, 0x80, 0x03, 0xFC, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFF,
+  0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00,
+  0x0F, 0xFF, 0x00, 0x03, 0x8F, 0xE0, 0x00, 0xE1, 0xF8, 0x00, 0x38, 0x3F,
+  0x00, 0x0E, 0x07, 0xFF, 0x03, 0x81, 0xF7, 0xC0, 0xE0, 0x7D, 0xF0, 0x38,
+  0x3F, 0x7E, 0x0E, 0x0F, 0x9F, 0xC3, 0x8F, 0xE3, 0xFE, 0xEF, 0xF0, 0x7F,
+  0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xE0,
+  0x00, 0x00, 0x38, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x01, 0xFF, 0x80, 0x00,
+  0xF0, 0x1F, 0xFE, 0x00, 0x0F, 0x00, 0xF0, 0xF0, 0x00, 0xF8, 0x0F, 0x07,
+  0xC0, 0x07, 0x80, 0x78, 0x1E, 0x00, 0x78, 0x03, 0xC0, 0xF0, 0x07, 0xC0,
+  0x1E, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x3C, 0x03, 0xC0, 0x07, 0x81, 0xE0,
+  0x3E, 0x00, 0x3C, 0x1F, 0x01, 0xE0, 0x00, 0xF0, 0xF0, 0x1E, 0x00, 0x07,
+  0xFF, 0x01, 0xE0, 0x00, 0x1F, 0xF8, 0x0F, 0x00, 0x00, 0x3F, 0x00, 0xF0,
+  0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
+  0x07, 0x80, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x3F,
+  0x00, 0x00, 0x3C, 0x07, 0xFC, 0x00, 0x03, 0xC0, 0x7F, 0xF0, 0x00, 0x3E,
+  0x03, 0xC3, 0xC0, 0x01, 0xE0, 0x3C, 0x1E, 0x00, 0x1E, 0x01, 0xE0, 0x78,
+  0x01, 0xE0, 0x0F, 0x03, 0xC0, 0x0F, 0x00, 0x78, 0x1E, 0x00, 0xF0, 0x03,
+  0xC0, 0xF0, 0x0F, 0x00, 0x1E, 0x07, 0x80, 0xF8, 0x00, 0xF0, 0x7C, 0x07,
+  0x80, 0x07, 0xC3, 0xC0, 0x78, 0x00, 0x1F, 0xFE, 0x07, 0xC0, 0x00, 0x7F,
+  0xE0, 0x7C, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xFE,
+  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00,
+  0x0F, 0xC7, 0xF0, 0x01, 0xF8, 0x1F, 0x00, 0x1F, 0x01, 0xF0, 0x01, 0xF0,
+  0x0F, 0x00, 0x1F, 0x00, 0xF0, 0x01, 0xF0, 0x1F, 0x00, 0x0F, 0x03, 0xE0,
+  0x00, 0xF8, 0x7E, 0x00, 0x07, 0xCF, 0xC0, 0x00, 0x7D, 0xF8, 0x00, 0x03,
+  0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xE0,
+  0x00, 0x1F, 0xFE, 0x03, 0xC3, 0xFB, 0xF0, 0x7C, 0x7E, 0x1F, 0x87, 0xC7,
+  0xC0, 0xFC, 0x7C, 0xFC, 0x07, 0xE7, 0xCF, 0x80, 0x3F, 0xF8, 0xF8, 0x01,
+  0xFF, 0x8F, 0x80, 0x1F, 0xF8, 0xFC, 0x00, 0xFF, 0x07, 0xC0, 0x07, 0xE0,
+  0x7E, 0x00, 0xFF, 0x03, 0xF8, 0x7F, 0xF8, 0x3F, 0xFF, 0xFF, 0x81, 0xFF,
+  0xFF, 0xFC, 0x07, 0xFF, 0xC7, 0xE0, 0x1F, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFD, 0xEF, 0x00, 0x07, 0xC1, 0xF0, 0xF8, 0x3E, 0x1F,
+  0x07, 0xC1, 0xF0, 0xF8, 0x3E, 0x0F, 0x87, 0xC1, 0xF0, 0x7C, 0x1F, 0x0F,
+  0xC3, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0,
+  0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F,
+  0x83, 0xE0, 0xF8, 0x3F, 0x07, 0xC1, 0xF0, 0x3E, 0x0F, 0x81, 0xF0, 0x7C,
+  0xF8, 0x0F, 0x81, 0xF0, 0x3F, 0x03, 0xE0, 0x7C, 0x07, 0xC0, 0xF8, 0x1F,
+  0x01, 0xF0, 0x3E, 0x07, 0xC0, 0xFC, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0,
+  0xF8, 0x1F, 0x83, 0xF0, 0x7E, 0x07, 0xC0, 0xF8, 0x1F, 0x07, 0xE0, 0xFC,
+  0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x7E, 0x0F, 0x81, 0xF0, 0x7E,
+  0x0F, 0x81, 0xF0, 0x7E, 0x0F, 0x81, 0xF0, 0x7C, 0x0F, 0x83, 0xE0, 0x00,
+  0x01, 0xE0, 0x00, 0x78, 0x00, 0x0E, 0x01, 0x03, 0x82, 0x70, 0xE1, 0xBE,
+  0x39, 0xFF, 0xEF, 0xFC, 0xFF, 0xFC, 0x0F, 0xFC, 0x00, 0xFC, 0x00, 0xFF,
+  0xC0, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0x39, 0xF7, 0x0E, 0x39, 0x03, 0x82,
+  0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8,
+  0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80,
+  0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01,
+  0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F,
+  0x00, 0x00, 0x3E, 0xFD, 0xF3, 0xE7, 0xCF, 0x9E, 0x3C, 0xF9, 0xE3, 0xC7,
+  0x8F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x79, 0xFB,
+  0xF7, 0xFF, 0xDF, 0x9E, 0x00, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x01,
+  0xF0, 0x03, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xF0,
+  0x03, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF0, 0x03,
+  0xE0, 0x07, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xE0,
+  0x03, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xF0, 0x03,
+  0xE0, 0x07, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xE0,
+  0x07, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x00, 0xFF,
+  0x00, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x01, 0xFC,
+  0x3F, 0x81, 0xFC, 0x07, 0xE0, 0xF8, 0x01, 0xF8, 0xFC, 0x00, 0x7C, 0x7C,
+  0x00, 0x3E, 0x3E, 0x00, 0x1F, 0xBE, 0x00, 0x07, 0xDF, 0x00, 0x03, 0xEF,
+  0x80, 0x01, 0xF7, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F,
+  0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03,
+  0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xFB, 0xE0, 0x00, 0x7D, 0xF0, 0x00,
+  0x3E, 0xFC, 0x00, 0x3F, 0x3E, 0x00, 0x1F, 0x9F, 0x80, 0x0F, 0x87, 0xC0,
+  0x0F, 0xC3, 0xF0, 0x0F, 0xC0, 0xFE, 0x1F, 0xE0, 0x3F, 0xFF, 0xE0, 0x0F,
+  0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFC, 0x0F,
+  0xF0, 0xFF, 0xC7, 0xFF, 0x3F, 0xFF, 0xFD, 0xFF, 0xC7, 0xFE, 0x1F, 0xE0,
+  0x7F, 0x01, 0xF8, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0,
+  0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0,
+  0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C,
+  0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0xFE, 0x00,
+  0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x83, 0xF8, 0x7F, 0x8F,
+  0xC0, 0x3F, 0x1F, 0x00, 0x3F, 0x3E, 0x00, 0x3E, 0xF8, 0x00, 0x7D, 0xF0,
+  0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00,
+  0x1F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
+  0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0,
+  0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
+  0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F,
+  0xC3, 0xF8, 0x7E, 0x00, 0xFC, 0x7C, 0x00, 0x7C, 0x7C, 0x00, 0x7E, 0xF8,
+  0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00,
+  0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x7E, 0x7E,
+  0x00, 0xFE, 0x7F, 0xC3, 0xFC, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x07,
+  0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00,
+  0x01, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0,
+  0x00, 0xFF, 0xE0, 0x00, 0x7D, 0xF0, 0x00, 0x7C, 0xF8, 0x00, 0x7E, 0x7C,
+  0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x1F, 0x00, 0x3F, 0x0F, 0x80, 0x1F, 0x07,
+  0xC0, 0x1F, 0x03, 0xE0, 0x0F, 0x81, 0xF0, 0x0F, 0x80, 0xF8, 0x0F, 0xC0,
+  0x7C, 0x07, 0xC0, 0x3E, 0x07, 0xC0, 0x1F, 0x07, 0xE0, 0x0F, 0x83, 0xE0,
+  0x07, 0xC3, 0xE0, 0x03, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80,
+  0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x7C, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF,
+  0xF1, 0xFF, 0xFF, 0xE3, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00,
+  0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01,
+  0xE3, 0xF8, 0x07, 0xDF, 0xFC, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x3F,
+  0xE3, 0xFC, 0x7E, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00,
+  0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00,
+  0x1F, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x7D, 0xF0, 0x01, 0xFB, 0xF0, 0x03,
+  0xE7, 0xF0, 0x0F, 0xC7, 0xF8, 0xFF, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xF0,
+  0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xE0,
+  0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x1F, 0xE1, 0xFC, 0x1F, 0x00, 0x7E,
+  0x3E, 0x00, 0x3E, 0x7E, 0x00, 0x3F, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF8, 0x3F, 0x80, 0xF8, 0xFF, 0xE0, 0xF9, 0xFF, 0xF0,
+  0xFB, 0xFF, 0xF8, 0xFF, 0xE3, 0xFC, 0xFF, 0x00, 0xFE, 0xFE, 0x00, 0x7E,
+  0xFC, 0x00, 0x3E, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0x7C, 0x00, 0x3F,
+  0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x3F, 0x00, 0xFC, 0x1F, 0xC3, 0xFC,
+  0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x00, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00,
+  0x01, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F,
+  0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xE0,
+  0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF8, 0x00,
+  0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x7E,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F,
+  0xFF, 0xF8, 0x3F, 0xC3, 0xFC, 0x7F, 0x00, 0xFC, 0x7E, 0x00, 0x7C, 0x7C,
+  0x00, 0x7E, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x7C, 0x7E,
+  0x00, 0x7C, 0x3F, 0x00, 0xFC, 0x1F, 0xC3, 0xF8, 0x0F, 0xFF, 0xF0, 0x03,
+  0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0x81, 0xFC, 0x7E,
+  0x00, 0xFE, 0xFC, 0x00, 0x7E, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8,
+  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFC,
+  0x00, 0x7E, 0x7E, 0x00, 0xFE, 0x7F, 0xC3, 0xFC, 0x3F, 0xFF, 0xF8, 0x1F,
+  0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x07,
+  0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x3F, 0xC7, 0xF8, 0x7F,
+  0x01, 0xFC, 0x7C, 0x00, 0x7C, 0xFC, 0x00, 0x7E, 0xF8, 0x00, 0x3E, 0xF8,
+  0x00, 0x3E, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8,
+  0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0x7E, 0x01, 0xFF, 0x7F,
+  0xC7, 0xFF, 0x3F, 0xFF, 0xDF, 0x1F, 0xFF, 0x9F, 0x07, 0xFF, 0x1F, 0x01,
+  0xF8, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0xF8,
+  0x00, 0x7C, 0xFC, 0x00, 0x7C, 0x7C, 0x00, 0xFC, 0x7E, 0x01, 0xF8, 0x3F,
+  0x87, 0xF0, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x01,
+  0xFE, 0x00, 0x79, 0xFB, 0xF7, 0xFF, 0xDF, 0x9E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE7, 0xEF, 0xDF, 0xFF, 0x7E, 0x78,
+  0x1E, 0x1F, 0x8F, 0xC7, 0xF3, 0xF1, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE3,
+  0xF1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1E, 0x0F, 0x0F, 0x87, 0x83, 0xC1, 0xE0,
+  0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x70, 0x00, 0x07, 0xC0, 0x00,
+  0x7F, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0xFF, 0xE0,
+  0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFC,
+  0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
+  0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFC,
+  0x00, 0x07, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
+  0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
+  0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00,
+  0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0xFF, 0xC0,
+  0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0xC0, 0x00, 0x00,
+  0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0xC3, 0xFF, 0xFE, 0x7F, 0x8F,
+  0xE7, 0xE0, 0x3F, 0xFC, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xF0, 0x00,
+  0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00,
+  0x1F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00,
+  0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0xF0,
+  0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x1E,
+  0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
+  0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xF8,
+  0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x0F,
+  0xC0, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x1F,
+  0x80, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x1F,
+  0xC7, 0x87, 0xC7, 0xC0, 0x3F, 0xF3, 0xC1, 0xF3, 0xC0, 0x3F, 0xFD, 0xE0,
+  0xFB, 0xE0, 0x3F, 0xFF, 0xF0, 0x3D, 0xF0, 0x3F, 0x07, 0xF8, 0x1E, 0xF8,
+  0x1F, 0x00, 0xFC, 0x0F, 0x78, 0x1F, 0x00, 0x3E, 0x07, 0xFC, 0x0F, 0x00,
+  0x1F, 0x03, 0xFE, 0x07, 0x80, 0x0F, 0x81, 0xFF, 0x03, 0xC0, 0x07, 0xC0,
+  0xFF, 0x81, 0xE0, 0x01, 0xE0, 0x7F, 0xC0, 0xF0, 0x00, 0xF0, 0x3D, 0xE0,
+  0x78, 0x00, 0xF8, 0x1E, 0xF0, 0x3C, 0x00, 0x7C, 0x0F, 0x78, 0x1F, 0x00,
+  0x3E, 0x07, 0xBE, 0x0F, 0x80, 0x3F, 0x07, 0xDF, 0x03, 0xE0, 0x1F, 0x83,
+  0xCF, 0x81, 0xFC, 0x3F, 0xE3, 0xE3, 0xC0, 0x7F, 0xFD, 0xFF, 0xF1, 0xF0,
+  0x1F, 0xFE, 0xFF, 0xF0, 0xF8, 0x07, 0xFE, 0x3F, 0xF0, 0x3E, 0x00, 0xFC,
+  0x07, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
+  0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xE0, 0x00, 0x20, 0x00, 0x0F, 0xFF, 0x01, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
+  0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F,
+  0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xEF,
+  0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x1F, 0x7E,
+  0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x01, 0xF1, 0xF8,
+  0x00, 0x07, 0xC1, 0xF0, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x3F, 0x07, 0xE0,
+  0x00, 0x7C, 0x07, 0xC0, 0x00, 0xF8, 0x0F, 0x80, 0x03, 0xF0, 0x1F, 0x80,
+  0x07, 0xE0, 0x1F, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x7E, 0x00,
+  0x7C, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x07,
+  0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x7C,
+  0x00, 0x07, 0xC1, 0xF8, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x0F, 0x87, 0xC0,
+  0x00, 0x1F, 0x9F, 0x80, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3E, 0x7C, 0x00,
+  0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0x03, 0xFC, 0xF8, 0x00, 0xFE,
+  0xF8, 0x00, 0x7E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E,
+  0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x7C, 0xF8, 0x00, 0xFC,
+  0xF8, 0x03, 0xF8, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xFC, 0xF8, 0x01, 0xFE, 0xF8, 0x00, 0x7E, 0xF8, 0x00, 0x3F,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF8, 0x01, 0xFE,
+  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x80,
+  0x00, 0x1F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x0F,
+  0xFF, 0xFF, 0x00, 0xFF, 0x87, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0xFE, 0x00,
+  0x1F, 0xC7, 0xE0, 0x00, 0x7E, 0x7E, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x0F,
+  0xDF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C,
+  0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
+  0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
+  0x80, 0x00, 0x1F, 0x7C, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x0F, 0x8F, 0xC0,
+  0x00, 0xFC, 0x7F, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0xFE, 0x07, 0xFC, 0x3F,
+  0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFC, 0x03, 0xFF,
+  0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x0F, 0x80, 0x3F, 0xE1, 0xF0, 0x00, 0xFE,
+  0x3E, 0x00, 0x0F, 0xE7, 0xC0, 0x00, 0xFC, 0xF8, 0x00, 0x0F, 0xDF, 0x00,
+  0x00, 0xFB, 0xE0, 0x00, 0x1F, 0x7C, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F,
+  0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00,
+  0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
+  0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00,
+  0x3E, 0xF8, 0x00, 0x07, 0xDF, 0x00, 0x01, 0xFB, 0xE0, 0x00, 0x7E, 0x7C,
+  0x00, 0x1F, 0xCF, 0x80, 0x07, 0xF1, 0xF0, 0x0F, 0xFC, 0x3F, 0xFF, 0xFF,
+  0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
+  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03,
+  0xE0, 0x00, 0x1F, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF,
+  0xFD, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F,
+  0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00,
+  0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F,
+  0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00,
+  0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xFF,
+  0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0x80, 0x00,
+  0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
+  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03,
+  0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
+  0x1F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
+  0xFF, 0x00, 0xFF, 0x87, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0xFE, 0x00, 0x1F,
+  0xC7, 0xE0, 0x00, 0x7E, 0x7E, 0x00, 0x01, 0xFB, 0xE0, 0x00, 0x0F, 0xDF,
+  0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFF,
+  0xFF, 0xC0, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
+  0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x80,
+  0x00, 0x1F, 0x7C, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x0F, 0xCF, 0xC0, 0x00,
+  0xFC, 0x7F, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0xFE, 0x07, 0xFC, 0x3F, 0xE0,
+  0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00,
+  0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE,
+  0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00,
+  0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0,
+  0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x80,
+  0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F,
+  0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00,
+  0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF,
+  0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7C, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00,
+  0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C,
+  0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00,
+  0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0,
+  0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01,
+  0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8,
+  0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x3E, 0xF8, 0x03, 0xF7, 0xE0, 0x3F,
+  0x3F, 0xC7, 0xF8, 0xFF, 0xFF, 0x83, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x0F,
+  0xE0, 0x00, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0xFE,
+  0x7C, 0x00, 0x3F, 0x8F, 0x80, 0x0F, 0xE1, 0xF0, 0x03, 0xF8, 0x3E, 0x00,
+  0xFE, 0x07, 0xC0, 0x3F, 0x80, 0xF8, 0x07, 0xE0, 0x1F, 0x01, 0xF8, 0x03,
+  0xE0, 0x7E, 0x00, 0x7C, 0x1F, 0xC0, 0x0F, 0x87, 0xF0, 0x01, 0xF1, 0xFC,
+  0x00, 0x3E, 0x7F, 0x00, 0x07, 0xCF, 0xE0, 0x00, 0xFB, 0xFE, 0x00, 0x1F,
+  0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xCF, 0xC0, 0x0F, 0xF1, 0xF8,
+  0x01, 0xFC, 0x1F, 0x80, 0x3F, 0x01, 0xF8, 0x07, 0xC0, 0x3F, 0x80, 0xF8,
+  0x03, 0xF0, 0x1F, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0, 0x7C, 0x00, 0x7E,
+  0x0F, 0x80, 0x07, 0xE1, 0xF0, 0x00, 0x7E, 0x3E, 0x00, 0x0F, 0xE7, 0xC0,
+  0x00, 0xFC, 0xF8, 0x00, 0x0F, 0xDF, 0x00, 0x01, 0xFC, 0xF8, 0x00, 0x07,
+  0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00,
+  0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E,
+  0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00,
+  0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0,
+  0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00,
+  0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80,
+  0x00, 0x7C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+  0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x03,
+  0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
+  0x03, 0xDF, 0xFB, 0xE0, 0x00, 0xFB, 0xFF, 0x7C, 0x00, 0x1F, 0x7F, 0xEF,
+  0xC0, 0x07, 0xCF, 0xFC, 0xF8, 0x00, 0xF9, 0xFF, 0x9F, 0x00, 0x1F, 0x3F,
+  0xF3, 0xF0, 0x07, 0xE7, 0xFE, 0x3E, 0x00, 0xF8, 0xFF, 0xC7, 0xC0, 0x1F,
+  0x1F, 0xF8, 0xFC, 0x07, 0xC3, 0xFF, 0x0F, 0x80, 0xF8, 0x7F, 0xE1, 0xF8,
+  0x3F, 0x0F, 0xFC, 0x1F, 0x07, 0xC1, 0xFF, 0x83, 0xE0, 0xF8, 0x3F, 0xF0,
+  0x7E, 0x3F, 0x07, 0xFE, 0x07, 0xC7, 0xC0, 0xFF, 0xC0, 0xF8, 0xF8, 0x1F,
+  0xF8, 0x1F, 0x3E, 0x03, 0xFF, 0x01, 0xF7, 0xC0, 0x7F, 0xE0, 0x3E, 0xF8,
+  0x0F, 0xFC, 0x03, 0xDE, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x3F, 0xF0, 0x0F,
+  0xF0, 0x07, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xC0, 0x1F, 0xF8,
+  0x01, 0xF0, 0x03, 0xFF, 0x00, 0x3E, 0x00, 0x7C, 0xFC, 0x00, 0x03, 0xFF,
+  0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80,
+  0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x3F,
+  0xFB, 0xE0, 0x03, 0xFF, 0xBF, 0x00, 0x3F, 0xF9, 0xF8, 0x03, 0xFF, 0x9F,
+  0x80, 0x3F, 0xF8, 0xFC, 0x03, 0xFF, 0x87, 0xC0, 0x3F, 0xF8, 0x7E, 0x03,
+  0xFF, 0x83, 0xF0, 0x3F, 0xF8, 0x3F, 0x03, 0xFF, 0x81, 0xF8, 0x3F, 0xF8,
+  0x0F, 0xC3, 0xFF, 0x80, 0xFC, 0x3F, 0xF8, 0x07, 0xE3, 0xFF, 0x80, 0x3E,
+  0x3F, 0xF8, 0x03, 0xF3, 0xFF, 0x80, 0x1F, 0x9F, 0xF8, 0x00, 0xF9, 0xFF,
+  0x80, 0x0F, 0xDF, 0xF8, 0x00, 0x7D, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x00,
+  0x3F, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xFF,
+  0xF8, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x00, 0x03,
+  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xF8,
+  0x7F, 0xC0, 0x7F, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x7F, 0x0F, 0xC0, 0x00,
+  0xFC, 0x7E, 0x00, 0x01, 0xF9, 0xF0, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0x0F,
+  0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF,
+  0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xE0,
+  0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00,
+  0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00,
+  0x3E, 0x7C, 0x00, 0x00, 0xF9, 0xF8, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x3F,
+  0x0F, 0xE0, 0x01, 0xFC, 0x1F, 0xC0, 0x0F, 0xE0, 0x3F, 0xE1, 0xFF, 0x00,
+  0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x00,
+  0x7F, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0,
+  0xFF, 0xFF, 0xF8, 0xF8, 0x03, 0xFC, 0xF8, 0x00, 0xFE, 0xF8, 0x00, 0x7E,
+  0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x1F,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3E,
+  0xF8, 0x00, 0x7E, 0xF8, 0x00, 0xFE, 0xF8, 0x03, 0xFC, 0xFF, 0xFF, 0xF8,
+  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0,
+  0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0,
+  0x0F, 0xF8, 0x7F, 0xC0, 0x7F, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x7F, 0x0F,
+  0xC0, 0x00, 0xFC, 0x7E, 0x00, 0x01, 0xF9, 0xF0, 0x00, 0x03, 0xE7, 0xC0,
+  0x00, 0x0F, 0xBF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00,
+  0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
+  0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F,
+  0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
+  0x01, 0xF8, 0x3F, 0x7C, 0x03, 0xF0, 0xF9, 0xF8, 0x07, 0xC7, 0xE3, 0xF0,
+  0x0F, 0xBF, 0x0F, 0xE0, 0x1F, 0xFC, 0x1F, 0xC0, 0x3F, 0xE0, 0x3F, 0xE1,
+  0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
+  0xC0, 0x00, 0x7F, 0x8F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E,
+  0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
+  0x0F, 0x80, 0x3F, 0xC7, 0xC0, 0x07, 0xF3, 0xE0, 0x01, 0xF9, 0xF0, 0x00,
+  0x7E, 0xF8, 0x00, 0x3F, 0x7C, 0x00, 0x1F, 0xBE, 0x00, 0x07, 0xDF, 0x00,
+  0x03, 0xEF, 0x80, 0x03, 0xF7, 0xC0, 0x01, 0xFB, 0xE0, 0x01, 0xF9, 0xF0,
+  0x01, 0xFC, 0xF8, 0x03, 0xFC, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F,
+  0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x07, 0xC0, 0x3E, 0x03, 0xE0, 0x1F, 0x81,
+  0xF0, 0x07, 0xC0, 0xF8, 0x03, 0xF0, 0x7C, 0x00, 0xFC, 0x3E, 0x00, 0x7E,
+  0x1F, 0x00, 0x1F, 0x8F, 0x80, 0x0F, 0xC7, 0xC0, 0x03, 0xF3, 0xE0, 0x01,
+  0xF9, 0xF0, 0x00, 0x7E, 0xF8, 0x00, 0x3F, 0x7C, 0x00, 0x0F, 0xC0, 0x00,
+  0x7F, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8,
+  0x1F, 0xE0, 0xFF, 0x0F, 0xE0, 0x0F, 0xE3, 0xF0, 0x01, 0xF8, 0xF8, 0x00,
+  0x3E, 0x7E, 0x00, 0x0F, 0x9F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00,
+  0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF,
+  0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xE0, 0x00,
+  0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xF7,
+  0xC0, 0x00, 0xFD, 0xF8, 0x00, 0x3E, 0x7F, 0x00, 0x1F, 0x8F, 0xE0, 0x1F,
+  0xE1, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x00, 0x7F,
+  0xFC, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x3E,
+  0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0,
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
+  0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80,
+  0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
+  0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07,
+  0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00,
+  0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00,
+  0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF,
+  0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00,
+  0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE,
+  0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00,
+  0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0,
+  0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x07,
+  0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0x3F, 0x00, 0x07, 0xE7, 0xF0,
+  0x01, 0xF8, 0x7F, 0x80, 0xFF, 0x07, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0,
+  0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x00, 0xFC,
+  0x00, 0x00, 0x7E, 0xF8, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x01, 0xF3, 0xF0,
+  0x00, 0x07, 0xE3, 0xE0, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x1F, 0x07, 0xC0,
+  0x00, 0x7E, 0x0F, 0x80, 0x00, 0xF8, 0x1F, 0x80, 0x01, 0xF0, 0x1F, 0x00,
+  0x07, 0xE0, 0x3F, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x1F, 0x00, 0x7C, 0x00,
+  0x7E, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xF0, 0x01, 0xF0, 0x07,
+  0xE0, 0x03, 0xF0, 0x0F, 0x80, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xC0, 0x7E,
+  0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x1F, 0x07, 0xC0,
+  0x00, 0x3F, 0x0F, 0x80, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x7C, 0x7C, 0x00,
+  0x00, 0xFC, 0xF8, 0x00, 0x00, 0xF9, 0xF0, 0x00, 0x01, 0xF7, 0xC0, 0x00,
+  0x01, 0xEF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
+  0x07, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFC,
+  0x00, 0x0F, 0xC0, 0x01, 0xFB, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xDF, 0x00,
+  0x07, 0xF0, 0x00, 0x7C, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xE7, 0xE0, 0x01,
+  0xFE, 0x00, 0x3F, 0x1F, 0x00, 0x1F, 0xF0, 0x01, 0xF0, 0xF8, 0x00, 0xFF,
+  0x80, 0x0F, 0x87, 0xE0, 0x07, 0xBC, 0x00, 0xFC, 0x3F, 0x00, 0x7D, 0xF0,
+  0x07, 0xE0, 0xF8, 0x03, 0xEF, 0x80, 0x3E, 0x07, 0xC0, 0x1F, 0x7C, 0x01,
+  0xF0, 0x3F, 0x00, 0xF9, 0xE0, 0x1F, 0x80, 0xF8, 0x0F, 0x8F, 0x80, 0xFC,
+  0x07, 0xC0, 0x7C, 0x7C, 0x07, 0xC0, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x01,
+  0xF8, 0x1F, 0x0F, 0x03, 0xF0, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x00, 0x3E,
+  0x0F, 0x83, 0xE0, 0xF8, 0x01, 0xF0, 0x7C, 0x1F, 0x07, 0xC0, 0x0F, 0xC3,
+  0xC0, 0x78, 0x7E, 0x00, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x01, 0xF1, 0xF0,
+  0x1F, 0x1F, 0x00, 0x0F, 0x8F, 0x80, 0xF8, 0xF8, 0x00, 0x3E, 0x78, 0x03,
+  0xC7, 0xC0, 0x01, 0xF7, 0xC0, 0x1F, 0x7C, 0x00, 0x0F, 0xBE, 0x00, 0xFB,
+  0xE0, 0x00, 0x7D, 0xF0, 0x03, 0xDF, 0x00, 0x01, 0xEF, 0x00, 0x1E, 0xF0,
+  0x00, 0x0F, 0x78, 0x00, 0xF7, 0x80, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
+  0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x00,
+  0x7F, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x7F,
+  0x00, 0x00, 0xFC, 0x7E, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x0F, 0xC0, 0x7E,
+  0x00, 0x1F, 0x80, 0xFC, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0xFC,
+  0x03, 0xE0, 0x01, 0xF8, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF0,
+  0x7C, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x03, 0xEF,
+  0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xF0,
+  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
+  0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x0F, 0xDF, 0x80,
+  0x00, 0x3F, 0x1F, 0x80, 0x00, 0x7E, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00,
+  0x07, 0xE0, 0x3F, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x3F, 0x00, 0x7E, 0x00,
+  0xFC, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0xFE, 0x07, 0xE0, 0x00, 0xFC, 0x1F,
+  0x80, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x01, 0xFC, 0xFE,
+  0x00, 0x00, 0xFE, 0xFC, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x07, 0xE1, 0xF8,
+  0x00, 0x1F, 0x81, 0xF8, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0xFC, 0x03, 0xF0,
+  0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0x80, 0x07, 0xE0,
+  0x3F, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x0F, 0xC7,
+  0xE0, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x1F, 0x7C,
+  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0x80,
+  0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
+  0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
+  0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00,
+  0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+  0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00,
+  0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x01,
+  0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0F,
+  0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3E,
+  0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83,
+  0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8,
+  0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F,
+  0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8,
+  0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00,
+  0x1E, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x78, 0x00, 0xF8, 0x01, 0xF0, 0x01,
+  0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3E,
+  0x00, 0x7C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0,
+  0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x7C, 0x00,
+  0x78, 0x00, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x0F,
+  0x80, 0x0F, 0x00, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x78, 0x3C, 0x1E,
+  0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83,
+  0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0,
+  0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xE0,
+  0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x1F, 0x78, 0x03, 0xCF, 0x80, 0xF8, 0xF0,
+  0x1E, 0x1E, 0x07, 0xC1, 0xE0, 0xF0, 0x3C, 0x3E, 0x03, 0xC7, 0x80, 0x78,
+  0xF0, 0x0F, 0xBE, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x7C, 0x3C, 0x3E, 0x1E, 0x0F, 0x01,
+  0xFE, 0x00, 0x3F, 0xFE, 0x07, 0xFF, 0xF8, 0x7F, 0xFF, 0xE3, 0xF8, 0x7F,
+  0x3F, 0x00, 0xFD, 0xF0, 0x03, 0xE1, 0x80, 0x1F, 0x00, 0x00, 0xF8, 0x00,
+  0x07, 0xC0, 0x00, 0x7E, 0x03, 0xFF, 0xF0, 0xFF, 0xFF, 0x9F, 0xFF, 0xFD,
+  0xFF, 0xC3, 0xEF, 0xC0, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00,
+  0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x1F, 0xFE, 0x03, 0xFD, 0xFF, 0xFF, 0xEF,
+  0xFF, 0xDF, 0x3F, 0xFC, 0xF8, 0x7F, 0xC7, 0xC0, 0x20, 0x00, 0xF8, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x3F,
+  0x00, 0xF8, 0xFF, 0xE0, 0xF9, 0xFF, 0xF0, 0xFB, 0xFF, 0xF8, 0xFB, 0xC3,
+  0xFC, 0xFF, 0x00, 0xFC, 0xFE, 0x00, 0x7E, 0xFE, 0x00, 0x7E, 0xFC, 0x00,
+  0x3E, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
+  0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00,
+  0x3F, 0xFC, 0x00, 0x3E, 0xFE, 0x00, 0x7E, 0xFE, 0x00, 0x7E, 0xFF, 0x00,
+  0xFC, 0xFF, 0xC3, 0xFC, 0xFB, 0xFF, 0xF8, 0xF9, 0xFF, 0xF0, 0xF8, 0xFF,
+  0xE0, 0xF8, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFF,
+  0xC0, 0x7F, 0xFF, 0xC1, 0xFC, 0x3F, 0xC7, 0xE0, 0x1F, 0x8F, 0x80, 0x1F,
+  0xBF, 0x00, 0x1F, 0x7C, 0x00, 0x20, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07,
+  0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E,
+  0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0xF3, 0xF0,
+  0x03, 0xF3, 0xF0, 0x07, 0xC7, 0xF0, 0x3F, 0x87, 0xFF, 0xFE, 0x07, 0xFF,
+  0xF8, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0xFC,
+  0x1F, 0x07, 0xFF, 0x1F, 0x0F, 0xFF, 0x9F, 0x1F, 0xFF, 0xDF, 0x3F, 0xC3,
+  0xDF, 0x3F, 0x00, 0xFF, 0x7E, 0x00, 0x7F, 0x7E, 0x00, 0x7F, 0x7C, 0x00,
+  0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
+  0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00,
+  0x3F, 0x7C, 0x00, 0x3F, 0x7E, 0x00, 0x7F, 0x7E, 0x00, 0x7F, 0x3F, 0x00,
+  0xFF, 0x3F, 0xC3, 0xFF, 0x1F, 0xFF, 0xDF, 0x0F, 0xFF, 0x9F, 0x07, 0xFF,
+  0x1F, 0x00, 0xFC, 0x1F, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFF,
+  0x80, 0x7F, 0xFF, 0x81, 0xFC, 0x3F, 0x87, 0xE0, 0x1F, 0x8F, 0x80, 0x1F,
+  0x3E, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0,
+  0x01, 0xC3, 0xF0, 0x07, 0xE7, 0xF0, 0x1F, 0x87, 0xFF, 0xFF, 0x07, 0xFF,
+  0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x20, 0x00, 0x00, 0x3F,
+  0x80, 0x7F, 0xC0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0x10, 0x3F, 0x00, 0x1F,
+  0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x3F, 0xFF, 0xDF, 0xFF, 0xEF,
+  0xFF, 0xF7, 0xFF, 0xF8, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0,
+  0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F,
+  0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00,
+  0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0,
+  0x00, 0xF8, 0x00, 0x00, 0xFC, 0x1F, 0x03, 0xFF, 0x1F, 0x0F, 0xFF, 0x9F,
+  0x1F, 0xFF, 0xDF, 0x1F, 0xC3, 0xDF, 0x3F, 0x00, 0xFF, 0x7E, 0x00, 0x7F,
+  0x7E, 0x00, 0x7F, 0x7C, 0x00, 0x3F, 0x7C, 0x00, 0x3F, 0xFC, 0x00, 0x3F,
+  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
+  0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x7C, 0x00, 0x3F, 0x7E, 0x00, 0x3F,
+  0x7E, 0x00, 0x7F, 0x3F, 0x00, 0xFF, 0x3F, 0xC3, 0xFF, 0x1F, 0xFF, 0xDF,
+  0x0F, 0xFF, 0x9F, 0x07, 0xFF, 0x1F, 0x01, 0xFC, 0x1F, 0x00, 0x00, 0x1F,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x1C, 0x00, 0x3E, 0x7E, 0x00, 0x7E,
+  0x3F, 0xC3, 0xFC, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0,
+  0x00, 0xFF, 0x80, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E,
+  0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00,
+  0x00, 0xF8, 0x3F, 0x03, 0xE3, 0xFF, 0x0F, 0x9F, 0xFF, 0x3E, 0xFF, 0xFC,
+  0xFB, 0xC7, 0xFB, 0xFC, 0x07, 0xEF, 0xE0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC,
+  0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00,
+  0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F,
+  0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0,
+  0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01,
+  0xF0, 0x7B, 0xFF, 0xFF, 0xFD, 0xE0, 0x00, 0x00, 0x0F, 0xBE, 0xFB, 0xEF,
+  0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF,
+  0xBE, 0xFB, 0xEF, 0xBE, 0x07, 0x83, 0xF0, 0xFC, 0x3F, 0x0F, 0xC1, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E,
+  0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83,
+  0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8,
+  0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x8F, 0xEF, 0xF3, 0xFC, 0xFE,
+  0x3E, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0,
+  0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00,
+  0x00, 0xF8, 0x00, 0xFD, 0xF0, 0x03, 0xF3, 0xE0, 0x0F, 0xC7, 0xC0, 0x3F,
+  0x0F, 0x80, 0xFC, 0x1F, 0x03, 0xF0, 0x3E, 0x0F, 0xC0, 0x7C, 0x3F, 0x00,
+  0xF8, 0xFC, 0x01, 0xF3, 0xF0, 0x03, 0xEF, 0xE0, 0x07, 0xFF, 0x80, 0x0F,
+  0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F, 0x00, 0xFC,
+  0x7F, 0x01, 0xF0, 0x7E, 0x03, 0xE0, 0x7E, 0x07, 0xC0, 0x7E, 0x0F, 0x80,
+  0xFE, 0x1F, 0x00, 0xFC, 0x3E, 0x00, 0xFC, 0x7C, 0x00, 0xFC, 0xF8, 0x01,
+  0xFD, 0xF0, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC0, 0xF8, 0x3E, 0x00, 0xFC, 0x1F, 0x1F, 0xF0, 0x7F, 0xE3, 0xE7,
+  0xFF, 0x1F, 0xFE, 0x7D, 0xFF, 0xE7, 0xFF, 0xEF, 0xB8, 0xFF, 0xF1, 0xFF,
+  0xFC, 0x07, 0xF8, 0x0F, 0xFF, 0x00, 0x7E, 0x00, 0xFF, 0xE0, 0x0F, 0xC0,
+  0x1F, 0xFC, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x3E, 0x00, 0x7F, 0xE0, 0x07,
+  0xC0, 0x0F, 0xFC, 0x00, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0x00, 0x3F, 0xF0,
+  0x03, 0xE0, 0x07, 0xFE, 0x00, 0x7C, 0x00, 0xFF, 0xC0, 0x0F, 0x80, 0x1F,
+  0xF8, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x3E, 0x00, 0x7F, 0xE0, 0x07, 0xC0,
+  0x0F, 0xFC, 0x00, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0x00, 0x3F, 0xF0, 0x03,
+  0xE0, 0x07, 0xFE, 0x00, 0x7C, 0x00, 0xFF, 0xC0, 0x0F, 0x80, 0x1F, 0xF8,
+  0x01, 0xF0, 0x03, 0xFF, 0x00, 0x3E, 0x00, 0x7C, 0xF8, 0x3F, 0x03, 0xE3,
+  0xFF, 0x0F, 0x9F, 0xFF, 0x3E, 0xFF, 0xFC, 0xFB, 0xC7, 0xFB, 0xFC, 0x07,
+  0xEF, 0xE0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF,
+  0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80,
+  0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07,
+  0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE,
+  0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xF0, 0x00, 0xFF, 0x00, 0x03,
+  0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x1F, 0xC3, 0xFC, 0x3F,
+  0x00, 0xFC, 0x3E, 0x00, 0x7E, 0x7E, 0x00, 0x3E, 0x7C, 0x00, 0x3F, 0x7C,
+  0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
+  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0x7C,
+  0x00, 0x3F, 0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x3F, 0x00, 0x7E, 0x3F,
+  0x81, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x01,
+  0xFF, 0x80, 0x00, 0x08, 0x00, 0xF8, 0x3F, 0x00, 0xF8, 0xFF, 0xE0, 0xF9,
+  0xFF, 0xF0, 0xFB, 0xFF, 0xF8, 0xFB, 0xC3, 0xFC, 0xFF, 0x00, 0xFC, 0xFE,
+  0x00, 0x7E, 0xFE, 0x00, 0x7E, 0xFC, 0x00, 0x3E, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
+  0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3E, 0xFE,
+  0x00, 0x7E, 0xFE, 0x00, 0x7E, 0xFF, 0x00, 0xFC, 0xFF, 0xC3, 0xFC, 0xFB,
+  0xFF, 0xF8, 0xF9, 0xFF, 0xF0, 0xF8, 0xFF, 0xE0, 0xF8, 0x3F, 0x00, 0xF8,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x07, 0xFF, 0x1F, 0x0F,
+  0xFF, 0x9F, 0x1F, 0xFF, 0xDF, 0x3F, 0xC3, 0xDF, 0x3F, 0x00, 0xFF, 0x7E,
+  0x00, 0x7F, 0x7E, 0x00, 0x7F, 0x7C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
+  0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0x7C, 0x00, 0x3F, 0x7E,
+  0x00, 0x7F, 0x7E, 0x00, 0x7F, 0x3F, 0x00, 0xFF, 0x3F, 0xC3, 0xFF, 0x1F,
+  0xFF, 0xDF, 0x0F, 0xFF, 0x9F, 0x07, 0xFF, 0x1F, 0x00, 0xFC, 0x1F, 0x00,
+  0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x1F, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE7, 0xFF, 0xBF, 0xFE, 0xFF,
+  0xFF, 0xC7, 0xFC, 0x0F, 0xE0, 0x3F, 0x00, 0xFC, 0x03, 0xE0, 0x0F, 0x80,
+  0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0,
+  0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8,
+  0x03, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xF0, 0x7F,
+  0xFF, 0xC3, 0xF8, 0x7F, 0x3F, 0x00, 0xF9, 0xF0, 0x07, 0xEF, 0x80, 0x10,
+  0x7C, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xF0, 0x01, 0xFF,
+  0xF8, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x01, 0xF8,
+  0x00, 0x07, 0xC2, 0x00, 0x3F, 0xF0, 0x01, 0xF7, 0xC0, 0x1F, 0xBF, 0x01,
+  0xFD, 0xFF, 0xFF, 0xC7, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x3F, 0xF8, 0x00,
+  0x08, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01,
+  0xF0, 0x3F, 0xFF, 0x7F, 0xFE, 0xFF, 0xFD, 0xFF, 0xF8, 0x3E, 0x00, 0x7C,
+  0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00,
+  0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F,
+  0x80, 0x1F, 0x00, 0x3F, 0x00, 0x7F, 0x10, 0x7F, 0xC0, 0xFF, 0xC0, 0xFF,
+  0x80, 0x7F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00,
+  0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F,
+  0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8,
+  0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00,
+  0x7F, 0xF0, 0x01, 0xF7, 0xC0, 0x0F, 0xDF, 0x00, 0x3F, 0x7E, 0x01, 0xFD,
+  0xFE, 0x1F, 0xF3, 0xFF, 0xF7, 0xC7, 0xFF, 0x9F, 0x0F, 0xFC, 0x7C, 0x0F,
+  0xC1, 0xF0, 0xFC, 0x00, 0x1F, 0xBE, 0x00, 0x0F, 0x9F, 0x00, 0x07, 0xCF,
+  0xC0, 0x07, 0xE3, 0xE0, 0x03, 0xE1, 0xF0, 0x01, 0xF0, 0xFC, 0x01, 0xF8,
+  0x3E, 0x00, 0xF8, 0x1F, 0x00, 0x7C, 0x07, 0xC0, 0x7C, 0x03, 0xE0, 0x3E,
+  0x01, 0xF0, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x0F, 0x80, 0x1F, 0x07,
+  0xC0, 0x07, 0xC7, 0xC0, 0x03, 0xE3, 0xE0, 0x00, 0xF1, 0xE0, 0x00, 0x7D,
+  0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0x78, 0x00, 0x07, 0xFC, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0xFC, 0x00, 0xF8, 0x01, 0xFB, 0xE0, 0x07, 0xC0, 0x0F, 0x9F, 0x00, 0x7F,
+  0x00, 0x7C, 0xFC, 0x03, 0xF8, 0x07, 0xE3, 0xE0, 0x1F, 0xC0, 0x3E, 0x1F,
+  0x00, 0xFE, 0x01, 0xF0, 0xF8, 0x0F, 0x78, 0x0F, 0x83, 0xE0, 0x7B, 0xC0,
+  0xF8, 0x1F, 0x03, 0xDE, 0x07, 0xC0, 0xF8, 0x3E, 0xF0, 0x3E, 0x07, 0xC1,
+  0xE7, 0xC1, 0xF0, 0x1F, 0x0F, 0x1E, 0x1F, 0x00, 0xF8, 0x78, 0xF0, 0xF8,
+  0x07, 0xC7, 0xC7, 0xC7, 0xC0, 0x1E, 0x3C, 0x1E, 0x3C, 0x00, 0xF9, 0xE0,
+  0xF3, 0xE0, 0x07, 0xCF, 0x07, 0x9F, 0x00, 0x3E, 0x78, 0x3C, 0xF0, 0x00,
+  0xF7, 0x80, 0xF7, 0x80, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x3F,
+  0xE0, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x3F,
+  0x80, 0x3F, 0x80, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x07, 0xC0, 0x07, 0xC0,
+  0x00, 0x7E, 0x00, 0x3E, 0x3E, 0x00, 0x7E, 0x3F, 0x00, 0xFC, 0x1F, 0x80,
+  0xF8, 0x0F, 0x81, 0xF8, 0x0F, 0xC1, 0xF0, 0x07, 0xC3, 0xE0, 0x03, 0xE7,
+  0xE0, 0x03, 0xE7, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
+  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF,
+  0x80, 0x01, 0xFF, 0x80, 0x03, 0xE7, 0xC0, 0x07, 0xE3, 0xE0, 0x07, 0xC3,
+  0xF0, 0x0F, 0x81, 0xF0, 0x1F, 0x81, 0xF8, 0x1F, 0x00, 0xFC, 0x3F, 0x00,
+  0x7C, 0x7E, 0x00, 0x7E, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xBE, 0x00,
+  0x0F, 0x9F, 0x00, 0x07, 0xCF, 0xC0, 0x07, 0xE3, 0xE0, 0x03, 0xE1, 0xF0,
+  0x01, 0xF0, 0xFC, 0x01, 0xF8, 0x3E, 0x00, 0xF8, 0x1F, 0x00, 0x7C, 0x07,
+  0xC0, 0x7C, 0x03, 0xE0, 0x3E, 0x01, 0xF0, 0x1F, 0x00, 0x7C, 0x1F, 0x00,
+  0x3E, 0x0F, 0x80, 0x1F, 0x07, 0xC0, 0x07, 0xC7, 0xC0, 0x03, 0xE3, 0xE0,
+  0x00, 0xF1, 0xE0, 0x00, 0x7D, 0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0x78,
+  0x00, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F,
+  0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07,
+  0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x23, 0xF0, 0x00, 0x1F,
+  0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
+  0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x03,
+  0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x03,
+  0xF0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03,
+  0xF0, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1E, 0x01, 0xFC, 0x07, 0xF8, 0x1F,
+  0xF0, 0x3F, 0x80, 0x7C, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80,
+  0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07,
+  0xC0, 0x0F, 0x80, 0x7E, 0x07, 0xFC, 0x0F, 0xE0, 0x1F, 0x00, 0x3F, 0x80,
+  0x7F, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00,
+  0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E,
+  0x00, 0x7C, 0x00, 0x7C, 0x00, 0xFE, 0x01, 0xFF, 0x01, 0xFE, 0x01, 0xFC,
+  0x00, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xF0, 0x0F, 0xE0, 0x3F,
+  0xC0, 0x3F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0x80, 0x1E, 0x00,
+  0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0xC0,
+  0x1F, 0x00, 0x7C, 0x00, 0xFC, 0x01, 0xFC, 0x01, 0xF0, 0x0F, 0xC0, 0xFF,
+  0x03, 0xE0, 0x1F, 0x00, 0x7C, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78,
+  0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0x80, 0x3E,
+  0x03, 0xF8, 0x3F, 0xC0, 0xFF, 0x03, 0xF0, 0x0F, 0x00, 0x00, 0x1F, 0xC0,
+  0x00, 0x3F, 0xE0, 0x1F, 0x7F, 0xF8, 0x1E, 0x7F, 0xFC, 0x1E, 0xF8, 0x7E,
+  0x7E, 0xF0, 0x3F, 0xFE, 0xF0, 0x1F, 0xFC, 0xF0, 0x0F, 0xF8, 0x00, 0x03,
+  0xE0 };
+
+const GFXglyph Inter_Medium24pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  13,    0,    0 },   // 0x20 ' '
+  {     1,   7,  34,  14,    4,  -33 },   // 0x21 '!'
+  {    31,  14,  13,  23,    5,  -33 },   // 0x22 '"'
+  {    54,  28,  34,  30,    1,  -33 },   // 0x23 '#'
+  {   173,  26,  44,  30,    2,  -38 },   // 0x24 '$'
+  {   316,  37,  35,  47,    5,  -33 },   // 0x25 '%'
+  {   478,  28,  34,  31,    2,  -33 },   // 0x26 '&'
+  {   597,   5,  13,  15,    5,  -33 },   // 0x27 '''
+  {   606,  10,  43,  17,    5,  -36 },   // 0x28 '('
+  {   660,  11,  43,  17,    2,  -36 },   // 0x29 ')'
+  {   720,  18,  19,  24,    3,  -33 },   // 0x2A '*'
+  {   763,  23,  23,  31,    4,  -24 },   // 0x2B '+'
+  {   830,   7,  13,  14,    3,   -4 },   // 0x2C ','
+  {   842,  15,   4,  22,    3,  -15 },   // 0x2D '-'
+  {   850,   7,   7,  14,    4,   -6 },   // 0x2E '.'
+  {   857,  15,  41,  17,    1,  -35 },   // 0x2F '/'
+  {   934,  25,  34,  30,    3,  -33 },   // 0x30 '0'
+  {  1041,  14,  34,  20,    2,  -33 },   // 0x31 '1'
+  {  1101,  23,  34,  29,    3,  -33 },   // 0x32 '2'
+  {  1199,  24,  34,  29,    3,  -33 },   // 0x33 '3'
+  {  1301,  25,  34,  31,    3,  -33 },   // 0x34 '4'
+  {  1408,  23,  34,  29,    3,  -33 },   // 0x35 '5'
+  {  1506,  24,  34,  30,    3,  -33 },   // 0x36 '6'
+  {  1608,  23,  34,  27,    2,  -33 },   // 0x37 '7'
+  {  1706,  24,  34,  30,    3,  -33 },   // 0x38 '8'
+  {  1808,  24,  34,  30,    3,  -33 },   // 0x39 '9'
+  {  1910,   7,  25,  14,    4,  -24 },   // 0x3A ':'
+  {  1932,   9,  33,  15,    3,  -24 },   // 0x3B ';'
+  {  1970,  22,  25,  31,    4,  -25 },   // 0x3C '<'
+  {  2039,  21,  15,  31,    5,  -20 },   // 0x3D '='
+  {  2079,  22,  25,  31,    5,  -25 },   // 0x3E '>'
+  {  2148,  20,  34,  25,    2,  -33 },   // 0x3F '?'
+  {  2233,  41,  43,  46,    3,  -32 },   // 0x40 '@'
+  {  2454,  31,  34,  33,    1,  -33 },   // 0x41 'A'
+  {  2586,  24,  34,  31,    4,  -33 },   // 0x42 'B'
+  {  2688,  29,  34,  34,    3,  -33 },   // 0x43 'C'
+  {  2812,  27,  34,  34,    4,  -33 },   // 0x44 'D'
+  {  2927,  21,  34,  28,    4,  -33 },   // 0x45 'E'
+  {  3017,  21,  34,  28,    4,  -33 },   // 0x46 'F'
+  {  3107,  29,  34,  35,    3,  -33 },   // 0x47 'G'
+  {  3231,  27,  34,  35,    4,  -33 },   // 0x48 'H'
+  {  3346,   5,  34,  13,    4,  -33 },   // 0x49 'I'
+  {  3368,  21,  34,  27,    2,  -33 },   // 0x4A 'J'
+  {  3458,  27,  34,  32,    4,  -33 },   // 0x4B 'K'
+  {  3573,  21,  34,  27,    4,  -33 },   // 0x4C 'L'
+  {  3663,  35,  34,  43,    4,  -33 },   // 0x4D 'M'
+  {  3812,  28,  34,  36,    4,  -33 },   // 0x4E 'N'
+  {  3931,  30,  34,  36,    3,  -33 },   // 0x4F 'O'
+  {  4059,  24,  34,  30,    4,  -33 },   // 0x50 'P'
+  {  4161,  30,  36,  36,    3,  -33 },   // 0x51 'Q'
+  {  4296,  25,  34,  30,    4,  -33 },   // 0x52 'R'
+  {  4403,  26,  35,  30,    2,  -33 },   // 0x53 'S'
+  {  4517,  27,  34,  31,    2,  -33 },   // 0x54 'T'
+  {  4632,  27,  35,  35,    4,  -33 },   // 0x55 'U'
+  {  4751,  31,  34,  33,    1,  -33 },   // 0x56 'V'
+  {  4883,  45,  34,  47,    1,  -33 },   // 0x57 'W'
+  {  5075,  31,  34,  33,    1,  -33 },   // 0x58 'X'
+  {  5207,  31,  34,  33,    1,  -33 },   // 0x59 'Y'
+  {  5339,  24,  34,  30,    3,  -33 },   // 0x5A 'Z'
+  {  5441,  10,  43,  17,    5,  -36 },   // 0x5B '['
+  {  5495,  15,  41,  17,    1,  -35 },   // 0x5C '\'
+  {  5572,   9,  43,  17,    3,  -36 },   // 0x5D ']'
+  {  5621,  19,  15,  22,    2,  -33 },   // 0x5E '^'
+  {  5657,  22,   4,  22,    0,    1 },   // 0x5F '_'
+  {  5668,   8,   7,  16,    4,  -35 },   // 0x60 '`'
+  {  5675,  21,  27,  27,    2,  -25 },   // 0x61 'a'
+  {  5746,  24,  34,  29,    3,  -33 },   // 0x62 'b'
+  {  5848,  23,  27,  27,    2,  -25 },   // 0x63 'c'
+  {  5926,  24,  34,  29,    2,  -33 },   // 0x64 'd'
+  {  6028,  23,  27,  28,    2,  -25 },   // 0x65 'e'
+  {  6106,  17,  36,  18,    0,  -35 },   // 0x66 'f'
+  {  6183,  24,  36,  29,    2,  -25 },   // 0x67 'g'
+  {  6291,  22,  34,  28,    3,  -33 },   // 0x68 'h'
+  {  6385,   6,  36,  12,    3,  -35 },   // 0x69 'i'
+  {  6412,  10,  46,  12,   -1,  -35 },   // 0x6A 'j'
+  {  6470,  23,  34,  26,    3,  -33 },   // 0x6B 'k'
+  {  6568,   5,  34,  12,    3,  -33 },   // 0x6C 'l'
+  {  6590,  35,  26,  42,    3,  -25 },   // 0x6D 'm'
+  {  6704,  22,  26,  28,    3,  -25 },   // 0x6E 'n'
+  {  6776,  24,  27,  28,    2,  -25 },   // 0x6F 'o'
+  {  6857,  24,  36,  29,    3,  -25 },   // 0x70 'p'
+  {  6965,  24,  36,  29,    2,  -25 },   // 0x71 'q'
+  {  7073,  14,  26,  18,    3,  -25 },   // 0x72 'r'
+  {  7119,  21,  27,  25,    2,  -25 },   // 0x73 's'
+  {  7190,  15,  32,  16,    0,  -31 },   // 0x74 't'
+  {  7250,  22,  26,  28,    3,  -25 },   // 0x75 'u'
+  {  7322,  25,  26,  27,    1,  -25 },   // 0x76 'v'
+  {  7404,  37,  26,  39,    1,  -25 },   // 0x77 'w'
+  {  7525,  24,  26,  26,    1,  -25 },   // 0x78 'x'
+  {  7603,  25,  36,  27,    1,  -25 },   // 0x79 'y'
+  {  7716,  20,  26,  26,    3,  -25 },   // 0x7A 'z'
+  {  7781,  15,  43,  21,    3,  -36 },   // 0x7B '{'
+  {  7862,   4,  56,  16,    6,  -44 },   // 0x7C '|'
+  {  7890,  14,  43,  21,    3,  -36 },   // 0x7D '}'
+  {  7966,  24,   9,  31,    4,  -17 } }; // 0x7E '~'
+
+const GFXfont Inter_Medium24pt7b PROGMEM = {
+  (uint8_t  *)Inter_Medium24pt7bBitmaps,
+  (GFXglyph *)Inter_Medium24pt7bGlyphs,
+  0x20, 0x7E, 57 };
+
+// Approx. 8665 bytes
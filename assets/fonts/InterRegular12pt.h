@@ -0,0 +1,269 @@
+const uint8_t Inter_Regular12pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xB6, 0xDB, 0x60, 0x3F, 0xE0, 0xEF, 0xDD, 0x9B, 0x34,
+  0x48, 0x80, 0x06, 0x18, 0x10, 0x40, 0xC3, 0x03, 0x0C, 0x3F, 0xFD, 0xFF,
+  0xF0, 0xC3, 0x02, 0x08, 0x18, 0x60, 0x61, 0x87, 0xFF, 0xBF, 0xFE, 0x18,
+  0x60, 0x41, 0x01, 0x04, 0x0C, 0x30, 0x30, 0xC0, 0x02, 0x00, 0x10, 0x00,
+  0x80, 0x1F, 0x83, 0xFE, 0x39, 0x39, 0x88, 0xCC, 0x41, 0x62, 0x03, 0x90,
+  0x0F, 0x80, 0x1F, 0x80, 0x3F, 0x01, 0x18, 0x08, 0xFC, 0x43, 0xE2, 0x3B,
+  0x93, 0x8F, 0xF8, 0x3F, 0x80, 0x20, 0x01, 0x00, 0x78, 0x06, 0x7E, 0x06,
+  0x33, 0x03, 0x10, 0x83, 0x0C, 0xC3, 0x07, 0xE1, 0x81, 0xE1, 0x80, 0x01,
+  0x80, 0x00, 0x80, 0x00, 0xC7, 0x80, 0xC7, 0xE0, 0xC3, 0x30, 0x61, 0x08,
+  0x60, 0xC4, 0x60, 0x66, 0x30, 0x3F, 0x30, 0x0F, 0x00, 0x1F, 0x00, 0xFE,
+  0x03, 0x1C, 0x0C, 0x30, 0x30, 0xC0, 0xC6, 0x01, 0xB0, 0x03, 0x80, 0x3E,
+  0x01, 0xDC, 0x66, 0x39, 0xB0, 0x7C, 0xC0, 0xF3, 0x81, 0xC6, 0x0F, 0x1F,
+  0xFE, 0x1F, 0x1C, 0xFD, 0xB4, 0x80, 0x18, 0xCE, 0x63, 0x39, 0x8C, 0x63,
+  0x19, 0xCE, 0x31, 0x8C, 0x63, 0x8C, 0x61, 0x8C, 0xC3, 0x18, 0xE3, 0x18,
+  0xC7, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x31, 0x8C, 0xC6, 0x60, 0x0C, 0x06,
+  0x13, 0x3F, 0xF3, 0xE0, 0xF3, 0xFE, 0x9B, 0x0C, 0x06, 0x00, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x0F, 0xFF, 0xFF, 0xC1, 0x80, 0x30, 0x06, 0x00, 0xC0,
+  0x18, 0x00, 0x6F, 0xED, 0xB0, 0xFF, 0xFC, 0xFF, 0x80, 0x06, 0x0C, 0x30,
+  0x60, 0xC1, 0x86, 0x0C, 0x18, 0x30, 0xC1, 0x83, 0x04, 0x18, 0x30, 0x61,
+  0x83, 0x06, 0x0C, 0x00, 0x0F, 0x81, 0xFC, 0x38, 0xE7, 0x07, 0x60, 0x36,
+  0x03, 0x60, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x36, 0x03, 0x60, 0x37,
+  0x07, 0x30, 0xE1, 0xFC, 0x0F, 0x80, 0x1E, 0x7D, 0xFE, 0x78, 0xE1, 0xC3,
+  0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1F, 0x0F, 0xF3,
+  0x87, 0x60, 0x6C, 0x0C, 0x01, 0x80, 0x30, 0x0E, 0x03, 0x80, 0xE0, 0x38,
+  0x06, 0x01, 0x80, 0x60, 0x18, 0x07, 0xFF, 0xFF, 0xE0, 0x0F, 0x83, 0xFC,
+  0x70, 0xE6, 0x06, 0x00, 0x70, 0x06, 0x00, 0xE0, 0x7C, 0x07, 0xC0, 0x0E,
+  0x00, 0x70, 0x03, 0x80, 0x36, 0x03, 0x70, 0x63, 0xFE, 0x1F, 0x80, 0x00,
+  0xE0, 0x0F, 0x00, 0xF8, 0x07, 0xC0, 0x6E, 0x07, 0x70, 0x33, 0x83, 0x1C,
+  0x18, 0xE1, 0x87, 0x1C, 0x38, 0xC1, 0xCF, 0xFF, 0xFF, 0xFC, 0x03, 0x80,
+  0x1C, 0x00, 0xE0, 0x7F, 0xCF, 0xF9, 0x80, 0x30, 0x06, 0x01, 0xC0, 0x37,
+  0xC7, 0xFC, 0xC1, 0xC0, 0x1C, 0x01, 0x80, 0x30, 0x07, 0x81, 0xF8, 0x73,
+  0xFC, 0x1F, 0x00, 0x0F, 0x81, 0xFE, 0x38, 0x67, 0x03, 0x60, 0x06, 0x00,
+  0x67, 0x8D, 0xFE, 0xF0, 0x6E, 0x07, 0xE0, 0x36, 0x03, 0x60, 0x36, 0x07,
+  0x30, 0xE3, 0xFC, 0x0F, 0x80, 0xFF, 0xFF, 0xFC, 0x01, 0x80, 0x60, 0x0C,
+  0x03, 0x00, 0x60, 0x18, 0x03, 0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30,
+  0x06, 0x01, 0x80, 0x70, 0x00, 0x0F, 0x83, 0xFC, 0x70, 0xE6, 0x06, 0x60,
+  0x76, 0x06, 0x30, 0xE1, 0xFC, 0x3F, 0xC7, 0x06, 0x60, 0x7E, 0x03, 0xE0,
+  0x36, 0x03, 0x70, 0x73, 0xFE, 0x1F, 0x80, 0x0F, 0x83, 0xFC, 0x70, 0xE6,
+  0x06, 0xE0, 0x3E, 0x03, 0xE0, 0x36, 0x07, 0x70, 0xF3, 0xFB, 0x0F, 0x30,
+  0x03, 0x60, 0x76, 0x06, 0x70, 0xE3, 0xFC, 0x1F, 0x00, 0xFF, 0x80, 0x00,
+  0x1F, 0xF0, 0xFF, 0x80, 0x00, 0x0D, 0xFD, 0xB6, 0x00, 0x20, 0x1C, 0x0F,
+  0x87, 0x83, 0xC1, 0xE0, 0x38, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80,
+  0x30, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x80,
+  0x18, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x38, 0x1E, 0x1F, 0x0F,
+  0x83, 0xC0, 0x60, 0x08, 0x00, 0x1E, 0x1F, 0xEE, 0x1B, 0x03, 0x00, 0xC0,
+  0x70, 0x18, 0x1E, 0x0E, 0x03, 0x01, 0xC0, 0x60, 0x00, 0x00, 0x01, 0xC0,
+  0x70, 0x1C, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xF0, 0x1E, 0x03, 0xC3, 0x80,
+  0x0C, 0x30, 0x00, 0x66, 0x0F, 0x63, 0x61, 0xFE, 0x36, 0x30, 0xE3, 0x43,
+  0x06, 0x3C, 0x60, 0x63, 0xC6, 0x06, 0x3C, 0x60, 0x63, 0xC3, 0x06, 0x36,
+  0x30, 0xE3, 0x61, 0xFF, 0xE6, 0x0F, 0x3C, 0x30, 0x00, 0x03, 0x80, 0x00,
+  0x1E, 0x01, 0x00, 0x7F, 0xF0, 0x01, 0xFC, 0x00, 0x03, 0x80, 0x0F, 0x00,
+  0x1E, 0x00, 0x36, 0x00, 0xCC, 0x01, 0x98, 0x07, 0x18, 0x0C, 0x30, 0x18,
+  0x60, 0x60, 0x60, 0xFF, 0xC1, 0xFF, 0xC6, 0x01, 0x8C, 0x03, 0x38, 0x07,
+  0x60, 0x06, 0xC0, 0x0E, 0xFF, 0x8F, 0xFC, 0xC0, 0xEC, 0x06, 0xC0, 0x6C,
+  0x06, 0xC0, 0xEF, 0xF8, 0xFF, 0xCC, 0x0E, 0xC0, 0x7C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x7F, 0xFE, 0xFF, 0x80, 0x07, 0xE0, 0x3F, 0xF0, 0xE0, 0x71,
+  0x80, 0x66, 0x00, 0xEC, 0x00, 0x18, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0,
+  0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0xE6, 0x01, 0x8E, 0x07, 0x0F, 0xFC,
+  0x07, 0xE0, 0xFF, 0x83, 0xFF, 0x8C, 0x0F, 0x30, 0x0C, 0xC0, 0x1B, 0x00,
+  0x6C, 0x01, 0xB0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xB0, 0x06, 0xC0,
+  0x1B, 0x00, 0xCC, 0x0F, 0x3F, 0xF8, 0xFF, 0x80, 0xFF, 0xDF, 0xFB, 0x00,
+  0x60, 0x0C, 0x01, 0x80, 0x30, 0x07, 0xFE, 0xFF, 0xD8, 0x03, 0x00, 0x60,
+  0x0C, 0x01, 0x80, 0x30, 0x07, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFC, 0x03,
+  0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0xC0,
+  0x30, 0x0C, 0x03, 0x00, 0xC0, 0x00, 0x07, 0xE0, 0x3F, 0xF0, 0xE0, 0x71,
+  0x80, 0x66, 0x00, 0xEC, 0x00, 0x18, 0x00, 0x70, 0x00, 0xE0, 0xFF, 0xC1,
+  0xFD, 0x80, 0x1B, 0x00, 0x36, 0x00, 0xE6, 0x01, 0x8E, 0x07, 0x0F, 0xFC,
+  0x07, 0xE0, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F,
+  0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0,
+  0x0F, 0x00, 0x78, 0x03, 0xC0, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+  0x0F, 0x03, 0xC0, 0xF8, 0x36, 0x1D, 0xFE, 0x1F, 0x00, 0xC0, 0x3E, 0x03,
+  0xB0, 0x39, 0x83, 0x8C, 0x38, 0x63, 0x83, 0x38, 0x1B, 0x80, 0xDE, 0x07,
+  0xB8, 0x38, 0xC1, 0x83, 0x0C, 0x1C, 0x60, 0x73, 0x01, 0x98, 0x0E, 0xC0,
+  0x38, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0,
+  0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFF, 0xFF, 0xC0, 0xE0,
+  0x03, 0xF8, 0x03, 0xFC, 0x01, 0xFF, 0x00, 0xFD, 0x80, 0xDE, 0xC0, 0x6F,
+  0x70, 0x37, 0x98, 0x33, 0xCE, 0x19, 0xE3, 0x1C, 0xF1, 0x8C, 0x78, 0xE6,
+  0x3C, 0x36, 0x1E, 0x1B, 0x0F, 0x07, 0x87, 0x83, 0x83, 0xC1, 0xC1, 0x80,
+  0xE0, 0x1F, 0xC0, 0x7F, 0x01, 0xFE, 0x07, 0xDC, 0x1F, 0x30, 0x7C, 0xE1,
+  0xF1, 0x87, 0xC3, 0x1F, 0x0E, 0x7C, 0x19, 0xF0, 0x77, 0xC0, 0xFF, 0x01,
+  0xBC, 0x07, 0xF0, 0x0F, 0xC0, 0x1C, 0x07, 0xE0, 0x1F, 0xF8, 0x38, 0x1C,
+  0x30, 0x0C, 0x60, 0x0E, 0x60, 0x06, 0x60, 0x06, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x30, 0x0C, 0x38, 0x1C,
+  0x1F, 0xF8, 0x07, 0xE0, 0xFF, 0x8F, 0xFC, 0xC0, 0xEC, 0x06, 0xC0, 0x7C,
+  0x03, 0xC0, 0x7C, 0x06, 0xC0, 0xEF, 0xFC, 0xFF, 0x0C, 0x00, 0xC0, 0x0C,
+  0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x3C,
+  0x30, 0x0C, 0x60, 0x0E, 0x60, 0x06, 0x60, 0x06, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0x60, 0x06, 0x61, 0x06, 0x70, 0xCE, 0x30, 0x6C, 0x3C, 0x3C,
+  0x1F, 0xF8, 0x07, 0xF8, 0x00, 0x0E, 0xFF, 0x8F, 0xFC, 0xC0, 0xEC, 0x07,
+  0xC0, 0x3C, 0x03, 0xC0, 0x7C, 0x0E, 0xFF, 0xCF, 0xF8, 0xC1, 0x8C, 0x1C,
+  0xC0, 0xCC, 0x0E, 0xC0, 0x6C, 0x07, 0xC0, 0x30, 0x0F, 0xC1, 0xFF, 0x1C,
+  0x1C, 0xC0, 0x66, 0x00, 0xB0, 0x01, 0xC0, 0x07, 0xC0, 0x0F, 0xC0, 0x0F,
+  0x80, 0x0C, 0x00, 0x7E, 0x01, 0xB0, 0x1D, 0xC1, 0xC7, 0xFC, 0x1F, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xC1, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00,
+  0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C,
+  0x00, 0xE0, 0x07, 0x00, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01,
+  0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3E,
+  0x01, 0xB0, 0x1D, 0xC1, 0xC7, 0xFC, 0x0F, 0xC0, 0xC0, 0x0F, 0x80, 0x19,
+  0x80, 0x73, 0x00, 0xC7, 0x01, 0x86, 0x07, 0x0C, 0x0C, 0x1C, 0x18, 0x18,
+  0x70, 0x30, 0xC0, 0x71, 0x80, 0x66, 0x00, 0xCC, 0x00, 0xD8, 0x01, 0xE0,
+  0x03, 0xC0, 0x03, 0x80, 0xC0, 0x70, 0x1F, 0x01, 0xC0, 0x6C, 0x07, 0x01,
+  0x98, 0x36, 0x0E, 0x60, 0xD8, 0x31, 0x83, 0x60, 0xC7, 0x0D, 0xC3, 0x0C,
+  0x63, 0x1C, 0x31, 0x8C, 0x60, 0xC6, 0x31, 0x83, 0x98, 0x66, 0x06, 0xC1,
+  0xB0, 0x1B, 0x06, 0xC0, 0x6C, 0x1B, 0x00, 0xB0, 0x3C, 0x03, 0x80, 0xE0,
+  0x0E, 0x03, 0x80, 0xE0, 0x1D, 0xC0, 0x63, 0x03, 0x0E, 0x1C, 0x1C, 0xE0,
+  0x33, 0x00, 0xFC, 0x01, 0xE0, 0x03, 0x00, 0x1E, 0x00, 0xFC, 0x03, 0x38,
+  0x18, 0x60, 0xE1, 0xC7, 0x03, 0x98, 0x06, 0xC0, 0x1C, 0xC0, 0x0D, 0x80,
+  0x67, 0x03, 0x8C, 0x0C, 0x38, 0x70, 0x63, 0x80, 0xCC, 0x03, 0xF0, 0x07,
+  0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00,
+  0xC0, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x70, 0x06, 0x00, 0xC0, 0x1C,
+  0x01, 0x80, 0x30, 0x07, 0x00, 0x60, 0x0C, 0x01, 0xC0, 0x18, 0x03, 0x00,
+  0x60, 0x0F, 0xFF, 0xFF, 0xF0, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+  0xCC, 0xCC, 0xCF, 0xF0, 0x81, 0x83, 0x06, 0x06, 0x0C, 0x18, 0x30, 0x30,
+  0x60, 0xC1, 0x81, 0x83, 0x06, 0x04, 0x0C, 0x18, 0x30, 0x30, 0x60, 0xFF,
+  0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC7, 0xFF,
+  0x80, 0x1C, 0x0E, 0x0D, 0x86, 0xC6, 0x33, 0x1B, 0x06, 0xFF, 0xFF, 0xFC,
+  0xC6, 0x30, 0x1F, 0x1F, 0xE6, 0x0E, 0x83, 0x00, 0xC1, 0xF7, 0xFF, 0xC3,
+  0xC0, 0xF0, 0x3E, 0x1D, 0xFF, 0x3E, 0xC0, 0xC0, 0x18, 0x03, 0x00, 0x60,
+  0x0C, 0xF1, 0xBF, 0x38, 0x37, 0x07, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C,
+  0x07, 0xC1, 0xF8, 0x76, 0xFC, 0xCF, 0x00, 0x0F, 0x87, 0xF9, 0xC3, 0xB0,
+  0x3E, 0x01, 0x80, 0x30, 0x06, 0x00, 0xE0, 0x0C, 0x0D, 0xC3, 0x9F, 0xE0,
+  0xF0, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x1F, 0x33, 0xFB, 0x70, 0xF6,
+  0x07, 0xE0, 0x7C, 0x07, 0xC0, 0x3C, 0x07, 0xE0, 0x76, 0x07, 0x70, 0xF3,
+  0xFB, 0x1F, 0x30, 0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xC0, 0x6F, 0xFF,
+  0xFF, 0xFC, 0x00, 0xE0, 0x06, 0x06, 0x70, 0xE3, 0xFC, 0x0F, 0x80, 0x02,
+  0x0F, 0x1D, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x33, 0xFB, 0x70, 0xF6, 0x07, 0xE0,
+  0x7C, 0x07, 0xC0, 0x3C, 0x03, 0xE0, 0x76, 0x07, 0x70, 0xF3, 0xFB, 0x1F,
+  0x30, 0x03, 0x20, 0x66, 0x0E, 0x3F, 0xC1, 0xF8, 0xC0, 0x30, 0x0C, 0x03,
+  0x00, 0xCF, 0x3F, 0xEE, 0x1F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xC0, 0x7D, 0x80, 0xDB, 0x6D, 0xB6, 0xDB,
+  0x6C, 0x37, 0x30, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x7E,
+  0xC0, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x1D, 0x87, 0x31, 0xC6, 0x70,
+  0xDC, 0x1F, 0x03, 0xF0, 0x76, 0x0C, 0xE1, 0x8E, 0x30, 0xE6, 0x0C, 0xC0,
+  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xCE, 0x1E, 0x7F, 0xBF, 0xB8, 0x70,
+  0xD8, 0x38, 0x3C, 0x18, 0x1E, 0x0C, 0x0F, 0x06, 0x07, 0x83, 0x03, 0xC1,
+  0x81, 0xE0, 0xC0, 0xF0, 0x60, 0x78, 0x30, 0x3C, 0x18, 0x18, 0xCF, 0x3F,
+  0xEE, 0x1F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xC0, 0x0F, 0x83, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x7C, 0x03,
+  0xC0, 0x3C, 0x03, 0xE0, 0x76, 0x06, 0x70, 0xE3, 0xFC, 0x0F, 0x00, 0xCF,
+  0x1B, 0xF3, 0x83, 0x70, 0x7C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x7C,
+  0x1F, 0x87, 0x6F, 0xCC, 0xF1, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x00,
+  0x1F, 0x33, 0xFB, 0x70, 0xF6, 0x07, 0xE0, 0x7C, 0x07, 0xC0, 0x3C, 0x07,
+  0xE0, 0x76, 0x07, 0x70, 0xF3, 0xFB, 0x1F, 0x30, 0x03, 0x00, 0x30, 0x03,
+  0x00, 0x30, 0x03, 0xDF, 0xFE, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30,
+  0xC0, 0x1F, 0x1F, 0xE6, 0x1D, 0x82, 0x60, 0x1E, 0x03, 0xF8, 0x0F, 0x00,
+  0xD0, 0x3E, 0x1D, 0xFE, 0x3F, 0x00, 0x30, 0x60, 0xC7, 0xFF, 0xE6, 0x0C,
+  0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x07, 0x87, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3E, 0x1D, 0xFF, 0x3C,
+  0xC0, 0xC0, 0x7C, 0x06, 0x60, 0xE6, 0x0C, 0x60, 0xC3, 0x1C, 0x31, 0x83,
+  0x98, 0x1B, 0x01, 0xB0, 0x0B, 0x00, 0xE0, 0x0E, 0x00, 0xC1, 0xC1, 0xE0,
+  0xE0, 0xD8, 0x70, 0x6C, 0x2C, 0x66, 0x36, 0x33, 0x9B, 0x18, 0xCC, 0x98,
+  0x64, 0x6C, 0x36, 0x36, 0x0F, 0x1B, 0x07, 0x07, 0x03, 0x83, 0x80, 0xC1,
+  0xC0, 0xE0, 0xEC, 0x18, 0xC6, 0x1D, 0xC1, 0xB0, 0x1C, 0x03, 0x80, 0xF0,
+  0x1B, 0x06, 0x71, 0xC6, 0x30, 0x6C, 0x0E, 0xC0, 0x7C, 0x06, 0x60, 0xE6,
+  0x0C, 0x60, 0xC3, 0x1C, 0x31, 0x83, 0x98, 0x1B, 0x01, 0xB0, 0x0B, 0x00,
+  0xE0, 0x0E, 0x00, 0xE0, 0x0C, 0x01, 0xC0, 0x78, 0x07, 0x00, 0x7F, 0xCF,
+  0xF8, 0x07, 0x01, 0xC0, 0x30, 0x0C, 0x03, 0x80, 0xE0, 0x18, 0x07, 0x01,
+  0xC0, 0x3F, 0xFF, 0xFE, 0x02, 0x3C, 0x71, 0x83, 0x06, 0x0C, 0x18, 0x30,
+  0x63, 0x87, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0xC1, 0xE1, 0xC0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xE0, 0xC0, 0xC1, 0x83,
+  0x06, 0x0C, 0x18, 0x30, 0x38, 0x71, 0xC3, 0x06, 0x0C, 0x18, 0x30, 0x61,
+  0xCF, 0x1C, 0x00, 0x78, 0x3F, 0xE7, 0xC7, 0xEC, 0x3C };
+
+const GFXglyph Inter_Regular12pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   7,    0,    0 },   // 0x20 ' '
+  {     1,   3,  17,   7,    2,  -16 },   // 0x21 '!'
+  {     8,   7,   6,  11,    2,  -16 },   // 0x22 '"'
+  {    14,  14,  17,  15,    0,  -16 },   // 0x23 '#'
+  {    44,  13,  22,  15,    1,  -19 },   // 0x24 '$'
+  {    80,  17,  17,  23,    3,  -16 },   // 0x25 '%'
+  {   117,  14,  17,  15,    1,  -16 },   // 0x26 '&'
+  {   147,   3,   6,   7,    2,  -16 },   // 0x27 '''
+  {   150,   5,  22,   9,    2,  -18 },   // 0x28 '('
+  {   164,   5,  22,   9,    1,  -18 },   // 0x29 ')'
+  {   178,   9,  10,  12,    1,  -16 },   // 0x2A '*'
+  {   190,  11,  11,  16,    2,  -11 },   // 0x2B '+'
+  {   206,   3,   7,   7,    2,   -2 },   // 0x2C ','
+  {   209,   7,   2,  11,    2,   -7 },   // 0x2D '-'
+  {   211,   3,   3,   7,    2,   -2 },   // 0x2E '.'
+  {   213,   7,  21,   8,    1,  -17 },   // 0x2F '/'
+  {   232,  12,  17,  15,    1,  -16 },   // 0x30 '0'
+  {   258,   7,  17,  10,    1,  -16 },   // 0x31 '1'
+  {   273,  11,  17,  14,    2,  -16 },   // 0x32 '2'
+  {   297,  12,  17,  15,    1,  -16 },   // 0x33 '3'
+  {   323,  13,  17,  15,    1,  -16 },   // 0x34 '4'
+  {   351,  11,  17,  14,    2,  -16 },   // 0x35 '5'
+  {   375,  12,  17,  15,    1,  -16 },   // 0x36 '6'
+  {   401,  11,  17,  13,    1,  -16 },   // 0x37 '7'
+  {   425,  12,  17,  15,    1,  -16 },   // 0x38 '8'
+  {   451,  12,  17,  15,    1,  -16 },   // 0x39 '9'
+  {   477,   3,  12,   7,    2,  -11 },   // 0x3A ':'
+  {   482,   3,  16,   7,    2,  -11 },   // 0x3B ';'
+  {   488,  11,  13,  16,    2,  -12 },   // 0x3C '<'
+  {   506,  10,   7,  16,    3,   -9 },   // 0x3D '='
+  {   515,  11,  13,  16,    3,  -12 },   // 0x3E '>'
+  {   533,  10,  17,  12,    1,  -16 },   // 0x3F '?'
+  {   555,  20,  21,  23,    1,  -15 },   // 0x40 '@'
+  {   608,  15,  17,  16,    1,  -16 },   // 0x41 'A'
+  {   640,  12,  17,  15,    2,  -16 },   // 0x42 'B'
+  {   666,  15,  17,  17,    1,  -16 },   // 0x43 'C'
+  {   698,  14,  17,  17,    2,  -16 },   // 0x44 'D'
+  {   728,  11,  17,  14,    2,  -16 },   // 0x45 'E'
+  {   752,  10,  17,  14,    2,  -16 },   // 0x46 'F'
+  {   774,  15,  17,  18,    1,  -16 },   // 0x47 'G'
+  {   806,  13,  17,  17,    2,  -16 },   // 0x48 'H'
+  {   834,   2,  17,   6,    2,  -16 },   // 0x49 'I'
+  {   839,  10,  17,  13,    1,  -16 },   // 0x4A 'J'
+  {   861,  13,  17,  16,    2,  -16 },   // 0x4B 'K'
+  {   889,  10,  17,  13,    2,  -16 },   // 0x4C 'L'
+  {   911,  17,  17,  21,    2,  -16 },   // 0x4D 'M'
+  {   948,  14,  17,  18,    2,  -16 },   // 0x4E 'N'
+  {   978,  16,  17,  18,    1,  -16 },   // 0x4F 'O'
+  {  1012,  12,  17,  15,    2,  -16 },   // 0x50 'P'
+  {  1038,  16,  18,  18,    1,  -16 },   // 0x51 'Q'
+  {  1074,  12,  17,  15,    2,  -16 },   // 0x52 'R'
+  {  1100,  13,  17,  15,    1,  -16 },   // 0x53 'S'
+  {  1128,  13,  17,  15,    1,  -16 },   // 0x54 'T'
+  {  1156,  13,  17,  17,    2,  -16 },   // 0x55 'U'
+  {  1184,  15,  17,  16,    1,  -16 },   // 0x56 'V'
+  {  1216,  22,  17,  23,    1,  -16 },   // 0x57 'W'
+  {  1263,  14,  17,  16,    1,  -16 },   // 0x58 'X'
+  {  1293,  14,  17,  16,    1,  -16 },   // 0x59 'Y'
+  {  1323,  12,  17,  15,    1,  -16 },   // 0x5A 'Z'
+  {  1349,   4,  21,   9,    3,  -17 },   // 0x5B '['
+  {  1360,   7,  21,   8,    1,  -17 },   // 0x5C '\'
+  {  1379,   5,  21,   9,    1,  -17 },   // 0x5D ']'
+  {  1393,   9,   7,  11,    1,  -15 },   // 0x5E '^'
+  {  1401,  11,   2,  11,    0,    1 },   // 0x5F '_'
+  {  1404,   4,   3,   8,    2,  -17 },   // 0x60 '`'
+  {  1406,  10,  13,  13,    1,  -12 },   // 0x61 'a'
+  {  1423,  11,  17,  14,    2,  -16 },   // 0x62 'b'
+  {  1447,  11,  13,  13,    1,  -12 },   // 0x63 'c'
+  {  1465,  12,  17,  14,    1,  -16 },   // 0x64 'd'
+  {  1491,  12,  13,  14,    1,  -12 },   // 0x65 'e'
+  {  1511,   8,  18,   9,    0,  -17 },   // 0x66 'f'
+  {  1529,  12,  18,  14,    1,  -12 },   // 0x67 'g'
+  {  1556,  10,  17,  14,    2,  -16 },   // 0x68 'h'
+  {  1578,   3,  18,   6,    1,  -17 },   // 0x69 'i'
+  {  1585,   4,  23,   6,    0,  -17 },   // 0x6A 'j'
+  {  1597,  11,  17,  13,    2,  -16 },   // 0x6B 'k'
+  {  1621,   2,  17,   6,    2,  -16 },   // 0x6C 'l'
+  {  1626,  17,  13,  21,    2,  -12 },   // 0x6D 'm'
+  {  1654,  10,  13,  14,    2,  -12 },   // 0x6E 'n'
+  {  1671,  12,  13,  14,    1,  -12 },   // 0x6F 'o'
+  {  1691,  11,  18,  14,    2,  -12 },   // 0x70 'p'
+  {  1716,  12,  18,  14,    1,  -12 },   // 0x71 'q'
+  {  1743,   6,  13,   9,    2,  -12 },   // 0x72 'r'
+  {  1753,  10,  13,  12,    1,  -12 },   // 0x73 's'
+  {  1770,   7,  16,   8,    0,  -15 },   // 0x74 't'
+  {  1784,  10,  13,  14,    2,  -12 },   // 0x75 'u'
+  {  1801,  12,  13,  13,    1,  -12 },   // 0x76 'v'
+  {  1821,  17,  13,  19,    1,  -12 },   // 0x77 'w'
+  {  1849,  11,  13,  13,    1,  -12 },   // 0x78 'x'
+  {  1867,  12,  18,  13,    1,  -12 },   // 0x79 'y'
+  {  1894,  11,  13,  13,    1,  -12 },   // 0x7A 'z'
+  {  1912,   7,  22,  10,    2,  -17 },   // 0x7B '{'
+  {  1932,   2,  28,   8,    3,  -22 },   // 0x7C '|'
+  {  1939,   7,  22,  10,    1,  -17 },   // 0x7D '}'
+  {  1959,  12,   4,  16,    2,   -8 } }; // 0x7E '~'
+
+const GFXfont Inter_Regular12pt7b PROGMEM = {
+  (uint8_t  *)Inter_Regular12pt7bBitmaps,
+  (GFXglyph *)Inter_Regular12pt7bGlyphs,
+  0x20, 0x7E, 28 };
+
+// Approx. 2637 bytes
@@ -0,0 +1,195 @@
+// ParserBench.cpp - Throughput, peak heap and stack depth of the realtime and forecast parse
+// and fetch paths on examples/realtime.json and examples/forecast.json, against the buffered-body
+// baseline the streaming parser replaced
+//   ParserBench [runs]   (default 200)
+// ArduinoJson is not part of the host build, so the DynamicJsonDocument parsers cannot run here.
+// The buffered rows stand in for them: the same body String, before the document's own heap
+// (2048 B realtime, 8192 B forecast), which is printed alongside.
+#include <Arduino.h>
+#include <pthread.h>
+#include <chrono>
+#include <functional>
+#include "WeatherRealtime.h"
+#include "WeatherForecast.h"
+#include "../tests/ExampleServers.h"
+#include "../tests/HeapCounter.h"
+
+namespace {
+  // The old body path: the whole response appended to one String, reserved up front when
+  // the length is known (ArduinoHttpClient::responseBody()), then parsed from memory
+  class BufferedBody : public BodySink {
+  public:
+    String body;
+
+    bool write(const char* data, size_t length) override {
+      body += String(std::string(data, length));
+      return true;
+    }
+
+    bool finish() override {
+      return true;
+    }
+  };
+
+  const size_t STACK_BYTES = 256 * 1024;
+  const uint8_t STACK_PAINT = 0xA5;
+  alignas(4096) uint8_t threadStack[STACK_BYTES];
+
+  void* runWork(void* work) {
+    (*(const std::function<bool()>*)work)();
+    return nullptr;
+  }
+
+  // Run `work` once on a thread whose stack is painted first; the stack grows down, so the
+  // paint left at the bottom shows how deep it went. Includes the thread's own setup.
+  size_t paintedStackUse(const std::function<bool()>& work) {
+    memset(threadStack, STACK_PAINT, sizeof(threadStack));
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+    pthread_attr_setstack(&attributes, threadStack, sizeof(threadStack));
+    pthread_t thread;
+    if (pthread_create(&thread, &attributes, runWork, (void*)&work) != 0) {
+      pthread_attr_destroy(&attributes);
+      return 0;
+    }
+    pthread_join(thread, nullptr);
+    pthread_attr_destroy(&attributes);
+
+    size_t untouched = 0;
+    while (untouched < sizeof(threadStack) && threadStack[untouched] == STACK_PAINT) {
+      untouched++;
+    }
+    return sizeof(threadStack) - untouched;
+  }
+
+  // Stack high-water of one run of `work`, beyond what an idle thread touches
+  size_t stackHighWater(const std::function<bool()>& work) {
+    static const size_t idle = paintedStackUse([]() {
+      return true;
+    });
+    size_t used = paintedStackUse(work);
+    return used > idle ? used - idle : 0;
+  }
+
+  // Run `work` `runs` times; report bytes/s, the most heap it held at once in any run, and
+  // the stack one more run reached
+  bool measure(const char* name, size_t bytes, int runs, const std::function<bool()>& work) {
+    bool ok = true;
+    size_t baseline = HeapCounter::live();
+    HeapCounter::reset();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++) {
+      ok = work() && ok;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    size_t peak = HeapCounter::peakSince(baseline);
+    double allocations = HeapCounter::allocations() / (double)runs;
+    printf("%-36s %8.1f MB/s  %7.1f us/run  peak heap %7zu B  %5.1f allocations/run  stack %5zu B%s\n", name,
+      bytes * (double)runs / seconds / 1e6, seconds * 1e6 / runs, peak, allocations, stackHighWater(work),
+      ok ? "" : "  FAILED");
+    return ok;
+  }
+
+  // Parse alone, framed and streamed in 512-byte socket reads as SimpleHttpClient does, and
+  // the buffered baseline: the same reads collected into a String and parsed once complete
+  bool measureParses(const std::string& document, int runs, JsonStreamParser& parser,
+    const std::function<bool()>& clearAndCheck) {
+    const std::string response = HostNet::chunkedResponse(document, 4096);
+    bool ok = measure("parse, whole document", document.size(), runs, [&]() {
+      clearAndCheck();
+      parser.reset();
+      parser.feed(document.data(), document.size());
+      return parser.finish() && clearAndCheck();
+    });
+
+    ok = measure("streamed: framing + parse, 512 B", document.size(), runs, [&]() {
+      clearAndCheck();
+      parser.reset();
+      HttpResponseReader reader(&parser);
+      for (size_t offset = 0; offset < response.size(); offset += 512) {
+        reader.write(response.data() + offset, response.size() - offset < 512 ? response.size() - offset : 512);
+      }
+      return reader.finish() && clearAndCheck();
+    }) && ok;
+
+    ok = measure("buffered: framing, String, parse", document.size(), runs, [&]() {
+      clearAndCheck();
+      parser.reset();
+      BufferedBody buffered;
+      HttpResponseReader reader(&buffered);
+      for (size_t offset = 0; offset < response.size(); offset += 512) {
+        reader.write(response.data() + offset, response.size() - offset < 512 ? response.size() - offset : 512);
+      }
+      reader.finish();
+      parser.feed(buffered.body.c_str(), buffered.body.length());
+      return parser.finish() && clearAndCheck();
+    }) && ok;
+    return ok;
+  }
+
+  bool isComplete(const ForecastData& data) {
+    return data.dayCount == 7 && data.hourCount == 24 && data.minuteCount == 60;
+  }
+}
+
+int main(int argc, char** argv) {
+  int runs = argc > 1 ? atoi(argv[1]) : 200;
+  bool ok = true;
+  printf("JsonStreamParser is %zu bytes, RealtimeWeatherData %zu bytes, ForecastData %zu bytes\n",
+    sizeof(JsonStreamParser), sizeof(RealtimeWeatherData), sizeof(ForecastData));
+  printf("No ArduinoJson in the host build: its DynamicJsonDocuments held 2048 B (realtime) and 8192 B (forecast)\n"
+    "of heap on top of the buffered rows' body String. Stack is per run, beyond an idle thread's; fetch rows\n"
+    "include the in-process server's frames.\n");
+
+  // Each check runs before a parse, where it clears the record, and after, where its result counts
+  const std::string realtimeDocument = TestSupport::readSourceFile("examples/realtime.json");
+  static RealtimeWeatherData realtimeData;
+  static RealtimeStreamHandler realtimeHandler(realtimeData);
+  static JsonStreamParser realtimeParser(&realtimeHandler);
+  printf("\nexamples/realtime.json: %zu bytes, %d runs\n", realtimeDocument.size(), runs);
+  ok = measureParses(realtimeDocument, runs, realtimeParser, []() {
+    bool complete = realtimeHandler.hasValues() && realtimeData.weatherCode != 0;
+    realtimeData = {};
+    realtimeHandler.reset();
+    return complete;
+  }) && ok;
+
+  const std::string forecastDocument = TestSupport::readSourceFile("examples/forecast.json");
+  static ForecastData forecastData;
+  static ForecastStreamHandler forecastHandler(forecastData);
+  static JsonStreamParser forecastParser(&forecastHandler);
+  printf("\nexamples/forecast.json: %zu bytes, %d runs\n", forecastDocument.size(), runs);
+  ok = measureParses(forecastDocument, runs, forecastParser, []() {
+    bool complete = isComplete(forecastData);
+    forecastData = {};
+    return complete;
+  }) && ok;
+
+  // Whole fetches through SimpleHttpClient and the connection pool from an in-process server;
+  // the virtual clock keeps the client's 1 ms poll waits out of the measurement
+  HostClock::setVirtual(true);
+  ExampleServers servers;
+  printf("\nfetches, %d runs\n", runs);
+  static WeatherRealtime realtime("key", "0,0");
+  ok = measure("realtime fetch via SimpleHttpClient", realtimeDocument.size(), runs, [&]() {
+    return realtime.fetchWeatherData().isValid;
+  }) && ok;
+
+  static WeatherForecast forecast("key", "0,0");
+  ok = measure("streamed fetch via SimpleHttpClient", forecastDocument.size(), runs, [&]() {
+    return isComplete(forecast.fetchForecastData());
+  }) && ok;
+
+  static SimpleHttpClient client;
+  ok = measure("buffered fetch via SimpleHttpClient", forecastDocument.size(), runs, [&]() {
+    forecastData = {};
+    forecastParser.reset();
+    BufferedBody buffered;
+    client.get("api.tomorrow.io", "/v4/weather/forecast", buffered);
+    forecastParser.feed(buffered.body.c_str(), buffered.body.length());
+    return forecastParser.finish() && isComplete(forecastData);
+  }) && ok;
+
+  printf("\n%lu handshakes, %lu reused connections\n", ConnectionPool::getHandshakeCount(), ConnectionPool::getReuseCount());
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,295 @@
+// Arduino.h - Host stand-in for the parts of the Arduino core the sketch and lib/ use
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define memcpy_P memcpy
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+using std::min;
+using std::max;
+
+// Time since start. Real by default; a virtual clock only moves when delay() or
+// HostClock::advance() moves it, so simulations of hours run in milliseconds
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+namespace HostClock {
+  void setVirtual(bool enabled);
+  bool isVirtual();
+  void advance(unsigned long ms);
+  void advanceMicros(unsigned long us);
+  void reset(); // Back to 0 ms; the virtual setting is kept
+}
+
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+// Arduino String over std::string; only what the tree uses
+class String {
+private:
+  std::string text;
+
+public:
+  String() {
+  }
+
+  String(const char* value) : text(value != nullptr ? value : "") {
+  }
+
+  String(const std::string& value) : text(value) {
+  }
+
+  explicit String(char value) : text(1, value) {
+  }
+
+  String(int value) : text(std::to_string(value)) {
+  }
+
+  String(unsigned int value) : text(std::to_string(value)) {
+  }
+
+  String(long value) : text(std::to_string(value)) {
+  }
+
+  String(unsigned long value) : text(std::to_string(value)) {
+  }
+
+  String(float value, int decimals = 2) : text(format(value, decimals)) {
+  }
+
+  String(double value, int decimals = 2) : text(format(value, decimals)) {
+  }
+
+  const char* c_str() const {
+    return text.c_str();
+  }
+
+  unsigned int length() const {
+    return text.size();
+  }
+
+  bool isEmpty() const {
+    return text.empty();
+  }
+
+  void reserve(unsigned int size) {
+    text.reserve(size);
+  }
+
+  char operator[](unsigned int index) const {
+    return index < text.size() ? text[index] : '\0';
+  }
+
+  String& operator+=(const String& other) {
+    text += other.text;
+    return *this;
+  }
+
+  String& operator+=(const char* other) {
+    text += other;
+    return *this;
+  }
+
+  String& operator+=(char other) {
+    text += other;
+    return *this;
+  }
+
+  bool operator==(const String& other) const {
+    return text == other.text;
+  }
+
+  bool operator==(const char* other) const {
+    return text == other;
+  }
+
+  bool operator!=(const String& other) const {
+    return text != other.text;
+  }
+
+  bool operator!=(const char* other) const {
+    return text != other;
+  }
+
+  bool operator<(const String& other) const {
+    return text < other.text;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    size_t found = text.find(c, from);
+    return found == std::string::npos ? -1 : (int)found;
+  }
+
+  int indexOf(const char* value, unsigned int from = 0) const {
+    size_t found = text.find(value, from);
+    return found == std::string::npos ? -1 : (int)found;
+  }
+
+  String substring(unsigned int from) const {
+    return from < text.size() ? String(text.substr(from)) : String();
+  }
+
+  String substring(unsigned int from, unsigned int to) const {
+    return from < to && from < text.size() ? String(text.substr(from, to - from)) : String();
+  }
+
+  bool startsWith(const String& prefix) const {
+    return text.compare(0, prefix.text.size(), prefix.text) == 0;
+  }
+
+  bool equalsIgnoreCase(const String& other) const {
+    return strcasecmp(text.c_str(), other.text.c_str()) == 0;
+  }
+
+  float toFloat() const {
+    return (float)atof(text.c_str());
+  }
+
+  long toInt() const {
+    return atol(text.c_str());
+  }
+
+  friend String operator+(const String& a, const String& b) {
+    return String(a.text + b.text);
+  }
+
+  friend String operator+(const String& a, const char* b) {
+    return String(a.text + b);
+  }
+
+  friend String operator+(const char* a, const String& b) {
+    return String(a + b.text);
+  }
+
+private:
+  static std::string format(double value, int decimals) {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+    return buffer;
+  }
+};
+
+class Print {
+public:
+  virtual ~Print() {
+  }
+
+  virtual size_t write(uint8_t c) = 0;
+
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    for (size_t i = 0; i < size; i++) {
+      written += write(buffer[i]);
+    }
+    return written;
+  }
+
+  size_t write(const char* text) {
+    return write((const uint8_t*)text, strlen(text));
+  }
+
+  size_t print(const char* text) {
+    return write(text);
+  }
+
+  size_t print(const String& text) {
+    return write(text.c_str());
+  }
+
+  size_t print(char c) {
+    return write((uint8_t)c);
+  }
+
+  size_t print(int value) {
+    return print(String(value));
+  }
+
+  size_t print(unsigned int value) {
+    return print(String(value));
+  }
+
+  size_t print(long value) {
+    return print(String(value));
+  }
+
+  size_t print(unsigned long value) {
+    return print(String(value));
+  }
+
+  size_t print(double value, int decimals = 2) {
+    return print(String(value, decimals));
+  }
+
+  size_t println() {
+    return write("\r\n");
+  }
+
+  template <typename T>
+  size_t println(T value) {
+    size_t written = print(value);
+    return written + println();
+  }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+
+  virtual int peek() {
+    return -1;
+  }
+};
+
+// Serial output goes to stdout only when echo is on, so test output stays readable
+class HardwareSerial : public Print {
+private:
+  bool echo;
+  bool stamp;
+  bool lineStart;
+
+public:
+  HardwareSerial() : echo(false), stamp(false), lineStart(true) {
+  }
+
+  void begin(unsigned long) {
+  }
+
+  // Print what the sketch logs, optionally with millis() at the start of each line
+  void setEcho(bool enabled, bool withTimestamps = false) {
+    echo = enabled;
+    stamp = withTimestamps;
+  }
+
+  size_t write(uint8_t c) override {
+    if (echo) {
+      if (stamp && lineStart) {
+        printf("[%lu] ", millis());
+      }
+      lineStart = c == '\n';
+      putchar(c);
+    }
+    return 1;
+  }
+
+  using Print::write;
+};
+
+extern HardwareSerial Serial;
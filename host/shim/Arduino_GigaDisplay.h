@@ -0,0 +1,11 @@
+// Arduino_GigaDisplay.h - Host stand-in for the Giga display backlight
+#pragma once
+
+class GigaDisplayBacklight {
+public:
+  void begin() {
+  }
+
+  void set(int) {
+  }
+};
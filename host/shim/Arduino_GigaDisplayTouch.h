@@ -0,0 +1,21 @@
+// Arduino_GigaDisplayTouch.h - Host stand-in for the Giga touch controller; never touched
+#pragma once
+#include <Arduino.h>
+
+typedef struct {
+  uint8_t trackId;
+  uint16_t x;
+  uint16_t y;
+  uint16_t area;
+} GDTpoint_t;
+
+class Arduino_GigaDisplayTouch {
+public:
+  bool begin() {
+    return true;
+  }
+
+  uint8_t getTouchPoints(GDTpoint_t*) {
+    return 0;
+  }
+};
@@ -0,0 +1,455 @@
+// Arduino_GigaDisplay_GFX.h - Host stand-in for Adafruit_GFX and the Giga panel
+#pragma once
+#include <Arduino.h>
+#include <utility>
+#include <vector>
+
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t* bitmap;
+  GFXglyph* glyph;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+} GFXfont;
+
+// The Adafruit_GFX drawing algorithms the tree relies on, with the same virtual
+// hooks, so FrameBuffer and the icon code draw the same pixels as on the board
+class Adafruit_GFX : public Print {
+protected:
+  int16_t WIDTH;
+  int16_t HEIGHT;
+  int16_t _width;
+  int16_t _height;
+  int16_t cursor_x = 0;
+  int16_t cursor_y = 0;
+  uint16_t textcolor = 0xFFFF;
+  uint8_t textsize = 1;
+  uint8_t rotation = 0;
+  const GFXfont* gfxFont = nullptr;
+
+public:
+  Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {
+  }
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void startWrite() {
+  }
+
+  virtual void endWrite() {
+  }
+
+  virtual void writePixel(int16_t x, int16_t y, uint16_t color) {
+    drawPixel(x, y, color);
+  }
+
+  virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    fillRect(x, y, w, h, color);
+  }
+
+  virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    drawFastVLine(x, y, h, color);
+  }
+
+  virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+  }
+
+  virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+      std::swap(x0, y0);
+      std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+      std::swap(x0, x1);
+      std::swap(y0, y1);
+    }
+
+    int16_t dx = x1 - x0;
+    int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = y0 < y1 ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+      if (steep) {
+        writePixel(y0, x0, color);
+      }
+      else {
+        writePixel(x0, y0, color);
+      }
+      err -= dy;
+      if (err < 0) {
+        y0 += ystep;
+        err += dx;
+      }
+    }
+  }
+
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    writeLine(x, y, x, y + h - 1, color);
+  }
+
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    writeLine(x, y, x + w - 1, y, color);
+  }
+
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t i = x; i < x + w; i++) {
+      writeFastVLine(i, y, h, color);
+    }
+  }
+
+  virtual void fillScreen(uint16_t color) {
+    fillRect(0, 0, _width, _height, color);
+  }
+
+  virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (x0 == x1) {
+      if (y0 > y1) {
+        std::swap(y0, y1);
+      }
+      drawFastVLine(x0, y0, y1 - y0 + 1, color);
+    }
+    else if (y0 == y1) {
+      if (x0 > x1) {
+        std::swap(x0, x1);
+      }
+      drawFastHLine(x0, y0, x1 - x0 + 1, color);
+    }
+    else {
+      writeLine(x0, y0, x1, y1, color);
+    }
+  }
+
+  virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    writeFastHLine(x, y, w, color);
+    writeFastHLine(x, y + h - 1, w, color);
+    writeFastVLine(x, y, h, color);
+    writeFastVLine(x + w - 1, y, h, color);
+  }
+
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+
+    writePixel(x0, y0 + r, color);
+    writePixel(x0, y0 - r, color);
+    writePixel(x0 + r, y0, color);
+    writePixel(x0 - r, y0, color);
+    while (x < y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f += ddF_x;
+      writePixel(x0 + x, y0 + y, color);
+      writePixel(x0 - x, y0 + y, color);
+      writePixel(x0 + x, y0 - y, color);
+      writePixel(x0 - x, y0 - y, color);
+      writePixel(x0 + y, y0 + x, color);
+      writePixel(x0 - y, y0 + x, color);
+      writePixel(x0 + y, y0 - x, color);
+      writePixel(x0 - y, y0 - x, color);
+    }
+  }
+
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    writeFastVLine(x0, y0 - r, 2 * r + 1, color);
+    fillCircleHelper(x0, y0, r, 3, 0, color);
+  }
+
+  void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    int16_t px = x;
+    int16_t py = y;
+
+    delta++;
+    while (x < y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f += ddF_x;
+      if (x < (y + 1)) {
+        if (corners & 1) {
+          writeFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+        }
+        if (corners & 2) {
+          writeFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+        }
+      }
+      if (y != py) {
+        if (corners & 1) {
+          writeFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+        }
+        if (corners & 2) {
+          writeFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+        }
+        py = y;
+      }
+      px = x;
+    }
+  }
+
+  void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    drawLine(x0, y0, x1, y1, color);
+    drawLine(x1, y1, x2, y2, color);
+    drawLine(x2, y2, x0, y0, color);
+  }
+
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    int16_t a, b, y, last;
+    if (y0 > y1) {
+      std::swap(y0, y1);
+      std::swap(x0, x1);
+    }
+    if (y1 > y2) {
+      std::swap(y2, y1);
+      std::swap(x2, x1);
+    }
+    if (y0 > y1) {
+      std::swap(y0, y1);
+      std::swap(x0, x1);
+    }
+
+    if (y0 == y2) {
+      a = b = x0;
+      a = x1 < a ? x1 : a;
+      b = x1 > b ? x1 : b;
+      a = x2 < a ? x2 : a;
+      b = x2 > b ? x2 : b;
+      writeFastHLine(a, y0, b - a + 1, color);
+      return;
+    }
+
+    int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+    int32_t sa = 0, sb = 0;
+    last = y1 == y2 ? y1 : y1 - 1;
+    for (y = y0; y <= last; y++) {
+      a = x0 + sa / dy01;
+      b = x0 + sb / dy02;
+      sa += dx01;
+      sb += dx02;
+      if (a > b) {
+        std::swap(a, b);
+      }
+      writeFastHLine(a, y, b - a + 1, color);
+    }
+
+    sa = (int32_t)dx12 * (y - y1);
+    sb = (int32_t)dx02 * (y - y0);
+    for (; y <= y2; y++) {
+      a = x1 + sa / dy12;
+      b = x0 + sb / dy02;
+      sa += dx12;
+      sb += dx02;
+      if (a > b) {
+        std::swap(a, b);
+      }
+      writeFastHLine(a, y, b - a + 1, color);
+    }
+  }
+
+  void drawRGBBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) {
+    for (int16_t j = 0; j < h; j++) {
+      for (int16_t i = 0; i < w; i++) {
+        writePixel(x + i, y + j, bitmap[j * w + i]);
+      }
+    }
+  }
+
+  void setRotation(uint8_t r) {
+    rotation = r & 3;
+    _width = rotation & 1 ? HEIGHT : WIDTH;
+    _height = rotation & 1 ? WIDTH : HEIGHT;
+  }
+
+  uint8_t getRotation() const {
+    return rotation;
+  }
+
+  int16_t width() const {
+    return _width;
+  }
+
+  int16_t height() const {
+    return _height;
+  }
+
+  void setTextSize(uint8_t size) {
+    textsize = size;
+  }
+
+  void setTextColor(uint16_t color) {
+    textcolor = color;
+  }
+
+  void setTextColor(uint16_t color, uint16_t) {
+    textcolor = color;
+  }
+
+  void setCursor(int16_t x, int16_t y) {
+    cursor_x = x;
+    cursor_y = y;
+  }
+
+  int16_t getCursorX() const {
+    return cursor_x;
+  }
+
+  int16_t getCursorY() const {
+    return cursor_y;
+  }
+
+  void setFont(const GFXfont* font) {
+    gfxFont = font;
+  }
+
+  void getTextBounds(const char* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+    int minX = 32767, minY = 32767, maxX = -32768, maxY = -32768;
+    int penX = x;
+    for (; *text; text++) {
+      if (gfxFont == nullptr) {
+        penX += 6 * textsize;
+        continue;
+      }
+      uint8_t c = *text;
+      if (c < gfxFont->first || c > gfxFont->last) {
+        continue;
+      }
+      const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+      int gx1 = penX + glyph->xOffset * textsize;
+      int gy1 = y + glyph->yOffset * textsize;
+      if (glyph->width > 0 && glyph->height > 0) {
+        minX = gx1 < minX ? gx1 : minX;
+        minY = gy1 < minY ? gy1 : minY;
+        maxX = gx1 + glyph->width * textsize - 1 > maxX ? gx1 + glyph->width * textsize - 1 : maxX;
+        maxY = gy1 + glyph->height * textsize - 1 > maxY ? gy1 + glyph->height * textsize - 1 : maxY;
+      }
+      penX += glyph->xAdvance * textsize;
+    }
+
+    if (maxX >= minX) {
+      *x1 = minX;
+      *y1 = minY;
+      *w = maxX - minX + 1;
+      *h = maxY - minY + 1;
+    }
+    else {
+      *x1 = x;
+      *y1 = y;
+      *w = 0;
+      *h = 0;
+    }
+  }
+
+  size_t write(uint8_t c) override {
+    if (gfxFont == nullptr) {
+      // Built-in 6x8 font: advance only, the glyph table is not part of the stand-in
+      cursor_x += 6 * textsize;
+      return 1;
+    }
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += gfxFont->yAdvance * textsize;
+      return 1;
+    }
+    if (c < gfxFont->first || c > gfxFont->last) {
+      return 1;
+    }
+
+    const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+    const uint8_t* bitmap = gfxFont->bitmap + glyph->bitmapOffset;
+    uint8_t bits = 0, bit = 0;
+    for (int yy = 0; yy < glyph->height; yy++) {
+      for (int xx = 0; xx < glyph->width; xx++) {
+        if (!(bit++ & 7)) {
+          bits = *bitmap++;
+        }
+        if (bits & 0x80) {
+          if (textsize == 1) {
+            writePixel(cursor_x + glyph->xOffset + xx, cursor_y + glyph->yOffset + yy, textcolor);
+          }
+          else {
+            fillRect(cursor_x + (glyph->xOffset + xx) * textsize, cursor_y + (glyph->yOffset + yy) * textsize,
+              textsize, textsize, textcolor);
+          }
+        }
+        bits <<= 1;
+      }
+    }
+    cursor_x += glyph->xAdvance * textsize;
+    return 1;
+  }
+
+  using Print::write;
+};
+
+// The 800x480 panel. Pixels are counted, so tests can see how much a frame pushed to the
+// display, and kept in the current orientation, so they can see what it shows
+class GigaDisplay_GFX : public Adafruit_GFX {
+private:
+  unsigned long pixelsWritten = 0;
+  std::vector<uint16_t> pixels;
+
+public:
+  GigaDisplay_GFX() : Adafruit_GFX(480, 800), pixels(480 * 800, 0) {
+    last() = this;
+  }
+
+  ~GigaDisplay_GFX() {
+    if (last() == this) {
+      last() = nullptr;
+    }
+  }
+
+  // The most recently constructed panel, i.e. the sketch's
+  static GigaDisplay_GFX*& last() {
+    static GigaDisplay_GFX* panel = nullptr;
+    return panel;
+  }
+
+  void begin() {
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    pixelsWritten++;
+    if (x >= 0 && y >= 0 && x < width() && y < height()) {
+      pixels[y * width() + x] = color;
+    }
+  }
+
+  uint16_t getPixel(int16_t x, int16_t y) const {
+    return x >= 0 && y >= 0 && x < width() && y < height() ? pixels[y * width() + x] : 0;
+  }
+
+  unsigned long getPixelsWritten() const {
+    return pixelsWritten;
+  }
+
+  void resetPixelsWritten() {
+    pixelsWritten = 0;
+  }
+};
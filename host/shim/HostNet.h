@@ -0,0 +1,60 @@
+// HostNet.h - In-process stand-in network behind the WiFiSSLClient and WiFiUDP shims
+#pragma once
+#include <Arduino.h>
+#include <functional>
+#include <memory>
+#include <string>
+
+// One scripted server at host:port. Each request (everything up to the blank line after the
+// headers) gets the raw HTTP response that respond() returns. Delivery can be slowed down:
+// the first byte after firstByteDelayMs, then bytesPerStep bytes every stepMs. All times are
+// millis(), so a virtual clock (HostClock) replays hours of a slow server instantly.
+struct HostEndpoint {
+  std::function<std::string(const std::string& request)> respond;
+  unsigned long connectDelayMs = 0;   // The handshake blocks the caller this long
+  unsigned long firstByteDelayMs = 0;
+  size_t bytesPerStep = 0;            // 0 sends each response all at once
+  unsigned long stepMs = 0;
+  unsigned long readCostMs = 0;       // Charged to the clock by every read() that returns data
+  bool refuse = false;
+  bool closeAfterResponse = false;    // The server hangs up once the response is read
+
+  // Counted by the shim
+  unsigned long connects = 0;         // Plain connect() calls that reached this endpoint
+  unsigned long sslConnects = 0;      // connectSSL() calls
+  unsigned long requests = 0;
+  unsigned long bytesRead = 0;        // Response bytes handed to the client by read()
+};
+
+// Datagram side for SNTP: the shim hands every packet to send() and polls receive().
+// resolve() stands in for beginPacket()'s blocking name lookup.
+struct HostUdpNet {
+  virtual ~HostUdpNet() {
+  }
+  virtual bool resolve(const char* /* host */) {
+    return true;
+  }
+  virtual bool send(const char* host, const uint8_t* data, size_t length) = 0;
+  virtual int receive(uint8_t* data, size_t length) = 0;
+};
+
+namespace HostNet {
+  // Register a server; the endpoint must outlive the connections made to it
+  void serve(const char* host, int port, HostEndpoint* endpoint);
+  void clear();
+  HostEndpoint* find(const char* host, int port);
+
+  // An HTTP/1.1 response with a Content-Length body
+  std::string httpResponse(const std::string& body, int status = 200, const char* extraHeaders = "");
+  // The same body framed as chunks of at most chunkSize bytes
+  std::string chunkedResponse(const std::string& body, size_t chunkSize, int status = 200);
+  // Body delimited by the server closing the connection
+  std::string closeDelimitedResponse(const std::string& body, int status = 200);
+
+  void setUdp(HostUdpNet* net);
+  HostUdpNet* getUdp();
+
+  // True on a thread that is running stand-in server code, so heap measurements can
+  // leave the servers' own buffers out
+  bool inServer();
+}
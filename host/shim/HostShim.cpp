@@ -0,0 +1,331 @@
+// HostShim.cpp - Globals and out-of-line parts of the host stand-ins
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+
+HardwareSerial Serial;
+WiFiClass WiFi;
+
+// Clock
+
+namespace {
+  std::atomic<bool> virtualClock(false);
+  std::atomic<uint64_t> virtualUs(0);
+  std::chrono::steady_clock::time_point realStart = std::chrono::steady_clock::now();
+
+  uint64_t elapsedUs() {
+    if (virtualClock) {
+      return virtualUs;
+    }
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - realStart).count();
+  }
+}
+
+unsigned long millis() {
+  return (unsigned long)(elapsedUs() / 1000);
+}
+
+// 32 bits wide like the board's, so it wraps every 71.6 minutes
+unsigned long micros() {
+  return (uint32_t)elapsedUs();
+}
+
+void delay(unsigned long ms) {
+  if (virtualClock) {
+    virtualUs += (uint64_t)ms * 1000;
+    return;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+namespace HostClock {
+  void setVirtual(bool enabled) {
+    if (enabled && !virtualClock) {
+      virtualUs = elapsedUs();
+    }
+    virtualClock = enabled;
+  }
+
+  bool isVirtual() {
+    return virtualClock;
+  }
+
+  void advance(unsigned long ms) {
+    virtualUs += (uint64_t)ms * 1000;
+  }
+
+  void advanceMicros(unsigned long us) {
+    virtualUs += us;
+  }
+
+  void reset() {
+    virtualUs = 0;
+    realStart = std::chrono::steady_clock::now();
+  }
+}
+
+long random(long howBig) {
+  return howBig > 0 ? rand() % howBig : 0;
+}
+
+long random(long howSmall, long howBig) {
+  return howBig > howSmall ? howSmall + random(howBig - howSmall) : howSmall;
+}
+
+void randomSeed(unsigned long seed) {
+  srand((unsigned)seed);
+}
+
+// Network
+
+struct HostConnection {
+  HostEndpoint* endpoint;
+  bool open;
+  std::string request;       // Request bytes not yet answered
+  std::string response;      // Queued response bytes, from the oldest one not yet read
+  size_t readPosition;
+  size_t scheduleBase;       // The newest response starts here...
+  unsigned long scheduleStart; // ...and its first byte is released at this millis()
+  bool answered;
+
+  explicit HostConnection(HostEndpoint* endpoint)
+    : endpoint(endpoint), open(true), readPosition(0), scheduleBase(0), scheduleStart(0), answered(false) {
+  }
+
+  size_t released() const {
+    unsigned long now = millis();
+    if (now < scheduleStart) {
+      return scheduleBase;
+    }
+    if (endpoint->bytesPerStep == 0 || endpoint->stepMs == 0) {
+      return response.size();
+    }
+    size_t allowed = scheduleBase + endpoint->bytesPerStep * ((now - scheduleStart) / endpoint->stepMs + 1);
+    return allowed < response.size() ? allowed : response.size();
+  }
+
+  // The server hangs up after sending a response when told to
+  bool closedByServer() const {
+    return endpoint->closeAfterResponse && answered && released() == response.size();
+  }
+};
+
+namespace {
+  std::map<std::string, HostEndpoint*> endpoints;
+  HostUdpNet* udpNet = nullptr;
+  thread_local bool serverRunning = false;
+
+  struct ServerScope {
+    ServerScope() {
+      serverRunning = true;
+    }
+
+    ~ServerScope() {
+      serverRunning = false;
+    }
+  };
+
+  std::string endpointKey(const char* host, int port) {
+    return std::string(host) + ":" + std::to_string(port);
+  }
+
+  std::string statusLine(int status) {
+    return "HTTP/1.1 " + std::to_string(status) + (status == 200 ? " OK" : " Error") + "\r\n";
+  }
+}
+
+namespace HostNet {
+  void serve(const char* host, int port, HostEndpoint* endpoint) {
+    endpoints[endpointKey(host, port)] = endpoint;
+  }
+
+  void clear() {
+    endpoints.clear();
+  }
+
+  HostEndpoint* find(const char* host, int port) {
+    std::map<std::string, HostEndpoint*>::iterator found = endpoints.find(endpointKey(host, port));
+    return found != endpoints.end() ? found->second : nullptr;
+  }
+
+  std::string httpResponse(const std::string& body, int status, const char* extraHeaders) {
+    return statusLine(status) + "Content-Type: application/json\r\nContent-Length: " + std::to_string(body.size()) +
+      "\r\n" + extraHeaders + "\r\n" + body;
+  }
+
+  std::string chunkedResponse(const std::string& body, size_t chunkSize, int status) {
+    std::string response = statusLine(status) + "Content-Type: application/json\r\nTransfer-Encoding: chunked\r\n\r\n";
+    for (size_t offset = 0; offset < body.size(); offset += chunkSize) {
+      size_t length = body.size() - offset < chunkSize ? body.size() - offset : chunkSize;
+      char size[16];
+      snprintf(size, sizeof(size), "%zx\r\n", length);
+      response += size + body.substr(offset, length) + "\r\n";
+    }
+    return response + "0\r\n\r\n";
+  }
+
+  std::string closeDelimitedResponse(const std::string& body, int status) {
+    return statusLine(status) + "Content-Type: application/json\r\nConnection: close\r\n\r\n" + body;
+  }
+
+  void setUdp(HostUdpNet* net) {
+    udpNet = net;
+  }
+
+  HostUdpNet* getUdp() {
+    return udpNet;
+  }
+
+  bool inServer() {
+    return serverRunning;
+  }
+}
+
+int WiFiSSLClient::connect(const char* host, uint16_t port) {
+  return open(host, port, false);
+}
+
+int WiFiSSLClient::connectSSL(const char* host, uint16_t port) {
+  return open(host, port, true);
+}
+
+int WiFiSSLClient::open(const char* host, uint16_t port, bool ssl) {
+  stop();
+  HostEndpoint* endpoint = HostNet::find(host, port);
+  if (endpoint == nullptr) {
+    return 0;
+  }
+
+  (ssl ? endpoint->sslConnects : endpoint->connects)++;
+  if (endpoint->connectDelayMs > 0) {
+    delay(endpoint->connectDelayMs);
+  }
+  if (endpoint->refuse) {
+    return 0;
+  }
+  ServerScope scope;
+  connection = std::make_shared<HostConnection>(endpoint);
+  return 1;
+}
+
+uint8_t WiFiSSLClient::connected() {
+  if (!connection || !connection->open) {
+    return 0;
+  }
+  return available() > 0 || !connection->closedByServer();
+}
+
+void WiFiSSLClient::stop() {
+  if (connection) {
+    connection->open = false;
+    connection.reset();
+  }
+}
+
+int WiFiSSLClient::available() {
+  if (!connection || !connection->open) {
+    return 0;
+  }
+  return (int)(connection->released() - connection->readPosition);
+}
+
+int WiFiSSLClient::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiSSLClient::read(uint8_t* buffer, size_t size) {
+  int ready = available();
+  if (ready <= 0) {
+    return -1;
+  }
+
+  size_t count = (size_t)ready < size ? (size_t)ready : size;
+  memcpy(buffer, connection->response.data() + connection->readPosition, count);
+  connection->readPosition += count;
+  connection->endpoint->bytesRead += count;
+  if (connection->endpoint->readCostMs > 0) {
+    delay(connection->endpoint->readCostMs);
+  }
+  return (int)count;
+}
+
+size_t WiFiSSLClient::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t WiFiSSLClient::write(const uint8_t* buffer, size_t size) {
+  if (!connection || !connection->open || connection->closedByServer()) {
+    return 0;
+  }
+
+  ServerScope scope;
+  HostConnection& conn = *connection;
+  conn.request.append((const char*)buffer, size);
+  size_t end;
+  while ((end = conn.request.find("\r\n\r\n")) != std::string::npos) {
+    std::string request = conn.request.substr(0, end + 4);
+    conn.request.erase(0, end + 4);
+    conn.endpoint->requests++;
+    // Drop what the client has already read so kept-alive connections do not grow
+    conn.response.erase(0, conn.readPosition);
+    conn.readPosition = 0;
+    conn.scheduleBase = conn.response.size();
+    conn.scheduleStart = millis() + conn.endpoint->firstByteDelayMs;
+    conn.response += conn.endpoint->respond ? conn.endpoint->respond(request) : std::string();
+    conn.answered = true;
+  }
+  return size;
+}
+
+// Radio
+
+int WiFiClass::begin(const char*, const char*) {
+  begins++;
+  if (!simulate) {
+    return state;
+  }
+  if (refuseAttempts > 0) {
+    refuseAttempts--;
+    state = WL_CONNECT_FAILED;
+    return state;
+  }
+  state = WL_IDLE_STATUS;
+  joining = true;
+  beganAt = millis();
+  return state;
+}
+
+int WiFiClass::status() {
+  if (simulate && joining && apUp && millis() - beganAt >= joinDelayMs) {
+    joining = false;
+    state = WL_CONNECTED;
+  }
+  return state;
+}
+
+void WiFiClass::disconnect() {
+  disconnects++;
+  if (simulate) {
+    state = WL_DISCONNECTED;
+    joining = false;
+  }
+}
+
+void WiFiClass::dropLink() {
+  state = WL_DISCONNECTED;
+  joining = false;
+}
+
+long WiFiClass::RSSI() {
+  if (simulate) {
+    rssi += random(7) - 3;
+    rssi = rssi > -30 ? -30 : (rssi < -90 ? -90 : rssi);
+  }
+  return rssi;
+}
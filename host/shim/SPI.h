@@ -0,0 +1,2 @@
+// SPI.h - Host stand-in; the sketch includes it but calls nothing from it
+#pragma once
@@ -0,0 +1,97 @@
+// WiFi.h - Host stand-in for the Giga WiFi library, backed by HostNet
+#pragma once
+#include <Arduino.h>
+#include <memory>
+#include "HostNet.h"
+
+#define WL_IDLE_STATUS 0
+#define WL_CONNECTED 3
+#define WL_CONNECT_FAILED 4
+#define WL_DISCONNECTED 6
+
+class IPAddress {
+public:
+  String toString() const {
+    return "127.0.0.1";
+  }
+};
+
+class Client : public Stream {
+public:
+  virtual int connect(const char* host, uint16_t port) = 0;
+  virtual uint8_t connected() = 0;
+  virtual void stop() = 0;
+  virtual int read(uint8_t* buffer, size_t size) = 0;
+  using Stream::read;
+
+  virtual void flush() {
+  }
+
+  operator bool() {
+    return connected();
+  }
+};
+
+struct HostConnection;
+
+// Talks to the HostEndpoint registered for host:port. connect() and connectSSL() both
+// negotiate TLS on the real client; the shim counts them separately.
+class WiFiSSLClient : public Client {
+private:
+  std::shared_ptr<HostConnection> connection;
+
+public:
+  int connect(const char* host, uint16_t port) override;
+  int connectSSL(const char* host, uint16_t port);
+  uint8_t connected() override;
+  void stop() override;
+  int available() override;
+  int read() override;
+  int read(uint8_t* buffer, size_t size) override;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+
+private:
+  int open(const char* host, uint16_t port, bool ssl);
+};
+
+// The radio. Joined at once by default; with simulate set, begin() joins after joinDelayMs
+// unless the access point is down or the next refuseAttempts attempts are refused, and
+// dropLink() loses the link.
+class WiFiClass {
+public:
+  bool simulate = false;
+  bool apUp = true;
+  int refuseAttempts = 0;
+  unsigned long joinDelayMs = 1500;
+  long rssi = -50;
+  uint8_t mac[6] = { 0xA8, 0x61, 0x0A, 0x00, 0x00, 0x01 };
+
+  // Counted by the shim
+  int begins = 0;
+  int disconnects = 0;
+
+private:
+  int state = WL_CONNECTED;
+  bool joining = false;
+  unsigned long beganAt = 0;
+
+public:
+  int begin(const char* ssid, const char* password);
+  int status();
+  void disconnect();
+  void dropLink();
+  long RSSI();
+
+  uint8_t* macAddress(uint8_t* address) {
+    memcpy(address, mac, sizeof(mac));
+    return address;
+  }
+
+  IPAddress localIP() {
+    return IPAddress();
+  }
+};
+
+extern WiFiClass WiFi;
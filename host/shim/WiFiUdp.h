@@ -0,0 +1,64 @@
+// WiFiUdp.h - Host stand-in for WiFiUDP; packets go to the HostUdpNet set in HostNet
+#pragma once
+#include <Arduino.h>
+#include "HostNet.h"
+
+class WiFiUDP {
+private:
+  const char* host = nullptr;
+  uint8_t outgoing[512];
+  size_t outgoingLength = 0;
+  uint8_t incoming[512];
+  int incomingLength = 0;
+  int incomingPosition = 0;
+
+public:
+  int begin(int) {
+    return 1;
+  }
+
+  void stop() {
+  }
+
+  int beginPacket(const char* packetHost, int) {
+    HostUdpNet* net = HostNet::getUdp();
+    if (net != nullptr && !net->resolve(packetHost)) {
+      return 0;
+    }
+    host = packetHost;
+    outgoingLength = 0;
+    return 1;
+  }
+
+  size_t write(const uint8_t* data, size_t length) {
+    if (outgoingLength + length <= sizeof(outgoing)) {
+      memcpy(outgoing + outgoingLength, data, length);
+      outgoingLength += length;
+    }
+    return length;
+  }
+
+  int endPacket() {
+    HostUdpNet* net = HostNet::getUdp();
+    return net == nullptr || net->send(host, outgoing, outgoingLength);
+  }
+
+  int parsePacket() {
+    HostUdpNet* net = HostNet::getUdp();
+    incomingLength = net != nullptr ? net->receive(incoming, sizeof(incoming)) : 0;
+    incomingPosition = 0;
+    return incomingLength > 0 ? incomingLength : 0;
+  }
+
+  int available() {
+    return incomingLength - incomingPosition;
+  }
+
+  int read(uint8_t* data, size_t length) {
+    int count = available() < (int)length ? available() : (int)length;
+    count = count > 0 ? count : 0;
+    memcpy(data, incoming + incomingPosition, count);
+    incomingPosition += count;
+    return count;
+  }
+};
@@ -0,0 +1,21 @@
+// HostMain.cpp - Runs the sketch on the desktop against the example servers
+//   today_host [seconds]   (default 60; today_host_offline runs on test data)
+#include <Arduino.h>
+#include <unistd.h>
+#include "today.ino.cpp"
+#include "ExampleServers.h"
+
+int main(int argc, char** argv) {
+  unsigned long runMs = (argc > 1 ? strtoul(argv[1], nullptr, 10) : 60) * 1000;
+  static ExampleServers servers;
+  Serial.setEcho(true, true);
+
+  setup();
+  while (millis() < runMs) {
+    loop();
+  }
+
+  // The network thread is still running; leave without tearing down what it uses
+  fflush(stdout);
+  _exit(0);
+}
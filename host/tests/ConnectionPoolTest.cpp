@@ -0,0 +1,76 @@
+// ConnectionPoolTest.cpp - Handshakes and per-request latency for the realtime and pool clients
+// sharing ConnectionPool, against stand-in servers whose handshake costs 900 ms of virtual time
+#include <Arduino.h>
+#include "TimeManager.h"
+#include "WeatherRealtime.h"
+#include "PoolTemperature.h"
+#include "ExampleServers.h"
+
+namespace {
+  const unsigned long HANDSHAKE_MS = 900;
+
+  // Fetch realtime then pool `rounds` times, `gapMs` apart; returns the slowest request that
+  // reused a connection
+  unsigned long fetchRounds(WeatherRealtime& realtime, PoolTemperature& pool, int rounds, unsigned long gapMs) {
+    unsigned long slowestReused = 0;
+    for (int i = 0; i < rounds; i++) {
+      unsigned long start = millis();
+      CHECK(realtime.fetchWeatherData().isValid);
+      unsigned long realtimeMs = millis() - start;
+      start = millis();
+      CHECK(pool.fetchPoolData().isValid);
+      unsigned long poolMs = millis() - start;
+      printf("  round %d: realtime %4lu ms, pool %4lu ms\n", i + 1, realtimeMs, poolMs);
+      if (i > 0) {
+        slowestReused = realtimeMs > slowestReused ? realtimeMs : slowestReused;
+        slowestReused = poolMs > slowestReused ? poolMs : slowestReused;
+      }
+      delay(gapMs);
+    }
+    return slowestReused;
+  }
+}
+
+int main() {
+  HostClock::setVirtual(true);
+  ExampleServers servers;
+  servers.tomorrow.connectDelayMs = HANDSHAKE_MS;
+  servers.pool.connectDelayMs = HANDSHAKE_MS;
+  TimeManager timeManager;
+  WeatherRealtime realtime("key", "0,0");
+  PoolTemperature pool(&timeManager);
+
+  // Within the idle timeout, each host costs one handshake and every later request reuses it
+  printf("requests 5 s apart:\n");
+  ConnectionPool::setIdleTimeout(30000);
+  unsigned long slowestReused = fetchRounds(realtime, pool, 5, 5000);
+  CHECK(ConnectionPool::getHandshakeCount() == 2);
+  CHECK(ConnectionPool::getReuseCount() == 8);
+  CHECK(slowestReused < HANDSHAKE_MS / 10);
+
+  // Each pooled socket was opened the way its client asked, whatever the host
+  CHECK(servers.tomorrow.connects == 1 && servers.tomorrow.sslConnects == 0);
+  CHECK(servers.pool.connects == 0 && servers.pool.sslConnects == 1);
+
+  // Past the idle timeout every request pays for a new handshake (the first round still
+  // follows the 5 s gap)
+  printf("requests 60 s apart:\n");
+  fetchRounds(realtime, pool, 3, 60000);
+  CHECK(ConnectionPool::getHandshakeCount() == 2 + 4);
+  CHECK(ConnectionPool::getReuseCount() == 8 + 2);
+  CHECK(servers.tomorrow.sslConnects == 0 && servers.pool.connects == 0);
+
+  // A socket opened one way is not handed to a client that wants the other
+  bool reused = true;
+  WiFiSSLClient* plain = ConnectionPool::acquire("api.tomorrow.io", 443, TlsConnect::Default, reused);
+  CHECK(plain != nullptr && !reused);
+  ConnectionPool::release(plain, true);
+  WiFiSSLClient* explicitSsl = ConnectionPool::acquire("api.tomorrow.io", 443, TlsConnect::ConnectSSL, reused);
+  CHECK(explicitSsl != nullptr && explicitSsl != plain && !reused);
+  CHECK(servers.tomorrow.sslConnects == 1);
+  ConnectionPool::release(explicitSsl, false);
+
+  printf("%lu handshakes, %lu reused connections\n", ConnectionPool::getHandshakeCount(),
+    ConnectionPool::getReuseCount());
+  return TestSupport::finish("ConnectionPoolTest");
+}
@@ -0,0 +1,91 @@
+// DirtyRectTest.cpp - DirtyRectRenderer leaves the panel identical to the frame drawn while
+// pushing only changed spans, and how much of the panel the slideshow pushes per transition
+#include <Arduino.h>
+#include "Display.h"
+#include "ExampleData.h"
+
+namespace {
+  const int16_t WIDTH = 200;
+  const int16_t HEIGHT = 120;
+
+  bool samePixels(const FrameBuffer& a, const FrameBuffer& b) {
+    return memcmp(a.getBuffer(), b.getBuffer(), (size_t)a.width() * a.height() * sizeof(uint16_t)) == 0;
+  }
+
+  // A frame of a clear and two elements, like a slide's title and value
+  void drawFrame(DirtyRectRenderer& renderer, uint16_t background, int16_t valueX, uint16_t valueColor) {
+    FrameBuffer& frame = renderer.beginFrame();
+    frame.fillScreen(background);
+    frame.fillRect(10, 10, 80, 12, WHITE);
+    renderer.closeElement();
+    frame.fillRect(valueX, 60, 40, 30, valueColor);
+    renderer.closeElement();
+  }
+
+  // Present into a FrameBuffer standing in for the panel and compare it with the frame
+  void checkPresent(DirtyRectRenderer& renderer, FrameBuffer& panel, FrameBuffer& expected, uint16_t background,
+    int16_t valueX, uint16_t valueColor, unsigned long maxPushed) {
+    drawFrame(renderer, background, valueX, valueColor);
+    renderer.present(panel);
+    expected.fillScreen(background);
+    expected.fillRect(10, 10, 80, 12, WHITE);
+    expected.fillRect(valueX, 60, 40, 30, valueColor);
+    CHECK(samePixels(panel, expected));
+    CHECK(renderer.getPixelsPushed() <= maxPushed);
+  }
+
+  void checkRenderer() {
+    DirtyRectRenderer renderer(WIDTH, HEIGHT);
+    FrameBuffer panel(WIDTH, HEIGHT);
+    FrameBuffer expected(WIDTH, HEIGHT);
+    const unsigned long full = (unsigned long)WIDTH * HEIGHT;
+    const unsigned long value = 40 * 30;
+
+    checkPresent(renderer, panel, expected, BLUE, 20, YELLOW, full);
+    CHECK(renderer.getPixelsPushed() == full);
+    checkPresent(renderer, panel, expected, BLUE, 20, YELLOW, 0);       // Nothing changed
+    checkPresent(renderer, panel, expected, BLUE, 20, RED, value);      // Value recolored in place
+    checkPresent(renderer, panel, expected, BLUE, 100, RED, 2 * value); // Value moved: old and new place
+    checkPresent(renderer, panel, expected, GREEN, 100, RED, full);     // New background
+
+    // Drawn straight to the panel behind the renderer's back: the next frame goes in full
+    panel.fillRect(150, 5, 20, 20, MAGENTA);
+    renderer.invalidate();
+    checkPresent(renderer, panel, expected, GREEN, 100, RED, full);
+  }
+
+  // The slideshow through Display's renderer with the example data
+  void checkSlideshow() {
+    Display::init();
+    Display::enableDirtyRects();
+    Display::updatePoolData(ExampleData::pool());
+    Display::updateForecastData(ExampleData::forecast());
+    RealtimeWeatherData realtime = ExampleData::realtime();
+    Display::displayRealtimeWeather(realtime);
+    const float panel = 800.0f * 480;
+
+    Display::showSlide(0);
+    CHECK(Display::getPixelsPushed() == 800UL * 480);
+    for (int slide = 1; slide <= SLIDE_COUNT; slide++) {
+      Display::showSlide(slide % SLIDE_COUNT);
+      printf("slide %d -> %d: %.1f%% of the panel pushed\n", slide - 1, slide % SLIDE_COUNT,
+        100.0f * Display::getPixelsPushed() / panel);
+    }
+
+    Display::showSlide(0);
+    CHECK(Display::getPixelsPushed() == 0);
+
+    // A new value on the slide being shown only repaints the value
+    realtime.temperature += 0.5f;
+    Display::updateRealtimeData(realtime);
+    Display::showSlide(0);
+    printf("temperature change on slide 0: %.1f%% of the panel pushed\n", 100.0f * Display::getPixelsPushed() / panel);
+    CHECK(Display::getPixelsPushed() > 0 && Display::getPixelsPushed() < panel * 0.05f);
+  }
+}
+
+int main() {
+  checkRenderer();
+  checkSlideshow();
+  return TestSupport::finish("DirtyRectTest");
+}
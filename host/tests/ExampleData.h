@@ -0,0 +1,30 @@
+// ExampleData.h - The captured API responses in examples/ parsed into the sketch's data types
+#pragma once
+#include <Arduino.h>
+#include "WeatherForecast.h"
+#include "PoolTemperature.h"
+#include "TestSupport.h"
+
+namespace ExampleData {
+  inline RealtimeWeatherData realtime() {
+    RealtimeWeatherData data = { 0, 0, 0, 0, 0, 0, 0, false };
+    WeatherRealtime parser("key", "0,0");
+    parser.parseRealtimeJson(String(TestSupport::readSourceFile("examples/realtime.json")), data);
+    return data;
+  }
+
+  // Static storage: a ForecastData is too large to pass around by value comfortably
+  inline const ForecastData& forecast() {
+    static ForecastData data = {};
+    if (!data.isValid) {
+      WeatherForecast parser("key", "0,0");
+      parser.parseForecastJson(String(TestSupport::readSourceFile("examples/forecast.json")), data);
+      data.isValid = data.dayCount > 0;
+    }
+    return data;
+  }
+
+  inline PoolTemperatureData pool() {
+    return { "current", 19.31f, 1731227559UL, "5 minutes ago", true };
+  }
+}
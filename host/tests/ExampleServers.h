@@ -0,0 +1,28 @@
+// ExampleServers.h - tomorrow.io and pool API stand-ins that answer with the captured examples
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+#include "TestSupport.h"
+
+struct ExampleServers {
+  HostEndpoint tomorrow;
+  HostEndpoint pool;
+
+  ExampleServers() {
+    static const std::string forecast = TestSupport::readSourceFile("examples/forecast.json");
+    static const std::string realtime = TestSupport::readSourceFile("examples/realtime.json");
+    tomorrow.respond = [](const std::string& request) {
+      bool isForecast = request.find("/v4/weather/forecast") != std::string::npos;
+      return HostNet::chunkedResponse(isForecast ? forecast : realtime, 4096);
+    };
+    pool.respond = [](const std::string&) {
+      return HostNet::httpResponse("{\"id\":\"current\",\"temperature\":19.31,\"date\":1731227559883}");
+    };
+    HostNet::serve("api.tomorrow.io", 443, &tomorrow);
+    HostNet::serve("api.canwegointhepool.com", 443, &pool);
+  }
+
+  ~ExampleServers() {
+    HostNet::clear();
+  }
+};
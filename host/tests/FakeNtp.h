@@ -0,0 +1,117 @@
+// FakeNtp.h - NTP servers behind the shim's UDP, answering from a true clock the test controls
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+#include <string.h>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+struct FakeNtpServer {
+  int64_t errorUs = 0;        // How far its clock is off
+  int64_t upUs = 15000;       // Path delays, each plus up to jitterUs
+  int64_t downUs = 15000;
+  int64_t jitterUs = 2000;
+  int64_t processingUs = 300; // Between its receive and transmit timestamps
+  int64_t lookupUs = 0;       // The client's name lookup, before the request goes out
+  bool silent = false;
+  bool kissOfDeath = false;   // Answers stratum 0 "RATE"
+  int requests = 0;
+};
+
+// Replies are queued with the true time they arrive at and handed out once the true clock
+// has reached it. Name lookups take the server's lookupUs, passed through `wait`.
+class FakeNtp : public HostUdpNet {
+public:
+  typedef int64_t (*TrueClock)(); // Unix microseconds
+  typedef void (*Wait)(int64_t us);
+
+  std::map<std::string, FakeNtpServer> servers;
+
+private:
+  struct Reply {
+    int64_t arrivesAt;
+    uint8_t packet[48];
+  };
+
+  TrueClock trueUs;
+  Wait wait;
+  std::vector<Reply> replies;
+  std::mt19937 random{7};
+
+  int64_t jitter(int64_t maxUs) {
+    return maxUs > 0 ? (int64_t)(random() % (uint32_t)maxUs) : 0;
+  }
+
+  static void putTimestamp(uint8_t* at, int64_t unixUs) {
+    int64_t seconds = unixUs / 1000000;
+    int64_t fraction = unixUs % 1000000;
+    uint64_t timestamp = ((uint64_t)(uint32_t)(seconds + 2208988800LL) << 32) |
+      (uint32_t)(((uint64_t)fraction << 32) / 1000000);
+    for (int i = 0; i < 8; i++) {
+      at[i] = (uint8_t)(timestamp >> (56 - 8 * i));
+    }
+  }
+
+public:
+  FakeNtp(TrueClock trueUs, Wait wait = nullptr) : trueUs(trueUs), wait(wait) {
+    HostNet::setUdp(this);
+  }
+
+  ~FakeNtp() {
+    HostNet::setUdp(nullptr);
+  }
+
+  void reset() {
+    servers.clear();
+    replies.clear();
+  }
+
+  bool resolve(const char* host) override {
+    int64_t lookupUs = servers[host].lookupUs;
+    if (lookupUs > 0 && wait != nullptr) {
+      wait(lookupUs);
+    }
+    return true;
+  }
+
+  bool send(const char* host, const uint8_t* data, size_t length) override {
+    FakeNtpServer& server = servers[host];
+    server.requests++;
+    if (server.silent || length < 48) {
+      return true;
+    }
+
+    Reply reply;
+    memset(reply.packet, 0, sizeof(reply.packet));
+    int64_t arrival = trueUs() + server.upUs + jitter(server.jitterUs);
+    reply.packet[0] = (0 << 6) | (4 << 3) | 4; // No leap warning, version 4, server
+    reply.packet[1] = server.kissOfDeath ? 0 : 2;
+    reply.packet[2] = 6;
+    reply.packet[3] = 0xEC;
+    reply.packet[7] = 0x20;  // Root delay about 0.5 ms
+    reply.packet[11] = 0x10; // Root dispersion about 0.25 ms
+    if (server.kissOfDeath) {
+      memcpy(reply.packet + 12, "RATE", 4);
+    }
+    memcpy(reply.packet + 24, data + 40, 8); // Origin: the request's transmit timestamp
+    putTimestamp(reply.packet + 16, arrival + server.errorUs);
+    putTimestamp(reply.packet + 32, arrival + server.errorUs);
+    putTimestamp(reply.packet + 40, arrival + server.processingUs + server.errorUs);
+    reply.arrivesAt = arrival + server.processingUs + server.downUs + jitter(server.jitterUs);
+    replies.push_back(reply);
+    return true;
+  }
+
+  int receive(uint8_t* data, size_t length) override {
+    for (size_t i = 0; i < replies.size(); i++) {
+      if (replies[i].arrivesAt <= trueUs() && length >= 48) {
+        memcpy(data, replies[i].packet, 48);
+        replies.erase(replies.begin() + i);
+        return 48;
+      }
+    }
+    return 0;
+  }
+};
@@ -0,0 +1,140 @@
+// FetchLoopTest.cpp - Loop time while fetches run against a slow server, and the tomorrow.io
+// quota held by FetchScheduler's token buckets through failures and retryFailed()
+#include <Arduino.h>
+#include <deque>
+#include "WeatherForecast.h"
+#include "FetchScheduler.h"
+#include "TaskScheduler.h"
+#include "ExampleServers.h"
+
+namespace {
+  TaskScheduler scheduler("Test tasks");
+  HostEndpoint* server = nullptr;
+  WeatherForecast* forecast = nullptr;
+  int fetchTask = TaskScheduler::NO_TASK;
+  bool fetching = false;
+  int fetchesDone = 0;
+  int fetchesValid = 0;
+  unsigned long longestStepMs = 0;       // Fetch task runs that did not open a connection
+  unsigned long longestHandshakeMs = 0;  // The blocking TLS handshake, counted apart
+
+  // Like the sketch's fetch task: a fetch every 30 s, advanced a bounded step per 10 ms tick
+  void runFetchTask() {
+    unsigned long start = millis();
+    unsigned long handshakes = server->connects + server->sslConnects;
+    if (!fetching) {
+      fetching = forecast->beginFetch();
+    }
+    else if (forecast->pollFetch()) {
+      fetching = false;
+      fetchesDone++;
+      fetchesValid += forecast->getData().isValid ? 1 : 0;
+    }
+
+    unsigned long took = millis() - start;
+    unsigned long& longest = server->connects + server->sslConnects != handshakes ? longestHandshakeMs : longestStepMs;
+    longest = took > longest ? took : longest;
+    scheduler.wakeIn(fetchTask, fetching ? 10 : 30000);
+  }
+
+  void runFrame() {
+  }
+
+  // Slide timing and touch share the loop with the fetch; how late can they start?
+  void checkLoopTime() {
+    ExampleServers examples;
+    server = &examples.tomorrow;
+    examples.tomorrow.connectDelayMs = 1500;
+    examples.tomorrow.firstByteDelayMs = 2000;
+    examples.tomorrow.bytesPerStep = 1460;
+    examples.tomorrow.stepMs = 3;
+    examples.tomorrow.readCostMs = 1;
+    ConnectionPool::setIdleTimeout(20000);  // Every other fetch needs a new handshake
+
+    WeatherForecast weather("key", "0,0");
+    forecast = &weather;
+    int frameTask = scheduler.addTask("frame", runFrame, 10);
+    fetchTask = scheduler.addTask("fetch", runFetchTask, 10);
+
+    unsigned long end = millis() + 10 * 60000UL;
+    while ((long)(millis() - end) < 0) {
+      scheduler.runOnce();
+    }
+
+    printf("%d forecast fetches over 10 min at ~490 KB/s: longest fetch step %lu ms, longest handshake %lu ms, "
+      "frame task worst %lu ms late\n", fetchesDone, longestStepMs, longestHandshakeMs,
+      scheduler.getWorstLateMs(frameTask));
+    CHECK(fetchesDone >= 15);
+    CHECK(fetchesValid == fetchesDone);
+    CHECK(longestStepMs <= 5 + 1);
+    CHECK(longestHandshakeMs == 1500);
+    server = nullptr;
+  }
+
+  // Attempt times for one provider, to count them in sliding windows
+  struct WindowCounter {
+    std::deque<unsigned long> hour;
+    std::deque<unsigned long> day;
+    size_t worstHour = 0;
+    size_t worstDay = 0;
+
+    void record(unsigned long now) {
+      hour.push_back(now);
+      day.push_back(now);
+      while (now - hour.front() >= 3600000UL) {
+        hour.pop_front();
+      }
+      while (now - day.front() >= 86400000UL) {
+        day.pop_front();
+      }
+      worstHour = hour.size() > worstHour ? hour.size() : worstHour;
+      worstDay = day.size() > worstDay ? day.size() : worstDay;
+    }
+  };
+
+  // A month of one-second ticks with a flaky network: a third of requests fail, and the
+  // link "comes back" at random, calling retryFailed() as onWiFiEvent(LinkUp) does
+  void checkQuota(bool unified) {
+    FetchScheduler fetches;
+    if (unified) {
+      fetches.setEnabled(FetchSource::Realtime, false);
+      fetches.setIntervals(FetchSource::Forecast, 15 * 60000UL, 30 * 60000UL);
+    }
+
+    WindowCounter tomorrow;
+    WindowCounter pool;
+    unsigned long retries = 0;
+    for (unsigned long now = 1000; now < 30 * 86400000UL; now += 1000) {
+      if (random(600) == 0) {
+        fetches.retryFailed();
+        retries++;
+      }
+
+      FetchSource fetch = fetches.nextFetch(now);
+      if (fetch == FetchSource::None) {
+        continue;
+      }
+      fetches.recordAttempt(fetch, now);
+      (fetch == FetchSource::Pool ? pool : tomorrow).record(now);
+      fetches.recordResult(fetch, random(3) != 0, now);
+    }
+
+    printf("%s: %lu tomorrow.io requests in 30 days, at most %zu in any hour and %zu in any day; "
+      "pool at most %zu/%zu; %lu retryFailed() calls\n", unified ? "unified" : "separate",
+      fetches.getRequestCount(FetchScheduler::TOMORROW_IO), tomorrow.worstHour, tomorrow.worstDay,
+      pool.worstHour, pool.worstDay, retries);
+    CHECK(tomorrow.worstHour <= 25);
+    CHECK(tomorrow.worstDay <= 500);
+    CHECK(pool.worstHour <= 30);
+    CHECK(pool.worstDay <= 720);
+  }
+}
+
+int main() {
+  HostClock::setVirtual(true);
+  randomSeed(4);
+  checkLoopTime();
+  checkQuota(false);
+  checkQuota(true);
+  return TestSupport::finish("FetchLoopTest");
+}
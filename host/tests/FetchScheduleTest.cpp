@@ -0,0 +1,98 @@
+// FetchScheduleTest.cpp - A week of FetchScheduler decisions on a virtual clock: requests per
+// provider against the hourly and daily quotas, and how old the shown data gets
+#include <Arduino.h>
+#include <algorithm>
+#include <vector>
+#include "FetchScheduler.h"
+#include "TestSupport.h"
+
+namespace {
+  const unsigned long HOUR_MS = 3600000UL;
+  const unsigned long DAY_MS = 24 * HOUR_MS;
+  const char* SOURCE_NAMES[] = { "realtime", "forecast", "pool" };
+
+  struct ProviderLimits {
+    const char* name;
+    unsigned long perHour;
+    unsigned long perDay;
+  };
+
+  const ProviderLimits LIMITS[FetchScheduler::PROVIDER_COUNT] = {
+    { "tomorrow.io", 25, 500 },
+    { "pool API", 30, 720 },
+  };
+
+  unsigned long percentile(std::vector<unsigned long> values, int percent) {
+    std::sort(values.begin(), values.end());
+    return values[(values.size() - 1) * percent / 100];
+  }
+
+  // A request every one-second tick the scheduler allows; one in ten fails. Requests are
+  // counted per calendar hour and day, and each source's data age sampled once a minute.
+  void simulateWeek(bool unified) {
+    FetchScheduler fetches;
+    if (unified) {
+      fetches.setEnabled(FetchSource::Realtime, false);
+      fetches.setIntervals(FetchSource::Forecast, 15 * 60000UL, 30 * 60000UL);
+    }
+
+    std::vector<unsigned long> hourly[FetchScheduler::PROVIDER_COUNT];
+    std::vector<unsigned long> daily[FetchScheduler::PROVIDER_COUNT];
+    std::vector<unsigned long> ages[3];
+    for (int p = 0; p < FetchScheduler::PROVIDER_COUNT; p++) {
+      hourly[p].assign(7 * 24, 0);
+      daily[p].assign(7, 0);
+    }
+
+    const unsigned long start = 10000;
+    for (unsigned long now = start; now < start + 7 * DAY_MS; now += 1000) {
+      FetchSource fetch = fetches.nextFetch(now);
+      if (fetch != FetchSource::None) {
+        int provider = fetch == FetchSource::Pool ? FetchScheduler::POOL_API : FetchScheduler::TOMORROW_IO;
+        fetches.recordAttempt(fetch, now);
+        hourly[provider][(now - start) / HOUR_MS]++;
+        daily[provider][(now - start) / DAY_MS]++;
+        fetches.recordResult(fetch, random(10) != 0, now);
+      }
+
+      if ((now - start) % 60000 == 0 && now - start >= HOUR_MS) {
+        for (int s = 0; s < 3; s++) {
+          ages[s].push_back(fetches.dataAge((FetchSource)s, now) / 1000);
+        }
+      }
+    }
+
+    printf("%s fetches:\n", unified ? "unified" : "separate");
+    for (int p = 0; p < FetchScheduler::PROVIDER_COUNT; p++) {
+      unsigned long busiestHour = *std::max_element(hourly[p].begin(), hourly[p].end());
+      unsigned long busiestDay = *std::max_element(daily[p].begin(), daily[p].end());
+      printf("  %-11s %5lu requests, busiest hour %2lu/%lu, busiest day %3lu/%lu\n", LIMITS[p].name,
+        fetches.getRequestCount((FetchScheduler::Provider)p), busiestHour, LIMITS[p].perHour, busiestDay,
+        LIMITS[p].perDay);
+      CHECK(busiestHour <= LIMITS[p].perHour);
+      CHECK(busiestDay <= LIMITS[p].perDay);
+    }
+
+    for (int s = 0; s < 3; s++) {
+      if (unified && s == (int)FetchSource::Realtime) {
+        continue;
+      }
+      printf("  %-11s data age p50 %4lu s, p95 %4lu s, max %4lu s\n", SOURCE_NAMES[s], percentile(ages[s], 50),
+        percentile(ages[s], 95), percentile(ages[s], 100));
+    }
+
+    // Each source stays within its target interval nearly all the time
+    if (!unified) {
+      CHECK(percentile(ages[(int)FetchSource::Realtime], 95) <= 10 * 60);
+    }
+    CHECK(percentile(ages[(int)FetchSource::Forecast], 95) <= (unified ? 30 : 60) * 60);
+    CHECK(percentile(ages[(int)FetchSource::Pool], 95) <= 8 * 60);
+  }
+}
+
+int main() {
+  randomSeed(6);
+  simulateWeek(false);
+  simulateWeek(true);
+  return TestSupport::finish("FetchScheduleTest");
+}
@@ -0,0 +1,87 @@
+// ForecastInterpolationTest.cpp - "Now" derived from examples/forecast.json the way unified fetch
+// mode does it: minutely entries, the hourly fallback, wind along the shorter arc
+#include <Arduino.h>
+#include <math.h>
+#include "WeatherForecast.h"
+#include "TestSupport.h"
+
+namespace {
+  bool near(float a, float b) {
+    return fabs(a - b) < 0.001f;
+  }
+
+  // Two hand-made entries a minute apart, to see each field blend on its own
+  void checkBlend() {
+    static ForecastData forecast = {};
+    forecast.minuteCount = 2;
+    forecast.minutely[0] = { 1000, 10.0f, 1.0f, 80.0f, 2.0f, 350.0f, 40.0f, 1000 };
+    forecast.minutely[1] = { 1060, 12.0f, 3.0f, 60.0f, 4.0f, 10.0f, 60.0f, 1100 };
+
+    RealtimeWeatherData now = {};
+    CHECK(WeatherForecast::interpolateRealtime(forecast, 1015, now));
+    CHECK(now.isValid);
+    CHECK(near(now.temperature, 10.5f));
+    CHECK(near(now.uvIndex, 1.5f));
+    CHECK(near(now.humidity, 75.0f));
+    CHECK(near(now.windSpeed, 2.5f));
+    CHECK(near(now.windDirection, 355.0f));  // 350 -> 10 passes through north
+    CHECK(near(now.cloudCover, 45.0f));
+    CHECK(now.weatherCode == 1000);           // Codes switch at the midpoint
+    CHECK(WeatherForecast::interpolateRealtime(forecast, 1045, now));
+    CHECK(near(now.windDirection, 5.0f));
+    CHECK(now.weatherCode == 1100);
+
+    // Before the first entry the first one stands; past the last there is nothing to show
+    CHECK(WeatherForecast::interpolateRealtime(forecast, 900, now));
+    CHECK(near(now.temperature, 10.0f));
+    CHECK(!WeatherForecast::interpolateRealtime(forecast, 1061, now));
+  }
+
+  // The captured forecast: exact on its entries, between them on the line joining them
+  void checkExample() {
+    static ForecastData forecast = {};
+    WeatherForecast parser("key", "0,0");
+    CHECK(parser.parseForecastJson(String(TestSupport::readSourceFile("examples/forecast.json")), forecast));
+    CHECK(forecast.minuteCount == 60 && forecast.hourCount == 24);
+
+    RealtimeWeatherData now = {};
+    const TimelineEntry& first = forecast.minutely[0];
+    CHECK(WeatherForecast::interpolateRealtime(forecast, first.time, now));
+    CHECK(near(now.temperature, first.temperature) && near(now.humidity, first.humidity));
+
+    const TimelineEntry& a = forecast.minutely[20];
+    const TimelineEntry& b = forecast.minutely[21];
+    CHECK(WeatherForecast::interpolateRealtime(forecast, a.time + (b.time - a.time) / 2, now));
+    CHECK(near(now.temperature, (a.temperature + b.temperature) / 2));
+
+    // An hour and a half in, the minutely timeline has run out and the hourly one takes over
+    unsigned long later = first.time + 90 * 60;
+    CHECK(later > forecast.minutely[forecast.minuteCount - 1].time);
+    int next = 0;
+    while (forecast.hourly[next].time < later) {
+      next++;
+    }
+    const TimelineEntry& before = forecast.hourly[next - 1];
+    const TimelineEntry& after = forecast.hourly[next];
+    float t = (float)(later - before.time) / (after.time - before.time);
+    CHECK(WeatherForecast::interpolateRealtime(forecast, later, now));
+    CHECK(near(now.temperature, before.temperature + (after.temperature - before.temperature) * t));
+
+    CHECK(!WeatherForecast::interpolateRealtime(forecast, forecast.hourly[forecast.hourCount - 1].time + 1, now));
+
+    // Against the realtime call captured at the same time
+    RealtimeWeatherData realtime = {};
+    WeatherRealtime realtimeParser("key", "0,0");
+    CHECK(realtimeParser.parseRealtimeJson(String(TestSupport::readSourceFile("examples/realtime.json")), realtime));
+    CHECK(WeatherForecast::interpolateRealtime(forecast, TimeManager::parseIso8601("2025-11-08T01:13:00Z"), now));
+    printf("derived vs realtime at 01:13Z: %.1f/%.1f C, %.0f/%.0f %% humidity, %.1f/%.1f m/s, %.0f/%.0f deg\n",
+      now.temperature, realtime.temperature, now.humidity, realtime.humidity, now.windSpeed, realtime.windSpeed,
+      now.windDirection, realtime.windDirection);
+  }
+}
+
+int main() {
+  checkBlend();
+  checkExample();
+  return TestSupport::finish("ForecastInterpolationTest");
+}
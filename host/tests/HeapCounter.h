@@ -0,0 +1,93 @@
+// HeapCounter.h - Replaces global new/delete to count allocations and track peak heap use.
+// Include it in exactly one source file of an executable. Allocations made by the
+// stand-in servers (HostNet::inServer()) are left out.
+#pragma once
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+#include "HostNet.h"
+
+namespace HeapCounter {
+  struct Counters {
+    std::atomic<unsigned long> allocations;
+    std::atomic<size_t> live;
+    std::atomic<size_t> peak;
+  };
+
+  inline Counters& counters() {
+    static Counters instance;
+    return instance;
+  }
+
+  // Start a measurement: zero the allocation count and peak from the current live bytes
+  inline void reset() {
+    counters().allocations = 0;
+    counters().peak = counters().live.load();
+  }
+
+  inline unsigned long allocations() {
+    return counters().allocations;
+  }
+
+  // Most bytes live at once since reset(), above what was live at reset()
+  inline size_t peakSince(size_t baseline) {
+    size_t peak = counters().peak;
+    return peak > baseline ? peak - baseline : 0;
+  }
+
+  inline size_t live() {
+    return counters().live;
+  }
+
+  // Each block carries its counted size in front of it so delete can account for it
+  inline void* allocate(size_t size) {
+    size_t* block = (size_t*)malloc(size + sizeof(max_align_t));
+    if (block == nullptr) {
+      throw std::bad_alloc();
+    }
+    *block = HostNet::inServer() ? 0 : size;
+    if (*block == 0) {
+      return (char*)block + sizeof(max_align_t);
+    }
+    Counters& c = counters();
+    c.allocations++;
+    size_t now = c.live += size;
+    size_t peak = c.peak;
+    while (now > peak && !c.peak.compare_exchange_weak(peak, now)) {
+    }
+    return (char*)block + sizeof(max_align_t);
+  }
+
+  inline void release(void* pointer) {
+    if (pointer == nullptr) {
+      return;
+    }
+    size_t* block = (size_t*)((char*)pointer - sizeof(max_align_t));
+    counters().live -= *block;
+    free(block);
+  }
+}
+
+void* operator new(size_t size) {
+  return HeapCounter::allocate(size);
+}
+
+void* operator new[](size_t size) {
+  return HeapCounter::allocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+  HeapCounter::release(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+  HeapCounter::release(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+  HeapCounter::release(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+  HeapCounter::release(pointer);
+}
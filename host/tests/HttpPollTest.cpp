@@ -0,0 +1,127 @@
+// HttpPollTest.cpp - SimpleHttpClient::poll() against slow stand-in servers on the virtual clock:
+// each poll hands back within its 5 ms read budget, and the 30 s first-byte and 10 s idle
+// timeouts fire on time
+#include <Arduino.h>
+#include "HttpClient.h"
+#include "TestSupport.h"
+
+namespace {
+  class CountingSink : public BodySink {
+  public:
+    size_t bytes = 0;
+
+    bool write(const char*, size_t length) override {
+      bytes += length;
+      return true;
+    }
+
+    bool finish() override {
+      return true;
+    }
+  };
+
+  struct PollRun {
+    HttpResponse response;
+    size_t bodyBytes;
+    unsigned long polls;
+    unsigned long longestPollMs;  // Receiving polls only; connecting blocks for the handshake
+  };
+
+  // Drive one request to the end the way the fetch task does, a poll per 1 ms tick
+  PollRun run(HostEndpoint& server) {
+    HostNet::serve("slow.test", 443, &server);
+    SimpleHttpClient client;
+    CountingSink sink;
+    PollRun result = {};
+    client.begin("slow.test", "/", sink);
+    while (client.isBusy()) {
+      bool receiving = client.getState() == HttpRequestState::Receiving;
+      unsigned long start = millis();
+      client.poll();
+      unsigned long took = millis() - start;
+      if (receiving) {
+        result.polls++;
+        result.longestPollMs = took > result.longestPollMs ? took : result.longestPollMs;
+      }
+      delay(1);
+    }
+    result.response = client.getResponse();
+    result.bodyBytes = sink.bytes;
+    client.cancel();
+    HostNet::clear();
+    return result;
+  }
+}
+
+int main() {
+  HostClock::setVirtual(true);
+  const std::string body = TestSupport::readSourceFile("examples/forecast.json");
+  const std::string wire = HostNet::chunkedResponse(body, 4096);
+
+  // Everything is ready at once, but every socket read costs 2 ms: a poll stops reading once
+  // its 5 ms budget is spent, so it can overrun by at most the read in progress
+  {
+    HostEndpoint server;
+    server.respond = [&wire](const std::string&) {
+      return wire;
+    };
+    server.connectDelayMs = 800;
+    server.readCostMs = 2;
+    PollRun result = run(server);
+    printf("read budget: %lu polls, longest %lu ms, %lu ms total\n", result.polls, result.longestPollMs,
+      result.response.elapsedMs);
+    CHECK(result.response.isSuccess);
+    CHECK(result.bodyBytes == body.size());
+    CHECK(result.longestPollMs <= 5 + 2);
+    CHECK(result.polls > 100);
+  }
+
+  // A server that trickles with 9 s gaps stays inside the idle timeout
+  {
+    HostEndpoint server;
+    server.respond = [&wire](const std::string&) {
+      return wire;
+    };
+    server.bytesPerStep = 50000;
+    server.stepMs = 9000;
+    PollRun result = run(server);
+    printf("9 s gaps: %s after %lu ms\n", result.response.isSuccess ? "complete" : "failed", result.response.elapsedMs);
+    CHECK(result.response.isSuccess);
+    CHECK(result.bodyBytes == body.size());
+  }
+
+  // No first byte: the request fails 30 s after it was sent, not sooner
+  {
+    HostEndpoint server;
+    server.respond = [&wire](const std::string&) {
+      return wire;
+    };
+    server.firstByteDelayMs = 120000;
+    PollRun result = run(server);
+    printf("silent server: \"%s\" after %lu ms\n", result.response.error.c_str(), result.response.elapsedMs);
+    CHECK(!result.response.isSuccess);
+    CHECK(result.response.error.startsWith("Request timeout"));
+    CHECK(result.response.elapsedMs > 30000 && result.response.elapsedMs <= 30010);
+    CHECK(result.bodyBytes == 0);
+  }
+
+  // The body starts, then the server goes quiet: the request fails 10 s after the last byte
+  {
+    HostEndpoint server;
+    server.respond = [&wire](const std::string&) {
+      return wire;
+    };
+    server.firstByteDelayMs = 1000;
+    server.bytesPerStep = 20000;
+    server.stepMs = 600000;
+    PollRun result = run(server);
+    printf("stalled body: \"%s\" after %lu ms, %zu body bytes\n", result.response.error.c_str(),
+      result.response.elapsedMs, result.bodyBytes);
+    CHECK(!result.response.isSuccess);
+    CHECK(result.response.error.startsWith("Response stalled"));
+    CHECK(result.response.elapsedMs > 11000 && result.response.elapsedMs <= 11010);
+    CHECK(result.bodyBytes > 0 && result.bodyBytes < body.size());
+  }
+
+  return TestSupport::finish("HttpPollTest");
+}
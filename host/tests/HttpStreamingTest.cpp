@@ -0,0 +1,86 @@
+// HttpStreamingTest.cpp - SimpleHttpClient bodies reach the sink in one copy and without heap
+// allocations, for chunked, Content-Length and close-delimited responses from a slow server
+#include <Arduino.h>
+#include "HttpClient.h"
+#include "TestSupport.h"
+#include "HeapCounter.h"
+
+namespace {
+  // Collects the body into storage reserved up front, so the sink itself never allocates
+  class CollectingSink : public BodySink {
+  public:
+    std::string body;
+    unsigned long writes = 0;
+    size_t largestWrite = 0;
+
+    explicit CollectingSink(size_t capacity) {
+      body.reserve(capacity);
+    }
+
+    bool write(const char* data, size_t length) override {
+      body.append(data, length);
+      writes++;
+      largestWrite = length > largestWrite ? length : largestWrite;
+      return true;
+    }
+
+    bool finish() override {
+      return true;
+    }
+  };
+
+  void fetch(const char* name, const std::string& body, const std::string& wire, bool closeAfterResponse) {
+    HostEndpoint server;
+    server.respond = [&wire](const std::string&) {
+      return wire;
+    };
+    server.bytesPerStep = 1400;  // About one TCP segment per millisecond
+    server.stepMs = 1;
+    server.closeAfterResponse = closeAfterResponse;
+    HostNet::serve("stream.test", 443, &server);
+
+    SimpleHttpClient client;
+    CollectingSink sink(body.size());
+    CHECK(client.begin("stream.test", "/body", sink));
+
+    // Only the polls that move body bytes count; the last one logs the result
+    unsigned long receivePolls = 0;
+    unsigned long receiveAllocations = 0;
+    while (client.isBusy()) {
+      bool receiving = client.getState() == HttpRequestState::Receiving;
+      HeapCounter::reset();
+      HttpRequestState state = client.poll();
+      if (receiving && state == HttpRequestState::Receiving) {
+        receivePolls++;
+        receiveAllocations += HeapCounter::allocations();
+      }
+      delay(1);
+    }
+
+    const HttpResponse& response = client.getResponse();
+    printf("%-16s %7zu wire bytes read once, %4lu sink writes of <= %zu B, %lu allocations in %lu receive polls\n",
+      name, wire.size(), sink.writes, sink.largestWrite, receiveAllocations, receivePolls);
+    CHECK(response.isSuccess);
+    CHECK(response.bodyLength == body.size());
+    CHECK(sink.body == body);
+    CHECK(server.bytesRead == wire.size());
+    CHECK(sink.largestWrite <= 512);
+    CHECK(receivePolls > 10);
+    CHECK(receiveAllocations == 0);
+
+    client.cancel();
+    HostNet::clear();
+  }
+}
+
+int main() {
+  HostClock::setVirtual(true);
+  const std::string body = TestSupport::readSourceFile("examples/forecast.json");
+  CHECK(body.size() > 100000);
+
+  fetch("chunked", body, HostNet::chunkedResponse(body, 4096), false);
+  fetch("content-length", body, HostNet::httpResponse(body), false);
+  fetch("until close", body, HostNet::closeDelimitedResponse(body), true);
+
+  return TestSupport::finish("HttpStreamingTest");
+}
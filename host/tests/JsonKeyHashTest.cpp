@@ -0,0 +1,108 @@
+// JsonKeyHashTest.cpp - Key matching by hash: the parser's streamed hashes agree with the
+// compile-time ones, split anywhere, no two keys the handlers meet share a hash, and the pool
+// fields go through their table
+#include <Arduino.h>
+#include <regex>
+#include <set>
+#include <vector>
+#include "WeatherForecast.h"
+#include "PoolTemperature.h"
+#include "TestSupport.h"
+
+// Hashed by the compiler, or these would not build
+static_assert(jsonKeyHash("") == 2166136261UL, "FNV-1a offset basis");
+static_assert(jsonKeyHash("a") == 0xe40c292cUL, "FNV-1a of \"a\"");
+static_assert(DAILY_FIELDS[0].keyHash == jsonKeyHash("cloudCoverAvg"), "field tables are hashed at compile time");
+
+namespace {
+  // Records the key hash of each level of the path at every value
+  class PathRecorder : public JsonStreamHandler {
+  public:
+    std::vector<std::vector<uint32_t>> paths;
+
+    void onValue(const JsonStreamParser& parser, const char* /* value */, JsonValueType /* type */) override {
+      std::vector<uint32_t> path;
+      for (int level = 0; level < parser.getDepth(); level++) {
+        path.push_back(parser.keyHashAt(level));
+      }
+      paths.push_back(path);
+    }
+  };
+
+  void checkStreamedHashes() {
+    const std::string document = "{\"timelines\":{\"minutely\":[{\"time\":\"2025-11-08T01:13:00Z\","
+      "\"values\":{\"temperature\":10.7,\"weatherCode\":1001}}]},\"a\\\"b\":1}";
+    const std::vector<std::vector<uint32_t>> expected = {
+      { jsonKeyHash("timelines"), jsonKeyHash("minutely"), 0, jsonKeyHash("time") },
+      { jsonKeyHash("timelines"), jsonKeyHash("minutely"), 0, jsonKeyHash("values"), jsonKeyHash("temperature") },
+      { jsonKeyHash("timelines"), jsonKeyHash("minutely"), 0, jsonKeyHash("values"), jsonKeyHash("weatherCode") },
+      { jsonKeyHash("a\"b") },
+    };
+
+    // Every split point: a key cut across two socket reads hashes the same
+    for (size_t split = 0; split <= document.size(); split++) {
+      PathRecorder recorder;
+      JsonStreamParser parser(&recorder);
+      parser.feed(document.data(), split);
+      parser.feed(document.data() + split, document.size() - split);
+      CHECK(parser.finish());
+      CHECK(recorder.paths == expected);
+    }
+  }
+
+  // Every distinct key in the captured responses, plus every name the handlers look for
+  void checkNoCollisions() {
+    std::set<std::string> keys;
+    std::regex keyPattern("\"([A-Za-z0-9_]+)\"\\s*:");
+    const char* files[] = { "examples/forecast.json", "examples/realtime.json" };
+    for (const char* file : files) {
+      std::string text = TestSupport::readSourceFile(file);
+      for (std::sregex_iterator it(text.begin(), text.end(), keyPattern), end; it != end; ++it) {
+        keys.insert((*it)[1]);
+      }
+    }
+    for (const FieldBinding<DailyForecastData>& field : DAILY_FIELDS) {
+      keys.insert(field.name);
+    }
+    for (const FieldBinding<TimelineEntry>& field : TIMELINE_FIELDS) {
+      keys.insert(field.name);
+    }
+    for (const FieldBinding<RealtimeWeatherData>& field : REALTIME_FIELDS) {
+      keys.insert(field.name);
+    }
+    for (const FieldBinding<PoolTemperatureData>& field : POOL_FIELDS) {
+      keys.insert(field.name);
+    }
+
+    std::set<uint32_t> hashes;
+    for (const std::string& key : keys) {
+      hashes.insert(jsonKeyHash(key.c_str()));
+    }
+    printf("%zu distinct keys, %zu distinct hashes; JsonStreamParser is %zu bytes\n", keys.size(), hashes.size(),
+      sizeof(JsonStreamParser));
+    CHECK(keys.size() > 50);
+    CHECK(hashes.size() == keys.size());
+  }
+
+  // The pool handler reads its table like the tomorrow.io ones, and needs every field
+  void checkPoolFields() {
+    static PoolTemperature pool(nullptr);
+    PoolTemperatureData data = { "", 0.0f, 0, "", false };
+    CHECK(pool.parsePoolJson("{\"id\":\"current\",\"nested\":{\"date\":1},\"temperature\":19.31,"
+      "\"date\":1731227559883}", data));
+    CHECK(data.id == String("current") && data.temperature == 19.31f && data.timestamp == 1731227559UL);
+    CHECK(pool.parsePoolJson("{\"id\":\"current\",\"temperature\":19.31,\"date\":1731227559}", data));
+    CHECK(data.timestamp == 1731227559UL);
+    CHECK(!pool.parsePoolJson("{\"id\":\"current\",\"temperature\":19.31,\"nested\":{\"date\":1}}", data));
+  }
+}
+
+int main() {
+  checkStreamedHashes();
+  checkNoCollisions();
+  checkPoolFields();
+
+  // Frames hold a hash instead of key text
+  CHECK(sizeof(JsonStreamParser) <= 208);
+  return TestSupport::finish("JsonKeyHashTest");
+}
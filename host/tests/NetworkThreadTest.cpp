@@ -0,0 +1,76 @@
+// NetworkThreadTest.cpp - The online sketch in real time with its network thread, the pool
+// API's TLS handshake stalled for 8 s: slides keep their 7 s cadence and touch stays responsive
+#include <Arduino.h>
+#include <atomic>
+#include <unistd.h>
+#include "today.ino.cpp"
+#include "ExampleServers.h"
+#include "ExampleData.h"
+#include "TestSupport.h"
+
+int main() {
+  const unsigned long stallMs = 8000;
+  const unsigned long runMs = 20000;
+
+  // Warm-start slides run from boot, so the stall lands in the middle of the slideshow
+  remove("today_cache.bin");
+  WarmStartCache::save(ExampleData::realtime(), ExampleData::pool(), ExampleData::forecast());
+
+  static ExampleServers servers;
+  static std::atomic<unsigned long> firstResponseAt(0);
+  auto respond = servers.pool.respond;
+  servers.pool.respond = [respond](const std::string& request) {
+    unsigned long expected = 0;
+    firstResponseAt.compare_exchange_strong(expected, millis());
+    return respond(request);
+  };
+  servers.pool.connectDelayMs = stallMs;
+
+  setup();
+
+  unsigned long due = 0;
+  bool running = Display::getNextSlideTime(due);
+  std::vector<unsigned long> changes;
+  unsigned long shortest = 0xFFFFFFFFUL;
+  unsigned long longest = 0;
+  long latest = 0;
+  while (millis() < runMs) {
+    unsigned long ranAt = millis();
+    loop();
+
+    unsigned long next = 0;
+    if (!Display::getNextSlideTime(next)) {
+      continue;
+    }
+    if (running && next != due) {
+      unsigned long interval = next - due;
+      shortest = interval < shortest ? interval : shortest;
+      longest = interval > longest ? interval : longest;
+      long late = (long)(ranAt - due);
+      latest = late > latest ? late : latest;
+      changes.push_back(ranAt);
+    }
+    running = true;
+    due = next;
+  }
+
+  unsigned long stallEnd = firstResponseAt;
+  bool changedDuringStall = false;
+  for (unsigned long change : changes) {
+    changedDuringStall = changedDuringStall || (change + stallMs >= stallEnd && change <= stallEnd);
+  }
+  printf("%zu slide changes, %lu-%lu ms apart, at most %ld ms late; first response at %lu ms after an %lu ms "
+    "handshake; touch at most %lu ms late\n", changes.size(), shortest, longest, latest, stallEnd, stallMs,
+    scheduler.getWorstLateMs(touchTask));
+  CHECK(stallEnd > stallMs);
+  CHECK(changedDuringStall);
+  CHECK(changes.size() >= 2);
+  CHECK(shortest == 7000 && longest == 7000);
+  CHECK(latest <= 50);
+  CHECK(scheduler.getWorstLateMs(touchTask) <= 50);
+
+  // The network thread is still running; leave without tearing down what it uses
+  int result = TestSupport::finish("NetworkThreadTest");
+  fflush(stdout);
+  _exit(result);
+}
@@ -0,0 +1,63 @@
+// NtpOutageTest.cpp - The sketch's ntp task keeps the clock counting through a two-hour WiFi
+// outage, longer than a micros() wrap, on the virtual clock
+#include <Arduino.h>
+#include "today.ino.cpp"
+#include "FakeNtp.h"
+#include "TestSupport.h"
+
+namespace {
+  const int64_t START_US = 1760000000LL * 1000000;
+  int64_t trueUs = START_US;
+
+  int64_t trueClock() {
+    return trueUs;
+  }
+
+  void advance(unsigned long ms) {
+    HostClock::advance(ms);
+    trueUs += (int64_t)ms * 1000;
+  }
+}
+
+int main() {
+  HostClock::setVirtual(true);
+  static FakeNtp ntp(trueClock);
+  for (const char* host : { "0.au.pool.ntp.org", "1.au.pool.ntp.org", "2.au.pool.ntp.org" }) {
+    ntp.servers[host].jitterUs = 0;
+  }
+
+  timeManager = new TimeManager();
+  timeManager->begin();
+  while (!wifi.isConnected()) {
+    wifi.poll();
+    advance(10);
+  }
+  while (!TimeManager::isTimeSynced()) {
+    runNtpTask();
+    advance(10);
+  }
+
+  // The AP goes away and stays away for two hours
+  WiFi.simulate = true;
+  WiFi.apUp = false;
+  WiFi.dropLink();
+  while (wifi.isConnected()) {
+    wifi.poll();
+    advance(10);
+  }
+  uint64_t before = TimeManager::getCurrentUnixTimeMs();
+  int64_t trueBefore = trueUs;
+  while (trueUs - trueBefore < 2 * 3600000000LL) {
+    runNtpTask();
+    advance(ntpIdleMs);
+  }
+
+  // Without the ntp task reading it, the clock would be a whole wrap, 4295 s, behind
+  int64_t elapsedMs = (int64_t)(TimeManager::getCurrentUnixTimeMs() - before);
+  int64_t errorMs = (int64_t)TimeManager::getCurrentUnixTimeMs() - trueUs / 1000;
+  printf("clock advanced %lld ms over a %lld ms outage, %lld ms from true time\n", (long long)elapsedMs,
+    (long long)((trueUs - trueBefore) / 1000), (long long)errorMs);
+  CHECK(elapsedMs > 7200000 - 50 && elapsedMs < 7200000 + 50);
+  CHECK(errorMs > -50 && errorMs < 50);
+  return TestSupport::finish("NtpOutageTest");
+}
@@ -0,0 +1,61 @@
+// PortableHeadersTest.cpp - BodySink.h, JsonStreamParser.h and HttpResponseReader.h on their own:
+// built as C++11 with -Wall -Wextra -Werror and no Arduino include path
+#include "BodySink.h"
+#include "JsonStreamParser.h"
+#include "HttpResponseReader.h"
+#include "TestSupport.h"
+
+namespace {
+  class TemperatureHandler : public JsonStreamHandler {
+  public:
+    float temperature = 0;
+    int values = 0;
+
+    void onValue(const JsonStreamParser& parser, const char* value, JsonValueType type) override {
+      values++;
+      if (type == JsonValueType::Number && parser.currentKeyHash() == jsonKeyHash("temperature")) {
+        temperature = JsonStreamParser::toFloat(value);
+      }
+    }
+  };
+
+  // Feed a response a few bytes at a time, the way it arrives off a socket
+  void feed(HttpResponseReader& reader, const std::string& response, size_t step) {
+    for (size_t offset = 0; offset < response.size() && !reader.isComplete(); offset += step) {
+      size_t length = response.size() - offset < step ? response.size() - offset : step;
+      reader.write(response.data() + offset, length);
+    }
+  }
+}
+
+int main() {
+  const std::string body = "{\"id\":\"current\",\"temperature\":19.31,\"date\":1731227559883}";
+  const std::string sized = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+  char tailSize[8];
+  snprintf(tailSize, sizeof(tailSize), "%zx", body.size() - 16);
+  const std::string chunked = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n10\r\n" + body.substr(0, 16) +
+    "\r\n" + tailSize + "\r\n" + body.substr(16) + "\r\n0\r\n\r\n";
+
+  for (size_t step = 1; step <= 64; step *= 4) {
+    TemperatureHandler handler;
+    JsonStreamParser parser(&handler);
+    HttpResponseReader reader(&parser);
+    feed(reader, sized, step);
+    CHECK(reader.isComplete());
+    CHECK(reader.finish());
+    CHECK(reader.getStatusCode() == 200);
+    CHECK(handler.values == 3);
+    CHECK(handler.temperature > 19.30f && handler.temperature < 19.32f);
+  }
+
+  TemperatureHandler handler;
+  JsonStreamParser parser(&handler);
+  HttpResponseReader reader(&parser);
+  feed(reader, chunked, 7);
+  CHECK(reader.isChunked());
+  CHECK(reader.finish());
+  CHECK(reader.getBodyBytes() == body.size());
+  CHECK(handler.temperature > 19.30f && handler.temperature < 19.32f);
+
+  return TestSupport::finish("PortableHeadersTest");
+}
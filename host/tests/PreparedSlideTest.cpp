@@ -0,0 +1,71 @@
+// PreparedSlideTest.cpp - A slide drawn ahead by prepareNextSlide() reaches the panel exactly as
+// one drawn on demand, and a prepared slide is drawn again once the data it shows changes
+#include <Arduino.h>
+#include "Display.h"
+#include "ExampleData.h"
+
+namespace {
+  // Whether the panel shows what rendering the slide off-screen gives now
+  bool panelShows(int slide) {
+    static FrameBuffer expected(800, 480);
+    Display::renderSlide(expected, slide);
+    GigaDisplay_GFX& panel = *GigaDisplay_GFX::last();
+    for (int16_t y = 0; y < expected.height(); y++) {
+      for (int16_t x = 0; x < expected.width(); x++) {
+        if (panel.getPixel(x, y) != expected.getPixel(x, y)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  // Run the slideshow task up to and through the next slide change
+  void nextTransition() {
+    unsigned long due = millis();
+    CHECK(Display::getNextSlideTime(due));
+    HostClock::advance(due - millis());
+    Display::updateSlideShow();
+  }
+}
+
+int main() {
+  HostClock::setVirtual(true);
+  Display::init();
+  Display::enableDirtyRects();
+  Display::updatePoolData(ExampleData::pool());
+  Display::updateForecastData(ExampleData::forecast());
+  RealtimeWeatherData realtime = ExampleData::realtime();
+  Display::displayRealtimeWeather(realtime);
+
+  // Two rounds of the slideshow, alternating prepared and on-demand transitions, so that
+  // each slide arrives both ways and over each kind of predecessor
+  for (int transition = 0; transition < 2 * SLIDE_COUNT + 1; transition++) {
+    int slide = transition % SLIDE_COUNT;
+    bool prepare = transition % 2 == 0;
+    if (prepare) {
+      Display::prepareNextSlide();
+      CHECK(Display::isPrepared(slide));
+    }
+    nextTransition();
+    CHECK(!Display::isPrepared(slide));
+    CHECK(panelShows(slide));
+  }
+
+  // New data after the next slide was prepared: it is drawn again with the new value
+  int slide = (2 * SLIDE_COUNT + 1) % SLIDE_COUNT;
+  Display::prepareNextSlide();
+  CHECK(Display::isPrepared(slide));
+  realtime.uvIndex += 2.0f; // The UV slide is next
+  Display::updateRealtimeData(realtime);
+  CHECK(!Display::isPrepared(slide));
+  nextTransition();
+  CHECK(panelShows(slide));
+
+  // The same values again keep the snapshot version, and the prepared slide with it
+  Display::prepareNextSlide();
+  Display::updateRealtimeData(realtime);
+  CHECK(Display::isPrepared((slide + 1) % SLIDE_COUNT));
+
+  return TestSupport::finish("PreparedSlideTest");
+}
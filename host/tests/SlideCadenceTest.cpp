@@ -0,0 +1,52 @@
+// SlideCadenceTest.cpp - The offline sketch on the virtual clock: slides change on the dot of
+// their 7 s cadence, and loop() sleeps between task deadlines instead of spinning
+#include <Arduino.h>
+#include "today.ino.cpp"
+#include "TestSupport.h"
+
+int main() {
+  HostClock::setVirtual(true);
+  setup();
+
+  const unsigned long runMs = 200000;
+  unsigned long due = 0;
+  bool running = Display::getNextSlideTime(due);
+  int changes = 0;
+  unsigned long loops = 0;
+  unsigned long shortest = 0xFFFFFFFFUL;
+  unsigned long longest = 0;
+  unsigned long latest = 0;
+
+  while (millis() < runMs) {
+    // Tasks run first and take no virtual time; the sleep comes after them
+    unsigned long ranAt = millis();
+    loop();
+    loops++;
+
+    unsigned long next = 0;
+    if (!Display::getNextSlideTime(next)) {
+      continue;
+    }
+    if (running && next != due) {
+      unsigned long interval = next - due;
+      shortest = interval < shortest ? interval : shortest;
+      longest = interval > longest ? interval : longest;
+      unsigned long late = ranAt - due;
+      latest = late > latest ? late : latest;
+      changes++;
+    }
+    running = true;
+    due = next;
+  }
+
+  printf("%d slide changes in %lu s, %lu-%lu ms apart, at most %lu ms late; %lu loop() calls\n", changes,
+    runMs / 1000, shortest, longest, latest, loops);
+  CHECK(changes >= (int)(runMs / 7000) - 2);
+  CHECK(shortest == 7000 && longest == 7000);
+  CHECK(latest == 0);
+
+  // One loop() per touch deadline, 10 ms apart, sleeping in between
+  CHECK(loops <= runMs / 10 + 100);
+
+  return TestSupport::finish("SlideCadenceTest");
+}
@@ -0,0 +1,65 @@
+// SlideRenderTest.cpp - Every slide rendered off-screen with the example data: pixels written
+// per slide, identical frames on a second render, and the capture format frames-to-png.py reads
+#include <Arduino.h>
+#include "Display.h"
+#include "ExampleData.h"
+
+namespace {
+  // Counts the lines of a frame dump and keeps its first one
+  class DumpReader : public Print {
+  public:
+    std::string header;
+    int lines = 0;
+
+    size_t write(uint8_t c) override {
+      if (c == '\n') {
+        lines++;
+      }
+      else if (lines == 0 && c != '\r') {
+        header += (char)c;
+      }
+      return 1;
+    }
+  };
+}
+
+int main() {
+  Display::init();
+  Display::updatePoolData(ExampleData::pool());
+  Display::updateForecastData(ExampleData::forecast());
+  Display::displayRealtimeWeather(ExampleData::realtime());
+
+  FrameBuffer frame(800, 480);
+  FrameBuffer again(800, 480);
+  CHECK(frame.isValid() && again.isValid());
+  const unsigned long frameSize = 800UL * 480;
+
+  for (int slide = 0; slide < SLIDE_COUNT; slide++) {
+    frame.resetStats();
+    Display::renderSlide(frame, slide);
+    unsigned long written = frame.getPixelsWritten();
+    printf("slide %d (%s): %lu pixels written, %.1f%% of the frame\n", slide, SLIDES[slide].title, written,
+      100.0 * written / frameSize);
+
+    // A full clear, then the title, icon and value over it
+    CHECK(frame.wasCleared());
+    CHECK(written > frameSize && written < frameSize * 115 / 100);
+
+    // Same data, same pixels
+    Display::renderSlide(again, slide);
+    CHECK(memcmp(frame.getBuffer(), again.getBuffer(), frameSize * sizeof(uint16_t)) == 0);
+  }
+
+  DumpReader dump;
+  frame.dump(dump, 5);
+  CHECK(dump.header == "FRAME 5 800 480");
+  CHECK(dump.lines == 480 + 2);
+
+  // What captureSlides() sends over Serial with DISPLAY_DEBUG: every slide, in order
+  DumpReader capture;
+  Display::renderSlides(frame, &capture);
+  CHECK(capture.header == "FRAME 0 800 480");
+  CHECK(capture.lines == SLIDE_COUNT * (480 + 2));
+
+  return TestSupport::finish("SlideRenderTest");
+}
@@ -0,0 +1,191 @@
+// SnapshotStoreTest.cpp - Change masks compare values rather than bytes, and seqlock readers on
+// other threads only ever see whole versions, in order, while a writer publishes flat out
+#include <Arduino.h>
+#include <atomic>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include "SnapshotStore.h"
+#include "ExampleData.h"
+#include "TestSupport.h"
+
+namespace {
+  // The same forecast over different bytes: padding, and the bytes after each date's terminator
+  void checkForecastChanges() {
+    static ForecastData before;
+    static ForecastData after;
+    memset(&before, 0x00, sizeof(before));
+    memset(&after, 0xA5, sizeof(after));
+    const ForecastData& example = ExampleData::forecast();
+    before.dayCount = after.dayCount = example.dayCount;
+    before.hourCount = after.hourCount = example.hourCount;
+    before.minuteCount = after.minuteCount = example.minuteCount;
+    before.isValid = after.isValid = true;
+    for (int i = 0; i < example.dayCount; i++) {
+      const DailyForecastData& day = example.daily[i];
+      for (DailyForecastData* copy : { &before.daily[i], &after.daily[i] }) {
+        strcpy(copy->date, day.date);
+        for (const FieldBinding<DailyForecastData>& field : DAILY_FIELDS) {
+          if (field.member != nullptr) {
+            copy->*(field.member) = day.*(field.member);
+          }
+          else {
+            copy->*(field.codeMember) = day.*(field.codeMember);
+          }
+        }
+        copy->isValid = day.isValid;
+      }
+    }
+    for (int i = 0; i < example.hourCount; i++) {
+      before.hourly[i] = example.hourly[i];
+      after.hourly[i].time = example.hourly[i].time;
+      for (const FieldBinding<TimelineEntry>& field : TIMELINE_FIELDS) {
+        if (field.member != nullptr) {
+          after.hourly[i].*(field.member) = example.hourly[i].*(field.member);
+        }
+        else {
+          after.hourly[i].*(field.codeMember) = example.hourly[i].*(field.codeMember);
+        }
+      }
+    }
+    for (int i = 0; i < example.minuteCount; i++) {
+      before.minutely[i] = example.minutely[i];
+      after.minutely[i] = example.minutely[i];
+    }
+
+    CHECK(snapshotChanges(before, after) == 0);
+
+    after.daily[2].temperatureAvg += 1.0f;
+    CHECK(snapshotChanges(before, after) == FORECAST_DAILY);
+    after.daily[2].temperatureAvg = before.daily[2].temperatureAvg;
+    after.daily[0].date[0] = 'X';
+    CHECK(snapshotChanges(before, after) == FORECAST_DAILY);
+    after.daily[0].date[0] = before.daily[0].date[0];
+    after.hourly[5].weatherCode = 4201;
+    CHECK(snapshotChanges(before, after) == FORECAST_HOURLY);
+    after.hourly[5].weatherCode = before.hourly[5].weatherCode;
+    after.minutely[59].time++;
+    CHECK(snapshotChanges(before, after) == FORECAST_MINUTELY);
+    after.minutely[59].time--;
+    after.minuteCount--;
+    CHECK(snapshotChanges(before, after) == FORECAST_MINUTELY);
+  }
+
+  // Every value of write i is i, so any mix of two versions shows
+  void checkConcurrentReads() {
+    const int writes = 200000;
+    static WeatherSnapshots store;
+    std::atomic<bool> done(false);
+    std::atomic<long> reads(0);
+    std::atomic<long> torn(0);
+    std::atomic<long> regressions(0);
+    std::atomic<long> noOpPublishes(0);
+    std::atomic<long> tryReadRetries(0);
+
+    std::thread writer([&] {
+      static ForecastData forecast = {};
+      for (int i = 1; i <= writes; i++) {
+        RealtimeWeatherData realtime = { (float)i, (float)i, (float)i, (float)i, (float)i, (float)i, i, true };
+        store.realtime.publish(realtime, i);
+        if (i % 10 == 0) {
+          forecast.dayCount = 7;
+          forecast.hourCount = 24;
+          forecast.minuteCount = 60;
+          forecast.isValid = true;
+          for (int k = 0; k < 60; k++) {
+            forecast.minutely[k].time = i;
+          }
+          for (int k = 0; k < 24; k++) {
+            forecast.hourly[k].time = i;
+          }
+          for (int d = 0; d < 7; d++) {
+            forecast.daily[d].temperatureAvg = i;
+          }
+          store.forecast.publish(forecast, i);
+        }
+
+        // Publishing the same values again keeps the version
+        noOpPublishes += store.realtime.publish(realtime, i + 1) != 0 ? 1 : 0;
+      }
+      done = true;
+    });
+
+    // Three readers that wait out a write, and one that gives up like an ISR would
+    auto reader = [&](bool once) {
+      static thread_local Snapshot<RealtimeWeatherData> realtime;
+      static thread_local Snapshot<ForecastData> forecast;
+      uint32_t lastRealtime = 0;
+      uint32_t lastForecast = 0;
+      while (!done) {
+        if (once) {
+          if (!store.realtime.tryRead(realtime)) {
+            tryReadRetries++;
+            continue;
+          }
+        }
+        else {
+          store.realtime.read(realtime);
+        }
+        reads++;
+
+        float v = realtime.data.temperature;
+        if (realtime.version > 0 && (realtime.data.uvIndex != v || realtime.data.humidity != v ||
+          realtime.data.cloudCover != v || realtime.data.weatherCode != (int)v ||
+          realtime.updatedAt != (unsigned long)v || realtime.version != (uint32_t)v)) {
+          torn++;
+        }
+        // Every field changes from one write to the next; validity does not
+        if (realtime.version > 1 && realtime.changed != 0x7F) {
+          torn++;
+        }
+        regressions += realtime.version < lastRealtime ? 1 : 0;
+        lastRealtime = realtime.version;
+
+        if (once) {
+          continue;
+        }
+        store.forecast.read(forecast);
+        if (forecast.version == 0) {
+          continue;
+        }
+        unsigned long t = forecast.data.minutely[0].time;
+        bool whole = forecast.updatedAt == t && forecast.data.daily[6].temperatureAvg == (float)t;
+        for (int k = 0; k < 60; k++) {
+          whole = whole && forecast.data.minutely[k].time == t;
+        }
+        for (int k = 0; k < 24; k++) {
+          whole = whole && forecast.data.hourly[k].time == t;
+        }
+        torn += whole ? 0 : 1;
+        regressions += forecast.version < lastForecast ? 1 : 0;
+        lastForecast = forecast.version;
+      }
+    };
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; i++) {
+      readers.emplace_back(reader, false);
+    }
+    readers.emplace_back(reader, true);
+    writer.join();
+    for (std::thread& thread : readers) {
+      thread.join();
+    }
+
+    printf("%ld reads, %ld torn, %ld version regressions, %ld tryRead retries; realtime v%u, forecast v%u\n",
+      reads.load(), torn.load(), regressions.load(), tryReadRetries.load(), store.realtime.getVersion(),
+      store.forecast.getVersion());
+    CHECK(reads > 0);
+    CHECK(torn == 0);
+    CHECK(regressions == 0);
+    CHECK(noOpPublishes == 0);
+    CHECK(store.realtime.getVersion() == (uint32_t)writes);
+    CHECK(store.forecast.getVersion() == (uint32_t)writes / 10);
+  }
+}
+
+int main() {
+  checkForecastChanges();
+  checkConcurrentReads();
+  return TestSupport::finish("SnapshotStoreTest");
+}
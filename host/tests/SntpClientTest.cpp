@@ -0,0 +1,220 @@
+// SntpClientTest.cpp - SntpClient and DisciplinedClock against fake servers and a drifting local
+// oscillator: accuracy, frequency tracking, bad servers, path asymmetry, slow name lookups,
+// slewing and micros() wraps
+#include <Arduino.h>
+#include <math.h>
+#include "SntpClient.h"
+#include "FakeNtp.h"
+#include "TestSupport.h"
+
+namespace {
+  const int64_t START_US = 1760000000LL * 1000000;
+  int64_t trueUs = START_US;
+  double driftPpm = 0;
+
+  int64_t trueClock() {
+    return trueUs;
+  }
+
+  // The board's micros(): 32 bits, running driftPpm fast, from an arbitrary start
+  unsigned long localMicros() {
+    return (unsigned long)(uint32_t)(int64_t)((trueUs - START_US) * (1 + driftPpm * 1e-6) + 12345);
+  }
+
+  void wait(int64_t us) {
+    trueUs += us;
+  }
+
+  FakeNtp ntp(trueClock, wait);
+  const char* const HOSTS[] = { "a", "b", "c" };
+
+  struct Result {
+    double maxErrorMs;
+    double meanErrorMs;
+  };
+
+  // Poll as the ntp task would, sampling the clock's error every 10 ms after `settleHours`
+  Result run(DisciplinedClock& clock, SntpClient& sntp, double hours, double settleHours) {
+    double maxError = 0;
+    double sum = 0;
+    long samples = 0;
+    int64_t end = trueUs + (int64_t)(hours * 3600e6);
+    int64_t settled = trueUs + (int64_t)(settleHours * 3600e6);
+    while (trueUs < end) {
+      unsigned long waitMs = sntp.poll();
+      while (waitMs > 0) {
+        unsigned long step = waitMs < 10000 ? waitMs : 10000;
+        trueUs += (int64_t)step * 1000;
+        waitMs -= step;
+        if (trueUs > settled && clock.isSet()) {
+          double error = (clock.nowUs() - trueUs) / 1000.0;
+          maxError = fabs(error) > maxError ? fabs(error) : maxError;
+          sum += error;
+          samples++;
+        }
+      }
+    }
+    return { maxError, samples > 0 ? sum / samples : 0 };
+  }
+
+  void restart(double ppm) {
+    trueUs = START_US;
+    driftPpm = ppm;
+    ntp.reset();
+  }
+
+  void checkTimestamps() {
+    CHECK(SntpClient::toUnixUs(SntpClient::toNtpTimestamp(1760000000123456LL)) == 1760000000123456LL);
+    CHECK(SntpClient::toUnixUs(SntpClient::toNtpTimestamp(2200000000000001LL)) == 2200000000000001LL); // Era 1
+    CHECK(SntpClient::toUnixUs(0xE4B0C6F080000000ULL) / 1000 % 1000 == 500);
+  }
+
+  // Three good servers, 15 ms each way with jitter, and a crystal 60 ppm fast
+  void checkSymmetric() {
+    restart(60);
+    DisciplinedClock clock(localMicros);
+    SntpClient sntp(clock, HOSTS, 3);
+    sntp.begin();
+    CHECK(!clock.isSet());
+    Result result = run(clock, sntp, 12, 2);
+    printf("symmetric paths: max error %.2f ms, frequency %.2f ppm, polling every %lu s\n", result.maxErrorMs,
+      clock.getFrequencyPpm(), sntp.getPollIntervalMs() / 1000);
+    CHECK(clock.isSet());
+    CHECK(result.maxErrorMs < 3.0);
+    CHECK(fabs(clock.getFrequencyPpm() + 60) < 3);
+    CHECK(sntp.getPollIntervalMs() == SntpClient::MAX_POLL_MS);
+  }
+
+  // A falseticker 3 s off among two good servers is outvoted
+  void checkFalseticker() {
+    restart(-25);
+    ntp.servers["b"].errorUs = 3000000;
+    DisciplinedClock clock(localMicros);
+    SntpClient sntp(clock, HOSTS, 3);
+    sntp.begin();
+    Result result = run(clock, sntp, 4, 1);
+    printf("falseticker: max error %.2f ms, %lu replies rejected\n", result.maxErrorMs, sntp.getRejected());
+    CHECK(result.maxErrorMs < 3.0);
+    CHECK(sntp.getRejected() > 0);
+  }
+
+  // One server silent, one answering kiss-o'-death, one good
+  void checkBadServers() {
+    restart(10);
+    ntp.servers["a"].silent = true;
+    ntp.servers["b"].kissOfDeath = true;
+    DisciplinedClock clock(localMicros);
+    SntpClient sntp(clock, HOSTS, 3);
+    sntp.begin();
+    Result result = run(clock, sntp, 4, 1);
+    printf("silent and kiss-o'-death servers: max error %.2f ms\n", result.maxErrorMs);
+    CHECK(clock.isSet());
+    CHECK(result.maxErrorMs < 3.0);
+  }
+
+  // 30 ms up and 10 ms down: SNTP cannot see asymmetry, so the clock is half of it ahead
+  void checkAsymmetric() {
+    restart(0);
+    for (const char* host : HOSTS) {
+      ntp.servers[host].upUs = 30000;
+      ntp.servers[host].downUs = 10000;
+      ntp.servers[host].jitterUs = 0;
+    }
+    DisciplinedClock clock(localMicros);
+    SntpClient sntp(clock, HOSTS, 3);
+    sntp.begin();
+    Result result = run(clock, sntp, 2, 0.5);
+    printf("asymmetric paths: mean error %.2f ms (+10 expected)\n", result.meanErrorMs);
+    CHECK(fabs(result.meanErrorMs - 10) < 1.5);
+  }
+
+  // A 250 ms name lookup before every request, no jitter: the offset and delay leave it out
+  void checkSlowLookups() {
+    restart(0);
+    for (const char* host : HOSTS) {
+      ntp.servers[host].lookupUs = 250000;
+      ntp.servers[host].jitterUs = 0;
+    }
+    DisciplinedClock clock(localMicros);
+    SntpClient sntp(clock, HOSTS, 3);
+    sntp.begin();
+    Result result = run(clock, sntp, 2, 0.5);
+    printf("250 ms lookups: max error %.2f ms, last offset %.2f ms, delay %.2f ms (30 expected)\n",
+      result.maxErrorMs, sntp.getLastOffsetUs() / 1000.0, sntp.getLastDelayUs() / 1000.0);
+    CHECK(result.maxErrorMs < 3.0);
+    CHECK(fabs(result.meanErrorMs) < 1.0);
+    CHECK(sntp.getLastDelayUs() > 29000 && sntp.getLastDelayUs() < 32000);
+  }
+
+  // No replies: never set, and the retries back off
+  void checkSilent() {
+    restart(0);
+    for (const char* host : HOSTS) {
+      ntp.servers[host].silent = true;
+    }
+    DisciplinedClock clock(localMicros);
+    SntpClient sntp(clock, HOSTS, 3);
+    sntp.begin();
+    run(clock, sntp, 1, 0);
+    printf("no replies: %d requests per server in an hour\n", ntp.servers["a"].requests);
+    CHECK(!clock.isSet());
+    CHECK(ntp.servers["a"].requests > 3 && ntp.servers["a"].requests < 70);
+  }
+
+  // Once set, a 50 ms offset is slewed away and the clock never runs backwards
+  void checkSlew() {
+    restart(0);
+    DisciplinedClock clock(localMicros);
+    SntpClient sntp(clock, HOSTS, 3);
+    sntp.begin();
+    run(clock, sntp, 0.5, 0);
+    for (const char* host : HOSTS) {
+      ntp.servers[host].errorUs = -50000;
+    }
+
+    int64_t last = clock.nowUs();
+    bool monotonic = true;
+    int64_t end = trueUs + 3600000000LL;
+    while (trueUs < end) {
+      unsigned long waitMs = sntp.poll();
+      trueUs += (int64_t)(waitMs < 1000 ? waitMs : 1000) * 1000;
+      int64_t now = clock.nowUs();
+      monotonic = monotonic && now >= last;
+      last = now;
+    }
+    double errorMs = (clock.nowUs() - (trueUs - 50000)) / 1000.0;
+    printf("50 ms slew: %.2f ms from the shifted servers after an hour\n", errorMs);
+    CHECK(monotonic);
+    CHECK(fabs(errorMs) < 3);
+  }
+
+  // Read at least once per micros() wrap, the local counter keeps counting; a gap longer
+  // than a wrap loses one
+  void checkWraps() {
+    restart(0);
+    DisciplinedClock clock(localMicros);
+    int64_t startLocal = clock.getLocalUs();
+    for (int minute = 0; minute < 5 * 72; minute += 10) {
+      trueUs += 10 * 60000000LL;
+      clock.getLocalUs();
+    }
+    CHECK(clock.getLocalUs() - startLocal == trueUs - START_US);
+
+    int64_t before = clock.getLocalUs();
+    trueUs += 75 * 60000000LL;
+    CHECK(clock.getLocalUs() - before == 75 * 60000000LL - 4294967296LL);
+  }
+}
+
+int main() {
+  checkTimestamps();
+  checkSymmetric();
+  checkFalseticker();
+  checkBadServers();
+  checkAsymmetric();
+  checkSlowLookups();
+  checkSilent();
+  checkSlew();
+  checkWraps();
+  return TestSupport::finish("SntpClientTest");
+}
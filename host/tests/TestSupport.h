@@ -0,0 +1,36 @@
+// TestSupport.h - Checks and fixtures shared by the host tests
+#pragma once
+#include <stdio.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace TestSupport {
+  inline int& failures() {
+    static int count = 0;
+    return count;
+  }
+
+  // A file from the source tree, e.g. "examples/forecast.json"
+  inline std::string readSourceFile(const char* path) {
+    std::ifstream file(std::string(TODAY_SOURCE_DIR) + "/" + path, std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+  }
+
+  // Print the tally; the return value is the test's exit code
+  inline int finish(const char* name) {
+    printf("%s: %s\n", name, failures() == 0 ? "OK" : "FAILED");
+    return failures() == 0 ? 0 : 1;
+  }
+}
+
+// Report and count a failed condition, then carry on so one run shows every failure
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+      TestSupport::failures()++; \
+    } \
+  } while (0)
@@ -0,0 +1,97 @@
+// TextRunCacheTest.cpp - Cached text runs give the same pixels as blending the glyphs, into a
+// frame or through drawRGBBitmap, and the least recently used run is the one replaced
+#include <Arduino.h>
+#include "Display.h"
+#include "TestSupport.h"
+
+namespace {
+  const int16_t WIDTH = 400;
+  const int16_t HEIGHT = 120;
+  const uint16_t BACKGROUND = 0x3C9F;
+
+  bool samePixels(const FrameBuffer& a, const FrameBuffer& b) {
+    return memcmp(a.getBuffer(), b.getBuffer(), (size_t)WIDTH * HEIGHT * sizeof(uint16_t)) == 0;
+  }
+
+  void checkPixels() {
+    FrameBuffer blended(WIDTH, HEIGHT);
+    FrameBuffer cached(WIDTH, HEIGHT);
+    FrameBuffer panel(WIDTH, HEIGHT);
+    TextRunCache runs;
+
+    const char* values[] = { "11.8C", "8.2km/h", "No data", "-12.5%" };
+    for (int pass = 0; pass < 2; pass++) {
+      for (const char* value : values) {
+        blended.fillScreen(BACKGROUND);
+        cached.fillScreen(BACKGROUND);
+        panel.fillScreen(BACKGROUND);
+        int16_t blendedX = PackedText::drawBlended(blended, Inter_Medium24ptSmooth, 10, 100, value, WHITE, BACKGROUND);
+        int16_t cachedX = runs.draw(cached, &cached, Inter_Medium24ptSmooth, 10, 100, value, WHITE, BACKGROUND);
+        int16_t panelX = runs.draw(panel, nullptr, Inter_Medium24ptSmooth, 10, 100, value, WHITE, BACKGROUND);
+        CHECK(cachedX == blendedX && panelX == blendedX);
+        CHECK(samePixels(cached, blended));
+        CHECK(samePixels(panel, blended));
+      }
+    }
+
+    // Rendered once each on the first pass; every other draw copies the run
+    CHECK(runs.getMisses() == 4);
+    CHECK(runs.getHits() == 12);
+
+    // Another background is another run
+    runs.draw(cached, &cached, Inter_Medium24ptSmooth, 10, 100, "11.8C", WHITE, BLACK);
+    CHECK(runs.getMisses() == 5);
+  }
+
+  void checkReplacement() {
+    FrameBuffer frame(WIDTH, HEIGHT);
+    TextRunCache runs;
+    char text[8];
+    for (int i = 0; i < TextRunCache::SLOTS; i++) {
+      snprintf(text, sizeof(text), "%d.0C", i);
+      runs.draw(frame, &frame, Inter_Medium24ptSmooth, 10, 100, text, WHITE, BACKGROUND);
+    }
+
+    // Keep "0.0C" recent, then a new value takes the slot of "1.0C"
+    runs.draw(frame, &frame, Inter_Medium24ptSmooth, 10, 100, "0.0C", WHITE, BACKGROUND);
+    runs.draw(frame, &frame, Inter_Medium24ptSmooth, 10, 100, "9.0C", WHITE, BACKGROUND);
+    unsigned long misses = runs.getMisses();
+    runs.draw(frame, &frame, Inter_Medium24ptSmooth, 10, 100, "0.0C", WHITE, BACKGROUND);
+    CHECK(runs.getMisses() == misses);
+    runs.draw(frame, &frame, Inter_Medium24ptSmooth, 10, 100, "1.0C", WHITE, BACKGROUND);
+    CHECK(runs.getMisses() == misses + 1);
+
+    // Too long to cache, still drawn
+    unsigned long hits = runs.getHits();
+    CHECK(runs.draw(frame, &frame, Inter_Medium24ptSmooth, 0, 100, "1234567890123456", WHITE, BACKGROUND) > 0);
+    CHECK(runs.getHits() == hits);
+  }
+
+  void printTimes() {
+    FrameBuffer frame(WIDTH, HEIGHT);
+    TextRunCache runs;
+    const int repeats = 1000;
+    frame.fillScreen(BACKGROUND);
+
+    unsigned long startTime = micros();
+    for (int i = 0; i < repeats; i++) {
+      PackedText::drawBlended(frame, Inter_Medium24ptSmooth, 10, 100, "11.8C", WHITE, BACKGROUND);
+    }
+    unsigned long blendedUs = micros() - startTime;
+
+    startTime = micros();
+    for (int i = 0; i < repeats; i++) {
+      runs.draw(frame, &frame, Inter_Medium24ptSmooth, 10, 100, "11.8C", WHITE, BACKGROUND);
+    }
+    unsigned long cachedUs = micros() - startTime;
+    printf("\"11.8C\": blended %.2f us, cached %.2f us per draw\n", blendedUs / (float)repeats,
+      cachedUs / (float)repeats);
+  }
+}
+
+int main() {
+  checkPixels();
+  checkReplacement();
+  printTimes();
+  return TestSupport::finish("TextRunCacheTest");
+}
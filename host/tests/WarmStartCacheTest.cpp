@@ -0,0 +1,200 @@
+// WarmStartCacheTest.cpp - The warm-start record round-trips, keeps its byte layout, damaged
+// records are ignored, an interrupted save is recovered, and flushIfDue() writes only for
+// fetched changes at most every 30 minutes
+#include <Arduino.h>
+#include <stdio.h>
+#include <unistd.h>
+#include "WarmStartCache.h"
+#include "ExampleData.h"
+#include "TestSupport.h"
+
+namespace {
+  const char* CACHE_PATH = "today_cache.bin";
+  const char* TEMP_PATH = "today_cache.tmp";
+
+  ForecastData& exampleForecast() {
+    static ForecastData forecast = {};
+    WeatherForecast parser("key", "0,0");
+    parser.parseForecastJson(String(TestSupport::readSourceFile("examples/forecast.json")), forecast);
+    forecast.isValid = true;
+    return forecast;
+  }
+
+  bool sameEntries(const TimelineEntry* a, const TimelineEntry* b, int count) {
+    for (int i = 0; i < count; i++) {
+      if (a[i].time != b[i].time || a[i].temperature != b[i].temperature || a[i].humidity != b[i].humidity ||
+        a[i].windDirection != b[i].windDirection || a[i].weatherCode != b[i].weatherCode) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool loadsAfter(void (*damage)(FILE* file)) {
+    FILE* file = fopen(CACHE_PATH, "r+b");
+    damage(file);
+    fclose(file);
+    RealtimeWeatherData realtime = {};
+    PoolTemperatureData pool = { "", 0.0f, 0, "", false };
+    static ForecastData forecast = {};
+    return WarmStartCache::load(realtime, pool, forecast);
+  }
+
+  void checkRoundTrip() {
+    const ForecastData& forecast = exampleForecast();
+    const RealtimeWeatherData realtime = { 11.8f, 1.0f, 92.0f, 8.2f, 209.0f, 96.0f, 1001, true };
+    const PoolTemperatureData pool = { "current", 19.31f, 1731227559UL, "", true };
+
+    remove(CACHE_PATH);
+    RealtimeWeatherData loadedRealtime = {};
+    PoolTemperatureData loadedPool = { "", 0.0f, 0, "", false };
+    static ForecastData loadedForecast = {};
+    CHECK(!WarmStartCache::load(loadedRealtime, loadedPool, loadedForecast));
+
+    CHECK(WarmStartCache::save(realtime, pool, forecast));
+    CHECK(WarmStartCache::load(loadedRealtime, loadedPool, loadedForecast));
+    CHECK(loadedRealtime.isValid && loadedRealtime.temperature == realtime.temperature);
+    CHECK(loadedRealtime.weatherCode == realtime.weatherCode && loadedRealtime.windDirection == realtime.windDirection);
+    CHECK(loadedPool.isValid && loadedPool.id == "current" && loadedPool.temperature == pool.temperature);
+    CHECK(loadedPool.timestamp == pool.timestamp);
+    CHECK(loadedForecast.isValid && loadedForecast.dayCount == forecast.dayCount);
+    CHECK(strcmp(loadedForecast.daily[3].date, forecast.daily[3].date) == 0);
+    CHECK(loadedForecast.daily[3].temperatureAvg == forecast.daily[3].temperatureAvg);
+    CHECK(loadedForecast.hourCount == forecast.hourCount && loadedForecast.minuteCount == forecast.minuteCount);
+    CHECK(sameEntries(loadedForecast.hourly, forecast.hourly, forecast.hourCount));
+    CHECK(sameEntries(loadedForecast.minutely, forecast.minutely, forecast.minuteCount));
+
+    FILE* file = fopen(CACHE_PATH, "rb");
+    fseek(file, 0, SEEK_END);
+    printf("record with a full forecast: %ld bytes\n", ftell(file));
+    fclose(file);
+
+    // A flipped payload byte, a truncated file and another format version are all rejected
+    CHECK(!loadsAfter([](FILE* record) {
+      fseek(record, 100, SEEK_SET);
+      int c = fgetc(record);
+      fseek(record, 100, SEEK_SET);
+      fputc(c ^ 0x55, record);
+    }));
+    CHECK(WarmStartCache::save(realtime, pool, forecast));
+    CHECK(!loadsAfter([](FILE* record) {
+      fseek(record, 0, SEEK_END);
+      long length = ftell(record);
+      CHECK(ftruncate(fileno(record), length - 10) == 0);
+    }));
+    CHECK(WarmStartCache::save(realtime, pool, forecast));
+    CHECK(!loadsAfter([](FILE* record) {
+      fseek(record, 4, SEEK_SET);
+      fputc(0x7F, record);
+    }));
+    CHECK(WarmStartCache::save(realtime, pool, forecast));
+    CHECK(loadsAfter([](FILE*) {
+    }));
+  }
+
+  // Power cut between save()'s remove and rename, as on FAT: only the temp file is left, and
+  // it loads and becomes the record if its CRC holds
+  void checkInterruptedSave() {
+    RealtimeWeatherData realtime = {};
+    PoolTemperatureData pool = { "", 0.0f, 0, "", false };
+    static ForecastData forecast = {};
+    remove(TEMP_PATH);
+    CHECK(WarmStartCache::save(ExampleData::realtime(), ExampleData::pool(), ExampleData::forecast()));
+    CHECK(access(TEMP_PATH, F_OK) != 0);
+
+    CHECK(rename(CACHE_PATH, TEMP_PATH) == 0);
+    CHECK(WarmStartCache::load(realtime, pool, forecast));
+    CHECK(realtime.isValid && pool.isValid && forecast.isValid);
+    CHECK(access(CACHE_PATH, F_OK) == 0 && access(TEMP_PATH, F_OK) != 0);
+
+    // A torn temp file is not taken
+    CHECK(rename(CACHE_PATH, TEMP_PATH) == 0);
+    FILE* file = fopen(TEMP_PATH, "r+b");
+    fseek(file, 0, SEEK_END);
+    CHECK(ftruncate(fileno(file), ftell(file) / 2) == 0);
+    fclose(file);
+    CHECK(!WarmStartCache::load(realtime, pool, forecast));
+    remove(TEMP_PATH);
+  }
+
+  // The example data's record, pinned by its header: the CRC covers every payload byte. These
+  // are the bytes the cache wrote before its field layouts moved to SnapshotCodec, so records
+  // saved by older firmware still load.
+  void checkLayout() {
+    const uint8_t expected[12] = { 0x54, 0x44, 0x41, 0x59, 0x02, 0x00, 0x4f, 0x0b, 0xfc, 0x3c, 0x57, 0x9c };
+    remove(CACHE_PATH);
+    CHECK(WarmStartCache::save(ExampleData::realtime(), ExampleData::pool(), ExampleData::forecast()));
+    FILE* file = fopen(CACHE_PATH, "rb");
+    uint8_t header[12] = {};
+    CHECK(fread(header, 1, sizeof(header), file) == sizeof(header));
+    fclose(file);
+    CHECK(memcmp(header, expected, sizeof(header)) == 0);
+  }
+
+  // A day of the sketch's unified mode: a forecast fetch every 30 minutes, a pool fetch every
+  // 8 with its reading moving by a tenth of a degree every other time, and realtime
+  // re-derived every minute
+  void checkFlushes() {
+    WarmStartCache::setRealtimeDerived(true);
+    static WeatherSnapshots snapshots;
+    static ForecastData forecast = exampleForecast();
+    RealtimeWeatherData realtime = { 11.8f, 1.0f, 92.0f, 8.2f, 209.0f, 96.0f, 1001, true };
+    PoolTemperatureData pool = { "current", 19.3f, 1731227559UL, "", true };
+    WarmStartCache::markSaved(snapshots);
+
+    int writes = 0;
+    unsigned long lastWrite = 0;
+    unsigned long shortestGap = 0xFFFFFFFFUL;
+    for (int minute = 1; minute <= 24 * 60; minute++) {
+      delay(60000);
+      if (minute % 30 == 0) {
+        forecast.minutely[0].temperature += 0.1f;
+        snapshots.forecast.publish(forecast, millis());
+      }
+      if (minute % 8 == 0 && minute % 16 != 0) {
+        pool.temperature += 0.1f;
+        snapshots.pool.publish(PoolReading::from(pool), millis());
+      }
+      realtime.temperature += 0.01f;
+      snapshots.realtime.publish(realtime, millis());
+
+      if (WarmStartCache::flushIfDue(snapshots)) {
+        unsigned long gap = millis() - lastWrite;
+        shortestGap = writes > 0 && gap < shortestGap ? gap : shortestGap;
+        lastWrite = millis();
+        writes++;
+      }
+    }
+
+    // Every 10 minutes, with derived realtime counted, was 144 writes a day
+    printf("unified mode: %d cache writes in 24 h, at least %lu min apart\n", writes, shortestGap / 60000);
+    CHECK(writes <= 48);
+    CHECK(shortestGap >= 30 * 60000UL);
+
+    // Once the fetched data is on flash, an hour of derived realtime writes nothing
+    delay(30 * 60000UL);
+    WarmStartCache::flushIfDue(snapshots);
+    int quietWrites = 0;
+    for (int minute = 0; minute < 60; minute++) {
+      delay(60000);
+      realtime.temperature += 0.01f;
+      snapshots.realtime.publish(realtime, millis());
+      quietWrites += WarmStartCache::flushIfDue(snapshots) ? 1 : 0;
+    }
+    CHECK(quietWrites == 0);
+
+    // Fetched realtime still counts when it is not derived
+    WarmStartCache::setRealtimeDerived(false);
+    CHECK(WarmStartCache::flushIfDue(snapshots));
+  }
+}
+
+int main() {
+  HostClock::setVirtual(true);
+  checkRoundTrip();
+  checkInterruptedSave();
+  checkLayout();
+  checkFlushes();
+  remove(CACHE_PATH);
+  return TestSupport::finish("WarmStartCacheTest");
+}
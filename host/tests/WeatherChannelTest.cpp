@@ -0,0 +1,104 @@
+// WeatherChannelTest.cpp - Snapshots cross QueueTransport between two threads whole and in order,
+// and every kind of message decodes to what was sent
+#include <Arduino.h>
+#include <atomic>
+#include <thread>
+#include "WeatherChannel.h"
+#include "TestSupport.h"
+
+namespace {
+  const int COUNT = 200000;
+
+  // Message i carries i in its values, so the receiver knows what it should have got
+  bool encode(WeatherMessage& message, ForecastData& forecast, int i) {
+    switch (i % 4) {
+    case 0: {
+      RealtimeWeatherData realtime = { (float)i, 1, 2, 3, 4, 5, 1000 + (i % 100), true };
+      return message.setRealtime(realtime);
+    }
+    case 1: {
+      PoolTemperatureData pool = { String("pool") + String(i), (float)i, (unsigned long)i, "ago", true };
+      return message.setPool(pool);
+    }
+    case 2:
+      forecast.dayCount = i % 8;
+      forecast.hourCount = i % 25;
+      forecast.minuteCount = i % 61;
+      forecast.isValid = true;
+      for (int k = 0; k < forecast.minuteCount; k++) {
+        forecast.minutely[k].time = i + k;
+      }
+      return message.setForecast(forecast);
+    default:
+      return message.setError(String("error ") + String(i));
+    }
+  }
+
+  bool decodes(const WeatherMessage& message, ForecastData& forecast, int i) {
+    switch (i % 4) {
+    case 0: {
+      RealtimeWeatherData realtime = {};
+      return message.type == WeatherMessageType::Realtime && message.getRealtime(realtime) && realtime.isValid &&
+        realtime.temperature == i && realtime.weatherCode == 1000 + (i % 100);
+    }
+    case 1: {
+      PoolTemperatureData pool;
+      return message.type == WeatherMessageType::Pool && message.getPool(pool) && pool.id == String("pool") + String(i) &&
+        pool.timestamp == (unsigned long)i && pool.timeAgo == String("ago");
+    }
+    case 2: {
+      bool ok = message.type == WeatherMessageType::Forecast && message.getForecast(forecast) && forecast.isValid &&
+        forecast.dayCount == i % 8 && forecast.hourCount == i % 25 && forecast.minuteCount == i % 61;
+      for (int k = 0; ok && k < forecast.minuteCount; k++) {
+        ok = forecast.minutely[k].time == (unsigned long)(i + k);
+      }
+      return ok;
+    }
+    default:
+      return message.type == WeatherMessageType::Error && message.getError() == String("error ") + String(i);
+    }
+  }
+}
+
+int main() {
+  static QueueTransport<> channel;
+  std::atomic<bool> encoded(true);
+  unsigned long fullRetries = 0;
+
+  // The producer retries a full queue, so nothing is dropped and every message is checked
+  std::thread producer([&] {
+    static WeatherMessage message;
+    static ForecastData forecast = {};
+    for (int i = 0; i < COUNT; i++) {
+      if (!encode(message, forecast, i)) {
+        encoded = false;
+      }
+      while (!channel.send(message)) {
+        fullRetries++;
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  static WeatherMessage message;
+  static ForecastData forecast = {};
+  int received = 0;
+  int mismatched = 0;
+  unsigned long bytes = 0;
+  while (received < COUNT) {
+    if (!channel.receive(message)) {
+      std::this_thread::yield();
+      continue;
+    }
+    bytes += message.size();
+    mismatched += decodes(message, forecast, received) ? 0 : 1;
+    received++;
+  }
+  producer.join();
+
+  printf("%d messages, %lu bytes, %lu full-queue retries, %d mismatched\n", received, bytes, fullRetries, mismatched);
+  CHECK(encoded);
+  CHECK(mismatched == 0);
+  CHECK(!channel.receive(message));
+  return TestSupport::finish("WeatherChannelTest");
+}
@@ -0,0 +1,163 @@
+// WiFiManagerTest.cpp - WiFiManager against the simulated radio on the virtual clock: backoff
+// and jitter between attempts, joining once the AP is back, rejoining after a drop, the cap,
+// and jitter that differs between boards
+#include <Arduino.h>
+#include <WiFi.h>
+#include <vector>
+#include "WiFiManager.h"
+#include "TaskScheduler.h"
+#include "TestSupport.h"
+
+namespace {
+  WiFiManager wifi("ssid", "password");
+  TaskScheduler scheduler("WiFi test");
+  int wifiTask = TaskScheduler::NO_TASK;
+  int fetchTask = TaskScheduler::NO_TASK;
+  unsigned long fetchRanAt = 0;
+  unsigned long linkUpAt = 0;
+  int linkUps = 0;
+  int linkDowns = 0;
+
+  std::vector<unsigned long> attemptsAt; // WiFi.begin() calls
+  std::vector<unsigned long> failedAt;   // AttemptFailed and LinkDown events
+
+  // As in the sketch: a LinkUp wakes the fetch task straight away
+  void onWiFiEvent(WiFiEvent event) {
+    switch (event) {
+    case WiFiEvent::LinkUp:
+      linkUps++;
+      linkUpAt = millis();
+      scheduler.wakeIn(fetchTask, 0);
+      break;
+    case WiFiEvent::LinkDown:
+      linkDowns++;
+      failedAt.push_back(millis());
+      break;
+    case WiFiEvent::AttemptFailed:
+      failedAt.push_back(millis());
+      break;
+    }
+  }
+
+  void runFor(unsigned long ms) {
+    unsigned long end = millis() + ms;
+    while ((long)(millis() - end) < 0) {
+      // Tasks run before runOnce() sleeps, and take no virtual time
+      unsigned long ranAt = millis();
+      int begins = WiFi.begins;
+      scheduler.runOnce();
+      if (WiFi.begins != begins) {
+        attemptsAt.push_back(ranAt);
+      }
+    }
+  }
+
+  // Retry n waits base * 2^n, capped, jittered into its upper half: the wait from failure n to
+  // the next attempt, which is attempt n + 1 if the run started with an attempt, else n
+  bool retriesBackOff(unsigned long baseMs, unsigned long maxMs, bool startedWithAttempt) {
+    size_t next = startedWithAttempt ? 1 : 0;
+    bool ok = true;
+    for (size_t i = 0; i < failedAt.size() && i + next < attemptsAt.size(); i++) {
+      unsigned long limit = baseMs;
+      for (size_t n = 0; n < i && limit < maxMs; n++) {
+        limit *= 2;
+      }
+      limit = limit < maxMs ? limit : maxMs;
+      unsigned long waited = attemptsAt[i + next] - failedAt[i];
+      ok = ok && waited >= limit / 2 && waited <= limit + 10;
+    }
+    return ok;
+  }
+
+  // The waits between a fresh manager's first attempts, every one refused
+  std::vector<unsigned long> retrySchedule(uint32_t seed) {
+    WiFiManager manager("ssid", "password");
+    manager.setJitterSeed(seed);
+    WiFi.refuseAttempts = 8;
+    std::vector<unsigned long> waits;
+    unsigned long lastAttemptAt = millis();
+    while (WiFi.refuseAttempts > 0) {
+      int begins = WiFi.begins;
+      unsigned long ranAt = millis();
+      delay(manager.poll());
+      if (WiFi.begins != begins) {
+        waits.push_back(ranAt - lastAttemptAt);
+        lastAttemptAt = ranAt;
+      }
+    }
+    waits.erase(waits.begin()); // Before the first attempt
+    return waits;
+  }
+}
+
+int main() {
+  HostClock::setVirtual(true);
+  WiFi.simulate = true;
+  WiFi.apUp = false;
+  WiFi.refuseAttempts = 2;
+
+  wifi.setEventHandler(onWiFiEvent);
+  wifiTask = scheduler.addTask("wifi", [] { scheduler.wakeIn(wifiTask, wifi.poll()); }, 1000);
+  fetchTask = scheduler.addTask("fetch", [] { fetchRanAt = millis(); }, 480000);
+  scheduler.wakeIn(fetchTask, 480000);
+
+  // AP down for 90 s: two refused joins, then 20 s timeouts, with the waits growing
+  runFor(90000);
+  CHECK(!wifi.isConnected() && linkUps == 0);
+  printf("%d attempts in 90 s with the AP down:", WiFi.begins);
+  for (size_t i = 1; i < attemptsAt.size(); i++) {
+    printf(" %lu", attemptsAt[i] - attemptsAt[i - 1]);
+  }
+  printf(" ms apart\n");
+  CHECK(WiFi.begins >= 4 && WiFi.begins <= 10);
+  CHECK(attemptsAt[1] - attemptsAt[0] < 5000);  // Refused at once
+  CHECK(retriesBackOff(2000, 300000, true));
+
+  // AP back: joined within the current retry window, and the fetch task runs in the same ms
+  WiFi.apUp = true;
+  unsigned long upAt = millis();
+  runFor(200000);
+  CHECK(wifi.isConnected() && linkUps == 1);
+  printf("joined %lu ms after the AP came back, in %lu ms\n", linkUpAt - upAt, wifi.getLastConnectMs());
+  CHECK(wifi.getLastConnectMs() >= 1500 && wifi.getLastConnectMs() < 1800);
+  CHECK(fetchRanAt == linkUpAt);
+
+  // Dropped link: the join reset the backoff, so the first retry is within 2 s
+  attemptsAt.clear();
+  failedAt.clear();
+  WiFi.dropLink();
+  unsigned long dropAt = millis();
+  runFor(30000);
+  CHECK(wifi.isConnected() && linkUps == 2 && linkDowns == 1 && wifi.getDrops() == 1);
+  printf("rejoined %lu ms after the drop\n", linkUpAt - dropAt);
+  CHECK(linkUpAt - dropAt < 5000 + 2000 + 1800); // Link check, retry, join
+  CHECK(retriesBackOff(2000, 300000, false));
+  CHECK(fetchRanAt == linkUpAt);
+
+  // An hour-long outage with a 60 s cap: every wait stays between 30 and 60 s once capped
+  attemptsAt.clear();
+  failedAt.clear();
+  wifi.setBackoff(2000, 60000);
+  WiFi.apUp = false;
+  WiFi.dropLink();
+  runFor(3600000);
+  CHECK(!wifi.isConnected());
+  printf("%zu attempts in an hour with the backoff capped at 60 s\n", attemptsAt.size());
+  CHECK(attemptsAt.size() >= 3600 / 80 && attemptsAt.size() <= 3600 / 50 + 6);
+  CHECK(retriesBackOff(2000, 60000, false));
+
+  wifi.logStats();
+
+  // Two boards with different seeds retry on different schedules; one seed always gives the same
+  std::vector<unsigned long> first = retrySchedule(0x1234);
+  std::vector<unsigned long> second = retrySchedule(0x5678);
+  printf("refused retries, seed 0x1234:");
+  for (unsigned long wait : first) {
+    printf(" %lu", wait);
+  }
+  printf(" ms\n");
+  CHECK(first.size() == 7 && second.size() == 7);
+  CHECK(first != second);
+  CHECK(retrySchedule(0x1234) == first);
+  return TestSupport::finish("WiFiManagerTest");
+}
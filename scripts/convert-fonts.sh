@@ -22,9 +22,10 @@ echo "./fontconvert helvetica.ttf 24 32 126 > HelveticaNeue24pt.h"
 echo "./fontconvert helvetica.ttf 36 32 126 > HelveticaNeue36pt.h"
 
 echo ""
-echo "STEP 3: Include in your project"
-echo "#include \"fonts/HelveticaNeue18pt.h\""
-echo "display.setFont(&HelveticaNeue18pt7b);"
+echo "STEP 3: Subset for the sketch"
+echo "Save the output in assets/fonts/, add it to FONTS in scripts/font-subset.py, then run:"
+echo "./font-subset.py --rle"
+echo "Draw with Display::drawText() using the PackedFont from today/lib/fonts/"
 
 echo ""
 echo "LEGAL ALTERNATIVES to Helvetica Neue:"
@@ -85,7 +85,7 @@ fi
 echo
 
 echo "${YELLOW}📚 Step 3: Checking required libraries...${NC}"
-REQUIRED_LIBS=("ArduinoJson" "ArduinoHttpClient" "Arduino_GigaDisplay_GFX" "AUnit")
+REQUIRED_LIBS=("Arduino_GigaDisplay_GFX" "AUnit")
 MISSING_LIBS=()
 
 for lib in "${REQUIRED_LIBS[@]}"; do
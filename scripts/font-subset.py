@@ -0,0 +1,310 @@
+#!/usr/bin/env python3
+
+# Font Subsetter for Today
+# Cuts the full fontconvert headers in assets/fonts/ down to the characters the slides
+# actually print and writes them to today/lib/fonts/ as PackedFont headers
+# (see today/lib/PackedFont.h), with a size report per font.
+#
+# Usage: ./font-subset.py [--rle] [--chars FONT=CHARS ...]
+# Each font's characters are scanned from the sketch (slide titles and units from the
+# SLIDES table, condition names, weekday names, message slides, drawText() literals)
+# plus the fixed extras in FONTS
+# for text built at runtime. --chars replaces the scan for one font.
+# --rle stores glyphs as nibble run lengths instead of 1-bit rows.
+#
+# The SMOOTH_FONTS are 4-bit anti-aliased versions for the large slide values, made at
+# the scale they are shown at. There is no outline font in the repo, so the outline is
+# rebuilt from the 1-bit glyph: the bitmap is interpolated between pixel centers and cut
+# at half intensity (straight edges stay on pixel boundaries, steps become slopes), and
+# each output pixel's coverage is measured with 4x4 samples and run-length packed.
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+SOURCES = ROOT / "assets" / "fonts"
+OUT = ROOT / "today" / "lib" / "fonts"
+DISPLAY = ROOT / "today" / "lib" / "Display.h"
+SLIDES = ROOT / "today" / "lib" / "Slides.h"
+CONDITIONS = ROOT / "today" / "lib" / "WeatherConditions.h"
+
+# Where each font's characters come from, besides drawText() calls naming it
+FONTS = {
+    "InterRegular12pt": {"groups": ("titles", "weekdays"), "extra": "0123456789-C"},  # Forecast "%dC"
+    "InterMedium24pt": {"groups": ("values", "conditions"), "extra": "0123456789.-"},  # String(float)
+    "InterBold18pt": {"groups": ("titles",), "extra": "0123456789"},
+}
+
+# Anti-aliased fonts: drawn at `scale` without further scaling
+SMOOTH_FONTS = {
+    "InterMedium24ptSmooth": {"source": "InterMedium24pt", "scale": 2, "groups": ("values",),
+                              "extra": "0123456789.-"},
+}
+
+MISSING = 0xFF
+SAMPLES = 4  # Per axis, for coverage
+GLYPH_SIZE = 8  # sizeof(GFXglyph) and sizeof(PackedGlyph) on ARM, padding included
+
+
+def string_literals(text):
+    return re.findall(r'"((?:[^"\\]|\\.)*)"', text)
+
+
+def call_arguments(text, name):
+    """Arguments of every call to `name`, split at top-level commas."""
+    calls = []
+    for match in re.finditer(r"\b" + name + r"\(", text):
+        depth = 0
+        args = []
+        current = ""
+        in_string = False
+        for c in text[match.end():]:
+            if c == '"' and not current.endswith("\\"):
+                in_string = not in_string
+            if not in_string:
+                if c in "([{":
+                    depth += 1
+                elif c in ")]}":
+                    if depth == 0:
+                        break
+                    depth -= 1
+                elif c == "," and depth == 0:
+                    args.append(current.strip())
+                    current = ""
+                    continue
+            current += c
+        args.append(current.strip())
+        calls.append(args)
+    return calls
+
+
+def literal(arg):
+    match = re.fullmatch(r'"((?:[^"\\]|\\.)*)"', arg)
+    return match.group(1) if match else None
+
+
+def scan_groups():
+    display = DISPLAY.read_text()
+    groups = {"titles": "", "values": "", "weekdays": "", "conditions": ""}
+
+    slides = SLIDES.read_text()
+    # { SLIDE_..., SLIDE_LAYOUT_..., "Title", icon, read, decimals, "unit", ... }
+    for title, unit in re.findall(r'\{\s*SLIDE_\w+,\s*SLIDE_LAYOUT_\w+,\s*"([^"]*)",[^"]*"([^"]*)"', slides):
+        groups["titles"] += title
+        groups["values"] += unit
+    groups["values"] += "".join(re.findall(r'NO_SLIDE_VALUE = "([^"]*)"', slides))
+
+    # Message slides: displaySlide("Error", "Load failed")
+    for args in call_arguments(display, "displaySlide"):
+        if len(args) >= 2:
+            groups["titles"] += literal(args[0]) or ""
+            groups["values"] += literal(args[1]) or ""
+    for args in call_arguments(display, "drawSlideTitle"):
+        groups["titles"] += literal(args[0]) or ""
+
+    weekdays = re.search(r"names\[\] = \{([^}]*)\}", display)
+    if weekdays:
+        groups["weekdays"] = "".join(string_literals(weekdays.group(1)))
+
+    conditions = CONDITIONS.read_text()
+    groups["conditions"] = "".join(re.findall(r'\{\s*\d+,\s*CONDITIONS_\w+,\s*"([^"]*)"', conditions))
+    groups["conditions"] += "".join(re.findall(r'UNKNOWN_CONDITION = "([^"]*)"', conditions))
+    return groups, call_arguments(display, "drawText")
+
+
+def symbol_for(name):
+    # InterRegular12pt -> Inter_Regular12pt, matching the fontconvert naming
+    return re.sub(r"^([A-Z][a-z]+)", r"\1_", name)
+
+
+def read_font(path):
+    text = path.read_text()
+    bitmap = re.search(r"Bitmaps\[\] PROGMEM = \{(.*?)\};", text, re.S)
+    glyphs = re.search(r"Glyphs\[\] PROGMEM = \{(.*?)\};", text, re.S)
+    header = re.search(r"(0x[0-9A-Fa-f]+),\s*(0x[0-9A-Fa-f]+),\s*(\d+)\s*\};", text)
+    if not (bitmap and glyphs and header):
+        raise ValueError("not a fontconvert GFXfont header")
+
+    data = bytes(int(b, 16) for b in re.findall(r"0x[0-9A-Fa-f]{2}", bitmap.group(1)))
+    entries = [tuple(int(v) for v in g) for g in
+               re.findall(r"\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", glyphs.group(1))]
+    return data, entries, int(header.group(1), 16), int(header.group(2), 16), int(header.group(3))
+
+
+def glyph_bits(data, offset, width, height):
+    count = width * height
+    return [(data[offset + i // 8] >> (7 - i % 8)) & 1 for i in range(count)]
+
+
+def pack_bits(bits):
+    out = bytearray((len(bits) + 7) // 8)
+    for i, bit in enumerate(bits):
+        if bit:
+            out[i // 8] |= 0x80 >> (i % 8)
+    return bytes(out)
+
+
+def pack_runs(bits):
+    nibbles = []
+    i = 0
+    ink = 0
+    while i < len(bits):
+        length = 0
+        while i < len(bits) and bits[i] == ink:
+            length += 1
+            i += 1
+        while length >= 15:
+            nibbles.append(15)
+            length -= 15
+        nibbles.append(length)
+        ink ^= 1
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes((nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2))
+
+
+def smooth_glyph(bits, width, height, scale):
+    """4-bit coverage (0-15) of every pixel of the glyph at `scale`, row by row."""
+    def at(column, row):
+        if 0 <= column < width and 0 <= row < height:
+            return bits[row * width + column]
+        return 0
+
+    coverage = []
+    for y in range(height * scale):
+        for x in range(width * scale):
+            inside = 0
+            for sy in range(SAMPLES):
+                v = (y + (sy + 0.5) / SAMPLES) / scale - 0.5
+                row = int(v // 1)
+                ty = v - row
+                for sx in range(SAMPLES):
+                    u = (x + (sx + 0.5) / SAMPLES) / scale - 0.5
+                    column = int(u // 1)
+                    tx = u - column
+                    top = at(column, row) * (1 - tx) + at(column + 1, row) * tx
+                    bottom = at(column, row + 1) * (1 - tx) + at(column + 1, row + 1) * tx
+                    if top * (1 - ty) + bottom * ty >= 0.5:
+                        inside += 1
+            coverage.append((inside * 15 + SAMPLES * SAMPLES // 2) // (SAMPLES * SAMPLES))
+    return coverage
+
+
+def pack_coverage(coverage):
+    """Nibble stream: 0 or 15 and a count nibble for 1-16 clear or solid pixels, 1-14 for one edge pixel."""
+    nibbles = []
+    i = 0
+    while i < len(coverage):
+        value = coverage[i]
+        if value in (0, 15):
+            length = 1
+            while i + length < len(coverage) and coverage[i + length] == value and length < 16:
+                length += 1
+            nibbles += [value, length - 1]
+            i += length
+        else:
+            nibbles.append(value)
+            i += 1
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes((nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2))
+
+
+def subset_font(name, chars, rle, scale=1):
+    data, glyphs, first, last, y_advance = read_font(SOURCES / f"{name}.h")
+    wanted = sorted({ord(c) for c in chars if first <= ord(c) <= last})
+    if not wanted:
+        raise ValueError("no characters to keep")
+
+    low, high = wanted[0], wanted[-1]
+    packed = bytearray()
+    entries = []
+    for code in wanted:
+        offset, width, height, advance, x_offset, y_offset = glyphs[code - first]
+        if width * height == 0:
+            entries.append((0, 0, 0, advance, 0, 0, code))
+            continue
+        bits = glyph_bits(data, offset, width, height)
+        entries.append((len(packed), width * scale, height * scale, advance * scale, x_offset * scale,
+                        y_offset * scale, code))
+        if scale > 1:
+            packed += pack_coverage(smooth_glyph(bits, width, height, scale))
+        else:
+            packed += pack_runs(bits) if rle else pack_bits(bits)
+    index = bytes(wanted.index(code) if code in wanted else MISSING for code in range(low, high + 1))
+
+    full = len(data) + GLYPH_SIZE * len(glyphs)
+    subset = len(packed) + GLYPH_SIZE * len(entries) + len(index)
+    return {"data": bytes(packed), "entries": entries, "index": index, "first": low, "last": high,
+            "yAdvance": y_advance * scale,
+            "kept": "".join(chr(c) for c in wanted), "full": full, "size": subset, "total": len(glyphs)}
+
+
+def write_font(name, font, encoding, source=None):
+    symbol = symbol_for(name)
+    kept = font["kept"].replace("\\", "\\\\")
+    lines = [
+        f"// {name}.h - Generated by scripts/font-subset.py from assets/fonts/{source or name}.h, do not edit",
+        f"// {len(font['kept'])} of {font['total']} glyphs: {kept}",
+        "#pragma once",
+        '#include "../PackedFont.h"',
+        "",
+        f"const uint8_t {symbol}Data[] PROGMEM = {{",
+    ]
+    data = font["data"]
+    for i in range(0, len(data), 12):
+        lines.append("  " + ", ".join(f"0x{b:02X}" for b in data[i:i + 12]) + ",")
+    lines += ["};", "", f"const PackedGlyph {symbol}Glyphs[] PROGMEM = {{"]
+    for offset, width, height, advance, x_offset, y_offset, code in font["entries"]:
+        shown = chr(code) if chr(code) != "\\" else "\\\\"
+        lines.append(f"  {{ {offset:5}, {width:3}, {height:3}, {advance:3}, {x_offset:4}, {y_offset:4} }}, // 0x{code:02X} '{shown}'")
+    lines += ["};", "", f"const uint8_t {symbol}Index[] PROGMEM = {{"]
+    index = font["index"]
+    for i in range(0, len(index), 12):
+        lines.append("  " + ", ".join(f"0x{b:02X}" for b in index[i:i + 12]) + ",")
+    lines += [
+        "};",
+        "",
+        f"const PackedFont {symbol} = {{ {symbol}Data, {symbol}Glyphs, {symbol}Index, 0x{font['first']:02X}, 0x{font['last']:02X}, "
+        f"{font['yAdvance']}, PackedFont::{encoding} }};",
+        "",
+    ]
+    (OUT / f"{name}.h").write_text("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Subset the Inter GFXfont headers to the characters the slides use")
+    parser.add_argument("--rle", action="store_true", help="store glyphs as nibble run lengths")
+    parser.add_argument("--chars", action="append", default=[], metavar="FONT=CHARS",
+                        help="use exactly these characters for FONT instead of scanning")
+    args = parser.parse_args()
+
+    overrides = dict(item.split("=", 1) for item in args.chars)
+    groups, draw_calls = scan_groups()
+
+    print(f"{'font':24} {'glyphs':>7} {'full':>7} {'subset':>7}  ratio")
+    for name, config in list(FONTS.items()) + list(SMOOTH_FONTS.items()):
+        if name in overrides:
+            chars = overrides[name]
+        else:
+            chars = config["extra"] + "".join(groups[g] for g in config["groups"])
+            chars += "".join(literal(a[3]) or "" for a in draw_calls if len(a) > 3 and a[0] == symbol_for(name))
+
+        source = config.get("source", name)
+        scale = config.get("scale", 1)
+        try:
+            font = subset_font(source, chars, args.rle, scale)
+        except (OSError, ValueError) as error:
+            print(f"{name}: {error}", file=sys.stderr)
+            return 1
+        encoding = "SMOOTH" if scale > 1 else "RLE" if args.rle else "BITS"
+        write_font(name, font, encoding, source)
+        print(f"{name:24} {len(font['kept']):3}/{font['total']:<3} {font['full']:7} {font['size']:7}  "
+              f"{font['full'] / font['size']:.1f}x")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
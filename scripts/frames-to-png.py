@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Convert slide frames dumped over Serial into PNG files.
+
+Define DISPLAY_DEBUG and set captureSlideFrames in today.ino, capture the serial output to a file, then:
+
+    ./frames-to-png.py capture.log frames/
+    ./frames-to-png.py capture.log frames/ --golden golden/
+
+Each FRAME block (see FrameBuffer::dump) becomes frames/slide-<n>.png. With --golden,
+every frame is compared with golden/slide-<n>.png and the script exits non-zero if any
+pixel differs.
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+
+def read_frames(path):
+    frames = {}
+    with open(path, errors="replace") as log:
+        lines = iter(log)
+        for line in lines:
+            if not line.startswith("FRAME "):
+                continue
+            _, index, width, height = line.split()
+            width, height = int(width), int(height)
+            rows = []
+            for _ in range(height):
+                row = next(lines).strip()
+                rows.append([int(row[i:i + 4], 16) for i in range(0, width * 4, 4)])
+            frames[int(index)] = (width, height, rows)
+    return frames
+
+
+def rgb565_to_rgb(pixel):
+    r = (pixel >> 11) & 0x1F
+    g = (pixel >> 5) & 0x3F
+    b = pixel & 0x1F
+    return (r * 255 + 15) // 31, (g * 255 + 31) // 63, (b * 255 + 15) // 31
+
+
+def png_chunk(kind, data):
+    chunk = kind + data
+    return struct.pack(">I", len(data)) + chunk + struct.pack(">I", zlib.crc32(chunk) & 0xFFFFFFFF)
+
+
+def write_png(path, width, height, rows):
+    raw = bytearray()
+    for row in rows:
+        raw.append(0)
+        for pixel in row:
+            raw.extend(rgb565_to_rgb(pixel))
+    with open(path, "wb") as png:
+        png.write(b"\x89PNG\r\n\x1a\n")
+        png.write(png_chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        png.write(png_chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        png.write(png_chunk(b"IEND", b""))
+
+
+def read_png(path):
+    """Read back an 8-bit RGB PNG as written by write_png."""
+    with open(path, "rb") as png:
+        data = png.read()
+    offset, width, height, idat = 8, 0, 0, b""
+    while offset < len(data):
+        length, kind = struct.unpack(">I4s", data[offset:offset + 8])
+        body = data[offset + 8:offset + 8 + length]
+        if kind == b"IHDR":
+            width, height = struct.unpack(">II", body[:8])
+        elif kind == b"IDAT":
+            idat += body
+        offset += 12 + length
+    raw = zlib.decompress(idat)
+    stride = width * 3 + 1
+    return width, height, [raw[y * stride + 1:(y + 1) * stride] for y in range(height)]
+
+
+def compare(frame, golden_path):
+    width, height, rows = frame
+    golden_width, golden_height, golden_rows = read_png(golden_path)
+    if (width, height) != (golden_width, golden_height):
+        return width * height
+    differing = 0
+    for row, golden_row in zip(rows, golden_rows):
+        for x, pixel in enumerate(row):
+            if bytes(rgb565_to_rgb(pixel)) != golden_row[x * 3:x * 3 + 3]:
+                differing += 1
+    return differing
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert dumped slide frames to PNG")
+    parser.add_argument("capture", help="serial output containing FRAME blocks")
+    parser.add_argument("output", help="directory for slide-<n>.png files")
+    parser.add_argument("--golden", help="directory of reference PNGs to compare against")
+    args = parser.parse_args()
+
+    frames = read_frames(args.capture)
+    if not frames:
+        print("No frames found in " + args.capture)
+        return 1
+
+    os.makedirs(args.output, exist_ok=True)
+    failed = False
+    for index, frame in sorted(frames.items()):
+        name = "slide-%d.png" % index
+        write_png(os.path.join(args.output, name), *frame)
+        status = ""
+        golden_path = os.path.join(args.golden, name) if args.golden else None
+        if golden_path and not os.path.exists(golden_path):
+            failed = True
+            status = "  no golden image"
+        elif golden_path:
+            differing = compare(frame, golden_path)
+            failed = failed or differing > 0
+            status = "  matches golden" if differing == 0 else "  %d pixels differ from golden" % differing
+        print(name + status)
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
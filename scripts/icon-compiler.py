@@ -0,0 +1,323 @@
+#!/usr/bin/env python3
+
+# Icon Compiler for Today
+# Turns PNG icon sources into flash-resident C++ headers (see today/lib/IconBitmap.h).
+# Each icon becomes an RGB565 palette of up to 15 colors plus one byte per pixel run,
+# so the sketch draws it by walking a table instead of running primitives every frame.
+#
+# Usage: ./icon-compiler.py [icon.png ...] [--out DIR]
+# With no sources, every PNG in assets/icons/ is compiled into today/lib/icons/, and
+# every directory under it into one atlas (see write_atlas()).
+# The center of the source image is the point the icon is drawn around.
+# Pixels with alpha below 128 are transparent; there is no blending.
+
+import argparse
+import struct
+import sys
+import zlib
+from collections import Counter
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+DEFAULT_SOURCES = ROOT / "assets" / "icons"
+DEFAULT_OUT = ROOT / "today" / "lib" / "icons"
+
+MAX_COLORS = 15   # Palette index 0 is reserved for transparent runs
+INLINE_RUN = 15   # Longer runs store their length in a second byte
+MAX_RUN = 255
+
+
+def read_png(path):
+    """Decode a non-interlaced 8-bit PNG into rows of (r, g, b, a) tuples."""
+    data = path.read_bytes()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("not a PNG file")
+
+    pos = 8
+    idat = b""
+    palette = []
+    alpha = []
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            alpha = list(body)
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    if depth != 8 or interlace != 0:
+        raise ValueError("only 8-bit, non-interlaced PNGs are supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(color_type)
+    if channels is None:
+        raise ValueError(f"unsupported PNG color type {color_type}")
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        line = bytearray(raw[start + 1:start + 1 + stride])
+        for i in range(stride):
+            left = line[i - channels] if i >= channels else 0
+            up = previous[i]
+            corner = previous[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (left + up) // 2) & 0xFF
+            elif kind == 4:
+                p = left + up - corner
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - corner)
+                predictor = left if pa <= pb and pa <= pc else (up if pb <= pc else corner)
+                line[i] = (line[i] + predictor) & 0xFF
+        previous = line
+
+        row = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if color_type == 0:
+                row.append((px[0], px[0], px[0], 255))
+            elif color_type == 2:
+                row.append((px[0], px[1], px[2], 255))
+            elif color_type == 3:
+                r, g, b = palette[px[0]]
+                row.append((r, g, b, alpha[px[0]] if px[0] < len(alpha) else 255))
+            elif color_type == 4:
+                row.append((px[0], px[0], px[0], px[1]))
+            else:
+                row.append(tuple(px))
+        rows.append(row)
+    return width, height, rows
+
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def build_palette(pixels, name):
+    """Pick up to MAX_COLORS colors; extra colors map to their nearest palette entry."""
+    counts = Counter(p for p in pixels if p is not None)
+    palette = [color for color, _ in counts.most_common(MAX_COLORS)]
+    if len(counts) > MAX_COLORS:
+        print(f"  {name}: {len(counts)} colors, reduced to the {MAX_COLORS} most used", file=sys.stderr)
+
+    def expand(c):
+        return ((c >> 11) & 31) << 3, ((c >> 5) & 63) << 2, (c & 31) << 3
+
+    lookup = {}
+    for color in counts:
+        if color in palette:
+            lookup[color] = palette.index(color)
+            continue
+        r, g, b = expand(color)
+        lookup[color] = min(range(len(palette)),
+                            key=lambda i: sum((a - e) ** 2 for a, e in zip((r, g, b), expand(palette[i]))))
+    return palette, lookup
+
+
+def load_icon(path):
+    """Read a PNG, trim transparent borders and return its RGB565 pixels (None = transparent)."""
+    width, height, rows = read_png(path)
+    pixels = [[rgb565(r, g, b) if a >= 128 else None for r, g, b, a in row] for row in rows]
+
+    # Trim transparent borders; offsets stay relative to the source image's center
+    opaque = [(x, y) for y in range(height) for x in range(width) if pixels[y][x] is not None]
+    if not opaque:
+        raise ValueError("icon is fully transparent")
+    left = min(x for x, _ in opaque)
+    right = max(x for x, _ in opaque) + 1
+    top = min(y for _, y in opaque)
+    bottom = max(y for _, y in opaque) + 1
+
+    return {
+        "pixels": [row[left:right] for row in pixels[top:bottom]],
+        "width": right - left,
+        "height": bottom - top,
+        "offsetX": left - width // 2,
+        "offsetY": top - height // 2,
+    }
+
+
+def encode_runs(icon, lookup):
+    runs = bytearray()
+    for row in icon["pixels"]:
+        x = 0
+        while x < len(row):
+            color = row[x]
+            length = 1
+            while x + length < len(row) and length < MAX_RUN and row[x + length] == color:
+                length += 1
+            index = 0 if color is None else lookup[color] + 1
+            if length <= INLINE_RUN:
+                runs.append((index << 4) | length)
+            else:
+                runs += bytes([index << 4, length])
+            x += length
+    return bytes(runs)
+
+
+def compile_icon(path):
+    icon = load_icon(path)
+    icon["palette"], lookup = build_palette([p for row in icon["pixels"] for p in row], path.stem)
+    icon["runs"] = encode_runs(icon, lookup)
+    return icon
+
+
+def symbol_for(path):
+    return "Icon" + "".join(part.capitalize() for part in path.stem.replace("-", "_").split("_"))
+
+
+def write_header(out_dir, path, icon):
+    symbol = symbol_for(path)
+    source = path.relative_to(ROOT) if path.is_relative_to(ROOT) else path.name
+    lines = [
+        f"// {symbol}.h - Generated by scripts/icon-compiler.py from {source}, do not edit",
+        "#pragma once",
+        '#include "../IconBitmap.h"',
+        "",
+        f"// {icon['width']}x{icon['height']}, {len(icon['palette'])} colors, {len(icon['runs'])} bytes of runs",
+        f"const uint16_t {symbol}Palette[] PROGMEM = {{",
+        "  " + ", ".join(f"0x{c:04X}" for c in icon["palette"]),
+        "};",
+        "",
+        f"const uint8_t {symbol}Runs[] PROGMEM = {{",
+    ]
+    runs = icon["runs"]
+    for i in range(0, len(runs), 16):
+        lines.append("  " + ", ".join(f"0x{b:02X}" for b in runs[i:i + 16]) + ",")
+    lines += [
+        "};",
+        "",
+        f"const IconBitmap {symbol} = {{ {symbol}Palette, {symbol}Runs, {len(icon['palette'])}, sizeof({symbol}Runs), "
+        f"{icon['width']}, {icon['height']}, {icon['offsetX']}, {icon['offsetY']} }};",
+        "",
+    ]
+    (out_dir / f"{symbol}.h").write_text("\n".join(lines))
+    return symbol
+
+
+def write_atlas(out_dir, directory):
+    """Pack every size set of an icon family into one header.
+
+    Each subdirectory of `directory` is a size set (e.g. large/, small/) holding the same
+    file names. All icons share one palette and one run array; every set gets an
+    IconBitmap table indexed by a generated enum, so one icon ID works at any size.
+    """
+    family = "".join(part.capitalize() for part in directory.name.replace("-", "_").split("_"))
+    symbol = family + "Atlas"
+    sets = sorted(d for d in directory.iterdir() if d.is_dir())
+    if not sets:
+        raise ValueError("atlas has no size directories")
+    names = sorted(p.stem for p in sets[0].glob("*.png"))
+    for size in sets:
+        if sorted(p.stem for p in size.glob("*.png")) != names:
+            raise ValueError(f"{size.name}/ does not hold the same icons as {sets[0].name}/")
+
+    icons = {size.name: [load_icon(size / f"{name}.png") for name in names] for size in sets}
+    pixels = [p for entries in icons.values() for icon in entries for row in icon["pixels"] for p in row]
+    palette, lookup = build_palette(pixels, directory.name)
+
+    runs = bytearray()
+    tables = []
+    for size in sets:
+        entries = []
+        for name, icon in zip(names, icons[size.name]):
+            encoded = encode_runs(icon, lookup)
+            entries.append((name, len(runs), len(encoded), icon))
+            runs += encoded
+        tables.append((size.name, entries))
+
+    prefix = directory.name.upper().replace("-", "_")
+    enum = [f"  {prefix}_{name.upper().replace('-', '_')}," for name in names]
+    source = directory.relative_to(ROOT) if directory.is_relative_to(ROOT) else directory.name
+    lines = [
+        f"// {symbol}.h - Generated by scripts/icon-compiler.py from {source}/, do not edit",
+        "#pragma once",
+        '#include "../IconBitmap.h"',
+        "",
+        f"enum {family}Icon {{",
+        *enum,
+        f"  {prefix}_COUNT",
+        "};",
+        "",
+        f"// {len(names)} icons in {len(sets)} sizes, {len(palette)} colors, {len(runs)} bytes of runs",
+        f"const uint16_t {symbol}Palette[] PROGMEM = {{",
+        "  " + ", ".join(f"0x{c:04X}" for c in palette),
+        "};",
+        "",
+        f"const uint8_t {symbol}Runs[] PROGMEM = {{",
+    ]
+    for i in range(0, len(runs), 16):
+        lines.append("  " + ", ".join(f"0x{b:02X}" for b in runs[i:i + 16]) + ",")
+    lines.append("};")
+
+    for size, entries in tables:
+        lines += ["", f"const IconBitmap {symbol}{size.capitalize()}[{prefix}_COUNT] = {{"]
+        for name, offset, length, icon in entries:
+            lines.append(f"  {{ {symbol}Palette, {symbol}Runs + {offset}, {len(palette)}, {length}, {icon['width']}, "
+                         f"{icon['height']}, {icon['offsetX']}, {icon['offsetY']} }}, // {name}")
+        lines.append("};")
+
+    (out_dir / f"{symbol}.h").write_text("\n".join(lines) + "\n")
+    size = len(runs) + 2 * len(palette)
+    print(f"{directory.name + '/':20} {len(names)} icons x {len(sets)} sizes {len(palette):2} colors {size:6} bytes")
+    return symbol, size
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile PNG icons into flash-resident RLE headers")
+    parser.add_argument("sources", nargs="*", type=Path, help="PNG files (default: assets/icons/*.png)")
+    parser.add_argument("--out", type=Path, default=DEFAULT_OUT, help="output directory (default: today/lib/icons)")
+    args = parser.parse_args()
+
+    sources = [p.resolve() for p in args.sources] or sorted(DEFAULT_SOURCES.glob("*.png"))
+    atlases = [] if args.sources else sorted(d for d in DEFAULT_SOURCES.iterdir() if d.is_dir())
+    if not sources and not atlases:
+        print("No icon sources found", file=sys.stderr)
+        return 1
+
+    args.out.mkdir(parents=True, exist_ok=True)
+    symbols = []
+    total = 0
+    for path in sources:
+        try:
+            icon = compile_icon(path)
+        except (OSError, ValueError) as error:
+            print(f"{path.name}: {error}", file=sys.stderr)
+            return 1
+        symbols.append(write_header(args.out, path, icon))
+        size = len(icon["runs"]) + 2 * len(icon["palette"])
+        total += size
+        print(f"{path.name:20} {icon['width']:4}x{icon['height']:<4} {len(icon['palette']):2} colors {size:6} bytes")
+
+    for directory in atlases:
+        try:
+            symbol, size = write_atlas(args.out, directory)
+        except (OSError, ValueError) as error:
+            print(f"{directory.name}/: {error}", file=sys.stderr)
+            return 1
+        symbols.append(symbol)
+        total += size
+
+    # One header to include them all
+    index = ["// Icons.h - Generated by scripts/icon-compiler.py, do not edit", "#pragma once"]
+    index += [f'#include "{symbol}.h"' for symbol in sorted(symbols)]
+    (args.out / "Icons.h").write_text("\n".join(index) + "\n")
+
+    print(f"{len(symbols)} icons, {total} bytes of flash")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,58 @@
+#!/bin/bash
+
+# Payload Size Comparison
+# Trims the captured tomorrow.io examples down to the fields the sketch requests
+# (read from the FieldBinding tables in WeatherRealtime.h and WeatherForecast.h)
+# and compares the byte counts against the full default responses.
+
+SCRIPT_DIR="$(dirname "$(realpath "$0")")"
+PROJECT_DIR="$SCRIPT_DIR/.."
+
+if ! command -v python3 &> /dev/null; then
+    echo "Error: python3 not found!"
+    exit 1
+fi
+
+echo "=== tomorrow.io Payload Size ==="
+echo
+
+python3 - "$PROJECT_DIR" <<'EOF'
+import json
+import re
+import sys
+
+project = sys.argv[1]
+
+def field_table(header, table):
+    source = open(f"{project}/today/lib/{header}").read()
+    body = re.search(table + r"\[\] = \{(.*?)\n\};", source, re.S).group(1)
+    return re.findall(r'\{ "(\w+)", &', body)
+
+def compact(document):
+    return len(json.dumps(document, separators=(",", ":")).encode())
+
+def keep_values(entry, fields):
+    trimmed = dict(entry)
+    trimmed["values"] = {k: v for k, v in entry["values"].items() if k in fields}
+    return trimmed
+
+realtime_fields = field_table("WeatherRealtime.h", "REALTIME_FIELDS")
+daily_fields = field_table("WeatherForecast.h", "DAILY_FIELDS")
+timeline_fields = field_table("WeatherForecast.h", "TIMELINE_FIELDS")
+
+realtime = json.load(open(f"{project}/examples/realtime.json"))
+realtime_trimmed = dict(realtime)
+realtime_trimmed["data"] = keep_values(realtime["data"], realtime_fields)
+
+forecast = json.load(open(f"{project}/examples/forecast.json"))
+forecast_trimmed = dict(forecast)
+forecast_trimmed["timelines"] = {
+    name: [keep_values(entry, daily_fields if name == "daily" else timeline_fields) for entry in entries]
+    for name, entries in forecast["timelines"].items()
+}
+
+print(f"{'request':<10} {'default':>10} {'trimmed':>10} {'ratio':>7}")
+for name, full, trimmed in (("realtime", realtime, realtime_trimmed), ("forecast", forecast, forecast_trimmed)):
+    before, after = compact(full), compact(trimmed)
+    print(f"{name:<10} {before:>10} {after:>10} {before / after:>6.1f}x")
+EOF
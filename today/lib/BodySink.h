@@ -0,0 +1,20 @@
+// BodySink.h - Destination for response bodies pushed in fixed-size chunks
+#pragma once
+#include <stddef.h>
+
+class BodySink {
+public:
+  virtual ~BodySink() {}
+
+  // Consume the next chunk; the buffer is reused by the caller after this returns.
+  // Returning false aborts the transfer.
+  virtual bool write(const char* data, size_t length) = 0;
+
+  // Called once the transfer ends; returns whether the body was complete and valid
+  virtual bool finish() = 0;
+
+  // Lets the reader stop early once the sink has everything it needs
+  virtual bool isComplete() const {
+    return false;
+  }
+};
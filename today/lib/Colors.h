@@ -0,0 +1,77 @@
+// Colors.h - 16-bit (565) RGB color definitions shared by the display code
+#pragma once
+
+// Basic Colors
+#define BLACK 0x0000
+#define WHITE 0xFFFF
+#define RED 0xF800
+#define GREEN 0x07E0
+#define BLUE 0x001F
+#define CYAN 0x07FF
+#define MAGENTA 0xF81F
+#define YELLOW 0xFFE0
+
+// Grayscale Colors
+#define DARK_GRAY 0x2104
+#define GRAY 0x4208
+#define LIGHT_GRAY 0x630C
+#define SILVER 0x7BEF
+#define LIGHT_SILVER 0x9CF3
+
+// Red Variants
+#define DARK_RED 0x8800
+#define RED_ORANGE 0xC800
+#define LIGHT_RED 0xF8C0
+#define BRIGHT_RED 0xFC00
+
+// Green Variants
+#define DARK_GREEN 0x0400
+#define FOREST_GREEN 0x0600
+#define LIGHT_GREEN 0x87E0
+#define LIME_GREEN 0xAFE0
+
+// Blue Variants
+#define DARK_BLUE 0x0010
+#define NAVY_BLUE 0x0015
+#define LIGHT_BLUE 0x841F
+#define SKY_BLUE 0xC61F
+
+// Orange/Brown Colors
+#define ORANGE 0xFD20
+#define DARK_ORANGE 0xFC00
+#define LIGHT_ORANGE 0xFBE0
+#define BROWN 0xA145
+#define LIGHT_BROWN 0xD343
+
+// Purple/Violet Colors
+#define PURPLE 0x780F
+#define DARK_PURPLE 0xA817
+#define LIGHT_MAGENTA 0xFC1F
+#define DARK_VIOLET 0x8010
+
+// Pink Colors
+#define PINK 0xFC9F
+#define LIGHT_PINK 0xFE19
+#define PALE_PINK 0xFDF9
+
+// Nature Colors
+#define OLIVE 0x2589
+#define DARK_OLIVE 0x4D69
+#define KHAKI 0x6D2D
+#define SEA_GREEN 0x3C69
+#define DARK_SEA_GREEN 0x5D8A
+
+// Weather App Utility Colors
+#define MIDNIGHT_BLUE 0x051D
+#define DEEP_SKY_BLUE 0x3C9F
+#define CLOUD_GRAY 0x39E7
+#define SUN_YELLOW 0xFEA0
+#define STORM_GRAY 0x4208
+
+// Pool/Water Colors
+#define TURQUOISE 0x4F9B
+#define TEAL 0x2B5A
+#define STEEL_BLUE 0x4C9F
+#define DARK_SLATE_BLUE 0x2B75
+#define WARM_ORANGE 0xFD00
+#define FOG_GRAY 0x8C51
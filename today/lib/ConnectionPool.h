@@ -0,0 +1,172 @@
+// ConnectionPool.h - Process-wide keep-alive TLS connections keyed by host:port and connect mode
+#pragma once
+#include <WiFi.h>
+#include "Logger.h"
+
+// How a socket is opened: WiFiSSLClient's default connect() or its explicit connectSSL().
+// Some servers only complete the handshake one way, so callers pick per host.
+enum class TlsConnect {
+  Default,
+  ConnectSSL
+};
+
+class ConnectionPool {
+private:
+  static const int MAX_CONNECTIONS = 3;
+
+  struct Slot {
+    WiFiSSLClient client;
+    String host;
+    int port;
+    TlsConnect mode;
+    bool inUse;
+    unsigned long lastUsedTime;
+  };
+
+  static Slot slots[MAX_CONNECTIONS];
+  static unsigned long idleTimeoutMs;
+  static unsigned long handshakeCount;
+  static unsigned long reuseCount;
+
+public:
+  static void setIdleTimeout(unsigned long timeoutMs) {
+    idleTimeoutMs = timeoutMs;
+  }
+
+  // Hand out a connected client for host:port, reusing a live idle socket opened the same
+  // way when one exists. Returns nullptr if no connection could be made. `reused` reports
+  // whether the socket was already open, so callers can retry once on a fresh one if the
+  // peer had gone away.
+  static WiFiSSLClient* acquire(const String& host, int port, TlsConnect mode, bool& reused) {
+    evictIdle();
+    reused = false;
+
+    for (int i = 0; i < MAX_CONNECTIONS; i++) {
+      Slot& slot = slots[i];
+      if (slot.inUse || slot.port != port || slot.mode != mode || slot.host != host) {
+        continue;
+      }
+
+      // Unsolicited bytes on an idle socket mean the server closed or errored it
+      if (slot.client.connected() && slot.client.available() == 0) {
+        slot.inUse = true;
+        reused = true;
+        reuseCount++;
+        return &slot.client;
+      }
+
+      close(slot);
+    }
+
+    Slot* slot = findFreeSlot();
+    if (slot == nullptr) {
+      Logger::log("No free connection slot for " + host);
+      return nullptr;
+    }
+
+    if (!connect(*slot, host, port, mode)) {
+      return nullptr;
+    }
+
+    slot->inUse = true;
+    return &slot->client;
+  }
+
+  // Return a client after a request; keepAlive=false closes it
+  static void release(WiFiSSLClient* client, bool keepAlive) {
+    Slot* slot = findSlot(client);
+    if (slot == nullptr) {
+      return;
+    }
+
+    slot->inUse = false;
+    slot->lastUsedTime = millis();
+    if (!keepAlive || !slot->client.connected()) {
+      close(*slot);
+    }
+  }
+
+  // Close sockets that have sat unused longer than the idle timeout
+  static void evictIdle() {
+    unsigned long now = millis();
+    for (int i = 0; i < MAX_CONNECTIONS; i++) {
+      Slot& slot = slots[i];
+      if (!slot.inUse && slot.host.length() > 0 && now - slot.lastUsedTime > idleTimeoutMs) {
+        Logger::log("Closing idle connection to " + slot.host);
+        close(slot);
+      }
+    }
+  }
+
+  static unsigned long getHandshakeCount() {
+    return handshakeCount;
+  }
+
+  static unsigned long getReuseCount() {
+    return reuseCount;
+  }
+
+private:
+  static bool connect(Slot& slot, const String& host, int port, TlsConnect mode) {
+    bool connected = mode == TlsConnect::ConnectSSL ?
+      slot.client.connectSSL(host.c_str(), port) :
+      slot.client.connect(host.c_str(), port);
+
+    handshakeCount++;
+    if (!connected) {
+      slot.client.stop();
+      return false;
+    }
+
+    slot.host = host;
+    slot.port = port;
+    slot.mode = mode;
+    slot.lastUsedTime = millis();
+    Logger::log("TLS handshake #" + String(handshakeCount) + " to " + host);
+    return true;
+  }
+
+  static void close(Slot& slot) {
+    slot.client.stop();
+    slot.host = "";
+    slot.port = 0;
+    slot.inUse = false;
+  }
+
+  static Slot* findFreeSlot() {
+    Slot* oldestIdle = nullptr;
+    for (int i = 0; i < MAX_CONNECTIONS; i++) {
+      Slot& slot = slots[i];
+      if (slot.inUse) {
+        continue;
+      }
+      if (slot.host.length() == 0) {
+        return &slot;
+      }
+      if (oldestIdle == nullptr || slot.lastUsedTime < oldestIdle->lastUsedTime) {
+        oldestIdle = &slot;
+      }
+    }
+
+    // All slots hold idle sockets to other hosts: recycle the least recently used
+    if (oldestIdle != nullptr) {
+      close(*oldestIdle);
+    }
+    return oldestIdle;
+  }
+
+  static Slot* findSlot(WiFiSSLClient* client) {
+    for (int i = 0; i < MAX_CONNECTIONS; i++) {
+      if (&slots[i].client == client) {
+        return &slots[i];
+      }
+    }
+    return nullptr;
+  }
+};
+
+// Static member definitions
+ConnectionPool::Slot ConnectionPool::slots[ConnectionPool::MAX_CONNECTIONS];
+unsigned long ConnectionPool::idleTimeoutMs = 30000;
+unsigned long ConnectionPool::handshakeCount = 0;
+unsigned long ConnectionPool::reuseCount = 0;
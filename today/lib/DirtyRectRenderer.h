@@ -0,0 +1,125 @@
+// DirtyRectRenderer.h - Pushes only the pixels that changed between frames to the panel
+#pragma once
+#include <Arduino.h>
+#include "Arduino_GigaDisplay_GFX.h"
+#include "Logger.h"
+#include "FrameBuffer.h"
+
+// Frames are drawn into a back buffer, then compared with a copy of what the panel
+// currently shows. Only row spans that differ are sent to the panel.
+//
+// The comparison is limited to damage rectangles: the elements of this frame and of the
+// previous one (title, icon, value...). If the clear color is unchanged, the background
+// between elements cannot have changed and is skipped entirely. A changed clear color,
+// or anything drawn straight to the panel (invalidate()), damages the whole screen.
+class DirtyRectRenderer {
+private:
+  FrameBuffer back;
+  FrameBuffer front;
+  bool frontValid;
+  uint16_t frontClearColor;
+  FrameRect previousElements[FrameBuffer::MAX_ELEMENTS];
+  int previousElementCount;
+  unsigned long pixelsPushed;
+
+public:
+  DirtyRectRenderer(int16_t width, int16_t height)
+    : back(width, height), front(width, height), frontValid(false), frontClearColor(0), previousElementCount(0),
+    pixelsPushed(0) {
+  }
+
+  bool isValid() const {
+    return back.isValid() && front.isValid();
+  }
+
+  // The panel no longer matches the front copy; the next frame is pushed in full
+  void invalidate() {
+    frontValid = false;
+  }
+
+  // Surface to draw the next frame into
+  FrameBuffer& beginFrame() {
+    back.beginFrame();
+    back.resetStats();
+    return back;
+  }
+
+  // Separates the frame's elements for damage tracking
+  void closeElement() {
+    back.closeElement();
+  }
+
+  // Send the differences between the back buffer and the panel. With DISPLAY_DEBUG, log how
+  // much of the panel was written compared with a full-screen clear.
+  void present(Adafruit_GFX& panel) {
+    back.closeElement();
+    pixelsPushed = 0;
+#if defined(DISPLAY_DEBUG)
+    unsigned long startTime = micros();
+#endif
+
+    FrameRect full = { 0, 0, back.width(), back.height() };
+    if (!frontValid || !back.wasCleared() || back.getClearColor() != frontClearColor) {
+      pushChanges(panel, full);
+    }
+    else {
+      for (int i = 0; i < back.getElementCount(); i++) {
+        pushChanges(panel, back.getElement(i));
+      }
+      for (int i = 0; i < previousElementCount; i++) {
+        pushChanges(panel, previousElements[i]);
+      }
+    }
+
+    frontValid = true;
+    frontClearColor = back.getClearColor();
+    previousElementCount = back.getElementCount();
+    for (int i = 0; i < previousElementCount; i++) {
+      previousElements[i] = back.getElement(i);
+    }
+
+#if defined(DISPLAY_DEBUG)
+    unsigned long framePixels = (unsigned long)back.width() * back.height();
+    Logger::log("Frame presented: " + String(pixelsPushed) + " pixels pushed (" +
+      String(100.0f * pixelsPushed / framePixels, 1) + "% of a full clear) in " + String(micros() - startTime) + " us");
+#endif
+  }
+
+  unsigned long getPixelsPushed() const {
+    return pixelsPushed;
+  }
+
+private:
+  // Compare one rectangle row by row and push each run of changed pixels as a single bitmap span
+  void pushChanges(Adafruit_GFX& panel, const FrameRect& rect) {
+    int16_t width = back.width();
+    uint16_t* backPixels = back.getBuffer();
+    uint16_t* frontPixels = front.getBuffer();
+
+    int16_t left = rect.x < 0 ? 0 : rect.x;
+    int16_t top = rect.y < 0 ? 0 : rect.y;
+    int16_t right = rect.x + rect.w > width ? width : rect.x + rect.w;
+    int16_t bottom = rect.y + rect.h > back.height() ? back.height() : rect.y + rect.h;
+
+    for (int16_t y = top; y < bottom; y++) {
+      uint16_t* backRow = backPixels + (int32_t)y * width;
+      uint16_t* frontRow = frontPixels + (int32_t)y * width;
+
+      int16_t x = left;
+      while (x < right) {
+        if (frontValid && backRow[x] == frontRow[x]) {
+          x++;
+          continue;
+        }
+
+        int16_t runStart = x;
+        while (x < right && (!frontValid || backRow[x] != frontRow[x])) {
+          frontRow[x] = backRow[x];
+          x++;
+        }
+        panel.drawRGBBitmap(runStart, y, backRow + runStart, x - runStart, 1);
+        pixelsPushed += x - runStart;
+      }
+    }
+  }
+};
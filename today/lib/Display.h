@@ -8,90 +8,31 @@
 #include <Arduino_GigaDisplay.h>
 #include "Arduino_GigaDisplay_GFX.h"
 #include "Arduino_GigaDisplayTouch.h"
+#include "Colors.h"
+#include "Slides.h"
 #include "WeatherIcons.h"
+#include "WeatherConditions.h"
+#include "FrameBuffer.h"
+#include "DirtyRectRenderer.h"
+#include "PackedFont.h"
+#include "TextRunCache.h"
+#include "SnapshotStore.h"
+#include "./icons/Icons.h"
 #include "./fonts/InterBold18pt.h"
 #include "./fonts/InterMedium24pt.h"
+#include "./fonts/InterMedium24ptSmooth.h"
 #include "./fonts/InterRegular12pt.h"
 
-// Color definitions for 16-bit (565) RGB
-// Basic Colors
-#define BLACK 0x0000
-#define WHITE 0xFFFF
-#define RED 0xF800
-#define GREEN 0x07E0
-#define BLUE 0x001F
-#define CYAN 0x07FF
-#define MAGENTA 0xF81F
-#define YELLOW 0xFFE0
-
-// Grayscale Colors
-#define DARK_GRAY 0x2104
-#define GRAY 0x4208
-#define LIGHT_GRAY 0x630C
-#define SILVER 0x7BEF
-#define LIGHT_SILVER 0x9CF3
-
-// Red Variants
-#define DARK_RED 0x8800
-#define RED_ORANGE 0xC800
-#define LIGHT_RED 0xF8C0
-#define BRIGHT_RED 0xFC00
-
-// Green Variants
-#define DARK_GREEN 0x0400
-#define FOREST_GREEN 0x0600
-#define LIGHT_GREEN 0x87E0
-#define LIME_GREEN 0xAFE0
-
-// Blue Variants
-#define DARK_BLUE 0x0010
-#define NAVY_BLUE 0x0015
-#define LIGHT_BLUE 0x841F
-#define SKY_BLUE 0xC61F
-
-// Orange/Brown Colors
-#define ORANGE 0xFD20
-#define DARK_ORANGE 0xFC00
-#define LIGHT_ORANGE 0xFBE0
-#define BROWN 0xA145
-#define LIGHT_BROWN 0xD343
-
-// Purple/Violet Colors
-#define PURPLE 0x780F
-#define DARK_PURPLE 0xA817
-#define LIGHT_MAGENTA 0xFC1F
-#define DARK_VIOLET 0x8010
-
-// Pink Colors
-#define PINK 0xFC9F
-#define LIGHT_PINK 0xFE19
-#define PALE_PINK 0xFDF9
-
-// Nature Colors
-#define OLIVE 0x2589
-#define DARK_OLIVE 0x4D69
-#define KHAKI 0x6D2D
-#define SEA_GREEN 0x3C69
-#define DARK_SEA_GREEN 0x5D8A
-
-// Weather App Utility Colors
-#define MIDNIGHT_BLUE 0x051D
-#define DEEP_SKY_BLUE 0x3C9F
-#define CLOUD_GRAY 0x39E7
-#define SUN_YELLOW 0xFEA0
-#define STORM_GRAY 0x4208
-
-// Pool/Water Colors
-#define TURQUOISE 0x4F9B
-#define TEAL 0x2B5A
-#define STEEL_BLUE 0x4C9F
-#define DARK_SLATE_BLUE 0x2B75
-#define WARM_ORANGE 0xFD00
-#define FOG_GRAY 0x8C51
-
 class Display {
 private:
   static GigaDisplay_GFX display;
+  static Adafruit_GFX* target;                        // Surface all drawing goes to: the panel or a FrameBuffer
+  static FrameBuffer* targetFrame;                    // target when it is a FrameBuffer, for direct pixel copies
+  static DirtyRectRenderer* dirtyRenderer;            // When set, slides are diffed and only changes reach the panel
+  static int preparedSlide;                           // Slide already drawn into the renderer's back buffer, or -1
+  static uint32_t preparedGeneration;                 // snapshots.getGeneration() it was drawn from
+  static unsigned long preparedAt;                    // millis() when it was drawn
+  static unsigned long prepareUs;                     // How long drawing it took
   static Arduino_GigaDisplayTouch touch;
   static GigaDisplayBacklight backlight;
   static int currentY;
@@ -107,9 +48,20 @@ private:
   static unsigned long lastSlideChange;
   static int currentSlide;
   static const unsigned long slideDuration = 7000;
-  static const int totalSlides = 6;
-  static RealtimeWeatherData currentWeatherData;
+  static const int conditionsIconX = 250;  // Conditions slide: large icon center, forecast column
+  static const int forecastX = 580;
+  static const int forecastTop = 130;
+  static const int forecastRowHeight = 48;
+  static RealtimeWeatherData currentWeatherData; // Working copies of the snapshots, for drawing
   static PoolTemperatureData currentPoolData;
+  static ForecastData currentForecastData;
+  static WeatherSnapshots snapshots; // Versioned; readable from other threads
+  static const IconBitmap* const compiledIcons[ICON_COUNT]; // Slide icons (SlideIcon), from assets/icons/
+  static TextRunCache valueRuns; // Anti-aliased slide values, reused while they are unchanged
+  static SlideDisplayList slideLists[SLIDE_COUNT];
+
+  static bool showingCachedData;      // Slides show the warm-start snapshot until fresh data arrives
+  static unsigned long firstFrameTime;
 
 private:
   static void drawWeatherIcon(int centerX, int centerY) {
@@ -119,227 +71,140 @@ private:
     int sunRadius = 25;
 
     // Sun body
-    display.fillCircle(sunX, sunY, sunRadius, YELLOW);
+    target->fillCircle(sunX, sunY, sunRadius, YELLOW);
 
     // Sun rays
     int rayLength = 15;
     int rayDistance = sunRadius + 5;
 
     // Vertical rays
-    display.drawLine(sunX, sunY - rayDistance, sunX, sunY - rayDistance - rayLength, YELLOW);
-    display.drawLine(sunX, sunY + rayDistance, sunX, sunY + rayDistance + rayLength, YELLOW);
+    target->drawLine(sunX, sunY - rayDistance, sunX, sunY - rayDistance - rayLength, YELLOW);
+    target->drawLine(sunX, sunY + rayDistance, sunX, sunY + rayDistance + rayLength, YELLOW);
 
     // Horizontal rays
-    display.drawLine(sunX - rayDistance, sunY, sunX - rayDistance - rayLength, sunY, YELLOW);
-    display.drawLine(sunX + rayDistance, sunY, sunX + rayDistance + rayLength, sunY, YELLOW);
+    target->drawLine(sunX - rayDistance, sunY, sunX - rayDistance - rayLength, sunY, YELLOW);
+    target->drawLine(sunX + rayDistance, sunY, sunX + rayDistance + rayLength, sunY, YELLOW);
 
     // Diagonal rays
-    display.drawLine(sunX + 18, sunY - 18, sunX + 18 + 12, sunY - 18 - 12, YELLOW);
-    display.drawLine(sunX - 18, sunY - 18, sunX - 18 - 12, sunY - 18 - 12, YELLOW);
-    display.drawLine(sunX + 18, sunY + 18, sunX + 18 + 12, sunY + 18 + 12, YELLOW);
-    display.drawLine(sunX - 18, sunY + 18, sunX - 18 - 12, sunY + 18 + 12, YELLOW);
+    target->drawLine(sunX + 18, sunY - 18, sunX + 18 + 12, sunY - 18 - 12, YELLOW);
+    target->drawLine(sunX - 18, sunY - 18, sunX - 18 - 12, sunY - 18 - 12, YELLOW);
+    target->drawLine(sunX + 18, sunY + 18, sunX + 18 + 12, sunY + 18 + 12, YELLOW);
+    target->drawLine(sunX - 18, sunY + 18, sunX - 18 - 12, sunY + 18 + 12, YELLOW);
 
     // Draw cloud (white/gray overlapping circles)
     int cloudX = centerX + 15;
     int cloudY = centerY + 10;
 
     // Draw light grey stroke outlines first (unfilled circles)
-    display.drawCircle(cloudX - 16, cloudY - 1, 19, DEEP_SKY_BLUE); // Left circle outline
-    display.drawCircle(cloudX - 1, cloudY - 9, 23, DEEP_SKY_BLUE);  // Center circle outline
-    display.drawCircle(cloudX + 16, cloudY - 1, 19, DEEP_SKY_BLUE); // Right circle outline
-    display.drawCircle(cloudX + 26, cloudY + 6, 16, DEEP_SKY_BLUE); // Right extension outline
+    target->drawCircle(cloudX - 16, cloudY - 1, 19, DEEP_SKY_BLUE); // Left circle outline
+    target->drawCircle(cloudX - 1, cloudY - 9, 23, DEEP_SKY_BLUE);  // Center circle outline
+    target->drawCircle(cloudX + 16, cloudY - 1, 19, DEEP_SKY_BLUE); // Right circle outline
+    target->drawCircle(cloudX + 26, cloudY + 6, 16, DEEP_SKY_BLUE); // Right extension outline
 
     // Cloud circles (create puffy cloud shape) - filled white circles on top
-    display.fillCircle(cloudX - 15, cloudY, 18, WHITE);     // Left circle
-    display.fillCircle(cloudX, cloudY - 8, 22, WHITE);      // Center circle
-    display.fillCircle(cloudX + 15, cloudY, 18, WHITE);     // Right circle
-    display.fillCircle(cloudX + 25, cloudY + 5, 15, WHITE); // Right extension
+    target->fillCircle(cloudX - 15, cloudY, 18, WHITE);     // Left circle
+    target->fillCircle(cloudX, cloudY - 8, 22, WHITE);      // Center circle
+    target->fillCircle(cloudX + 15, cloudY, 18, WHITE);     // Right circle
+    target->fillCircle(cloudX + 25, cloudY + 5, 15, WHITE); // Right extension
 
     // Add text
-    display.setTextSize(3);
-    display.setTextColor(WHITE);
+    target->setTextSize(3);
+    target->setTextColor(WHITE);
 
     int textX = centerX - 45;
     int textY = centerY + 70;
 
-    display.setCursor(textX, textY);
-    display.print("TODAY");
+    target->setCursor(textX, textY);
+    target->print("TODAY");
 
     resetTextSize();
   }
 
-  // Icon drawing functions for different weather parameters
-  static void drawTemperatureIcon(int centerX, int centerY) {
-    // Draw a thermometer (tripled size - doubled + 50%)
-    int thermX = centerX;
-    int thermY = centerY;
-
-    // Thermometer bulb (circle at bottom) - tripled radius
-    display.fillCircle(thermX, thermY + 60, 24, RED);
-
-    // Thermometer stem (rectangle) - tripled dimensions
-    display.fillRect(thermX - 9, thermY - 60, 18, 120, WHITE);
-    display.drawRect(thermX - 9, thermY - 60, 18, 120, GRAY);
+  // A slide icon is one walk of its compiled table (see IconBitmap): no trig and no overdraw
+  static void drawIcon(int icon, int centerX, int centerY) {
+    compiledIcons[icon]->draw(*target, centerX, centerY);
+  }
 
-    // Temperature markings - tripled spacing and length
-    for (int i = 0; i < 4; i++) {
-      int markY = thermY - 45 + (i * 24);
-      display.drawLine(thermX + 9, markY, thermX + 24, markY, GRAY);
+  static uint16_t getConditionBackground(ConditionsIcon icon) {
+    switch (icon) {
+    case CONDITIONS_CLEAR:
+    case CONDITIONS_MOSTLY_CLEAR:
+      return DEEP_SKY_BLUE;
+    case CONDITIONS_PARTLY_CLOUDY:
+    case CONDITIONS_MOSTLY_CLOUDY:
+      return STEEL_BLUE;
+    case CONDITIONS_CLOUDY:
+    case CONDITIONS_FOG:
+      return CLOUD_GRAY;
+    case CONDITIONS_THUNDERSTORM:
+      return DARK_VIOLET;
+    default:
+      return DARK_SLATE_BLUE;                      // Rain, snow and ice
     }
   }
 
-  static void drawHumidityIcon(int centerX, int centerY) {
-    // Draw a water droplet (tripled size - doubled + 50%)
-    int dropX = centerX;
-    int dropY = centerY;
-
-    // Water droplet shape using circles and triangle approximation - tripled radius
-    display.fillCircle(dropX, dropY + 15, 36, BLUE);
-    display.fillTriangle(dropX, dropY - 30, dropX - 24, dropY + 15, dropX + 24, dropY + 15, BLUE);
+  // Three-letter weekday of a "YYYY-MM-DD..." date (Sakamoto's method)
+  static const char* getWeekdayName(const char* date) {
+    static const char* const names[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+    static const int monthOffsets[] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+    int year = atoi(date);
+    int month = atoi(date + 5);
+    int dayOfMonth = atoi(date + 8);
+    if (month < 1 || month > 12) {
+      return "";
+    }
 
-    // Highlight for shine effect - tripled radius
-    display.fillCircle(dropX - 12, dropY, 9, LIGHT_BLUE);
+    if (month < 3) {
+      year--;
+    }
+    return names[(year + year / 4 - year / 100 + year / 400 + monthOffsets[month - 1] + dayOfMonth) % 7];
   }
 
-  static void drawWindIcon(int centerX, int centerY) {
-    // Draw wind lines (tripled size - doubled + 50%)
-    int windX = centerX;
-    int windY = centerY;
+  // Slide title at the top left, with a marker while the slide shows cached data
+  static void drawSlideTitle(const char* title) {
+    drawText(Inter_Regular12pt, marginX, marginY + 20, title);
+    closeElement();
 
-    // Multiple curved wind lines - tripled dimensions
-    for (int i = 0; i < 3; i++) {
-      int lineY = windY - 30 + (i * 24);
-      // Horizontal lines with slight curves - tripled length
-      display.drawLine(windX - 45, lineY, windX + 30, lineY, WHITE);
-      display.drawLine(windX + 30, lineY, windX + 45, lineY - 6, WHITE);
-      display.drawLine(windX + 45, lineY - 6, windX + 36, lineY - 15, WHITE);
+    if (showingCachedData) {
+      drawText(Inter_Regular12pt, target->width() - marginX - 90, marginY + 20, "cached", LIGHT_SILVER);
+      closeElement();
     }
   }
 
-  static void drawCloudIcon(int centerX, int centerY) {
-    // Draw a cloud (tripled size - doubled + 50%)
-    int cloudX = centerX;
-    int cloudY = centerY;
-
-    // Cloud circles (create puffy cloud shape) - tripled radius
-    display.fillCircle(cloudX - 36, cloudY, 45, WHITE);
-    display.fillCircle(cloudX, cloudY - 24, 54, WHITE);
-    display.fillCircle(cloudX + 36, cloudY, 45, WHITE);
-    display.fillCircle(cloudX + 60, cloudY + 15, 36, WHITE);
-
-    // Outline for definition - tripled radius
-    display.drawCircle(cloudX - 36, cloudY, 45, LIGHT_GRAY);
-    display.drawCircle(cloudX, cloudY - 24, 54, LIGHT_GRAY);
-    display.drawCircle(cloudX + 36, cloudY, 45, LIGHT_GRAY);
-    display.drawCircle(cloudX + 60, cloudY + 15, 36, LIGHT_GRAY);
+  // Slide text comes from the subset fonts in lib/fonts (see scripts/font-subset.py)
+  static void drawText(const PackedFont& font, int16_t x, int16_t baseline, const char* text, uint16_t color = WHITE,
+    uint8_t size = 2) {
+    PackedText::draw(*target, font, x, baseline, text, color, size);
   }
 
-  static void drawUVIcon(int centerX, int centerY) {
-    // Draw a sun with UV rays (tripled size - doubled + 50%)
-    int sunX = centerX;
-    int sunY = centerY;
-
-    // Sun body - tripled radius
-    display.fillCircle(sunX, sunY, 45, YELLOW);
-
-    // Sun rays (longer and more prominent for UV) - tripled length
-    int rayLength = 60;
-    int rayDistance = 54;
-
-    // 8 rays in all directions
-    for (int i = 0; i < 8; i++) {
-      float angle = i * 45.0 * PI / 180.0;
-      int startX = sunX + cos(angle) * rayDistance;
-      int startY = sunY + sin(angle) * rayDistance;
-      int endX = sunX + cos(angle) * (rayDistance + rayLength);
-      int endY = sunY + sin(angle) * (rayDistance + rayLength);
-
-      display.drawLine(startX, startY, endX, endY, ORANGE);
-      display.drawLine(startX, startY + 1, endX, endY + 1, ORANGE); // Thicker lines
-      display.drawLine(startX + 1, startY, endX + 1, endY, ORANGE); // Even thicker lines
-    }
+  // Large anti-aliased text, blended into the solid background it is drawn over
+  static void drawSmoothText(int16_t x, int16_t baseline, const char* text, uint16_t background) {
+    valueRuns.draw(*target, targetFrame, Inter_Medium24ptSmooth, x, baseline, text, WHITE, background);
   }
 
-  static void drawSwimmingIcon(int centerX, int centerY) {
-    // Draw swimming person icon (🏊‍♂️ emoji representation)
-    int swimmerX = centerX;
-    int swimmerY = centerY;
+  static void resetTextSize() {
+    target->setTextSize(2);
+  }
 
-    // Draw water waves at bottom (tripled size)
-    int waveY = swimmerY + 40;
-    for (int i = 0; i < 3; i++) {
-      int waveBaseY = waveY + (i * 12);
-      // Wavy lines using multiple short segments
-      for (int x = -90; x <= 90; x += 15) {
-        int y1 = waveBaseY + (int)(6 * sin(x * 0.1));
-        int y2 = waveBaseY + (int)(6 * sin((x + 15) * 0.1));
-        display.drawLine(swimmerX + x, y1, swimmerX + x + 15, y2, CYAN);
-        display.drawLine(swimmerX + x, y1 + 1, swimmerX + x + 15, y2 + 1, CYAN);
-      }
+  static void closeElement() {
+    if (dirtyRenderer != nullptr) {
+      dirtyRenderer->closeElement();
     }
-
-    // Draw swimmer's head (circle) - tripled radius
-    display.fillCircle(swimmerX + 30, swimmerY - 30, 18, WHITE);
-    display.drawCircle(swimmerX + 30, swimmerY - 30, 18, GRAY);
-
-    // Draw swimmer's body (oval/rectangle) - tripled dimensions
-    display.fillRect(swimmerX - 15, swimmerY - 12, 45, 24, WHITE);
-    display.drawRect(swimmerX - 15, swimmerY - 12, 45, 24, GRAY);
-
-    // Draw extended arm (swimming stroke) - tripled length
-    display.drawLine(swimmerX - 15, swimmerY - 6, swimmerX - 60, swimmerY - 24, WHITE);
-    display.drawLine(swimmerX - 15, swimmerY - 6, swimmerX - 60, swimmerY - 21, WHITE);
-    display.drawLine(swimmerX - 15, swimmerY - 6, swimmerX - 60, swimmerY - 18, WHITE);
-
-    // Hand
-    display.fillCircle(swimmerX - 60, swimmerY - 21, 6, WHITE);
-
-    // Draw legs (kicking) - tripled length
-    display.drawLine(swimmerX + 30, swimmerY + 12, swimmerX + 60, swimmerY - 6, WHITE);
-    display.drawLine(swimmerX + 30, swimmerY + 12, swimmerX + 60, swimmerY - 3, WHITE);
-    display.drawLine(swimmerX + 30, swimmerY + 12, swimmerX + 60, swimmerY, WHITE);
-
-    display.drawLine(swimmerX + 30, swimmerY + 12, swimmerX + 54, swimmerY + 30, WHITE);
-    display.drawLine(swimmerX + 30, swimmerY + 12, swimmerX + 57, swimmerY + 30, WHITE);
-    display.drawLine(swimmerX + 30, swimmerY + 12, swimmerX + 60, swimmerY + 30, WHITE);
   }
 
-private:
-  // Function to get background color based on weather parameter and value
-  static uint16_t getBackgroundColor(const String& paramType, float value) {
-    if (paramType == "temperature") {
-      if (value >= 30) return RED_ORANGE;          // Hot - orange/red
-      else if (value >= 20) return FOREST_GREEN;   // Warm - green
-      else if (value >= 15) return DEEP_SKY_BLUE;  // Cool - blue
-      else return DARK_BLUE;                       // Cold - dark blue
-    }
-    else if (paramType == "pool") {
-      if (value >= 25) return TURQUOISE;           // Warm pool - turquoise
-      else if (value >= 20) return TEAL;           // Comfortable - teal
-      else if (value >= 15) return STEEL_BLUE;     // Cool pool - steel blue
-      else return DARK_SLATE_BLUE;                 // Cold pool - dark blue
-    }
-    else if (paramType == "uv") {
-      if (value >= 8) return RED;                  // Very high UV - red
-      else if (value >= 6) return ORANGE;          // High UV - orange
-      else if (value >= 3) return YELLOW;          // Moderate UV - yellow
-      else return DARK_SEA_GREEN;                     // Low UV - light green
-    }
-    else if (paramType == "humidity") {
-      return NAVY_BLUE;                            // Static blue for humidity
-    }
-    else if (paramType == "wind") {
-      return STORM_GRAY;                           // Gray for wind
-    }
-    else if (paramType == "cloud") {
-      return CLOUD_GRAY;                           // Gray for cloud cover
+  // Something was drawn straight to the panel, so the renderer's copy of it is stale
+  static void invalidateFrame() {
+    if (dirtyRenderer != nullptr) {
+      dirtyRenderer->invalidate();
     }
-
-    return DEEP_SKY_BLUE; // Default background
   }
 
-  static void resetTextSize() {
-    display.setTextSize(2);
+  static void noteFirstFrame() {
+    if (firstFrameTime == 0) {
+      firstFrameTime = millis();
+      Logger::log("First useful frame " + String(firstFrameTime) + " ms after boot" +
+        (showingCachedData ? " (cached data)" : ""));
+    }
   }
 
 public:
@@ -351,14 +216,43 @@ public:
     backlight.begin();
 
     display.setRotation(1);
-    display.fillScreen(DEEP_SKY_BLUE);
+    target->fillScreen(DEEP_SKY_BLUE);
 
     currentY = marginY;
     displayOn = true;
     lastTouchTime = 0;
     touchInProgress = false;
 
-    drawWeatherIcon(display.width() / 2 - 20, display.height() / 2 - 20);
+    drawWeatherIcon(target->width() / 2 - 20, target->height() / 2 - 20);
+  }
+
+  // Log the flash the compiled slide icons take. With DISPLAY_DEBUG, also time each blit, off screen.
+  static void logIcons() {
+    size_t flashBytes = 0;
+    for (int icon = 0; icon < ICON_COUNT; icon++) {
+      flashBytes += compiledIcons[icon]->getByteSize();
+    }
+    Logger::log("Compiled icons: " + String(flashBytes) + " bytes of flash");
+
+#if defined(DISPLAY_DEBUG)
+    const int scratchSize = 240; // Large enough for the biggest icon (UV rays reach 115 px)
+    FrameBuffer scratch(scratchSize, scratchSize);
+    if (!scratch.isValid()) {
+      return;
+    }
+
+    static const char* const iconNames[ICON_COUNT] = { "temperature", "uv", "humidity", "wind", "cloud", "pool" };
+    Adafruit_GFX* screen = target;
+    target = &scratch;
+    for (int icon = 0; icon < ICON_COUNT; icon++) {
+      unsigned long startTime = micros();
+      drawIcon(icon, scratchSize / 2, scratchSize / 2);
+      unsigned long blitUs = micros() - startTime;
+      Logger::log("Icon " + String(iconNames[icon]) + ": " + String(compiledIcons[icon]->getByteSize()) + " bytes, blit " +
+        String(blitUs) + " us");
+    }
+    target = screen;
+#endif
   }
 
   static void setBacklight(bool on) {
@@ -408,11 +302,15 @@ public:
     }
   }
 
-  static void handleTouchToggle() {
-    if (checkTouch()) {
-      displayOn = !displayOn;
-      setBacklight(displayOn);
+  // Toggle the display on a tap; true if it was toggled
+  static bool handleTouchToggle() {
+    if (!checkTouch()) {
+      return false;
     }
+
+    displayOn = !displayOn;
+    setBacklight(displayOn);
+    return true;
   }
 
   static void refreshDisplay() {
@@ -429,7 +327,8 @@ public:
 
   static void clearScreen() {
     // Always clear when explicitly called, regardless of display state
-    display.fillScreen(BLACK);
+    invalidateFrame();
+    target->fillScreen(BLACK);
     currentY = marginY;
   }
 
@@ -437,95 +336,189 @@ public:
     if (!displayOn)
       return; // Don't print if display is off
 
-    display.setTextColor(color);
-    display.setCursor(marginY, currentY);
-    display.print(text);
+    invalidateFrame();
+    target->setTextColor(color);
+    target->setCursor(marginY, currentY);
+    target->print(text);
     currentY += lineHeight;
 
     // Wrap to top if we've reached the bottom
-    if (currentY > display.height() - lineHeight) {
+    if (currentY > target->height() - lineHeight) {
       currentY = marginY;
     }
   }
 
-  static void displaySlide(const String& title, const String& value, const String& unit = "", const String& iconType = "") {
+  static void displaySlide(const String& title, const String& message) {
     Logger::log("=== displaySlide() called ===");
     Logger::log("displayOn: ", displayOn);
     Logger::log("Title: ", title);
-    Logger::log("Value: ", value);
+    Logger::log("Message: ", message);
 
     if (!displayOn) {
       Logger::log("Display is OFF, not showing slide");
       return;
     }
 
-    // Determine background color based on parameter type and value
-    uint16_t backgroundColor = DEEP_SKY_BLUE; // Default
-    if (iconType.length() > 0) {
-      float numericValue = value.toFloat();
+    invalidateFrame();
+    drawSlideFrame(title.c_str(), message.c_str(), DEEP_SKY_BLUE, ICON_NONE);
+    noteFirstFrame();
+    Logger::log("=== displaySlide() completed ===");
+  }
 
-      if (iconType == "temperature") {
-        backgroundColor = getBackgroundColor("temperature", numericValue);
-      }
-      else if (iconType == "pool") {
-        backgroundColor = getBackgroundColor("pool", numericValue);
-      }
-      else if (iconType == "uv") {
-        backgroundColor = getBackgroundColor("uv", numericValue);
-      }
-      else if (iconType == "humidity") {
-        backgroundColor = getBackgroundColor("humidity", numericValue);
-      }
-      else if (iconType == "wind") {
-        backgroundColor = getBackgroundColor("wind", numericValue);
-      }
-      else if (iconType == "cloud") {
-        backgroundColor = getBackgroundColor("cloud", numericValue);
-      }
+  // A value slide from its display list, which is only rebuilt when the slide's value changes
+  static void drawValueSlide(const SlideDefinition& slide) {
+    SlideDisplayList& list = slideLists[slide.id];
+    list.update(slide, { currentWeatherData, currentPoolData });
+    drawSlideFrame(slide.title, list.text, list.background, slide.icon);
+  }
+
+  static void drawSlideFrame(const char* title, const char* value, uint16_t backgroundColor, int icon) {
+    target->fillScreen(backgroundColor);
+    drawSlideTitle(title);
+
+    // Display icon in center if specified
+    if (icon != ICON_NONE) {
+      drawIcon(icon, target->width() / 2, target->height() / 2);
+      closeElement();
     }
 
-    // Clear screen with dynamic background color
-    display.fillScreen(backgroundColor);
+    // Display value at bottom left with largest font size using Inter font
+    int valueY = target->height() - marginY;
+    drawSmoothText(marginX, valueY, value, backgroundColor);
+    closeElement();
 
-    // Display title at top left with enhanced styling using Inter font
-    display.setFont(&Inter_Regular12pt7b);
-    display.setTextColor(WHITE);
-    display.setCursor(marginX, marginY + 20);
-    display.print(title.c_str());
+    resetTextSize();
+  }
 
-    // Display icon in center if specified
-    if (iconType.length() > 0) {
-      int centerX = display.width() / 2;
-      int centerY = display.height() / 2;
+  // Current conditions as a large atlas icon with its description, and the coming days'
+  // icons down the right. Every icon is one table blit: no trig and no allocation.
+  static void drawConditionsSlide() {
+    const WeatherCondition* now = findWeatherCondition(currentWeatherData.weatherCode);
+    target->fillScreen(now != nullptr ? getConditionBackground(now->icon) : DEEP_SKY_BLUE);
+    drawSlideTitle(SLIDES[SLIDE_CONDITIONS].title);
 
-      if (iconType == "temperature") {
-        drawTemperatureIcon(centerX, centerY);
-      }
-      else if (iconType == "pool") {
-        drawSwimmingIcon(centerX, centerY);
-      }
-      else if (iconType == "humidity") {
-        drawHumidityIcon(centerX, centerY);
-      }
-      else if (iconType == "wind") {
-        drawWindIcon(centerX, centerY);
+    if (now != nullptr) {
+      ConditionsAtlasLarge[now->icon].draw(*target, conditionsIconX, target->height() / 2);
+      closeElement();
+    }
+
+    // Long descriptions ("Heavy Freezing Rain") drop to normal size to stay clear of the forecast
+    const char* description = now != nullptr ? now->description : UNKNOWN_CONDITION;
+    uint8_t size = marginX + PackedText::measure(Inter_Medium24pt, description, 2) > forecastX - marginX ? 1 : 2;
+    drawText(Inter_Medium24pt, marginX, target->height() - marginY, description, WHITE, size);
+    closeElement();
+
+    char temperature[8];
+    for (int i = 0; i < currentForecastData.dayCount; i++) {
+      const DailyForecastData& day = currentForecastData.daily[i];
+      int rowY = forecastTop + i * forecastRowHeight;
+
+      drawText(Inter_Regular12pt, forecastX, rowY + 8, getWeekdayName(day.date), WHITE, 1);
+
+      const WeatherCondition* condition = findWeatherCondition(day.weatherCode);
+      if (condition != nullptr) {
+        ConditionsAtlasSmall[condition->icon].draw(*target, forecastX + 85, rowY);
       }
-      else if (iconType == "cloud") {
-        drawCloudIcon(centerX, centerY);
+
+      snprintf(temperature, sizeof(temperature), "%dC", (int)lroundf(day.temperatureAvg));
+      drawText(Inter_Regular12pt, forecastX + 125, rowY + 8, temperature, WHITE, 1);
+    }
+    closeElement();
+  }
+
+  // Draw a slideshow slide, through the dirty-rectangle renderer when it is enabled. If
+  // prepareNextSlide() already drew it, the transition is only the present.
+  static void showSlide(int slide) {
+    if (dirtyRenderer != nullptr) {
+#if defined(DISPLAY_DEBUG)
+      unsigned long startTime = micros();
+      bool prepared = isPrepared(slide);
+      if (!prepared) {
+        drawToBackBuffer(slide);
       }
-      else if (iconType == "uv") {
-        drawUVIcon(centerX, centerY);
+      unsigned long drawnTime = micros();
+      dirtyRenderer->present(display);
+      unsigned long presentedTime = micros();
+
+      String drawn = prepared ? "prepared " + String(millis() - preparedAt) + " ms ahead in " + String(prepareUs) + " us"
+                              : "drawn on demand in " + String(drawnTime - startTime) + " us";
+      Logger::log("Slide " + String(slide) + " " + drawn + ", presented in " + String(presentedTime - drawnTime) +
+        " us; transition took " + String(presentedTime - startTime) + " us");
+#else
+      if (!isPrepared(slide)) {
+        drawToBackBuffer(slide);
       }
+      dirtyRenderer->present(display);
+#endif
+      preparedSlide = -1;
+    }
+    else {
+      drawSlide(slide);
     }
+    noteFirstFrame();
+  }
 
-    // Display value at bottom left with largest font size using Inter font
-    display.setFont(&Inter_Medium24pt7b);
-    int valueY = display.height() - marginY;
-    display.setCursor(marginX, valueY);
-    display.print((value + unit).c_str());
+  static void drawToBackBuffer(int slide) {
+    Adafruit_GFX* screen = target;
+    targetFrame = &dirtyRenderer->beginFrame();
+    target = targetFrame;
+    drawSlide(slide);
+    target = screen;
+    targetFrame = nullptr;
+  }
 
-    resetTextSize();
-    Logger::log("=== displaySlide() completed ===");
+  // Prepared slides are drawn again once the data they show has a new version
+  static bool isPrepared(int slide) {
+    return preparedSlide == slide && preparedGeneration == snapshots.getGeneration();
+  }
+
+  // Whatever was prepared shows an old state; draw it again when next needed
+  static void discardPreparedSlide() {
+    preparedSlide = -1;
+  }
+
+  // Draw the coming slide into the back buffer during idle loop time, so that when it is
+  // due the renderer only has to push the changed spans. Call from loop() after other work.
+  static void prepareNextSlide() {
+    if (dirtyRenderer == nullptr || !displayOn || !currentWeatherData.isValid) {
+      return;
+    }
+
+    int next = (currentSlide + 1) % SLIDE_COUNT;
+    if (isPrepared(next)) {
+      return;
+    }
+
+#if defined(DISPLAY_DEBUG)
+    unsigned long startTime = micros();
+    drawToBackBuffer(next);
+    prepareUs = micros() - startTime;
+    preparedAt = millis();
+#else
+    drawToBackBuffer(next);
+#endif
+    preparedSlide = next;
+    preparedGeneration = snapshots.getGeneration();
+  }
+
+  // Pixels the last slide transition sent to the panel; 0 while drawing directly
+  static unsigned long getPixelsPushed() {
+    return dirtyRenderer != nullptr ? dirtyRenderer->getPixelsPushed() : 0;
+  }
+
+  // Diff consecutive slides and push only changed spans instead of clearing the whole panel.
+  // Needs two frame-sized buffers; stays off if they cannot be allocated.
+  static void enableDirtyRects() {
+    if (dirtyRenderer != nullptr) {
+      return;
+    }
+
+    dirtyRenderer = new DirtyRectRenderer(display.width(), display.height());
+    if (!dirtyRenderer->isValid()) {
+      Logger::log("Dirty-rectangle renderer unavailable, drawing slides directly");
+      delete dirtyRenderer;
+      dirtyRenderer = nullptr;
+    }
   }
 
   static void updateSlideShow() {
@@ -537,45 +530,116 @@ public:
 
     unsigned long currentTime = millis();
 
-    // Check if it's time to change slides
+    // Check if it's time to change slides. Slides keep to the cadence they were due on,
+    // unless the slideshow fell more than a slide behind (e.g. while the display was off).
     if (currentTime - lastSlideChange >= slideDuration) {
-      currentSlide = (currentSlide + 1) % totalSlides;
-      lastSlideChange = currentTime;
+      currentSlide = (currentSlide + 1) % SLIDE_COUNT;
+      lastSlideChange = currentTime - lastSlideChange < 2 * slideDuration ? lastSlideChange + slideDuration : currentTime;
 
       Logger::log("Switching to slide " + String(currentSlide) + "...");
+      showSlide(currentSlide);
+      Logger::log("Displaying slide " + String(currentSlide + 1) + " of " + String(SLIDE_COUNT));
+    }
+  }
 
-      // Display the current slide with appropriate icons
-      switch (currentSlide) {
-      case 0: // Temperature
-        displaySlide("Temperature", String(currentWeatherData.temperature, 1), "C", "temperature");
-        break;
-      case 1: // UV Index
-        displaySlide("UV Index", String(currentWeatherData.uvIndex), "", "uv");
-        break;
-      case 2: // Humidity
-        displaySlide("Humidity", String(currentWeatherData.humidity, 1), "%", "humidity");
-        break;
-      case 3: // Wind Speed
-        displaySlide("Wind Speed", String(currentWeatherData.windSpeed, 1), "km/h", "wind");
-        break;
-      case 4: // Cloud Cover
-        displaySlide("Cloud Cover", String(currentWeatherData.cloudCover), "%", "cloud");
-        break;
-      case 5: // Pool Temperature
-        if (currentPoolData.isValid) {
-          displaySlide("Pool Temp", String(currentPoolData.temperature, 1), "C", "pool");
-        }
-        else {
-          displaySlide("Pool Temp", "No data", "", "pool");
-        }
-        break;
-      default:
-        break;
+  // millis() at which updateSlideShow() next changes slide; false while the slideshow is stopped
+  static bool getNextSlideTime(unsigned long& time) {
+    if (!displayOn || !currentWeatherData.isValid) {
+      return false;
+    }
+
+    time = lastSlideChange + slideDuration;
+    return true;
+  }
+
+  // Display one slide of the slideshow, as its definition in Slides.h lays it out
+  static void drawSlide(int slide) {
+    const SlideDefinition& definition = SLIDES[slide];
+    switch (definition.layout) {
+    case SLIDE_LAYOUT_VALUE:
+      drawValueSlide(definition);
+      break;
+    case SLIDE_LAYOUT_CONDITIONS:
+      drawConditionsSlide();
+      break;
+    default:
+      break;
+    }
+  }
+
+  // Draw one slide into an off-screen frame instead of the panel
+  static void renderSlide(FrameBuffer& frame, int slide) {
+    if (!frame.isValid()) {
+      return;
+    }
+
+    Adafruit_GFX* screen = target;
+    target = &frame;
+    targetFrame = &frame;
+    drawSlide(slide);
+    target = screen;
+    targetFrame = nullptr;
+  }
+
+#if defined(DISPLAY_DEBUG)
+  // Render every slide off-screen, logging draw time and pixels written for each, and
+  // optionally dump the frames as text for scripts/frames-to-png.py
+  static void renderSlides(FrameBuffer& frame, Print* dumpTo = nullptr) {
+    if (!frame.isValid()) {
+      return;
+    }
+
+    for (int slide = 0; slide < SLIDE_COUNT; slide++) {
+      frame.resetStats();
+      unsigned long startTime = micros();
+      renderSlide(frame, slide);
+      unsigned long elapsedUs = micros() - startTime;
+
+      unsigned long frameSize = (unsigned long)frame.width() * frame.height();
+      Logger::log("Slide " + String(slide) + ": " + String(elapsedUs) + " us, " + String(frame.getPixelsWritten()) +
+        " pixels written (" + String(100.0f * frame.getPixelsWritten() / frameSize, 1) + "% of frame)");
+      if (dumpTo != nullptr) {
+        frame.dump(*dumpTo, slide);
       }
+    }
+  }
 
-      Logger::log("Displaying slide " + String(currentSlide + 1) + " of " + String(totalSlides));
+  // Time the ways of drawing a slide value off-screen: 1-bit glyphs at size 2, anti-aliased
+  // glyphs blended on every draw, and anti-aliased runs copied from a TextRunCache
+  static void benchmarkText(FrameBuffer& frame, int repeats = 100) {
+    if (!frame.isValid()) {
+      return;
+    }
+
+    String value = String(currentWeatherData.temperature, 1) + "C";
+    uint16_t background = getSlideBackground(SLIDES[SLIDE_TEMPERATURE], currentWeatherData.temperature);
+    int16_t baseline = frame.height() - marginY;
+    TextRunCache runs;
+    frame.fillScreen(background);
+
+    unsigned long startTime = micros();
+    for (int i = 0; i < repeats; i++) {
+      PackedText::draw(frame, Inter_Medium24pt, marginX, baseline, value.c_str(), WHITE, 2);
+    }
+    unsigned long bitsUs = micros() - startTime;
+
+    startTime = micros();
+    for (int i = 0; i < repeats; i++) {
+      PackedText::drawBlended(frame, Inter_Medium24ptSmooth, marginX, baseline, value.c_str(), WHITE, background);
+    }
+    unsigned long blendedUs = micros() - startTime;
+
+    startTime = micros();
+    for (int i = 0; i < repeats; i++) {
+      runs.draw(frame, &frame, Inter_Medium24ptSmooth, marginX, baseline, value.c_str(), WHITE, background);
     }
+    unsigned long cachedUs = micros() - startTime;
+
+    Logger::log("Text \"" + value + "\" x" + String(repeats) + ": 1-bit " + String(bitsUs / (float)repeats, 1) +
+      " us, anti-aliased " + String(blendedUs / (float)repeats, 1) + " us, cached " + String(cachedUs / (float)repeats, 1) +
+      " us per draw (" + String(runs.getHits()) + " hits, " + String(runs.getMisses()) + " misses)");
   }
+#endif
 
   static void startSlideShow(const RealtimeWeatherData& data) {
     Logger::log("=== startSlideShow() called ===");
@@ -583,14 +647,76 @@ public:
     Logger::log("displayOn: ", displayOn);
 
     currentWeatherData = data;
+    snapshots.realtime.publish(data, millis());
+    showingCachedData = false;
     currentSlide = -1;
     lastSlideChange = millis();
+    discardPreparedSlide();
 
     if (!data.isValid) {
       displaySlide("Error", "Load failed");
     }
   }
 
+  // Swap in fresh values without restarting the slideshow; the next slide picks them up.
+  // Values equal to the current ones leave the snapshot version, and prepared slides, alone.
+  static void updateRealtimeData(const RealtimeWeatherData& data) {
+    if (!data.isValid) {
+      return;
+    }
+
+    if (!currentWeatherData.isValid) {
+      startSlideShow(data);
+      return;
+    }
+
+    currentWeatherData = data;
+    snapshots.realtime.publish(data, millis());
+    if (showingCachedData) {
+      showingCachedData = false;
+      discardPreparedSlide();
+    }
+  }
+
+  // Start the slideshow from a warm-start snapshot and draw its first slide right away;
+  // slides are marked "cached" until fresh data replaces it
+  static void showCachedData(const RealtimeWeatherData& weatherData, const PoolTemperatureData& poolData,
+    const ForecastData& forecastData) {
+    if (!weatherData.isValid) {
+      return;
+    }
+
+    currentWeatherData = weatherData;
+    currentPoolData = poolData;
+    currentForecastData = forecastData;
+    unsigned long now = millis();
+    snapshots.realtime.publish(weatherData, now);
+    snapshots.pool.publish(PoolReading::from(poolData), now);
+    snapshots.forecast.publish(forecastData, now);
+    showingCachedData = true;
+    currentSlide = -1;
+    lastSlideChange = millis() - slideDuration;
+    discardPreparedSlide();
+    updateSlideShow();
+  }
+
+  static const RealtimeWeatherData& getWeatherData() {
+    return currentWeatherData;
+  }
+
+  static const PoolTemperatureData& getPoolData() {
+    return currentPoolData;
+  }
+
+  static const ForecastData& getForecastData() {
+    return currentForecastData;
+  }
+
+  // For readers on other threads; the getters above are for the display side only
+  static const WeatherSnapshots& getSnapshots() {
+    return snapshots;
+  }
+
   static void displayRealtimeWeather(const RealtimeWeatherData& data) {
     Logger::log("DisplayOn: ", displayOn);
 
@@ -649,15 +775,36 @@ public:
     Logger::log("poolData.isValid: ", poolData.isValid);
 
     currentPoolData = poolData;
+    snapshots.pool.publish(PoolReading::from(poolData), millis());
 
     if (poolData.isValid) {
       Logger::log("Pool temp: " + String(poolData.temperature) + "C, " + poolData.timeAgo);
     }
   }
+
+  static void updateForecastData(const ForecastData& forecastData) {
+    Logger::log("=== updateForecastData() called ===");
+    Logger::log("forecastData.isValid: ", forecastData.isValid);
+
+    currentForecastData = forecastData;
+    snapshots.forecast.publish(forecastData, millis());
+  }
 };
 
 // Static member definitions
 GigaDisplay_GFX Display::display;
+Adafruit_GFX* Display::target = &Display::display;
+FrameBuffer* Display::targetFrame = nullptr;
+DirtyRectRenderer* Display::dirtyRenderer = nullptr;
+int Display::preparedSlide = -1;
+uint32_t Display::preparedGeneration = 0;
+unsigned long Display::preparedAt = 0;
+unsigned long Display::prepareUs = 0;
+const IconBitmap* const Display::compiledIcons[ICON_COUNT] = {
+  &IconTemperature, &IconUv, &IconHumidity, &IconWind, &IconCloud, &IconPool
+};
+TextRunCache Display::valueRuns;
+SlideDisplayList Display::slideLists[SLIDE_COUNT] = {};
 Arduino_GigaDisplayTouch Display::touch;
 GigaDisplayBacklight Display::backlight;
 int Display::currentY = 10;
@@ -668,5 +815,9 @@ bool Display::touchInProgress = false;
 // Slide cycling static member definitions
 unsigned long Display::lastSlideChange = 0;
 int Display::currentSlide = 0;
-RealtimeWeatherData Display::currentWeatherData = { 0, 0, 0, 0, 0, false };
+RealtimeWeatherData Display::currentWeatherData = { 0, 0, 0, 0, 0, 0, 0, false };
 PoolTemperatureData Display::currentPoolData = { "", 0.0f, 0, "", false };
+ForecastData Display::currentForecastData = {};
+WeatherSnapshots Display::snapshots;
+bool Display::showingCachedData = false;
+unsigned long Display::firstFrameTime = 0;
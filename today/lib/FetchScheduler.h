@@ -0,0 +1,210 @@
+// FetchScheduler.h - Quota-aware scheduling of realtime, forecast and pool fetches
+#pragma once
+#include <Arduino.h>
+#include "Logger.h"
+
+enum class FetchSource {
+  Realtime,
+  Forecast,
+  Pool,
+  None
+};
+
+// Token bucket sized so that no sliding window of `windowMs` can ever see more than
+// `limit` requests: burst + refill over the window == limit
+class TokenBucket {
+private:
+  float capacity;
+  float tokens;
+  float refillPerMs;
+  unsigned long lastRefillTime;
+
+public:
+  TokenBucket() : capacity(0), tokens(0), refillPerMs(0), lastRefillTime(0) {
+  }
+
+  TokenBucket(float limit, unsigned long windowMs, float burst)
+    : capacity(burst), tokens(burst), refillPerMs((limit - burst) / windowMs), lastRefillTime(0) {
+  }
+
+  float available(unsigned long now) {
+    refill(now);
+    return tokens;
+  }
+
+  bool canConsume(unsigned long now) {
+    return available(now) >= 1.0f;
+  }
+
+  void consume(unsigned long now) {
+    refill(now);
+    tokens -= 1.0f;
+  }
+
+  float getCapacity() const {
+    return capacity;
+  }
+
+private:
+  void refill(unsigned long now) {
+    tokens = min(capacity, tokens + (now - lastRefillTime) * refillPerMs);
+    lastRefillTime = now;
+  }
+};
+
+class FetchScheduler {
+public:
+  enum Provider {
+    TOMORROW_IO,
+    POOL_API,
+    PROVIDER_COUNT
+  };
+
+private:
+  static const int SOURCE_COUNT = 3;
+
+  struct ProviderBudget {
+    TokenBucket hourly;
+    TokenBucket daily;
+    unsigned long requestCount;
+  };
+
+  struct SourceState {
+    Provider provider;
+    unsigned long minIntervalMs;    // never refetch sooner than this
+    unsigned long targetIntervalMs; // data older than this is overdue
+    float priority;
+    bool enabled;
+    bool hasAttempted;
+    bool hasSucceeded;
+    unsigned long lastAttemptTime;
+    unsigned long lastSuccessTime;
+    unsigned long retryDelayMs;
+  };
+
+  ProviderBudget budgets[PROVIDER_COUNT];
+  SourceState sources[SOURCE_COUNT];
+
+public:
+  FetchScheduler() {
+    // tomorrow.io free tier: 25 requests/hour and 500/day, shared by realtime and forecast
+    budgets[TOMORROW_IO] = { TokenBucket(25, 3600000UL, 5), TokenBucket(500, 86400000UL, 20), 0 };
+    // The pool API has no published limit; stay polite
+    budgets[POOL_API] = { TokenBucket(30, 3600000UL, 5), TokenBucket(720, 86400000UL, 20), 0 };
+
+    sources[(int)FetchSource::Realtime] = { TOMORROW_IO, 3 * 60000UL, 10 * 60000UL, 3.0f, true, false, false, 0, 0, 0 };
+    sources[(int)FetchSource::Forecast] = { TOMORROW_IO, 20 * 60000UL, 60 * 60000UL, 1.0f, true, false, false, 0, 0, 0 };
+    sources[(int)FetchSource::Pool] = { POOL_API, 5 * 60000UL, 8 * 60000UL, 2.0f, true, false, false, 0, 0, 0 };
+  }
+
+  void setEnabled(FetchSource fetch, bool enabled) {
+    sources[(int)fetch].enabled = enabled;
+  }
+
+  void setIntervals(FetchSource fetch, unsigned long minIntervalMs, unsigned long targetIntervalMs) {
+    sources[(int)fetch].minIntervalMs = minIntervalMs;
+    sources[(int)fetch].targetIntervalMs = targetIntervalMs;
+  }
+
+  // Pick the most valuable fetch that the budgets allow right now, or None.
+  // Overdue sources win by staleness x priority; when a provider has spare tokens,
+  // sources past their minimum interval are refreshed early with the leftover budget.
+  FetchSource nextFetch(unsigned long now) {
+    FetchSource best = FetchSource::None;
+    float bestScore = 0;
+
+    for (int i = 0; i < SOURCE_COUNT; i++) {
+      SourceState& source = sources[i];
+      ProviderBudget& budget = budgets[source.provider];
+
+      if (!source.enabled) {
+        continue;
+      }
+      if (source.hasAttempted && now - source.lastAttemptTime < max(source.minIntervalMs, source.retryDelayMs)) {
+        continue;
+      }
+      if (!budget.hourly.canConsume(now) || !budget.daily.canConsume(now)) {
+        continue;
+      }
+
+      float score = source.priority * staleness(source, now);
+      bool overdue = score >= source.priority;
+      if (!overdue && !hasSpareBudget(budget, now)) {
+        continue;
+      }
+
+      if (score > bestScore) {
+        best = (FetchSource)i;
+        bestScore = score;
+      }
+    }
+
+    return best;
+  }
+
+  // Record that a fetch was sent; every attempt counts against the provider's quota
+  void recordAttempt(FetchSource fetch, unsigned long now) {
+    SourceState& source = sources[(int)fetch];
+    ProviderBudget& budget = budgets[source.provider];
+    budget.hourly.consume(now);
+    budget.daily.consume(now);
+    budget.requestCount++;
+    source.hasAttempted = true;
+    source.lastAttemptTime = now;
+  }
+
+  void recordResult(FetchSource fetch, bool success, unsigned long now) {
+    SourceState& source = sources[(int)fetch];
+    if (success) {
+      source.hasSucceeded = true;
+      source.lastSuccessTime = now;
+      source.retryDelayMs = 0;
+      return;
+    }
+
+    // Back off exponentially from the minimum interval, capped at the target interval
+    source.retryDelayMs = source.retryDelayMs == 0 ? source.minIntervalMs : source.retryDelayMs * 2;
+    source.retryDelayMs = min(source.retryDelayMs, source.targetIntervalMs);
+  }
+
+  // Let sources whose last attempt failed go again right away, still within the budgets;
+  // for when the cause has gone, such as the network coming back. The backoff is kept.
+  void retryFailed() {
+    for (int i = 0; i < SOURCE_COUNT; i++) {
+      if (sources[i].retryDelayMs != 0) {
+        sources[i].hasAttempted = false;
+      }
+    }
+  }
+
+  // Age of the last good data in ms, or ULONG_MAX if there has never been any
+  unsigned long dataAge(FetchSource fetch, unsigned long now) const {
+    const SourceState& source = sources[(int)fetch];
+    return source.hasSucceeded ? now - source.lastSuccessTime : 0xFFFFFFFFUL;
+  }
+
+  unsigned long getRequestCount(Provider provider) const {
+    return budgets[provider].requestCount;
+  }
+
+  void logBudget(unsigned long now) {
+    ProviderBudget& budget = budgets[TOMORROW_IO];
+    Logger::log("tomorrow.io budget: " + String(budget.hourly.available(now), 1) + " hourly / " +
+      String(budget.daily.available(now), 1) + " daily tokens, " + String(budget.requestCount) + " requests sent");
+  }
+
+private:
+  // 1.0 means exactly at the target interval; never-fetched sources are maximally stale
+  static float staleness(const SourceState& source, unsigned long now) {
+    if (!source.hasSucceeded) {
+      return 1000.0f;
+    }
+    return (float)(now - source.lastSuccessTime) / source.targetIntervalMs;
+  }
+
+  // Keep half the burst in reserve for fetches that become overdue
+  static bool hasSpareBudget(ProviderBudget& budget, unsigned long now) {
+    return budget.hourly.available(now) >= budget.hourly.getCapacity() / 2 + 1 &&
+      budget.daily.available(now) >= budget.daily.getCapacity() / 2 + 1;
+  }
+};
@@ -0,0 +1,278 @@
+// FrameBuffer.h - Off-screen RGB565 drawing surface for measuring and capturing slides
+#pragma once
+#include <Arduino.h>
+#include "Arduino_GigaDisplay_GFX.h"
+#include "Logger.h"
+
+#if defined(ARDUINO_GIGA)
+#include "SDRAM.h"
+#endif
+
+// An Adafruit_GFX surface backed by a plain RGB565 buffer instead of the panel.
+// Display can draw into it exactly as it draws to the screen, so a slide's cost and
+// output can be measured without the hardware in the loop. Every pixel write is
+// counted (overdraw included) to show how much work a frame really does.
+// The buffer is not rotated: create it with the width and height Display draws at.
+//
+// For damage tracking a frame can be split into elements: writes since the last
+// closeElement() are gathered into one bounding rectangle. Full-screen clears are not
+// part of any element; only the clear color is remembered.
+struct FrameRect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+class FrameBuffer : public Adafruit_GFX {
+public:
+  static const int MAX_ELEMENTS = 8;
+
+private:
+  uint16_t* buffer;
+  unsigned long pixelsWritten;
+  FrameRect elements[MAX_ELEMENTS];
+  int elementCount;
+  int16_t boundsLeft, boundsTop, boundsRight, boundsBottom;
+  bool hasClear;
+  uint16_t clearColor;
+
+public:
+  FrameBuffer(int16_t width, int16_t height) : Adafruit_GFX(width, height), buffer(nullptr), pixelsWritten(0) {
+    beginFrame();
+    buffer = allocatePixels((size_t)width * height);
+    if (buffer == nullptr) {
+      Logger::log("FrameBuffer: allocation failed");
+    }
+  }
+
+  ~FrameBuffer() {
+    freePixels(buffer);
+  }
+
+  // Pixel storage for frames and other large RGB565 buffers
+  static uint16_t* allocatePixels(size_t count) {
+#if defined(ARDUINO_GIGA)
+    // 750 KB does not fit in internal RAM; the Giga's 8 MB SDRAM holds it easily
+    static bool sdramStarted = false;
+    if (!sdramStarted) {
+      SDRAM.begin();
+      sdramStarted = true;
+    }
+    return (uint16_t*)SDRAM.malloc(count * sizeof(uint16_t));
+#else
+    return (uint16_t*)malloc(count * sizeof(uint16_t));
+#endif
+  }
+
+  static void freePixels(uint16_t* pixels) {
+#if defined(ARDUINO_GIGA)
+    SDRAM.free(pixels);
+#else
+    free(pixels);
+#endif
+  }
+
+  bool isValid() const {
+    return buffer != nullptr;
+  }
+
+  const uint16_t* getBuffer() const {
+    return buffer;
+  }
+
+  uint16_t* getBuffer() {
+    return buffer;
+  }
+
+  uint16_t getPixel(int16_t x, int16_t y) const {
+    if (buffer == nullptr || x < 0 || y < 0 || x >= _width || y >= _height) {
+      return 0;
+    }
+    return buffer[(int32_t)y * _width + x];
+  }
+
+  unsigned long getPixelsWritten() const {
+    return pixelsWritten;
+  }
+
+  void resetStats() {
+    pixelsWritten = 0;
+  }
+
+  // Start tracking elements for a new frame
+  void beginFrame() {
+    elementCount = 0;
+    hasClear = false;
+    clearColor = 0;
+    resetBounds();
+  }
+
+  // Close the current element: everything written since the last call becomes one rectangle
+  void closeElement() {
+    if (boundsLeft > boundsRight) {
+      return;
+    }
+
+    FrameRect rect = { boundsLeft, boundsTop, (int16_t)(boundsRight - boundsLeft + 1), (int16_t)(boundsBottom - boundsTop + 1) };
+    resetBounds();
+    if (elementCount < MAX_ELEMENTS) {
+      elements[elementCount++] = rect;
+      return;
+    }
+
+    // Out of slots: grow the last element to cover this one too
+    FrameRect& last = elements[MAX_ELEMENTS - 1];
+    int right = last.x + last.w > rect.x + rect.w ? last.x + last.w : rect.x + rect.w;
+    int bottom = last.y + last.h > rect.y + rect.h ? last.y + last.h : rect.y + rect.h;
+    last.x = last.x < rect.x ? last.x : rect.x;
+    last.y = last.y < rect.y ? last.y : rect.y;
+    last.w = right - last.x;
+    last.h = bottom - last.y;
+  }
+
+  int getElementCount() const {
+    return elementCount;
+  }
+
+  const FrameRect& getElement(int index) const {
+    return elements[index];
+  }
+
+  bool wasCleared() const {
+    return hasClear;
+  }
+
+  uint16_t getClearColor() const {
+    return clearColor;
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    if (buffer == nullptr || x < 0 || y < 0 || x >= _width || y >= _height) {
+      return;
+    }
+    buffer[(int32_t)y * _width + x] = color;
+    pixelsWritten++;
+    includeInBounds(x, y, x, y);
+  }
+
+  // Spans and rectangles are clipped once and filled directly rather than per pixel
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+    if (w < 0) {
+      x += w + 1;
+      w = -w;
+    }
+    if (h < 0) {
+      y += h + 1;
+      h = -h;
+    }
+
+    int16_t x0 = x < 0 ? 0 : x;
+    int16_t y0 = y < 0 ? 0 : y;
+    int16_t x1 = x + w > _width ? _width : x + w;
+    int16_t y1 = y + h > _height ? _height : y + h;
+    if (buffer == nullptr || x0 >= x1 || y0 >= y1) {
+      return;
+    }
+
+    fill(x0, y0, x1, y1, color);
+    includeInBounds(x0, y0, x1 - 1, y1 - 1);
+  }
+
+  // Copy a block of ready-made pixels (w x h, rows packed) a row at a time
+  void blit(int16_t x, int16_t y, const uint16_t* pixels, int16_t w, int16_t h) {
+    int16_t x0 = x < 0 ? 0 : x;
+    int16_t y0 = y < 0 ? 0 : y;
+    int16_t x1 = x + w > _width ? _width : x + w;
+    int16_t y1 = y + h > _height ? _height : y + h;
+    if (buffer == nullptr || x0 >= x1 || y0 >= y1) {
+      return;
+    }
+
+    for (int16_t row = y0; row < y1; row++) {
+      memcpy(buffer + (int32_t)row * _width + x0, pixels + (int32_t)(row - y) * w + (x0 - x), (x1 - x0) * sizeof(uint16_t));
+    }
+    pixelsWritten += (unsigned long)(x1 - x0) * (y1 - y0);
+    includeInBounds(x0, y0, x1 - 1, y1 - 1);
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+    fillRect(x, y, w, 1, color);
+  }
+
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+    fillRect(x, y, 1, h, color);
+  }
+
+  void fillScreen(uint16_t color) override {
+    if (buffer == nullptr) {
+      return;
+    }
+    fill(0, 0, _width, _height, color);
+    hasClear = true;
+    clearColor = color;
+  }
+
+  // Dump the frame as text so it can be captured from the serial monitor and turned into
+  // a PNG with scripts/frames-to-png.py: a header line, one line of hex RGB565 per row, an end line
+  void dump(Print& out, int index) const {
+    if (buffer == nullptr) {
+      return;
+    }
+
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
+    char line[4 * 64 + 1];
+
+    out.print("FRAME ");
+    out.print(index);
+    out.print(" ");
+    out.print((int)_width);
+    out.print(" ");
+    out.println((int)_height);
+
+    for (int16_t y = 0; y < _height; y++) {
+      const uint16_t* row = buffer + (int32_t)y * _width;
+      // Written in 64-pixel pieces to keep the stack buffer small
+      for (int16_t x = 0; x < _width; x += 64) {
+        int count = _width - x < 64 ? _width - x : 64;
+        for (int i = 0; i < count; i++) {
+          uint16_t pixel = row[x + i];
+          line[i * 4] = HEX_DIGITS[(pixel >> 12) & 0xF];
+          line[i * 4 + 1] = HEX_DIGITS[(pixel >> 8) & 0xF];
+          line[i * 4 + 2] = HEX_DIGITS[(pixel >> 4) & 0xF];
+          line[i * 4 + 3] = HEX_DIGITS[pixel & 0xF];
+        }
+        line[count * 4] = '\0';
+        out.print(line);
+      }
+      out.println();
+    }
+
+    out.println("END FRAME");
+  }
+
+private:
+  void fill(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    for (int16_t row = y0; row < y1; row++) {
+      uint16_t* span = buffer + (int32_t)row * _width;
+      for (int16_t col = x0; col < x1; col++) {
+        span[col] = color;
+      }
+    }
+    pixelsWritten += (unsigned long)(x1 - x0) * (y1 - y0);
+  }
+
+  void resetBounds() {
+    boundsLeft = _width;
+    boundsTop = _height;
+    boundsRight = -1;
+    boundsBottom = -1;
+  }
+
+  void includeInBounds(int16_t left, int16_t top, int16_t right, int16_t bottom) {
+    if (left < boundsLeft) boundsLeft = left;
+    if (top < boundsTop) boundsTop = top;
+    if (right > boundsRight) boundsRight = right;
+    if (bottom > boundsBottom) boundsBottom = bottom;
+  }
+};
@@ -1,248 +1,295 @@
 // HttpClient.h
 #pragma once
 #include <WiFi.h>
-#include <ArduinoHttpClient.h>
 #include "Logger.h"
+#include "BodySink.h"
+#include "HttpResponseReader.h"
+#include "ConnectionPool.h"
 
 struct HttpResponse {
   int statusCode;
-  String body;
+  unsigned long bodyLength;
   bool isSuccess;
   String error;
+  unsigned long elapsedMs;
+  bool reusedConnection;
 };
 
+enum class HttpRequestState {
+  Idle,
+  Connecting,
+  Sending,
+  Receiving,
+  Done,
+  Failed
+};
+
+// Resumable HTTPS GET. begin() queues a request and poll() advances it one bounded
+// step at a time (connect, send, then at most a few body chunks), so the caller's
+// loop keeps running while a slow server trickles its response in.
+// Bodies are never buffered whole: bytes are pushed to the caller's BodySink in
+// STREAM_CHUNK_SIZE pieces from one reusable stack buffer.
+// Sockets come from the shared ConnectionPool and are kept alive between requests.
 class SimpleHttpClient {
 private:
-  WiFiSSLClient wifiSSLClient;
+  static const int STREAM_CHUNK_SIZE = 512;
+  static const unsigned long POLL_BUDGET_MS = 5;
+  static const unsigned long FIRST_BYTE_TIMEOUT_MS = 30000;
+  static const unsigned long IDLE_TIMEOUT_MS = 10000;
+
+  WiFiSSLClient* connection;
+  bool retriedConnection;
+  HttpResponseReader reader;
+  HttpRequestState state;
+  HttpResponse response;
+  String host;
+  String path;
+  int port;
+  TlsConnect tlsConnect;
+  unsigned long phaseStartTime;
+  unsigned long lastDataTime;
+  unsigned long bytesReceived;
+  unsigned long requestStartTime;
 
 public:
-  SimpleHttpClient() {
-    // Initialize SSL client
-    wifiSSLClient.flush();
+  SimpleHttpClient()
+    : connection(nullptr), retriedConnection(false), state(HttpRequestState::Idle), port(443),
+    tlsConnect(TlsConnect::Default), phaseStartTime(0), lastDataTime(0), bytesReceived(0), requestStartTime(0) {
   }
 
-  HttpResponse get(const String& host, const String& path, int port = 443, bool useSSLConnect = false) {
-    HttpResponse response = { 0, "", false, "" };
+  // How this client's requests open their sockets; applies from the next begin()
+  void setTlsConnect(TlsConnect mode) {
+    tlsConnect = mode;
+  }
+
+  // Start a request; returns false if it could not be queued
+  bool begin(const String& requestHost, const String& requestPath, BodySink& sink, int requestPort = 443) {
+    cancel();
+    response = { 0, 0, false, "", 0, false };
+    requestStartTime = millis();
 
     if (!checkConnection()) {
-      response.error = "WiFi not connected";
-      Logger::log(response.error);
-      return response;
+      return fail("WiFi not connected");
     }
 
-    Logger::log("HTTP GET: https://" + host + path);
+    host = requestHost;
+    path = requestPath;
+    port = requestPort;
+    reader = HttpResponseReader(&sink);
+    bytesReceived = 0;
+    retriedConnection = false;
 
-    // For problematic APIs, use manual HTTP instead of ArduinoHttpClient
-    if (host == "api.canwegointhepool.com") {
-      return getManualHttp(host, path, port);
-    }
-
-    // For other APIs, use the standard ArduinoHttpClient
-    HttpClient http = HttpClient(wifiSSLClient, host, port);
+    Logger::log("HTTP GET: https://" + host + path);
+    enterPhase(HttpRequestState::Connecting);
+    return true;
+  }
 
-    if (!beginRequest(http, path, response)) {
-      return response;
-    }
+  bool begin(const String& requestHost, const String& requestPath, const String& queryParams, BodySink& sink, int requestPort = 443) {
+    return begin(requestHost, buildPath(requestPath, queryParams), sink, requestPort);
+  }
 
-    return processResponse(http);
-  }  HttpResponse get(const String& host, const String& path, const String& queryParams, int port = 443) {
-    String fullPath = path;
-    if (queryParams.length() > 0) {
-      fullPath += "?" + queryParams;
+  // Advance the request by one bounded step and return the new state
+  HttpRequestState poll() {
+    switch (state) {
+    case HttpRequestState::Connecting:
+      pollConnect();
+      break;
+    case HttpRequestState::Sending:
+      pollSend();
+      break;
+    case HttpRequestState::Receiving:
+      pollReceive();
+      break;
+    default:
+      break;
     }
-    return get(host, fullPath, port);
+    return state;
   }
 
-private:
-  bool checkConnection() {
-    return WiFi.status() == WL_CONNECTED;
+  bool isBusy() const {
+    return state == HttpRequestState::Connecting || state == HttpRequestState::Sending ||
+      state == HttpRequestState::Receiving;
   }
 
-  // Manual HTTP method for problematic APIs (inspired by working pool API code)
-  HttpResponse getManualHttp(const String& host, const String& path, int port = 443) {
-    HttpResponse response = { 0, "", false, "" };
-
-    Logger::log("Using manual HTTP for: " + host);
+  HttpRequestState getState() const {
+    return state;
+  }
 
-    // Connect using SSL
-    if (!wifiSSLClient.connectSSL(host.c_str(), port)) {
-      response.error = "Failed to connect to " + host;
-      Logger::log(response.error);
-      return response;
-    }
+  const HttpResponse& getResponse() const {
+    return response;
+  }
 
-    Logger::log("SSL connection established");
-
-    // Send manual HTTP request (similar to your working code)
-    wifiSSLClient.print("GET ");
-    wifiSSLClient.print(path.c_str());
-    wifiSSLClient.println(" HTTP/1.1");
-    wifiSSLClient.print("Host: ");
-    wifiSSLClient.println(host.c_str());
-    wifiSSLClient.println("User-Agent: Today/1.0");
-    wifiSSLClient.println("Connection: close");
-    wifiSSLClient.println();
-
-    Logger::log("HTTP request sent manually");
-
-    // Read response
-    unsigned long startTime = millis();
-    String responseText = "";
-    bool headersEnded = false;
-    int statusCode = 0;
-
-    // Wait for response with timeout
-    while (millis() - startTime < 30000) { // 30 second timeout
-      if (wifiSSLClient.available()) {
-        String line = "";
-
-        // Read line character by character
-        while (wifiSSLClient.available()) {
-          char c = wifiSSLClient.read();
-          if (c == '\n') break;
-          if (c != '\r') line += c;
-        }
+  void cancel() {
+    releaseConnection(false);
+    state = HttpRequestState::Idle;
+  }
 
-        if (!headersEnded) {
-          // Parse status line
-          if (line.startsWith("HTTP/") && statusCode == 0) {
-            int firstSpace = line.indexOf(' ');
-            int secondSpace = line.indexOf(' ', firstSpace + 1);
-            if (firstSpace > 0 && secondSpace > firstSpace) {
-              statusCode = line.substring(firstSpace + 1, secondSpace).toInt();
-              Logger::log("Status code: " + String(statusCode));
-            }
-          }
-
-          // Check for end of headers
-          if (line.length() <= 2) { // Empty line or just \r\n
-            headersEnded = true;
-            Logger::log("Headers ended, reading body...");
-          }
+  // Blocking convenience wrapper for callers outside the main loop
+  HttpResponse get(const String& requestHost, const String& requestPath, BodySink& sink, int requestPort = 443) {
+    if (begin(requestHost, requestPath, sink, requestPort)) {
+      while (isBusy()) {
+        if (poll() == HttpRequestState::Receiving) {
+          delay(1);
         }
-        else {
-          // Read body
-          responseText += line;
-        }
-      }
-      else {
-        delay(100);
       }
     }
+    return response;
+  }
 
-    wifiSSLClient.stop();
+  HttpResponse get(const String& requestHost, const String& requestPath, const String& queryParams, BodySink& sink, int requestPort = 443) {
+    return get(requestHost, buildPath(requestPath, queryParams), sink, requestPort);
+  }
 
-    response.statusCode = statusCode;
-    responseText.trim();
-    response.body = responseText;
+private:
+  bool checkConnection() {
+    return WiFi.status() == WL_CONNECTED;
+  }
 
-    if (statusCode == 200 && response.body.length() > 0) {
-      response.isSuccess = true;
-      Logger::log("Manual HTTP successful: " + String(response.body.length()) + " bytes");
-    }
-    else {
-      response.error = "Manual HTTP failed or empty response";
-      Logger::log(response.error);
+  static String buildPath(const String& path, const String& queryParams) {
+    String fullPath = path;
+    if (queryParams.length() > 0) {
+      fullPath += "?" + queryParams;
     }
+    return fullPath;
+  }
 
-    return response;
+  void enterPhase(HttpRequestState next) {
+    state = next;
+    phaseStartTime = millis();
+    lastDataTime = phaseStartTime;
   }
 
-  bool testConnection(const String& host, int port, bool useSSLConnect = false) {
-    Logger::log("Testing SSL connection to " + host + ":" + String(port));
+  bool fail(const String& error) {
+    response.error = error;
+    response.isSuccess = false;
+    response.elapsedMs = millis() - requestStartTime;
+    Logger::log(response.error);
+    releaseConnection(false);
+    state = HttpRequestState::Failed;
+    return false;
+  }
 
-    if (useSSLConnect && wifiSSLClient.connectSSL(host.c_str(), port)) {
-      Logger::log("SSL connection (.connectSSL()) test successful");
-      wifiSSLClient.stop();
-      return true;
+  void releaseConnection(bool keepAlive) {
+    if (connection != nullptr) {
+      ConnectionPool::release(connection, keepAlive);
+      connection = nullptr;
     }
+  }
 
-    if (!useSSLConnect && wifiSSLClient.connect(host.c_str(), port)) {
-      Logger::log("SSL connection (.connect()) test successful");
-      wifiSSLClient.stop();
-      return true;
+  // A kept-alive socket may have been closed by the server since its last use;
+  // retry once on a fresh connection before reporting an error
+  bool retryOnFreshConnection() {
+    if (!response.reusedConnection || retriedConnection || bytesReceived > 0) {
+      return false;
     }
 
-    Logger::log("SSL connection test failed");
-    wifiSSLClient.stop();
-    return false;
+    Logger::log("Reused connection to " + host + " was closed, reconnecting...");
+    releaseConnection(false);
+    retriedConnection = true;
+    enterPhase(HttpRequestState::Connecting);
+    return true;
   }
 
-  bool beginRequest(HttpClient& http, const String& path, HttpResponse& response) {
-    Logger::log("Starting HTTP request...");
-
-    // Add delay to ensure SSL connection is stable
-    delay(100);
-
-    http.beginRequest();
-    http.get(path);
-    http.sendHeader("accept", "application/json");
-    http.sendHeader("user-agent", "Today 0.1");
-    // Add some standard headers that might help with AWS API Gateway
-    http.sendHeader("connection", "close");
-    http.sendHeader("cache-control", "no-cache");
-    http.endRequest();
+  void pollConnect() {
+    // A fresh TLS handshake is a single blocking call in the WiFi library
+    bool reused = false;
+    connection = ConnectionPool::acquire(host, port, tlsConnect, reused);
+    if (connection == nullptr) {
+      fail("Failed to connect to " + host);
+      return;
+    }
 
-    Logger::log("HTTP request sent successfully");
+    response.reusedConnection = reused;
+    Logger::log(reused ? "Reusing kept-alive connection" : "SSL connection established");
+    enterPhase(HttpRequestState::Sending);
+  }
 
-    // Add small delay after sending request
-    delay(100);
+  void pollSend() {
+    // Send the whole request in one write so it goes out as a single TLS record
+    String request = "GET " + path + " HTTP/1.1\r\n";
+    request += "Host: " + host + "\r\n";
+    request += "Accept: application/json\r\n";
+    request += "User-Agent: Today/1.0\r\n";
+    request += "Cache-Control: no-cache\r\n";
+    request += "Connection: keep-alive\r\n\r\n";
+
+    if (connection->write((const uint8_t*)request.c_str(), request.length()) != request.length()) {
+      if (!retryOnFreshConnection()) {
+        fail("Failed to send request to " + host);
+      }
+      return;
+    }
 
-    return true;
+    Logger::log("HTTP request sent");
+    enterPhase(HttpRequestState::Receiving);
   }
 
-  HttpResponse processResponse(HttpClient& http) {
-    HttpResponse response = { 0, "", false, "" };
-
-    Logger::log("Waiting for response...");
+  void pollReceive() {
+    char buffer[STREAM_CHUNK_SIZE];
+    unsigned long pollStart = millis();
 
-    // Wait for response with longer timeout for slower APIs
-    unsigned long start = millis();
-    int checkCount = 0;
-    while (!http.available() && millis() - start < 30000) { // 30 second timeout
-      delay(500); // Check every 500ms
-      checkCount++;
+    // Read as many chunks as are ready, but hand control back within POLL_BUDGET_MS
+    while (!reader.isComplete() && millis() - pollStart < POLL_BUDGET_MS) {
+      int available = connection->available();
+      if (available <= 0) {
+        break;
+      }
 
-      // Log progress every 5 seconds
-      if (checkCount % 10 == 0) {
-        Logger::log("Still waiting for response... (" + String((millis() - start) / 1000) + "s)");
+      int toRead = available < STREAM_CHUNK_SIZE ? available : STREAM_CHUNK_SIZE;
+      int count = connection->read((uint8_t*)buffer, toRead);
+      if (count <= 0) {
+        break;
       }
+
+      bytesReceived += count;
+      lastDataTime = millis();
+      reader.write(buffer, count);
     }
 
-    if (!http.available()) {
-      response.error = "Request timeout - no response received after 30 seconds";
-      Logger::log(response.error);
-      Logger::log("Connection state: " + String(http.connected() ? "connected" : "disconnected"));
-      http.stop();
-      return response;
+    if (reader.isComplete()) {
+      complete();
+      return;
     }
 
-    response.statusCode = http.responseStatusCode();
-    Logger::log("Response status: " + String(response.statusCode));
+    if (!connection->connected() && connection->available() <= 0) {
+      if (!retryOnFreshConnection()) {
+        complete();
+      }
+      return;
+    }
 
-    if (response.statusCode <= 0) {
-      response.error = "Invalid response status: " + String(response.statusCode);
-      Logger::log(response.error);
-      http.stop();
-      return response;
+    unsigned long now = millis();
+    if (bytesReceived == 0) {
+      if (now - phaseStartTime > FIRST_BYTE_TIMEOUT_MS) {
+        fail("Request timeout - no response received after 30 seconds");
+      }
+    }
+    else if (now - lastDataTime > IDLE_TIMEOUT_MS) {
+      fail("Response stalled - no data for 10 seconds");
     }
+  }
+
+  void complete() {
+    bool finished = reader.finish();
+    releaseConnection(reader.isKeepAlive());
 
-    response.body = http.responseBody();
-    Logger::log("Response received, length: " + String(response.body.length()));
+    response.statusCode = reader.getStatusCode();
+    response.bodyLength = reader.getBodyBytes();
+    response.elapsedMs = millis() - requestStartTime;
+    Logger::log("Response status: " + String(response.statusCode) + ", body length: " + String(response.bodyLength) +
+      ", " + String(response.elapsedMs) + " ms" + (response.reusedConnection ? " (reused connection)" : ""));
 
-    if (response.statusCode == 200) {
-      response.isSuccess = true;
-      Logger::log("HTTP request successful (200 OK)");
+    if (!reader.isSuccessStatus()) {
+      fail("HTTP error: " + String(response.statusCode));
+      return;
     }
-    else {
-      response.error = "HTTP error: " + String(response.statusCode);
-      Logger::log(response.error);
-      if (response.body.length() > 0) {
-        Logger::log("Response body: " + response.body);
-      }
+
+    if (!finished) {
+      fail("Incomplete or malformed response body");
+      return;
     }
 
-    http.stop();
-    return response;
+    response.isSuccess = true;
+    state = HttpRequestState::Done;
   }
-};
\ No newline at end of file
+};
@@ -0,0 +1,259 @@
+// HttpResponseReader.h - Incremental HTTP/1.1 response framer
+#pragma once
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "BodySink.h"
+
+// Takes raw bytes from the socket, parses the status line and headers, and forwards
+// the de-framed body (Content-Length, chunked or read-until-close) to a BodySink.
+// Reports completion as soon as the message ends so callers never wait on a timeout.
+class HttpResponseReader : public BodySink {
+private:
+  static const int LINE_SIZE = 128;
+
+  enum class State {
+    StatusLine,
+    Headers,
+    FixedBody,
+    UntilCloseBody,
+    ChunkSize,
+    ChunkData,
+    ChunkDataEnd,
+    Trailers,
+    Done,
+    Error
+  };
+
+  BodySink* bodySink;
+  State state;
+  char line[LINE_SIZE];
+  int lineLength;
+  int statusCode;
+  long contentLength;
+  bool chunked;
+  bool connectionClose;
+  unsigned long remaining;
+  unsigned long bodyBytes;
+
+public:
+  HttpResponseReader(BodySink* bodySink = nullptr) : bodySink(bodySink), line() {
+    reset();
+  }
+
+  void reset() {
+    state = State::StatusLine;
+    lineLength = 0;
+    statusCode = 0;
+    contentLength = -1;
+    chunked = false;
+    connectionClose = false;
+    remaining = 0;
+    bodyBytes = 0;
+  }
+
+  // Feed raw bytes read from the connection
+  bool write(const char* data, size_t length) override {
+    size_t offset = 0;
+    while (offset < length && state != State::Done && state != State::Error) {
+      offset += consume(data + offset, length - offset);
+    }
+    return state != State::Error;
+  }
+
+  // Called when the connection closed or reading stopped
+  bool finish() override {
+    if (state == State::UntilCloseBody) {
+      state = State::Done;
+    }
+    if (state != State::Done) {
+      return false;
+    }
+    return bodySink == nullptr || !isSuccessStatus() || bodySink->finish();
+  }
+
+  bool isComplete() const override {
+    if (state == State::UntilCloseBody) {
+      // Without framing, a body sink that has seen the whole document is as good as a close
+      return bodySink != nullptr && isSuccessStatus() && bodySink->isComplete();
+    }
+    return state == State::Done || state == State::Error;
+  }
+
+  bool hasError() const {
+    return state == State::Error;
+  }
+
+  bool headersComplete() const {
+    return state != State::StatusLine && state != State::Headers;
+  }
+
+  int getStatusCode() const {
+    return statusCode;
+  }
+
+  long getContentLength() const {
+    return contentLength;
+  }
+
+  bool isChunked() const {
+    return chunked;
+  }
+
+  unsigned long getBodyBytes() const {
+    return bodyBytes;
+  }
+
+  // Whether the connection can carry another request once this response is done
+  bool isKeepAlive() const {
+    return state == State::Done && !connectionClose;
+  }
+
+  bool isSuccessStatus() const {
+    return statusCode == 200;
+  }
+
+private:
+  size_t consume(const char* data, size_t length) {
+    switch (state) {
+    case State::FixedBody:
+    case State::ChunkData: {
+      size_t count = length < remaining ? length : remaining;
+      forwardBody(data, count);
+      remaining -= count;
+      if (remaining == 0) {
+        state = state == State::FixedBody ? State::Done : State::ChunkDataEnd;
+      }
+      return count;
+    }
+
+    case State::UntilCloseBody:
+      forwardBody(data, length);
+      return length;
+
+    default:
+      consumeLineChar(data[0]);
+      return 1;
+    }
+  }
+
+  void forwardBody(const char* data, size_t length) {
+    bodyBytes += length;
+    // Error bodies are drained but not parsed
+    if (bodySink != nullptr && isSuccessStatus() && !bodySink->write(data, length)) {
+      state = State::Error;
+    }
+  }
+
+  void consumeLineChar(char c) {
+    if (c == '\r') {
+      return;
+    }
+    if (c != '\n') {
+      if (lineLength < LINE_SIZE - 1) {
+        line[lineLength++] = c;
+      }
+      return;
+    }
+
+    line[lineLength] = '\0';
+    lineLength = 0;
+    handleLine();
+  }
+
+  void handleLine() {
+    switch (state) {
+    case State::StatusLine:
+      handleStatusLine();
+      break;
+    case State::Headers:
+      if (line[0] == '\0') {
+        beginBody();
+      }
+      else {
+        handleHeader();
+      }
+      break;
+    case State::ChunkSize:
+      handleChunkSize();
+      break;
+    case State::ChunkDataEnd:
+      state = line[0] == '\0' ? State::ChunkSize : State::Error;
+      break;
+    case State::Trailers:
+      if (line[0] == '\0') {
+        state = State::Done;
+      }
+      break;
+    default:
+      break;
+    }
+  }
+
+  void handleStatusLine() {
+    if (strncmp(line, "HTTP/", 5) != 0) {
+      state = State::Error;
+      return;
+    }
+    const char* space = strchr(line, ' ');
+    statusCode = space ? atoi(space + 1) : 0;
+    // HTTP/1.0 closes after each response unless told otherwise
+    connectionClose = strncmp(line, "HTTP/1.0", 8) == 0;
+    state = statusCode > 0 ? State::Headers : State::Error;
+  }
+
+  void handleHeader() {
+    const char* colon = strchr(line, ':');
+    if (colon == nullptr) {
+      return;
+    }
+
+    const char* value = colon + 1;
+    while (*value == ' ' || *value == '\t') {
+      value++;
+    }
+
+    size_t nameLength = colon - line;
+    if (nameLength == 14 && strncasecmp(line, "Content-Length", 14) == 0) {
+      contentLength = atol(value);
+    }
+    else if (nameLength == 17 && strncasecmp(line, "Transfer-Encoding", 17) == 0) {
+      chunked = strstr(value, "chunked") != nullptr || strstr(value, "Chunked") != nullptr;
+    }
+    else if (nameLength == 10 && strncasecmp(line, "Connection", 10) == 0) {
+      connectionClose = strncasecmp(value, "close", 5) == 0;
+    }
+  }
+
+  void beginBody() {
+    // Interim 1xx responses are followed by the real status line
+    if (statusCode >= 100 && statusCode < 200) {
+      reset();
+    }
+    // 204 and 304 responses never carry a body
+    else if (statusCode == 204 || statusCode == 304) {
+      state = State::Done;
+    }
+    else if (chunked) {
+      state = State::ChunkSize;
+    }
+    else if (contentLength >= 0) {
+      remaining = contentLength;
+      state = remaining > 0 ? State::FixedBody : State::Done;
+    }
+    else {
+      connectionClose = true;
+      state = State::UntilCloseBody;
+    }
+  }
+
+  void handleChunkSize() {
+    char* end = nullptr;
+    remaining = strtoul(line, &end, 16);
+    if (end == line) {
+      state = State::Error;
+      return;
+    }
+    state = remaining > 0 ? State::ChunkData : State::Trailers;
+  }
+};
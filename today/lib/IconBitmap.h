@@ -0,0 +1,52 @@
+// IconBitmap.h - Flash-resident indexed-palette icons produced by scripts/icon-compiler.py
+#pragma once
+#include <Arduino.h>
+#include "Arduino_GigaDisplay_GFX.h"
+
+// Icons compiled ahead of time from assets/icons/*.png into lib/icons/. Pixels are
+// stored row after row as runs of palette indexes, one byte per run:
+//   high nibble  palette index + 1, or 0 for a transparent run
+//   low nibble   run length 1..15, or 0 when the next byte holds the length
+// Runs never cross a row, so drawing is a plain integer table walk.
+struct IconBitmap {
+  const uint16_t* palette; // RGB565, PROGMEM
+  const uint8_t* runs;     // PROGMEM
+  uint8_t paletteSize;
+  uint16_t runBytes;
+  int16_t width;
+  int16_t height;
+  int16_t offsetX; // Top-left corner relative to the icon's center
+  int16_t offsetY;
+
+  size_t getByteSize() const {
+    return runBytes + paletteSize * sizeof(uint16_t);
+  }
+
+  void draw(Adafruit_GFX& gfx, int16_t centerX, int16_t centerY) const {
+    int16_t left = centerX + offsetX;
+    int16_t x = 0;
+    int16_t y = centerY + offsetY;
+    uint16_t i = 0;
+
+    gfx.startWrite();
+    while (i < runBytes) {
+      uint8_t run = pgm_read_byte(runs + i++);
+      uint8_t index = run >> 4;
+      int16_t length = run & 0x0F;
+      if (length == 0) {
+        length = pgm_read_byte(runs + i++);
+      }
+
+      if (index != 0) {
+        gfx.writeFastHLine(left + x, y, length, pgm_read_word(palette + index - 1));
+      }
+
+      x += length;
+      if (x >= width) {
+        x = 0;
+        y++;
+      }
+    }
+    gfx.endWrite();
+  }
+};
@@ -0,0 +1,380 @@
+// JsonStreamParser.h - Incremental JSON tokenizer for streamed HTTP bodies
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "BodySink.h"
+
+enum class JsonValueType {
+  String,
+  Number,
+  Bool,
+  Null
+};
+
+class JsonStreamParser;
+
+// FNV-1a over a key. constexpr so path and field keys are hashed at compile time;
+// the parser hashes incoming keys as they stream past and never stores their text.
+constexpr uint32_t jsonKeyHashStep(uint32_t hash, char c) {
+  return (hash ^ (uint8_t)c) * 16777619UL;
+}
+
+constexpr uint32_t jsonKeyHash(const char* key, uint32_t hash = 2166136261UL) {
+  return *key == '\0' ? hash : jsonKeyHash(key + 1, jsonKeyHashStep(hash, *key));
+}
+
+// Receives scalar values as they are tokenized, together with the parser so the
+// handler can inspect the current path (keys and array indices)
+class JsonStreamHandler {
+public:
+  virtual ~JsonStreamHandler() {}
+  virtual void onValue(const JsonStreamParser& parser, const char* value, JsonValueType type) = 0;
+  virtual void onContainerEnd(const JsonStreamParser& /* parser */) {}
+};
+
+class JsonStreamParser : public BodySink {
+public:
+  static const int MAX_DEPTH = 10;
+  static const int MAX_TOKEN_LENGTH = 40;
+
+private:
+  enum class State {
+    Value,
+    ArrayFirst,
+    ObjectFirst,
+    Key,
+    KeyString,
+    Colon,
+    AfterValue,
+    String,
+    Literal,
+    Done,
+    Error
+  };
+
+  struct Frame {
+    uint32_t keyHash;
+    int index;
+    bool isArray;
+  };
+
+  JsonStreamHandler* handler;
+  Frame frames[MAX_DEPTH];
+  int depth;
+  State state;
+  bool escaping;
+  char token[MAX_TOKEN_LENGTH];
+  int tokenLength;
+  uint32_t tokenHash;
+  unsigned long bytesConsumed;
+
+public:
+  JsonStreamParser(JsonStreamHandler* handler = nullptr) : handler(handler) {
+    reset();
+  }
+
+  void setHandler(JsonStreamHandler* newHandler) {
+    handler = newHandler;
+  }
+
+  void reset() {
+    depth = 0;
+    state = State::Value;
+    escaping = false;
+    tokenLength = 0;
+    tokenHash = jsonKeyHash("");
+    token[0] = '\0';
+    bytesConsumed = 0;
+  }
+
+  // Feed the next chunk of the document; returns false once the input is malformed
+  bool feed(const char* data, size_t length) {
+    for (size_t i = 0; i < length && state != State::Error; i++) {
+      consume(data[i]);
+    }
+    bytesConsumed += length;
+    return state != State::Error;
+  }
+
+  bool write(const char* data, size_t length) override {
+    return feed(data, length);
+  }
+
+  bool isComplete() const override {
+    return isDone() || hasError();
+  }
+
+  // Flush a trailing top-level literal (e.g. a bare number) at end of input
+  bool finish() override {
+    if (state == State::Literal) {
+      emitLiteral();
+    }
+    return isDone();
+  }
+
+  bool isDone() const {
+    return state == State::Done;
+  }
+
+  bool hasError() const {
+    return state == State::Error;
+  }
+
+  unsigned long getBytesConsumed() const {
+    return bytesConsumed;
+  }
+
+  // Path inspection for handlers
+  int getDepth() const {
+    return depth;
+  }
+
+  // Hash of the key at `level`, or 0 for array levels
+  uint32_t keyHashAt(int level) const {
+    if (level < 0 || level >= depth || frames[level].isArray) {
+      return 0;
+    }
+    return frames[level].keyHash;
+  }
+
+  int indexAt(int level) const {
+    if (level < 0 || level >= depth || !frames[level].isArray) {
+      return -1;
+    }
+    return frames[level].index;
+  }
+
+  bool keyIs(int level, uint32_t keyHash) const {
+    return keyHashAt(level) == keyHash;
+  }
+
+  uint32_t currentKeyHash() const {
+    return keyHashAt(depth - 1);
+  }
+
+  static float toFloat(const char* value) {
+    return (float)atof(value);
+  }
+
+private:
+  static bool isWhitespace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+  }
+
+  void fail() {
+    state = State::Error;
+  }
+
+  void push(bool isArray) {
+    if (depth >= MAX_DEPTH) {
+      fail();
+      return;
+    }
+    frames[depth].keyHash = 0;
+    frames[depth].index = 0;
+    frames[depth].isArray = isArray;
+    depth++;
+    state = isArray ? State::ArrayFirst : State::ObjectFirst;
+  }
+
+  void pop(bool isArray) {
+    if (depth == 0 || frames[depth - 1].isArray != isArray) {
+      fail();
+      return;
+    }
+    if (handler) {
+      handler->onContainerEnd(*this);
+    }
+    depth--;
+    endValue();
+  }
+
+  void endValue() {
+    state = depth == 0 ? State::Done : State::AfterValue;
+  }
+
+  void appendToken(char c) {
+    // Over-long tokens are truncated, but keys are still hashed in full
+    tokenHash = jsonKeyHashStep(tokenHash, c);
+    if (tokenLength < MAX_TOKEN_LENGTH - 1) {
+      token[tokenLength++] = c;
+    }
+  }
+
+  void beginToken() {
+    tokenLength = 0;
+    tokenHash = jsonKeyHash("");
+  }
+
+  void emit(JsonValueType type) {
+    token[tokenLength] = '\0';
+    if (handler) {
+      handler->onValue(*this, token, type);
+    }
+  }
+
+  void emitLiteral() {
+    JsonValueType type = JsonValueType::Number;
+    if (token[0] == 't' || token[0] == 'f') {
+      type = JsonValueType::Bool;
+    }
+    else if (token[0] == 'n') {
+      type = JsonValueType::Null;
+    }
+    emit(type);
+    endValue();
+  }
+
+  void beginValue(char c) {
+    if (c == '{') {
+      push(false);
+    }
+    else if (c == '[') {
+      push(true);
+    }
+    else if (c == '"') {
+      beginToken();
+      escaping = false;
+      state = State::String;
+    }
+    else if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n') {
+      beginToken();
+      appendToken(c);
+      state = State::Literal;
+    }
+    else {
+      fail();
+    }
+  }
+
+  void beginKey() {
+    beginToken();
+    escaping = false;
+    state = State::KeyString;
+  }
+
+  void endKey() {
+    frames[depth - 1].keyHash = tokenHash;
+    state = State::Colon;
+  }
+
+  void nextElement() {
+    Frame& frame = frames[depth - 1];
+    if (frame.isArray) {
+      frame.index++;
+      state = State::Value;
+    }
+    else {
+      state = State::Key;
+    }
+  }
+
+  void consume(char c) {
+    if (isWhitespace(c) && state != State::String && state != State::KeyString) {
+      if (state == State::Literal) {
+        emitLiteral();
+      }
+      return;
+    }
+
+    switch (state) {
+    case State::Value:
+      beginValue(c);
+      break;
+
+    case State::ArrayFirst:
+      if (c == ']') {
+        pop(true);
+      }
+      else {
+        beginValue(c);
+      }
+      break;
+
+    case State::ObjectFirst:
+      if (c == '}') {
+        pop(false);
+      }
+      else if (c == '"') {
+        beginKey();
+      }
+      else {
+        fail();
+      }
+      break;
+
+    case State::Key:
+      if (c == '"') {
+        beginKey();
+      }
+      else {
+        fail();
+      }
+      break;
+
+    case State::KeyString:
+    case State::String:
+      // Escapes are kept verbatim minus the backslash; none of the fields we read use them
+      if (escaping) {
+        appendToken(c);
+        escaping = false;
+      }
+      else if (c == '\\') {
+        escaping = true;
+      }
+      else if (c != '"') {
+        appendToken(c);
+      }
+      else if (state == State::KeyString) {
+        endKey();
+      }
+      else {
+        emit(JsonValueType::String);
+        endValue();
+      }
+      break;
+
+    case State::Colon:
+      if (c == ':') {
+        state = State::Value;
+      }
+      else {
+        fail();
+      }
+      break;
+
+    case State::AfterValue:
+      if (c == ',') {
+        nextElement();
+      }
+      else if (c == ']') {
+        pop(true);
+      }
+      else if (c == '}') {
+        pop(false);
+      }
+      else {
+        fail();
+      }
+      break;
+
+    case State::Literal:
+      if (c == ',' || c == ']' || c == '}') {
+        emitLiteral();
+        consume(c);
+      }
+      else {
+        appendToken(c);
+      }
+      break;
+
+    case State::Done:
+      fail();
+      break;
+
+    case State::Error:
+      break;
+    }
+  }
+};
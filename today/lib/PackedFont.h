@@ -0,0 +1,305 @@
+// PackedFont.h - Subset bitmap fonts produced by scripts/font-subset.py and their text renderer
+#pragma once
+#include <Arduino.h>
+#include "Arduino_GigaDisplay_GFX.h"
+
+// Same metrics as Adafruit's GFXglyph, so subsets keep the original spacing exactly
+struct PackedGlyph {
+  uint16_t offset; // Into PackedFont::data
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+};
+
+// A GFXfont cut down to the characters the slides print. Only kept glyphs are stored; a
+// one-byte index per character code finds them, and characters left out of the subset
+// are skipped when drawing. Bitmaps are either Adafruit's continuous 1-bit rows (BITS)
+// or nibble run lengths (RLE): runs alternate between background and ink, starting
+// with background, and a nibble of 15 adds 15 to the run and continues it.
+//
+// SMOOTH fonts are anti-aliased, with 4-bit coverage per pixel: a nibble of 0 or 15 is
+// followed by a count nibble for 1-16 clear or solid pixels, and 1-14 is one edge pixel.
+// They are made at the size they are shown at, so their metrics are already scaled.
+struct PackedFont {
+  static const uint8_t BITS = 0;
+  static const uint8_t RLE = 1;
+  static const uint8_t SMOOTH = 2;
+  static const uint8_t MISSING = 0xFF;
+
+  const uint8_t* data;       // PROGMEM
+  const PackedGlyph* glyphs; // PROGMEM
+  const uint8_t* index;      // PROGMEM, glyph number for each code first..last, or MISSING
+  uint8_t first;
+  uint8_t last;
+  uint8_t yAdvance;
+  uint8_t encoding;
+};
+
+// Draws PackedFont text as horizontal spans rather than pixel by pixel. The surface is an
+// Adafruit_GFX or anything else with startWrite(), endWrite(), writeFastHLine() and
+// writeFillRect() (TextRunCache renders into plain pixel buffers this way).
+class PackedText {
+public:
+  // Draw text with its baseline at y and return the x after the last character. At size > 1
+  // every font pixel becomes a size x size block, as with Adafruit_GFX::setTextSize().
+  // SMOOTH fonts have no background to blend with here, so their edges are cut at half coverage.
+  template <typename Surface>
+  static int16_t draw(Surface& gfx, const PackedFont& font, int16_t x, int16_t y, const char* text, uint16_t color,
+    uint8_t size = 1) {
+    uint16_t shades[16];
+    for (uint8_t coverage = 0; coverage < 16; coverage++) {
+      shades[coverage] = color;
+    }
+    return drawGlyphs(gfx, font, x, y, text, color, shades, 8, size);
+  }
+
+  // Draw text over a known solid background. SMOOTH font edges are blended with it; other
+  // fonts draw exactly as draw() does. Pixels left clear are not written.
+  template <typename Surface>
+  static int16_t drawBlended(Surface& gfx, const PackedFont& font, int16_t x, int16_t y, const char* text, uint16_t color,
+    uint16_t background) {
+    uint16_t shades[16];
+    for (uint8_t coverage = 0; coverage < 16; coverage++) {
+      shades[coverage] = blend(color, background, coverage);
+    }
+    return drawGlyphs(gfx, font, x, y, text, color, shades, 1, 1);
+  }
+
+  // Box covering every glyph's pixels, relative to the pen position and baseline (size 1)
+  static void bounds(const PackedFont& font, const char* text, int16_t& left, int16_t& top, int16_t& width,
+    int16_t& height) {
+    int16_t x = 0;
+    int16_t right = 0;
+    int16_t bottom = 0;
+    bool empty = true;
+    left = 0;
+    top = 0;
+    for (const char* c = text; *c != '\0'; c++) {
+      PackedGlyph glyph;
+      if (!readGlyph(font, *c, glyph)) {
+        continue;
+      }
+
+      if (glyph.width > 0 && glyph.height > 0) {
+        int16_t glyphLeft = x + glyph.xOffset;
+        int16_t glyphRight = glyphLeft + glyph.width;
+        int16_t glyphBottom = glyph.yOffset + glyph.height;
+        left = empty || glyphLeft < left ? glyphLeft : left;
+        top = empty || glyph.yOffset < top ? glyph.yOffset : top;
+        right = empty || glyphRight > right ? glyphRight : right;
+        bottom = empty || glyphBottom > bottom ? glyphBottom : bottom;
+        empty = false;
+      }
+      x += glyph.xAdvance;
+    }
+    width = right - left;
+    height = bottom - top;
+  }
+
+  // color mixed into background by coverage / 15, per RGB565 channel
+  static uint16_t blend(uint16_t color, uint16_t background, uint8_t coverage) {
+    return (mix(color >> 11, background >> 11, coverage) << 11) |
+      (mix((color >> 5) & 0x3F, (background >> 5) & 0x3F, coverage) << 5) | mix(color & 0x1F, background & 0x1F, coverage);
+  }
+
+  // Total advance of the text, i.e. how far draw() moves along
+  static int16_t measure(const PackedFont& font, const char* text, uint8_t size = 1) {
+    int16_t width = 0;
+    for (const char* c = text; *c != '\0'; c++) {
+      PackedGlyph glyph;
+      if (readGlyph(font, *c, glyph)) {
+        width += glyph.xAdvance * size;
+      }
+    }
+    return width;
+  }
+
+private:
+  // Walks a nibble stream two nibbles to the byte, high nibble first
+  struct NibbleReader {
+    const uint8_t* bytes;
+    bool lowPending; // The low nibble of `packed` is still to be read
+    uint8_t packed;
+
+    explicit NibbleReader(const uint8_t* start) : bytes(start), lowPending(false), packed(0) {
+    }
+
+    uint8_t next() {
+      if (lowPending) {
+        lowPending = false;
+        return packed & 0x0F;
+      }
+      packed = pgm_read_byte(bytes++);
+      lowPending = true;
+      return packed >> 4;
+    }
+  };
+
+  static uint16_t mix(int32_t ink, int32_t paper, uint8_t coverage) {
+    return (uint16_t)(paper + ((ink - paper) * coverage + (ink > paper ? 7 : -7)) / 15);
+  }
+
+  template <typename Surface>
+  static int16_t drawGlyphs(Surface& gfx, const PackedFont& font, int16_t x, int16_t y, const char* text, uint16_t color,
+    const uint16_t* shades, uint8_t minCoverage, uint8_t size) {
+    gfx.startWrite();
+    for (const char* c = text; *c != '\0'; c++) {
+      PackedGlyph glyph;
+      if (!readGlyph(font, *c, glyph)) {
+        continue;
+      }
+
+      if (glyph.width > 0 && glyph.height > 0) {
+        const uint8_t* bitmap = font.data + glyph.offset;
+        int16_t left = x + glyph.xOffset * size;
+        int16_t top = y + glyph.yOffset * size;
+        if (font.encoding == PackedFont::SMOOTH) {
+          drawSmoothGlyph(gfx, glyph, bitmap, left, top, shades, minCoverage, size);
+        }
+        else if (font.encoding == PackedFont::RLE) {
+          drawRunGlyph(gfx, glyph, bitmap, left, top, color, size);
+        }
+        else {
+          drawBitGlyph(gfx, glyph, bitmap, left, top, color, size);
+        }
+      }
+      x += glyph.xAdvance * size;
+    }
+    gfx.endWrite();
+    return x;
+  }
+
+  static bool readGlyph(const PackedFont& font, char c, PackedGlyph& glyph) {
+    uint8_t code = (uint8_t)c;
+    if (code < font.first || code > font.last) {
+      return false;
+    }
+
+    uint8_t number = pgm_read_byte(font.index + code - font.first);
+    if (number == PackedFont::MISSING) {
+      return false;
+    }
+    memcpy_P(&glyph, &font.glyphs[number], sizeof(glyph));
+    return true;
+  }
+
+  template <typename Surface>
+  static void drawSpan(Surface& gfx, int16_t left, int16_t top, int16_t column, int16_t row, int16_t length,
+    uint16_t color, uint8_t size) {
+    if (size == 1) {
+      gfx.writeFastHLine(left + column, top + row, length, color);
+    }
+    else {
+      gfx.writeFillRect(left + column * size, top + row * size, length * size, size, color);
+    }
+  }
+
+  template <typename Surface>
+  static void drawBitGlyph(Surface& gfx, const PackedGlyph& glyph, const uint8_t* bitmap, int16_t left, int16_t top,
+    uint16_t color, uint8_t size) {
+    uint8_t bits = 0;
+    uint16_t bit = 0;
+    for (int16_t row = 0; row < glyph.height; row++) {
+      int16_t runStart = -1;
+      for (int16_t column = 0; column < glyph.width; column++) {
+        if ((bit++ & 7) == 0) {
+          bits = pgm_read_byte(bitmap++);
+        }
+        bool ink = (bits & 0x80) != 0;
+        bits <<= 1;
+
+        if (ink && runStart < 0) {
+          runStart = column;
+        }
+        else if (!ink && runStart >= 0) {
+          drawSpan(gfx, left, top, runStart, row, column - runStart, color, size);
+          runStart = -1;
+        }
+      }
+      if (runStart >= 0) {
+        drawSpan(gfx, left, top, runStart, row, glyph.width - runStart, color, size);
+      }
+    }
+  }
+
+  template <typename Surface>
+  static void drawRunGlyph(Surface& gfx, const PackedGlyph& glyph, const uint8_t* runs, int16_t left, int16_t top,
+    uint16_t color, uint8_t size) {
+    int32_t remaining = (int32_t)glyph.width * glyph.height;
+    int16_t column = 0;
+    int16_t row = 0;
+    bool ink = false;
+    NibbleReader reader(runs);
+
+    while (remaining > 0) {
+      int32_t length = 0;
+      uint8_t nibble;
+      do {
+        nibble = reader.next();
+        length += nibble;
+      } while (nibble == 15);
+
+      if (length > remaining) {
+        length = remaining;
+      }
+      remaining -= length;
+
+      // Ink runs may wrap onto following rows; background runs are just skipped
+      while (ink && length > 0) {
+        int16_t span = length < glyph.width - column ? length : glyph.width - column;
+        drawSpan(gfx, left, top, column, row, span, color, size);
+        column += span;
+        length -= span;
+        if (column == glyph.width) {
+          column = 0;
+          row++;
+        }
+      }
+      if (!ink) {
+        column += length % glyph.width;
+        row += length / glyph.width;
+        if (column >= glyph.width) {
+          column -= glyph.width;
+          row++;
+        }
+      }
+      ink = !ink;
+    }
+  }
+
+  // Coverage below minCoverage is left undrawn; the rest is drawn in its shade
+  template <typename Surface>
+  static void drawSmoothGlyph(Surface& gfx, const PackedGlyph& glyph, const uint8_t* runs, int16_t left, int16_t top,
+    const uint16_t* shades, uint8_t minCoverage, uint8_t size) {
+    int32_t count = (int32_t)glyph.width * glyph.height;
+    int32_t pixel = 0;
+    NibbleReader reader(runs);
+
+    while (pixel < count) {
+      uint8_t coverage = reader.next();
+      int32_t length = 1;
+      if (coverage == 0 || coverage == 15) {
+        length += reader.next();
+      }
+      if (length > count - pixel) {
+        length = count - pixel;
+      }
+
+      if (coverage >= minCoverage) {
+        int16_t row = pixel / glyph.width;
+        int16_t column = pixel % glyph.width;
+        int32_t remaining = length;
+        while (remaining > 0) {
+          int16_t span = remaining < glyph.width - column ? remaining : glyph.width - column;
+          drawSpan(gfx, left, top, column, row, span, shades[coverage], size);
+          remaining -= span;
+          column = 0;
+          row++;
+        }
+      }
+      pixel += length;
+    }
+  }
+};
@@ -1,9 +1,10 @@
 // PoolTemperature.h
 #pragma once
-#include <ArduinoJson.h>
 #include <WiFi.h>
 #include "Logger.h"
 #include "HttpClient.h"
+#include "JsonStreamParser.h"
+#include "WeatherFields.h"
 #include "TimeManager.h"
 
 struct PoolTemperatureData {
@@ -14,55 +15,109 @@ struct PoolTemperatureData {
   bool isValid;
 };
 
+constexpr FieldBinding<PoolTemperatureData> POOL_FIELDS[] = {
+  { "id", &PoolTemperatureData::id },
+  { "temperature", &PoolTemperatureData::temperature },
+  { "date", &PoolTemperatureData::timestamp },
+};
+
+// Picks the top-level POOL_FIELDS out of a streamed pool response; all of them are required
+class PoolStreamHandler : public JsonStreamHandler {
+private:
+  static const uint32_t ALL_FIELDS = (1UL << (sizeof(POOL_FIELDS) / sizeof(POOL_FIELDS[0]))) - 1;
+
+  PoolTemperatureData& data;
+  uint32_t found;
+
+public:
+  PoolStreamHandler(PoolTemperatureData& data) : data(data), found(0) {
+  }
+
+  void reset() {
+    found = 0;
+  }
+
+  bool hasRequiredFields() const {
+    return found == ALL_FIELDS;
+  }
+
+  void onValue(const JsonStreamParser& parser, const char* value, JsonValueType type) override {
+    if (parser.getDepth() != 1 || type == JsonValueType::Null) {
+      return;
+    }
+
+    int index = findField(POOL_FIELDS, parser.currentKeyHash());
+    if (index >= 0) {
+      storeField(POOL_FIELDS[index], data, value);
+      found |= 1UL << index;
+    }
+  }
+};
+
 class PoolTemperature {
 private:
   SimpleHttpClient httpClient;
   TimeManager* timeManager;
+  PoolTemperatureData data;
+  PoolStreamHandler handler;
+  JsonStreamParser parser;
 
 public:
-  PoolTemperature(TimeManager* timeManager) : timeManager(timeManager) {
+  PoolTemperature(TimeManager* timeManager)
+    : timeManager(timeManager), data({ "", 0.0f, 0, "", false }), handler(data), parser(&handler) {
+    // The pool API only works with connectSSL(); tomorrow.io uses the default connect()
+    httpClient.setTlsConnect(TlsConnect::ConnectSSL);
   }
 
-  PoolTemperatureData fetchPoolData() {
+  // Start a non-blocking fetch; drive it with pollFetch() from loop()
+  bool beginFetch() {
     Logger::log("=== Starting pool temperature fetch ===");
-    PoolTemperatureData data = { "", 0.0f, 0, "", false };
+    data = { "", 0.0f, 0, "", false };
+    handler.reset();
+    parser.reset();
 
     Logger::log("Making HTTP request to pool API...");
-    HttpResponse response = httpClient.get("api.canwegointhepool.com", "/app/read");
-    Logger::log("HTTP request completed");
+    return httpClient.begin("api.canwegointhepool.com", "/app/read", parser);
+  }
 
-    if (!response.isSuccess) {
-      Logger::log("Failed to fetch pool data: " + response.error);
-      return data;
+  // Advance an in-flight fetch; returns true once it has finished, successfully or not
+  bool pollFetch() {
+    if (!httpClient.isBusy()) {
+      return true;
     }
 
-    Logger::log("Pool API response: " + response.body);
-
-    if (parsePoolJson(response.body, data)) {
-      data.timeAgo = timeManager->formatTimeAgo(data.timestamp);
-      data.isValid = true;
-      Logger::log("Pool data parsed successfully");
-    }
-    else {
-      Logger::log("Failed to parse pool data");
+    httpClient.poll();
+    if (httpClient.isBusy()) {
+      return false;
     }
 
+    finishFetch();
+    return true;
+  }
+
+  PoolTemperatureData getData() const {
+    return data;
+  }
+
+  PoolTemperatureData fetchPoolData() {
+    if (beginFetch()) {
+      while (!pollFetch()) {
+        delay(1);
+      }
+    }
     return data;
   }
 
   bool parsePoolJson(const String& jsonString, PoolTemperatureData& data) {
-    DynamicJsonDocument doc(1024);
+    PoolStreamHandler handler(data);
+    JsonStreamParser parser(&handler);
 
-    DeserializationError error = deserializeJson(doc, jsonString);
-    if (error) {
-      Logger::log("Pool JSON parsing failed: " + String(error.c_str()));
+    if (!parser.feed(jsonString.c_str(), jsonString.length()) || !parser.finish()) {
+      Logger::log("Pool JSON parsing failed");
       return false;
     }
 
-    if (doc["id"] && doc["temperature"] && doc["date"]) {
-      data.id = doc["id"].as<String>();
-      data.temperature = doc["temperature"] | 0.0f;
-      data.timestamp = doc["date"] | 0UL;
+    if (handler.hasRequiredFields()) {
       return true;
     }
 
@@ -70,8 +125,6 @@ public:
     return false;
   }
 
-public:
-
   // Load test data for offline mode
   PoolTemperatureData loadTestData() {
     const char* testPoolJson = R"({
@@ -89,4 +142,23 @@ public:
 
     return data;
   }
+
+private:
+  void finishFetch() {
+    Logger::log("HTTP request completed");
+    const HttpResponse& response = httpClient.getResponse();
+    if (!response.isSuccess) {
+      Logger::log("Failed to fetch pool data: " + response.error);
+      return;
+    }
+
+    if (handler.hasRequiredFields()) {
+      data.timeAgo = timeManager->formatTimeAgo(data.timestamp);
+      data.isValid = true;
+      Logger::log("Pool data parsed successfully");
+    }
+    else {
+      Logger::log("Failed to parse pool data");
+    }
+  }
 };
\ No newline at end of file
@@ -0,0 +1,164 @@
+// Slides.h - The slideshow as a constexpr table of slides and the cached display lists drawn from it
+#pragma once
+#include <Arduino.h>
+#include "Colors.h"
+#include "WeatherRealtime.h"
+#include "PoolTemperature.h"
+
+// Icons drawn in the middle of value slides (see Display::drawIcon)
+enum SlideIcon {
+  ICON_TEMPERATURE,
+  ICON_UV,
+  ICON_HUMIDITY,
+  ICON_WIND,
+  ICON_CLOUD,
+  ICON_POOL,
+  ICON_COUNT,
+  ICON_NONE = ICON_COUNT
+};
+
+// Slides in slideshow order; also the index into SLIDES
+enum SlideId {
+  SLIDE_TEMPERATURE,
+  SLIDE_UV,
+  SLIDE_HUMIDITY,
+  SLIDE_WIND,
+  SLIDE_CLOUD,
+  SLIDE_POOL,
+  SLIDE_CONDITIONS,
+  SLIDE_COUNT
+};
+
+enum SlideLayout {
+  SLIDE_LAYOUT_VALUE,     // Title, centered icon and a large value over a color picked by the value
+  SLIDE_LAYOUT_CONDITIONS // Current conditions and the forecast column (Display::drawConditionsSlide)
+};
+
+// Shown on a value slide whose source has nothing to show
+const char* const NO_SLIDE_VALUE = "No data";
+
+// Everything slide values are read from
+struct SlideSources {
+  const RealtimeWeatherData& weather;
+  const PoolTemperatureData& pool;
+};
+
+// Background for values at or above `minimum`. Bands are listed from the highest minimum down.
+struct ColorBand {
+  float minimum;
+  uint16_t color;
+};
+
+struct SlideDefinition {
+  SlideId id;
+  SlideLayout layout;
+  const char* title;
+  SlideIcon icon;
+  bool (*read)(const SlideSources& sources, float& value); // false when the source has no value
+  uint8_t decimals;                                       // Value formatting: decimals, then the unit
+  const char* unit;
+  const ColorBand* bands;
+  uint8_t bandCount;
+  uint16_t background; // Below every band, without bands, or without a value
+};
+
+// Value accessors for the slide table
+struct SlideValues {
+  static bool temperature(const SlideSources& sources, float& value) {
+    value = sources.weather.temperature;
+    return true;
+  }
+
+  static bool uvIndex(const SlideSources& sources, float& value) {
+    value = sources.weather.uvIndex;
+    return true;
+  }
+
+  static bool humidity(const SlideSources& sources, float& value) {
+    value = sources.weather.humidity;
+    return true;
+  }
+
+  static bool windSpeed(const SlideSources& sources, float& value) {
+    value = sources.weather.windSpeed;
+    return true;
+  }
+
+  static bool cloudCover(const SlideSources& sources, float& value) {
+    value = sources.weather.cloudCover;
+    return true;
+  }
+
+  static bool poolTemperature(const SlideSources& sources, float& value) {
+    value = sources.pool.temperature;
+    return sources.pool.isValid;
+  }
+};
+
+constexpr ColorBand TEMPERATURE_BANDS[] = { { 30, RED_ORANGE }, { 20, FOREST_GREEN }, { 15, DEEP_SKY_BLUE } };
+constexpr ColorBand UV_BANDS[] = { { 8, RED }, { 6, ORANGE }, { 3, YELLOW } };
+constexpr ColorBand POOL_BANDS[] = { { 25, TURQUOISE }, { 20, TEAL }, { 15, STEEL_BLUE } };
+
+// A new slide is a row here (and an id above); value slides need no drawing code
+constexpr SlideDefinition SLIDES[] = {
+  { SLIDE_TEMPERATURE, SLIDE_LAYOUT_VALUE, "Temperature", ICON_TEMPERATURE, &SlideValues::temperature, 1, "C",
+    TEMPERATURE_BANDS, 3, DARK_BLUE },
+  { SLIDE_UV, SLIDE_LAYOUT_VALUE, "UV Index", ICON_UV, &SlideValues::uvIndex, 2, "", UV_BANDS, 3, DARK_SEA_GREEN },
+  { SLIDE_HUMIDITY, SLIDE_LAYOUT_VALUE, "Humidity", ICON_HUMIDITY, &SlideValues::humidity, 1, "%", nullptr, 0, NAVY_BLUE },
+  { SLIDE_WIND, SLIDE_LAYOUT_VALUE, "Wind Speed", ICON_WIND, &SlideValues::windSpeed, 1, "km/h", nullptr, 0, STORM_GRAY },
+  { SLIDE_CLOUD, SLIDE_LAYOUT_VALUE, "Cloud Cover", ICON_CLOUD, &SlideValues::cloudCover, 2, "%", nullptr, 0, CLOUD_GRAY },
+  { SLIDE_POOL, SLIDE_LAYOUT_VALUE, "Pool Temp", ICON_POOL, &SlideValues::poolTemperature, 1, "C", POOL_BANDS, 3,
+    DARK_SLATE_BLUE },
+  { SLIDE_CONDITIONS, SLIDE_LAYOUT_CONDITIONS, "Conditions", ICON_NONE, nullptr, 0, "", nullptr, 0, DEEP_SKY_BLUE },
+};
+
+// Background of a slide showing `value`
+constexpr uint16_t getSlideBackground(const SlideDefinition& slide, float value, uint8_t band = 0) {
+  return band >= slide.bandCount ? slide.background
+    : value >= slide.bands[band].minimum ? slide.bands[band].color
+    : getSlideBackground(slide, value, band + 1);
+}
+
+constexpr bool slidesInIdOrder(size_t index = 0) {
+  return index >= SLIDE_COUNT || (SLIDES[index].id == (SlideId)index && slidesInIdOrder(index + 1));
+}
+
+static_assert(sizeof(SLIDES) / sizeof(SLIDES[0]) == SLIDE_COUNT, "one slide definition per slide id");
+static_assert(slidesInIdOrder(), "slide definitions are listed in id order");
+static_assert(getSlideBackground(SLIDES[SLIDE_TEMPERATURE], 22.5f) == FOREST_GREEN, "color bands");
+static_assert(getSlideBackground(SLIDES[SLIDE_UV], 1) == DARK_SEA_GREEN, "values below every band use the background");
+
+// What a value slide draws, kept between frames. Rebuilding formats the value and picks
+// the background; that happens only when the bound value changes, not on every draw.
+struct SlideDisplayList {
+  static const int MAX_TEXT = 16;
+
+  bool built;
+  bool hasValue;
+  float value;
+  uint16_t background;
+  char text[MAX_TEXT];
+
+  // Bring the list up to date with the slide's value; true if it had to be rebuilt
+  bool update(const SlideDefinition& slide, const SlideSources& sources) {
+    float current = 0;
+    bool available = slide.read != nullptr && slide.read(sources, current);
+    if (built && available == hasValue && (!available || current == value)) {
+      return false;
+    }
+
+    built = true;
+    hasValue = available;
+    value = current;
+    if (!available) {
+      background = slide.background;
+      snprintf(text, sizeof(text), "%s", NO_SLIDE_VALUE);
+      return true;
+    }
+
+    background = getSlideBackground(slide, current);
+    String formatted = String(current, slide.decimals) + slide.unit;
+    snprintf(text, sizeof(text), "%s", formatted.c_str());
+    return true;
+  }
+};
@@ -0,0 +1,213 @@
+// SnapshotCodec.h - Compact binary encoding of realtime, pool and forecast data
+#pragma once
+#include <Arduino.h>
+#include "WeatherRealtime.h"
+#include "WeatherForecast.h"
+#include "PoolTemperature.h"
+
+// Field-by-field layouts shared by WarmStartCache records and WeatherChannel messages.
+// Values are little-endian as stored in memory; forecast days and timelines store only
+// the entries in use, each preceded by a count (u8). isValid flags are left to the caller.
+//
+// A Writer has put<T>(value) and write(data, length); a Reader has get<T>() and
+// read(data, length). WarmStartCache's RecordFile is one, ByteWriter/ByteReader another.
+struct SnapshotCodec {
+  static const int POOL_ID_LENGTH = 63;
+
+  template <typename Writer>
+  static void writeRealtime(Writer& out, const RealtimeWeatherData& realtime) {
+    out.put(realtime.temperature);
+    out.put(realtime.uvIndex);
+    out.put(realtime.humidity);
+    out.put(realtime.windSpeed);
+    out.put(realtime.windDirection);
+    out.put(realtime.cloudCover);
+    out.put((uint16_t)realtime.weatherCode);
+  }
+
+  template <typename Reader>
+  static void readRealtime(Reader& in, RealtimeWeatherData& realtime) {
+    realtime.temperature = in.template get<float>();
+    realtime.uvIndex = in.template get<float>();
+    realtime.humidity = in.template get<float>();
+    realtime.windSpeed = in.template get<float>();
+    realtime.windDirection = in.template get<float>();
+    realtime.cloudCover = in.template get<float>();
+    realtime.weatherCode = in.template get<uint16_t>();
+  }
+
+  // Id, temperature and timestamp; timeAgo is derived and not stored
+  template <typename Writer>
+  static void writePool(Writer& out, const PoolTemperatureData& pool) {
+    uint8_t idLength = pool.id.length() < POOL_ID_LENGTH ? pool.id.length() : POOL_ID_LENGTH;
+    out.put(pool.temperature);
+    out.put((uint32_t)pool.timestamp);
+    out.put(idLength);
+    out.write(pool.id.c_str(), idLength);
+  }
+
+  template <typename Reader>
+  static bool readPool(Reader& in, PoolTemperatureData& pool) {
+    char id[POOL_ID_LENGTH + 1];
+    pool.temperature = in.template get<float>();
+    pool.timestamp = in.template get<uint32_t>();
+    uint8_t idLength = in.template get<uint8_t>();
+    if (idLength > POOL_ID_LENGTH) {
+      return false;
+    }
+    in.read(id, idLength);
+    id[idLength] = '\0';
+    pool.id = String(id);
+    pool.timeAgo = "";
+    return true;
+  }
+
+  template <typename Writer>
+  static void writeForecast(Writer& out, const ForecastData& forecast) {
+    out.put((uint8_t)forecast.dayCount);
+    for (int i = 0; i < forecast.dayCount; i++) {
+      const DailyForecastData& day = forecast.daily[i];
+      out.write(day.date, sizeof(day.date) - 1);
+      out.put(day.cloudCoverAvg);
+      out.put(day.temperatureApparentAvg);
+      out.put(day.temperatureAvg);
+      out.put(day.uvIndexAvg);
+      out.put(day.windSpeedAvg);
+      out.put(day.windDirectionAvg);
+      out.put((uint16_t)day.weatherCode);
+      out.put((uint8_t)day.isValid);
+    }
+    writeTimeline(out, forecast.hourly, forecast.hourCount);
+    writeTimeline(out, forecast.minutely, forecast.minuteCount);
+  }
+
+  // False if a count is out of range; the forecast may then be partly overwritten
+  template <typename Reader>
+  static bool readForecast(Reader& in, ForecastData& forecast) {
+    uint8_t dayCount = in.template get<uint8_t>();
+    if (dayCount > ForecastData::MAX_DAYS) {
+      return false;
+    }
+    for (int i = 0; i < dayCount; i++) {
+      DailyForecastData& day = forecast.daily[i];
+      in.read(day.date, sizeof(day.date) - 1);
+      day.date[sizeof(day.date) - 1] = '\0';
+      day.cloudCoverAvg = in.template get<float>();
+      day.temperatureApparentAvg = in.template get<float>();
+      day.temperatureAvg = in.template get<float>();
+      day.uvIndexAvg = in.template get<float>();
+      day.windSpeedAvg = in.template get<float>();
+      day.windDirectionAvg = in.template get<float>();
+      day.weatherCode = in.template get<uint16_t>();
+      day.isValid = in.template get<uint8_t>() != 0;
+    }
+    forecast.dayCount = dayCount;
+    return readTimeline(in, forecast.hourly, forecast.hourCount, ForecastData::MAX_HOURS) &&
+      readTimeline(in, forecast.minutely, forecast.minuteCount, ForecastData::MAX_MINUTES);
+  }
+
+private:
+  template <typename Writer>
+  static void writeTimeline(Writer& out, const TimelineEntry* entries, int count) {
+    out.put((uint8_t)count);
+    for (int i = 0; i < count; i++) {
+      out.put((uint32_t)entries[i].time);
+      out.put(entries[i].temperature);
+      out.put(entries[i].uvIndex);
+      out.put(entries[i].humidity);
+      out.put(entries[i].windSpeed);
+      out.put(entries[i].windDirection);
+      out.put(entries[i].cloudCover);
+      out.put((uint16_t)entries[i].weatherCode);
+    }
+  }
+
+  template <typename Reader>
+  static bool readTimeline(Reader& in, TimelineEntry* entries, int& count, int capacity) {
+    uint8_t stored = in.template get<uint8_t>();
+    if (stored > capacity) {
+      return false;
+    }
+    for (int i = 0; i < stored; i++) {
+      entries[i].time = in.template get<uint32_t>();
+      entries[i].temperature = in.template get<float>();
+      entries[i].uvIndex = in.template get<float>();
+      entries[i].humidity = in.template get<float>();
+      entries[i].windSpeed = in.template get<float>();
+      entries[i].windDirection = in.template get<float>();
+      entries[i].cloudCover = in.template get<float>();
+      entries[i].weatherCode = in.template get<uint16_t>();
+    }
+    count = stored;
+    return true;
+  }
+};
+
+// Writer over a fixed byte buffer; stops and reports !isOk() when it would overflow
+class ByteWriter {
+private:
+  uint8_t* bytes;
+  size_t capacity;
+  size_t length;
+  bool ok;
+
+public:
+  ByteWriter(uint8_t* bytes, size_t capacity) : bytes(bytes), capacity(capacity), length(0), ok(true) {
+  }
+
+  bool isOk() const {
+    return ok;
+  }
+
+  size_t getLength() const {
+    return length;
+  }
+
+  void write(const void* data, size_t count) {
+    if (!ok || count > capacity - length) {
+      ok = false;
+      return;
+    }
+    memcpy(bytes + length, data, count);
+    length += count;
+  }
+
+  template <typename T>
+  void put(T value) {
+    write(&value, sizeof(value));
+  }
+};
+
+// Reader over a byte buffer; reads past the end give zeros and report !isOk()
+class ByteReader {
+private:
+  const uint8_t* bytes;
+  size_t length;
+  size_t position;
+  bool ok;
+
+public:
+  ByteReader(const uint8_t* bytes, size_t length) : bytes(bytes), length(length), position(0), ok(true) {
+  }
+
+  bool isOk() const {
+    return ok;
+  }
+
+  void read(void* data, size_t count) {
+    if (!ok || count > length - position) {
+      ok = false;
+      memset(data, 0, count);
+      return;
+    }
+    memcpy(data, bytes + position, count);
+    position += count;
+  }
+
+  template <typename T>
+  T get() {
+    T value;
+    read(&value, sizeof(value));
+    return value;
+  }
+};
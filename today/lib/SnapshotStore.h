@@ -0,0 +1,235 @@
+// SnapshotStore.h - Seqlock-versioned snapshots of the data the slides show
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include <type_traits>
+#include "WeatherRealtime.h"
+#include "WeatherForecast.h"
+#include "PoolTemperature.h"
+
+// Change mask bits. Realtime fields are numbered as in REALTIME_FIELDS; SNAPSHOT_VALID is
+// set when isValid flips. A first publish reports every bit.
+const uint32_t SNAPSHOT_VALID = 1UL << 31;
+const uint32_t SNAPSHOT_ALL = 0xFFFFFFFFUL;
+const uint32_t POOL_TEMPERATURE = 1UL << 0;
+const uint32_t POOL_TIMESTAMP = 1UL << 1;
+const uint32_t POOL_ID = 1UL << 2;
+const uint32_t FORECAST_DAILY = 1UL << 0;
+const uint32_t FORECAST_HOURLY = 1UL << 1;
+const uint32_t FORECAST_MINUTELY = 1UL << 2;
+
+// PoolTemperatureData without its Strings, so it can be copied word by word
+struct PoolReading {
+  static const int ID_LENGTH = 63;
+
+  char id[ID_LENGTH + 1];
+  float temperature;
+  uint32_t timestamp;
+  bool isValid;
+
+  static PoolReading from(const PoolTemperatureData& pool) {
+    PoolReading reading = {};
+    snprintf(reading.id, sizeof(reading.id), "%s", pool.id.c_str());
+    reading.temperature = pool.temperature;
+    reading.timestamp = pool.timestamp;
+    reading.isValid = pool.isValid;
+    return reading;
+  }
+
+  PoolTemperatureData toPoolData() const {
+    return { String(id), temperature, timestamp, "", isValid };
+  }
+};
+
+template <typename Record>
+inline bool fieldDiffers(const Record& before, const Record& after, const FieldBinding<Record>& field) {
+  if (field.member != nullptr) {
+    return before.*(field.member) != after.*(field.member);
+  }
+  if (field.codeMember != nullptr) {
+    return before.*(field.codeMember) != after.*(field.codeMember);
+  }
+  if (field.textMember != nullptr) {
+    return before.*(field.textMember) != after.*(field.textMember);
+  }
+  return before.*(field.timeMember) != after.*(field.timeMember);
+}
+
+template <typename Record, size_t COUNT>
+inline bool fieldsDiffer(const Record& before, const Record& after, const FieldBinding<Record> (&fields)[COUNT]) {
+  for (size_t i = 0; i < COUNT; i++) {
+    if (fieldDiffers(before, after, fields[i])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline uint32_t snapshotChanges(const RealtimeWeatherData& before, const RealtimeWeatherData& after) {
+  uint32_t changed = before.isValid != after.isValid ? SNAPSHOT_VALID : 0;
+  for (size_t i = 0; i < sizeof(REALTIME_FIELDS) / sizeof(REALTIME_FIELDS[0]); i++) {
+    changed |= fieldDiffers(before, after, REALTIME_FIELDS[i]) ? 1UL << i : 0;
+  }
+  return changed;
+}
+
+inline uint32_t snapshotChanges(const PoolReading& before, const PoolReading& after) {
+  return (before.isValid != after.isValid ? SNAPSHOT_VALID : 0) |
+    (before.temperature != after.temperature ? POOL_TEMPERATURE : 0) |
+    (before.timestamp != after.timestamp ? POOL_TIMESTAMP : 0) | (strcmp(before.id, after.id) != 0 ? POOL_ID : 0);
+}
+
+// Forecast entries are compared field by field, not with memcmp: DailyForecastData and
+// TimelineEntry have padding (and date has bytes past its terminator) that no copy or
+// parse promises to keep equal, so equal entries could count as changed
+inline bool timelinesDiffer(const TimelineEntry* before, int beforeCount, const TimelineEntry* after, int afterCount) {
+  if (beforeCount != afterCount) {
+    return true;
+  }
+  for (int i = 0; i < afterCount; i++) {
+    if (before[i].time != after[i].time || fieldsDiffer(before[i], after[i], TIMELINE_FIELDS)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline bool daysDiffer(const DailyForecastData* before, int beforeCount, const DailyForecastData* after, int afterCount) {
+  if (beforeCount != afterCount) {
+    return true;
+  }
+  for (int i = 0; i < afterCount; i++) {
+    if (before[i].isValid != after[i].isValid || strcmp(before[i].date, after[i].date) != 0 ||
+      fieldsDiffer(before[i], after[i], DAILY_FIELDS)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline uint32_t snapshotChanges(const ForecastData& before, const ForecastData& after) {
+  bool dailyDiffers = daysDiffer(before.daily, before.dayCount, after.daily, after.dayCount);
+  return (before.isValid != after.isValid ? SNAPSHOT_VALID : 0) | (dailyDiffers ? FORECAST_DAILY : 0) |
+    (timelinesDiffer(before.hourly, before.hourCount, after.hourly, after.hourCount) ? FORECAST_HOURLY : 0) |
+    (timelinesDiffer(before.minutely, before.minuteCount, after.minutely, after.minuteCount) ? FORECAST_MINUTELY : 0);
+}
+
+// A copy of a slot as one reader saw it
+template <typename T>
+struct Snapshot {
+  T data;
+  uint32_t version;        // 0 until the first publish, then one more per change
+  unsigned long updatedAt; // millis() when this version was published
+  uint32_t changed;        // Fields that differ from the previous version
+};
+
+// One data source behind a seqlock. A single writer publishes; any number of readers copy
+// the latest version out without locks and without ever holding the writer up.
+//
+// The sequence is odd while a write is under way. A reader copies the words between two
+// loads of the sequence and keeps the copy only if both were the same even number, so it
+// can never see half of one version and half of another. Every word is an atomic accessed
+// relaxed, ordered by the fences, so a racing copy is discarded rather than undefined.
+//
+// read() retries until it gets a clean copy, which only works if the writer can run in the
+// meantime: a reader that can preempt the writer (an ISR, or a thread above the writer's
+// priority on the same core) must use tryRead() and try again later instead.
+template <typename T>
+class SnapshotSlot {
+  static_assert(std::is_trivially_copyable<T>::value, "snapshots are copied word by word");
+
+private:
+  static const size_t DATA_WORDS = (sizeof(T) + 3) / 4;
+  static const size_t WORDS = DATA_WORDS + 2; // Then updatedAt and changed
+
+  std::atomic<uint32_t> sequence;
+  std::atomic<uint32_t> words[WORDS];
+  T last; // Writer only: what was last published, to find the changed fields
+
+public:
+  SnapshotSlot() : sequence(0), last() {
+    for (size_t i = 0; i < WORDS; i++) {
+      words[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  // Writer: publish data as a new version if any field differs; returns the changed fields
+  // (0 if nothing changed and the version stays)
+  uint32_t publish(const T& data, unsigned long updatedAt) {
+    uint32_t start = sequence.load(std::memory_order_relaxed);
+    uint32_t changed = start == 0 ? SNAPSHOT_ALL : snapshotChanges(last, data);
+    if (changed == 0) {
+      return 0;
+    }
+    last = data;
+
+    sequence.store(start + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    storeWords(&data, sizeof(T));
+    words[DATA_WORDS].store((uint32_t)updatedAt, std::memory_order_relaxed);
+    words[DATA_WORDS + 1].store(changed, std::memory_order_relaxed);
+    sequence.store(start + 2, std::memory_order_release);
+    return changed;
+  }
+
+  // One attempt at a clean copy; false (and `out` unusable) if a write got in the way
+  bool tryRead(Snapshot<T>& out) const {
+    uint32_t before = sequence.load(std::memory_order_acquire);
+    if (before & 1) {
+      return false;
+    }
+
+    loadWords(&out.data, sizeof(T));
+    out.updatedAt = words[DATA_WORDS].load(std::memory_order_relaxed);
+    out.changed = words[DATA_WORDS + 1].load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence.load(std::memory_order_relaxed) != before) {
+      return false;
+    }
+    out.version = before / 2;
+    return true;
+  }
+
+  // Copy the latest version, retrying while writes get in the way; returns its version
+  uint32_t read(Snapshot<T>& out) const {
+    while (!tryRead(out)) {
+    }
+    return out.version;
+  }
+
+  // Cheap check for readers that only need to know whether anything changed
+  uint32_t getVersion() const {
+    return sequence.load(std::memory_order_acquire) / 2;
+  }
+
+private:
+  void storeWords(const void* data, size_t length) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i * 4 < length; i++) {
+      uint32_t word = 0;
+      memcpy(&word, bytes + i * 4, length - i * 4 < 4 ? length - i * 4 : 4);
+      words[i].store(word, std::memory_order_relaxed);
+    }
+  }
+
+  void loadWords(void* data, size_t length) const {
+    uint8_t* bytes = (uint8_t*)data;
+    for (size_t i = 0; i * 4 < length; i++) {
+      uint32_t word = words[i].load(std::memory_order_relaxed);
+      memcpy(bytes + i * 4, &word, length - i * 4 < 4 ? length - i * 4 : 4);
+    }
+  }
+};
+
+// The slides' data, one slot per source. Display publishes as data arrives; other threads
+// (the warm-start cache on the network side) read it without locking.
+struct WeatherSnapshots {
+  SnapshotSlot<RealtimeWeatherData> realtime;
+  SnapshotSlot<PoolReading> pool;
+  SnapshotSlot<ForecastData> forecast;
+
+  // Goes up whenever any slot changes; drawings made at one generation are current until it moves
+  uint32_t getGeneration() const {
+    return realtime.getVersion() + pool.getVersion() + forecast.getVersion();
+  }
+};
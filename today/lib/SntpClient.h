@@ -0,0 +1,458 @@
+// SntpClient.h - Non-blocking multi-server SNTP and a frequency-disciplined software clock
+#pragma once
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#include "Logger.h"
+
+// Unix time in microseconds, kept from a local microsecond counter. Corrections smaller
+// than the step threshold are slewed in at 500 ppm so time never jumps or runs backwards;
+// each one also nudges the frequency correction by the drift it reveals, so the clock
+// holds its time between syncs instead of wandering by the crystal's error (tens of ppm).
+//
+// micros() wraps every 71.6 minutes and is extended to 64 bits on every read, so the clock
+// must be read at least that often. SntpClient::poll() reads it, but nothing polls while the
+// network is down; the sketch's ntp task reads it on every run (TimeManager::tickClock()).
+class DisciplinedClock {
+public:
+  typedef unsigned long (*MicrosFunction)();
+
+  static const int64_t STEP_THRESHOLD_US = 128000; // RFC 5905 STEPT: larger offsets are stepped
+  static const int64_t SLEW_DIVISOR = 2000;        // 500 ppm
+  static const int64_t MIN_DRIFT_INTERVAL_US = 30000000; // Shorter intervals say more about network jitter
+
+private:
+  MicrosFunction readMicros;
+  uint32_t lastMicros;
+  int64_t localUs;         // Extended micros()
+  bool set;
+  int64_t baseLocalUs;     // The clock reads baseUnixUs at local time baseLocalUs...
+  int64_t baseUnixUs;
+  int64_t slewUs;          // ...plus this much phase correction, applied at 500 ppm from there
+  float frequencyPpm;      // ...and runs this much faster than the local counter
+  int64_t lastCorrectionLocalUs;
+
+public:
+  DisciplinedClock(MicrosFunction readMicros = micros)
+    : readMicros(readMicros), lastMicros(0), localUs(0), set(false), baseLocalUs(0), baseUnixUs(0), slewUs(0),
+      frequencyPpm(0), lastCorrectionLocalUs(0) {
+  }
+
+  bool isSet() const {
+    return set;
+  }
+
+  // Local counter in microseconds since boot; monotonic and never corrected
+  int64_t getLocalUs() {
+    uint32_t now = readMicros();
+    localUs += (uint32_t)(now - lastMicros);
+    lastMicros = now;
+    return localUs;
+  }
+
+  // Unix time in microseconds (meaningless until isSet())
+  int64_t nowUs() {
+    return timeAt(getLocalUs());
+  }
+
+  // Unix time in milliseconds, or 0 until the first correction
+  uint64_t nowMs() {
+    return set ? (uint64_t)(nowUs() / 1000) : 0;
+  }
+
+  float getFrequencyPpm() const {
+    return frequencyPpm;
+  }
+
+  // Apply a measured offset (true time minus this clock). Returns true if it was stepped.
+  bool correct(int64_t offsetUs) {
+    int64_t local = getLocalUs();
+    int64_t now = timeAt(local);
+
+    if (!set || offsetUs > STEP_THRESHOLD_US || offsetUs < -STEP_THRESHOLD_US) {
+      rebase(local, now + offsetUs, 0);
+      set = true;
+      return true;
+    }
+
+    // Whatever the previous slew had not yet applied is part of this offset but not drift
+    int64_t drift = offsetUs - (slewUs - appliedSlewUs(local - baseLocalUs));
+    int64_t interval = local - lastCorrectionLocalUs;
+    if (interval >= MIN_DRIFT_INTERVAL_US) {
+      // Half of each measurement, so one noisy round cannot throw the frequency far off
+      frequencyPpm += 0.5f * (float)drift * 1e6f / (float)interval;
+      frequencyPpm = max(-500.0f, min(frequencyPpm, 500.0f));
+    }
+    rebase(local, now, offsetUs);
+    return false;
+  }
+
+private:
+  int64_t timeAt(int64_t local) const {
+    int64_t elapsed = local - baseLocalUs;
+    return baseUnixUs + elapsed + (int64_t)((float)elapsed * frequencyPpm * 1e-6f) + appliedSlewUs(elapsed);
+  }
+
+  int64_t appliedSlewUs(int64_t elapsed) const {
+    int64_t slewed = elapsed / SLEW_DIVISOR;
+    return slewUs >= 0 ? (slewed < slewUs ? slewed : slewUs) : (-slewed > slewUs ? -slewed : slewUs);
+  }
+
+  void rebase(int64_t local, int64_t unixUs, int64_t slew) {
+    baseLocalUs = local;
+    baseUnixUs = unixUs;
+    slewUs = slew;
+    lastCorrectionLocalUs = local;
+  }
+};
+
+// One exchange with one server, per RFC 5905 section 8: with T1 our send time, T2 the
+// server's receive time, T3 its transmit time and T4 our receive time,
+//   offset = ((T2 - T1) + (T3 - T4)) / 2,  delay = (T4 - T1) - (T3 - T2)
+// The true offset lies within offset +/- distance, where distance = delay / 2 plus the
+// server's own root delay / 2 and root dispersion.
+struct NtpSample {
+  int64_t offsetUs;
+  int64_t delayUs;
+  int64_t distanceUs;
+  uint8_t stratum;
+};
+
+// Queries every server at once and, a round later, corrects the clock from the replies:
+// samples whose offset intervals disagree with most of the others are dropped as
+// falsetickers (a reduced form of RFC 5905's selection), and the one with the shortest
+// distance wins. Replies are matched to requests by the origin timestamp, which also
+// rejects stray and replayed packets.
+//
+// poll() never waits: it sends, or takes whatever replies have arrived, and returns how
+// long until it next has work. Rounds start every 64 s and stretch to 1024 s while the
+// clock stays within 20 ms; failed rounds retry sooner. Name lookups in beginPacket()
+// are the only blocking calls, and finish before the transmit timestamp is taken.
+class SntpClient {
+public:
+  static const int MAX_SERVERS = 4;
+  static const int PACKET_SIZE = 48;
+  static const unsigned long MIN_POLL_MS = 64000;
+  static const unsigned long MAX_POLL_MS = 1024000;
+  static const unsigned long RETRY_MS = 15000;
+  static const unsigned long REPLY_TIMEOUT_MS = 2000;
+  static const unsigned long RECEIVE_POLL_MS = 1; // Receive times add this much delay at worst
+
+private:
+  static const uint32_t UNIX_EPOCH_NTP = 2208988800UL; // 1970 in NTP seconds since 1900
+
+  struct Server {
+    const char* host;
+    uint64_t sentTimestamp; // Our transmit timestamp, echoed back as the origin
+    int64_t sentUs;
+    bool waiting;
+    bool replied;
+    NtpSample sample;
+  };
+
+  DisciplinedClock& clock;
+  WiFiUDP udp;
+  Server servers[MAX_SERVERS];
+  int serverCount;
+  bool inRound;
+  unsigned long nextRoundMs;   // Local ms
+  unsigned long roundDeadlineMs;
+  unsigned long pollIntervalMs;
+  int failedRounds;
+  int64_t lastOffsetUs;
+  int64_t lastDelayUs;
+  unsigned long rejected;      // Replies that failed validation or selection
+
+public:
+  SntpClient(DisciplinedClock& clock, const char* const* hosts, int hostCount)
+    : clock(clock), serverCount(hostCount < MAX_SERVERS ? hostCount : MAX_SERVERS), inRound(false), nextRoundMs(0),
+      roundDeadlineMs(0), pollIntervalMs(MIN_POLL_MS), failedRounds(0), lastOffsetUs(0), lastDelayUs(0),
+      rejected(0) {
+    for (int i = 0; i < serverCount; i++) {
+      servers[i] = { hosts[i], 0, 0, false, false, {} };
+    }
+  }
+
+  void begin(int localPort = 8888) {
+    udp.begin(localPort);
+    inRound = false;
+    nextRoundMs = localMs();
+  }
+
+  // Start a round early, e.g. when the network comes back
+  void syncSoon() {
+    if (!inRound) {
+      nextRoundMs = localMs();
+    }
+  }
+
+  // Advance by one step; returns the ms until the next poll is useful
+  unsigned long poll() {
+    unsigned long now = localMs();
+    if (!inRound) {
+      if ((long)(now - nextRoundMs) < 0) {
+        return nextRoundMs - now;
+      }
+      startRound(now);
+      return RECEIVE_POLL_MS;
+    }
+
+    receiveReplies();
+    if (waitingFor() > 0 && (long)(now - roundDeadlineMs) < 0) {
+      return RECEIVE_POLL_MS;
+    }
+    finishRound(now);
+    return nextRoundMs - now;
+  }
+
+  bool isSynced() const {
+    return clock.isSet();
+  }
+
+  int64_t getLastOffsetUs() const {
+    return lastOffsetUs;
+  }
+
+  int64_t getLastDelayUs() const {
+    return lastDelayUs;
+  }
+
+  unsigned long getPollIntervalMs() const {
+    return pollIntervalMs;
+  }
+
+  unsigned long getRejected() const {
+    return rejected;
+  }
+
+  // NTP timestamps (32.32 fixed point since 1900) to and from Unix microseconds. Seconds
+  // below 2^31 are read as NTP era 1, so this keeps working past 2036.
+  static uint64_t toNtpTimestamp(int64_t unixUs) {
+    int64_t seconds = unixUs / 1000000;
+    int64_t micros = unixUs % 1000000;
+    if (micros < 0) {
+      seconds--;
+      micros += 1000000;
+    }
+    uint32_t ntpSeconds = (uint32_t)(seconds + UNIX_EPOCH_NTP);
+    uint32_t fraction = (uint32_t)(((uint64_t)micros << 32) / 1000000);
+    return ((uint64_t)ntpSeconds << 32) | fraction;
+  }
+
+  static int64_t toUnixUs(uint64_t timestamp) {
+    int64_t seconds = (int64_t)(timestamp >> 32);
+    if (seconds < 0x80000000LL) {
+      seconds += 0x100000000LL;
+    }
+    int64_t micros = (int64_t)(((timestamp & 0xFFFFFFFFULL) * 1000000 + 0x80000000ULL) >> 32);
+    return (seconds - UNIX_EPOCH_NTP) * 1000000 + micros;
+  }
+
+private:
+  unsigned long localMs() {
+    return (unsigned long)(clock.getLocalUs() / 1000);
+  }
+
+  void startRound(unsigned long now) {
+    inRound = true;
+    roundDeadlineMs = now + REPLY_TIMEOUT_MS;
+    for (int i = 0; i < serverCount; i++) {
+      servers[i].replied = false;
+      servers[i].waiting = sendRequest(i);
+    }
+  }
+
+  // T1 is taken once beginPacket() has resolved the name, so the lookup is not counted as
+  // path delay (half of which would otherwise land in the offset)
+  bool sendRequest(int index) {
+    Server& server = servers[index];
+    if (!udp.beginPacket(server.host, 123)) {
+      Logger::log("NTP: could not resolve ", String(server.host));
+      return false;
+    }
+
+    server.sentUs = clock.nowUs();
+    server.sentTimestamp = toNtpTimestamp(server.sentUs);
+    for (int j = 0; j < index; j++) {
+      // Keep origins unique so each reply matches exactly one request
+      if (servers[j].sentTimestamp == server.sentTimestamp) {
+        server.sentTimestamp++;
+      }
+    }
+
+    uint8_t packet[PACKET_SIZE] = { 0 };
+    packet[0] = (0 << 6) | (4 << 3) | 3; // No leap warning, version 4, mode 3 (client)
+    putTimestamp(packet + 40, server.sentTimestamp);
+    udp.write(packet, PACKET_SIZE);
+    return udp.endPacket();
+  }
+
+  void receiveReplies() {
+    uint8_t packet[PACKET_SIZE];
+    while (udp.parsePacket() > 0) {
+      int64_t receivedUs = clock.nowUs();
+      int length = udp.read(packet, PACKET_SIZE);
+      if (length < PACKET_SIZE) {
+        rejected++;
+        continue;
+      }
+
+      Server* server = findServer(getTimestamp(packet + 24));
+      if (server == nullptr || !parseReply(packet, *server, receivedUs)) {
+        rejected++;
+        continue;
+      }
+      server->waiting = false;
+      server->replied = true;
+    }
+  }
+
+  Server* findServer(uint64_t origin) {
+    for (int i = 0; i < serverCount; i++) {
+      if (servers[i].waiting && servers[i].sentTimestamp == origin) {
+        return &servers[i];
+      }
+    }
+    return nullptr;
+  }
+
+  // RFC 4330 section 5 checks, then the offset and delay
+  bool parseReply(const uint8_t* packet, Server& server, int64_t receivedUs) {
+    uint8_t leap = packet[0] >> 6;
+    uint8_t mode = packet[0] & 0x07;
+    uint8_t stratum = packet[1];
+    uint64_t transmit = getTimestamp(packet + 40);
+
+    if (stratum == 0) {
+      // Kiss-o'-Death: the reference id holds a code such as RATE or DENY
+      char code[5] = { (char)packet[12], (char)packet[13], (char)packet[14], (char)packet[15], '\0' };
+      Logger::log("NTP: " + String(server.host) + " sent kiss code ", String(code));
+      server.waiting = false;
+      return false;
+    }
+    if (mode != 4 || leap == 3 || stratum > 15 || transmit == 0) {
+      return false;
+    }
+
+    int64_t t1 = server.sentUs;
+    int64_t t2 = toUnixUs(getTimestamp(packet + 32));
+    int64_t t3 = toUnixUs(transmit);
+    int64_t t4 = receivedUs;
+    NtpSample& sample = server.sample;
+    sample.offsetUs = ((t2 - t1) + (t3 - t4)) / 2;
+    sample.delayUs = (t4 - t1) - (t3 - t2);
+    sample.delayUs = sample.delayUs > 0 ? sample.delayUs : 0;
+    sample.distanceUs = sample.delayUs / 2 + shortToUs(packet + 4) / 2 + shortToUs(packet + 8);
+    sample.stratum = stratum;
+    return true;
+  }
+
+  void finishRound(unsigned long now) {
+    inRound = false;
+
+    const Server* best = selectServer();
+    if (best == nullptr) {
+      failedRounds++;
+      unsigned long retryMs = RETRY_MS << (failedRounds < 6 ? failedRounds - 1 : 5);
+      retryMs = retryMs < pollIntervalMs ? retryMs : pollIntervalMs;
+      nextRoundMs = now + retryMs;
+      Logger::log("NTP: no usable replies, retrying in " + String(retryMs / 1000) + " s");
+      return;
+    }
+
+    failedRounds = 0;
+    lastOffsetUs = best->sample.offsetUs;
+    lastDelayUs = best->sample.delayUs;
+    bool stepped = clock.correct(lastOffsetUs);
+
+    // Stretch the interval while the clock holds, shrink it when it needed a big correction
+    bool holding = !stepped && lastOffsetUs < 20000 && lastOffsetUs > -20000;
+    if (holding) {
+      pollIntervalMs = pollIntervalMs * 2 < MAX_POLL_MS ? pollIntervalMs * 2 : MAX_POLL_MS;
+    }
+    else {
+      pollIntervalMs = pollIntervalMs / 2 > MIN_POLL_MS ? pollIntervalMs / 2 : MIN_POLL_MS;
+    }
+    nextRoundMs = now + pollIntervalMs;
+
+    Logger::log("NTP: " + String(stepped ? "stepped " : "offset ") + formatMs(lastOffsetUs) + " ms, delay " +
+      formatMs(lastDelayUs) + " ms via " + String(best->host) + " (" + String(countReplies()) + "/" +
+      String(serverCount) + " replied), frequency " + String(clock.getFrequencyPpm(), 2) + " ppm, next in " +
+      String(pollIntervalMs / 1000) + " s");
+  }
+
+  // Keep the samples whose intervals overlap a majority of the others', then take the
+  // shortest distance
+  const Server* selectServer() {
+    const Server* best = nullptr;
+    int replies = countReplies();
+    for (int i = 0; i < serverCount; i++) {
+      const Server& candidate = servers[i];
+      if (!candidate.replied) {
+        continue;
+      }
+
+      int agreeing = 0;
+      for (int j = 0; j < serverCount; j++) {
+        if (servers[j].replied && overlaps(candidate.sample, servers[j].sample)) {
+          agreeing++;
+        }
+      }
+      if (agreeing * 2 <= replies && replies > 1) {
+        Logger::log("NTP: ignoring " + String(candidate.host) + ", offset " + formatMs(candidate.sample.offsetUs) +
+          " ms disagrees with the others");
+        rejected++;
+        continue;
+      }
+      if (best == nullptr || candidate.sample.distanceUs < best->sample.distanceUs) {
+        best = &candidate;
+      }
+    }
+    return best;
+  }
+
+  static bool overlaps(const NtpSample& a, const NtpSample& b) {
+    int64_t gap = a.offsetUs - b.offsetUs;
+    return (gap < 0 ? -gap : gap) <= a.distanceUs + b.distanceUs;
+  }
+
+  int countReplies() const {
+    int replies = 0;
+    for (int i = 0; i < serverCount; i++) {
+      replies += servers[i].replied ? 1 : 0;
+    }
+    return replies;
+  }
+
+  int waitingFor() const {
+    int waiting = 0;
+    for (int i = 0; i < serverCount; i++) {
+      waiting += servers[i].waiting ? 1 : 0;
+    }
+    return waiting;
+  }
+
+  static String formatMs(int64_t us) {
+    return String((float)us / 1000.0f, 1);
+  }
+
+  static uint64_t getTimestamp(const uint8_t* bytes) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) {
+      value = (value << 8) | bytes[i];
+    }
+    return value;
+  }
+
+  static void putTimestamp(uint8_t* bytes, uint64_t value) {
+    for (int i = 7; i >= 0; i--) {
+      bytes[i] = (uint8_t)value;
+      value >>= 8;
+    }
+  }
+
+  // NTP short format (16.16 seconds), as in root delay and root dispersion
+  static int64_t shortToUs(const uint8_t* bytes) {
+    uint32_t value = ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | bytes[3];
+    return (int64_t)(((uint64_t)value * 1000000) >> 16);
+  }
+};
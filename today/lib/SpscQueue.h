@@ -0,0 +1,93 @@
+// SpscQueue.h - Lock-free single-producer/single-consumer queue of variable-length records
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+
+// A byte ring holding records as a length (u16) followed by the record bytes, wrapping
+// at the end of the buffer. One thread pushes and one thread pops; neither ever waits for
+// the other. head and tail count bytes written and read since the start and only grow
+// (wrapping at 2^32), so the ring is empty when they are equal and holds head - tail bytes.
+//
+// The producer copies a record in and then publishes it with a release store of head; the
+// consumer's acquire load of head makes those bytes visible before it reads them, and the
+// same pairing on tail hands space back. This is enough between threads on one core or
+// with coherent caches; across cores without coherence the buffer must be uncached memory.
+template <uint32_t CAPACITY>
+class SpscQueue {
+  static_assert(CAPACITY >= 64 && (CAPACITY & (CAPACITY - 1)) == 0, "capacity is a power of two, at least 64");
+
+private:
+  static const uint32_t LENGTH_SIZE = sizeof(uint16_t);
+
+  uint8_t buffer[CAPACITY];
+  std::atomic<uint32_t> head; // Written only by the producer
+  std::atomic<uint32_t> tail; // Written only by the consumer
+  uint32_t dropped;           // Producer side: records that did not fit
+
+public:
+  SpscQueue() : head(0), tail(0), dropped(0) {
+  }
+
+  // Producer: queue a copy of the record; false (and counted as dropped) if it does not fit
+  bool push(const void* record, uint16_t length) {
+    uint32_t writeAt = head.load(std::memory_order_relaxed);
+    uint32_t readAt = tail.load(std::memory_order_acquire);
+    if (LENGTH_SIZE + length > CAPACITY - (writeAt - readAt)) {
+      dropped++;
+      return false;
+    }
+
+    copyIn(writeAt, &length, LENGTH_SIZE);
+    copyIn(writeAt + LENGTH_SIZE, record, length);
+    head.store(writeAt + LENGTH_SIZE + length, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer: take the oldest record into `record`, setting its length; false when empty.
+  // A record longer than `capacity` is taken off the queue but not copied (false, length set).
+  bool pop(void* record, uint16_t capacity, uint16_t& length) {
+    uint32_t readAt = tail.load(std::memory_order_relaxed);
+    uint32_t writeAt = head.load(std::memory_order_acquire);
+    if (readAt == writeAt) {
+      length = 0;
+      return false;
+    }
+
+    copyOut(readAt, &length, LENGTH_SIZE);
+    bool fits = length <= capacity;
+    if (fits) {
+      copyOut(readAt + LENGTH_SIZE, record, length);
+    }
+    tail.store(readAt + LENGTH_SIZE + length, std::memory_order_release);
+    return fits;
+  }
+
+  bool isEmpty() const {
+    return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+  }
+
+  // Bytes in use, as seen from either side (a snapshot; the other side may be moving)
+  uint32_t size() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+  }
+
+  // Read on the producer side
+  uint32_t getDropped() const {
+    return dropped;
+  }
+
+private:
+  void copyIn(uint32_t position, const void* data, uint32_t length) {
+    uint32_t offset = position & (CAPACITY - 1);
+    uint32_t first = length < CAPACITY - offset ? length : CAPACITY - offset;
+    memcpy(buffer + offset, data, first);
+    memcpy(buffer, (const uint8_t*)data + first, length - first);
+  }
+
+  void copyOut(uint32_t position, void* data, uint32_t length) const {
+    uint32_t offset = position & (CAPACITY - 1);
+    uint32_t first = length < CAPACITY - offset ? length : CAPACITY - offset;
+    memcpy(data, buffer + offset, first);
+    memcpy((uint8_t*)data + first, buffer, length - first);
+  }
+};
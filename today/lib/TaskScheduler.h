@@ -0,0 +1,188 @@
+// TaskScheduler.h - Deadline-based cooperative scheduling of the sketch's periodic work
+#pragma once
+#include <Arduino.h>
+#include "Logger.h"
+
+// loop() work as a table of tasks, each with a deadline. runOnce() runs every task whose
+// deadline has passed, in table order (so earlier tasks win ties), then sleeps until the
+// earliest remaining deadline instead of a fixed delay. After running, a task is due again
+// one period after its deadline, unless it picked its own next wake time with wakeAt() or
+// wakeIn() while running. Tasks must return quickly: a task that blocks delays all others.
+//
+// Time comes from a clock and a sleep function, millis() and delay() by default, so the
+// scheduler can be driven from a virtual clock off the board. Sleeping is accounted, giving
+// the idle fraction: the share of time since the last logStats() spent waiting for deadlines.
+class TaskScheduler {
+public:
+  typedef void (*TaskFunction)();
+  typedef unsigned long (*ClockFunction)();
+  typedef void (*SleepFunction)(unsigned long ms);
+
+  static const int MAX_TASKS = 8;
+  static const int NO_TASK = -1;
+
+private:
+  struct Task {
+    const char* name;
+    TaskFunction run;
+    unsigned long periodMs;
+    unsigned long nextRun;
+    bool enabled;
+    bool rescheduled;    // Chose its own next wake time during this run
+    unsigned long runs;  // Since the last logStats()
+    unsigned long lateMs; // Worst start past the deadline since the last logStats()
+  };
+
+  const char* name; // In logs, where several threads each run a scheduler
+  Task tasks[MAX_TASKS];
+  int taskCount;
+  int runningTask;
+  ClockFunction clock;
+  SleepFunction sleep;
+  unsigned long maxSleepMs;
+  unsigned long statsStart;
+  unsigned long sleptMs;
+
+public:
+  TaskScheduler(const char* name = "Scheduler", ClockFunction clock = millis, SleepFunction sleep = delay,
+    unsigned long maxSleepMs = 1000)
+    : name(name), taskCount(0), runningTask(NO_TASK), clock(clock), sleep(sleep), maxSleepMs(maxSleepMs),
+      statsStart(0), sleptMs(0) {
+  }
+
+  // Add a task that is due immediately and then every periodMs; returns its id, or NO_TASK
+  // when the table is full
+  int addTask(const char* name, TaskFunction run, unsigned long periodMs) {
+    if (taskCount >= MAX_TASKS) {
+      Logger::log("TaskScheduler: no room for task ", String(name));
+      return NO_TASK;
+    }
+
+    unsigned long now = clock();
+    if (taskCount == 0) {
+      statsStart = now;
+    }
+    tasks[taskCount] = { name, run, periodMs, now, true, false, 0, 0 };
+    return taskCount++;
+  }
+
+  // Stop running a task until resume()
+  void suspend(int task) {
+    if (isTask(task)) {
+      tasks[task].enabled = false;
+    }
+  }
+
+  // (Re)start a task, first running it delayMs from now
+  void resume(int task, unsigned long delayMs = 0) {
+    if (isTask(task)) {
+      tasks[task].enabled = true;
+      wakeIn(task, delayMs);
+    }
+  }
+
+  bool isEnabled(int task) const {
+    return isTask(task) && tasks[task].enabled;
+  }
+
+  // Move a task's next deadline to clock time `time`. Called by the task itself, this
+  // replaces the period for the run that follows; from elsewhere it can bring a task forward.
+  void wakeAt(int task, unsigned long time) {
+    if (!isTask(task)) {
+      return;
+    }
+    tasks[task].nextRun = time;
+    if (task == runningTask) {
+      tasks[task].rescheduled = true;
+    }
+  }
+
+  void wakeIn(int task, unsigned long delayMs) {
+    wakeAt(task, clock() + delayMs);
+  }
+
+  // Run every due task once, returning the ms until the next deadline (at most maxSleepMs)
+  unsigned long runDue() {
+    for (int i = 0; i < taskCount; i++) {
+      unsigned long now = clock();
+      Task& task = tasks[i];
+      if (!task.enabled || (long)(now - task.nextRun) < 0) {
+        continue;
+      }
+
+      unsigned long late = now - task.nextRun;
+      task.lateMs = late > task.lateMs ? late : task.lateMs;
+      task.runs++;
+      task.rescheduled = false;
+      runningTask = i;
+      task.run();
+      runningTask = NO_TASK;
+
+      if (!task.rescheduled) {
+        // Keep the cadence of the deadlines rather than of the runs, unless too far behind
+        task.nextRun += task.periodMs;
+        if ((long)(clock() - task.nextRun) >= 0) {
+          task.nextRun = clock() + task.periodMs;
+        }
+      }
+    }
+    return msUntilNextDeadline();
+  }
+
+  // One pass of loop(): run what is due, then sleep until the next deadline
+  void runOnce() {
+    unsigned long waitMs = runDue();
+    if (waitMs > 0) {
+      sleep(waitMs);
+      sleptMs += waitMs;
+    }
+  }
+
+  unsigned long msUntilNextDeadline() const {
+    unsigned long now = clock();
+    unsigned long waitMs = maxSleepMs;
+    for (int i = 0; i < taskCount; i++) {
+      if (!tasks[i].enabled) {
+        continue;
+      }
+      if ((long)(tasks[i].nextRun - now) <= 0) {
+        return 0;
+      }
+      waitMs = tasks[i].nextRun - now < waitMs ? tasks[i].nextRun - now : waitMs;
+    }
+    return waitMs;
+  }
+
+  // Share of the time since the last logStats() spent asleep, 0-1
+  float getIdleFraction() const {
+    unsigned long elapsed = clock() - statsStart;
+    return elapsed == 0 ? 1.0f : (float)sleptMs / elapsed;
+  }
+
+  unsigned long getRuns(int task) const {
+    return isTask(task) ? tasks[task].runs : 0;
+  }
+
+  unsigned long getWorstLateMs(int task) const {
+    return isTask(task) ? tasks[task].lateMs : 0;
+  }
+
+  // Log the idle fraction and each task's runs and worst lateness, then start a new window
+  void logStats() {
+    Logger::log(String(name) + ": " + String(getIdleFraction() * 100.0f, 1) + "% idle over " +
+      String((clock() - statsStart) / 1000) + " s");
+    for (int i = 0; i < taskCount; i++) {
+      Logger::log("  " + String(tasks[i].name) + ": " + String(tasks[i].runs) + " runs, worst " +
+        String(tasks[i].lateMs) + " ms late" + (tasks[i].enabled ? "" : " (suspended)"));
+      tasks[i].runs = 0;
+      tasks[i].lateMs = 0;
+    }
+    statsStart = clock();
+    sleptMs = 0;
+  }
+
+private:
+  bool isTask(int task) const {
+    return task >= 0 && task < taskCount;
+  }
+};
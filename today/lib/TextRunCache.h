@@ -0,0 +1,179 @@
+// TextRunCache.h - Recently drawn anti-aliased text kept as ready-made RGB565 pixels
+#pragma once
+#include <Arduino.h>
+#include "Arduino_GigaDisplay_GFX.h"
+#include "Logger.h"
+#include "FrameBuffer.h"
+#include "PackedFont.h"
+
+// Blending SMOOTH glyphs costs a table walk and a blend per edge pixel. Slide values
+// repeat every cycle ("11.8C" until the next fetch), so each rendered string is kept as
+// a block of pixels over its background and later draws just copy the block. Runs are
+// keyed by text, font, color and background; the least recently used slot is replaced.
+//
+// The block covers the text's whole box, background included, so it is only correct
+// over a solid fill of that background color.
+class TextRunCache {
+public:
+  static const int SLOTS = 8;
+  static const int MAX_TEXT = 16;            // Longer strings are drawn without caching
+  static const int32_t SLOT_PIXELS = 32768;  // 64 KB; the widest slide value, "8.2km/h", is 360 x 82
+
+private:
+  struct Run {
+    char text[MAX_TEXT];
+    const PackedFont* font;
+    uint16_t color;
+    uint16_t background;
+    int16_t left; // Box relative to the pen position and baseline
+    int16_t top;
+    int16_t width;
+    int16_t height;
+    int16_t advance;
+    uint32_t lastUsed; // 0 while the slot is empty
+  };
+
+  // Minimal drawing surface over one slot's pixels, for PackedText
+  struct RunSurface {
+    uint16_t* pixels;
+    int16_t width;
+    int16_t height;
+
+    void startWrite() {
+    }
+
+    void endWrite() {
+    }
+
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      for (int16_t row = y; row < y + h; row++) {
+        writeFastHLine(x, row, w, color);
+      }
+    }
+
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      if (y < 0 || y >= height) {
+        return;
+      }
+      int16_t x0 = x < 0 ? 0 : x;
+      int16_t x1 = x + w > width ? width : x + w;
+      uint16_t* span = pixels + (int32_t)y * width;
+      for (int16_t column = x0; column < x1; column++) {
+        span[column] = color;
+      }
+    }
+  };
+
+  Run runs[SLOTS];
+  uint16_t* pixels; // SLOTS * SLOT_PIXELS, allocated on first use
+  bool allocationFailed;
+  uint32_t useCount;
+  unsigned long hits;
+  unsigned long misses;
+
+public:
+  TextRunCache() : pixels(nullptr), allocationFailed(false), useCount(0), hits(0), misses(0) {
+    clear();
+  }
+
+  ~TextRunCache() {
+    FrameBuffer::freePixels(pixels);
+  }
+
+  // Draw text with its baseline at y over `background`, returning the x after the text.
+  // When `frame` is the surface being drawn to, cached runs are copied straight into it.
+  int16_t draw(Adafruit_GFX& gfx, FrameBuffer* frame, const PackedFont& font, int16_t x, int16_t y, const char* text,
+    uint16_t color, uint16_t background) {
+    const Run* run = find(font, text, color, background);
+    if (run == nullptr) {
+      run = render(font, text, color, background);
+    }
+    if (run == nullptr) {
+      return PackedText::drawBlended(gfx, font, x, y, text, color, background);
+    }
+
+    const uint16_t* runPixels = getPixels(*run);
+    if (frame != nullptr) {
+      frame->blit(x + run->left, y + run->top, runPixels, run->width, run->height);
+    }
+    else {
+      gfx.drawRGBBitmap(x + run->left, y + run->top, (uint16_t*)runPixels, run->width, run->height);
+    }
+    return x + run->advance;
+  }
+
+  void clear() {
+    for (int i = 0; i < SLOTS; i++) {
+      runs[i].lastUsed = 0;
+    }
+  }
+
+  unsigned long getHits() const {
+    return hits;
+  }
+
+  unsigned long getMisses() const {
+    return misses;
+  }
+
+private:
+  uint16_t* getPixels(const Run& run) const {
+    return pixels + (&run - runs) * SLOT_PIXELS;
+  }
+
+  const Run* find(const PackedFont& font, const char* text, uint16_t color, uint16_t background) {
+    for (int i = 0; i < SLOTS; i++) {
+      Run& run = runs[i];
+      if (run.lastUsed != 0 && run.font == &font && run.color == color && run.background == background &&
+        strcmp(run.text, text) == 0) {
+        run.lastUsed = ++useCount;
+        hits++;
+        return &run;
+      }
+    }
+    return nullptr;
+  }
+
+  // Render text into the least recently used slot; nullptr if it cannot be cached
+  const Run* render(const PackedFont& font, const char* text, uint16_t color, uint16_t background) {
+    misses++;
+    int16_t left, top, width, height;
+    PackedText::bounds(font, text, left, top, width, height);
+    if (strlen(text) >= MAX_TEXT || (int32_t)width * height > SLOT_PIXELS || width == 0 || !allocate()) {
+      return nullptr;
+    }
+
+    Run* slot = &runs[0];
+    for (int i = 1; i < SLOTS && slot->lastUsed != 0; i++) {
+      if (runs[i].lastUsed < slot->lastUsed) {
+        slot = &runs[i];
+      }
+    }
+
+    strcpy(slot->text, text);
+    slot->font = &font;
+    slot->color = color;
+    slot->background = background;
+    slot->left = left;
+    slot->top = top;
+    slot->width = width;
+    slot->height = height;
+    slot->lastUsed = ++useCount;
+
+    RunSurface surface = { getPixels(*slot), width, height };
+    surface.writeFillRect(0, 0, width, height, background);
+    slot->advance = PackedText::drawBlended(surface, font, -left, -top, text, color, background) + left;
+    return slot;
+  }
+
+  bool allocate() {
+    if (pixels == nullptr && !allocationFailed) {
+      pixels = FrameBuffer::allocatePixels((size_t)SLOTS * SLOT_PIXELS);
+      if (pixels == nullptr) {
+        Logger::log("TextRunCache: allocation failed, drawing text uncached");
+        allocationFailed = true;
+      }
+    }
+    return pixels != nullptr;
+  }
+};
@@ -1,72 +1,45 @@
 // TimeManager.h - Better time handling for Arduino projects
 #pragma once
-#include <WiFi.h>
-#include <WiFiUdp.h>
 #include "Logger.h"
+#include "SntpClient.h"
 
 class TimeManager {
 private:
-  static WiFiUDP udp;
-  static unsigned long ntpSyncTime;
-  static unsigned long ntpSyncMillis;
-  static bool timeIsSynced;
-
-  static const char* ntpServer;
-  static const int ntpPort = 123;
-  static const int NTP_PACKET_SIZE = 48;
+  static const int NTP_SERVER_COUNT = 3;
+  static const char* const ntpServers[NTP_SERVER_COUNT];
+  static DisciplinedClock clock;
+  static SntpClient sntp;
 
 public:
   static void begin() {
-    udp.begin(8888);
-    timeIsSynced = false;
-    ntpSyncTime = 0;
-    ntpSyncMillis = 0;
+    sntp.begin();
   }
 
-  static bool syncWithNTP() {
-    if (WiFi.status() != WL_CONNECTED) {
-      Logger::log("WiFi not connected - cannot sync NTP");
-      return false;
-    }
-
-    Logger::log("Syncing time with NTP server...");
-
-    // Send NTP request
-    if (!sendNTPRequest()) {
-      Logger::log("Failed to send NTP request");
-      return false;
-    }
+  // Advance NTP without waiting on the network; returns the ms until it next has work.
+  // The first round goes out straight away, and the clock is set when it completes.
+  static unsigned long pollNTP() {
+    return sntp.poll();
+  }
 
-    // Wait for response with timeout
-    unsigned long timeout = millis() + 5000; // 5 second timeout
-    while (millis() < timeout) {
-      if (udp.available()) {
-        unsigned long ntpTime = parseNTPResponse();
-        if (ntpTime > 0) {
-          ntpSyncTime = ntpTime;
-          ntpSyncMillis = millis();
-          timeIsSynced = true;
-
-          Logger::log("NTP sync successful. Unix time: " + String(ntpTime));
-          return true;
-        }
-      }
-      delay(100);
-    }
+  // Carry micros() into the clock. It wraps every 71.6 minutes and a wrap between two reads
+  // is lost, so call this at least that often, with or without the network.
+  static void tickClock() {
+    clock.getLocalUs();
+  }
 
-    Logger::log("NTP sync timeout");
-    return false;
+  // Query the servers again soon, e.g. once the network is back after an outage
+  static void syncSoon() {
+    sntp.syncSoon();
   }
 
   static unsigned long getCurrentUnixTime() {
-    if (!timeIsSynced) {
-      // Return 0 if time is not synced
-      return 0;
-    }
+    // 0 until the first NTP round has set the clock
+    return (unsigned long)(clock.nowMs() / 1000);
+  }
 
-    // Calculate current time based on NTP sync and elapsed millis
-    unsigned long elapsedSeconds = (millis() - ntpSyncMillis) / 1000;
-    return ntpSyncTime + elapsedSeconds;
+  // Unix time in milliseconds, or 0 until synced
+  static uint64_t getCurrentUnixTimeMs() {
+    return clock.nowMs();
   }
 
   static String formatTimeAgo(unsigned long timestamp) {
@@ -92,54 +65,29 @@ public:
     return formatDuration(diffSeconds);
   }
 
-  static bool isTimeSynced() {
-    return timeIsSynced;
-  }
-
-  static void resyncIfNeeded() {
-    // Resync every 24 hours to account for clock drift
-    const unsigned long resyncInterval = 24 * 60 * 60 * 1000; // 24 hours in ms
-
-    if (timeIsSynced && (millis() - ntpSyncMillis > resyncInterval)) {
-      Logger::log("Time sync is stale, re-syncing...");
-      syncWithNTP();
-    }
-  }
-
-private:
-  static bool sendNTPRequest() {
-    byte ntpBuffer[NTP_PACKET_SIZE] = { 0 };
-
-    // Initialize NTP request packet
-    ntpBuffer[0] = 0b11100011;   // LI, Version, Mode
-    ntpBuffer[1] = 0;            // Stratum
-    ntpBuffer[2] = 6;            // Polling interval
-    ntpBuffer[3] = 0xEC;         // Peer Clock Precision
-
-    udp.beginPacket(ntpServer, ntpPort);
-    udp.write(ntpBuffer, NTP_PACKET_SIZE);
-    return udp.endPacket();
-  }
-
-  static unsigned long parseNTPResponse() {
-    if (udp.available() < NTP_PACKET_SIZE) {
+  // Parse an ISO 8601 UTC timestamp ("2025-11-08T01:13:00Z") into Unix seconds
+  static unsigned long parseIso8601(const char* text) {
+    int year, month, day, hour, minute, second;
+    if (sscanf(text, "%4d-%2d-%2dT%2d:%2d:%2d", &year, &month, &day, &hour, &minute, &second) != 6) {
       return 0;
     }
 
-    byte ntpBuffer[NTP_PACKET_SIZE];
-    udp.read(ntpBuffer, NTP_PACKET_SIZE);
+    // Days since epoch using the civil-from-days inverse (proleptic Gregorian)
+    year -= month <= 2;
+    long era = (year >= 0 ? year : year - 399) / 400;
+    unsigned long yearOfEra = (unsigned long)(year - era * 400);
+    unsigned long dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    unsigned long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    long days = era * 146097 + (long)dayOfEra - 719468;
 
-    // Extract timestamp from bytes 40-43 (transmit timestamp)
-    unsigned long timestamp = ((unsigned long)ntpBuffer[40] << 24) |
-      ((unsigned long)ntpBuffer[41] << 16) |
-      ((unsigned long)ntpBuffer[42] << 8) |
-      (unsigned long)ntpBuffer[43];
+    return (unsigned long)days * 86400UL + hour * 3600UL + minute * 60UL + second;
+  }
 
-    // Convert from NTP time (1900 epoch) to Unix time (1970 epoch)
-    const unsigned long seventyYears = 2208988800UL;
-    return timestamp - seventyYears;
+  static bool isTimeSynced() {
+    return clock.isSet();
   }
 
+private:
   static String formatDuration(unsigned long totalSeconds) {
     if (totalSeconds < 60) {
       return String(totalSeconds) + " seconds ago";
@@ -196,8 +144,8 @@ private:
 };
 
 // Static member definitions
-WiFiUDP TimeManager::udp;
-unsigned long TimeManager::ntpSyncTime = 0;
-unsigned long TimeManager::ntpSyncMillis = 0;
-bool TimeManager::timeIsSynced = false;
-const char* TimeManager::ntpServer = "au.pool.ntp.org";
\ No newline at end of file
+const char* const TimeManager::ntpServers[TimeManager::NTP_SERVER_COUNT] = {
+  "0.au.pool.ntp.org", "1.au.pool.ntp.org", "2.au.pool.ntp.org"
+};
+DisciplinedClock TimeManager::clock;
+SntpClient TimeManager::sntp(TimeManager::clock, TimeManager::ntpServers, TimeManager::NTP_SERVER_COUNT);
\ No newline at end of file
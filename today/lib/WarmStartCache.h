@@ -0,0 +1,337 @@
+// WarmStartCache.h - Last good readings persisted to flash for an instant first frame
+#pragma once
+#include <Arduino.h>
+#include <stdio.h>
+#include "Logger.h"
+#include "WeatherRealtime.h"
+#include "WeatherForecast.h"
+#include "PoolTemperature.h"
+#include "SnapshotCodec.h"
+#include "SnapshotStore.h"
+
+#if defined(ARDUINO_GIGA)
+#include "BlockDevice.h"
+#include "MBRBlockDevice.h"
+#include "FATFileSystem.h"
+#endif
+
+// Snapshot of realtime, pool and forecast data written as one compact binary record:
+//
+//   header   magic "TDAY" (u32), version (u16), payload length (u16), CRC-32 of payload (u32)
+//   payload  flags (u8), then realtime, pool and forecast values as SnapshotCodec lays them out
+//
+// A record with the wrong magic, version, length or CRC is ignored, so a layout change
+// (here or in SnapshotCodec) only needs a version bump. On the Giga the file lives on the
+// QSPI flash user partition; elsewhere it is a plain file in the working directory, which
+// stands in for flash on the host.
+class WarmStartCache {
+private:
+  static const uint32_t MAGIC = 0x59414454; // "TDAY"
+  static const uint16_t VERSION = 2;
+  static const int HEADER_SIZE = 12;
+  static const unsigned long MIN_SAVE_INTERVAL_MS = 1800000; // Flash wear: at most every 30 minutes
+
+  static const uint8_t HAS_REALTIME = 0x01;
+  static const uint8_t HAS_POOL = 0x02;
+  static const uint8_t HAS_FORECAST = 0x04;
+
+  static const char* path;
+  static const char* tempPath;
+  static bool mounted;
+  static bool mountFailed;
+  static bool realtimeDerived;
+  static uint32_t savedGeneration; // savedVersions() of what the flash record holds
+  static bool hasSaved;
+  static unsigned long lastSaveTime;
+
+#if defined(ARDUINO_GIGA)
+  static mbed::MBRBlockDevice* partition;
+  static mbed::FATFileSystem* fileSystem;
+#endif
+
+  // Sequential record I/O that keeps a running CRC-32 of everything passed through it
+  class RecordFile {
+  private:
+    FILE* file;
+    uint32_t crc;
+    bool ok;
+
+  public:
+    RecordFile(FILE* file) : file(file), crc(0xFFFFFFFFUL), ok(file != nullptr) {
+    }
+
+    bool isOk() const {
+      return ok;
+    }
+
+    uint32_t getCrc() const {
+      return ~crc;
+    }
+
+    void resetCrc() {
+      crc = 0xFFFFFFFFUL;
+    }
+
+    void write(const void* data, size_t length) {
+      if (ok && fwrite(data, 1, length, file) != length) {
+        ok = false;
+      }
+      update(data, length);
+    }
+
+    // After a failed read everything reads as zeros
+    void read(void* data, size_t length) {
+      if (!ok || fread(data, 1, length, file) != length) {
+        ok = false;
+        memset(data, 0, length);
+      }
+      update(data, length);
+    }
+
+    template <typename T>
+    void put(T value) {
+      write(&value, sizeof(value));
+    }
+
+    template <typename T>
+    T get() {
+      T value;
+      read(&value, sizeof(value));
+      return value;
+    }
+
+  private:
+    void update(const void* data, size_t length) {
+      const uint8_t* bytes = (const uint8_t*)data;
+      for (size_t i = 0; i < length; i++) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; bit++) {
+          crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+        }
+      }
+    }
+  };
+
+public:
+  static bool begin() {
+    if (mounted) {
+      return true;
+    }
+    // An unformatted partition stays that way; don't retry (and log) on every flush
+    if (mountFailed) {
+      return false;
+    }
+
+#if defined(ARDUINO_GIGA)
+    // Partition 2 of the default QSPI layout is the user data area
+    partition = new mbed::MBRBlockDevice(mbed::BlockDevice::get_default_instance(), 2);
+    fileSystem = new mbed::FATFileSystem("cache");
+    if (fileSystem->mount(partition) != 0) {
+      Logger::log("Warm-start cache: flash partition not formatted, cache disabled");
+      delete fileSystem;
+      delete partition;
+      fileSystem = nullptr;
+      partition = nullptr;
+      mountFailed = true;
+      return false;
+    }
+#endif
+
+    mounted = true;
+    return true;
+  }
+
+  // When realtime is interpolated from the forecast (unified fetch mode) it changes every
+  // minute without a fetch; those changes alone don't call for a flash write
+  static void setRealtimeDerived(bool derived) {
+    realtimeDerived = derived;
+  }
+
+  // Record that the snapshots hold what is already on flash (e.g. just loaded from it)
+  static void markSaved(const WeatherSnapshots& snapshots) {
+    savedGeneration = savedVersions(snapshots.realtime.getVersion(), snapshots.pool.getVersion(),
+      snapshots.forecast.getVersion());
+  }
+
+  // Write the snapshots if they changed since the last save and the flash-wear interval has
+  // passed. They are read through their seqlocks, so this can run off the display thread.
+  static bool flushIfDue(const WeatherSnapshots& snapshots) {
+    unsigned long now = millis();
+    uint32_t current = savedVersions(snapshots.realtime.getVersion(), snapshots.pool.getVersion(),
+      snapshots.forecast.getVersion());
+    if (current == savedGeneration || (hasSaved && now - lastSaveTime < MIN_SAVE_INTERVAL_MS)) {
+      return false;
+    }
+
+    static Snapshot<RealtimeWeatherData> realtime;
+    static Snapshot<PoolReading> pool;
+    static Snapshot<ForecastData> forecast;
+    snapshots.realtime.read(realtime);
+    snapshots.pool.read(pool);
+    snapshots.forecast.read(forecast);
+
+    hasSaved = true;
+    lastSaveTime = now;
+    if (!save(realtime.data, pool.data.toPoolData(), forecast.data)) {
+      return false;
+    }
+    // Versions as read: a slot that changed since is saved next time
+    savedGeneration = savedVersions(realtime.version, pool.version, forecast.version);
+    return true;
+  }
+
+  static bool save(const RealtimeWeatherData& realtime, const PoolTemperatureData& pool, const ForecastData& forecast) {
+    if (!begin()) {
+      return false;
+    }
+
+    unsigned long startTime = millis();
+    FILE* file = fopen(tempPath, "wb");
+    if (file == nullptr) {
+      Logger::log("Warm-start cache: cannot open ", String(tempPath));
+      return false;
+    }
+
+    // Reserve the header, stream the payload, then come back for the length and CRC
+    RecordFile record(file);
+    uint8_t header[HEADER_SIZE] = {};
+    record.write(header, HEADER_SIZE);
+    record.resetCrc();
+    long payloadStart = ftell(file);
+    writePayload(record, realtime, pool, forecast);
+    long payloadLength = ftell(file) - payloadStart;
+
+    uint32_t crc = record.getCrc();
+    fseek(file, 0, SEEK_SET);
+    record.put(MAGIC);
+    record.put(VERSION);
+    record.put((uint16_t)payloadLength);
+    record.put(crc);
+
+    bool ok = record.isOk();
+    ok = fclose(file) == 0 && ok;
+
+    // Replace the previous record only once the new one is fully written. POSIX rename
+    // replaces it in one step; FAT refuses to rename over a file, so there the old record
+    // goes first and load() falls back to the temp file if power is cut in between.
+    if (ok && rename(tempPath, path) != 0) {
+      remove(path);
+      ok = rename(tempPath, path) == 0;
+    }
+
+    Logger::log("Warm-start cache " + String(ok ? "saved" : "save failed") + ": " + String(HEADER_SIZE + payloadLength) +
+      " bytes in " + String(millis() - startTime) + " ms");
+    return ok;
+  }
+
+  // Load the last snapshot; only entries the record holds are overwritten. With no record
+  // but a valid temp file, save() was cut off between its remove and rename: finish it.
+  static bool load(RealtimeWeatherData& realtime, PoolTemperatureData& pool, ForecastData& forecast) {
+    if (!begin()) {
+      return false;
+    }
+
+    FILE* file = fopen(path, "rb");
+    if (file != nullptr) {
+      return loadFrom(file, realtime, pool, forecast);
+    }
+
+    file = fopen(tempPath, "rb");
+    if (file == nullptr) {
+      Logger::log("Warm-start cache: no saved record");
+      return false;
+    }
+    if (!loadFrom(file, realtime, pool, forecast)) {
+      return false;
+    }
+    rename(tempPath, path);
+    Logger::log("Warm-start cache: recovered the record from an interrupted save");
+    return true;
+  }
+
+private:
+  static bool loadFrom(FILE* file, RealtimeWeatherData& realtime, PoolTemperatureData& pool, ForecastData& forecast) {
+    // First pass checks the header and CRC so a torn or stale record never reaches the display
+    RecordFile record(file);
+    uint32_t magic = record.get<uint32_t>();
+    uint16_t version = record.get<uint16_t>();
+    uint16_t payloadLength = record.get<uint16_t>();
+    uint32_t expectedCrc = record.get<uint32_t>();
+
+    bool ok = record.isOk() && magic == MAGIC && version == VERSION;
+    if (ok) {
+      record.resetCrc();
+      uint8_t buffer[64];
+      for (uint16_t remaining = payloadLength; remaining > 0 && record.isOk();) {
+        uint16_t count = remaining < sizeof(buffer) ? remaining : sizeof(buffer);
+        record.read(buffer, count);
+        remaining -= count;
+      }
+      ok = record.isOk() && fgetc(file) == EOF && record.getCrc() == expectedCrc;
+    }
+
+    if (ok) {
+      fseek(file, HEADER_SIZE, SEEK_SET);
+      ok = readPayload(record, realtime, pool, forecast);
+    }
+
+    fclose(file);
+    Logger::log(ok ? "Warm-start cache loaded" : "Warm-start cache record invalid, ignoring");
+    return ok;
+  }
+
+  // The slot versions whose changes are worth a write, summed
+  static uint32_t savedVersions(uint32_t realtime, uint32_t pool, uint32_t forecast) {
+    return (realtimeDerived ? 0 : realtime) + pool + forecast;
+  }
+
+  static void writePayload(RecordFile& record, const RealtimeWeatherData& realtime, const PoolTemperatureData& pool,
+    const ForecastData& forecast) {
+    uint8_t flags = (realtime.isValid ? HAS_REALTIME : 0) | (pool.isValid ? HAS_POOL : 0) |
+      (forecast.isValid ? HAS_FORECAST : 0);
+    record.put(flags);
+    SnapshotCodec::writeRealtime(record, realtime);
+    SnapshotCodec::writePool(record, pool);
+    SnapshotCodec::writeForecast(record, forecast);
+  }
+
+  static bool readPayload(RecordFile& record, RealtimeWeatherData& realtime, PoolTemperatureData& pool, ForecastData& forecast) {
+    uint8_t flags = record.get<uint8_t>();
+
+    RealtimeWeatherData cachedRealtime;
+    SnapshotCodec::readRealtime(record, cachedRealtime);
+    cachedRealtime.isValid = (flags & HAS_REALTIME) != 0;
+
+    PoolTemperatureData cachedPool = { "", 0.0f, 0, "", false };
+    if (!SnapshotCodec::readPool(record, cachedPool) || !SnapshotCodec::readForecast(record, forecast)) {
+      return false;
+    }
+    forecast.isValid = (flags & HAS_FORECAST) != 0;
+
+    if (cachedRealtime.isValid) {
+      realtime = cachedRealtime;
+    }
+    if (flags & HAS_POOL) {
+      cachedPool.isValid = true;
+      pool = cachedPool;
+    }
+    return record.isOk();
+  }
+};
+
+// Static member definitions
+#if defined(ARDUINO_GIGA)
+const char* WarmStartCache::path = "/cache/today.bin";
+const char* WarmStartCache::tempPath = "/cache/today.tmp";
+mbed::MBRBlockDevice* WarmStartCache::partition = nullptr;
+mbed::FATFileSystem* WarmStartCache::fileSystem = nullptr;
+#else
+const char* WarmStartCache::path = "today_cache.bin";
+const char* WarmStartCache::tempPath = "today_cache.tmp";
+#endif
+bool WarmStartCache::mounted = false;
+bool WarmStartCache::mountFailed = false;
+bool WarmStartCache::realtimeDerived = false;
+uint32_t WarmStartCache::savedGeneration = 0;
+bool WarmStartCache::hasSaved = false;
+unsigned long WarmStartCache::lastSaveTime = 0;
@@ -0,0 +1,154 @@
+// WeatherChannel.h - Weather snapshots passed from the networking side to the display side
+#pragma once
+#include <Arduino.h>
+#include "SnapshotCodec.h"
+#include "SpscQueue.h"
+
+enum class WeatherMessageType : uint8_t {
+  Realtime,        // A realtime fetch finished, valid or not
+  DerivedRealtime, // Realtime values interpolated from the latest forecast
+  Pool,
+  Forecast,
+  Error            // Text for Display::displayError()
+};
+
+// One self-contained snapshot in SnapshotCodec's compact layout, preceded by an isValid
+// byte: nothing in it points back into the networking side's memory.
+struct WeatherMessage {
+  static const uint16_t MAX_PAYLOAD = 3072;  // A full forecast is about 2.9 KB
+  static const uint16_t MAX_TEXT_LENGTH = 63; // Error text and pool timeAgo
+  static const uint16_t HEADER_SIZE = 4;
+
+  WeatherMessageType type;
+  uint8_t reserved;
+  uint16_t length; // Payload bytes in use
+  uint8_t payload[MAX_PAYLOAD];
+
+  // Bytes to copy when passing the message on
+  uint16_t size() const {
+    return HEADER_SIZE + length;
+  }
+
+  bool setRealtime(const RealtimeWeatherData& data, WeatherMessageType realtimeType = WeatherMessageType::Realtime) {
+    ByteWriter out = begin(realtimeType, data.isValid);
+    SnapshotCodec::writeRealtime(out, data);
+    return finish(out);
+  }
+
+  bool setPool(const PoolTemperatureData& data) {
+    ByteWriter out = begin(WeatherMessageType::Pool, data.isValid);
+    SnapshotCodec::writePool(out, data);
+    writeText(out, data.timeAgo);
+    return finish(out);
+  }
+
+  bool setForecast(const ForecastData& data) {
+    ByteWriter out = begin(WeatherMessageType::Forecast, data.isValid);
+    SnapshotCodec::writeForecast(out, data);
+    return finish(out);
+  }
+
+  bool setError(const String& message) {
+    ByteWriter out = begin(WeatherMessageType::Error, true);
+    writeText(out, message);
+    return finish(out);
+  }
+
+  bool getRealtime(RealtimeWeatherData& data) const {
+    ByteReader in(payload, length);
+    data.isValid = in.get<uint8_t>() != 0;
+    SnapshotCodec::readRealtime(in, data);
+    return in.isOk();
+  }
+
+  bool getPool(PoolTemperatureData& data) const {
+    ByteReader in(payload, length);
+    data.isValid = in.get<uint8_t>() != 0;
+    bool ok = SnapshotCodec::readPool(in, data);
+    data.timeAgo = readText(in);
+    return ok && in.isOk();
+  }
+
+  bool getForecast(ForecastData& data) const {
+    ByteReader in(payload, length);
+    data.isValid = in.get<uint8_t>() != 0;
+    return SnapshotCodec::readForecast(in, data) && in.isOk();
+  }
+
+  String getError() const {
+    ByteReader in(payload, length);
+    in.get<uint8_t>();
+    return readText(in);
+  }
+
+private:
+  ByteWriter begin(WeatherMessageType messageType, bool isValid) {
+    type = messageType;
+    reserved = 0;
+    length = 0;
+    ByteWriter out(payload, MAX_PAYLOAD);
+    out.put((uint8_t)isValid);
+    return out;
+  }
+
+  bool finish(const ByteWriter& out) {
+    length = out.isOk() ? out.getLength() : 0;
+    return out.isOk();
+  }
+
+  static void writeText(ByteWriter& out, const String& text) {
+    uint8_t textLength = text.length() < MAX_TEXT_LENGTH ? text.length() : MAX_TEXT_LENGTH;
+    out.put(textLength);
+    out.write(text.c_str(), textLength);
+  }
+
+  static String readText(ByteReader& in) {
+    char text[MAX_TEXT_LENGTH + 1];
+    uint8_t textLength = in.get<uint8_t>();
+    textLength = textLength < MAX_TEXT_LENGTH ? textLength : MAX_TEXT_LENGTH;
+    in.read(text, textLength);
+    text[textLength] = '\0';
+    return String(text);
+  }
+};
+
+// How messages get from the networking side to the display side. Neither call may block:
+// a stalled network must never hold up a frame, and a busy display never holds up a fetch.
+class WeatherTransport {
+public:
+  virtual ~WeatherTransport() {
+  }
+
+  // Networking side: false if the message was dropped (the channel is full)
+  virtual bool send(const WeatherMessage& message) = 0;
+
+  // Display side: false when nothing is waiting
+  virtual bool receive(WeatherMessage& message) = 0;
+};
+
+// Both sides in one address space, as two threads: an RTOS thread and loop() on the
+// board, or two std::threads on the host
+template <uint32_t CAPACITY = 16384>
+class QueueTransport : public WeatherTransport {
+private:
+  SpscQueue<CAPACITY> queue;
+
+public:
+  bool send(const WeatherMessage& message) override {
+    return queue.push(&message, message.size());
+  }
+
+  bool receive(WeatherMessage& message) override {
+    uint16_t size;
+    while (!queue.isEmpty()) {
+      if (queue.pop(&message, sizeof(WeatherMessage), size) && size >= WeatherMessage::HEADER_SIZE) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  uint32_t getDropped() const {
+    return queue.getDropped();
+  }
+};
@@ -0,0 +1,50 @@
+// WeatherConditions.h - tomorrow.io weather codes mapped to condition names and atlas icons
+#pragma once
+#include <Arduino.h>
+#include "./icons/ConditionsAtlas.h"
+
+struct WeatherCondition {
+  int code;
+  ConditionsIcon icon; // Index into ConditionsAtlasLarge / ConditionsAtlasSmall
+  const char* description;
+};
+
+// The tomorrow.io weather code table; codes sharing a look share an icon
+constexpr WeatherCondition WEATHER_CONDITIONS[] = {
+  { 1000, CONDITIONS_CLEAR, "Clear" },
+  { 1100, CONDITIONS_MOSTLY_CLEAR, "Mostly Clear" },
+  { 1101, CONDITIONS_PARTLY_CLOUDY, "Partly Cloudy" },
+  { 1102, CONDITIONS_MOSTLY_CLOUDY, "Mostly Cloudy" },
+  { 1001, CONDITIONS_CLOUDY, "Cloudy" },
+  { 2000, CONDITIONS_FOG, "Fog" },
+  { 2100, CONDITIONS_FOG, "Light Fog" },
+  { 4000, CONDITIONS_DRIZZLE, "Drizzle" },
+  { 4001, CONDITIONS_RAIN, "Rain" },
+  { 4200, CONDITIONS_RAIN, "Light Rain" },
+  { 4201, CONDITIONS_HEAVY_RAIN, "Heavy Rain" },
+  { 5000, CONDITIONS_SNOW, "Snow" },
+  { 5001, CONDITIONS_SNOW, "Flurries" },
+  { 5100, CONDITIONS_SNOW, "Light Snow" },
+  { 5101, CONDITIONS_SNOW, "Heavy Snow" },
+  { 6000, CONDITIONS_FREEZING_RAIN, "Freezing Drizzle" },
+  { 6001, CONDITIONS_FREEZING_RAIN, "Freezing Rain" },
+  { 6200, CONDITIONS_FREEZING_RAIN, "Light Freezing Rain" },
+  { 6201, CONDITIONS_FREEZING_RAIN, "Heavy Freezing Rain" },
+  { 7000, CONDITIONS_ICE_PELLETS, "Ice Pellets" },
+  { 7101, CONDITIONS_ICE_PELLETS, "Heavy Ice Pellets" },
+  { 7102, CONDITIONS_ICE_PELLETS, "Light Ice Pellets" },
+  { 8000, CONDITIONS_THUNDERSTORM, "Thunderstorm" },
+};
+
+// Shown for codes without an entry
+const char* const UNKNOWN_CONDITION = "Unknown";
+
+// Entry for a weather code, or nullptr for codes not in the table (including 0, "Unknown")
+constexpr const WeatherCondition* findWeatherCondition(int code, size_t index = 0) {
+  return index >= sizeof(WEATHER_CONDITIONS) / sizeof(WEATHER_CONDITIONS[0]) ? nullptr
+    : WEATHER_CONDITIONS[index].code == code ? &WEATHER_CONDITIONS[index]
+    : findWeatherCondition(code, index + 1);
+}
+
+static_assert(findWeatherCondition(2100)->icon == CONDITIONS_FOG, "weather code table lookup");
+static_assert(findWeatherCondition(0) == nullptr, "unknown weather codes have no entry");
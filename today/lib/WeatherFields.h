@@ -0,0 +1,92 @@
+// WeatherFields.h - Declarative tomorrow.io field lists shared by requests and parsers
+#pragma once
+#include <Arduino.h>
+#include "JsonStreamParser.h"
+
+// Binds a tomorrow.io value name to the member it is stored in. The same table
+// builds the `fields=` query parameter and drives the stream handler, so the request
+// and the parser cannot ask for and read different things.
+// Tables are constexpr, so each name is hashed once at compile time.
+// Most values are floats; codes such as weatherCode bind to an int member, text to a
+// String and Unix times (seconds or milliseconds) to an unsigned long of seconds.
+template <typename Record>
+struct FieldBinding {
+  const char* name;
+  uint32_t keyHash;
+  float Record::* member;
+  int Record::* codeMember;
+  String Record::* textMember;
+  unsigned long Record::* timeMember;
+
+  constexpr FieldBinding(const char* name, float Record::* member)
+    : name(name), keyHash(jsonKeyHash(name)), member(member), codeMember(nullptr), textMember(nullptr),
+      timeMember(nullptr) {
+  }
+
+  constexpr FieldBinding(const char* name, int Record::* codeMember)
+    : name(name), keyHash(jsonKeyHash(name)), member(nullptr), codeMember(codeMember), textMember(nullptr),
+      timeMember(nullptr) {
+  }
+
+  constexpr FieldBinding(const char* name, String Record::* textMember)
+    : name(name), keyHash(jsonKeyHash(name)), member(nullptr), codeMember(nullptr), textMember(textMember),
+      timeMember(nullptr) {
+  }
+
+  constexpr FieldBinding(const char* name, unsigned long Record::* timeMember)
+    : name(name), keyHash(jsonKeyHash(name)), member(nullptr), codeMember(nullptr), textMember(nullptr),
+      timeMember(timeMember) {
+  }
+};
+
+// Index of the field bound to the key hash, or -1
+template <typename Record, size_t N>
+int findField(const FieldBinding<Record> (&fields)[N], uint32_t keyHash) {
+  for (size_t i = 0; i < N; i++) {
+    if (fields[i].keyHash == keyHash) {
+      return (int)i;
+    }
+  }
+  return -1;
+}
+
+// Convert a scalar's text for the field's member and store it
+template <typename Record>
+void storeField(const FieldBinding<Record>& field, Record& record, const char* value) {
+  if (field.member != nullptr) {
+    record.*(field.member) = JsonStreamParser::toFloat(value);
+  }
+  else if (field.codeMember != nullptr) {
+    record.*(field.codeMember) = (int)JsonStreamParser::toFloat(value);
+  }
+  else if (field.textMember != nullptr) {
+    record.*(field.textMember) = value;
+  }
+  else {
+    // Millisecond timestamps exceed 32 bits; keep seconds so formatTimeAgo stays exact
+    unsigned long long time = strtoull(value, nullptr, 10);
+    record.*(field.timeMember) = (unsigned long)(time > 1000000000000ULL ? time / 1000 : time);
+  }
+}
+
+// Store `value` into the member bound to the key hash; returns false for fields not in the table
+template <typename Record, size_t N>
+bool storeField(const FieldBinding<Record> (&fields)[N], Record& record, uint32_t keyHash, const char* value) {
+  int index = findField(fields, keyHash);
+  if (index < 0) {
+    return false;
+  }
+  storeField(fields[index], record, value);
+  return true;
+}
+
+// Append the table's names to a comma-separated field list
+template <typename Record, size_t N>
+void appendFieldNames(String& list, const FieldBinding<Record> (&fields)[N]) {
+  for (size_t i = 0; i < N; i++) {
+    if (list.length() > 0) {
+      list += ",";
+    }
+    list += fields[i].name;
+  }
+}
@@ -1,25 +1,162 @@
 // WeatherForecast.h
 #pragma once
-#include <ArduinoJson.h>
 #include <WiFi.h>
 #include "HttpClient.h"
+#include "JsonStreamParser.h"
+#include "TimeManager.h"
+#include "WeatherRealtime.h"
+#include "WeatherFields.h"
 
 struct DailyForecastData {
-  String date;
+  char date[21];
   float cloudCoverAvg;
   float temperatureApparentAvg;
   float temperatureAvg;
   float uvIndexAvg;
   float windSpeedAvg;
   float windDirectionAvg;
+  int weatherCode; // The day's weatherCodeMax
   bool isValid;
 };
 
+// One entry of the hourly or minutely timeline, reduced to the values we display
+struct TimelineEntry {
+  unsigned long time;
+  float temperature;
+  float uvIndex;
+  float humidity;
+  float windSpeed;
+  float windDirection;
+  float cloudCover;
+  int weatherCode;
+};
+
 struct ForecastData {
   static const int MAX_DAYS = 7;
+  static const int MAX_HOURS = 24;
+  static const int MAX_MINUTES = 60;
   DailyForecastData daily[MAX_DAYS];
   int dayCount;
   bool isValid;
+  TimelineEntry hourly[MAX_HOURS];
+  int hourCount;
+  TimelineEntry minutely[MAX_MINUTES];
+  int minuteCount;
+};
+
+// Values requested for the daily timeline
+constexpr FieldBinding<DailyForecastData> DAILY_FIELDS[] = {
+  { "cloudCoverAvg", &DailyForecastData::cloudCoverAvg },
+  { "temperatureApparentAvg", &DailyForecastData::temperatureApparentAvg },
+  { "temperatureAvg", &DailyForecastData::temperatureAvg },
+  { "uvIndexAvg", &DailyForecastData::uvIndexAvg },
+  { "windSpeedAvg", &DailyForecastData::windSpeedAvg },
+  { "windDirectionAvg", &DailyForecastData::windDirectionAvg },
+  { "weatherCodeMax", &DailyForecastData::weatherCode },
+};
+
+// Values requested for the hourly and minutely timelines; mirrors REALTIME_FIELDS so
+// "now" can be interpolated from the forecast
+constexpr FieldBinding<TimelineEntry> TIMELINE_FIELDS[] = {
+  { "temperature", &TimelineEntry::temperature },
+  { "uvIndex", &TimelineEntry::uvIndex },
+  { "humidity", &TimelineEntry::humidity },
+  { "windSpeed", &TimelineEntry::windSpeed },
+  { "windDirection", &TimelineEntry::windDirection },
+  { "cloudCover", &TimelineEntry::cloudCover },
+  { "weatherCode", &TimelineEntry::weatherCode },
+};
+
+// Only the timelines the handler below stores
+const char* const FORECAST_TIMESTEPS = "1m,1h,1d";
+
+// Picks the daily, hourly and minutely fields out of a streamed tomorrow.io forecast.
+// Everything else in the ~200 KB payload is discarded as it is tokenized.
+class ForecastStreamHandler : public JsonStreamHandler {
+private:
+  static constexpr uint32_t KEY_TIMELINES = jsonKeyHash("timelines");
+  static constexpr uint32_t KEY_DAILY = jsonKeyHash("daily");
+  static constexpr uint32_t KEY_HOURLY = jsonKeyHash("hourly");
+  static constexpr uint32_t KEY_MINUTELY = jsonKeyHash("minutely");
+  static constexpr uint32_t KEY_TIME = jsonKeyHash("time");
+  static constexpr uint32_t KEY_VALUES = jsonKeyHash("values");
+
+  ForecastData& data;
+
+public:
+  ForecastStreamHandler(ForecastData& data) : data(data) {
+  }
+
+  void onValue(const JsonStreamParser& parser, const char* value, JsonValueType type) override {
+    // Paths of interest: timelines.<timeline>[i].time and timelines.<timeline>[i].values.<field>
+    int depth = parser.getDepth();
+    if (depth < 4 || !parser.keyIs(0, KEY_TIMELINES)) {
+      return;
+    }
+
+    int index = parser.indexAt(2);
+    if (index < 0) {
+      return;
+    }
+
+    bool isTime = depth == 4 && parser.keyIs(3, KEY_TIME);
+    bool isField = depth == 5 && parser.keyIs(3, KEY_VALUES);
+    if (!isTime && !isField) {
+      return;
+    }
+
+    if (parser.keyIs(1, KEY_DAILY)) {
+      if (index >= ForecastData::MAX_DAYS) {
+        return;
+      }
+      data.dayCount = max(data.dayCount, index + 1);
+      DailyForecastData& day = data.daily[index];
+      day.isValid = true;
+      if (isTime) {
+        strncpy(day.date, value, sizeof(day.date) - 1);
+        day.date[sizeof(day.date) - 1] = '\0';
+        return;
+      }
+      storeDailyField(day, parser.currentKeyHash(), value, type);
+      return;
+    }
+
+    if (parser.keyIs(1, KEY_HOURLY)) {
+      storeTimelineValue(data.hourly, data.hourCount, ForecastData::MAX_HOURS, index, isTime, parser.currentKeyHash(), value, type);
+    }
+    else if (parser.keyIs(1, KEY_MINUTELY)) {
+      storeTimelineValue(data.minutely, data.minuteCount, ForecastData::MAX_MINUTES, index, isTime, parser.currentKeyHash(), value, type);
+    }
+  }
+
+private:
+  static void storeDailyField(DailyForecastData& day, uint32_t keyHash, const char* value, JsonValueType type) {
+    if (type != JsonValueType::Number) {
+      return;
+    }
+
+    storeField(DAILY_FIELDS, day, keyHash, value);
+  }
+
+  static void storeTimelineValue(TimelineEntry* entries, int& count, int capacity, int index, bool isTime,
+    uint32_t keyHash, const char* value, JsonValueType type) {
+    if (index >= capacity) {
+      return;
+    }
+    count = max(count, index + 1);
+    TimelineEntry& entry = entries[index];
+
+    if (isTime) {
+      entry.time = TimeManager::parseIso8601(value);
+      return;
+    }
+
+    if (type != JsonValueType::Number) {
+      return;
+    }
+
+    storeField(TIMELINE_FIELDS, entry, keyHash, value);
+  }
 };
 
 class WeatherForecast {
@@ -27,63 +164,138 @@ private:
   String apiKey;
   String location;
   SimpleHttpClient httpClient;
+  ForecastData data;
+  ForecastStreamHandler handler;
+  JsonStreamParser parser;
 
 public:
   WeatherForecast(const String& key, const String& loc)
-    : apiKey(key), location(loc) {
+    : apiKey(key), location(loc), data({}), handler(data), parser(&handler) {
   }
 
-  ForecastData fetchForecastData() {
-    ForecastData data = { {}, 0, false };
+  // Start a non-blocking fetch; drive it with pollFetch() from loop()
+  bool beginFetch() {
+    data = {};
+    parser.reset();
 
-    String queryParams = "location=" + location + "&apikey=" + apiKey + "&timesteps=1d";
-    HttpResponse response = httpClient.get("api.tomorrow.io", "/v4/weather/forecast", queryParams);
+    // Ask only for the fields and timelines the handler stores; the server returns
+    // six values per timestep instead of ~30
+    String fields;
+    appendFieldNames(fields, DAILY_FIELDS);
+    appendFieldNames(fields, TIMELINE_FIELDS);
+    String queryParams = "location=" + location + "&timesteps=" + FORECAST_TIMESTEPS +
+      "&fields=" + fields + "&apikey=" + apiKey;
+    return httpClient.begin("api.tomorrow.io", "/v4/weather/forecast", queryParams, parser);
+  }
 
-    if (!response.isSuccess) {
-      Serial.println("Failed to fetch forecast data: " + response.error);
-      return data;
+  // Advance an in-flight fetch; returns true once it has finished, successfully or not
+  bool pollFetch() {
+    if (!httpClient.isBusy()) {
+      return true;
     }
 
-    Serial.println(response.body);
+    httpClient.poll();
+    if (httpClient.isBusy()) {
+      return false;
+    }
 
-    if (parseForecastJson(response.body, data)) {
-      data.isValid = true;
+    finishFetch();
+    return true;
+  }
+
+  const ForecastData& getData() const {
+    return data;
+  }
+
+  // Derive "now" values from a forecast by interpolating between the minutely entries
+  // around unixTime, falling back to the hourly timeline once the minutely one runs out.
+  // Lets the forecast call double as the realtime call.
+  static bool interpolateRealtime(const ForecastData& forecast, unsigned long unixTime, RealtimeWeatherData& result) {
+    if (interpolateTimeline(forecast.minutely, forecast.minuteCount, unixTime, result)) {
+      return true;
     }
+    return interpolateTimeline(forecast.hourly, forecast.hourCount, unixTime, result);
+  }
 
+  ForecastData fetchForecastData() {
+    if (beginFetch()) {
+      while (!pollFetch()) {
+        delay(1);
+      }
+    }
     return data;
   }
 
   bool parseForecastJson(const String& jsonString, ForecastData& data) {
-    DynamicJsonDocument doc(8192); // Larger buffer for forecast data
+    ForecastStreamHandler handler(data);
+    JsonStreamParser parser(&handler);
 
-    DeserializationError error = deserializeJson(doc, jsonString);
-    if (error) {
+    if (!parser.feed(jsonString.c_str(), jsonString.length()) || !parser.finish()) {
       Serial.println("JSON parsing failed");
       return false;
     }
 
-    if (!doc["timelines"]["daily"]) {
+    if (data.dayCount == 0) {
       Serial.println("No daily timeline found");
       return false;
     }
 
-    JsonArray dailyArray = doc["timelines"]["daily"];
-    data.dayCount = min((int)dailyArray.size(), ForecastData::MAX_DAYS);
+    return true;
+  }
+
+private:
+  static bool interpolateTimeline(const TimelineEntry* entries, int count, unsigned long unixTime, RealtimeWeatherData& result) {
+    if (count == 0 || unixTime > entries[count - 1].time) {
+      return false;
+    }
+
+    // Before the first entry the first bucket is the best estimate
+    int next = 0;
+    while (next < count && entries[next].time < unixTime) {
+      next++;
+    }
+    const TimelineEntry& after = entries[next];
+    const TimelineEntry& before = next > 0 ? entries[next - 1] : after;
+
+    float t = 0.0f;
+    if (after.time > before.time) {
+      t = (float)(unixTime - before.time) / (after.time - before.time);
+    }
+
+    result.temperature = lerp(before.temperature, after.temperature, t);
+    result.uvIndex = lerp(before.uvIndex, after.uvIndex, t);
+    result.humidity = lerp(before.humidity, after.humidity, t);
+    result.windSpeed = lerp(before.windSpeed, after.windSpeed, t);
+    result.windDirection = lerpDegrees(before.windDirection, after.windDirection, t);
+    result.cloudCover = lerp(before.cloudCover, after.cloudCover, t);
+    result.weatherCode = t < 0.5f ? before.weatherCode : after.weatherCode; // Codes cannot be blended
+    result.isValid = true;
+    return true;
+  }
 
-    for (int i = 0; i < data.dayCount; i++) {
-      JsonObject day = dailyArray[i];
-      JsonObject values = day["values"];
+  static float lerp(float from, float to, float t) {
+    return from + (to - from) * t;
+  }
 
-      data.daily[i].date = day["time"].as<String>();
-      data.daily[i].cloudCoverAvg = values["cloudCoverAvg"] | 0.0f;
-      data.daily[i].temperatureApparentAvg = values["temperatureApparentAvg"] | 0.0f;
-      data.daily[i].temperatureAvg = values["temperatureAvg"] | 0.0f;
-      data.daily[i].uvIndexAvg = values["uvIndexAvg"] | 0.0f;
-      data.daily[i].windSpeedAvg = values["windSpeedAvg"] | 0.0f;
-      data.daily[i].windDirectionAvg = values["windDirectionAvg"] | 0.0f;
-      data.daily[i].isValid = true;
+  // Interpolate along the shorter arc so 350 -> 10 passes through 0, not 180
+  static float lerpDegrees(float from, float to, float t) {
+    float delta = fmod(to - from + 540.0f, 360.0f) - 180.0f;
+    float result = fmod(from + delta * t + 360.0f, 360.0f);
+    return result;
+  }
+
+  void finishFetch() {
+    const HttpResponse& response = httpClient.getResponse();
+    if (!response.isSuccess) {
+      Serial.println("Failed to fetch forecast data: " + response.error);
+      return;
     }
 
-    return data.dayCount > 0;
+    Serial.println("Forecast parsed: " + String(data.dayCount) + " days, " + String(data.hourCount) + " hours, " +
+      String(data.minuteCount) + " minutes");
+
+    if (data.dayCount > 0) {
+      data.isValid = true;
+    }
   }
 };
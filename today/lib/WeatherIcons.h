@@ -5,7 +5,7 @@
 class WeatherIcons {
 public:
   // Simple weather icons using basic shapes
-  static void drawSunIcon(GigaDisplay_GFX& display, int16_t x, int16_t y, uint16_t color) {
+  static void drawSunIcon(Adafruit_GFX& display, int16_t x, int16_t y, uint16_t color) {
     // Sun - filled circle with rays
     display.fillCircle(x, y, 15, color);
     // Sun rays
@@ -19,7 +19,7 @@ public:
     }
   }
 
-  static void drawCloudIcon(GigaDisplay_GFX& display, int16_t x, int16_t y, uint16_t color) {
+  static void drawCloudIcon(Adafruit_GFX& display, int16_t x, int16_t y, uint16_t color) {
     // Cloud - multiple overlapping circles
     display.fillCircle(x - 10, y, 8, color);
     display.fillCircle(x, y - 5, 12, color);
@@ -27,7 +27,7 @@ public:
     display.fillCircle(x + 5, y + 5, 8, color);
   }
 
-  static void drawRainIcon(GigaDisplay_GFX& display, int16_t x, int16_t y, uint16_t color) {
+  static void drawRainIcon(Adafruit_GFX& display, int16_t x, int16_t y, uint16_t color) {
     // Cloud + rain drops
     drawCloudIcon(display, x, y - 10, color);
     // Rain drops
@@ -37,26 +37,26 @@ public:
     }
   }
 
-  static void drawWindIcon(GigaDisplay_GFX& display, int16_t x, int16_t y, uint16_t color) {
+  static void drawWindIcon(Adafruit_GFX& display, int16_t x, int16_t y, uint16_t color) {
     // Wind - curved lines
     display.drawLine(x - 15, y - 5, x + 15, y - 5, color);
     display.drawLine(x - 10, y, x + 10, y, color);
     display.drawLine(x - 5, y + 5, x + 5, y + 5, color);
   }
 
-  static void drawThermometerIcon(GigaDisplay_GFX& display, int16_t x, int16_t y, uint16_t color) {
+  static void drawThermometerIcon(Adafruit_GFX& display, int16_t x, int16_t y, uint16_t color) {
     // Thermometer - rectangle with circle at bottom
     display.drawRect(x - 2, y - 15, 4, 20, color);
     display.fillCircle(x, y + 8, 6, color);
   }
 
-  static void drawHumidityIcon(GigaDisplay_GFX& display, int16_t x, int16_t y, uint16_t color) {
+  static void drawHumidityIcon(Adafruit_GFX& display, int16_t x, int16_t y, uint16_t color) {
     // Water drop shape using triangle and circle
     display.drawTriangle(x, y - 10, x - 8, y + 5, x + 8, y + 5, color);
     display.fillCircle(x, y + 2, 6, color);
   }
 
-  static void drawUVIcon(GigaDisplay_GFX& display, int16_t x, int16_t y, uint16_t color) {
+  static void drawUVIcon(Adafruit_GFX& display, int16_t x, int16_t y, uint16_t color) {
     // UV rays from center
     for (int i = 0; i < 12; i++) {
       float angle = (i * 30) * PI / 180;
@@ -1,9 +1,10 @@
 // WeatherRealtime.h
 #pragma once
-#include <ArduinoJson.h>
 #include <WiFi.h>
 #include "Logger.h"
 #include "HttpClient.h"
+#include "JsonStreamParser.h"
+#include "WeatherFields.h"
 
 struct RealtimeWeatherData {
   float temperature;
@@ -12,60 +13,139 @@ struct RealtimeWeatherData {
   float windSpeed;
   float windDirection;
   float cloudCover;
+  int weatherCode; // tomorrow.io weather code, see WeatherConditions.h
   bool isValid;
 };
 
+// The only values requested from /v4/weather/realtime and read back out of it
+constexpr FieldBinding<RealtimeWeatherData> REALTIME_FIELDS[] = {
+  { "temperature", &RealtimeWeatherData::temperature },
+  { "uvIndex", &RealtimeWeatherData::uvIndex },
+  { "humidity", &RealtimeWeatherData::humidity },
+  { "windSpeed", &RealtimeWeatherData::windSpeed },
+  { "windDirection", &RealtimeWeatherData::windDirection },
+  { "cloudCover", &RealtimeWeatherData::cloudCover },
+  { "weatherCode", &RealtimeWeatherData::weatherCode },
+};
+
+// Picks data.values.<field> out of a streamed realtime response
+class RealtimeStreamHandler : public JsonStreamHandler {
+private:
+  static constexpr uint32_t KEY_DATA = jsonKeyHash("data");
+  static constexpr uint32_t KEY_VALUES = jsonKeyHash("values");
+
+  RealtimeWeatherData& data;
+  bool foundValues;
+
+public:
+  RealtimeStreamHandler(RealtimeWeatherData& data) : data(data), foundValues(false) {
+  }
+
+  void reset() {
+    foundValues = false;
+  }
+
+  bool hasValues() const {
+    return foundValues;
+  }
+
+  void onValue(const JsonStreamParser& parser, const char* value, JsonValueType type) override {
+    if (parser.getDepth() != 3 || !parser.keyIs(0, KEY_DATA) || !parser.keyIs(1, KEY_VALUES)) {
+      return;
+    }
+
+    foundValues = true;
+    if (type != JsonValueType::Number) {
+      return;
+    }
+
+    storeField(REALTIME_FIELDS, data, parser.currentKeyHash(), value);
+  }
+};
+
 class WeatherRealtime {
 private:
   String apiKey;
   String location;
   SimpleHttpClient httpClient;
+  RealtimeWeatherData data;
+  RealtimeStreamHandler handler;
+  JsonStreamParser parser;
 
 public:
   WeatherRealtime(const String& key, const String& loc)
-    : apiKey(key), location(loc) {
+    : apiKey(key), location(loc), data({ 0, 0, 0, 0, 0, 0, 0, false }), handler(data), parser(&handler) {
   }
 
-  RealtimeWeatherData fetchWeatherData() {
-    RealtimeWeatherData data = { 0, 0, 0, 0, 0, 0, false };
+  // Start a non-blocking fetch; drive it with pollFetch() from loop()
+  bool beginFetch() {
+    data = { 0, 0, 0, 0, 0, 0, 0, false };
+    handler.reset();
+    parser.reset();
 
-    String queryParams = "location=" + location + "&apikey=" + apiKey;
-    HttpResponse response = httpClient.get("api.tomorrow.io", "/v4/weather/realtime", queryParams);
+    String fields;
+    appendFieldNames(fields, REALTIME_FIELDS);
+    String queryParams = "location=" + location + "&fields=" + fields + "&apikey=" + apiKey;
+    return httpClient.begin("api.tomorrow.io", "/v4/weather/realtime", queryParams, parser);
+  }
 
-    if (!response.isSuccess) {
-      Logger::log("Failed to fetch weather data: " + response.error);
-      return data;
+  // Advance an in-flight fetch; returns true once it has finished, successfully or not
+  bool pollFetch() {
+    if (!httpClient.isBusy()) {
+      return true;
     }
 
-    if (!parseRealtimeJson(response.body, data)) {
-      Logger::log("Failed to parse weather data");
-      return data;
+    httpClient.poll();
+    if (httpClient.isBusy()) {
+      return false;
     }
 
-    data.isValid = true;
+    finishFetch();
+    return true;
+  }
+
+  RealtimeWeatherData getData() const {
+    return data;
+  }
+
+  RealtimeWeatherData fetchWeatherData() {
+    if (beginFetch()) {
+      while (!pollFetch()) {
+        delay(1);
+      }
+    }
     return data;
   }
 
   bool parseRealtimeJson(const String& jsonString, RealtimeWeatherData& data) {
-    DynamicJsonDocument doc(2048);
+    RealtimeStreamHandler handler(data);
+    JsonStreamParser parser(&handler);
 
-    DeserializationError error = deserializeJson(doc, jsonString);
-    if (error) {
+    if (!parser.feed(jsonString.c_str(), jsonString.length()) || !parser.finish()) {
       return false;
     }
 
-    if (doc["data"]["values"]) {
-      JsonObject values = doc["data"]["values"];
-      data.temperature = values["temperature"] | 0.0f;
-      data.uvIndex = values["uvIndex"] | 0.0f;
-      data.humidity = values["humidity"] | 0.0f;
-      data.windSpeed = values["windSpeed"] | 0.0f;
-      data.windDirection = values["windDirection"] | 0.0f;
-      data.cloudCover = values["cloudCover"] | 0.0f;
+    if (handler.hasValues()) {
       data.isValid = true;
       return true;
     }
 
     return false;
   }
+
+private:
+  void finishFetch() {
+    const HttpResponse& response = httpClient.getResponse();
+    if (!response.isSuccess) {
+      Logger::log("Failed to fetch weather data: " + response.error);
+      return;
+    }
+
+    if (!handler.hasValues()) {
+      Logger::log("Failed to parse weather data");
+      return;
+    }
+
+    data.isValid = true;
+  }
 };
@@ -0,0 +1,296 @@
+// WiFiManager.h - Non-blocking WiFi connection state machine with backoff reconnect
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+#include "Logger.h"
+
+enum class WiFiEvent {
+  LinkUp,        // Joined the network (first time or after a drop)
+  LinkDown,      // A connected link was lost
+  AttemptFailed  // A join attempt timed out or was refused; a retry is scheduled
+};
+
+// Joins and keeps the network without ever waiting on it. poll() advances the state
+// machine by one step and returns how long until it wants to be polled again, so it runs
+// as a scheduler task. Events go to one handler, on the polling thread.
+//
+//   Idle -> Connecting -> Connected -> (link lost) -> Backoff -> Connecting ...
+//                 \-> (timeout) -> Backoff -^
+//
+// Failed attempts and drops back off exponentially from baseBackoffMs up to maxBackoffMs,
+// each delay jittered into its upper half so that devices dropped by the same router
+// outage do not all come back at once. A successful join resets the backoff. The jitter
+// comes from the manager's own generator, seeded per board (see seedJitter()).
+class WiFiManager {
+public:
+  typedef void (*EventHandler)(WiFiEvent event);
+  typedef unsigned long (*ClockFunction)();
+
+  enum State {
+    Idle,
+    Connecting,
+    Connected,
+    Backoff
+  };
+
+private:
+  const char* ssid;
+  const char* password;
+  ClockFunction clock;
+  EventHandler handler;
+  State state;
+  unsigned long stateSince;
+  unsigned long retryAt;
+  int failures; // Consecutive, since the last successful join
+  uint32_t jitterState; // xorshift32; 0 until seeded
+
+  unsigned long connectTimeoutMs;
+  unsigned long statusPollMs;  // While connecting
+  unsigned long linkCheckMs;   // While connected: status and RSSI
+  unsigned long baseBackoffMs;
+  unsigned long maxBackoffMs;
+
+  // RSSI while connected, in dBm; smoothed is an exponential average over link checks
+  long rssi;
+  long rssiMin;
+  long rssiMax;
+  float rssiSmoothed;
+
+  // Connect-time metrics, since boot
+  unsigned long firstAttemptTime;
+  unsigned long attempts;
+  unsigned long joins;
+  unsigned long drops;
+  unsigned long lastConnectMs;
+  unsigned long fastestConnectMs;
+  unsigned long slowestConnectMs;
+  unsigned long totalConnectMs;
+  unsigned long connectedMs; // Completed connected periods; the current one is added on read
+
+public:
+  WiFiManager(const char* ssid, const char* password, ClockFunction clock = millis)
+    : ssid(ssid), password(password), clock(clock), handler(nullptr), state(Idle), stateSince(0), retryAt(0),
+      failures(0), jitterState(0), connectTimeoutMs(20000), statusPollMs(250), linkCheckMs(5000), baseBackoffMs(2000),
+      maxBackoffMs(300000), rssi(0), rssiMin(0), rssiMax(0), rssiSmoothed(0), firstAttemptTime(0), attempts(0),
+      joins(0), drops(0), lastConnectMs(0), fastestConnectMs(0), slowestConnectMs(0), totalConnectMs(0), connectedMs(0) {
+  }
+
+  void setEventHandler(EventHandler eventHandler) {
+    handler = eventHandler;
+  }
+
+  void setBackoff(unsigned long baseMs, unsigned long maxMs) {
+    baseBackoffMs = baseMs;
+    maxBackoffMs = maxMs;
+  }
+
+  void setConnectTimeout(unsigned long timeoutMs) {
+    connectTimeoutMs = timeoutMs;
+  }
+
+  // Seed the retry jitter; without one, the first attempt seeds it from the board
+  void setJitterSeed(uint32_t seed) {
+    jitterState = seed != 0 ? seed : 1;
+  }
+
+  // Advance by one step; returns the ms until the next poll is useful
+  unsigned long poll() {
+    unsigned long now = clock();
+    switch (state) {
+    case Idle:
+      startAttempt(now);
+      return statusPollMs;
+    case Connecting:
+      return pollConnecting(now);
+    case Connected:
+      return pollConnected(now);
+    case Backoff:
+      if ((long)(now - retryAt) < 0) {
+        return retryAt - now;
+      }
+      startAttempt(now);
+      return statusPollMs;
+    }
+    return statusPollMs;
+  }
+
+  State getState() const {
+    return state;
+  }
+
+  // As of the last poll; cheaper than asking the radio
+  bool isConnected() const {
+    return state == Connected;
+  }
+
+  long getRssi() const {
+    return rssi;
+  }
+
+  unsigned long getLastConnectMs() const {
+    return lastConnectMs;
+  }
+
+  unsigned long getJoins() const {
+    return joins;
+  }
+
+  unsigned long getDrops() const {
+    return drops;
+  }
+
+  // Share of the time since the first attempt spent connected, 0-1
+  float getUptimeFraction() const {
+    unsigned long now = clock();
+    unsigned long connected = connectedMs + (state == Connected ? now - stateSince : 0);
+    unsigned long elapsed = now - firstAttemptTime;
+    return attempts == 0 || elapsed == 0 ? 0.0f : (float)connected / elapsed;
+  }
+
+  void logStats() const {
+    String line = "WiFi: " + String(stateName(state)) + ", " + String(joins) + " joins in " + String(attempts) +
+      " attempts, " + String(drops) + " drops, " + String(getUptimeFraction() * 100.0f, 1) + "% up";
+    if (joins > 0) {
+      line += "; connect " + String(fastestConnectMs) + "/" + String(totalConnectMs / joins) + "/" +
+        String(slowestConnectMs) + " ms min/avg/max";
+    }
+    Logger::log(line);
+    if (state == Connected) {
+      Logger::log("WiFi RSSI: " + String(rssi) + " dBm now, " + String(rssiSmoothed, 1) + " smoothed, " +
+        String(rssiMin) + " to " + String(rssiMax) + " this link");
+    }
+  }
+
+  static const char* stateName(State state) {
+    switch (state) {
+    case Idle:
+      return "idle";
+    case Connecting:
+      return "connecting";
+    case Connected:
+      return "connected";
+    case Backoff:
+      return "waiting to retry";
+    }
+    return "?";
+  }
+
+private:
+  void startAttempt(unsigned long now) {
+    if (attempts == 0) {
+      firstAttemptTime = now;
+    }
+    attempts++;
+    Logger::log("Connecting to WiFi (attempt " + String(failures + 1) + ")...");
+    WiFi.begin(ssid, password);
+    if (jitterState == 0) {
+      seedJitter();
+    }
+    enter(Connecting, now);
+  }
+
+  // The MAC address differs per board and micros() once the radio is up differs per boot, so
+  // boards that lose the same router draw different retry times
+  void seedJitter() {
+    uint8_t mac[6] = {};
+    WiFi.macAddress(mac);
+    uint32_t seed = 2166136261UL; // FNV-1a over the MAC
+    for (int i = 0; i < 6; i++) {
+      seed = (seed ^ mac[i]) * 16777619UL;
+    }
+    setJitterSeed(seed ^ (uint32_t)micros());
+  }
+
+  uint32_t nextJitter() {
+    jitterState ^= jitterState << 13;
+    jitterState ^= jitterState >> 17;
+    jitterState ^= jitterState << 5;
+    return jitterState;
+  }
+
+  unsigned long pollConnecting(unsigned long now) {
+    int status = WiFi.status();
+    if (status == WL_CONNECTED) {
+      recordJoin(now - stateSince);
+      enter(Connected, now);
+      readRssi(true);
+      Logger::log("WiFi connected in " + String(lastConnectMs) + " ms, IP address: " + WiFi.localIP().toString() +
+        ", signal " + String(rssi) + " dBm");
+      notify(WiFiEvent::LinkUp);
+      return linkCheckMs;
+    }
+
+    if (status != WL_CONNECT_FAILED && now - stateSince < connectTimeoutMs) {
+      return statusPollMs;
+    }
+
+    Logger::log("WiFi connection attempt failed, status ", status);
+    WiFi.disconnect();
+    scheduleRetry(now);
+    notify(WiFiEvent::AttemptFailed);
+    return retryAt - now;
+  }
+
+  unsigned long pollConnected(unsigned long now) {
+    int status = WiFi.status();
+    if (status == WL_CONNECTED) {
+      readRssi(false);
+      return linkCheckMs;
+    }
+
+    drops++;
+    connectedMs += now - stateSince;
+    Logger::log("WiFi link lost after " + String((now - stateSince) / 1000) + " s, status ", status);
+    WiFi.disconnect();
+    scheduleRetry(now);
+    notify(WiFiEvent::LinkDown);
+    return retryAt - now;
+  }
+
+  // Next attempt after base * 2^failures (capped), jittered into [delay/2, delay]
+  void scheduleRetry(unsigned long now) {
+    unsigned long delayMs = baseBackoffMs;
+    for (int i = 0; i < failures && delayMs < maxBackoffMs; i++) {
+      delayMs *= 2;
+    }
+    delayMs = delayMs < maxBackoffMs ? delayMs : maxBackoffMs;
+    delayMs = delayMs / 2 + nextJitter() % (delayMs / 2 + 1);
+    failures++;
+    retryAt = now + delayMs;
+    enter(Backoff, now);
+    Logger::log("Retrying WiFi in " + String(delayMs) + " ms");
+  }
+
+  void recordJoin(unsigned long connectMs) {
+    joins++;
+    failures = 0;
+    lastConnectMs = connectMs;
+    totalConnectMs += connectMs;
+    fastestConnectMs = joins == 1 || connectMs < fastestConnectMs ? connectMs : fastestConnectMs;
+    slowestConnectMs = connectMs > slowestConnectMs ? connectMs : slowestConnectMs;
+  }
+
+  void readRssi(bool newLink) {
+    rssi = WiFi.RSSI();
+    if (newLink) {
+      rssiMin = rssi;
+      rssiMax = rssi;
+      rssiSmoothed = rssi;
+      return;
+    }
+    rssiMin = rssi < rssiMin ? rssi : rssiMin;
+    rssiMax = rssi > rssiMax ? rssi : rssiMax;
+    rssiSmoothed += 0.2f * (rssi - rssiSmoothed);
+  }
+
+  void enter(State next, unsigned long now) {
+    state = next;
+    stateSince = now;
+  }
+
+  void notify(WiFiEvent event) {
+    if (handler != nullptr) {
+      handler(event);
+    }
+  }
+};
@@ -1,520 +1,159 @@
-const uint8_t Inter_Bold18pt7bBitmaps[] PROGMEM = {
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xEF,
-  0xBE, 0x79, 0xE0, 0x00, 0x7B, 0xFF, 0xFF, 0xFD, 0xE0, 0xF8, 0xFB, 0xC3,
-  0xDE, 0x1E, 0xF0, 0xF7, 0x87, 0xBC, 0x3D, 0xE1, 0xEF, 0x0F, 0x78, 0x7B,
-  0xC3, 0xDE, 0x1E, 0x01, 0xE0, 0xF0, 0x07, 0x83, 0xC0, 0x1E, 0x0F, 0x00,
-  0xF0, 0x78, 0x03, 0xC1, 0xE0, 0x0F, 0x07, 0x83, 0xFF, 0xFF, 0xCF, 0xFF,
-  0xFF, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0x78, 0x3C, 0x01, 0xE0, 0xF0,
-  0x07, 0x83, 0xC0, 0x1E, 0x0F, 0x00, 0x78, 0x3C, 0x1F, 0xFF, 0xFE, 0x7F,
-  0xFF, 0xF9, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x03, 0xC1, 0xE0, 0x0F, 0x07,
-  0x80, 0x38, 0x1C, 0x01, 0xE0, 0xF0, 0x07, 0x83, 0xC0, 0x1E, 0x0F, 0x00,
-  0x78, 0x3C, 0x00, 0x00, 0x30, 0x00, 0x01, 0x80, 0x00, 0x0C, 0x00, 0x00,
-  0x60, 0x00, 0x1F, 0xE0, 0x03, 0xFF, 0xC0, 0x7F, 0xFF, 0x07, 0xFF, 0xFC,
-  0x3F, 0xBF, 0xF3, 0xF1, 0x9F, 0x9F, 0x8C, 0x7C, 0xFC, 0x63, 0xE7, 0xE3,
-  0x00, 0x3F, 0x98, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0x80,
-  0x3F, 0xFE, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xE0, 0x03, 0x3F, 0x00, 0x18,
-  0xFF, 0xF0, 0xC7, 0xEF, 0x86, 0x3F, 0x7E, 0x33, 0xF3, 0xFD, 0xBF, 0x8F,
-  0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0xFF, 0xFC, 0x01, 0xFF, 0x00, 0x00, 0xC0,
-  0x00, 0x06, 0x00, 0x00, 0x30, 0x00, 0x1F, 0x00, 0x07, 0x80, 0xFF, 0x00,
-  0x1C, 0x07, 0xFE, 0x00, 0xF0, 0x3C, 0x78, 0x07, 0x80, 0xF0, 0xE0, 0x1C,
-  0x03, 0xC3, 0x80, 0xF0, 0x0F, 0x0E, 0x07, 0x80, 0x3C, 0x38, 0x1C, 0x00,
-  0xF1, 0xE0, 0xF0, 0x01, 0xFF, 0x87, 0x80, 0x03, 0xFC, 0x1C, 0x00, 0x07,
-  0xE0, 0xF0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x1C, 0x0F, 0x80, 0x00,
-  0xF0, 0xFF, 0x00, 0x07, 0x87, 0xFE, 0x00, 0x1C, 0x1E, 0x78, 0x00, 0xF0,
-  0x70, 0xE0, 0x07, 0x83, 0xC3, 0xC0, 0x1C, 0x0F, 0x0F, 0x00, 0xF0, 0x3C,
-  0x3C, 0x07, 0x80, 0xF0, 0xE0, 0x1C, 0x01, 0xE7, 0x80, 0xE0, 0x07, 0xFE,
-  0x07, 0x80, 0x0F, 0xF0, 0x3C, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x0F,
-  0xF8, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xF8, 0x01, 0xF1, 0xF0, 0x03, 0xC1,
-  0xE0, 0x07, 0x83, 0xC0, 0x0F, 0x07, 0x80, 0x1F, 0x1F, 0x00, 0x3E, 0x7C,
-  0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xFE, 0x0F,
-  0x0F, 0xFE, 0x1E, 0x3F, 0x7E, 0x7C, 0x7C, 0x7E, 0xF8, 0xF8, 0x7F, 0xE3,
-  0xE0, 0x7F, 0xC7, 0xE0, 0x7F, 0x87, 0xC0, 0x7E, 0x0F, 0xC3, 0xFC, 0x1F,
-  0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x1F, 0xFE, 0xF8, 0x0F, 0xF0, 0xFC, 0xFB,
-  0xDE, 0xF7, 0xBD, 0xEF, 0x7B, 0xDE, 0x0F, 0x87, 0x87, 0xC3, 0xE3, 0xE1,
-  0xF0, 0xF8, 0xFC, 0x7C, 0x3E, 0x1F, 0x1F, 0x8F, 0xC7, 0xC3, 0xE1, 0xF0,
-  0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xE3, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F,
-  0x87, 0xC3, 0xE0, 0xF8, 0x7C, 0x3F, 0x0F, 0x80, 0xF8, 0x3E, 0x1F, 0x07,
-  0xC3, 0xE1, 0xF0, 0xFC, 0x3E, 0x1F, 0x0F, 0x87, 0xE1, 0xF0, 0xF8, 0x7C,
-  0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x3F, 0x1F,
-  0x0F, 0x87, 0xC7, 0xE3, 0xE1, 0xF1, 0xF0, 0xF8, 0xF8, 0x00, 0x07, 0x80,
-  0x1C, 0x04, 0x70, 0x99, 0xC6, 0xFF, 0x7B, 0xFF, 0xF3, 0xFF, 0x03, 0xF0,
-  0x3F, 0xE3, 0xFF, 0xEF, 0xF7, 0xD9, 0xCE, 0x47, 0x08, 0x1C, 0x00, 0x78,
-  0x00, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x01, 0xE0,
-  0x00, 0x78, 0x00, 0x1E, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07,
-  0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x7E, 0xF9, 0xF3, 0xE7, 0x8F, 0x3E,
-  0x78, 0xF1, 0xE3, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xEF,
-  0xFF, 0xF9, 0xE0, 0x00, 0x78, 0x07, 0xC0, 0x3E, 0x01, 0xE0, 0x0F, 0x00,
-  0xF8, 0x07, 0xC0, 0x3C, 0x01, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0x80, 0x3C,
-  0x03, 0xE0, 0x1F, 0x00, 0xF0, 0x07, 0x80, 0x7C, 0x03, 0xE0, 0x1E, 0x01,
-  0xF0, 0x0F, 0x80, 0x78, 0x03, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x00, 0x78,
-  0x07, 0xC0, 0x3E, 0x01, 0xE0, 0x1F, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xE0,
-  0x1F, 0xFF, 0x83, 0xFF, 0xF8, 0x3F, 0x1F, 0xC7, 0xE0, 0x7E, 0x7C, 0x03,
-  0xEF, 0xC0, 0x3E, 0xF8, 0x03, 0xFF, 0x80, 0x3F, 0xF8, 0x01, 0xFF, 0x80,
-  0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0xF8,
-  0x01, 0xFF, 0x80, 0x3F, 0xFC, 0x03, 0xE7, 0xC0, 0x3E, 0x7E, 0x07, 0xE3,
-  0xF0, 0xFC, 0x3F, 0xFF, 0xC1, 0xFF, 0xF8, 0x0F, 0xFE, 0x00, 0x3F, 0x80,
-  0x07, 0xE3, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF8, 0xFE, 0x1F, 0x83,
-  0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0,
-  0x7C, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C,
-  0x07, 0xF0, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xFF, 0xFE, 0x7E, 0x1F, 0xBF,
-  0x03, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xF0, 0x00,
-  0xF8, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x07, 0xF0,
-  0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F,
-  0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03,
-  0xF8, 0x01, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xFF, 0xC7, 0xE1, 0xFD, 0xF8,
-  0x0F, 0xBE, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x0F,
-  0xFC, 0x01, 0xFE, 0x00, 0x3F, 0xE0, 0x07, 0xFF, 0x00, 0x07, 0xF0, 0x00,
-  0x3F, 0x00, 0x07, 0xE0, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0xC0,
-  0x7F, 0xFC, 0x3F, 0x9F, 0xFF, 0xF1, 0xFF, 0xFC, 0x1F, 0xFE, 0x00, 0x7F,
-  0x00, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x7F, 0x80, 0x0F, 0xF8, 0x00,
-  0xFF, 0x80, 0x1F, 0xF8, 0x03, 0xFF, 0x80, 0x3E, 0xF8, 0x07, 0xCF, 0x80,
-  0xFC, 0xF8, 0x0F, 0x8F, 0x81, 0xF0, 0xF8, 0x1F, 0x0F, 0x83, 0xE0, 0xF8,
-  0x7E, 0x0F, 0x87, 0xC0, 0xF8, 0xF8, 0x0F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00,
-  0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x3F, 0xFF, 0xC7, 0xFF, 0xF8, 0xFF,
-  0xFF, 0x1F, 0xFF, 0xE3, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0,
-  0x00, 0x7C, 0xFC, 0x0F, 0xBF, 0xE1, 0xFF, 0xFE, 0x3F, 0xFF, 0xC7, 0xE1,
-  0xFC, 0x38, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00,
-  0x7F, 0xE0, 0x0F, 0xFE, 0x03, 0xF7, 0xC0, 0x7C, 0xFE, 0x3F, 0x8F, 0xFF,
-  0xE1, 0xFF, 0xF8, 0x0F, 0xFE, 0x00, 0x7F, 0x00, 0x01, 0xF8, 0x00, 0xFF,
-  0xE0, 0x7F, 0xFE, 0x1F, 0xFF, 0xE3, 0xF0, 0xFC, 0xFC, 0x0F, 0xDF, 0x00,
-  0xFF, 0xC0, 0x00, 0xF8, 0x7C, 0x1F, 0x3F, 0xE3, 0xEF, 0xFE, 0x7F, 0xFF,
-  0xEF, 0xF1, 0xFD, 0xFC, 0x0F, 0xFF, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03,
-  0xFF, 0x00, 0x7F, 0xF0, 0x0F, 0xFE, 0x01, 0xF7, 0xE0, 0x7E, 0xFE, 0x3F,
-  0x8F, 0xFF, 0xE0, 0xFF, 0xFC, 0x0F, 0xFE, 0x00, 0x7F, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xC0, 0x03, 0xF0,
-  0x00, 0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x03, 0xE0, 0x01,
-  0xF8, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x01, 0xF0,
-  0x00, 0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x07, 0xC0, 0x03, 0xF0, 0x00,
-  0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xF8, 0x01,
-  0xFF, 0xC0, 0xFF, 0xFE, 0x3F, 0xFF, 0xE7, 0xE1, 0xFC, 0xF8, 0x0F, 0x9F,
-  0x01, 0xF3, 0xE0, 0x3E, 0x7C, 0x07, 0xCF, 0xC1, 0xF0, 0xFF, 0xFE, 0x07,
-  0xFF, 0x01, 0xFF, 0xF0, 0x7F, 0xFF, 0x1F, 0xC7, 0xF7, 0xE0, 0x3F, 0xF8,
-  0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0xC0, 0x7F, 0xFC,
-  0x3F, 0xDF, 0xFF, 0xF1, 0xFF, 0xFC, 0x1F, 0xFF, 0x00, 0x7F, 0x00, 0x03,
-  0xF0, 0x01, 0xFF, 0xC0, 0xFF, 0xFC, 0x3F, 0xFF, 0xC7, 0xE1, 0xFD, 0xF8,
-  0x1F, 0xBE, 0x01, 0xF7, 0xC0, 0x3F, 0xF8, 0x03, 0xFF, 0x00, 0xFF, 0xE0,
-  0x1F, 0xFE, 0x07, 0xFF, 0xE1, 0xFE, 0xFF, 0xFF, 0xCF, 0xFE, 0xF8, 0xFF,
-  0x9F, 0x07, 0xC3, 0xE0, 0x00, 0x7C, 0x00, 0x1F, 0x7C, 0x03, 0xEF, 0xC0,
-  0xFC, 0xFC, 0x3F, 0x1F, 0xFF, 0xC1, 0xFF, 0xF0, 0x1F, 0xFC, 0x00, 0x7E,
-  0x00, 0x7B, 0xEF, 0xFF, 0xF9, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF,
-  0xBF, 0xFF, 0xE7, 0x80, 0x3C, 0xF9, 0xFB, 0xF7, 0xC7, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7C, 0xF9, 0xF3, 0xC7, 0x9F, 0x3C,
-  0x78, 0xF1, 0xE0, 0x00, 0x00, 0x80, 0x01, 0xC0, 0x07, 0xE0, 0x0F, 0xF0,
-  0x1F, 0xF8, 0x3F, 0xF8, 0xFF, 0xE1, 0xFF, 0xC0, 0xFF, 0x00, 0x7E, 0x00,
-  0x3F, 0x80, 0x1F, 0xF0, 0x07, 0xFF, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x01,
-  0xFF, 0x00, 0x3F, 0x80, 0x07, 0xC0, 0x00, 0x60, 0x00, 0x10, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x80, 0x00, 0x70, 0x00, 0x3F, 0x00, 0x1F, 0xE0,
-  0x0F, 0xFC, 0x03, 0xFF, 0x80, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0x7F, 0x80,
-  0x0F, 0xC0, 0x0F, 0xE0, 0x3F, 0xF0, 0x7F, 0xF0, 0xFF, 0xC3, 0xFF, 0x81,
-  0xFF, 0x00, 0xFE, 0x00, 0x78, 0x00, 0x30, 0x00, 0x10, 0x00, 0x00, 0x07,
-  0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x8F, 0xFF, 0xE7, 0xE3, 0xFB, 0xE0, 0xFF,
-  0xE0, 0x3E, 0x00, 0x1F, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x1F, 0xC0, 0x1F,
-  0xC0, 0x1F, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xC0, 0x01,
-  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0x00, 0x1F, 0x80,
-  0x0F, 0xC0, 0x07, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-  0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xE0, 0x0F,
-  0xF8, 0x0F, 0xF0, 0x1F, 0xC0, 0x01, 0xF8, 0x3F, 0x00, 0x00, 0xFC, 0x3E,
-  0x07, 0xCF, 0x7C, 0x7C, 0x1F, 0xEF, 0x3E, 0x7C, 0x3F, 0xFF, 0x1E, 0xF8,
-  0x7F, 0xFF, 0x1F, 0xF8, 0x7C, 0x7F, 0x1F, 0xF0, 0xF8, 0x1F, 0x0F, 0xF0,
-  0xF0, 0x1F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0,
-  0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0,
-  0xF0, 0x1F, 0x0F, 0xF0, 0xF8, 0x1F, 0x0F, 0xF8, 0x7C, 0x7F, 0x1E, 0xF8,
-  0x7F, 0xFF, 0x1E, 0x7C, 0x3F, 0xFF, 0xFC, 0x7C, 0x1F, 0xF7, 0xF8, 0x3E,
-  0x0F, 0xC3, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x0F,
-  0xF8, 0x07, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
-  0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-  0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x01, 0xFF,
-  0x80, 0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0, 0x03, 0xE7, 0xC0, 0x07, 0xE7,
-  0xE0, 0x07, 0xC3, 0xE0, 0x07, 0xC3, 0xE0, 0x0F, 0xC3, 0xF0, 0x0F, 0xC1,
-  0xF0, 0x0F, 0x81, 0xF8, 0x1F, 0x81, 0xF8, 0x1F, 0xFF, 0xF8, 0x1F, 0xFF,
-  0xFC, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x3E, 0x00, 0x7E, 0x7E, 0x00,
-  0x7E, 0x7E, 0x00, 0x7E, 0x7C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00,
-  0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFC,
-  0x0F, 0xEF, 0xC0, 0x7E, 0xFC, 0x07, 0xEF, 0xC0, 0x3E, 0xFC, 0x07, 0xEF,
-  0xC0, 0x7C, 0xFC, 0x0F, 0xCF, 0xFF, 0xF8, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8,
-  0xFF, 0xFF, 0xCF, 0xC0, 0xFE, 0xFC, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x01,
-  0xFF, 0xC0, 0x3F, 0xFC, 0x03, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xEF, 0xFF,
-  0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0x80,
-  0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x83, 0xF8, 0x3F, 0x8F, 0xE0, 0x3F, 0x9F,
-  0x80, 0x3F, 0x3E, 0x00, 0x3E, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xE0,
-  0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00,
-  0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0xFF, 0xF0, 0x01,
-  0xF3, 0xF0, 0x07, 0xE7, 0xF0, 0x1F, 0x87, 0xF8, 0x7F, 0x07, 0xFF, 0xFC,
-  0x07, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0xFF, 0xF8, 0x03,
-  0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xF8, 0xFC, 0x0F, 0xE3, 0xF0,
-  0x0F, 0xCF, 0xC0, 0x1F, 0xBF, 0x00, 0x3E, 0xFC, 0x00, 0xFB, 0xF0, 0x03,
-  0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF,
-  0xC0, 0x07, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xEF, 0xC0,
-  0x0F, 0xBF, 0x00, 0x7E, 0xFC, 0x03, 0xF3, 0xF0, 0x3F, 0x8F, 0xFF, 0xFE,
-  0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xBF,
-  0xFF, 0xEF, 0xFF, 0xFB, 0xFF, 0xFE, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0,
-  0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xFE,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xEF, 0xFF, 0xFB, 0xF0, 0x00, 0xFC, 0x00, 0x3F,
-  0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8,
-  0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xFF, 0xF7,
-  0xFF, 0xFB, 0xFF, 0xFD, 0xFF, 0xFE, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00,
-  0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC,
-  0x00, 0x7E, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0x80, 0x3F, 0xFF,
-  0x80, 0xFF, 0xFF, 0x83, 0xF8, 0x3F, 0x8F, 0xE0, 0x1F, 0x9F, 0x80, 0x3F,
-  0x3E, 0x00, 0x3E, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07,
-  0xC0, 0x00, 0x0F, 0x80, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0x03, 0xFF, 0xFC,
-  0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0xFF, 0xF0, 0x01, 0xF3, 0xF0,
-  0x03, 0xE7, 0xF0, 0x0F, 0xC7, 0xF8, 0x7F, 0x07, 0xFF, 0xFC, 0x07, 0xFF,
-  0xF0, 0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0x7F, 0xF0, 0x01,
-  0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF,
-  0xC0, 0x07, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0,
-  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x07, 0xFF,
-  0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0x00,
-  0x1F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0,
-  0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07,
-  0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00,
-  0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x81, 0xFF, 0xC1, 0xFB,
-  0xF1, 0xFD, 0xFF, 0xFC, 0x7F, 0xFC, 0x1F, 0xFC, 0x03, 0xF8, 0x00, 0xFC,
-  0x01, 0xFF, 0xF0, 0x07, 0xEF, 0xC0, 0x3F, 0x3F, 0x01, 0xF8, 0xFC, 0x0F,
-  0xC3, 0xF0, 0x7F, 0x0F, 0xC3, 0xF8, 0x3F, 0x1F, 0xC0, 0xFC, 0x7E, 0x03,
-  0xF3, 0xF0, 0x0F, 0xDF, 0x80, 0x3F, 0xFE, 0x00, 0xFF, 0xF8, 0x03, 0xFF,
-  0xF0, 0x0F, 0xFF, 0xE0, 0x3F, 0xDF, 0x80, 0xFE, 0x3F, 0x03, 0xF8, 0x7E,
-  0x0F, 0xC1, 0xF8, 0x3F, 0x03, 0xF0, 0xFC, 0x07, 0xE3, 0xF0, 0x1F, 0x8F,
-  0xC0, 0x3F, 0x3F, 0x00, 0x7E, 0xFC, 0x01, 0xFB, 0xF0, 0x03, 0xF0, 0xFC,
-  0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03,
-  0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80,
-  0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E,
-  0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0x80, 0x0F, 0xFF, 0xFC,
-  0x00, 0x7F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x01,
-  0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xEF, 0x80, 0xFF, 0xFF, 0x7C, 0x07, 0xFF,
-  0xFB, 0xE0, 0x3D, 0xFF, 0xCF, 0x83, 0xEF, 0xFE, 0x7C, 0x1F, 0x7F, 0xFB,
-  0xE1, 0xFB, 0xFF, 0xDF, 0x8F, 0x9F, 0xFE, 0x7C, 0x7C, 0xFF, 0xF3, 0xE3,
-  0xE7, 0xFF, 0x9F, 0x3E, 0x3F, 0xFC, 0x7D, 0xF1, 0xFF, 0xE3, 0xEF, 0x8F,
-  0xFF, 0x0F, 0x78, 0x7F, 0xF8, 0x7B, 0xC3, 0xFF, 0xC3, 0xFE, 0x1F, 0xFE,
-  0x0F, 0xE0, 0xFF, 0xF0, 0x7F, 0x07, 0xFF, 0x83, 0xF8, 0x3F, 0xFC, 0x0F,
-  0x81, 0xFF, 0xE0, 0x7C, 0x0F, 0xC0, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0xFF,
-  0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x0F, 0xFF,
-  0xF0, 0x1F, 0xFD, 0xF0, 0x3F, 0xFB, 0xE0, 0x7F, 0xFB, 0xE0, 0xFF, 0xF7,
-  0xE1, 0xFF, 0xE7, 0xC3, 0xFF, 0xCF, 0xC7, 0xFF, 0x8F, 0x8F, 0xFF, 0x0F,
-  0x9F, 0xFE, 0x1F, 0xBF, 0xFC, 0x1F, 0x7F, 0xF8, 0x3F, 0xFF, 0xF0, 0x3F,
-  0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0xFF,
-  0xFE, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00,
-  0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x3F, 0x83, 0xF8,
-  0x7F, 0x01, 0xFC, 0x7E, 0x00, 0xFC, 0x7C, 0x00, 0x7E, 0xFC, 0x00, 0x7E,
-  0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3F,
-  0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E,
-  0xFC, 0x00, 0x3E, 0xFC, 0x00, 0x7E, 0x7E, 0x00, 0xFC, 0x7F, 0x01, 0xFC,
-  0x3F, 0xC3, 0xF8, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xC0,
-  0x00, 0xFE, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x8F, 0xFF,
-  0xFC, 0xFC, 0x1F, 0xEF, 0xC0, 0x7E, 0xFC, 0x03, 0xEF, 0xC0, 0x3E, 0xFC,
-  0x03, 0xFF, 0xC0, 0x3E, 0xFC, 0x03, 0xEF, 0xC0, 0x7E, 0xFC, 0x0F, 0xEF,
-  0xFF, 0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0xFF, 0xFC, 0x0F, 0xC0, 0x00,
-  0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00,
-  0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xFE, 0x00, 0x07,
-  0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x3F, 0x83, 0xF8, 0x7F,
-  0x01, 0xFC, 0x7E, 0x00, 0xFC, 0x7C, 0x00, 0x7E, 0xFC, 0x00, 0x7E, 0xF8,
-  0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3F, 0xF8,
-  0x00, 0x3F, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xFC,
-  0x3E, 0x7E, 0xFC, 0x1E, 0x7E, 0x7E, 0x0F, 0xFC, 0x7F, 0x0F, 0xFC, 0x3F,
-  0xC7, 0xF8, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x00,
-  0xFE, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E, 0xFF, 0xFC, 0x0F, 0xFF,
-  0xF0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFC, 0x0F, 0xEF, 0xC0, 0x7E, 0xFC,
-  0x03, 0xEF, 0xC0, 0x3E, 0xFC, 0x03, 0xFF, 0xC0, 0x3E, 0xFC, 0x07, 0xEF,
-  0xC0, 0xFE, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0xFF, 0xFF, 0x0F, 0xFF, 0xE0,
-  0xFC, 0x3F, 0x0F, 0xC3, 0xF0, 0xFC, 0x1F, 0x8F, 0xC1, 0xF8, 0xFC, 0x0F,
-  0xCF, 0xC0, 0xFC, 0xFC, 0x07, 0xEF, 0xC0, 0x7E, 0xFC, 0x03, 0xFF, 0xC0,
-  0x3F, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0xC3,
-  0xF0, 0x7F, 0x3F, 0x01, 0xF9, 0xF8, 0x07, 0xCF, 0xC0, 0x00, 0x7E, 0x00,
-  0x03, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xF8, 0x03,
-  0xFF, 0xF0, 0x07, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-  0xFF, 0x00, 0x7E, 0xF8, 0x03, 0xF7, 0xE0, 0x1F, 0x3F, 0x83, 0xF8, 0xFF,
-  0xFF, 0x83, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x0F, 0xF0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x80, 0x00,
-  0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
-  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03,
-  0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00,
-  0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-  0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0xFC, 0x00, 0xFF, 0xF0, 0x03,
-  0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-  0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0,
-  0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x0F,
-  0xFF, 0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xF0, 0x03, 0xEF, 0xC0, 0x0F, 0x9F,
-  0x00, 0x7E, 0x7E, 0x01, 0xF8, 0xFE, 0x1F, 0xC3, 0xFF, 0xFE, 0x07, 0xFF,
-  0xF8, 0x07, 0xFF, 0x80, 0x07, 0xF8, 0x00, 0xFC, 0x00, 0x3F, 0xFC, 0x00,
-  0x3F, 0x7C, 0x00, 0x3F, 0x7E, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x3E, 0x00,
-  0x7E, 0x3F, 0x00, 0x7C, 0x3F, 0x00, 0xFC, 0x1F, 0x00, 0xFC, 0x1F, 0x80,
-  0xF8, 0x1F, 0x81, 0xF8, 0x0F, 0x81, 0xF8, 0x0F, 0xC1, 0xF0, 0x07, 0xC3,
-  0xF0, 0x07, 0xC3, 0xF0, 0x07, 0xE3, 0xE0, 0x03, 0xE3, 0xE0, 0x03, 0xE7,
-  0xE0, 0x03, 0xE7, 0xC0, 0x01, 0xF7, 0xC0, 0x01, 0xF7, 0xC0, 0x01, 0xFF,
-  0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7F,
-  0x00, 0xFC, 0x03, 0xF0, 0x07, 0xFF, 0x80, 0x7E, 0x00, 0xF9, 0xF0, 0x0F,
-  0xE0, 0x3F, 0x3E, 0x01, 0xFC, 0x07, 0xE7, 0xE0, 0x7F, 0x80, 0xFC, 0xFC,
-  0x0F, 0xF0, 0x1F, 0x0F, 0x81, 0xFF, 0x07, 0xE1, 0xF0, 0x3F, 0xE0, 0xFC,
-  0x3F, 0x0F, 0xBC, 0x1F, 0x07, 0xE1, 0xF7, 0x83, 0xE0, 0x7C, 0x3E, 0xF8,
-  0x7C, 0x0F, 0x87, 0x9F, 0x1F, 0x81, 0xF1, 0xF3, 0xE3, 0xE0, 0x3F, 0x3E,
-  0x3C, 0x7C, 0x03, 0xE7, 0xC7, 0xCF, 0x80, 0x7C, 0xF0, 0xFB, 0xF0, 0x0F,
-  0x9E, 0x1F, 0x7C, 0x01, 0xF7, 0xC1, 0xEF, 0x80, 0x1F, 0xF8, 0x3D, 0xF0,
-  0x03, 0xFE, 0x07, 0xBE, 0x00, 0x7F, 0xC0, 0xFF, 0x80, 0x07, 0xF8, 0x0F,
-  0xF0, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x1F, 0xC0, 0x3F, 0xC0, 0x03, 0xF8,
-  0x07, 0xF0, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x7E, 0x3F, 0x00,
-  0xFC, 0x3F, 0x00, 0xFC, 0x1F, 0x81, 0xF8, 0x0F, 0xC3, 0xF0, 0x0F, 0xC3,
-  0xF0, 0x07, 0xE7, 0xE0, 0x03, 0xE7, 0xC0, 0x03, 0xFF, 0xC0, 0x01, 0xFF,
-  0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F,
-  0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x03, 0xE7,
-  0xC0, 0x07, 0xE7, 0xE0, 0x0F, 0xC3, 0xF0, 0x0F, 0xC3, 0xF0, 0x1F, 0x81,
-  0xF8, 0x3F, 0x00, 0xFC, 0x3F, 0x00, 0xFC, 0x7E, 0x00, 0x7E, 0xFC, 0x00,
-  0x3F, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x7E, 0x7E, 0x00, 0xFE, 0x3F, 0x00,
-  0xFC, 0x3F, 0x01, 0xF8, 0x1F, 0x81, 0xF8, 0x0F, 0x83, 0xF0, 0x0F, 0xC3,
-  0xF0, 0x07, 0xE7, 0xE0, 0x07, 0xE7, 0xC0, 0x03, 0xEF, 0xC0, 0x01, 0xFF,
-  0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7E,
-  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E,
-  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E,
-  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x80, 0x07, 0xE0,
-  0x00, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x7E, 0x00,
-  0x1F, 0x80, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x01,
-  0xF8, 0x00, 0x7E, 0x00, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87,
-  0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0,
-  0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF8,
-  0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x07, 0xC0,
-  0x1E, 0x00, 0xF0, 0x07, 0xC0, 0x3E, 0x00, 0xF0, 0x07, 0x80, 0x3E, 0x01,
-  0xF0, 0x07, 0x80, 0x3C, 0x01, 0xF0, 0x0F, 0x80, 0x3C, 0x01, 0xE0, 0x0F,
-  0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x80, 0x7C, 0x01, 0xE0, 0x0F, 0x00, 0x7C,
-  0x03, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
-  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x80, 0x7F, 0x00, 0xEF, 0x03, 0xDE, 0x07,
-  0x9C, 0x1E, 0x3C, 0x3C, 0x78, 0xF0, 0x79, 0xE0, 0xF7, 0x80, 0xF0, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF8, 0xF1, 0xF1, 0xE3,
-  0xC3, 0xC0, 0x03, 0xF8, 0x07, 0xFF, 0x0F, 0xFF, 0xC7, 0xFF, 0xF7, 0xE1,
-  0xFB, 0xE0, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x01, 0xFF, 0x8F, 0xFF, 0xCF,
-  0xFF, 0xEF, 0xC1, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xE0, 0x7F, 0xF8, 0x7F,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xCF, 0xFB, 0xE1, 0xF1, 0xF0, 0xF8, 0x00, 0x1F,
-  0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E,
-  0x3F, 0x07, 0xCF, 0xF0, 0xFB, 0xFF, 0x9F, 0x7F, 0xF3, 0xFC, 0x7F, 0x7E,
-  0x07, 0xEF, 0xC0, 0x7D, 0xF8, 0x0F, 0xFE, 0x01, 0xFF, 0xC0, 0x3F, 0xF8,
-  0x03, 0xFF, 0x00, 0xFF, 0xF0, 0x1F, 0xFE, 0x03, 0xEF, 0xE0, 0xFD, 0xFE,
-  0x3F, 0xBF, 0xFF, 0xE7, 0xDF, 0xFC, 0xF9, 0xFE, 0x1F, 0x1F, 0x80, 0x03,
-  0xF8, 0x03, 0xFF, 0x81, 0xFF, 0xF0, 0xFF, 0xFE, 0x3F, 0x1F, 0xDF, 0x81,
-  0xF7, 0xC0, 0x7D, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03,
-  0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x01, 0xF7, 0xE0, 0x7C, 0xFC, 0x3F, 0x3F,
-  0xFF, 0x87, 0xFF, 0xC0, 0xFF, 0xE0, 0x0F, 0xE0, 0x00, 0x03, 0xE0, 0x00,
-  0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0xF8,
-  0xF8, 0x7F, 0x9F, 0x1F, 0xFB, 0xE7, 0xFF, 0xFD, 0xFC, 0x7F, 0xBF, 0x03,
-  0xF7, 0xC0, 0x7E, 0xF8, 0x07, 0xFF, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x03,
-  0xFF, 0x80, 0x7D, 0xF0, 0x0F, 0xBE, 0x03, 0xF7, 0xE0, 0x7E, 0xFE, 0x3F,
-  0xCF, 0xFF, 0xF8, 0xFF, 0xDF, 0x0F, 0xF3, 0xE0, 0xFC, 0x7C, 0x03, 0xF8,
-  0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0xFF, 0xC3, 0xF1, 0xFC, 0xFC, 0x0F,
-  0x9F, 0x01, 0xF3, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFE, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x81, 0xF1, 0xF8, 0x7E,
-  0x3F, 0xFF, 0x83, 0xFF, 0xF0, 0x3F, 0xF8, 0x01, 0xFC, 0x00, 0x01, 0xFC,
-  0x1F, 0xE0, 0xFF, 0x83, 0xFE, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x3F, 0xFE,
-  0xFF, 0xFB, 0xFF, 0xEF, 0xFF, 0x83, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8,
-  0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E,
-  0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x00, 0x03, 0xE3,
-  0xE1, 0xFE, 0x7C, 0x7F, 0xEF, 0x9F, 0xFF, 0xF7, 0xF1, 0xFE, 0xFC, 0x0F,
-  0xDF, 0x01, 0xFB, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x0F,
-  0xFE, 0x01, 0xF7, 0xC0, 0x3E, 0xF8, 0x0F, 0xDF, 0x81, 0xFB, 0xF8, 0xFF,
-  0x3F, 0xFF, 0xE3, 0xFF, 0x7C, 0x3F, 0xCF, 0x83, 0xF1, 0xF0, 0x00, 0x3E,
-  0x08, 0x0F, 0xDF, 0x83, 0xF1, 0xFF, 0xFE, 0x3F, 0xFF, 0x81, 0xFF, 0xE0,
-  0x0F, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00,
-  0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x8F, 0xC3, 0xE7, 0xF8, 0xFB, 0xFF, 0x3F,
-  0xFF, 0xEF, 0xF1, 0xFB, 0xF0, 0x3F, 0xFC, 0x0F, 0xFE, 0x01, 0xFF, 0x80,
-  0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F,
-  0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE,
-  0x01, 0xF0, 0x7B, 0xFF, 0xFF, 0x78, 0x00, 0x3E, 0xFB, 0xEF, 0xBE, 0xFB,
-  0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0x80, 0x0F,
-  0x0F, 0xC7, 0xE3, 0xF0, 0xF0, 0x00, 0x00, 0x3E, 0x1F, 0x0F, 0x87, 0xC3,
-  0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8,
-  0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xE1, 0xF1, 0xFB, 0xFD, 0xFC, 0xFC,
-  0x7C, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8,
-  0x00, 0x3E, 0x00, 0x0F, 0x80, 0xFF, 0xE0, 0x7E, 0xF8, 0x3F, 0x3E, 0x1F,
-  0x8F, 0x8F, 0xC3, 0xE3, 0xE0, 0xF9, 0xF8, 0x3E, 0xFC, 0x0F, 0xFE, 0x03,
-  0xFF, 0x80, 0xFF, 0xF0, 0x3F, 0xFE, 0x0F, 0xDF, 0x83, 0xF3, 0xF0, 0xF8,
-  0x7E, 0x3E, 0x1F, 0x8F, 0x83, 0xF3, 0xE0, 0x7E, 0xF8, 0x1F, 0xBE, 0x03,
-  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8, 0xF8, 0x1F, 0x0F, 0x9F, 0xC7,
-  0xFC, 0xFB, 0xFE, 0x7F, 0xEF, 0xFF, 0xEF, 0xFE, 0xFE, 0x3F, 0xC7, 0xFF,
-  0xC1, 0xF8, 0x3F, 0xFC, 0x1F, 0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0x0F,
-  0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0x0F, 0x81, 0xFF, 0x80, 0xF8, 0x1F,
-  0xF8, 0x0F, 0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0x0F, 0x81, 0xFF, 0x80,
-  0xF8, 0x1F, 0xF8, 0x0F, 0x81, 0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0x0F, 0x81,
-  0xFF, 0x80, 0xF8, 0x1F, 0xF8, 0xFC, 0x3E, 0x7F, 0x8F, 0xBF, 0xF3, 0xFF,
-  0xFE, 0xFF, 0x1F, 0xBF, 0x03, 0xFF, 0xC0, 0xFF, 0xE0, 0x1F, 0xF8, 0x07,
-  0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF,
-  0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0,
-  0x1F, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0xFF, 0xC3, 0xF1,
-  0xFC, 0xFC, 0x0F, 0x9F, 0x01, 0xFB, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0x80,
-  0x7F, 0xF0, 0x0F, 0xFE, 0x01, 0xF7, 0xC0, 0x3E, 0xF8, 0x0F, 0xDF, 0x81,
-  0xF1, 0xF8, 0xFE, 0x3F, 0xFF, 0x83, 0xFF, 0xE0, 0x3F, 0xF8, 0x01, 0xFC,
-  0x00, 0xF8, 0xFC, 0x1F, 0x3F, 0xC3, 0xEF, 0xFE, 0x7F, 0xFF, 0xCF, 0xF1,
-  0xFD, 0xF8, 0x1F, 0xBF, 0x01, 0xF7, 0xE0, 0x3F, 0xF8, 0x07, 0xFF, 0x00,
-  0xFF, 0xE0, 0x0F, 0xFC, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xBF, 0x83,
-  0xF7, 0xF8, 0xFE, 0xFF, 0xFF, 0x9F, 0x7F, 0xF3, 0xE7, 0xF8, 0x7C, 0x7E,
-  0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00,
-  0x1F, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE3, 0xE1, 0xFE, 0x7C, 0x7F,
-  0xEF, 0x9F, 0xFF, 0xF7, 0xF1, 0xFE, 0xFC, 0x0F, 0xDF, 0x01, 0xFB, 0xE0,
-  0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x7F, 0xF0, 0x0F, 0xFE, 0x01, 0xF7, 0xC0,
-  0x3E, 0xF8, 0x0F, 0xDF, 0x81, 0xFB, 0xF8, 0xFF, 0x3F, 0xFF, 0xE3, 0xFF,
-  0x7C, 0x3F, 0xCF, 0x83, 0xF1, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00,
-  0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0xF8,
-  0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xFF, 0x0F, 0xC0, 0xFC, 0x0F, 0x80, 0xF8,
-  0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8,
-  0x0F, 0x80, 0xF8, 0x0F, 0x80, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x8F,
-  0xFF, 0xE7, 0xE1, 0xFB, 0xE0, 0x7D, 0xF0, 0x00, 0xFC, 0x00, 0x3F, 0xE0,
-  0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x3F, 0xF0, 0x01, 0xF8, 0x40, 0x7F, 0xF0,
-  0x3E, 0xFC, 0x3F, 0x7F, 0xFF, 0x9F, 0xFF, 0x87, 0xFF, 0x80, 0xFE, 0x00,
-  0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF1, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0,
-  0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x81, 0xFF, 0x0F, 0xF0, 0xFF,
-  0x03, 0xF0, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8,
-  0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01,
-  0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFF, 0x03, 0xFF, 0xC0, 0xFD,
-  0xF8, 0xFF, 0x7F, 0xFF, 0xCF, 0xFD, 0xF3, 0xFE, 0x7C, 0x3E, 0x1F, 0xF8,
-  0x03, 0xFF, 0xC0, 0x3E, 0xFC, 0x07, 0xE7, 0xC0, 0x7C, 0x7C, 0x07, 0xC7,
-  0xE0, 0xFC, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x1F, 0x0F, 0x81, 0xF1, 0xF0,
-  0x1F, 0x1F, 0x00, 0xF9, 0xF0, 0x0F, 0xBE, 0x00, 0xFB, 0xE0, 0x07, 0xBC,
-  0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F,
-  0x80, 0xF8, 0x1F, 0x01, 0xFF, 0x81, 0xF8, 0x1F, 0xFC, 0x1F, 0x83, 0xF7,
-  0xC1, 0xF8, 0x3E, 0x7C, 0x1F, 0x83, 0xE7, 0xC3, 0xFC, 0x3E, 0x7C, 0x3F,
-  0xC7, 0xE3, 0xE3, 0xFC, 0x7C, 0x3E, 0x3B, 0xC7, 0xC3, 0xE7, 0x9E, 0x7C,
-  0x1E, 0x79, 0xE7, 0x81, 0xE7, 0x9E, 0xF8, 0x1F, 0x79, 0xEF, 0x81, 0xFF,
-  0x0E, 0xF8, 0x0F, 0xF0, 0xFF, 0x00, 0xFF, 0x0F, 0xF0, 0x0F, 0xE0, 0xFF,
-  0x00, 0x7E, 0x07, 0xE0, 0x07, 0xE0, 0x7E, 0x00, 0x7E, 0x07, 0xE0, 0xFC,
-  0x07, 0xCF, 0x81, 0xF8, 0xF8, 0x3E, 0x1F, 0x8F, 0x81, 0xF1, 0xF0, 0x3F,
-  0x7C, 0x03, 0xEF, 0x80, 0x3F, 0xE0, 0x07, 0xF8, 0x00, 0x7F, 0x00, 0x0F,
-  0xE0, 0x03, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0x7C, 0x07, 0xCF, 0x81, 0xF8,
-  0xF8, 0x3E, 0x1F, 0x8F, 0xC1, 0xF1, 0xF0, 0x3F, 0x7E, 0x03, 0xF0, 0xF8,
-  0x03, 0xFF, 0xC0, 0x3E, 0xFC, 0x07, 0xE7, 0xC0, 0x7C, 0x7C, 0x07, 0xC3,
-  0xE0, 0xFC, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x1F, 0x1F, 0x81, 0xF1, 0xF0,
-  0x1F, 0x1F, 0x00, 0xFB, 0xE0, 0x0F, 0xBE, 0x00, 0xFB, 0xE0, 0x07, 0xBC,
-  0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x1F,
-  0x00, 0x01, 0xF0, 0x00, 0x3F, 0x00, 0x03, 0xE0, 0x03, 0xFE, 0x00, 0x3F,
-  0xC0, 0x07, 0xF8, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0x7E, 0x00, 0x7C, 0x00, 0xFC, 0x01, 0xF8, 0x03,
-  0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x0F, 0xC0, 0x1F, 0x80, 0x1F, 0x80, 0x3F,
-  0x00, 0x7E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0xF8, 0x1F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7E, 0x07, 0xC0, 0x3E, 0x01, 0xF0,
-  0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x0F, 0xC3, 0xFC, 0x1F,
-  0xC0, 0xF8, 0x07, 0xF0, 0x3F, 0xC0, 0x3F, 0x00, 0xF8, 0x07, 0xC0, 0x3E,
-  0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x80, 0xFE, 0x03, 0xFC,
-  0x1F, 0xE0, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0x0F, 0xC0, 0xFE,
-  0x0F, 0xF0, 0x3F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
-  0x00, 0xF0, 0x0F, 0x80, 0xFC, 0x0F, 0xF0, 0x7F, 0x00, 0xF0, 0x3F, 0x0F,
-  0xF0, 0xFC, 0x0F, 0x80, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x1F,
-  0x01, 0xF0, 0x3F, 0x0F, 0xF0, 0xFE, 0x0F, 0xC0, 0xF0, 0x00, 0x1E, 0x00,
-  0x1F, 0xE0, 0xF7, 0xFC, 0x3F, 0xFF, 0x9F, 0xF9, 0xFF, 0xFC, 0x3F, 0xEF,
-  0x07, 0xF0, 0x00, 0x78 };
+// InterBold18pt.h - Generated by scripts/font-subset.py from assets/fonts/InterBold18pt.h, do not edit
+// 37 of 95 glyphs:  0123456789CEHIPSTUVWadeilmnoprstuvxy
+#pragma once
+#include "../PackedFont.h"
 
-const GFXglyph Inter_Bold18pt7bGlyphs[] PROGMEM = {
-  {     0,   1,   1,   8,    0,    0 },   // 0x20 ' '
-  {     1,   6,  26,  12,    3,  -25 },   // 0x21 '!'
-  {    21,  13,  11,  19,    3,  -25 },   // 0x22 '"'
-  {    39,  22,  26,  23,    0,  -25 },   // 0x23 '#'
-  {   111,  21,  33,  23,    1,  -29 },   // 0x24 '$'
-  {   198,  30,  26,  36,    3,  -25 },   // 0x25 '%'
-  {   296,  23,  26,  24,    1,  -25 },   // 0x26 '&'
-  {   371,   5,  11,  12,    3,  -25 },   // 0x27 '''
-  {   378,   9,  33,  13,    3,  -27 },   // 0x28 '('
-  {   416,   9,  33,  13,    1,  -27 },   // 0x29 ')'
-  {   454,  14,  15,  20,    3,  -25 },   // 0x2A '*'
-  {   481,  18,  18,  24,    3,  -19 },   // 0x2B '+'
-  {   522,   7,  11,  12,    2,   -3 },   // 0x2C ','
-  {   532,  12,   4,  16,    2,  -12 },   // 0x2D '-'
-  {   538,   6,   6,  12,    3,   -5 },   // 0x2E '.'
-  {   543,  13,  32,  14,    0,  -27 },   // 0x2F '/'
-  {   595,  20,  26,  24,    2,  -25 },   // 0x30 '0'
-  {   660,  11,  26,  15,    2,  -25 },   // 0x31 '1'
-  {   696,  18,  26,  22,    2,  -25 },   // 0x32 '2'
-  {   755,  19,  26,  23,    2,  -25 },   // 0x33 '3'
-  {   817,  20,  26,  24,    2,  -25 },   // 0x34 '4'
-  {   882,  19,  26,  23,    2,  -25 },   // 0x35 '5'
-  {   944,  19,  26,  23,    2,  -25 },   // 0x36 '6'
-  {  1006,  18,  26,  21,    1,  -25 },   // 0x37 '7'
-  {  1065,  19,  26,  23,    2,  -25 },   // 0x38 '8'
-  {  1127,  19,  26,  23,    2,  -25 },   // 0x39 '9'
-  {  1189,   6,  19,  12,    3,  -18 },   // 0x3A ':'
-  {  1204,   7,  26,  12,    2,  -18 },   // 0x3B ';'
-  {  1227,  17,  20,  24,    3,  -19 },   // 0x3C '<'
-  {  1270,  18,  13,  24,    3,  -16 },   // 0x3D '='
-  {  1300,  17,  20,  24,    4,  -19 },   // 0x3E '>'
-  {  1343,  17,  26,  20,    1,  -25 },   // 0x3F '?'
-  {  1399,  32,  33,  36,    2,  -25 },   // 0x40 '@'
-  {  1531,  24,  26,  26,    1,  -25 },   // 0x41 'A'
-  {  1609,  20,  26,  23,    2,  -25 },   // 0x42 'B'
-  {  1674,  23,  26,  26,    2,  -25 },   // 0x43 'C'
-  {  1749,  22,  26,  25,    2,  -25 },   // 0x44 'D'
-  {  1821,  18,  26,  21,    2,  -25 },   // 0x45 'E'
-  {  1880,  17,  26,  21,    2,  -25 },   // 0x46 'F'
-  {  1936,  23,  26,  26,    2,  -25 },   // 0x47 'G'
-  {  2011,  22,  26,  26,    2,  -25 },   // 0x48 'H'
-  {  2083,   6,  26,  10,    2,  -25 },   // 0x49 'I'
-  {  2103,  17,  26,  21,    1,  -25 },   // 0x4A 'J'
-  {  2159,  22,  26,  25,    2,  -25 },   // 0x4B 'K'
-  {  2231,  17,  26,  20,    2,  -25 },   // 0x4C 'L'
-  {  2287,  29,  26,  33,    2,  -25 },   // 0x4D 'M'
-  {  2382,  23,  26,  27,    2,  -25 },   // 0x4E 'N'
-  {  2457,  24,  26,  27,    2,  -25 },   // 0x4F 'O'
-  {  2535,  20,  26,  23,    2,  -25 },   // 0x50 'P'
-  {  2600,  24,  28,  27,    2,  -25 },   // 0x51 'Q'
-  {  2684,  20,  26,  23,    2,  -25 },   // 0x52 'R'
-  {  2749,  21,  26,  23,    1,  -25 },   // 0x53 'S'
-  {  2818,  21,  26,  24,    1,  -25 },   // 0x54 'T'
-  {  2887,  22,  26,  26,    2,  -25 },   // 0x55 'U'
-  {  2959,  24,  26,  26,    1,  -25 },   // 0x56 'V'
-  {  3037,  35,  26,  37,    1,  -25 },   // 0x57 'W'
-  {  3151,  24,  26,  26,    1,  -25 },   // 0x58 'X'
-  {  3229,  24,  26,  26,    1,  -25 },   // 0x59 'Y'
-  {  3307,  19,  26,  23,    2,  -25 },   // 0x5A 'Z'
-  {  3369,   9,  33,  13,    3,  -27 },   // 0x5B '['
-  {  3407,  13,  32,  14,    0,  -27 },   // 0x5C '\'
-  {  3459,   8,  33,  13,    2,  -27 },   // 0x5D ']'
-  {  3492,  15,  12,  17,    1,  -25 },   // 0x5E '^'
-  {  3515,  17,   4,  17,    0,    1 },   // 0x5F '_'
-  {  3524,   7,   6,  13,    3,  -27 },   // 0x60 '`'
-  {  3530,  17,  20,  20,    1,  -19 },   // 0x61 'a'
-  {  3573,  19,  26,  22,    2,  -25 },   // 0x62 'b'
-  {  3635,  18,  20,  21,    1,  -19 },   // 0x63 'c'
-  {  3680,  19,  26,  22,    1,  -25 },   // 0x64 'd'
-  {  3742,  19,  20,  21,    1,  -19 },   // 0x65 'e'
-  {  3790,  14,  27,  14,    0,  -26 },   // 0x66 'f'
-  {  3838,  19,  27,  22,    1,  -19 },   // 0x67 'g'
-  {  3903,  18,  26,  22,    2,  -25 },   // 0x68 'h'
-  {  3962,   6,  27,  10,    2,  -26 },   // 0x69 'i'
-  {  3983,   9,  34,  10,   -1,  -26 },   // 0x6A 'j'
-  {  4022,  18,  26,  20,    2,  -25 },   // 0x6B 'k'
-  {  4081,   5,  26,  10,    2,  -25 },   // 0x6C 'l'
-  {  4098,  28,  20,  32,    2,  -19 },   // 0x6D 'm'
-  {  4168,  18,  20,  22,    2,  -19 },   // 0x6E 'n'
-  {  4213,  19,  20,  22,    1,  -19 },   // 0x6F 'o'
-  {  4261,  19,  27,  22,    2,  -19 },   // 0x70 'p'
-  {  4326,  19,  27,  22,    1,  -19 },   // 0x71 'q'
-  {  4391,  12,  20,  14,    2,  -19 },   // 0x72 'r'
-  {  4421,  17,  20,  20,    1,  -19 },   // 0x73 's'
-  {  4464,  12,  25,  13,    0,  -24 },   // 0x74 't'
-  {  4502,  18,  20,  22,    2,  -19 },   // 0x75 'u'
-  {  4547,  20,  20,  21,    1,  -19 },   // 0x76 'v'
-  {  4597,  28,  20,  30,    1,  -19 },   // 0x77 'w'
-  {  4667,  19,  20,  20,    1,  -19 },   // 0x78 'x'
-  {  4715,  20,  27,  21,    1,  -19 },   // 0x79 'y'
-  {  4783,  16,  20,  20,    2,  -19 },   // 0x7A 'z'
-  {  4823,  13,  33,  17,    2,  -27 },   // 0x7B '{'
-  {  4877,   5,  43,  13,    4,  -34 },   // 0x7C '|'
-  {  4904,  12,  33,  17,    2,  -27 },   // 0x7D '}'
-  {  4954,  18,   8,  24,    3,  -14 } }; // 0x7E '~'
+const uint8_t Inter_Bold18ptData[] PROGMEM = {
+  0x10, 0x67, 0xBB, 0x8E, 0x5F, 0x05, 0x63, 0x73, 0x66, 0x62, 0x58, 0x51,
+  0x68, 0x51, 0x59, 0xB9, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9,
+  0xC8, 0x52, 0x58, 0x52, 0x66, 0x63, 0x64, 0x64, 0xF1, 0x5E, 0x7B, 0xB7,
+  0x70, 0x56, 0x38, 0x2F, 0xF5, 0x28, 0x37, 0x46, 0x55, 0x65, 0x65, 0x65,
+  0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+  0x65, 0x65, 0x57, 0x9C, 0x5E, 0x3F, 0x12, 0x64, 0x61, 0x66, 0xB8, 0xA8,
+  0x5D, 0x5D, 0x5C, 0x5C, 0x6B, 0x6C, 0x6A, 0x7A, 0x7A, 0x7A, 0x7A, 0x7A,
+  0x7A, 0x7A, 0x7A, 0xFF, 0xFF, 0xC0, 0x67, 0xAB, 0x6E, 0x4F, 0x13, 0x64,
+  0x71, 0x67, 0x51, 0x58, 0x5E, 0x5E, 0x5C, 0x68, 0xA9, 0x8B, 0x9A, 0xBD,
+  0x7E, 0x6D, 0x6E, 0xA9, 0xA8, 0xC7, 0xD4, 0x72, 0xF2, 0x3F, 0x05, 0xCA,
+  0x76, 0xA7, 0xD7, 0xC8, 0xB9, 0xB9, 0xAA, 0x9B, 0x95, 0x15, 0x85, 0x25,
+  0x76, 0x25, 0x75, 0x35, 0x65, 0x45, 0x65, 0x45, 0x55, 0x55, 0x46, 0x55,
+  0x45, 0x65, 0x35, 0x75, 0x3F, 0xFF, 0xFF, 0x5C, 0x5F, 0x05, 0xF0, 0x5F,
+  0x05, 0xF0, 0x53, 0x2F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x34, 0xE5, 0xE5,
+  0xE5, 0xE5, 0x26, 0x65, 0x19, 0x4F, 0x13, 0xF1, 0x36, 0x47, 0x43, 0x75,
+  0xE6, 0xE5, 0xE5, 0xEA, 0x9B, 0x76, 0x15, 0x75, 0x27, 0x37, 0x3F, 0x04,
+  0xE7, 0xBA, 0x76, 0x76, 0xBB, 0x6E, 0x4F, 0x13, 0x64, 0x62, 0x66, 0x61,
+  0x58, 0xAE, 0x54, 0x55, 0x52, 0x93, 0x51, 0xB2, 0xF3, 0x18, 0x37, 0x17,
+  0x6C, 0x8A, 0x9A, 0x9A, 0x9B, 0x8B, 0x85, 0x16, 0x66, 0x17, 0x37, 0x3F,
+  0x05, 0xE6, 0xBA, 0x76, 0x0F, 0xFF, 0xFC, 0xD5, 0xC6, 0xC5, 0xC6, 0xC5,
+  0xC6, 0xC5, 0xC6, 0xC5, 0xC6, 0xC5, 0xC6, 0xC5, 0xC6, 0xC5, 0xC6, 0xC5,
+  0xC6, 0xC5, 0xC6, 0xC5, 0xC6, 0xA0, 0x67, 0xAB, 0x6F, 0x03, 0xF2, 0x26,
+  0x47, 0x25, 0x75, 0x25, 0x75, 0x25, 0x75, 0x25, 0x75, 0x26, 0x55, 0x4F,
+  0x06, 0xB7, 0xD5, 0xF0, 0x37, 0x37, 0x16, 0x7B, 0x9A, 0x9A, 0x9A, 0x9B,
+  0x7D, 0x48, 0x1F, 0x23, 0xF0, 0x5D, 0x97, 0x60, 0x66, 0xBB, 0x6E, 0x4F,
+  0x13, 0x64, 0x71, 0x66, 0x61, 0x58, 0x51, 0x58, 0xB9, 0xA8, 0xB8, 0xC6,
+  0xE4, 0x81, 0xF3, 0x2B, 0x15, 0x39, 0x25, 0x55, 0x45, 0xE5, 0xD5, 0x15,
+  0x85, 0x16, 0x66, 0x26, 0x46, 0x3F, 0x05, 0xD7, 0xBB, 0x67, 0x87, 0xDD,
+  0x9F, 0x07, 0xF2, 0x57, 0x57, 0x37, 0x77, 0x26, 0x96, 0x25, 0xB5, 0x16,
+  0xBB, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F,
+  0x36, 0xBC, 0xB5, 0x26, 0x96, 0x27, 0x76, 0x48, 0x47, 0x5F, 0x27, 0xF0,
+  0x9D, 0xD7, 0x80, 0x0F, 0x21, 0xF2, 0x1F, 0x21, 0xF2, 0x16, 0xC6, 0xC6,
+  0xC6, 0xC6, 0xC6, 0xC6, 0xCF, 0x21, 0xF2, 0x1F, 0x21, 0xF2, 0x16, 0xC6,
+  0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xCF, 0xFF, 0xFC, 0x06, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBF, 0xFF, 0xFF, 0xF9, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB5, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF6, 0x0E, 0x6F, 0x14, 0xF2, 0x3F, 0x32, 0x65, 0x81,
+  0x67, 0x61, 0x68, 0x51, 0x68, 0x51, 0x68, 0xC8, 0x51, 0x68, 0x51, 0x67,
+  0x61, 0x66, 0x71, 0xF3, 0x2F, 0x23, 0xF1, 0x4E, 0x66, 0xE6, 0xE6, 0xE6,
+  0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE0, 0x78, 0xBC, 0x7F, 0x05, 0xF2, 0x46,
+  0x57, 0x26, 0x76, 0x26, 0x85, 0x26, 0xF0, 0x6F, 0x07, 0xF0, 0x9C, 0xD9,
+  0xE9, 0xE9, 0xCD, 0x9F, 0x06, 0xF1, 0xC9, 0x61, 0x59, 0x61, 0x68, 0x52,
+  0x75, 0x73, 0xF2, 0x5F, 0x07, 0xDB, 0x86, 0x0F, 0xFF, 0xFF, 0x98, 0x5F,
+  0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F,
+  0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F,
+  0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0x80, 0x06, 0xAC, 0xAC, 0xAC,
+  0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+  0xAC, 0xAC, 0xA5, 0x16, 0xA5, 0x25, 0x96, 0x26, 0x86, 0x37, 0x47, 0x4F,
+  0x26, 0xF1, 0x8C, 0xC8, 0x70, 0x06, 0xCC, 0xC6, 0x15, 0xC6, 0x16, 0xB5,
+  0x26, 0xA6, 0x35, 0xA6, 0x36, 0x95, 0x46, 0x86, 0x55, 0x86, 0x56, 0x75,
+  0x66, 0x66, 0x75, 0x66, 0x76, 0x55, 0x95, 0x46, 0x95, 0x46, 0x96, 0x35,
+  0xB5, 0x35, 0xB5, 0x26, 0xB5, 0x25, 0xD5, 0x15, 0xD5, 0x15, 0xDA, 0xF0,
+  0x9F, 0x09, 0xF0, 0x8F, 0x27, 0x80, 0x06, 0x86, 0x9C, 0x86, 0x95, 0x25,
+  0x87, 0x76, 0x25, 0x87, 0x76, 0x26, 0x68, 0x76, 0x26, 0x68, 0x75, 0x45,
+  0x69, 0x56, 0x45, 0x69, 0x56, 0x46, 0x45, 0x14, 0x55, 0x56, 0x45, 0x14,
+  0x55, 0x65, 0x45, 0x15, 0x45, 0x65, 0x44, 0x25, 0x36, 0x65, 0x35, 0x25,
+  0x35, 0x76, 0x25, 0x34, 0x35, 0x85, 0x25, 0x35, 0x25, 0x85, 0x24, 0x45,
+  0x16, 0x85, 0x24, 0x45, 0x15, 0x95, 0x15, 0x54, 0x15, 0xAA, 0x54, 0x15,
+  0xA9, 0x64, 0x15, 0xA9, 0x69, 0xC8, 0x78, 0xC8, 0x78, 0xC7, 0x88, 0xC7,
+  0x87, 0xE6, 0x96, 0x70, 0x67, 0x8B, 0x4E, 0x3F, 0x01, 0x64, 0x61, 0x56,
+  0x5C, 0x5C, 0x57, 0xA3, 0xE2, 0xF0, 0x16, 0x5B, 0x6A, 0x7A, 0x6C, 0x4F,
+  0x91, 0xF1, 0x29, 0x15, 0x45, 0x35, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5,
+  0x65, 0x35, 0x48, 0x25, 0x3A, 0x15, 0x2F, 0x21, 0x73, 0x81, 0x66, 0x61,
+  0x57, 0x61, 0x58, 0xB8, 0xB8, 0xB8, 0xB8, 0x51, 0x58, 0x51, 0x57, 0x61,
+  0x66, 0x61, 0x73, 0x82, 0xF2, 0x3A, 0x15, 0x48, 0x25, 0x56, 0x35, 0x67,
+  0xAB, 0x7D, 0x5F, 0x04, 0x63, 0x72, 0x66, 0x52, 0x57, 0x52, 0x58, 0xFF,
+  0xFF, 0x8E, 0x5E, 0x5E, 0x66, 0x53, 0x64, 0x63, 0xF0, 0x5E, 0x6B, 0xA7,
+  0x60, 0x14, 0x1F, 0x31, 0x4D, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+  0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+  0x51, 0x0F, 0xFF, 0xFF, 0xFF, 0xFA, 0x05, 0x35, 0x65, 0x45, 0x27, 0x39,
+  0x25, 0x19, 0x2A, 0x1F, 0x01, 0xB1, 0x73, 0x83, 0xD5, 0x65, 0xC5, 0x66,
+  0xA7, 0x56, 0xA7, 0x56, 0xA7, 0x56, 0xA7, 0x56, 0xA7, 0x56, 0xA7, 0x56,
+  0xA7, 0x56, 0xA7, 0x56, 0xA7, 0x56, 0xA7, 0x56, 0xA7, 0x56, 0xA7, 0x56,
+  0xA7, 0x56, 0x50, 0x05, 0x36, 0x45, 0x28, 0x35, 0x1A, 0x2F, 0x21, 0x83,
+  0x61, 0x66, 0xC6, 0xB8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+  0xA8, 0xA8, 0xA8, 0xA8, 0x50, 0x67, 0xAB, 0x7D, 0x5F, 0x04, 0x63, 0x72,
+  0x66, 0x52, 0x57, 0x61, 0x58, 0xB8, 0xB8, 0xB8, 0xB8, 0x51, 0x58, 0x51,
+  0x57, 0x61, 0x66, 0x53, 0x63, 0x73, 0xF0, 0x5D, 0x7B, 0xA7, 0x60, 0x05,
+  0x36, 0x55, 0x28, 0x45, 0x1B, 0x2F, 0x22, 0x83, 0x71, 0x66, 0x61, 0x67,
+  0x51, 0x67, 0xB8, 0xB8, 0xB9, 0xA8, 0xC7, 0xC7, 0x51, 0x75, 0x61, 0x83,
+  0x71, 0xF2, 0x25, 0x1B, 0x25, 0x28, 0x45, 0x36, 0x55, 0xE5, 0xE5, 0xE5,
+  0xE5, 0xE5, 0xE5, 0xE0, 0x05, 0x39, 0x1B, 0x1F, 0xB4, 0x66, 0x66, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57,
+  0x57, 0x8B, 0x5D, 0x3F, 0x02, 0x64, 0x61, 0x56, 0x51, 0x5C, 0x6C, 0x98,
+  0xC7, 0xC8, 0xAB, 0x64, 0x17, 0xB6, 0x51, 0x64, 0x61, 0xF1, 0x2E, 0x4C,
+  0x77, 0x50, 0x35, 0x75, 0x75, 0x75, 0x75, 0x4F, 0xFF, 0x33, 0x57, 0x57,
+  0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x57, 0x66, 0x94, 0x84,
+  0x86, 0x60, 0x05, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+  0x8A, 0x8A, 0x8A, 0x8B, 0x6C, 0x66, 0x16, 0x38, 0x1F, 0x22, 0xA1, 0x52,
+  0x92, 0x54, 0x54, 0x50, 0x05, 0x9C, 0x85, 0x16, 0x76, 0x25, 0x75, 0x35,
+  0x75, 0x36, 0x56, 0x45, 0x55, 0x55, 0x55, 0x65, 0x45, 0x65, 0x35, 0x75,
+  0x35, 0x85, 0x25, 0x85, 0x15, 0x95, 0x15, 0xA4, 0x14, 0xB9, 0xB9, 0xC7,
+  0xD7, 0xD7, 0x70, 0x06, 0x75, 0x25, 0x66, 0x35, 0x55, 0x46, 0x35, 0x65,
+  0x35, 0x66, 0x15, 0x85, 0x15, 0x99, 0xA8, 0xC7, 0xC7, 0xB8, 0xAA, 0x95,
+  0x15, 0x75, 0x25, 0x66, 0x35, 0x55, 0x46, 0x36, 0x55, 0x35, 0x66, 0x16,
+  0x76, 0x05, 0x9C, 0x85, 0x16, 0x76, 0x25, 0x75, 0x35, 0x75, 0x45, 0x56,
+  0x45, 0x55, 0x55, 0x55, 0x65, 0x36, 0x65, 0x35, 0x75, 0x35, 0x85, 0x15,
+  0x95, 0x15, 0x95, 0x15, 0xA4, 0x14, 0xB9, 0xC8, 0xC7, 0xD7, 0xE5, 0xF0,
+  0x5E, 0x6E, 0x5B, 0x9B, 0x8B, 0x8C, 0x6D,
+};
 
-const GFXfont Inter_Bold18pt7b PROGMEM = {
-  (uint8_t  *)Inter_Bold18pt7bBitmaps,
-  (GFXglyph *)Inter_Bold18pt7bGlyphs,
-  0x20, 0x7E, 43 };
+const PackedGlyph Inter_Bold18ptGlyphs[] PROGMEM = {
+  {     0,   1,   1,   8,    0,    0 }, // 0x20 ' '
+  {     1,  20,  26,  24,    2,  -25 }, // 0x30 '0'
+  {    37,  11,  26,  15,    2,  -25 }, // 0x31 '1'
+  {    62,  18,  26,  22,    2,  -25 }, // 0x32 '2'
+  {    90,  19,  26,  23,    2,  -25 }, // 0x33 '3'
+  {   121,  20,  26,  24,    2,  -25 }, // 0x34 '4'
+  {   159,  19,  26,  23,    2,  -25 }, // 0x35 '5'
+  {   195,  19,  26,  23,    2,  -25 }, // 0x36 '6'
+  {   232,  18,  26,  21,    1,  -25 }, // 0x37 '7'
+  {   258,  19,  26,  23,    2,  -25 }, // 0x38 '8'
+  {   296,  19,  26,  23,    2,  -25 }, // 0x39 '9'
+  {   334,  23,  26,  26,    2,  -25 }, // 0x43 'C'
+  {   375,  18,  26,  21,    2,  -25 }, // 0x45 'E'
+  {   404,  22,  26,  26,    2,  -25 }, // 0x48 'H'
+  {   430,   6,  26,  10,    2,  -25 }, // 0x49 'I'
+  {   436,  20,  26,  23,    2,  -25 }, // 0x50 'P'
+  {   474,  21,  26,  23,    1,  -25 }, // 0x53 'S'
+  {   511,  21,  26,  24,    1,  -25 }, // 0x54 'T'
+  {   548,  22,  26,  26,    2,  -25 }, // 0x55 'U'
+  {   581,  24,  26,  26,    1,  -25 }, // 0x56 'V'
+  {   630,  35,  26,  37,    1,  -25 }, // 0x57 'W'
+  {   712,  17,  20,  20,    1,  -19 }, // 0x61 'a'
+  {   738,  19,  26,  22,    1,  -25 }, // 0x64 'd'
+  {   779,  19,  20,  21,    1,  -19 }, // 0x65 'e'
+  {   805,   6,  27,  10,    2,  -26 }, // 0x69 'i'
+  {   829,   5,  26,  10,    2,  -25 }, // 0x6C 'l'
+  {   834,  28,  20,  32,    2,  -19 }, // 0x6D 'm'
+  {   879,  18,  20,  22,    2,  -19 }, // 0x6E 'n'
+  {   905,  19,  20,  22,    1,  -19 }, // 0x6F 'o'
+  {   935,  19,  27,  22,    2,  -19 }, // 0x70 'p'
+  {   976,  12,  20,  14,    2,  -19 }, // 0x72 'r'
+  {   996,  17,  20,  20,    1,  -19 }, // 0x73 's'
+  {  1022,  12,  25,  13,    0,  -24 }, // 0x74 't'
+  {  1046,  18,  20,  22,    2,  -19 }, // 0x75 'u'
+  {  1072,  20,  20,  21,    1,  -19 }, // 0x76 'v'
+  {  1107,  19,  20,  20,    1,  -19 }, // 0x78 'x'
+  {  1141,  20,  27,  21,    1,  -19 }, // 0x79 'y'
+};
 
-// Approx. 5644 bytes
+const uint8_t Inter_Bold18ptIndex[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+  0x09, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B,
+  0xFF, 0x0C, 0xFF, 0xFF, 0x0D, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x0F, 0xFF, 0xFF, 0x10, 0x11, 0x12, 0x13, 0x14, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x15, 0xFF, 0xFF, 0x16, 0x17, 0xFF, 0xFF,
+  0xFF, 0x18, 0xFF, 0xFF, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0xFF, 0x1E, 0x1F,
+  0x20, 0x21, 0x22, 0xFF, 0x23, 0x24,
+};
+
+const PackedFont Inter_Bold18pt = { Inter_Bold18ptData, Inter_Bold18ptGlyphs, Inter_Bold18ptIndex, 0x20, 0x79, 43, PackedFont::RLE };
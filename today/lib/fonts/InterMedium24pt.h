@@ -1,772 +1,264 @@
-const uint8_t Inter_Medium24pt7bBitmaps[] PROGMEM = {
-  0x00, 0xFD, 0xFB, 0xF7, 0xEF, 0xDF, 0xBF, 0x7E, 0xFD, 0xF9, 0xF3, 0xE7,
-  0xCF, 0x9F, 0x3E, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x00, 0x00, 0x00,
-  0x03, 0xCF, 0xDF, 0xBF, 0xFE, 0xFC, 0xF0, 0xF8, 0x7F, 0xE1, 0xFF, 0x87,
-  0xFE, 0x1F, 0xF8, 0x7F, 0xE1, 0xFF, 0x87, 0xFE, 0x1F, 0xF8, 0x7F, 0xE1,
-  0xFF, 0x07, 0xBC, 0x1E, 0xF0, 0x78, 0x00, 0x78, 0x07, 0x80, 0x07, 0x80,
-  0x78, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00,
-  0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x1F, 0x01, 0xF0, 0x01, 0xE0,
-  0x1E, 0x03, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
-  0x3F, 0xFF, 0xFF, 0xF0, 0x3E, 0x01, 0xE0, 0x03, 0xC0, 0x3C, 0x00, 0x3C,
-  0x03, 0xC0, 0x03, 0xC0, 0x3C, 0x00, 0x3C, 0x03, 0xC0, 0x03, 0xC0, 0x3C,
-  0x00, 0x3C, 0x03, 0xC0, 0x07, 0x80, 0x78, 0x0F, 0xFF, 0xFF, 0xFC, 0xFF,
-  0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xC0, 0x78, 0x07,
-  0x80, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00,
-  0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x1E, 0x01,
-  0xE0, 0x01, 0xE0, 0x1E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x80, 0x00,
-  0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1F, 0xF0,
-  0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xFE, 0x07, 0xFB,
-  0xFF, 0xC3, 0xF8, 0xE3, 0xF8, 0xFC, 0x38, 0x7E, 0x3E, 0x0E, 0x0F, 0x9F,
-  0x83, 0x83, 0xE7, 0xE0, 0xE0, 0x01, 0xF8, 0x38, 0x00, 0x3E, 0x0E, 0x00,
-  0x0F, 0xC3, 0x80, 0x03, 0xFC, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFF,
-  0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xF8, 0x00,
-  0x0F, 0xFF, 0x00, 0x03, 0x8F, 0xE0, 0x00, 0xE1, 0xF8, 0x00, 0x38, 0x3F,
-  0x00, 0x0E, 0x07, 0xFF, 0x03, 0x81, 0xF7, 0xC0, 0xE0, 0x7D, 0xF0, 0x38,
-  0x3F, 0x7E, 0x0E, 0x0F, 0x9F, 0xC3, 0x8F, 0xE3, 0xFE, 0xEF, 0xF0, 0x7F,
-  0xFF, 0xFC, 0x0F, 0xFF, 0xFE, 0x01, 0xFF, 0xFE, 0x00, 0x0F, 0xFE, 0x00,
-  0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xE0,
-  0x00, 0x00, 0x38, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x01, 0xFF, 0x80, 0x00,
-  0xF0, 0x1F, 0xFE, 0x00, 0x0F, 0x00, 0xF0, 0xF0, 0x00, 0xF8, 0x0F, 0x07,
-  0xC0, 0x07, 0x80, 0x78, 0x1E, 0x00, 0x78, 0x03, 0xC0, 0xF0, 0x07, 0xC0,
-  0x1E, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x3C, 0x03, 0xC0, 0x07, 0x81, 0xE0,
-  0x3E, 0x00, 0x3C, 0x1F, 0x01, 0xE0, 0x00, 0xF0, 0xF0, 0x1E, 0x00, 0x07,
-  0xFF, 0x01, 0xE0, 0x00, 0x1F, 0xF8, 0x0F, 0x00, 0x00, 0x3F, 0x00, 0xF0,
-  0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00,
-  0x07, 0x80, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x3F,
-  0x00, 0x00, 0x3C, 0x07, 0xFC, 0x00, 0x03, 0xC0, 0x7F, 0xF0, 0x00, 0x3E,
-  0x03, 0xC3, 0xC0, 0x01, 0xE0, 0x3C, 0x1E, 0x00, 0x1E, 0x01, 0xE0, 0x78,
-  0x01, 0xE0, 0x0F, 0x03, 0xC0, 0x0F, 0x00, 0x78, 0x1E, 0x00, 0xF0, 0x03,
-  0xC0, 0xF0, 0x0F, 0x00, 0x1E, 0x07, 0x80, 0xF8, 0x00, 0xF0, 0x7C, 0x07,
-  0x80, 0x07, 0xC3, 0xC0, 0x78, 0x00, 0x1F, 0xFE, 0x07, 0xC0, 0x00, 0x7F,
-  0xE0, 0x7C, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xFE,
-  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00,
-  0x0F, 0xC7, 0xF0, 0x01, 0xF8, 0x1F, 0x00, 0x1F, 0x01, 0xF0, 0x01, 0xF0,
-  0x0F, 0x00, 0x1F, 0x00, 0xF0, 0x01, 0xF0, 0x1F, 0x00, 0x0F, 0x03, 0xE0,
-  0x00, 0xF8, 0x7E, 0x00, 0x07, 0xCF, 0xC0, 0x00, 0x7D, 0xF8, 0x00, 0x03,
-  0xFF, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0xE0,
-  0x00, 0x1F, 0xFE, 0x03, 0xC3, 0xFB, 0xF0, 0x7C, 0x7E, 0x1F, 0x87, 0xC7,
-  0xC0, 0xFC, 0x7C, 0xFC, 0x07, 0xE7, 0xCF, 0x80, 0x3F, 0xF8, 0xF8, 0x01,
-  0xFF, 0x8F, 0x80, 0x1F, 0xF8, 0xFC, 0x00, 0xFF, 0x07, 0xC0, 0x07, 0xE0,
-  0x7E, 0x00, 0xFF, 0x03, 0xF8, 0x7F, 0xF8, 0x3F, 0xFF, 0xFF, 0x81, 0xFF,
-  0xFF, 0xFC, 0x07, 0xFF, 0xC7, 0xE0, 0x1F, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFD, 0xEF, 0x00, 0x07, 0xC1, 0xF0, 0xF8, 0x3E, 0x1F,
-  0x07, 0xC1, 0xF0, 0xF8, 0x3E, 0x0F, 0x87, 0xC1, 0xF0, 0x7C, 0x1F, 0x0F,
-  0xC3, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0,
-  0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F,
-  0x83, 0xE0, 0xF8, 0x3F, 0x07, 0xC1, 0xF0, 0x3E, 0x0F, 0x81, 0xF0, 0x7C,
-  0xF8, 0x0F, 0x81, 0xF0, 0x3F, 0x03, 0xE0, 0x7C, 0x07, 0xC0, 0xF8, 0x1F,
-  0x01, 0xF0, 0x3E, 0x07, 0xC0, 0xFC, 0x0F, 0x81, 0xF0, 0x3E, 0x07, 0xC0,
-  0xF8, 0x1F, 0x83, 0xF0, 0x7E, 0x07, 0xC0, 0xF8, 0x1F, 0x07, 0xE0, 0xFC,
-  0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x7E, 0x0F, 0x81, 0xF0, 0x7E,
-  0x0F, 0x81, 0xF0, 0x7E, 0x0F, 0x81, 0xF0, 0x7C, 0x0F, 0x83, 0xE0, 0x00,
-  0x01, 0xE0, 0x00, 0x78, 0x00, 0x0E, 0x01, 0x03, 0x82, 0x70, 0xE1, 0xBE,
-  0x39, 0xFF, 0xEF, 0xFC, 0xFF, 0xFC, 0x0F, 0xFC, 0x00, 0xFC, 0x00, 0xFF,
-  0xC0, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF, 0x39, 0xF7, 0x0E, 0x39, 0x03, 0x82,
-  0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8,
-  0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80,
-  0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x03,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01,
-  0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F,
-  0x00, 0x00, 0x3E, 0xFD, 0xF3, 0xE7, 0xCF, 0x9E, 0x3C, 0xF9, 0xE3, 0xC7,
-  0x8F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x79, 0xFB,
-  0xF7, 0xFF, 0xDF, 0x9E, 0x00, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF8, 0x01,
-  0xF0, 0x03, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xF0,
-  0x03, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF0, 0x03,
-  0xE0, 0x07, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xE0,
-  0x03, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xF0, 0x03,
-  0xE0, 0x07, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xE0,
-  0x07, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x00, 0xFF,
-  0x00, 0x01, 0xFF, 0xE0, 0x01, 0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x01, 0xFC,
-  0x3F, 0x81, 0xFC, 0x07, 0xE0, 0xF8, 0x01, 0xF8, 0xFC, 0x00, 0x7C, 0x7C,
-  0x00, 0x3E, 0x3E, 0x00, 0x1F, 0xBE, 0x00, 0x07, 0xDF, 0x00, 0x03, 0xEF,
-  0x80, 0x01, 0xF7, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F,
-  0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x03,
-  0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0xFB, 0xE0, 0x00, 0x7D, 0xF0, 0x00,
-  0x3E, 0xFC, 0x00, 0x3F, 0x3E, 0x00, 0x1F, 0x9F, 0x80, 0x0F, 0x87, 0xC0,
-  0x0F, 0xC3, 0xF0, 0x0F, 0xC0, 0xFE, 0x1F, 0xE0, 0x3F, 0xFF, 0xE0, 0x0F,
-  0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x01, 0xFC, 0x0F,
-  0xF0, 0xFF, 0xC7, 0xFF, 0x3F, 0xFF, 0xFD, 0xFF, 0xC7, 0xFE, 0x1F, 0xE0,
-  0x7F, 0x01, 0xF8, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0,
-  0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0,
-  0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C,
-  0x01, 0xF0, 0x07, 0xC0, 0x1F, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0xFE, 0x00,
-  0x0F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0xFF, 0xFF, 0x83, 0xF8, 0x7F, 0x8F,
-  0xC0, 0x3F, 0x1F, 0x00, 0x3F, 0x3E, 0x00, 0x3E, 0xF8, 0x00, 0x7D, 0xF0,
-  0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00,
-  0x1F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF0, 0x00, 0x0F,
-  0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0,
-  0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00,
-  0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-  0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F,
-  0xC3, 0xF8, 0x7E, 0x00, 0xFC, 0x7C, 0x00, 0x7C, 0x7C, 0x00, 0x7E, 0xF8,
-  0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00,
-  0x00, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00,
-  0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFE, 0x00,
-  0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x00,
-  0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x7E, 0x7E,
-  0x00, 0xFE, 0x7F, 0xC3, 0xFC, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF0, 0x07,
-  0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00,
-  0x01, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0xC0,
-  0x00, 0xFF, 0xE0, 0x00, 0x7D, 0xF0, 0x00, 0x7C, 0xF8, 0x00, 0x7E, 0x7C,
-  0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x1F, 0x00, 0x3F, 0x0F, 0x80, 0x1F, 0x07,
-  0xC0, 0x1F, 0x03, 0xE0, 0x0F, 0x81, 0xF0, 0x0F, 0x80, 0xF8, 0x0F, 0xC0,
-  0x7C, 0x07, 0xC0, 0x3E, 0x07, 0xC0, 0x1F, 0x07, 0xE0, 0x0F, 0x83, 0xE0,
-  0x07, 0xC3, 0xE0, 0x03, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80,
-  0x00, 0x07, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8,
-  0x00, 0x00, 0x7C, 0x00, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x7F, 0xFF,
-  0xF1, 0xFF, 0xFF, 0xE3, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-  0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01,
-  0xE3, 0xF8, 0x07, 0xDF, 0xFC, 0x0F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFE, 0x3F,
-  0xE3, 0xFC, 0x7E, 0x01, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00,
-  0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00,
-  0x1F, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x7D, 0xF0, 0x01, 0xFB, 0xF0, 0x03,
-  0xE7, 0xF0, 0x0F, 0xC7, 0xF8, 0xFF, 0x07, 0xFF, 0xFC, 0x07, 0xFF, 0xF0,
-  0x07, 0xFF, 0xC0, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xFF, 0xE0,
-  0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x1F, 0xE1, 0xFC, 0x1F, 0x00, 0x7E,
-  0x3E, 0x00, 0x3E, 0x7E, 0x00, 0x3F, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00,
-  0xF8, 0x00, 0x00, 0xF8, 0x3F, 0x80, 0xF8, 0xFF, 0xE0, 0xF9, 0xFF, 0xF0,
-  0xFB, 0xFF, 0xF8, 0xFF, 0xE3, 0xFC, 0xFF, 0x00, 0xFE, 0xFE, 0x00, 0x7E,
-  0xFC, 0x00, 0x3E, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
-  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0x7C, 0x00, 0x3F,
-  0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x3F, 0x00, 0xFC, 0x1F, 0xC3, 0xFC,
-  0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0xFF, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x00, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00,
-  0x01, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00,
-  0x7E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F,
-  0x80, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xE0,
-  0x00, 0x0F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF8, 0x00,
-  0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7E, 0x00, 0x00,
-  0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x7E,
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x1F,
-  0xFF, 0xF8, 0x3F, 0xC3, 0xFC, 0x7F, 0x00, 0xFC, 0x7E, 0x00, 0x7C, 0x7C,
-  0x00, 0x7E, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x7C, 0x7E,
-  0x00, 0x7C, 0x3F, 0x00, 0xFC, 0x1F, 0xC3, 0xF8, 0x0F, 0xFF, 0xF0, 0x03,
-  0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0x81, 0xFC, 0x7E,
-  0x00, 0xFE, 0xFC, 0x00, 0x7E, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8,
-  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFC,
-  0x00, 0x7E, 0x7E, 0x00, 0xFE, 0x7F, 0xC3, 0xFC, 0x3F, 0xFF, 0xF8, 0x1F,
-  0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x07,
-  0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x3F, 0xC7, 0xF8, 0x7F,
-  0x01, 0xFC, 0x7C, 0x00, 0x7C, 0xFC, 0x00, 0x7E, 0xF8, 0x00, 0x3E, 0xF8,
-  0x00, 0x3E, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8,
-  0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0x7E, 0x01, 0xFF, 0x7F,
-  0xC7, 0xFF, 0x3F, 0xFF, 0xDF, 0x1F, 0xFF, 0x9F, 0x07, 0xFF, 0x1F, 0x01,
-  0xF8, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0xF8,
-  0x00, 0x7C, 0xFC, 0x00, 0x7C, 0x7C, 0x00, 0xFC, 0x7E, 0x01, 0xF8, 0x3F,
-  0x87, 0xF0, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x01,
-  0xFE, 0x00, 0x79, 0xFB, 0xF7, 0xFF, 0xDF, 0x9E, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE7, 0xEF, 0xDF, 0xFF, 0x7E, 0x78,
-  0x1E, 0x1F, 0x8F, 0xC7, 0xF3, 0xF1, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE3,
-  0xF1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1E, 0x0F, 0x0F, 0x87, 0x83, 0xC1, 0xE0,
-  0xF0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x70, 0x00, 0x07, 0xC0, 0x00,
-  0x7F, 0x00, 0x07, 0xFC, 0x00, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, 0xFF, 0xE0,
-  0x0F, 0xFE, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0xFC,
-  0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC,
-  0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFC,
-  0x00, 0x07, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x04, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xE0, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x3F,
-  0xC0, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x01, 0xFF, 0xC0, 0x00, 0xFF,
-  0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xFF,
-  0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x00,
-  0xFF, 0xC0, 0x0F, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xFC, 0x00, 0xFF, 0xC0,
-  0x03, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x3C, 0x00, 0x00, 0xC0, 0x00, 0x00,
-  0x01, 0xFC, 0x00, 0xFF, 0xF0, 0x1F, 0xFF, 0xC3, 0xFF, 0xFE, 0x7F, 0x8F,
-  0xE7, 0xE0, 0x3F, 0xFC, 0x01, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xF0, 0x00,
-  0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0xFE, 0x00,
-  0x1F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00,
-  0x1F, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x03, 0xF0,
-  0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF0, 0x00, 0x1E,
-  0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-  0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xF8,
-  0x0F, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x00, 0x0F,
-  0xC0, 0x1F, 0x80, 0x00, 0x03, 0xF0, 0x1F, 0x80, 0x00, 0x00, 0xFC, 0x1F,
-  0x80, 0x00, 0x00, 0x3E, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x8F, 0x80, 0x1F,
-  0xC7, 0x87, 0xC7, 0xC0, 0x3F, 0xF3, 0xC1, 0xF3, 0xC0, 0x3F, 0xFD, 0xE0,
-  0xFB, 0xE0, 0x3F, 0xFF, 0xF0, 0x3D, 0xF0, 0x3F, 0x07, 0xF8, 0x1E, 0xF8,
-  0x1F, 0x00, 0xFC, 0x0F, 0x78, 0x1F, 0x00, 0x3E, 0x07, 0xFC, 0x0F, 0x00,
-  0x1F, 0x03, 0xFE, 0x07, 0x80, 0x0F, 0x81, 0xFF, 0x03, 0xC0, 0x07, 0xC0,
-  0xFF, 0x81, 0xE0, 0x01, 0xE0, 0x7F, 0xC0, 0xF0, 0x00, 0xF0, 0x3D, 0xE0,
-  0x78, 0x00, 0xF8, 0x1E, 0xF0, 0x3C, 0x00, 0x7C, 0x0F, 0x78, 0x1F, 0x00,
-  0x3E, 0x07, 0xBE, 0x0F, 0x80, 0x3F, 0x07, 0xDF, 0x03, 0xE0, 0x1F, 0x83,
-  0xCF, 0x81, 0xFC, 0x3F, 0xE3, 0xE3, 0xC0, 0x7F, 0xFD, 0xFF, 0xF1, 0xF0,
-  0x1F, 0xFE, 0xFF, 0xF0, 0xF8, 0x07, 0xFE, 0x3F, 0xF0, 0x3E, 0x00, 0xFC,
-  0x07, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00,
-  0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0xE0, 0x00, 0x20, 0x00, 0x0F, 0xFF, 0x01, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
-  0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00,
-  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F,
-  0xC0, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xEF,
-  0x00, 0x00, 0x07, 0xDF, 0x00, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x1F, 0x7E,
-  0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x01, 0xF1, 0xF8,
-  0x00, 0x07, 0xC1, 0xF0, 0x00, 0x0F, 0x83, 0xE0, 0x00, 0x3F, 0x07, 0xE0,
-  0x00, 0x7C, 0x07, 0xC0, 0x00, 0xF8, 0x0F, 0x80, 0x03, 0xF0, 0x1F, 0x80,
-  0x07, 0xE0, 0x1F, 0x00, 0x0F, 0x80, 0x3F, 0x00, 0x3F, 0x00, 0x7E, 0x00,
-  0x7C, 0x00, 0x7C, 0x00, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xF8, 0x07,
-  0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x3F, 0x00, 0x03, 0xE0, 0x7C,
-  0x00, 0x07, 0xC1, 0xF8, 0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x0F, 0x87, 0xC0,
-  0x00, 0x1F, 0x9F, 0x80, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3E, 0x7C, 0x00,
-  0x00, 0x7F, 0xF8, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0,
-  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xF8, 0x03, 0xFC, 0xF8, 0x00, 0xFE,
-  0xF8, 0x00, 0x7E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E,
-  0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x7C, 0xF8, 0x00, 0xFC,
-  0xF8, 0x03, 0xF8, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xF0,
-  0xFF, 0xFF, 0xFC, 0xF8, 0x01, 0xFE, 0xF8, 0x00, 0x7E, 0xF8, 0x00, 0x3F,
-  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
-  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x7F, 0xF8, 0x01, 0xFE,
-  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x80,
-  0x00, 0x1F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x0F,
-  0xFF, 0xFF, 0x00, 0xFF, 0x87, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0xFE, 0x00,
-  0x1F, 0xC7, 0xE0, 0x00, 0x7E, 0x7E, 0x00, 0x01, 0xF3, 0xE0, 0x00, 0x0F,
-  0xDF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C,
-  0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00,
-  0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-  0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x1F,
-  0x80, 0x00, 0x1F, 0x7C, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x0F, 0x8F, 0xC0,
-  0x00, 0xFC, 0x7F, 0x00, 0x0F, 0xC1, 0xFC, 0x00, 0xFE, 0x07, 0xFC, 0x3F,
-  0xE0, 0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00,
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFC, 0x03, 0xFF,
-  0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x0F, 0x80, 0x3F, 0xE1, 0xF0, 0x00, 0xFE,
-  0x3E, 0x00, 0x0F, 0xE7, 0xC0, 0x00, 0xFC, 0xF8, 0x00, 0x0F, 0xDF, 0x00,
-  0x00, 0xFB, 0xE0, 0x00, 0x1F, 0x7C, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x3F,
-  0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00,
-  0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF,
-  0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-  0x3E, 0xF8, 0x00, 0x07, 0xDF, 0x00, 0x01, 0xFB, 0xE0, 0x00, 0x7E, 0x7C,
-  0x00, 0x1F, 0xCF, 0x80, 0x07, 0xF1, 0xF0, 0x0F, 0xFC, 0x3F, 0xFF, 0xFF,
-  0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xE0, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
-  0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
-  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03,
-  0xE0, 0x00, 0x1F, 0xFF, 0xFE, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF,
-  0xFD, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-  0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00,
-  0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F,
-  0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00,
-  0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xFF,
-  0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0x80, 0x00,
-  0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
-  0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03,
-  0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00,
-  0x1F, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF,
-  0xFF, 0x00, 0xFF, 0x87, 0xFC, 0x0F, 0xE0, 0x07, 0xF0, 0xFE, 0x00, 0x1F,
-  0xC7, 0xE0, 0x00, 0x7E, 0x7E, 0x00, 0x01, 0xFB, 0xE0, 0x00, 0x0F, 0xDF,
-  0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00,
-  0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFF,
-  0xFF, 0xC0, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
-  0x80, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x80,
-  0x00, 0x1F, 0x7C, 0x00, 0x01, 0xFB, 0xF0, 0x00, 0x0F, 0xCF, 0xC0, 0x00,
-  0xFC, 0x7F, 0x00, 0x0F, 0xE1, 0xFC, 0x00, 0xFE, 0x07, 0xFC, 0x3F, 0xE0,
-  0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-  0xFF, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-  0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE,
-  0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00,
-  0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0,
-  0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0x80,
-  0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F,
-  0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00,
-  0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7C, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xF8, 0x00,
-  0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C,
-  0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00,
-  0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0,
-  0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01,
-  0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8,
-  0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x3E, 0xF8, 0x03, 0xF7, 0xE0, 0x3F,
-  0x3F, 0xC7, 0xF8, 0xFF, 0xFF, 0x83, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0x0F,
-  0xE0, 0x00, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFB, 0xE0, 0x00, 0xFE,
-  0x7C, 0x00, 0x3F, 0x8F, 0x80, 0x0F, 0xE1, 0xF0, 0x03, 0xF8, 0x3E, 0x00,
-  0xFE, 0x07, 0xC0, 0x3F, 0x80, 0xF8, 0x07, 0xE0, 0x1F, 0x01, 0xF8, 0x03,
-  0xE0, 0x7E, 0x00, 0x7C, 0x1F, 0xC0, 0x0F, 0x87, 0xF0, 0x01, 0xF1, 0xFC,
-  0x00, 0x3E, 0x7F, 0x00, 0x07, 0xCF, 0xE0, 0x00, 0xFB, 0xFE, 0x00, 0x1F,
-  0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xCF, 0xC0, 0x0F, 0xF1, 0xF8,
-  0x01, 0xFC, 0x1F, 0x80, 0x3F, 0x01, 0xF8, 0x07, 0xC0, 0x3F, 0x80, 0xF8,
-  0x03, 0xF0, 0x1F, 0x00, 0x3F, 0x03, 0xE0, 0x03, 0xF0, 0x7C, 0x00, 0x7E,
-  0x0F, 0x80, 0x07, 0xE1, 0xF0, 0x00, 0x7E, 0x3E, 0x00, 0x0F, 0xE7, 0xC0,
-  0x00, 0xFC, 0xF8, 0x00, 0x0F, 0xDF, 0x00, 0x01, 0xFC, 0xF8, 0x00, 0x07,
-  0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00,
-  0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E,
-  0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00,
-  0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0,
-  0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00,
-  0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80,
-  0x00, 0x7C, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC0, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
-  0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x03,
-  0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
-  0x03, 0xDF, 0xFB, 0xE0, 0x00, 0xFB, 0xFF, 0x7C, 0x00, 0x1F, 0x7F, 0xEF,
-  0xC0, 0x07, 0xCF, 0xFC, 0xF8, 0x00, 0xF9, 0xFF, 0x9F, 0x00, 0x1F, 0x3F,
-  0xF3, 0xF0, 0x07, 0xE7, 0xFE, 0x3E, 0x00, 0xF8, 0xFF, 0xC7, 0xC0, 0x1F,
-  0x1F, 0xF8, 0xFC, 0x07, 0xC3, 0xFF, 0x0F, 0x80, 0xF8, 0x7F, 0xE1, 0xF8,
-  0x3F, 0x0F, 0xFC, 0x1F, 0x07, 0xC1, 0xFF, 0x83, 0xE0, 0xF8, 0x3F, 0xF0,
-  0x7E, 0x3F, 0x07, 0xFE, 0x07, 0xC7, 0xC0, 0xFF, 0xC0, 0xF8, 0xF8, 0x1F,
-  0xF8, 0x1F, 0x3E, 0x03, 0xFF, 0x01, 0xF7, 0xC0, 0x7F, 0xE0, 0x3E, 0xF8,
-  0x0F, 0xFC, 0x03, 0xDE, 0x01, 0xFF, 0x80, 0x7F, 0xC0, 0x3F, 0xF0, 0x0F,
-  0xF0, 0x07, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xC0, 0x1F, 0xF8,
-  0x01, 0xF0, 0x03, 0xFF, 0x00, 0x3E, 0x00, 0x7C, 0xFC, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80,
-  0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00, 0x3F,
-  0xFB, 0xE0, 0x03, 0xFF, 0xBF, 0x00, 0x3F, 0xF9, 0xF8, 0x03, 0xFF, 0x9F,
-  0x80, 0x3F, 0xF8, 0xFC, 0x03, 0xFF, 0x87, 0xC0, 0x3F, 0xF8, 0x7E, 0x03,
-  0xFF, 0x83, 0xF0, 0x3F, 0xF8, 0x3F, 0x03, 0xFF, 0x81, 0xF8, 0x3F, 0xF8,
-  0x0F, 0xC3, 0xFF, 0x80, 0xFC, 0x3F, 0xF8, 0x07, 0xE3, 0xFF, 0x80, 0x3E,
-  0x3F, 0xF8, 0x03, 0xF3, 0xFF, 0x80, 0x1F, 0x9F, 0xF8, 0x00, 0xF9, 0xFF,
-  0x80, 0x0F, 0xDF, 0xF8, 0x00, 0x7D, 0xFF, 0x80, 0x03, 0xFF, 0xF8, 0x00,
-  0x3F, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xFF,
-  0xF8, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x00, 0x03,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0, 0x0F, 0xF8,
-  0x7F, 0xC0, 0x7F, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x7F, 0x0F, 0xC0, 0x00,
-  0xFC, 0x7E, 0x00, 0x01, 0xF9, 0xF0, 0x00, 0x03, 0xE7, 0xC0, 0x00, 0x0F,
-  0xFF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF,
-  0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xE0,
-  0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00,
-  0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0x00, 0x00,
-  0x3E, 0x7C, 0x00, 0x00, 0xF9, 0xF8, 0x00, 0x07, 0xE3, 0xF0, 0x00, 0x3F,
-  0x0F, 0xE0, 0x01, 0xFC, 0x1F, 0xC0, 0x0F, 0xE0, 0x3F, 0xE1, 0xFF, 0x00,
-  0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x00,
-  0x7F, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF0,
-  0xFF, 0xFF, 0xF8, 0xF8, 0x03, 0xFC, 0xF8, 0x00, 0xFE, 0xF8, 0x00, 0x7E,
-  0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x1F,
-  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3E,
-  0xF8, 0x00, 0x7E, 0xF8, 0x00, 0xFE, 0xF8, 0x03, 0xFC, 0xFF, 0xFF, 0xF8,
-  0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0xF8, 0x00, 0x00,
-  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
-  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00,
-  0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xE0,
-  0x00, 0x03, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xE0,
-  0x0F, 0xF8, 0x7F, 0xC0, 0x7F, 0x00, 0x3F, 0x83, 0xF8, 0x00, 0x7F, 0x0F,
-  0xC0, 0x00, 0xFC, 0x7E, 0x00, 0x01, 0xF9, 0xF0, 0x00, 0x03, 0xE7, 0xC0,
-  0x00, 0x0F, 0xBF, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-  0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
-  0x7F, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x1F,
-  0xF8, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0x01, 0xF8, 0x3F, 0x7C, 0x03, 0xF0, 0xF9, 0xF8, 0x07, 0xC7, 0xE3, 0xF0,
-  0x0F, 0xBF, 0x0F, 0xE0, 0x1F, 0xFC, 0x1F, 0xC0, 0x3F, 0xE0, 0x3F, 0xE1,
-  0xFF, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
-  0xC0, 0x00, 0x7F, 0x8F, 0x80, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E,
-  0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
-  0x0F, 0x80, 0x3F, 0xC7, 0xC0, 0x07, 0xF3, 0xE0, 0x01, 0xF9, 0xF0, 0x00,
-  0x7E, 0xF8, 0x00, 0x3F, 0x7C, 0x00, 0x1F, 0xBE, 0x00, 0x07, 0xDF, 0x00,
-  0x03, 0xEF, 0x80, 0x03, 0xF7, 0xC0, 0x01, 0xFB, 0xE0, 0x01, 0xF9, 0xF0,
-  0x01, 0xFC, 0xF8, 0x03, 0xFC, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x1F,
-  0xFF, 0xFC, 0x0F, 0xFF, 0xFC, 0x07, 0xC0, 0x3E, 0x03, 0xE0, 0x1F, 0x81,
-  0xF0, 0x07, 0xC0, 0xF8, 0x03, 0xF0, 0x7C, 0x00, 0xFC, 0x3E, 0x00, 0x7E,
-  0x1F, 0x00, 0x1F, 0x8F, 0x80, 0x0F, 0xC7, 0xC0, 0x03, 0xF3, 0xE0, 0x01,
-  0xF9, 0xF0, 0x00, 0x7E, 0xF8, 0x00, 0x3F, 0x7C, 0x00, 0x0F, 0xC0, 0x00,
-  0x7F, 0xC0, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8,
-  0x1F, 0xE0, 0xFF, 0x0F, 0xE0, 0x0F, 0xE3, 0xF0, 0x01, 0xF8, 0xF8, 0x00,
-  0x3E, 0x7E, 0x00, 0x0F, 0x9F, 0x80, 0x00, 0x07, 0xE0, 0x00, 0x00, 0xF8,
-  0x00, 0x00, 0x3F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x00,
-  0x3F, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0xFF,
-  0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xE0, 0x00,
-  0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xF7,
-  0xC0, 0x00, 0xFD, 0xF8, 0x00, 0x3E, 0x7F, 0x00, 0x1F, 0x8F, 0xE0, 0x1F,
-  0xE1, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x07, 0xFF, 0xF8, 0x00, 0x7F,
-  0xFC, 0x00, 0x00, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xF0, 0x00, 0x00, 0x3E,
-  0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00,
-  0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0,
-  0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00,
-  0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80,
-  0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,
-  0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00,
-  0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07,
-  0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00,
-  0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00,
-  0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF,
-  0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00,
-  0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0, 0x00, 0x07, 0xFE,
-  0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0x00, 0x00,
-  0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x3F, 0xF0,
-  0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1F, 0xF8, 0x00, 0x07,
-  0xFF, 0x80, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0x3F, 0x00, 0x07, 0xE7, 0xF0,
-  0x01, 0xF8, 0x7F, 0x80, 0xFF, 0x07, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xF0,
-  0x07, 0xFF, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x10, 0x00, 0x00, 0xFC,
-  0x00, 0x00, 0x7E, 0xF8, 0x00, 0x00, 0xFD, 0xF8, 0x00, 0x01, 0xF3, 0xF0,
-  0x00, 0x07, 0xE3, 0xE0, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x1F, 0x07, 0xC0,
-  0x00, 0x7E, 0x0F, 0x80, 0x00, 0xF8, 0x1F, 0x80, 0x01, 0xF0, 0x1F, 0x00,
-  0x07, 0xE0, 0x3F, 0x00, 0x0F, 0x80, 0x7E, 0x00, 0x1F, 0x00, 0x7C, 0x00,
-  0x7E, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0xF0, 0x01, 0xF0, 0x07,
-  0xE0, 0x03, 0xF0, 0x0F, 0x80, 0x03, 0xE0, 0x3F, 0x00, 0x07, 0xC0, 0x7E,
-  0x00, 0x0F, 0xC0, 0xF8, 0x00, 0x0F, 0x81, 0xF0, 0x00, 0x1F, 0x07, 0xC0,
-  0x00, 0x3F, 0x0F, 0x80, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x7C, 0x7C, 0x00,
-  0x00, 0xFC, 0xF8, 0x00, 0x00, 0xF9, 0xF0, 0x00, 0x01, 0xF7, 0xC0, 0x00,
-  0x01, 0xEF, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
-  0x07, 0xF8, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0xFC,
-  0x00, 0x0F, 0xC0, 0x01, 0xFB, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xDF, 0x00,
-  0x07, 0xF0, 0x00, 0x7C, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xE7, 0xE0, 0x01,
-  0xFE, 0x00, 0x3F, 0x1F, 0x00, 0x1F, 0xF0, 0x01, 0xF0, 0xF8, 0x00, 0xFF,
-  0x80, 0x0F, 0x87, 0xE0, 0x07, 0xBC, 0x00, 0xFC, 0x3F, 0x00, 0x7D, 0xF0,
-  0x07, 0xE0, 0xF8, 0x03, 0xEF, 0x80, 0x3E, 0x07, 0xC0, 0x1F, 0x7C, 0x01,
-  0xF0, 0x3F, 0x00, 0xF9, 0xE0, 0x1F, 0x80, 0xF8, 0x0F, 0x8F, 0x80, 0xFC,
-  0x07, 0xC0, 0x7C, 0x7C, 0x07, 0xC0, 0x3E, 0x03, 0xE3, 0xE0, 0x3E, 0x01,
-  0xF8, 0x1F, 0x0F, 0x03, 0xF0, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x00, 0x3E,
-  0x0F, 0x83, 0xE0, 0xF8, 0x01, 0xF0, 0x7C, 0x1F, 0x07, 0xC0, 0x0F, 0xC3,
-  0xC0, 0x78, 0x7E, 0x00, 0x3E, 0x3E, 0x03, 0xE3, 0xE0, 0x01, 0xF1, 0xF0,
-  0x1F, 0x1F, 0x00, 0x0F, 0x8F, 0x80, 0xF8, 0xF8, 0x00, 0x3E, 0x78, 0x03,
-  0xC7, 0xC0, 0x01, 0xF7, 0xC0, 0x1F, 0x7C, 0x00, 0x0F, 0xBE, 0x00, 0xFB,
-  0xE0, 0x00, 0x7D, 0xF0, 0x03, 0xDF, 0x00, 0x01, 0xEF, 0x00, 0x1E, 0xF0,
-  0x00, 0x0F, 0x78, 0x00, 0xF7, 0x80, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00,
-  0x03, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x00,
-  0x7F, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x3F, 0x80, 0x00, 0x7F,
-  0x00, 0x00, 0xFC, 0x7E, 0x00, 0x03, 0xF0, 0x7E, 0x00, 0x0F, 0xC0, 0x7E,
-  0x00, 0x1F, 0x80, 0xFC, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0xFC,
-  0x03, 0xE0, 0x01, 0xF8, 0x0F, 0xC0, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF0,
-  0x7C, 0x00, 0x03, 0xF1, 0xF8, 0x00, 0x03, 0xF7, 0xE0, 0x00, 0x03, 0xEF,
-  0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x07, 0xF0,
-  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0xC0,
-  0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xEF, 0x80, 0x00, 0x0F, 0xDF, 0x80,
-  0x00, 0x3F, 0x1F, 0x80, 0x00, 0x7E, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00,
-  0x07, 0xE0, 0x3F, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x3F, 0x00, 0x7E, 0x00,
-  0xFC, 0x00, 0x7E, 0x03, 0xF0, 0x00, 0xFE, 0x07, 0xE0, 0x00, 0xFC, 0x1F,
-  0x80, 0x00, 0xFC, 0x7E, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x01, 0xFC, 0xFE,
-  0x00, 0x00, 0xFE, 0xFC, 0x00, 0x01, 0xF8, 0xFC, 0x00, 0x07, 0xE1, 0xF8,
-  0x00, 0x1F, 0x81, 0xF8, 0x00, 0x3F, 0x01, 0xF8, 0x00, 0xFC, 0x03, 0xF0,
-  0x01, 0xF8, 0x03, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x0F, 0x80, 0x07, 0xE0,
-  0x3F, 0x00, 0x07, 0xC0, 0xFC, 0x00, 0x0F, 0xC1, 0xF8, 0x00, 0x0F, 0xC7,
-  0xE0, 0x00, 0x1F, 0x8F, 0x80, 0x00, 0x1F, 0xBF, 0x00, 0x00, 0x1F, 0x7C,
-  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x7F, 0x80,
-  0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00,
-  0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00,
-  0x00, 0x0F, 0x80, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00,
-  0x00, 0x7C, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,
-  0x03, 0xE0, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0x00, 0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00,
-  0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00,
-  0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00,
-  0x3E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x01,
-  0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0F,
-  0xC0, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E,
-  0x00, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3E,
-  0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83,
-  0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8,
-  0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F,
-  0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8,
-  0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00,
-  0x1E, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x78, 0x00, 0xF8, 0x01, 0xF0, 0x01,
-  0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3E,
-  0x00, 0x7C, 0x00, 0x78, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0xE0, 0x03, 0xC0,
-  0x07, 0xC0, 0x0F, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x7C, 0x00,
-  0x78, 0x00, 0xF0, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x0F,
-  0x80, 0x0F, 0x00, 0x1E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x78, 0x3C, 0x1E,
-  0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83,
-  0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0,
-  0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xE0,
-  0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x1F, 0x78, 0x03, 0xCF, 0x80, 0xF8, 0xF0,
-  0x1E, 0x1E, 0x07, 0xC1, 0xE0, 0xF0, 0x3C, 0x3E, 0x03, 0xC7, 0x80, 0x78,
-  0xF0, 0x0F, 0xBE, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0x7C, 0x3C, 0x3E, 0x1E, 0x0F, 0x01,
-  0xFE, 0x00, 0x3F, 0xFE, 0x07, 0xFF, 0xF8, 0x7F, 0xFF, 0xE3, 0xF8, 0x7F,
-  0x3F, 0x00, 0xFD, 0xF0, 0x03, 0xE1, 0x80, 0x1F, 0x00, 0x00, 0xF8, 0x00,
-  0x07, 0xC0, 0x00, 0x7E, 0x03, 0xFF, 0xF0, 0xFF, 0xFF, 0x9F, 0xFF, 0xFD,
-  0xFF, 0xC3, 0xEF, 0xC0, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00,
-  0x3F, 0xF0, 0x03, 0xFF, 0x80, 0x1F, 0xFE, 0x03, 0xFD, 0xFF, 0xFF, 0xEF,
-  0xFF, 0xDF, 0x3F, 0xFC, 0xF8, 0x7F, 0xC7, 0xC0, 0x20, 0x00, 0xF8, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00,
-  0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x3F,
-  0x00, 0xF8, 0xFF, 0xE0, 0xF9, 0xFF, 0xF0, 0xFB, 0xFF, 0xF8, 0xFB, 0xC3,
-  0xFC, 0xFF, 0x00, 0xFC, 0xFE, 0x00, 0x7E, 0xFE, 0x00, 0x7E, 0xFC, 0x00,
-  0x3E, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
-  0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00,
-  0x3F, 0xFC, 0x00, 0x3E, 0xFE, 0x00, 0x7E, 0xFE, 0x00, 0x7E, 0xFF, 0x00,
-  0xFC, 0xFF, 0xC3, 0xFC, 0xFB, 0xFF, 0xF8, 0xF9, 0xFF, 0xF0, 0xF8, 0xFF,
-  0xE0, 0xF8, 0x3F, 0x00, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFF,
-  0xC0, 0x7F, 0xFF, 0xC1, 0xFC, 0x3F, 0xC7, 0xE0, 0x1F, 0x8F, 0x80, 0x1F,
-  0xBF, 0x00, 0x1F, 0x7C, 0x00, 0x20, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07,
-  0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7E,
-  0x00, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0xF3, 0xF0,
-  0x03, 0xF3, 0xF0, 0x07, 0xC7, 0xF0, 0x3F, 0x87, 0xFF, 0xFE, 0x07, 0xFF,
-  0xF8, 0x07, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-  0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0xFC,
-  0x1F, 0x07, 0xFF, 0x1F, 0x0F, 0xFF, 0x9F, 0x1F, 0xFF, 0xDF, 0x3F, 0xC3,
-  0xDF, 0x3F, 0x00, 0xFF, 0x7E, 0x00, 0x7F, 0x7E, 0x00, 0x7F, 0x7C, 0x00,
-  0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00,
-  0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00,
-  0x3F, 0x7C, 0x00, 0x3F, 0x7E, 0x00, 0x7F, 0x7E, 0x00, 0x7F, 0x3F, 0x00,
-  0xFF, 0x3F, 0xC3, 0xFF, 0x1F, 0xFF, 0xDF, 0x0F, 0xFF, 0x9F, 0x07, 0xFF,
-  0x1F, 0x00, 0xFC, 0x1F, 0x00, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFF,
-  0x80, 0x7F, 0xFF, 0x81, 0xFC, 0x3F, 0x87, 0xE0, 0x1F, 0x8F, 0x80, 0x1F,
-  0x3E, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0xF0, 0x00, 0x7F, 0xE0, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0,
-  0x01, 0xC3, 0xF0, 0x07, 0xE7, 0xF0, 0x1F, 0x87, 0xFF, 0xFF, 0x07, 0xFF,
-  0xFC, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0x80, 0x00, 0x20, 0x00, 0x00, 0x3F,
-  0x80, 0x7F, 0xC0, 0x7F, 0xE0, 0x7F, 0xE0, 0x3F, 0x10, 0x3F, 0x00, 0x1F,
-  0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x3F, 0xFF, 0xDF, 0xFF, 0xEF,
-  0xFF, 0xF7, 0xFF, 0xF8, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0,
-  0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F,
-  0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00,
-  0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0,
-  0x00, 0xF8, 0x00, 0x00, 0xFC, 0x1F, 0x03, 0xFF, 0x1F, 0x0F, 0xFF, 0x9F,
-  0x1F, 0xFF, 0xDF, 0x1F, 0xC3, 0xDF, 0x3F, 0x00, 0xFF, 0x7E, 0x00, 0x7F,
-  0x7E, 0x00, 0x7F, 0x7C, 0x00, 0x3F, 0x7C, 0x00, 0x3F, 0xFC, 0x00, 0x3F,
-  0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F,
-  0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x7C, 0x00, 0x3F, 0x7E, 0x00, 0x3F,
-  0x7E, 0x00, 0x7F, 0x3F, 0x00, 0xFF, 0x3F, 0xC3, 0xFF, 0x1F, 0xFF, 0xDF,
-  0x0F, 0xFF, 0x9F, 0x07, 0xFF, 0x1F, 0x01, 0xFC, 0x1F, 0x00, 0x00, 0x1F,
-  0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x1C, 0x00, 0x3E, 0x7E, 0x00, 0x7E,
-  0x3F, 0xC3, 0xFC, 0x1F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0,
-  0x00, 0xFF, 0x80, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E,
-  0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00,
-  0x00, 0xF8, 0x3F, 0x03, 0xE3, 0xFF, 0x0F, 0x9F, 0xFF, 0x3E, 0xFF, 0xFC,
-  0xFB, 0xC7, 0xFB, 0xFC, 0x07, 0xEF, 0xE0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC,
-  0x00, 0x7F, 0xF0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00,
-  0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F,
-  0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0,
-  0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01,
-  0xF0, 0x7B, 0xFF, 0xFF, 0xFD, 0xE0, 0x00, 0x00, 0x0F, 0xBE, 0xFB, 0xEF,
-  0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF, 0xBE, 0xFB, 0xEF,
-  0xBE, 0xFB, 0xEF, 0xBE, 0x07, 0x83, 0xF0, 0xFC, 0x3F, 0x0F, 0xC1, 0xE0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E,
-  0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83,
-  0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8,
-  0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x8F, 0xEF, 0xF3, 0xFC, 0xFE,
-  0x3E, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0,
-  0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00,
-  0x00, 0xF8, 0x00, 0xFD, 0xF0, 0x03, 0xF3, 0xE0, 0x0F, 0xC7, 0xC0, 0x3F,
-  0x0F, 0x80, 0xFC, 0x1F, 0x03, 0xF0, 0x3E, 0x0F, 0xC0, 0x7C, 0x3F, 0x00,
-  0xF8, 0xFC, 0x01, 0xF3, 0xF0, 0x03, 0xEF, 0xE0, 0x07, 0xFF, 0x80, 0x0F,
-  0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0x3F, 0x00, 0xFC,
-  0x7F, 0x01, 0xF0, 0x7E, 0x03, 0xE0, 0x7E, 0x07, 0xC0, 0x7E, 0x0F, 0x80,
-  0xFE, 0x1F, 0x00, 0xFC, 0x3E, 0x00, 0xFC, 0x7C, 0x00, 0xFC, 0xF8, 0x01,
-  0xFD, 0xF0, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xC0, 0xF8, 0x3E, 0x00, 0xFC, 0x1F, 0x1F, 0xF0, 0x7F, 0xE3, 0xE7,
-  0xFF, 0x1F, 0xFE, 0x7D, 0xFF, 0xE7, 0xFF, 0xEF, 0xB8, 0xFF, 0xF1, 0xFF,
-  0xFC, 0x07, 0xF8, 0x0F, 0xFF, 0x00, 0x7E, 0x00, 0xFF, 0xE0, 0x0F, 0xC0,
-  0x1F, 0xFC, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x3E, 0x00, 0x7F, 0xE0, 0x07,
-  0xC0, 0x0F, 0xFC, 0x00, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0x00, 0x3F, 0xF0,
-  0x03, 0xE0, 0x07, 0xFE, 0x00, 0x7C, 0x00, 0xFF, 0xC0, 0x0F, 0x80, 0x1F,
-  0xF8, 0x01, 0xF0, 0x03, 0xFF, 0x00, 0x3E, 0x00, 0x7F, 0xE0, 0x07, 0xC0,
-  0x0F, 0xFC, 0x00, 0xF8, 0x01, 0xFF, 0x80, 0x1F, 0x00, 0x3F, 0xF0, 0x03,
-  0xE0, 0x07, 0xFE, 0x00, 0x7C, 0x00, 0xFF, 0xC0, 0x0F, 0x80, 0x1F, 0xF8,
-  0x01, 0xF0, 0x03, 0xFF, 0x00, 0x3E, 0x00, 0x7C, 0xF8, 0x3F, 0x03, 0xE3,
-  0xFF, 0x0F, 0x9F, 0xFF, 0x3E, 0xFF, 0xFC, 0xFB, 0xC7, 0xFB, 0xFC, 0x07,
-  0xEF, 0xE0, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xF0, 0x01, 0xFF,
-  0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80,
-  0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07,
-  0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE,
-  0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xF0, 0x00, 0xFF, 0x00, 0x03,
-  0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x1F, 0xC3, 0xFC, 0x3F,
-  0x00, 0xFC, 0x3E, 0x00, 0x7E, 0x7E, 0x00, 0x3E, 0x7C, 0x00, 0x3F, 0x7C,
-  0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
-  0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0x7C,
-  0x00, 0x3F, 0x7C, 0x00, 0x3E, 0x7E, 0x00, 0x7E, 0x3F, 0x00, 0x7E, 0x3F,
-  0x81, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x01,
-  0xFF, 0x80, 0x00, 0x08, 0x00, 0xF8, 0x3F, 0x00, 0xF8, 0xFF, 0xE0, 0xF9,
-  0xFF, 0xF0, 0xFB, 0xFF, 0xF8, 0xFB, 0xC3, 0xFC, 0xFF, 0x00, 0xFC, 0xFE,
-  0x00, 0x7E, 0xFE, 0x00, 0x7E, 0xFC, 0x00, 0x3E, 0xFC, 0x00, 0x3F, 0xFC,
-  0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
-  0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3E, 0xFE,
-  0x00, 0x7E, 0xFE, 0x00, 0x7E, 0xFF, 0x00, 0xFC, 0xFF, 0xC3, 0xFC, 0xFB,
-  0xFF, 0xF8, 0xF9, 0xFF, 0xF0, 0xF8, 0xFF, 0xE0, 0xF8, 0x3F, 0x00, 0xF8,
-  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
-  0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8,
-  0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x07, 0xFF, 0x1F, 0x0F,
-  0xFF, 0x9F, 0x1F, 0xFF, 0xDF, 0x3F, 0xC3, 0xDF, 0x3F, 0x00, 0xFF, 0x7E,
-  0x00, 0x7F, 0x7E, 0x00, 0x7F, 0x7C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC,
-  0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8,
-  0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0x7C, 0x00, 0x3F, 0x7E,
-  0x00, 0x7F, 0x7E, 0x00, 0x7F, 0x3F, 0x00, 0xFF, 0x3F, 0xC3, 0xFF, 0x1F,
-  0xFF, 0xDF, 0x0F, 0xFF, 0x9F, 0x07, 0xFF, 0x1F, 0x00, 0xFC, 0x1F, 0x00,
-  0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00,
-  0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00,
-  0x00, 0x1F, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xE7, 0xFF, 0xBF, 0xFE, 0xFF,
-  0xFF, 0xC7, 0xFC, 0x0F, 0xE0, 0x3F, 0x00, 0xFC, 0x03, 0xE0, 0x0F, 0x80,
-  0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0,
-  0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8,
-  0x03, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0x3F, 0xFC, 0x07, 0xFF, 0xF0, 0x7F,
-  0xFF, 0xC3, 0xF8, 0x7F, 0x3F, 0x00, 0xF9, 0xF0, 0x07, 0xEF, 0x80, 0x10,
-  0x7C, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xF0, 0x01, 0xFF,
-  0xF8, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x01, 0xFE, 0x00, 0x01, 0xF8,
-  0x00, 0x07, 0xC2, 0x00, 0x3F, 0xF0, 0x01, 0xF7, 0xC0, 0x1F, 0xBF, 0x01,
-  0xFD, 0xFF, 0xFF, 0xC7, 0xFF, 0xFC, 0x1F, 0xFF, 0xC0, 0x3F, 0xF8, 0x00,
-  0x08, 0x00, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01,
-  0xF0, 0x3F, 0xFF, 0x7F, 0xFE, 0xFF, 0xFD, 0xFF, 0xF8, 0x3E, 0x00, 0x7C,
-  0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00,
-  0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F,
-  0x80, 0x1F, 0x00, 0x3F, 0x00, 0x7F, 0x10, 0x7F, 0xC0, 0xFF, 0xC0, 0xFF,
-  0x80, 0x7F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00,
-  0x1F, 0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F,
-  0xF8, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8,
-  0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00,
-  0x7F, 0xF0, 0x01, 0xF7, 0xC0, 0x0F, 0xDF, 0x00, 0x3F, 0x7E, 0x01, 0xFD,
-  0xFE, 0x1F, 0xF3, 0xFF, 0xF7, 0xC7, 0xFF, 0x9F, 0x0F, 0xFC, 0x7C, 0x0F,
-  0xC1, 0xF0, 0xFC, 0x00, 0x1F, 0xBE, 0x00, 0x0F, 0x9F, 0x00, 0x07, 0xCF,
-  0xC0, 0x07, 0xE3, 0xE0, 0x03, 0xE1, 0xF0, 0x01, 0xF0, 0xFC, 0x01, 0xF8,
-  0x3E, 0x00, 0xF8, 0x1F, 0x00, 0x7C, 0x07, 0xC0, 0x7C, 0x03, 0xE0, 0x3E,
-  0x01, 0xF0, 0x1F, 0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x0F, 0x80, 0x1F, 0x07,
-  0xC0, 0x07, 0xC7, 0xC0, 0x03, 0xE3, 0xE0, 0x00, 0xF1, 0xE0, 0x00, 0x7D,
-  0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0x78, 0x00, 0x07, 0xFC, 0x00, 0x03,
-  0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x1F, 0x00, 0x00,
-  0xFC, 0x00, 0xF8, 0x01, 0xFB, 0xE0, 0x07, 0xC0, 0x0F, 0x9F, 0x00, 0x7F,
-  0x00, 0x7C, 0xFC, 0x03, 0xF8, 0x07, 0xE3, 0xE0, 0x1F, 0xC0, 0x3E, 0x1F,
-  0x00, 0xFE, 0x01, 0xF0, 0xF8, 0x0F, 0x78, 0x0F, 0x83, 0xE0, 0x7B, 0xC0,
-  0xF8, 0x1F, 0x03, 0xDE, 0x07, 0xC0, 0xF8, 0x3E, 0xF0, 0x3E, 0x07, 0xC1,
-  0xE7, 0xC1, 0xF0, 0x1F, 0x0F, 0x1E, 0x1F, 0x00, 0xF8, 0x78, 0xF0, 0xF8,
-  0x07, 0xC7, 0xC7, 0xC7, 0xC0, 0x1E, 0x3C, 0x1E, 0x3C, 0x00, 0xF9, 0xE0,
-  0xF3, 0xE0, 0x07, 0xCF, 0x07, 0x9F, 0x00, 0x3E, 0x78, 0x3C, 0xF0, 0x00,
-  0xF7, 0x80, 0xF7, 0x80, 0x07, 0xFC, 0x07, 0xFC, 0x00, 0x3F, 0xE0, 0x3F,
-  0xE0, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x07, 0xF0, 0x00, 0x3F,
-  0x80, 0x3F, 0x80, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x07, 0xC0, 0x07, 0xC0,
-  0x00, 0x7E, 0x00, 0x3E, 0x3E, 0x00, 0x7E, 0x3F, 0x00, 0xFC, 0x1F, 0x80,
-  0xF8, 0x0F, 0x81, 0xF8, 0x0F, 0xC1, 0xF0, 0x07, 0xC3, 0xE0, 0x03, 0xE7,
-  0xE0, 0x03, 0xE7, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0xFF,
-  0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF,
-  0x80, 0x01, 0xFF, 0x80, 0x03, 0xE7, 0xC0, 0x07, 0xE3, 0xE0, 0x07, 0xC3,
-  0xF0, 0x0F, 0x81, 0xF0, 0x1F, 0x81, 0xF8, 0x1F, 0x00, 0xFC, 0x3F, 0x00,
-  0x7C, 0x7E, 0x00, 0x7E, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x1F, 0xBE, 0x00,
-  0x0F, 0x9F, 0x00, 0x07, 0xCF, 0xC0, 0x07, 0xE3, 0xE0, 0x03, 0xE1, 0xF0,
-  0x01, 0xF0, 0xFC, 0x01, 0xF8, 0x3E, 0x00, 0xF8, 0x1F, 0x00, 0x7C, 0x07,
-  0xC0, 0x7C, 0x03, 0xE0, 0x3E, 0x01, 0xF0, 0x1F, 0x00, 0x7C, 0x1F, 0x00,
-  0x3E, 0x0F, 0x80, 0x1F, 0x07, 0xC0, 0x07, 0xC7, 0xC0, 0x03, 0xE3, 0xE0,
-  0x00, 0xF1, 0xE0, 0x00, 0x7D, 0xF0, 0x00, 0x3E, 0xF8, 0x00, 0x0F, 0x78,
-  0x00, 0x07, 0xFC, 0x00, 0x03, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F,
-  0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07,
-  0xC0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x23, 0xF0, 0x00, 0x1F,
-  0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
-  0xE0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x03,
-  0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x03,
-  0xF0, 0x00, 0x7E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x1F, 0x80, 0x03,
-  0xF0, 0x00, 0x3F, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1E, 0x01, 0xFC, 0x07, 0xF8, 0x1F,
-  0xF0, 0x3F, 0x80, 0x7C, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80,
-  0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07,
-  0xC0, 0x0F, 0x80, 0x7E, 0x07, 0xFC, 0x0F, 0xE0, 0x1F, 0x00, 0x3F, 0x80,
-  0x7F, 0xC0, 0x1F, 0x80, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00,
-  0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E,
-  0x00, 0x7C, 0x00, 0x7C, 0x00, 0xFE, 0x01, 0xFF, 0x01, 0xFE, 0x01, 0xFC,
-  0x00, 0x78, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xF0, 0x0F, 0xE0, 0x3F,
-  0xC0, 0x3F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0x80, 0x1E, 0x00,
-  0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0xC0,
-  0x1F, 0x00, 0x7C, 0x00, 0xFC, 0x01, 0xFC, 0x01, 0xF0, 0x0F, 0xC0, 0xFF,
-  0x03, 0xE0, 0x1F, 0x00, 0x7C, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78,
-  0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x0F, 0x80, 0x3E,
-  0x03, 0xF8, 0x3F, 0xC0, 0xFF, 0x03, 0xF0, 0x0F, 0x00, 0x00, 0x1F, 0xC0,
-  0x00, 0x3F, 0xE0, 0x1F, 0x7F, 0xF8, 0x1E, 0x7F, 0xFC, 0x1E, 0xF8, 0x7E,
-  0x7E, 0xF0, 0x3F, 0xFE, 0xF0, 0x1F, 0xFC, 0xF0, 0x0F, 0xF8, 0x00, 0x03,
-  0xE0 };
+// InterMedium24pt.h - Generated by scripts/font-subset.py from assets/fonts/InterMedium24pt.h, do not edit
+// 49 of 95 glyphs:  %-./0123456789CDFHILMNPRSTUacdefghiklmnorstuvwyz
+#pragma once
+#include "../PackedFont.h"
 
-const GFXglyph Inter_Medium24pt7bGlyphs[] PROGMEM = {
-  {     0,   1,   1,  13,    0,    0 },   // 0x20 ' '
-  {     1,   7,  34,  14,    4,  -33 },   // 0x21 '!'
-  {    31,  14,  13,  23,    5,  -33 },   // 0x22 '"'
-  {    54,  28,  34,  30,    1,  -33 },   // 0x23 '#'
-  {   173,  26,  44,  30,    2,  -38 },   // 0x24 '$'
-  {   316,  37,  35,  47,    5,  -33 },   // 0x25 '%'
-  {   478,  28,  34,  31,    2,  -33 },   // 0x26 '&'
-  {   597,   5,  13,  15,    5,  -33 },   // 0x27 '''
-  {   606,  10,  43,  17,    5,  -36 },   // 0x28 '('
-  {   660,  11,  43,  17,    2,  -36 },   // 0x29 ')'
-  {   720,  18,  19,  24,    3,  -33 },   // 0x2A '*'
-  {   763,  23,  23,  31,    4,  -24 },   // 0x2B '+'
-  {   830,   7,  13,  14,    3,   -4 },   // 0x2C ','
-  {   842,  15,   4,  22,    3,  -15 },   // 0x2D '-'
-  {   850,   7,   7,  14,    4,   -6 },   // 0x2E '.'
-  {   857,  15,  41,  17,    1,  -35 },   // 0x2F '/'
-  {   934,  25,  34,  30,    3,  -33 },   // 0x30 '0'
-  {  1041,  14,  34,  20,    2,  -33 },   // 0x31 '1'
-  {  1101,  23,  34,  29,    3,  -33 },   // 0x32 '2'
-  {  1199,  24,  34,  29,    3,  -33 },   // 0x33 '3'
-  {  1301,  25,  34,  31,    3,  -33 },   // 0x34 '4'
-  {  1408,  23,  34,  29,    3,  -33 },   // 0x35 '5'
-  {  1506,  24,  34,  30,    3,  -33 },   // 0x36 '6'
-  {  1608,  23,  34,  27,    2,  -33 },   // 0x37 '7'
-  {  1706,  24,  34,  30,    3,  -33 },   // 0x38 '8'
-  {  1808,  24,  34,  30,    3,  -33 },   // 0x39 '9'
-  {  1910,   7,  25,  14,    4,  -24 },   // 0x3A ':'
-  {  1932,   9,  33,  15,    3,  -24 },   // 0x3B ';'
-  {  1970,  22,  25,  31,    4,  -25 },   // 0x3C '<'
-  {  2039,  21,  15,  31,    5,  -20 },   // 0x3D '='
-  {  2079,  22,  25,  31,    5,  -25 },   // 0x3E '>'
-  {  2148,  20,  34,  25,    2,  -33 },   // 0x3F '?'
-  {  2233,  41,  43,  46,    3,  -32 },   // 0x40 '@'
-  {  2454,  31,  34,  33,    1,  -33 },   // 0x41 'A'
-  {  2586,  24,  34,  31,    4,  -33 },   // 0x42 'B'
-  {  2688,  29,  34,  34,    3,  -33 },   // 0x43 'C'
-  {  2812,  27,  34,  34,    4,  -33 },   // 0x44 'D'
-  {  2927,  21,  34,  28,    4,  -33 },   // 0x45 'E'
-  {  3017,  21,  34,  28,    4,  -33 },   // 0x46 'F'
-  {  3107,  29,  34,  35,    3,  -33 },   // 0x47 'G'
-  {  3231,  27,  34,  35,    4,  -33 },   // 0x48 'H'
-  {  3346,   5,  34,  13,    4,  -33 },   // 0x49 'I'
-  {  3368,  21,  34,  27,    2,  -33 },   // 0x4A 'J'
-  {  3458,  27,  34,  32,    4,  -33 },   // 0x4B 'K'
-  {  3573,  21,  34,  27,    4,  -33 },   // 0x4C 'L'
-  {  3663,  35,  34,  43,    4,  -33 },   // 0x4D 'M'
-  {  3812,  28,  34,  36,    4,  -33 },   // 0x4E 'N'
-  {  3931,  30,  34,  36,    3,  -33 },   // 0x4F 'O'
-  {  4059,  24,  34,  30,    4,  -33 },   // 0x50 'P'
-  {  4161,  30,  36,  36,    3,  -33 },   // 0x51 'Q'
-  {  4296,  25,  34,  30,    4,  -33 },   // 0x52 'R'
-  {  4403,  26,  35,  30,    2,  -33 },   // 0x53 'S'
-  {  4517,  27,  34,  31,    2,  -33 },   // 0x54 'T'
-  {  4632,  27,  35,  35,    4,  -33 },   // 0x55 'U'
-  {  4751,  31,  34,  33,    1,  -33 },   // 0x56 'V'
-  {  4883,  45,  34,  47,    1,  -33 },   // 0x57 'W'
-  {  5075,  31,  34,  33,    1,  -33 },   // 0x58 'X'
-  {  5207,  31,  34,  33,    1,  -33 },   // 0x59 'Y'
-  {  5339,  24,  34,  30,    3,  -33 },   // 0x5A 'Z'
-  {  5441,  10,  43,  17,    5,  -36 },   // 0x5B '['
-  {  5495,  15,  41,  17,    1,  -35 },   // 0x5C '\'
-  {  5572,   9,  43,  17,    3,  -36 },   // 0x5D ']'
-  {  5621,  19,  15,  22,    2,  -33 },   // 0x5E '^'
-  {  5657,  22,   4,  22,    0,    1 },   // 0x5F '_'
-  {  5668,   8,   7,  16,    4,  -35 },   // 0x60 '`'
-  {  5675,  21,  27,  27,    2,  -25 },   // 0x61 'a'
-  {  5746,  24,  34,  29,    3,  -33 },   // 0x62 'b'
-  {  5848,  23,  27,  27,    2,  -25 },   // 0x63 'c'
-  {  5926,  24,  34,  29,    2,  -33 },   // 0x64 'd'
-  {  6028,  23,  27,  28,    2,  -25 },   // 0x65 'e'
-  {  6106,  17,  36,  18,    0,  -35 },   // 0x66 'f'
-  {  6183,  24,  36,  29,    2,  -25 },   // 0x67 'g'
-  {  6291,  22,  34,  28,    3,  -33 },   // 0x68 'h'
-  {  6385,   6,  36,  12,    3,  -35 },   // 0x69 'i'
-  {  6412,  10,  46,  12,   -1,  -35 },   // 0x6A 'j'
-  {  6470,  23,  34,  26,    3,  -33 },   // 0x6B 'k'
-  {  6568,   5,  34,  12,    3,  -33 },   // 0x6C 'l'
-  {  6590,  35,  26,  42,    3,  -25 },   // 0x6D 'm'
-  {  6704,  22,  26,  28,    3,  -25 },   // 0x6E 'n'
-  {  6776,  24,  27,  28,    2,  -25 },   // 0x6F 'o'
-  {  6857,  24,  36,  29,    3,  -25 },   // 0x70 'p'
-  {  6965,  24,  36,  29,    2,  -25 },   // 0x71 'q'
-  {  7073,  14,  26,  18,    3,  -25 },   // 0x72 'r'
-  {  7119,  21,  27,  25,    2,  -25 },   // 0x73 's'
-  {  7190,  15,  32,  16,    0,  -31 },   // 0x74 't'
-  {  7250,  22,  26,  28,    3,  -25 },   // 0x75 'u'
-  {  7322,  25,  26,  27,    1,  -25 },   // 0x76 'v'
-  {  7404,  37,  26,  39,    1,  -25 },   // 0x77 'w'
-  {  7525,  24,  26,  26,    1,  -25 },   // 0x78 'x'
-  {  7603,  25,  36,  27,    1,  -25 },   // 0x79 'y'
-  {  7716,  20,  26,  26,    3,  -25 },   // 0x7A 'z'
-  {  7781,  15,  43,  21,    3,  -36 },   // 0x7B '{'
-  {  7862,   4,  56,  16,    6,  -44 },   // 0x7C '|'
-  {  7890,  14,  43,  21,    3,  -36 },   // 0x7D '}'
-  {  7966,  24,   9,  31,    4,  -17 } }; // 0x7E '~'
+const uint8_t Inter_Medium24ptData[] PROGMEM = {
+  0x10, 0x46, 0xF3, 0x47, 0xAF, 0x04, 0x7C, 0xD4, 0x84, 0x44, 0xC5, 0x74,
+  0x55, 0xB4, 0x84, 0x64, 0xA4, 0x94, 0x64, 0x95, 0x94, 0x64, 0x94, 0xA4,
+  0x64, 0x84, 0xB4, 0x64, 0x75, 0xB4, 0x55, 0x74, 0xD4, 0x44, 0x74, 0xEB,
+  0x74, 0xF1, 0xA7, 0x4F, 0x36, 0x84, 0xFF, 0x24, 0xFF, 0x25, 0xFF, 0x24,
+  0xFF, 0x24, 0xFF, 0x25, 0x86, 0xF3, 0x47, 0x9F, 0x14, 0x7B, 0xE5, 0x74,
+  0x44, 0xD4, 0x74, 0x54, 0xC4, 0x84, 0x64, 0xA4, 0x94, 0x64, 0xA4, 0x94,
+  0x64, 0x94, 0xA4, 0x64, 0x84, 0xB4, 0x64, 0x75, 0xB4, 0x55, 0x74, 0xC5,
+  0x44, 0x74, 0xEC, 0x65, 0xF0, 0xA6, 0x5F, 0x28, 0xFF, 0x22, 0x60, 0x0F,
+  0xFF, 0xF0, 0x14, 0x26, 0x16, 0x1D, 0x16, 0x24, 0x20, 0xB4, 0xB4, 0xA5,
+  0xA5, 0xA4, 0xA5, 0xA5, 0xA4, 0xB4, 0xA5, 0xA5, 0xA4, 0xB4, 0xA5, 0xA5,
+  0xA4, 0xA5, 0xA5, 0xA4, 0xB4, 0xA5, 0xA5, 0xA4, 0xB4, 0xA5, 0xA5, 0xA4,
+  0xB4, 0xA5, 0xA5, 0xA4, 0xA5, 0xA5, 0xA4, 0xB4, 0xA5, 0xA5, 0xA4, 0xB4,
+  0xA5, 0xA5, 0xA0, 0x88, 0xF0, 0xCC, 0xF0, 0x9F, 0x27, 0x74, 0x76, 0x77,
+  0x65, 0x5A, 0x63, 0x6B, 0x53, 0x5C, 0x53, 0x5C, 0x61, 0x5E, 0x51, 0x5E,
+  0x51, 0x5E, 0x51, 0x5E, 0xBE, 0xBF, 0x0A, 0xF0, 0xAF, 0x0A, 0xF0, 0xAE,
+  0xBE, 0xBE, 0x51, 0x5E, 0x51, 0x5E, 0x51, 0x6C, 0x62, 0x5C, 0x62, 0x6B,
+  0x54, 0x5A, 0x64, 0x68, 0x66, 0x74, 0x87, 0xF2, 0x9F, 0x0B, 0xCF, 0x08,
+  0x90, 0x77, 0x68, 0x4A, 0x3B, 0x2F, 0x51, 0xB3, 0xA4, 0x86, 0x77, 0x68,
+  0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+  0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x50,
+  0x87, 0xDD, 0x9F, 0x07, 0xF2, 0x57, 0x48, 0x36, 0x86, 0x35, 0xA6, 0x25,
+  0xB5, 0x15, 0xC5, 0x15, 0xC5, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x26, 0xF2,
+  0x5F, 0x26, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x7F, 0x06, 0xF1,
+  0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0, 0x7F, 0x07, 0xF0,
+  0xFF, 0xFF, 0xFF, 0x20, 0x88, 0xDD, 0xAF, 0x17, 0xF3, 0x58, 0x47, 0x46,
+  0x96, 0x35, 0xB5, 0x35, 0xB6, 0x15, 0xC6, 0xF4, 0x5F, 0x35, 0xF4, 0x5F,
+  0x36, 0xF1, 0x7B, 0xCC, 0xAE, 0xAE, 0xDF, 0x19, 0xF3, 0x7F, 0x36, 0xF4,
+  0x5F, 0x46, 0xF4, 0x5F, 0x4A, 0xDB, 0xDC, 0xB6, 0x26, 0x97, 0x29, 0x48,
+  0x4F, 0x46, 0xF2, 0x9E, 0xC9, 0x80, 0xE7, 0xF2, 0x8F, 0x28, 0xF1, 0x9F,
+  0x0A, 0xF0, 0xAE, 0xBE, 0x51, 0x5D, 0x52, 0x5C, 0x62, 0x5C, 0x53, 0x5B,
+  0x54, 0x5A, 0x64, 0x5A, 0x55, 0x59, 0x56, 0x59, 0x56, 0x58, 0x57, 0x57,
+  0x67, 0x57, 0x58, 0x56, 0x59, 0x55, 0x69, 0x55, 0x5A, 0x54, 0x5B, 0x54,
+  0xFF, 0xFF, 0xFF, 0xAF, 0x15, 0xF5, 0x5F, 0x55, 0xF5, 0x5F, 0x55, 0xF5,
+  0x5F, 0x55, 0x40, 0x3F, 0x44, 0xF4, 0x4F, 0x43, 0xF5, 0x35, 0xF3, 0x5F,
+  0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x43, 0x78, 0x51, 0xB6,
+  0xF4, 0x4F, 0x53, 0x93, 0x83, 0x68, 0x7F, 0x36, 0xF2, 0x6F, 0x35, 0xF3,
+  0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0xBC, 0x51, 0x5B, 0x61, 0x6A, 0x52,
+  0x78, 0x63, 0x83, 0x85, 0xF2, 0x7F, 0x09, 0xDD, 0x78, 0x97, 0xF0, 0xCA,
+  0xF0, 0x8F, 0x26, 0x84, 0x75, 0x59, 0x63, 0x5B, 0x52, 0x6B, 0x61, 0x5F,
+  0x45, 0xF3, 0x5F, 0x45, 0x57, 0x75, 0x3B, 0x55, 0x2D, 0x45, 0x1F, 0x03,
+  0xB3, 0x82, 0x88, 0x71, 0x7A, 0x61, 0x6C, 0x51, 0x6C, 0xCD, 0xAE, 0xAE,
+  0xAE, 0xBD, 0x51, 0x5C, 0x61, 0x5C, 0x52, 0x6A, 0x63, 0x68, 0x65, 0x74,
+  0x85, 0xF3, 0x8F, 0x0A, 0xCE, 0x88, 0x0F, 0xFF, 0xFF, 0xF2, 0xF2, 0x6F,
+  0x25, 0xF2, 0x6F, 0x25, 0xF2, 0x6F, 0x25, 0xF2, 0x6F, 0x25, 0xF2, 0x6F,
+  0x25, 0xF2, 0x6F, 0x25, 0xF2, 0x6F, 0x25, 0xF2, 0x6F, 0x25, 0xF2, 0x6F,
+  0x25, 0xF2, 0x6F, 0x25, 0xF2, 0x6F, 0x25, 0xF2, 0x6F, 0x25, 0xF2, 0x6F,
+  0x25, 0xF2, 0x6F, 0x25, 0xF2, 0x6F, 0x16, 0xF0, 0x88, 0xDD, 0xAF, 0x17,
+  0xF3, 0x58, 0x48, 0x37, 0x86, 0x36, 0xA5, 0x35, 0xB6, 0x25, 0xC5, 0x25,
+  0xC5, 0x25, 0xB5, 0x36, 0xA5, 0x46, 0x86, 0x57, 0x47, 0x7F, 0x1A, 0xBB,
+  0xF0, 0x8F, 0x35, 0x76, 0x73, 0x69, 0x71, 0x6B, 0x61, 0x5D, 0xBD, 0xBE,
+  0xAE, 0xAD, 0xBD, 0xCB, 0x62, 0x69, 0x72, 0x94, 0x84, 0xF4, 0x6F, 0x29,
+  0xEC, 0x98, 0x87, 0xED, 0xAF, 0x08, 0xF2, 0x68, 0x38, 0x47, 0x77, 0x35,
+  0xB5, 0x26, 0xB6, 0x15, 0xD5, 0x15, 0xD5, 0x15, 0xDB, 0xDB, 0xDB, 0xDC,
+  0xBD, 0xB7, 0x16, 0x89, 0x19, 0x3B, 0x2F, 0x11, 0x53, 0xE2, 0x55, 0xB3,
+  0x57, 0x66, 0x5F, 0x35, 0xF4, 0x5F, 0x45, 0x15, 0xC5, 0x26, 0xB5, 0x35,
+  0xA6, 0x36, 0x86, 0x57, 0x47, 0x6F, 0x29, 0xEB, 0xCE, 0x89, 0xB8, 0xF3,
+  0xED, 0xF3, 0xAF, 0x58, 0x94, 0x96, 0x7A, 0x74, 0x7C, 0x73, 0x6E, 0x62,
+  0x6F, 0x15, 0x25, 0xF2, 0x61, 0x5F, 0x3B, 0xF8, 0x5F, 0x95, 0xF9, 0x5F,
+  0x95, 0xF9, 0x5F, 0x95, 0xF9, 0x5F, 0x95, 0xF9, 0x5F, 0x95, 0xF9, 0x6F,
+  0x86, 0xF3, 0x51, 0x5F, 0x26, 0x16, 0xF1, 0x53, 0x6E, 0x63, 0x7C, 0x65,
+  0x7A, 0x76, 0x94, 0x98, 0xF5, 0xAF, 0x3D, 0xEF, 0x38, 0xA0, 0x0F, 0x1B,
+  0xF4, 0x8F, 0x66, 0xF7, 0x55, 0x99, 0x45, 0xC7, 0x35, 0xD7, 0x25, 0xE6,
+  0x25, 0xF0, 0x61, 0x5F, 0x15, 0x15, 0xF1, 0x51, 0x5F, 0x1B, 0xF2, 0xAF,
+  0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF,
+  0x2A, 0xF1, 0xBF, 0x15, 0x15, 0xF1, 0x51, 0x5F, 0x06, 0x15, 0xE6, 0x25,
+  0xD7, 0x25, 0xC7, 0x35, 0x8A, 0x4F, 0x75, 0xF6, 0x6F, 0x48, 0xF1, 0xB0,
+  0x0F, 0xFF, 0xFF, 0xEF, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1,
+  0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0xF5, 0x1F, 0x51,
+  0xF5, 0x1F, 0x51, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1,
+  0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1,
+  0x05, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF,
+  0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xFF,
+  0xFF, 0xFF, 0xFD, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A,
+  0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A,
+  0xF2, 0x50, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x05, 0xF1, 0x5F,
+  0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F,
+  0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F,
+  0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F,
+  0x15, 0xF1, 0x5F, 0x15, 0xF1, 0x5F, 0x1F, 0xFF, 0xFF, 0x90, 0x08, 0xF4,
+  0xF1, 0xF4, 0xF1, 0xF3, 0xF3, 0xF2, 0xF3, 0xF2, 0xF4, 0xF0, 0xF5, 0xF0,
+  0xF5, 0xF0, 0x41, 0xA1, 0x5D, 0x51, 0xA1, 0x5D, 0x51, 0xA1, 0x6B, 0x52,
+  0xA2, 0x5B, 0x52, 0xA2, 0x5B, 0x52, 0xA2, 0x69, 0x62, 0xA3, 0x59, 0x53,
+  0xA3, 0x59, 0x53, 0xA3, 0x67, 0x54, 0xA4, 0x57, 0x54, 0xA4, 0x65, 0x64,
+  0xA5, 0x55, 0x55, 0xA5, 0x55, 0x55, 0xA5, 0x63, 0x65, 0xA6, 0x53, 0x56,
+  0xA6, 0x53, 0x56, 0xA6, 0x52, 0x57, 0xA7, 0x51, 0x57, 0xA7, 0x51, 0x57,
+  0xA8, 0x41, 0x48, 0xA8, 0x98, 0xA8, 0x89, 0xA9, 0x79, 0xA9, 0x79, 0xAA,
+  0x5A, 0xAA, 0x5A, 0x50, 0x06, 0xF1, 0xDF, 0x0D, 0xF0, 0xEE, 0xF0, 0xDF,
+  0x0D, 0xF1, 0xCF, 0x2B, 0xB1, 0x5B, 0xB1, 0x6A, 0xB2, 0x69, 0xB2, 0x69,
+  0xB3, 0x68, 0xB4, 0x58, 0xB4, 0x67, 0xB5, 0x66, 0xB5, 0x66, 0xB6, 0x65,
+  0xB7, 0x64, 0xB7, 0x64, 0xB8, 0x63, 0xB9, 0x53, 0xB9, 0x62, 0xBA, 0x62,
+  0xAB, 0x52, 0xAB, 0x61, 0xAC, 0x51, 0xAD, 0xF0, 0xDF, 0x0E, 0xEE, 0xEF,
+  0x0D, 0xF1, 0xCF, 0x17, 0x0F, 0x18, 0xF4, 0x5F, 0x54, 0xF6, 0x35, 0x98,
+  0x25, 0xB7, 0x15, 0xC6, 0x15, 0xD5, 0x15, 0xDB, 0xDB, 0xEA, 0xEA, 0xDB,
+  0xDB, 0xD5, 0x15, 0xC6, 0x15, 0xB7, 0x15, 0x98, 0x2F, 0x63, 0xF5, 0x4F,
+  0x45, 0xF1, 0x85, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45,
+  0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x40, 0x0F, 0x19, 0xF4,
+  0x6F, 0x55, 0xF6, 0x45, 0x98, 0x35, 0xB7, 0x25, 0xC6, 0x25, 0xD6, 0x15,
+  0xD6, 0x15, 0xD6, 0x15, 0xE5, 0x15, 0xE5, 0x15, 0xD6, 0x15, 0xD6, 0x15,
+  0xC6, 0x25, 0xB7, 0x25, 0x98, 0x3F, 0x73, 0xF6, 0x4F, 0x46, 0xF3, 0x75,
+  0x85, 0x75, 0x86, 0x65, 0x95, 0x65, 0x96, 0x55, 0xA6, 0x45, 0xA6, 0x45,
+  0xB6, 0x35, 0xB6, 0x35, 0xC6, 0x25, 0xC6, 0x25, 0xD6, 0x15, 0xD6, 0x15,
+  0xE6, 0x99, 0xF0, 0xDB, 0xF2, 0x8F, 0x46, 0x85, 0x84, 0x79, 0x73, 0x6B,
+  0x63, 0x5D, 0x52, 0x6D, 0x52, 0x6F, 0x56, 0xF6, 0x5F, 0x66, 0xF5, 0x8F,
+  0x4B, 0xF1, 0xDE, 0xF0, 0xDF, 0x0E, 0xDF, 0x1B, 0xF4, 0x8F, 0x56, 0xF6,
+  0x6F, 0x65, 0xF6, 0xBF, 0x05, 0x15, 0xE6, 0x16, 0xD5, 0x27, 0xB6, 0x37,
+  0x88, 0x4F, 0x66, 0xF4, 0x8F, 0x1C, 0xDF, 0x41, 0xC0, 0x0F, 0xFF, 0xFF,
+  0xFF, 0x3B, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F,
+  0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F,
+  0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F,
+  0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xF7, 0x5F, 0x75, 0xB0, 0x05,
+  0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A,
+  0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A,
+  0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A, 0xF2, 0xAF, 0x2A,
+  0xF1, 0xCF, 0x0C, 0xF0, 0x52, 0x6D, 0x62, 0x7B, 0x64, 0x87, 0x85, 0xF6,
+  0x7F, 0x49, 0xF1, 0xDC, 0xF6, 0x1D, 0x78, 0xBD, 0x6F, 0x14, 0xF3, 0x37,
+  0x47, 0x26, 0x86, 0x15, 0xA5, 0x42, 0xA5, 0xF1, 0x5F, 0x15, 0xF0, 0x67,
+  0xE4, 0xF2, 0x2F, 0x41, 0xB4, 0x51, 0x69, 0xBA, 0xAB, 0xAB, 0xAA, 0xBA,
+  0xC7, 0x81, 0xF5, 0x1E, 0x15, 0x2C, 0x25, 0x49, 0x35, 0x81, 0xC0, 0x88,
+  0xDC, 0xAF, 0x07, 0xF2, 0x57, 0x48, 0x36, 0x86, 0x35, 0xA6, 0x16, 0xB5,
+  0x15, 0xC1, 0x55, 0xF2, 0x6F, 0x25, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x36,
+  0xF2, 0x6F, 0x35, 0xF3, 0x5C, 0x42, 0x6A, 0x62, 0x69, 0x53, 0x76, 0x74,
+  0xF3, 0x6F, 0x18, 0xEB, 0xAF, 0x31, 0xA0, 0xF4, 0x5F, 0x45, 0xF4, 0x5F,
+  0x45, 0xF4, 0x5F, 0x45, 0xF4, 0x5F, 0x45, 0x86, 0x55, 0x5B, 0x35, 0x4D,
+  0x25, 0x3F, 0x01, 0x52, 0x84, 0x41, 0x52, 0x68, 0x81, 0x6A, 0x71, 0x6A,
+  0x71, 0x5C, 0xCC, 0xCC, 0xBE, 0xAE, 0xAE, 0xAE, 0xBC, 0xCC, 0x61, 0x5C,
+  0x61, 0x6A, 0x71, 0x6A, 0x72, 0x68, 0x82, 0x84, 0xA3, 0xF0, 0x15, 0x4D,
+  0x25, 0x5B, 0x35, 0x86, 0x55, 0x88, 0xDC, 0xAE, 0x8F, 0x16, 0x74, 0x74,
+  0x68, 0x63, 0x5A, 0x52, 0x5C, 0x51, 0x5C, 0x51, 0x4D, 0xAD, 0xFF, 0xFF,
+  0xFF, 0xCF, 0x35, 0xF4, 0x5F, 0x35, 0xF3, 0x6B, 0x34, 0x69, 0x62, 0x77,
+  0x64, 0xF4, 0x5F, 0x27, 0xF0, 0xAB, 0xF2, 0x1A, 0xA7, 0x89, 0x7A, 0x6A,
+  0x76, 0x31, 0x66, 0xB5, 0xC5, 0xC5, 0xC5, 0x7F, 0x11, 0xF1, 0x1F, 0x11,
+  0xF1, 0x65, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5,
+  0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0x70,
+  0x86, 0x55, 0x6A, 0x35, 0x4D, 0x25, 0x3F, 0x01, 0x53, 0x74, 0x41, 0x52,
+  0x68, 0x81, 0x6A, 0x71, 0x6A, 0x71, 0x5C, 0x61, 0x5C, 0xCC, 0xBE, 0xAE,
+  0xAE, 0xAE, 0xBD, 0xBC, 0x61, 0x5C, 0x61, 0x6B, 0x61, 0x6A, 0x72, 0x68,
+  0x82, 0x84, 0xA3, 0xF0, 0x15, 0x4D, 0x25, 0x5B, 0x35, 0x77, 0x55, 0xF4,
+  0x5F, 0x45, 0xF3, 0x54, 0x3C, 0x52, 0x6A, 0x63, 0x84, 0x85, 0xF4, 0x6F,
+  0x28, 0xED, 0x97, 0x05, 0xF2, 0x5F, 0x25, 0xF2, 0x5F, 0x25, 0xF2, 0x5F,
+  0x25, 0xF2, 0x5F, 0x25, 0x56, 0x65, 0x3A, 0x45, 0x2D, 0x25, 0x1E, 0x25,
+  0x14, 0x38, 0x18, 0x76, 0x17, 0x9C, 0xAC, 0xBB, 0xBA, 0xCA, 0xCA, 0xCA,
+  0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+  0xC5, 0x14, 0x1F, 0x91, 0x4F, 0xA5, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x10, 0x05, 0xF3, 0x5F, 0x35,
+  0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xB6, 0x15, 0xA6,
+  0x25, 0x96, 0x35, 0x86, 0x45, 0x76, 0x55, 0x66, 0x65, 0x56, 0x75, 0x46,
+  0x85, 0x36, 0x95, 0x26, 0xA5, 0x17, 0xAC, 0xBD, 0xAD, 0xAE, 0x97, 0x26,
+  0x86, 0x37, 0x75, 0x56, 0x75, 0x66, 0x65, 0x76, 0x55, 0x77, 0x45, 0x86,
+  0x45, 0x96, 0x35, 0xA6, 0x25, 0xA7, 0x15, 0xB7, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x50, 0x05, 0x55, 0x96, 0x55, 0x39, 0x5A, 0x35, 0x2B, 0x3C,
+  0x25, 0x1C, 0x2E, 0x15, 0x13, 0x3C, 0x3F, 0x07, 0x87, 0xC9, 0x69, 0xB9,
+  0x69, 0xB9, 0x5A, 0xAA, 0x5A, 0xAA, 0x5A, 0xAA, 0x5A, 0xAA, 0x5A, 0xAA,
+  0x5A, 0xAA, 0x5A, 0xAA, 0x5A, 0xAA, 0x5A, 0xAA, 0x5A, 0xAA, 0x5A, 0xAA,
+  0x5A, 0xAA, 0x5A, 0xAA, 0x5A, 0xAA, 0x5A, 0xAA, 0x5A, 0xAA, 0x5A, 0xAA,
+  0x5A, 0x50, 0x05, 0x56, 0x65, 0x3A, 0x45, 0x2D, 0x25, 0x1E, 0x25, 0x14,
+  0x38, 0x18, 0x76, 0x17, 0x9C, 0xAC, 0xBB, 0xBA, 0xCA, 0xCA, 0xCA, 0xCA,
+  0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xC5,
+  0x88, 0xEC, 0xBF, 0x08, 0xF2, 0x67, 0x48, 0x46, 0x86, 0x45, 0xA6, 0x26,
+  0xB5, 0x25, 0xC6, 0x15, 0xDB, 0xDA, 0xEA, 0xEA, 0xEA, 0xEB, 0xDB, 0xD5,
+  0x15, 0xC6, 0x15, 0xC5, 0x26, 0xA6, 0x36, 0x96, 0x37, 0x67, 0x5F, 0x37,
+  0xF1, 0x9E, 0xCA, 0xF4, 0x1B, 0x05, 0x4A, 0x2C, 0x1D, 0x1F, 0x33, 0x96,
+  0x77, 0x68, 0x68, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+  0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x78, 0xBC, 0x7F, 0x05,
+  0xF2, 0x47, 0x47, 0x26, 0x85, 0x25, 0x96, 0x15, 0xA1, 0x55, 0xF1, 0x6F,
+  0x17, 0xEB, 0xBE, 0x9E, 0xAC, 0xD8, 0xF1, 0x6F, 0x15, 0x41, 0xBA, 0xB5,
+  0x15, 0x96, 0x16, 0x77, 0x1F, 0x43, 0xF2, 0x5F, 0x08, 0xBF, 0x01, 0xA0,
+  0x45, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0x6E, 0x1E, 0x1E, 0x1E, 0x55, 0xA5,
+  0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+  0xA5, 0xA5, 0xA6, 0x97, 0x31, 0x59, 0x6A, 0x69, 0x87, 0x05, 0xCA, 0xCA,
+  0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+  0xCA, 0xCA, 0xCB, 0xB5, 0x15, 0xA6, 0x15, 0xA6, 0x16, 0x87, 0x18, 0x49,
+  0x2E, 0x15, 0x3C, 0x25, 0x4A, 0x35, 0x66, 0x55, 0x06, 0xD6, 0x15, 0xD5,
+  0x25, 0xD5, 0x26, 0xB6, 0x35, 0xB5, 0x45, 0xB5, 0x46, 0x96, 0x55, 0x95,
+  0x65, 0x95, 0x75, 0x75, 0x85, 0x75, 0x85, 0x75, 0x95, 0x55, 0xA5, 0x55,
+  0xA5, 0x55, 0xB5, 0x35, 0xC5, 0x35, 0xD4, 0x34, 0xE5, 0x15, 0xE5, 0x15,
+  0xF0, 0x41, 0x4F, 0x19, 0xF1, 0x9F, 0x27, 0xF3, 0x7F, 0x45, 0xA0, 0x06,
+  0xA5, 0xA6, 0x15, 0xA5, 0xA5, 0x25, 0x97, 0x95, 0x26, 0x87, 0x86, 0x35,
+  0x87, 0x85, 0x45, 0x87, 0x85, 0x45, 0x74, 0x14, 0x75, 0x55, 0x64, 0x14,
+  0x65, 0x65, 0x64, 0x14, 0x65, 0x65, 0x55, 0x14, 0x65, 0x65, 0x54, 0x25,
+  0x55, 0x75, 0x44, 0x34, 0x45, 0x85, 0x44, 0x34, 0x45, 0x85, 0x35, 0x35,
+  0x35, 0x94, 0x34, 0x54, 0x34, 0xA5, 0x24, 0x54, 0x25, 0xA5, 0x24, 0x54,
+  0x25, 0xA5, 0x24, 0x54, 0x24, 0xC4, 0x14, 0x74, 0x14, 0xC9, 0x79, 0xC9,
+  0x79, 0xD7, 0x97, 0xE7, 0x97, 0xE7, 0x97, 0xF0, 0x69, 0x6F, 0x15, 0xB5,
+  0x80, 0x06, 0xD6, 0x15, 0xD5, 0x25, 0xD5, 0x26, 0xB6, 0x35, 0xB5, 0x45,
+  0xB5, 0x46, 0x96, 0x55, 0x95, 0x65, 0x95, 0x75, 0x75, 0x85, 0x75, 0x85,
+  0x75, 0x95, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0xB5, 0x35, 0xC5, 0x35, 0xD4,
+  0x34, 0xE5, 0x15, 0xE5, 0x15, 0xF0, 0x41, 0x4F, 0x19, 0xF1, 0x9F, 0x27,
+  0xF3, 0x7F, 0x45, 0xF5, 0x5F, 0x46, 0xF4, 0x5F, 0x55, 0xF4, 0x5F, 0x01,
+  0x36, 0xF0, 0x9F, 0x19, 0xF0, 0x9F, 0x17, 0xF1, 0x0F, 0xFF, 0xFF, 0x5D,
+  0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0x6E,
+  0x6D, 0x6D, 0x6D, 0x6E, 0x6D, 0x6D, 0xFF, 0xFF, 0xF5,
+};
 
-const GFXfont Inter_Medium24pt7b PROGMEM = {
-  (uint8_t  *)Inter_Medium24pt7bBitmaps,
-  (GFXglyph *)Inter_Medium24pt7bGlyphs,
-  0x20, 0x7E, 57 };
+const PackedGlyph Inter_Medium24ptGlyphs[] PROGMEM = {
+  {     0,   1,   1,  13,    0,    0 }, // 0x20 ' '
+  {     1,  37,  35,  47,    5,  -33 }, // 0x25 '%'
+  {    95,  15,   4,  22,    3,  -15 }, // 0x2D '-'
+  {    98,   7,   7,  14,    4,   -6 }, // 0x2E '.'
+  {   105,  15,  41,  17,    1,  -35 }, // 0x2F '/'
+  {   147,  25,  34,  30,    3,  -33 }, // 0x30 '0'
+  {   205,  14,  34,  20,    2,  -33 }, // 0x31 '1'
+  {   240,  23,  34,  29,    3,  -33 }, // 0x32 '2'
+  {   292,  24,  34,  29,    3,  -33 }, // 0x33 '3'
+  {   342,  25,  34,  31,    3,  -33 }, // 0x34 '4'
+  {   399,  23,  34,  29,    3,  -33 }, // 0x35 '5'
+  {   453,  24,  34,  30,    3,  -33 }, // 0x36 '6'
+  {   510,  23,  34,  27,    2,  -33 }, // 0x37 '7'
+  {   560,  24,  34,  30,    3,  -33 }, // 0x38 '8'
+  {   614,  24,  34,  30,    3,  -33 }, // 0x39 '9'
+  {   670,  29,  34,  34,    3,  -33 }, // 0x43 'C'
+  {   730,  27,  34,  34,    4,  -33 }, // 0x44 'D'
+  {   792,  21,  34,  28,    4,  -33 }, // 0x46 'F'
+  {   840,  27,  34,  35,    4,  -33 }, // 0x48 'H'
+  {   890,   5,  34,  13,    4,  -33 }, // 0x49 'I'
+  {   897,  21,  34,  27,    4,  -33 }, // 0x4C 'L'
+  {   946,  35,  34,  43,    4,  -33 }, // 0x4D 'M'
+  {  1036,  28,  34,  36,    4,  -33 }, // 0x4E 'N'
+  {  1096,  24,  34,  30,    4,  -33 }, // 0x50 'P'
+  {  1149,  25,  34,  30,    4,  -33 }, // 0x52 'R'
+  {  1213,  26,  35,  30,    2,  -33 }, // 0x53 'S'
+  {  1269,  27,  34,  31,    2,  -33 }, // 0x54 'T'
+  {  1319,  27,  35,  35,    4,  -33 }, // 0x55 'U'
+  {  1374,  21,  27,  27,    2,  -25 }, // 0x61 'a'
+  {  1415,  23,  27,  27,    2,  -25 }, // 0x63 'c'
+  {  1459,  24,  34,  29,    2,  -33 }, // 0x64 'd'
+  {  1517,  23,  27,  28,    2,  -25 }, // 0x65 'e'
+  {  1556,  17,  36,  18,    0,  -35 }, // 0x66 'f'
+  {  1596,  24,  36,  29,    2,  -25 }, // 0x67 'g'
+  {  1659,  22,  34,  28,    3,  -33 }, // 0x68 'h'
+  {  1705,   6,  36,  12,    3,  -35 }, // 0x69 'i'
+  {  1736,  23,  34,  26,    3,  -33 }, // 0x6B 'k'
+  {  1796,   5,  34,  12,    3,  -33 }, // 0x6C 'l'
+  {  1803,  35,  26,  42,    3,  -25 }, // 0x6D 'm'
+  {  1862,  22,  26,  28,    3,  -25 }, // 0x6E 'n'
+  {  1896,  24,  27,  28,    2,  -25 }, // 0x6F 'o'
+  {  1937,  14,  26,  18,    3,  -25 }, // 0x72 'r'
+  {  1964,  21,  27,  25,    2,  -25 }, // 0x73 's'
+  {  2004,  15,  32,  16,    0,  -31 }, // 0x74 't'
+  {  2037,  22,  26,  28,    3,  -25 }, // 0x75 'u'
+  {  2072,  25,  26,  27,    1,  -25 }, // 0x76 'v'
+  {  2123,  37,  26,  39,    1,  -25 }, // 0x77 'w'
+  {  2209,  25,  36,  27,    1,  -25 }, // 0x79 'y'
+  {  2276,  20,  26,  26,    3,  -25 }, // 0x7A 'z'
+};
 
-// Approx. 8665 bytes
+const uint8_t Inter_Medium24ptIndex[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+  0x0D, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+  0x10, 0xFF, 0x11, 0xFF, 0x12, 0x13, 0xFF, 0xFF, 0x14, 0x15, 0x16, 0xFF,
+  0x17, 0xFF, 0x18, 0x19, 0x1A, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xFF, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+  0x22, 0x23, 0xFF, 0x24, 0x25, 0x26, 0x27, 0x28, 0xFF, 0xFF, 0x29, 0x2A,
+  0x2B, 0x2C, 0x2D, 0x2E, 0xFF, 0x2F, 0x30,
+};
+
+const PackedFont Inter_Medium24pt = { Inter_Medium24ptData, Inter_Medium24ptGlyphs, Inter_Medium24ptIndex, 0x20, 0x7A, 57, PackedFont::RLE };
@@ -0,0 +1,701 @@
+// InterMedium24ptSmooth.h - Generated by scripts/font-subset.py from assets/fonts/InterMedium24pt.h, do not edit
+// 29 of 95 glyphs:  %-./0123456789CLNadefhiklmot
+#pragma once
+#include "../PackedFont.h"
+
+const uint8_t Inter_Medium24ptSmoothData[] PROGMEM = {
+  0x03, 0x07, 0x9F, 0x99, 0x0F, 0x0F, 0x03, 0x9F, 0x59, 0x0F, 0x00, 0x6F,
+  0xB6, 0x0F, 0x0F, 0x01, 0x6F, 0x69, 0x0D, 0x9F, 0xFF, 0x19, 0x0F, 0x0D,
+  0x9F, 0x66, 0x0D, 0x6F, 0xFF, 0x36, 0x0F, 0x0B, 0x6F, 0x69, 0x0D, 0x9F,
+  0xFF, 0x59, 0x0F, 0x09, 0x9F, 0x66, 0x0E, 0xFF, 0xF7, 0x0F, 0x08, 0x6F,
+  0x70, 0xFF, 0x76, 0x05, 0x6F, 0x70, 0xF0, 0x79, 0xF8, 0x0E, 0x6F, 0x69,
+  0x07, 0xF7, 0x60, 0xF0, 0x6F, 0x89, 0x0D, 0x9F, 0x66, 0x08, 0xF8, 0x90,
+  0xF0, 0x5F, 0x76, 0x0E, 0xF7, 0x09, 0x9F, 0x80, 0xF0, 0x46, 0xF6, 0x90,
+  0xFF, 0x70, 0xA6, 0xF7, 0x0F, 0x03, 0x9F, 0x66, 0x0F, 0x00, 0xF7, 0x0B,
+  0xF7, 0x0F, 0x02, 0x6F, 0x70, 0xF0, 0x1F, 0x70, 0xBF, 0x70, 0xF0, 0x19,
+  0xF8, 0x0F, 0x01, 0xF7, 0x0B, 0xF7, 0x0F, 0x01, 0xF8, 0x90, 0xF0, 0x1F,
+  0x70, 0xBF, 0x70, 0xF0, 0x1F, 0x76, 0x0F, 0x02, 0xF7, 0x0B, 0xF7, 0x0F,
+  0x00, 0x6F, 0x69, 0x0F, 0x03, 0xF7, 0x0B, 0xF7, 0x0F, 0x9F, 0x66, 0x0F,
+  0x04, 0xF7, 0x0B, 0xF7, 0x0E, 0x6F, 0x70, 0xF0, 0x5F, 0x70, 0xBF, 0x70,
+  0xD9, 0xF8, 0x0F, 0x05, 0xF7, 0x0A, 0x6F, 0x70, 0xDF, 0x89, 0x0F, 0x05,
+  0xF7, 0x09, 0x9F, 0x80, 0xDF, 0x76, 0x0F, 0x06, 0x9F, 0x66, 0x08, 0xF8,
+  0x90, 0xC6, 0xF6, 0x90, 0xF0, 0x86, 0xF6, 0x90, 0x7F, 0x76, 0x0C, 0x9F,
+  0x66, 0x0F, 0x0A, 0xF7, 0x60, 0x56, 0xF6, 0x90, 0xC6, 0xF6, 0x90, 0xF0,
+  0xBF, 0xFF, 0x56, 0x0C, 0x9F, 0x66, 0x0F, 0x0C, 0x9F, 0xFF, 0x40, 0xDF,
+  0x70, 0xF0, 0xE6, 0xFF, 0xF3, 0x0D, 0xF7, 0x0F, 0x0F, 0x9F, 0xFF, 0x19,
+  0x0C, 0x6F, 0x69, 0x0F, 0x0F, 0x02, 0x6F, 0xB6, 0x0E, 0x9F, 0x66, 0x0F,
+  0x0F, 0x04, 0x9F, 0x99, 0x0E, 0x6F, 0x69, 0x0F, 0x0F, 0x0F, 0x0F, 0x9F,
+  0x66, 0x0F, 0x0F, 0x0F, 0x0F, 0x6F, 0x70, 0xF0, 0xF0, 0xF0, 0xF9, 0xF8,
+  0x0F, 0x0F, 0x0F, 0x0F, 0xF8, 0x90, 0xF0, 0xF0, 0xF0, 0xFF, 0x76, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x6F, 0x69, 0x0F, 0x0F, 0x0F, 0x0F, 0x9F, 0x66, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x6F, 0x70, 0xF0, 0xF0, 0xF0, 0xF9, 0xF8, 0x0F, 0x9F,
+  0x99, 0x0F, 0x0F, 0x03, 0xF8, 0x90, 0xE6, 0xFB, 0x60, 0xF0, 0xF0, 0x2F,
+  0x76, 0x0C, 0x9F, 0xF9, 0x0F, 0x0F, 0x00, 0x6F, 0x69, 0x0C, 0x6F, 0xFF,
+  0x16, 0x0F, 0x0E, 0x9F, 0x66, 0x0C, 0x9F, 0xFF, 0x39, 0x0F, 0x0C, 0x6F,
+  0x70, 0xDF, 0xFF, 0x56, 0x0F, 0x0A, 0x9F, 0x80, 0xDF, 0x76, 0x05, 0x6F,
+  0x69, 0x0F, 0x09, 0xF8, 0x90, 0xC6, 0xF6, 0x90, 0x7F, 0x70, 0xF0, 0x9F,
+  0x76, 0x0C, 0x9F, 0x66, 0x08, 0xF7, 0x0F, 0x08, 0x6F, 0x69, 0x0D, 0xF7,
+  0x09, 0x9F, 0x66, 0x0F, 0x06, 0x9F, 0x66, 0x0E, 0xF7, 0x0A, 0x6F, 0x69,
+  0x0F, 0x04, 0x6F, 0x69, 0x0F, 0xF7, 0x0B, 0xF7, 0x0F, 0x03, 0x9F, 0x66,
+  0x0F, 0x00, 0xF7, 0x0B, 0xF7, 0x0F, 0x03, 0xF7, 0x0F, 0x01, 0xF7, 0x0B,
+  0xF7, 0x0F, 0x03, 0xF7, 0x0F, 0x01, 0xF7, 0x0B, 0xF7, 0x0F, 0x02, 0x6F,
+  0x69, 0x0F, 0x01, 0xF7, 0x0B, 0xF7, 0x0F, 0x01, 0x9F, 0x66, 0x0F, 0x02,
+  0xF7, 0x0B, 0xF7, 0x0F, 0x00, 0x6F, 0x69, 0x0F, 0x03, 0xF7, 0x0B, 0xF7,
+  0x0F, 0x9F, 0x66, 0x0F, 0x04, 0xF7, 0x0B, 0xF7, 0x0E, 0x6F, 0x70, 0xF0,
+  0x5F, 0x70, 0xA6, 0xF7, 0x0D, 0x9F, 0x80, 0xF0, 0x5F, 0x70, 0x99, 0xF8,
+  0x0D, 0xF8, 0x90, 0xF0, 0x5F, 0x76, 0x08, 0xF8, 0x90, 0xDF, 0x76, 0x0F,
+  0x06, 0xF8, 0x90, 0x7F, 0x76, 0x0D, 0x6F, 0x69, 0x0F, 0x07, 0x9F, 0x86,
+  0x05, 0x6F, 0x70, 0xD9, 0xF6, 0x60, 0xF0, 0x96, 0xFF, 0xF7, 0x0C, 0x6F,
+  0x70, 0xF0, 0xB9, 0xFF, 0xF5, 0x90, 0xB9, 0xF8, 0x0F, 0x0C, 0x6F, 0xFF,
+  0x36, 0x0B, 0x6F, 0x89, 0x0F, 0x0D, 0x9F, 0xFF, 0x19, 0x0B, 0x9F, 0x86,
+  0x0F, 0x0F, 0x6F, 0xF6, 0x0C, 0x9F, 0x79, 0x0F, 0x0F, 0x01, 0x9F, 0xD9,
+  0x0F, 0x0F, 0x0F, 0x0E, 0x6F, 0x36, 0x0F, 0x0F, 0x0F, 0x0F, 0x04, 0x9F,
+  0x19, 0x0B, 0x9F, 0xFF, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x9F, 0xFF, 0xB9, 0x01, 0x9F, 0x59, 0x04,
+  0x6F, 0x76, 0x02, 0x9F, 0x99, 0x01, 0xFB, 0x01, 0xFB, 0x01, 0xFB, 0x60,
+  0x0F, 0xC9, 0xFC, 0x9F, 0xB6, 0x00, 0xFB, 0x01, 0xFB, 0x01, 0x9F, 0x99,
+  0x02, 0x6F, 0x76, 0x04, 0x9F, 0x59, 0x03, 0x0F, 0x05, 0x9F, 0x59, 0x0F,
+  0x05, 0xF7, 0x0F, 0x05, 0xF7, 0x0F, 0x04, 0x6F, 0x70, 0xF0, 0x39, 0xF8,
+  0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF8, 0x90, 0xF0, 0x3F,
+  0x76, 0x0F, 0x03, 0x6F, 0x70, 0xF0, 0x39, 0xF8, 0x0F, 0x03, 0xF9, 0x0F,
+  0x03, 0xF9, 0x0F, 0x03, 0xF8, 0x90, 0xF0, 0x3F, 0x76, 0x0F, 0x04, 0xF7,
+  0x0F, 0x05, 0xF7, 0x0F, 0x04, 0x6F, 0x70, 0xF0, 0x39, 0xF8, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF8, 0x90, 0xF0, 0x3F, 0x76, 0x0F,
+  0x04, 0xF7, 0x0F, 0x05, 0xF7, 0x0F, 0x04, 0x6F, 0x70, 0xF0, 0x39, 0xF8,
+  0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF8, 0x90, 0xF0, 0x3F,
+  0x76, 0x0F, 0x03, 0x6F, 0x70, 0xF0, 0x39, 0xF8, 0x0F, 0x03, 0xF9, 0x0F,
+  0x03, 0xF9, 0x0F, 0x03, 0xF8, 0x90, 0xF0, 0x3F, 0x76, 0x0F, 0x04, 0xF7,
+  0x0F, 0x05, 0xF7, 0x0F, 0x04, 0x6F, 0x70, 0xF0, 0x39, 0xF8, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF8, 0x90, 0xF0, 0x3F, 0x76, 0x0F,
+  0x04, 0xF7, 0x0F, 0x05, 0xF7, 0x0F, 0x04, 0x6F, 0x70, 0xF0, 0x39, 0xF8,
+  0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF8, 0x90, 0xF0, 0x3F,
+  0x76, 0x0F, 0x04, 0xF7, 0x0F, 0x05, 0xF7, 0x0F, 0x04, 0x6F, 0x70, 0xF0,
+  0x39, 0xF8, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF8, 0x90,
+  0xF0, 0x3F, 0x76, 0x0F, 0x03, 0x6F, 0x70, 0xF0, 0x39, 0xF8, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF8, 0x90, 0xF0, 0x3F, 0x76, 0x0F,
+  0x04, 0xF7, 0x0F, 0x05, 0xF7, 0x0F, 0x04, 0x6F, 0x70, 0xF0, 0x39, 0xF8,
+  0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF8, 0x90, 0xF0, 0x3F,
+  0x76, 0x0F, 0x04, 0xF7, 0x0F, 0x05, 0xF7, 0x0F, 0x04, 0x6F, 0x70, 0xF0,
+  0x39, 0xF8, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0x9F, 0x79,
+  0x0F, 0x03, 0x0F, 0x9F, 0xD9, 0x0F, 0x0F, 0x00, 0x6F, 0xF6, 0x0F, 0x0C,
+  0x9F, 0xFF, 0x59, 0x0F, 0x08, 0x6F, 0xFF, 0x76, 0x0F, 0x06, 0x9F, 0xFF,
+  0xB9, 0x0F, 0x02, 0x6F, 0xFF, 0xD6, 0x0F, 0x00, 0x9F, 0xFF, 0xF9, 0x0E,
+  0x6F, 0xFF, 0xFF, 0x10, 0xD9, 0xFC, 0x60, 0x56, 0xFD, 0x0C, 0x6F, 0xC9,
+  0x07, 0x9F, 0xC6, 0x0A, 0x9F, 0xC6, 0x0B, 0x6F, 0xA9, 0x09, 0xFC, 0x90,
+  0xD9, 0xFA, 0x60, 0x8F, 0x96, 0x0F, 0x01, 0x6F, 0xA9, 0x06, 0x6F, 0x90,
+  0xF0, 0x39, 0xFA, 0x05, 0x9F, 0xA0, 0xF0, 0x46, 0xF9, 0x05, 0xFA, 0x90,
+  0xF0, 0x5F, 0x90, 0x5F, 0x96, 0x0F, 0x06, 0xF9, 0x05, 0xF9, 0x0F, 0x07,
+  0xF9, 0x60, 0x4F, 0x90, 0xF0, 0x7F, 0xA9, 0x02, 0x6F, 0x89, 0x0F, 0x07,
+  0x9F, 0xA0, 0x19, 0xF8, 0x60, 0xF0, 0x96, 0xF9, 0x01, 0xF9, 0x0F, 0x0B,
+  0xF9, 0x01, 0xF9, 0x0F, 0x0B, 0xF9, 0x01, 0xF9, 0x0F, 0x0B, 0xF9, 0x01,
+  0xF9, 0x0F, 0x0B, 0xF9, 0x01, 0xF9, 0x0F, 0x0B, 0xF9, 0x60, 0x0F, 0x90,
+  0xF0, 0xBF, 0xA9, 0xF9, 0x0F, 0x0B, 0xFF, 0xF5, 0x0F, 0x0B, 0xFF, 0xF5,
+  0x0F, 0x0B, 0x9F, 0xFF, 0x40, 0xF0, 0xC6, 0xFF, 0xF3, 0x0F, 0x0D, 0xFF,
+  0xF3, 0x0F, 0x0D, 0xFF, 0xF3, 0x0F, 0x0D, 0xFF, 0xF3, 0x0F, 0x0D, 0xFF,
+  0xF3, 0x0F, 0x0D, 0xFF, 0xF3, 0x0F, 0x0D, 0xFF, 0xF3, 0x0F, 0x0C, 0x6F,
+  0xFF, 0x30, 0xF0, 0xB9, 0xFF, 0xF4, 0x0F, 0x0B, 0xFF, 0xF5, 0x0F, 0x0B,
+  0xFF, 0xF5, 0x0F, 0x0B, 0xFA, 0x9F, 0x90, 0xF0, 0xBF, 0x96, 0x00, 0xF9,
+  0x0F, 0x0B, 0xF9, 0x01, 0xF9, 0x0F, 0x0B, 0xF9, 0x01, 0xF9, 0x0F, 0x0B,
+  0xF9, 0x01, 0xF9, 0x0F, 0x0B, 0xF9, 0x01, 0xF9, 0x60, 0xF0, 0x96, 0xF9,
+  0x01, 0xFA, 0x90, 0xF0, 0x79, 0xFA, 0x01, 0x9F, 0xA0, 0xF0, 0x7F, 0xB0,
+  0x26, 0xF9, 0x0F, 0x07, 0xFB, 0x03, 0xF9, 0x60, 0xF0, 0x6F, 0xA9, 0x03,
+  0xFA, 0x90, 0xF0, 0x5F, 0x96, 0x04, 0x9F, 0xA0, 0xF0, 0x46, 0xF9, 0x06,
+  0x6F, 0x90, 0xF0, 0x39, 0xFA, 0x07, 0xF9, 0x60, 0xF0, 0x16, 0xFA, 0x90,
+  0x7F, 0xA9, 0x0F, 0x9F, 0xA6, 0x08, 0x9F, 0xA6, 0x0D, 0x6F, 0xB0, 0xA6,
+  0xFC, 0x90, 0x79, 0xFE, 0x0B, 0x9F, 0xC6, 0x05, 0x6F, 0xE9, 0x0C, 0x6F,
+  0xFF, 0xFF, 0x16, 0x0E, 0x9F, 0xFF, 0xF9, 0x0F, 0x00, 0x6F, 0xFF, 0xD6,
+  0x0F, 0x02, 0x9F, 0xFF, 0xB9, 0x0F, 0x04, 0x6F, 0xFF, 0x76, 0x0F, 0x08,
+  0x9F, 0xFF, 0x59, 0x0F, 0x0C, 0x6F, 0xF6, 0x0F, 0x0F, 0x00, 0x9F, 0xD9,
+  0x0F, 0x01, 0x0D, 0x9F, 0xB9, 0x0C, 0x6F, 0xD0, 0xB9, 0xFE, 0x0A, 0x6F,
+  0xF0, 0x79, 0xFF, 0xF2, 0x06, 0x6F, 0xFF, 0x30, 0x59, 0xFF, 0xF4, 0x04,
+  0x6F, 0xFF, 0x50, 0x39, 0xFF, 0xF6, 0x02, 0x6F, 0xFF, 0x79, 0xFE, 0x66,
+  0xFF, 0xF8, 0x90, 0x1F, 0xFF, 0x56, 0x04, 0xFF, 0xF4, 0x90, 0x5F, 0xFF,
+  0x36, 0x06, 0xFF, 0xF2, 0x90, 0x7F, 0xF6, 0x0A, 0xFE, 0x90, 0xBF, 0xD6,
+  0x0C, 0xFC, 0x90, 0xDF, 0xB6, 0x0E, 0xF9, 0x99, 0x0F, 0xF9, 0x0F, 0x01,
+  0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01,
+  0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01,
+  0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01,
+  0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01,
+  0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01,
+  0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01,
+  0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01,
+  0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01,
+  0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01,
+  0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01,
+  0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01, 0xF9, 0x0F, 0x01,
+  0xF9, 0x0F, 0x01, 0x9F, 0x79, 0x0F, 0x9F, 0xB9, 0x0F, 0x0E, 0x6F, 0xD6,
+  0x0F, 0x08, 0x9F, 0xFF, 0x79, 0x0F, 0x02, 0x6F, 0xFF, 0x96, 0x0F, 0x00,
+  0x9F, 0xFF, 0xB9, 0x0E, 0x6F, 0xFF, 0xD6, 0x0C, 0x9F, 0xFF, 0xF9, 0x0A,
+  0x6F, 0xFF, 0xFF, 0x16, 0x08, 0x9F, 0xC6, 0x05, 0x6F, 0xE9, 0x06, 0x6F,
+  0xC9, 0x07, 0x9F, 0xE0, 0x59, 0xFA, 0x60, 0xD6, 0xFB, 0x05, 0xFA, 0x90,
+  0xF9, 0xFA, 0x60, 0x4F, 0x96, 0x0F, 0x01, 0x6F, 0xA9, 0x03, 0xF9, 0x0F,
+  0x03, 0x9F, 0xA0, 0x3F, 0x90, 0xF0, 0x46, 0xF9, 0x02, 0x6F, 0x89, 0x0F,
+  0x05, 0xF9, 0x01, 0x9F, 0x86, 0x0F, 0x06, 0xF9, 0x01, 0xF9, 0x0F, 0x07,
+  0xF9, 0x01, 0xF9, 0x0F, 0x07, 0xF9, 0x01, 0x9F, 0x79, 0x0F, 0x07, 0xF9,
+  0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9,
+  0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x02, 0x6F,
+  0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F, 0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0,
+  0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F, 0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F,
+  0x0F, 0x00, 0x6F, 0xA9, 0x0F, 0x0F, 0x9F, 0xA6, 0x0F, 0x0F, 0x6F, 0xA9,
+  0x0F, 0x0F, 0x9F, 0xA6, 0x0F, 0x0F, 0x6F, 0xA9, 0x0F, 0x0F, 0x9F, 0xA6,
+  0x0F, 0x0F, 0x6F, 0xA9, 0x0F, 0x0F, 0x9F, 0xA6, 0x0F, 0x0F, 0x6F, 0xB0,
+  0xF0, 0xF9, 0xFC, 0x0F, 0x0E, 0x6F, 0xC9, 0x0F, 0x0D, 0x9F, 0xA6, 0x0F,
+  0x0F, 0x6F, 0xB0, 0xF0, 0xF9, 0xFC, 0x0F, 0x0E, 0x6F, 0xC9, 0x0F, 0x0D,
+  0x9F, 0xC6, 0x0F, 0x0D, 0x6F, 0xC9, 0x0F, 0x0D, 0x9F, 0xC6, 0x0F, 0x0D,
+  0x6F, 0xC9, 0x0F, 0x0D, 0x9F, 0xC6, 0x0F, 0x0D, 0x6F, 0xC9, 0x0F, 0x0D,
+  0x9F, 0xC6, 0x0F, 0x0D, 0x6F, 0xC9, 0x0F, 0x0D, 0x9F, 0xC6, 0x0F, 0x0D,
+  0x6F, 0xC9, 0x0F, 0x0D, 0x9F, 0xC6, 0x0F, 0x0D, 0x6F, 0xC9, 0x0F, 0x0D,
+  0x9F, 0xC6, 0x0F, 0x0D, 0x6F, 0xD6, 0x0F, 0x0C, 0x9F, 0xFF, 0xFF, 0xB9,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x9F, 0xFF, 0xFF, 0xB9, 0x0F, 0x9F,
+  0xD9, 0x0F, 0x0E, 0x6F, 0xF6, 0x0F, 0x08, 0x9F, 0xFF, 0x79, 0x0F, 0x04,
+  0x6F, 0xFF, 0x96, 0x0F, 0x02, 0x9F, 0xFF, 0xD9, 0x0E, 0x6F, 0xFF, 0xF6,
+  0x0C, 0x9F, 0xFF, 0xFF, 0x19, 0x0A, 0x6F, 0xFF, 0xFF, 0x30, 0x99, 0xFE,
+  0x60, 0x56, 0xFD, 0x08, 0x6F, 0xE9, 0x07, 0x9F, 0xC6, 0x06, 0x9F, 0xA6,
+  0x0F, 0x6F, 0xA9, 0x05, 0xFA, 0x90, 0xF0, 0x19, 0xFA, 0x05, 0xF9, 0x60,
+  0xF0, 0x36, 0xF9, 0x05, 0xF9, 0x0F, 0x05, 0xF9, 0x60, 0x4F, 0x90, 0xF0,
+  0x5F, 0xA9, 0x02, 0x6F, 0x89, 0x0F, 0x05, 0xFB, 0x01, 0x9F, 0x86, 0x0F,
+  0x06, 0xFB, 0x01, 0x9F, 0x79, 0x0F, 0x07, 0x9F, 0xA0, 0xF0, 0xF0, 0x46,
+  0xF9, 0x0F, 0x0F, 0x04, 0x6F, 0x89, 0x0F, 0x0F, 0x03, 0x9F, 0x86, 0x0F,
+  0x0F, 0x04, 0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x04, 0x6F, 0x90,
+  0xF0, 0xF0, 0x39, 0xFA, 0x0F, 0x0F, 0x02, 0x6F, 0xA9, 0x0F, 0x0F, 0x9F,
+  0xC6, 0x0F, 0x0F, 0x6F, 0xC9, 0x0F, 0x05, 0x9F, 0xFF, 0x66, 0x0F, 0x06,
+  0xFF, 0xF6, 0x90, 0xF0, 0x7F, 0xFF, 0x36, 0x0F, 0x0A, 0xFF, 0xF3, 0x0F,
+  0x0B, 0xFF, 0xF3, 0x0F, 0x0B, 0xFF, 0xF3, 0x60, 0xF0, 0xAF, 0xFF, 0x89,
+  0x0F, 0x05, 0x9F, 0xFF, 0x86, 0x0F, 0x0D, 0x6F, 0xFF, 0x09, 0x0F, 0x0D,
+  0x9F, 0xFF, 0x06, 0x0F, 0x0F, 0x01, 0x6F, 0xC9, 0x0F, 0x0F, 0x01, 0x9F,
+  0xC0, 0xF0, 0xF0, 0x26, 0xFB, 0x0F, 0x0F, 0x03, 0x9F, 0xA0, 0xF0, 0xF0,
+  0x46, 0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x60, 0xF0, 0xF0, 0x4F, 0xA9, 0x0F,
+  0x0F, 0x03, 0x9F, 0xA0, 0xF0, 0xF0, 0x46, 0xF9, 0x0F, 0x0F, 0x05, 0xF9,
+  0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x04, 0x6F, 0x99, 0xF7, 0x90, 0xF0,
+  0x99, 0xFF, 0xF4, 0x0F, 0x09, 0xFF, 0xF5, 0x0F, 0x09, 0xFF, 0xF5, 0x60,
+  0xF0, 0x76, 0xFA, 0x9F, 0xA9, 0x0F, 0x05, 0x9F, 0xA6, 0x00, 0x9F, 0xA6,
+  0x0F, 0x03, 0x6F, 0xB0, 0x26, 0xFA, 0x90, 0xF0, 0x19, 0xFC, 0x03, 0xFB,
+  0x60, 0xF6, 0xFC, 0x90, 0x3F, 0xFF, 0x09, 0x07, 0x9F, 0xE6, 0x04, 0x9F,
+  0xFF, 0x06, 0x05, 0x6F, 0xE9, 0x06, 0x6F, 0xFF, 0xFF, 0x56, 0x08, 0x9F,
+  0xFF, 0xFF, 0x39, 0x0A, 0x6F, 0xFF, 0xFF, 0x16, 0x0C, 0x9F, 0xFF, 0xF9,
+  0x0F, 0x00, 0x6F, 0xFF, 0xB6, 0x0F, 0x02, 0x9F, 0xFF, 0x99, 0x0F, 0x06,
+  0x6F, 0xFF, 0x16, 0x0F, 0x0C, 0x9F, 0xF9, 0x0F, 0x0F, 0x0B, 0x9F, 0xB9,
+  0x0F, 0x0F, 0x02, 0x6F, 0xD0, 0xF0, 0xF0, 0x19, 0xFE, 0x0F, 0x0F, 0x01,
+  0xFF, 0x0F, 0x0F, 0x01, 0xFF, 0x0F, 0x0F, 0x00, 0x6F, 0xF0, 0xF0, 0xF9,
+  0xFF, 0xF0, 0x0F, 0x0E, 0x6F, 0xFF, 0x10, 0xF0, 0xD9, 0xFF, 0xF2, 0x0F,
+  0x0D, 0xFF, 0xF3, 0x0F, 0x0D, 0xFF, 0xF3, 0x0F, 0x0C, 0x6F, 0xFF, 0x30,
+  0xF0, 0xB9, 0xFF, 0xF4, 0x0F, 0x0B, 0xFF, 0xF5, 0x0F, 0x0B, 0xF9, 0x66,
+  0xF9, 0x0F, 0x0A, 0x6F, 0x89, 0x01, 0xF9, 0x0F, 0x09, 0x9F, 0x86, 0x02,
+  0xF9, 0x0F, 0x08, 0x6F, 0x90, 0x3F, 0x90, 0xF0, 0x79, 0xFA, 0x03, 0xF9,
+  0x0F, 0x07, 0xFA, 0x90, 0x3F, 0x90, 0xF0, 0x7F, 0x96, 0x04, 0xF9, 0x0F,
+  0x06, 0x6F, 0x89, 0x05, 0xF9, 0x0F, 0x05, 0x9F, 0x86, 0x06, 0xF9, 0x0F,
+  0x04, 0x6F, 0x90, 0x7F, 0x90, 0xF0, 0x39, 0xFA, 0x07, 0xF9, 0x0F, 0x03,
+  0xFA, 0x90, 0x7F, 0x90, 0xF0, 0x3F, 0x96, 0x08, 0xF9, 0x0F, 0x02, 0x6F,
+  0x89, 0x09, 0xF9, 0x0F, 0x01, 0x9F, 0x86, 0x0A, 0xF9, 0x0F, 0x01, 0xF9,
+  0x0B, 0xF9, 0x0F, 0x01, 0xF9, 0x0B, 0xF9, 0x0F, 0x00, 0x6F, 0x89, 0x0B,
+  0xF9, 0x0F, 0x9F, 0x86, 0x0C, 0xF9, 0x0E, 0x6F, 0x90, 0xDF, 0x90, 0xD9,
+  0xFA, 0x0D, 0xF9, 0x0D, 0xFA, 0x90, 0xDF, 0x90, 0xDF, 0x96, 0x0E, 0xF9,
+  0x0C, 0x6F, 0x89, 0x0F, 0xF9, 0x0B, 0x9F, 0x86, 0x0F, 0x00, 0xF9, 0x0A,
+  0x6F, 0x90, 0xF0, 0x1F, 0x90, 0x99, 0xFA, 0x0F, 0x01, 0xF9, 0x09, 0xFA,
+  0x90, 0xF0, 0x1F, 0x90, 0x9F, 0x96, 0x0F, 0x02, 0xF9, 0x08, 0x6F, 0x89,
+  0x0F, 0x03, 0xF9, 0x07, 0x9F, 0x86, 0x0F, 0x04, 0xF9, 0x07, 0xF9, 0x60,
+  0xF0, 0x36, 0xF9, 0x60, 0x6F, 0xFF, 0xFF, 0xFF, 0x09, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFB, 0x9F, 0xFF, 0xFF, 0xF9, 0x0F, 0x0E, 0x6F, 0x96,
+  0x0F, 0x0F, 0x06, 0xF9, 0x0F, 0x0F, 0x07, 0xF9, 0x0F, 0x0F, 0x07, 0xF9,
+  0x0F, 0x0F, 0x07, 0xF9, 0x0F, 0x0F, 0x07, 0xF9, 0x0F, 0x0F, 0x07, 0xF9,
+  0x0F, 0x0F, 0x07, 0xF9, 0x0F, 0x0F, 0x07, 0xF9, 0x0F, 0x0F, 0x07, 0xF9,
+  0x0F, 0x0F, 0x07, 0xF9, 0x0F, 0x0F, 0x07, 0xF9, 0x0F, 0x0F, 0x07, 0xF9,
+  0x0F, 0x0F, 0x07, 0x9F, 0x79, 0x07, 0x05, 0x9F, 0xFF, 0xFF, 0x39, 0x07,
+  0xFF, 0xFF, 0xF5, 0x07, 0xFF, 0xFF, 0xF5, 0x07, 0xFF, 0xFF, 0xF5, 0x07,
+  0xFF, 0xFF, 0xF5, 0x06, 0x6F, 0xFF, 0xFF, 0x50, 0x59, 0xFF, 0xFF, 0xF6,
+  0x05, 0xFF, 0xFF, 0xF6, 0x90, 0x5F, 0x96, 0x0F, 0x0F, 0x02, 0xF9, 0x0F,
+  0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F,
+  0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F,
+  0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F,
+  0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF8, 0x90,
+  0xF0, 0xF0, 0x3F, 0x76, 0x04, 0x9F, 0xB9, 0x0F, 0x00, 0x6F, 0x70, 0x46,
+  0xFD, 0x60, 0xE9, 0xF8, 0x01, 0x9F, 0xFF, 0x39, 0x0B, 0xF9, 0x66, 0xFF,
+  0xF5, 0x60, 0xAF, 0xFF, 0xFF, 0x49, 0x07, 0xFF, 0xFF, 0xF5, 0x60, 0x6F,
+  0xFF, 0xFF, 0x69, 0x05, 0xFF, 0xFF, 0xF7, 0x05, 0xFF, 0xF1, 0x60, 0x36,
+  0xFF, 0x05, 0xFF, 0xF0, 0x90, 0x59, 0xFE, 0x60, 0x4F, 0xB6, 0x0D, 0x6F,
+  0xC9, 0x03, 0x9F, 0x99, 0x0F, 0x9F, 0xC6, 0x0F, 0x0F, 0x01, 0x6F, 0xA9,
+  0x0F, 0x0F, 0x01, 0xFB, 0x0F, 0x0F, 0x01, 0xFB, 0x0F, 0x0F, 0x01, 0x9F,
+  0xA0, 0xF0, 0xF0, 0x26, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03,
+  0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03,
+  0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03,
+  0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03,
+  0xF9, 0x9F, 0x99, 0x0F, 0x07, 0xF9, 0x9F, 0xA0, 0xF0, 0x66, 0xF9, 0x00,
+  0x6F, 0x90, 0xF0, 0x59, 0xFA, 0x01, 0xF9, 0x60, 0xF0, 0x4F, 0xA9, 0x01,
+  0xFA, 0x90, 0xF0, 0x3F, 0x96, 0x02, 0xFB, 0x60, 0xF0, 0x16, 0xF9, 0x03,
+  0xFC, 0x90, 0xF9, 0xFA, 0x03, 0x9F, 0xC6, 0x0D, 0x6F, 0xA9, 0x04, 0x6F,
+  0xE9, 0x05, 0x9F, 0xE6, 0x06, 0x9F, 0xE6, 0x03, 0x6F, 0xE9, 0x08, 0x6F,
+  0xFF, 0xFF, 0x16, 0x0A, 0x9F, 0xFF, 0xF9, 0x0C, 0x6F, 0xFF, 0xD6, 0x0E,
+  0x9F, 0xFF, 0xB9, 0x0F, 0x00, 0x6F, 0xFF, 0x96, 0x0F, 0x02, 0x9F, 0xFF,
+  0x79, 0x0F, 0x08, 0x6F, 0xD6, 0x0F, 0x0E, 0x9F, 0xB9, 0x0F, 0x0F, 0x01,
+  0x9F, 0xB9, 0x0F, 0x0F, 0x00, 0x6F, 0xD6, 0x0F, 0x0C, 0x9F, 0xFF, 0x59,
+  0x0F, 0x06, 0x6F, 0xFF, 0x76, 0x0F, 0x02, 0x9F, 0xFF, 0xB9, 0x0F, 0x00,
+  0x6F, 0xFF, 0xD6, 0x0E, 0x9F, 0xFF, 0xF9, 0x0C, 0x6F, 0xFF, 0xFF, 0x16,
+  0x0A, 0x9F, 0xE6, 0x05, 0x6F, 0xC9, 0x09, 0xFE, 0x90, 0x79, 0xFC, 0x60,
+  0x8F, 0x96, 0x0F, 0x6F, 0xA9, 0x06, 0x6F, 0x89, 0x0F, 0x01, 0x9F, 0xA0,
+  0x59, 0xF8, 0x60, 0xF0, 0x36, 0xF9, 0x04, 0x6F, 0x90, 0xF0, 0x5F, 0x96,
+  0x02, 0x9F, 0xA0, 0xF0, 0x5F, 0xA9, 0x01, 0xFA, 0x90, 0xF0, 0x59, 0xF9,
+  0x90, 0x1F, 0x96, 0x0F, 0x0F, 0x04, 0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x0F,
+  0x0F, 0x04, 0x6F, 0x89, 0x0F, 0x0F, 0x03, 0x9F, 0x86, 0x0F, 0x0F, 0x04,
+  0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x09, 0x9F, 0xB9, 0x0D, 0xF9, 0x08, 0x6F,
+  0xD6, 0x0C, 0xF9, 0x05, 0x9F, 0xFF, 0x39, 0x09, 0xF9, 0x04, 0x6F, 0xFF,
+  0x56, 0x08, 0xF9, 0x03, 0x9F, 0xFF, 0x79, 0x07, 0xF9, 0x02, 0x6F, 0xFF,
+  0x96, 0x06, 0xF9, 0x01, 0x9F, 0xFF, 0xB9, 0x05, 0xF9, 0x66, 0xFF, 0xFD,
+  0x60, 0x4F, 0xFF, 0x56, 0x03, 0x6F, 0xE9, 0x03, 0xFF, 0xF4, 0x90, 0x59,
+  0xFE, 0x60, 0x2F, 0xF6, 0x0D, 0x6F, 0xC9, 0x01, 0xFE, 0x90, 0xF9, 0xFC,
+  0x01, 0xFD, 0x60, 0xF0, 0x16, 0xFB, 0x01, 0xFC, 0x90, 0xF0, 0x39, 0xFA,
+  0x01, 0xFB, 0x60, 0xF0, 0x56, 0xF9, 0x01, 0xFB, 0x0F, 0x07, 0xF9, 0x60,
+  0x0F, 0xB0, 0xF0, 0x7F, 0xA9, 0xFB, 0x0F, 0x07, 0x9F, 0xFF, 0x60, 0xF0,
+  0x86, 0xFF, 0xF4, 0x90, 0xF0, 0x9F, 0xFF, 0x36, 0x0F, 0x0A, 0xFF, 0xF3,
+  0x0F, 0x0B, 0xFF, 0xF3, 0x0F, 0x0B, 0xFF, 0xF3, 0x0F, 0x0B, 0xFF, 0xF3,
+  0x0F, 0x0B, 0xFF, 0xF3, 0x60, 0xF0, 0xAF, 0xFF, 0x49, 0x0F, 0x09, 0xF9,
+  0x9F, 0xA0, 0xF0, 0x86, 0xF9, 0x00, 0x6F, 0x90, 0xF0, 0x79, 0xFA, 0x01,
+  0xF9, 0x0F, 0x07, 0xFA, 0x90, 0x1F, 0x90, 0xF0, 0x7F, 0x96, 0x02, 0xF9,
+  0x60, 0xF0, 0x56, 0xF9, 0x03, 0xFA, 0x90, 0xF0, 0x39, 0xFA, 0x03, 0x9F,
+  0xA6, 0x0F, 0x01, 0x6F, 0xA9, 0x04, 0x6F, 0xA9, 0x0F, 0x9F, 0xA6, 0x06,
+  0x9F, 0xA6, 0x0D, 0x6F, 0xB0, 0x86, 0xFC, 0x90, 0x79, 0xFE, 0x09, 0xFD,
+  0x60, 0x56, 0xFE, 0x90, 0x9F, 0xFF, 0xFF, 0x36, 0x0A, 0x9F, 0xFF, 0xFF,
+  0x19, 0x0E, 0x6F, 0xFF, 0xD6, 0x0F, 0x00, 0x9F, 0xFF, 0xB9, 0x0F, 0x02,
+  0x6F, 0xFF, 0x76, 0x0F, 0x06, 0x9F, 0xFF, 0x59, 0x0F, 0x0A, 0x6F, 0xF6,
+  0x0F, 0x0E, 0x9F, 0xD9, 0x0F, 0x9F, 0xFF, 0xFF, 0xB9, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF3, 0x9F, 0xFF, 0xFF, 0xC0, 0xF0, 0xF0, 0x06, 0xFB, 0x0F,
+  0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0, 0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F,
+  0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F, 0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0,
+  0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F, 0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F,
+  0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0, 0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F,
+  0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F, 0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0,
+  0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F, 0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F,
+  0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0, 0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F,
+  0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F, 0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0,
+  0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F, 0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F,
+  0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0, 0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F,
+  0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F, 0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0,
+  0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F, 0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F,
+  0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0, 0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F,
+  0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F, 0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0,
+  0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F, 0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F,
+  0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0, 0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F,
+  0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F, 0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0,
+  0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F, 0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F,
+  0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0, 0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F,
+  0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F, 0x0F, 0x01, 0xFA, 0x90, 0xF0, 0xF0,
+  0x1F, 0x96, 0x0F, 0x0F, 0x01, 0x6F, 0x90, 0xF0, 0xF0, 0x19, 0xFA, 0x0F,
+  0x0F, 0x00, 0x6F, 0xA9, 0x0F, 0x0F, 0x9F, 0xA6, 0x0F, 0x0F, 0x00, 0x9F,
+  0x99, 0x0F, 0x0D, 0x0F, 0x9F, 0xD9, 0x0F, 0x0E, 0x6F, 0xF6, 0x0F, 0x08,
+  0x9F, 0xFF, 0x79, 0x0F, 0x04, 0x6F, 0xFF, 0x96, 0x0F, 0x02, 0x9F, 0xFF,
+  0xD9, 0x0E, 0x6F, 0xFF, 0xF6, 0x0C, 0x9F, 0xFF, 0xFF, 0x19, 0x0A, 0x6F,
+  0xFF, 0xFF, 0x36, 0x08, 0x9F, 0xE6, 0x05, 0x6F, 0xE9, 0x06, 0x6F, 0xE9,
+  0x07, 0x9F, 0xE0, 0x59, 0xFC, 0x60, 0xD6, 0xFB, 0x05, 0xFC, 0x90, 0xF9,
+  0xFA, 0x05, 0xFB, 0x60, 0xF0, 0x16, 0xF9, 0x05, 0xFA, 0x90, 0xF0, 0x3F,
+  0x96, 0x04, 0xF9, 0x60, 0xF0, 0x4F, 0xA9, 0x03, 0xF9, 0x0F, 0x05, 0x9F,
+  0xA0, 0x3F, 0x90, 0xF0, 0x66, 0xF9, 0x03, 0xF9, 0x0F, 0x07, 0xF9, 0x03,
+  0xF9, 0x0F, 0x07, 0xF9, 0x03, 0xF9, 0x0F, 0x06, 0x6F, 0x89, 0x03, 0xF9,
+  0x0F, 0x05, 0x9F, 0x86, 0x04, 0xF9, 0x60, 0xF0, 0x4F, 0x90, 0x5F, 0xA9,
+  0x0F, 0x03, 0xF9, 0x05, 0x9F, 0xA6, 0x0F, 0x01, 0x6F, 0x90, 0x66, 0xFA,
+  0x90, 0xF9, 0xFA, 0x07, 0x9F, 0xA6, 0x0D, 0x6F, 0xA9, 0x08, 0x6F, 0xC9,
+  0x07, 0x9F, 0xC6, 0x0A, 0x9F, 0xC6, 0x05, 0x6F, 0xC9, 0x0C, 0x6F, 0xFF,
+  0xF6, 0x0E, 0x9F, 0xFF, 0xD9, 0x0F, 0x02, 0x6F, 0xFF, 0x56, 0x0F, 0x07,
+  0x6F, 0xFF, 0x56, 0x0F, 0x04, 0x9F, 0xFF, 0xB9, 0x0F, 0x00, 0x6F, 0xFF,
+  0xD6, 0x0E, 0x9F, 0xFF, 0xFF, 0x19, 0x0A, 0x6F, 0xFF, 0xFF, 0x36, 0x08,
+  0x9F, 0xC6, 0x09, 0x6F, 0xC9, 0x06, 0x6F, 0xC9, 0x0B, 0x9F, 0xC6, 0x04,
+  0x9F, 0xA6, 0x0F, 0x6F, 0xC9, 0x02, 0x6F, 0xA9, 0x0F, 0x01, 0x9F, 0xC0,
+  0x19, 0xFA, 0x60, 0xF0, 0x36, 0xFB, 0x01, 0xFA, 0x90, 0xF0, 0x59, 0xFA,
+  0x60, 0x0F, 0x96, 0x0F, 0x07, 0x6F, 0xA9, 0xF9, 0x0F, 0x09, 0xFF, 0xF5,
+  0x0F, 0x09, 0xFF, 0xF5, 0x0F, 0x09, 0x9F, 0xFF, 0x40, 0xF0, 0xA6, 0xFF,
+  0xF3, 0x0F, 0x0B, 0xFF, 0xF3, 0x0F, 0x0B, 0xFF, 0xF3, 0x0F, 0x0A, 0x6F,
+  0xFF, 0x30, 0xF0, 0x99, 0xFF, 0xF4, 0x0F, 0x09, 0xFF, 0xF5, 0x0F, 0x09,
+  0xFF, 0xF5, 0x60, 0xF0, 0x76, 0xFA, 0x9F, 0xA9, 0x0F, 0x05, 0x9F, 0xA6,
+  0x00, 0x9F, 0xA6, 0x0F, 0x03, 0x6F, 0xB0, 0x26, 0xFA, 0x90, 0xF0, 0x19,
+  0xFC, 0x03, 0xFB, 0x60, 0xF6, 0xFC, 0x90, 0x3F, 0xFF, 0x09, 0x07, 0x9F,
+  0xE6, 0x04, 0x9F, 0xFF, 0x06, 0x05, 0x6F, 0xE9, 0x06, 0x6F, 0xFF, 0xFF,
+  0x56, 0x08, 0x9F, 0xFF, 0xFF, 0x39, 0x0A, 0x6F, 0xFF, 0xFF, 0x16, 0x0C,
+  0x9F, 0xFF, 0xF9, 0x0F, 0x00, 0x6F, 0xFF, 0xB6, 0x0F, 0x02, 0x9F, 0xFF,
+  0x99, 0x0F, 0x06, 0x6F, 0xFF, 0x16, 0x0F, 0x0C, 0x9F, 0xF9, 0x0F, 0x0F,
+  0x9F, 0xB9, 0x0F, 0x0F, 0x00, 0x6F, 0xD6, 0x0F, 0x0A, 0x9F, 0xFF, 0x79,
+  0x0F, 0x04, 0x6F, 0xFF, 0x96, 0x0F, 0x02, 0x9F, 0xFF, 0xB9, 0x0F, 0x00,
+  0x6F, 0xFF, 0xD6, 0x0E, 0x9F, 0xFF, 0xF9, 0x0C, 0x6F, 0xFF, 0xFF, 0x16,
+  0x0A, 0x9F, 0xE6, 0x03, 0x6F, 0xE9, 0x08, 0x6F, 0xE9, 0x05, 0x9F, 0xE6,
+  0x06, 0x9F, 0xC6, 0x0B, 0x6F, 0xC9, 0x05, 0xFC, 0x90, 0xD9, 0xFC, 0x05,
+  0xF9, 0x60, 0xF0, 0x36, 0xF9, 0x04, 0x6F, 0x90, 0xF0, 0x5F, 0x96, 0x02,
+  0x9F, 0xA0, 0xF0, 0x5F, 0xA9, 0x01, 0xFA, 0x90, 0xF0, 0x59, 0xFA, 0x01,
+  0xF9, 0x60, 0xF0, 0x76, 0xF9, 0x01, 0xF9, 0x0F, 0x09, 0xF9, 0x01, 0xF9,
+  0x0F, 0x09, 0xF9, 0x01, 0xF9, 0x0F, 0x09, 0xF9, 0x60, 0x0F, 0x90, 0xF0,
+  0x9F, 0xA9, 0xF9, 0x0F, 0x09, 0xFF, 0xF5, 0x0F, 0x09, 0xFF, 0xF5, 0x0F,
+  0x09, 0xFF, 0xF5, 0x0F, 0x09, 0xFF, 0xF5, 0x0F, 0x09, 0xFF, 0xF5, 0x0F,
+  0x09, 0xFF, 0xF5, 0x60, 0xF0, 0x76, 0xFF, 0xF6, 0x90, 0xF0, 0x59, 0xFF,
+  0xF8, 0x0F, 0x05, 0xFF, 0xF9, 0x0F, 0x05, 0xFD, 0x9F, 0xA6, 0x0F, 0x03,
+  0x6F, 0xD0, 0x06, 0xFA, 0x90, 0xF9, 0xFF, 0xF0, 0x01, 0xFB, 0x60, 0xD6,
+  0xFF, 0xF1, 0x01, 0xFF, 0xF0, 0x90, 0x59, 0xFF, 0xF4, 0x01, 0x9F, 0xFF,
+  0x06, 0x03, 0x6F, 0xFF, 0x50, 0x26, 0xFF, 0xFF, 0x66, 0xF9, 0x03, 0x9F,
+  0xFF, 0xD9, 0x01, 0xF9, 0x04, 0x6F, 0xFF, 0xB6, 0x02, 0xF9, 0x05, 0x9F,
+  0xFF, 0x99, 0x03, 0xF9, 0x08, 0x6F, 0xFF, 0x56, 0x04, 0xF9, 0x09, 0x9F,
+  0xFF, 0x39, 0x05, 0xF9, 0x0C, 0x6F, 0xB6, 0x0A, 0xF9, 0x0D, 0x9F, 0x99,
+  0x0A, 0x6F, 0x89, 0x0F, 0x0F, 0x03, 0x9F, 0x86, 0x0F, 0x0F, 0x04, 0xF9,
+  0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x05, 0xF9,
+  0x0F, 0x0F, 0x04, 0x6F, 0x89, 0x01, 0x9F, 0x79, 0x0F, 0x07, 0x9F, 0x86,
+  0x02, 0xF9, 0x60, 0xF0, 0x6F, 0x90, 0x3F, 0xA9, 0x0F, 0x05, 0xF9, 0x03,
+  0x9F, 0xA0, 0xF0, 0x46, 0xF9, 0x04, 0x6F, 0x90, 0xF0, 0x39, 0xFA, 0x05,
+  0xF9, 0x60, 0xF0, 0x16, 0xFA, 0x90, 0x5F, 0xA9, 0x0F, 0x9F, 0xA6, 0x06,
+  0x9F, 0xA6, 0x0D, 0x6F, 0xA9, 0x08, 0x6F, 0xC9, 0x07, 0x9F, 0xC6, 0x0A,
+  0xFD, 0x60, 0x56, 0xFC, 0x90, 0xBF, 0xFF, 0xFF, 0x16, 0x0C, 0x9F, 0xFF,
+  0xF9, 0x0F, 0x00, 0x6F, 0xFF, 0xB6, 0x0F, 0x02, 0x9F, 0xFF, 0x99, 0x0F,
+  0x04, 0x6F, 0xFF, 0x76, 0x0F, 0x06, 0x9F, 0xFF, 0x59, 0x0F, 0x0A, 0x6F,
+  0xF6, 0x0F, 0x0E, 0x9F, 0xD9, 0x0F, 0x01, 0x0F, 0x05, 0x9F, 0xD9, 0x0F,
+  0x0F, 0x08, 0x6F, 0xF6, 0x0F, 0x0F, 0x02, 0x9F, 0xFF, 0x99, 0x0F, 0x0C,
+  0x6F, 0xFF, 0xB6, 0x0F, 0x08, 0x9F, 0xFF, 0xFF, 0x19, 0x0F, 0x04, 0x6F,
+  0xFF, 0xFF, 0x36, 0x0F, 0x02, 0x9F, 0xFF, 0xFF, 0x59, 0x0F, 0x00, 0x6F,
+  0xFF, 0xFF, 0x76, 0x0E, 0x9F, 0xFF, 0x06, 0x05, 0x6F, 0xFF, 0x09, 0x0C,
+  0x6F, 0xFF, 0x09, 0x07, 0x9F, 0xFF, 0x06, 0x0A, 0x9F, 0xC6, 0x0F, 0x01,
+  0x6F, 0xC9, 0x08, 0x6F, 0xC9, 0x0F, 0x03, 0x9F, 0xC6, 0x06, 0x9F, 0xC6,
+  0x0F, 0x05, 0x6F, 0xC9, 0x05, 0xFC, 0x90, 0xF0, 0x79, 0xFC, 0x05, 0xFB,
+  0x60, 0xF0, 0x96, 0xFB, 0x04, 0x6F, 0xA9, 0x0F, 0x0B, 0x9F, 0xA0, 0x39,
+  0xFA, 0x60, 0xF0, 0xD6, 0xF9, 0x03, 0xFA, 0x90, 0xF0, 0xFF, 0x96, 0x02,
+  0xF9, 0x60, 0xF0, 0xF0, 0x0F, 0xA9, 0x01, 0xF9, 0x0F, 0x0F, 0x01, 0x9F,
+  0xA0, 0x1F, 0x90, 0xF0, 0xF0, 0x26, 0xF9, 0x00, 0x6F, 0x90, 0xF0, 0xF0,
+  0x39, 0xF7, 0x99, 0xFA, 0x0F, 0x0F, 0x0D, 0xFA, 0x90, 0xF0, 0xF0, 0xDF,
+  0x96, 0x0F, 0x0F, 0x0E, 0xF9, 0x0F, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0x0F,
+  0xF9, 0x0F, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0x0F,
+  0xF9, 0x0F, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0x0F,
+  0xF9, 0x0F, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0x0F,
+  0xF9, 0x0F, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0x0F,
+  0xF9, 0x0F, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0x0F,
+  0xF9, 0x0F, 0x0F, 0x0F, 0xF9, 0x60, 0xF0, 0xF0, 0xEF, 0xA9, 0x0F, 0x0F,
+  0x0D, 0xFB, 0x0F, 0x0F, 0x0D, 0xFB, 0x0F, 0x0F, 0x03, 0x9F, 0x79, 0x9F,
+  0xA0, 0xF0, 0xF0, 0x26, 0xF9, 0x00, 0x6F, 0x90, 0xF0, 0xF0, 0x19, 0xFA,
+  0x01, 0xF9, 0x60, 0xF0, 0xF0, 0x0F, 0xA9, 0x01, 0xFA, 0x90, 0xF0, 0xFF,
+  0x96, 0x02, 0x9F, 0xA6, 0x0F, 0x0D, 0x6F, 0x90, 0x46, 0xFA, 0x90, 0xF0,
+  0xB9, 0xFA, 0x05, 0xFB, 0x60, 0xF0, 0x96, 0xFA, 0x90, 0x5F, 0xC9, 0x0F,
+  0x07, 0x9F, 0xA6, 0x06, 0x9F, 0xC6, 0x0F, 0x05, 0x6F, 0xB0, 0x86, 0xFC,
+  0x90, 0xF0, 0x39, 0xFC, 0x09, 0x9F, 0xC6, 0x0F, 0x01, 0x6F, 0xC9, 0x0A,
+  0x6F, 0xFF, 0x09, 0x07, 0x9F, 0xFF, 0x06, 0x0C, 0x9F, 0xFF, 0x06, 0x05,
+  0x6F, 0xFF, 0x09, 0x0E, 0x6F, 0xFF, 0xFF, 0x76, 0x0F, 0x00, 0x9F, 0xFF,
+  0xFF, 0x59, 0x0F, 0x02, 0x6F, 0xFF, 0xFF, 0x36, 0x0F, 0x04, 0x9F, 0xFF,
+  0xFF, 0x19, 0x0F, 0x08, 0x6F, 0xFF, 0xB6, 0x0F, 0x0C, 0x9F, 0xFF, 0x99,
+  0x0F, 0x0F, 0x02, 0x6F, 0xF6, 0x0F, 0x0F, 0x08, 0x9F, 0xD9, 0x0F, 0x03,
+  0x9F, 0x79, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F,
+  0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x60,
+  0xF0, 0xEF, 0xFF, 0xFF, 0x89, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x9F, 0xFF, 0xFF,
+  0x79, 0x9F, 0x99, 0x0F, 0x0F, 0x9F, 0x99, 0xFB, 0x60, 0xF0, 0xEF, 0xFF,
+  0x89, 0x0F, 0x0D, 0xFF, 0xF9, 0x0F, 0x0D, 0xFF, 0xF9, 0x0F, 0x0D, 0xFF,
+  0xF9, 0x60, 0xF0, 0xCF, 0xFF, 0xA9, 0x0F, 0x0B, 0xFF, 0xFB, 0x60, 0xF0,
+  0xAF, 0xFF, 0xC9, 0x0F, 0x09, 0xFF, 0xFD, 0x0F, 0x09, 0xFF, 0xFD, 0x0F,
+  0x09, 0xFF, 0xFD, 0x60, 0xF0, 0x8F, 0xFF, 0xE9, 0x0F, 0x07, 0xFF, 0xFF,
+  0x60, 0xF0, 0x6F, 0xFF, 0xFF, 0x09, 0x0F, 0x05, 0xFF, 0xFF, 0xF1, 0x0F,
+  0x05, 0xFF, 0xF5, 0x66, 0xF9, 0x0F, 0x05, 0xFF, 0xF5, 0x01, 0xF9, 0x60,
+  0xF0, 0x4F, 0xFF, 0x50, 0x1F, 0xA9, 0x0F, 0x03, 0xFF, 0xF5, 0x01, 0x9F,
+  0xA6, 0x0F, 0x02, 0xFF, 0xF5, 0x02, 0x6F, 0xA9, 0x0F, 0x01, 0xFF, 0xF5,
+  0x03, 0xFB, 0x0F, 0x01, 0xFF, 0xF5, 0x03, 0xFB, 0x0F, 0x01, 0xFF, 0xF5,
+  0x03, 0x9F, 0xA6, 0x0F, 0x00, 0xFF, 0xF5, 0x04, 0x6F, 0xA9, 0x0F, 0xFF,
+  0xF5, 0x05, 0x9F, 0xA0, 0xFF, 0xFF, 0x50, 0x66, 0xF9, 0x0F, 0xFF, 0xF5,
+  0x07, 0xF9, 0x60, 0xEF, 0xFF, 0x50, 0x7F, 0xA9, 0x0D, 0xFF, 0xF5, 0x07,
+  0x9F, 0xA6, 0x0C, 0xFF, 0xF5, 0x08, 0x6F, 0xA9, 0x0B, 0xFF, 0xF5, 0x09,
+  0xFB, 0x0B, 0xFF, 0xF5, 0x09, 0xFB, 0x0B, 0xFF, 0xF5, 0x09, 0x9F, 0xA6,
+  0x0A, 0xFF, 0xF5, 0x0A, 0x6F, 0xA9, 0x09, 0xFF, 0xF5, 0x0B, 0x9F, 0xA6,
+  0x08, 0xFF, 0xF5, 0x0C, 0x6F, 0xA9, 0x07, 0xFF, 0xF5, 0x0D, 0xFB, 0x07,
+  0xFF, 0xF5, 0x0D, 0xFB, 0x07, 0xFF, 0xF5, 0x0D, 0x9F, 0xA6, 0x06, 0xFF,
+  0xF5, 0x0E, 0x6F, 0xA9, 0x05, 0xFF, 0xF5, 0x0F, 0x9F, 0xA0, 0x5F, 0xFF,
+  0x50, 0xF0, 0x06, 0xF9, 0x05, 0xFF, 0xF5, 0x0F, 0x01, 0xF9, 0x60, 0x4F,
+  0xFF, 0x50, 0xF0, 0x1F, 0xA9, 0x03, 0xFF, 0xF5, 0x0F, 0x01, 0x9F, 0xA6,
+  0x02, 0x9F, 0xFF, 0x40, 0xF0, 0x26, 0xFA, 0x90, 0x26, 0xFF, 0xF3, 0x0F,
+  0x03, 0x9F, 0xA0, 0x3F, 0xFF, 0x30, 0xF0, 0x46, 0xF9, 0x03, 0xFF, 0xF3,
+  0x0F, 0x05, 0xF9, 0x60, 0x2F, 0xFF, 0x30, 0xF0, 0x5F, 0xA9, 0x01, 0xFF,
+  0xF3, 0x0F, 0x05, 0x9F, 0xA0, 0x1F, 0xFF, 0x30, 0xF0, 0x66, 0xF9, 0x01,
+  0xFF, 0xF3, 0x0F, 0x07, 0x9F, 0x86, 0x6F, 0xFF, 0x30, 0xF0, 0x86, 0xFF,
+  0xFD, 0x0F, 0x09, 0xFF, 0xFD, 0x0F, 0x09, 0xFF, 0xFD, 0x0F, 0x09, 0x9F,
+  0xFF, 0xC0, 0xF0, 0xA6, 0xFF, 0xFB, 0x0F, 0x0B, 0xFF, 0xFB, 0x0F, 0x0B,
+  0xFF, 0xFB, 0x0F, 0x0B, 0x9F, 0xFF, 0xA0, 0xF0, 0xC6, 0xFF, 0xF9, 0x0F,
+  0x0D, 0x9F, 0xFF, 0x80, 0xF0, 0xE6, 0xFF, 0xF7, 0x0F, 0x0F, 0xFF, 0xF7,
+  0x0F, 0x0F, 0xFD, 0x9F, 0x79, 0x0F, 0x0F, 0x9F, 0xB9, 0x0D, 0x9F, 0xD9,
+  0x0F, 0x08, 0x6F, 0xF6, 0x0F, 0x04, 0x9F, 0xFF, 0x79, 0x0E, 0x6F, 0xFF,
+  0x96, 0x0A, 0x9F, 0xFF, 0xD9, 0x08, 0x6F, 0xFF, 0xF6, 0x06, 0x9F, 0xFF,
+  0xFF, 0x19, 0x05, 0xFF, 0xFF, 0xF3, 0x05, 0xFD, 0x60, 0x56, 0xFD, 0x04,
+  0x6F, 0xC9, 0x07, 0x9F, 0xC6, 0x02, 0x9F, 0xA6, 0x0D, 0x6F, 0xA9, 0x01,
+  0xFA, 0x90, 0xF9, 0xFA, 0x01, 0xF9, 0x60, 0xF0, 0x16, 0xF9, 0x01, 0x9F,
+  0x80, 0xF0, 0x3F, 0x90, 0x66, 0xF3, 0x0F, 0x03, 0xF9, 0x07, 0x9F, 0x19,
+  0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9, 0x0F, 0x0F, 0xF9,
+  0x0F, 0x0E, 0x6F, 0x90, 0xF0, 0xD9, 0xFA, 0x0F, 0x0C, 0x6F, 0xB0, 0xD9,
+  0xFF, 0xFA, 0x0C, 0x6F, 0xFF, 0xB0, 0x79, 0xFF, 0xFF, 0xF0, 0x06, 0x6F,
+  0xFF, 0xFF, 0x10, 0x39, 0xFF, 0xFF, 0xF4, 0x02, 0x6F, 0xFF, 0xFF, 0x50,
+  0x19, 0xFF, 0xF4, 0x60, 0x56, 0xF9, 0x01, 0xFF, 0xF4, 0x90, 0x7F, 0x90,
+  0x1F, 0xB6, 0x0F, 0x00, 0xF9, 0x00, 0x6F, 0xA9, 0x0F, 0x01, 0xF9, 0x9F,
+  0xA6, 0x0F, 0x02, 0xFF, 0xF4, 0x90, 0xF0, 0x3F, 0xFF, 0x36, 0x0F, 0x04,
+  0xFF, 0xF3, 0x0F, 0x05, 0xFF, 0xF3, 0x0F, 0x05, 0xFF, 0xF3, 0x0F, 0x04,
+  0x6F, 0xFF, 0x30, 0xF0, 0x39, 0xFF, 0xF4, 0x0F, 0x03, 0xFF, 0xF5, 0x0F,
+  0x03, 0xFF, 0xF5, 0x60, 0xF0, 0x16, 0xFF, 0xF6, 0x90, 0xD9, 0xFE, 0x9F,
+  0xA6, 0x0B, 0x6F, 0xF0, 0x06, 0xFF, 0xFF, 0xF7, 0x01, 0xFF, 0xFF, 0xF7,
+  0x01, 0xFF, 0xFB, 0x66, 0xF9, 0x01, 0x9F, 0xFF, 0x99, 0x01, 0xF9, 0x02,
+  0x6F, 0xFF, 0x76, 0x02, 0xF9, 0x03, 0x9F, 0xFF, 0x59, 0x03, 0xF9, 0x06,
+  0x6F, 0xFF, 0x16, 0x04, 0xF9, 0x07, 0x9F, 0xF9, 0x05, 0x9F, 0x79, 0x0E,
+  0x6F, 0x16, 0x0F, 0x0F, 0x06, 0x99, 0x0F, 0x07, 0x0F, 0x0F, 0x05, 0x9F,
+  0x79, 0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x05,
+  0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x05,
+  0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x05,
+  0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x05,
+  0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x05, 0xF9, 0x0F, 0x0F, 0x05,
+  0xF9, 0x0F, 0x9F, 0x99, 0x09, 0xF9, 0x0E, 0x6F, 0xB6, 0x08, 0xF9, 0x09,
+  0x9F, 0xFF, 0x39, 0x05, 0xF9, 0x08, 0x6F, 0xFF, 0x56, 0x04, 0xF9, 0x07,
+  0x9F, 0xFF, 0x79, 0x03, 0xF9, 0x06, 0x6F, 0xFF, 0x96, 0x02, 0xF9, 0x05,
+  0x9F, 0xFF, 0xB9, 0x01, 0xF9, 0x04, 0x6F, 0xFF, 0xD0, 0x1F, 0x90, 0x39,
+  0xFE, 0x60, 0x56, 0xF7, 0x01, 0xF9, 0x03, 0xFE, 0x90, 0x79, 0xF6, 0x66,
+  0xF9, 0x03, 0xFB, 0x60, 0xD6, 0xFF, 0x02, 0x6F, 0xA9, 0x0F, 0x9F, 0xE0,
+  0x19, 0xFA, 0x60, 0xF0, 0x16, 0xFD, 0x01, 0xFB, 0x0F, 0x03, 0xFD, 0x01,
+  0xFB, 0x0F, 0x03, 0xFD, 0x01, 0xFA, 0x90, 0xF0, 0x39, 0xFC, 0x01, 0xF9,
+  0x60, 0xF0, 0x56, 0xFB, 0x00, 0x6F, 0x90, 0xF0, 0x7F, 0xB9, 0xFA, 0x0F,
+  0x07, 0xFF, 0xF7, 0x0F, 0x07, 0xFF, 0xF7, 0x0F, 0x07, 0xFF, 0xF6, 0x90,
+  0xF0, 0x79, 0xFF, 0xF4, 0x60, 0xF0, 0x96, 0xFF, 0xF3, 0x0F, 0x0B, 0xFF,
+  0xF3, 0x0F, 0x0B, 0xFF, 0xF3, 0x0F, 0x0B, 0xFF, 0xF3, 0x0F, 0x0B, 0xFF,
+  0xF3, 0x0F, 0x0B, 0xFF, 0xF3, 0x0F, 0x0B, 0xFF, 0xF3, 0x60, 0xF0, 0x96,
+  0xFF, 0xF4, 0x90, 0xF0, 0x79, 0xFF, 0xF6, 0x0F, 0x07, 0xFF, 0xF7, 0x0F,
+  0x07, 0xFB, 0x9F, 0xA0, 0xF0, 0x7F, 0xB0, 0x06, 0xF9, 0x0F, 0x07, 0xFB,
+  0x01, 0xF9, 0x60, 0xF0, 0x56, 0xFB, 0x01, 0xFA, 0x90, 0xF0, 0x39, 0xFC,
+  0x01, 0xFB, 0x0F, 0x03, 0xFD, 0x01, 0xFB, 0x0F, 0x03, 0xFD, 0x01, 0x9F,
+  0xA6, 0x0F, 0x01, 0x6F, 0xD0, 0x26, 0xFA, 0x90, 0xF9, 0xFE, 0x03, 0xFB,
+  0x60, 0xD6, 0xFF, 0x03, 0xFE, 0x90, 0x79, 0xFF, 0xF2, 0x03, 0x9F, 0xE6,
+  0x05, 0x6F, 0xFF, 0x30, 0x46, 0xFF, 0xFD, 0x66, 0xF9, 0x05, 0x9F, 0xFF,
+  0xB9, 0x01, 0xF9, 0x06, 0x6F, 0xFF, 0x96, 0x02, 0xF9, 0x07, 0x9F, 0xFF,
+  0x79, 0x03, 0xF9, 0x08, 0x6F, 0xFF, 0x56, 0x04, 0xF9, 0x09, 0x9F, 0xFF,
+  0x39, 0x05, 0xF9, 0x0E, 0x6F, 0xB6, 0x08, 0xF9, 0x0F, 0x9F, 0x99, 0x09,
+  0x9F, 0x79, 0x0F, 0x9F, 0xD9, 0x0F, 0x0C, 0x6F, 0xF6, 0x0F, 0x08, 0x9F,
+  0xFF, 0x59, 0x0F, 0x04, 0x6F, 0xFF, 0x76, 0x0F, 0x02, 0x9F, 0xFF, 0x99,
+  0x0F, 0x00, 0x6F, 0xFF, 0xB6, 0x0E, 0x9F, 0xFF, 0xD9, 0x0C, 0x6F, 0xFF,
+  0xF6, 0x0A, 0x9F, 0xC6, 0x05, 0x6F, 0xC9, 0x08, 0x6F, 0xC9, 0x07, 0x9F,
+  0xC6, 0x06, 0x9F, 0xA6, 0x0D, 0x6F, 0xA9, 0x05, 0xFA, 0x90, 0xF9, 0xFA,
+  0x05, 0xF9, 0x60, 0xF0, 0x16, 0xF9, 0x04, 0x6F, 0x89, 0x0F, 0x03, 0x9F,
+  0x86, 0x02, 0x9F, 0x86, 0x0F, 0x05, 0x6F, 0x89, 0x01, 0xF9, 0x0F, 0x07,
+  0xF9, 0x01, 0xF9, 0x0F, 0x07, 0xF9, 0x01, 0xF8, 0x90, 0xF0, 0x7F, 0x90,
+  0x1F, 0x76, 0x0F, 0x08, 0xF9, 0x00, 0x6F, 0x70, 0xF0, 0x9F, 0x99, 0xF8,
+  0x0F, 0x09, 0xFF, 0xF3, 0x60, 0xF0, 0x76, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x9F, 0x96, 0x0F, 0x0F, 0x02,
+  0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0x9F, 0x86, 0x0F, 0x0F,
+  0x03, 0x6F, 0x89, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F,
+  0x0F, 0x03, 0xF9, 0x60, 0xF0, 0xF0, 0x2F, 0xA9, 0x0F, 0x05, 0x9F, 0x39,
+  0x05, 0x9F, 0xA6, 0x0F, 0x03, 0x6F, 0x56, 0x05, 0x6F, 0xA9, 0x0F, 0x01,
+  0x9F, 0x99, 0x03, 0xFB, 0x60, 0xF6, 0xFA, 0x90, 0x3F, 0xC9, 0x0D, 0x9F,
+  0xA6, 0x04, 0x9F, 0xC6, 0x0B, 0x6F, 0xB0, 0x66, 0xFF, 0xFF, 0xF5, 0x07,
+  0x9F, 0xFF, 0xFF, 0x39, 0x08, 0x6F, 0xFF, 0xFF, 0x16, 0x0A, 0x9F, 0xFF,
+  0xF9, 0x0C, 0x6F, 0xFF, 0xD6, 0x0E, 0x9F, 0xFF, 0xB9, 0x0F, 0x02, 0x6F,
+  0xFF, 0x56, 0x0F, 0x06, 0x9F, 0xFF, 0x39, 0x0F, 0x0F, 0x00, 0x6F, 0x16,
+  0x0F, 0x0F, 0x0A, 0x99, 0x0F, 0x03, 0x0F, 0x03, 0x9F, 0xB9, 0x0F, 0x02,
+  0x6F, 0xD0, 0xF9, 0xFF, 0xF0, 0x0E, 0x6F, 0xFF, 0x10, 0xD9, 0xFF, 0xF2,
+  0x0C, 0x6F, 0xFF, 0x29, 0x0B, 0x9F, 0xFF, 0x26, 0x0C, 0xFF, 0xF3, 0x0D,
+  0xFB, 0x60, 0x36, 0xF1, 0x0C, 0x6F, 0xA9, 0x05, 0x99, 0x0B, 0x9F, 0xA6,
+  0x0F, 0x04, 0xFA, 0x90, 0xF0, 0x5F, 0x96, 0x0F, 0x06, 0xF9, 0x0F, 0x07,
+  0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07,
+  0xF9, 0x0F, 0x06, 0x6F, 0x96, 0x0C, 0x9F, 0xFF, 0xD9, 0x01, 0xFF, 0xFF,
+  0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+  0x01, 0xFF, 0xFF, 0x01, 0x9F, 0xFF, 0xD9, 0x0A, 0x6F, 0x96, 0x0F, 0x06,
+  0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07,
+  0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07,
+  0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07,
+  0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07,
+  0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07,
+  0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07,
+  0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07,
+  0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07,
+  0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07,
+  0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07,
+  0xF9, 0x0F, 0x07, 0xF9, 0x0F, 0x07, 0x9F, 0x79, 0x0D, 0x9F, 0x79, 0x0F,
+  0x0F, 0x01, 0xF9, 0x0F, 0x0F, 0x01, 0xF9, 0x0F, 0x0F, 0x01, 0xF9, 0x0F,
+  0x0F, 0x01, 0xF9, 0x0F, 0x0F, 0x01, 0xF9, 0x0F, 0x0F, 0x01, 0xF9, 0x0F,
+  0x0F, 0x01, 0xF9, 0x0F, 0x0F, 0x01, 0xF9, 0x0F, 0x0F, 0x01, 0xF9, 0x0F,
+  0x0F, 0x01, 0xF9, 0x0F, 0x0F, 0x01, 0xF9, 0x0F, 0x0F, 0x01, 0xF9, 0x0F,
+  0x0F, 0x01, 0xF9, 0x0F, 0x0F, 0x01, 0xF9, 0x0F, 0x0F, 0x01, 0xF9, 0x0F,
+  0x0F, 0x01, 0xF9, 0x09, 0x9F, 0x99, 0x0B, 0xF9, 0x08, 0x6F, 0xB6, 0x0A,
+  0xF9, 0x05, 0x9F, 0xFF, 0x19, 0x07, 0xF9, 0x04, 0x6F, 0xFF, 0x36, 0x06,
+  0xF9, 0x03, 0x9F, 0xFF, 0x79, 0x03, 0xF9, 0x02, 0x6F, 0xFF, 0x90, 0x3F,
+  0x90, 0x19, 0xFF, 0xFA, 0x03, 0xF9, 0x01, 0xFF, 0xFB, 0x60, 0x2F, 0x90,
+  0x1F, 0x76, 0x03, 0x6F, 0xE9, 0x01, 0xF9, 0x66, 0xF6, 0x90, 0x59, 0xFE,
+  0x01, 0xFF, 0x60, 0xB6, 0xFB, 0x01, 0xFE, 0x90, 0xD9, 0xFA, 0x60, 0x0F,
+  0xD6, 0x0F, 0x6F, 0xA9, 0xFC, 0x90, 0xF0, 0x1F, 0xFF, 0x76, 0x0F, 0x02,
+  0xFF, 0xF7, 0x0F, 0x03, 0x9F, 0xFF, 0x60, 0xF0, 0x46, 0xFF, 0xF5, 0x0F,
+  0x05, 0xFF, 0xF5, 0x0F, 0x05, 0xFF, 0xF4, 0x90, 0xF0, 0x5F, 0xFF, 0x36,
+  0x0F, 0x06, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3,
+  0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3,
+  0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3,
+  0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3,
+  0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3,
+  0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3,
+  0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3,
+  0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3,
+  0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3,
+  0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3, 0x0F, 0x07, 0xFF, 0xF3,
+  0x0F, 0x07, 0xF9, 0x9F, 0x79, 0x0F, 0x07, 0x9F, 0x79, 0x01, 0x9F, 0x59,
+  0x02, 0x6F, 0x76, 0x00, 0x9F, 0x99, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x9F,
+  0x99, 0x00, 0x6F, 0x76, 0x02, 0x9F, 0x59, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x01, 0x9F, 0x79, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9,
+  0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9,
+  0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9,
+  0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9,
+  0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9,
+  0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9,
+  0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9,
+  0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9,
+  0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0xF9, 0x01, 0x9F, 0x79, 0x01,
+  0x9F, 0x79, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F,
+  0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F,
+  0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F,
+  0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F,
+  0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x0F,
+  0x03, 0xF9, 0x0F, 0x0F, 0x03, 0xF9, 0x0F, 0x05, 0x9F, 0x99, 0x01, 0xF9,
+  0x0F, 0x04, 0x6F, 0xA9, 0x01, 0xF9, 0x0F, 0x03, 0x9F, 0xA6, 0x02, 0xF9,
+  0x0F, 0x02, 0x6F, 0xA9, 0x03, 0xF9, 0x0F, 0x01, 0x9F, 0xA6, 0x04, 0xF9,
+  0x0F, 0x00, 0x6F, 0xA9, 0x05, 0xF9, 0x0F, 0x9F, 0xA6, 0x06, 0xF9, 0x0E,
+  0x6F, 0xA9, 0x07, 0xF9, 0x0D, 0x9F, 0xA6, 0x08, 0xF9, 0x0C, 0x6F, 0xA9,
+  0x09, 0xF9, 0x0B, 0x9F, 0xA6, 0x0A, 0xF9, 0x0A, 0x6F, 0xA9, 0x0B, 0xF9,
+  0x09, 0x9F, 0xA6, 0x0C, 0xF9, 0x08, 0x6F, 0xA9, 0x0D, 0xF9, 0x07, 0x9F,
+  0xA6, 0x0E, 0xF9, 0x06, 0x6F, 0xA9, 0x0F, 0xF9, 0x05, 0x9F, 0xA6, 0x0F,
+  0x00, 0xF9, 0x04, 0x6F, 0xA9, 0x0F, 0x01, 0xF9, 0x03, 0x9F, 0xA6, 0x0F,
+  0x02, 0xF9, 0x02, 0x6F, 0xB0, 0xF0, 0x3F, 0x90, 0x19, 0xFC, 0x0F, 0x03,
+  0xF9, 0x66, 0xFC, 0x90, 0xF0, 0x3F, 0xFF, 0x76, 0x0F, 0x04, 0xFF, 0xF7,
+  0x60, 0xF0, 0x4F, 0xFF, 0x89, 0x0F, 0x03, 0xFF, 0xF9, 0x0F, 0x03, 0xFF,
+  0xF9, 0x0F, 0x03, 0xFF, 0xF9, 0x60, 0xF0, 0x2F, 0xFF, 0xA9, 0x0F, 0x01,
+  0xFF, 0xFB, 0x60, 0xF0, 0x0F, 0xD6, 0x01, 0x6F, 0xA9, 0x0F, 0xFC, 0x90,
+  0x3F, 0xB6, 0x0E, 0xFB, 0x60, 0x4F, 0xC9, 0x0D, 0xFA, 0x90, 0x59, 0xFC,
+  0x0D, 0xF9, 0x60, 0x76, 0xFB, 0x0D, 0xF9, 0x09, 0x9F, 0xA6, 0x0C, 0xF9,
+  0x0A, 0x6F, 0xA9, 0x0B, 0xF9, 0x0B, 0x9F, 0xA6, 0x0A, 0xF9, 0x0C, 0x6F,
+  0xA9, 0x09, 0xF9, 0x0D, 0xFB, 0x60, 0x8F, 0x90, 0xDF, 0xC9, 0x07, 0xF9,
+  0x0D, 0x9F, 0xC0, 0x7F, 0x90, 0xE6, 0xFB, 0x07, 0xF9, 0x0F, 0x9F, 0xA6,
+  0x06, 0xF9, 0x0F, 0x00, 0x6F, 0xA9, 0x05, 0xF9, 0x0F, 0x01, 0x9F, 0xA6,
+  0x04, 0xF9, 0x0F, 0x02, 0x6F, 0xA9, 0x03, 0xF9, 0x0F, 0x03, 0xFB, 0x60,
+  0x2F, 0x90, 0xF0, 0x3F, 0xC9, 0x01, 0xF9, 0x0F, 0x03, 0x9F, 0xC6, 0x00,
+  0xF9, 0x0F, 0x04, 0x6F, 0xC9, 0x9F, 0x79, 0x0F, 0x05, 0x9F, 0xB9, 0x9F,
+  0x79, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x9F, 0x79, 0x9F, 0x79, 0x09,
+  0x9F, 0x79, 0x0F, 0x01, 0x9F, 0x99, 0x09, 0xF9, 0x08, 0x6F, 0x96, 0x0F,
+  0x6F, 0xB6, 0x08, 0xF9, 0x05, 0x9F, 0xF9, 0x09, 0x9F, 0xFF, 0x19, 0x05,
+  0xF9, 0x04, 0x6F, 0xFF, 0x16, 0x07, 0x6F, 0xFF, 0x36, 0x04, 0xF9, 0x03,
+  0x9F, 0xFF, 0x39, 0x05, 0x9F, 0xFF, 0x59, 0x03, 0xF9, 0x02, 0x6F, 0xFF,
+  0x50, 0x46, 0xFF, 0xF7, 0x60, 0x2F, 0x90, 0x19, 0xFF, 0xF6, 0x03, 0x9F,
+  0xFF, 0x99, 0x01, 0xF9, 0x01, 0xFF, 0xF7, 0x60, 0x16, 0xFF, 0xFB, 0x60,
+  0x0F, 0x90, 0x1F, 0x56, 0x03, 0x6F, 0xFF, 0x76, 0x03, 0x6F, 0xE9, 0xF9,
+  0x66, 0xF4, 0x90, 0x59, 0xFF, 0xF5, 0x90, 0x59, 0xFF, 0xFC, 0x60, 0xB6,
+  0xFF, 0x60, 0xB6, 0xFF, 0xF8, 0x90, 0xD9, 0xFD, 0x90, 0xD9, 0xFF, 0xF6,
+  0x60, 0xF6, 0xFB, 0x60, 0xF6, 0xFF, 0xF5, 0x0F, 0x01, 0xFB, 0x0F, 0x01,
+  0xFF, 0xF5, 0x0F, 0x01, 0xFB, 0x0F, 0x01, 0xFF, 0xF5, 0x0F, 0x01, 0xFA,
+  0x90, 0xF0, 0x1F, 0xFF, 0x50, 0xF0, 0x1F, 0x96, 0x0F, 0x02, 0xFF, 0xF4,
+  0x90, 0xF0, 0x1F, 0x90, 0xF0, 0x3F, 0xFF, 0x36, 0x0F, 0x02, 0xF9, 0x0F,
+  0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3,
+  0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9,
+  0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F,
+  0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF,
+  0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F,
+  0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3,
+  0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9,
+  0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F,
+  0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF,
+  0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F,
+  0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3,
+  0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9,
+  0x0F, 0x03, 0xFF, 0xF3, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x9F, 0x79,
+  0x0F, 0x03, 0x9F, 0x79, 0x0F, 0x03, 0x9F, 0x79, 0x0F, 0x9F, 0xD9, 0x0F,
+  0x0E, 0x6F, 0xF6, 0x0F, 0x0A, 0x9F, 0xFF, 0x59, 0x0F, 0x06, 0x6F, 0xFF,
+  0x76, 0x0F, 0x04, 0x9F, 0xFF, 0xB9, 0x0F, 0x00, 0x6F, 0xFF, 0xD6, 0x0E,
+  0x9F, 0xFF, 0xF9, 0x0C, 0x6F, 0xFF, 0xFF, 0x16, 0x0A, 0x9F, 0xC6, 0x05,
+  0x6F, 0xE9, 0x08, 0x6F, 0xC9, 0x07, 0x9F, 0xE0, 0x79, 0xFA, 0x60, 0xD6,
+  0xFB, 0x07, 0xFA, 0x90, 0xF9, 0xFA, 0x60, 0x6F, 0x96, 0x0F, 0x01, 0x6F,
+  0xA9, 0x04, 0x6F, 0x90, 0xF0, 0x39, 0xFA, 0x03, 0x9F, 0xA0, 0xF0, 0x46,
+  0xF9, 0x03, 0xFA, 0x90, 0xF0, 0x5F, 0x96, 0x02, 0xF9, 0x60, 0xF0, 0x6F,
+  0xA9, 0x01, 0xF9, 0x0F, 0x07, 0x9F, 0xA0, 0x1F, 0x90, 0xF0, 0x86, 0xF9,
+  0x00, 0x6F, 0x90, 0xF0, 0x9F, 0x99, 0xFA, 0x0F, 0x09, 0xFF, 0xF4, 0x90,
+  0xF0, 0x9F, 0xFF, 0x36, 0x0F, 0x0A, 0xFF, 0xF3, 0x0F, 0x0B, 0xFF, 0xF3,
+  0x0F, 0x0B, 0xFF, 0xF3, 0x0F, 0x0B, 0xFF, 0xF3, 0x0F, 0x0B, 0xFF, 0xF3,
+  0x0F, 0x0B, 0xFF, 0xF3, 0x0F, 0x0B, 0xFF, 0xF3, 0x60, 0xF0, 0xAF, 0xFF,
+  0x49, 0x0F, 0x09, 0xFF, 0xF5, 0x0F, 0x09, 0xFF, 0xF5, 0x0F, 0x09, 0xF9,
+  0x9F, 0xA0, 0xF0, 0x86, 0xF9, 0x00, 0x6F, 0x90, 0xF0, 0x79, 0xFA, 0x01,
+  0xF9, 0x0F, 0x07, 0xFA, 0x90, 0x1F, 0x90, 0xF0, 0x7F, 0x96, 0x02, 0xF9,
+  0x60, 0xF0, 0x56, 0xF9, 0x03, 0xFA, 0x90, 0xF0, 0x39, 0xFA, 0x03, 0x9F,
+  0xA6, 0x0F, 0x02, 0xFB, 0x04, 0x6F, 0xA9, 0x0F, 0x01, 0xFB, 0x05, 0xFB,
+  0x60, 0xF6, 0xFA, 0x90, 0x5F, 0xC9, 0x0B, 0x9F, 0xC6, 0x06, 0x9F, 0xC6,
+  0x09, 0x6F, 0xC9, 0x08, 0x6F, 0xFF, 0xFF, 0x36, 0x0A, 0x9F, 0xFF, 0xFF,
+  0x19, 0x0C, 0x6F, 0xFF, 0xF6, 0x0E, 0x9F, 0xFF, 0xD9, 0x0F, 0x00, 0x6F,
+  0xFF, 0xB6, 0x0F, 0x02, 0x9F, 0xFF, 0x99, 0x0F, 0x06, 0x6F, 0xFF, 0x36,
+  0x0F, 0x0A, 0x9F, 0xFF, 0x19, 0x0F, 0x0F, 0x04, 0x6F, 0x16, 0x0F, 0x0F,
+  0x0C, 0x99, 0x0F, 0x05, 0x07, 0x9F, 0x79, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xF9, 0x0F, 0x02, 0x6F, 0x96, 0x0A, 0x9F, 0xFF, 0x99, 0x01, 0xFF, 0xFB,
+  0x01, 0xFF, 0xFB, 0x01, 0xFF, 0xFB, 0x01, 0xFF, 0xFB, 0x01, 0xFF, 0xFB,
+  0x01, 0xFF, 0xFB, 0x01, 0x9F, 0xFF, 0x99, 0x08, 0x6F, 0x96, 0x0F, 0x02,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03,
+  0xF9, 0x0F, 0x03, 0xF9, 0x0F, 0x03, 0xF9, 0x60, 0xF0, 0x2F, 0xA9, 0x0F,
+  0x01, 0xFB, 0x60, 0xF0, 0x0F, 0xC9, 0x05, 0x99, 0x07, 0x9F, 0xC6, 0x04,
+  0xF0, 0x90, 0x86, 0xFF, 0xF1, 0x0B, 0xFF, 0xF1, 0x60, 0xAF, 0xFF, 0x29,
+  0x09, 0x9F, 0xFF, 0x20, 0xA6, 0xFF, 0xF1, 0x0B, 0x9F, 0xFF, 0x00, 0xE6,
+  0xFD, 0x0F, 0x9F, 0xB9,
+};
+
+const PackedGlyph Inter_Medium24ptSmoothGlyphs[] PROGMEM = {
+  {     0,   2,   2,  26,    0,    0 }, // 0x20 ' '
+  {     1,  74,  70,  94,   10,  -66 }, // 0x25 '%'
+  {   554,  30,   8,  44,    6,  -30 }, // 0x2D '-'
+  {   572,  14,  14,  28,    8,  -12 }, // 0x2E '.'
+  {   607,  30,  82,  34,    2,  -70 }, // 0x2F '/'
+  {   878,  50,  68,  60,    6,  -66 }, // 0x30 '0'
+  {  1226,  28,  68,  40,    4,  -66 }, // 0x31 '1'
+  {  1433,  46,  68,  58,    6,  -66 }, // 0x32 '2'
+  {  1726,  48,  68,  58,    6,  -66 }, // 0x33 '3'
+  {  2060,  50,  68,  62,    6,  -66 }, // 0x34 '4'
+  {  2382,  46,  68,  58,    6,  -66 }, // 0x35 '5'
+  {  2698,  48,  68,  60,    6,  -66 }, // 0x36 '6'
+  {  3053,  46,  68,  54,    4,  -66 }, // 0x37 '7'
+  {  3351,  48,  68,  60,    6,  -66 }, // 0x38 '8'
+  {  3707,  48,  68,  60,    6,  -66 }, // 0x39 '9'
+  {  4063,  58,  68,  68,    6,  -66 }, // 0x43 'C'
+  {  4440,  42,  68,  54,    8,  -66 }, // 0x4C 'L'
+  {  4645,  56,  68,  72,    8,  -66 }, // 0x4E 'N'
+  {  5013,  42,  54,  54,    4,  -50 }, // 0x61 'a'
+  {  5264,  48,  68,  58,    4,  -66 }, // 0x64 'd'
+  {  5606,  46,  54,  56,    4,  -50 }, // 0x65 'e'
+  {  5862,  34,  72,  36,    0,  -70 }, // 0x66 'f'
+  {  6093,  44,  68,  56,    6,  -66 }, // 0x68 'h'
+  {  6393,  12,  72,  24,    6,  -70 }, // 0x69 'i'
+  {  6528,  46,  68,  52,    6,  -66 }, // 0x6B 'k'
+  {  6863,  10,  68,  24,    6,  -66 }, // 0x6C 'l'
+  {  6909,  70,  52,  84,    6,  -50 }, // 0x6D 'm'
+  {  7304,  48,  54,  56,    4,  -50 }, // 0x6F 'o'
+  {  7576,  30,  64,  32,    0,  -62 }, // 0x74 't'
+};
+
+const uint8_t Inter_Medium24ptSmoothIndex[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+  0x0D, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0xFF, 0x11, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xFF, 0xFF, 0x13, 0x14, 0x15, 0xFF,
+  0x16, 0x17, 0xFF, 0x18, 0x19, 0x1A, 0xFF, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x1C,
+};
+
+const PackedFont Inter_Medium24ptSmooth = { Inter_Medium24ptSmoothData, Inter_Medium24ptSmoothGlyphs, Inter_Medium24ptSmoothIndex, 0x20, 0x74, 114, PackedFont::SMOOTH };
@@ -0,0 +1,1028 @@
+// ConditionsAtlas.h - Generated by scripts/icon-compiler.py from assets/icons/conditions/, do not edit
+#pragma once
+#include "../IconBitmap.h"
+
+enum ConditionsIcon {
+  CONDITIONS_CLEAR,
+  CONDITIONS_CLOUDY,
+  CONDITIONS_DRIZZLE,
+  CONDITIONS_FOG,
+  CONDITIONS_FREEZING_RAIN,
+  CONDITIONS_HEAVY_RAIN,
+  CONDITIONS_ICE_PELLETS,
+  CONDITIONS_MOSTLY_CLEAR,
+  CONDITIONS_MOSTLY_CLOUDY,
+  CONDITIONS_PARTLY_CLOUDY,
+  CONDITIONS_RAIN,
+  CONDITIONS_SNOW,
+  CONDITIONS_THUNDERSTORM,
+  CONDITIONS_COUNT
+};
+
+// 13 icons in 2 sizes, 9 colors, 15483 bytes of runs
+const uint16_t ConditionsAtlasPalette[] PROGMEM = {
+  0xFFFF, 0x9CF3, 0x7BEF, 0xFEA0, 0xFD20, 0x841F, 0xC61F, 0xFFE0, 0x07FF
+};
+
+const uint8_t ConditionsAtlasRuns[] PROGMEM = {
+  0x00, 0x53, 0x55, 0x00, 0x53, 0x00, 0x52, 0x57, 0x00, 0x52, 0x00, 0x51, 0x59, 0x00, 0x51, 0x00,
+  0x50, 0x5B, 0x00, 0x50, 0x00, 0x50, 0x5B, 0x00, 0x50, 0x00, 0x50, 0x5B, 0x00, 0x50, 0x00, 0x50,
+  0x5B, 0x00, 0x50, 0x00, 0x50, 0x5B, 0x00, 0x50, 0x00, 0x51, 0x5A, 0x00, 0x50, 0x00, 0x51, 0x5A,
+  0x00, 0x50, 0x00, 0x51, 0x5A, 0x00, 0x50, 0x00, 0x51, 0x5A, 0x00, 0x50, 0x00, 0x51, 0x5A, 0x00,
+  0x50, 0x00, 0x51, 0x5A, 0x00, 0x50, 0x00, 0x51, 0x5A, 0x00, 0x50, 0x00, 0x51, 0x5A, 0x00, 0x50,
+  0x00, 0x51, 0x5A, 0x00, 0x50, 0x00, 0x51, 0x5A, 0x00, 0x50, 0x00, 0x51, 0x5A, 0x00, 0x50, 0x00,
+  0x51, 0x5A, 0x00, 0x50, 0x00, 0x51, 0x5A, 0x00, 0x50, 0x00, 0x50, 0x5B, 0x00, 0x50, 0x00, 0x50,
+  0x5B, 0x00, 0x50, 0x00, 0x1A, 0x55, 0x00, 0x31, 0x5B, 0x00, 0x31, 0x55, 0x00, 0x1A, 0x00, 0x19,
+  0x57, 0x00, 0x30, 0x5B, 0x00, 0x30, 0x57, 0x00, 0x19, 0x00, 0x18, 0x59, 0x00, 0x2F, 0x5B, 0x00,
+  0x2F, 0x59, 0x00, 0x18, 0x00, 0x17, 0x5B, 0x00, 0x2F, 0x59, 0x00, 0x2F, 0x5B, 0x00, 0x17, 0x00,
+  0x17, 0x5B, 0x00, 0x30, 0x57, 0x00, 0x30, 0x5B, 0x00, 0x17, 0x00, 0x17, 0x5C, 0x00, 0x30, 0x55,
+  0x00, 0x30, 0x5C, 0x00, 0x17, 0x00, 0x17, 0x5D, 0x00, 0x63, 0x5D, 0x00, 0x17, 0x00, 0x17, 0x5E,
+  0x00, 0x61, 0x5E, 0x00, 0x17, 0x00, 0x18, 0x5E, 0x00, 0x5F, 0x5E, 0x00, 0x18, 0x00, 0x19, 0x5E,
+  0x00, 0x5D, 0x5E, 0x00, 0x19, 0x00, 0x1A, 0x5E, 0x00, 0x5B, 0x5E, 0x00, 0x1A, 0x00, 0x1B, 0x5E,
+  0x00, 0x59, 0x5E, 0x00, 0x1B, 0x00, 0x1C, 0x5E, 0x00, 0x57, 0x5E, 0x00, 0x1C, 0x00, 0x1D, 0x5F,
+  0x00, 0x53, 0x5F, 0x00, 0x1D, 0x00, 0x1E, 0x5F, 0x00, 0x22, 0x4D, 0x00, 0x22, 0x5F, 0x00, 0x1E,
+  0x00, 0x1F, 0x5F, 0x00, 0x1C, 0x40, 0x17, 0x00, 0x1C, 0x5F, 0x00, 0x1F, 0x00, 0x20, 0x5F, 0x00,
+  0x17, 0x40, 0x1F, 0x00, 0x17, 0x5F, 0x00, 0x20, 0x00, 0x21, 0x5E, 0x00, 0x15, 0x40, 0x23, 0x00,
+  0x15, 0x5E, 0x00, 0x21, 0x00, 0x22, 0x5D, 0x00, 0x12, 0x40, 0x29, 0x00, 0x12, 0x5D, 0x00, 0x22,
+  0x00, 0x23, 0x5C, 0x00, 0x10, 0x40, 0x2D, 0x00, 0x10, 0x5C, 0x00, 0x23, 0x00, 0x24, 0x5B, 0x0E,
+  0x40, 0x31, 0x0E, 0x5B, 0x00, 0x24, 0x00, 0x25, 0x59, 0x0E, 0x40, 0x33, 0x0E, 0x59, 0x00, 0x25,
+  0x00, 0x26, 0x57, 0x0D, 0x40, 0x37, 0x0D, 0x57, 0x00, 0x26, 0x00, 0x27, 0x55, 0x0D, 0x40, 0x39,
+  0x0D, 0x55, 0x00, 0x27, 0x00, 0x38, 0x40, 0x3B, 0x00, 0x38, 0x00, 0x36, 0x40, 0x3F, 0x00, 0x36,
+  0x00, 0x35, 0x40, 0x41, 0x00, 0x35, 0x00, 0x34, 0x40, 0x43, 0x00, 0x34, 0x00, 0x33, 0x40, 0x45,
+  0x00, 0x33, 0x00, 0x32, 0x40, 0x47, 0x00, 0x32, 0x00, 0x31, 0x40, 0x49, 0x00, 0x31, 0x00, 0x30,
+  0x40, 0x4B, 0x00, 0x30, 0x00, 0x30, 0x40, 0x4B, 0x00, 0x30, 0x00, 0x2F, 0x40, 0x4D, 0x00, 0x2F,
+  0x00, 0x2E, 0x40, 0x4F, 0x00, 0x2E, 0x00, 0x2D, 0x40, 0x51, 0x00, 0x2D, 0x00, 0x2D, 0x40, 0x51,
+  0x00, 0x2D, 0x00, 0x2C, 0x40, 0x53, 0x00, 0x2C, 0x00, 0x2B, 0x40, 0x55, 0x00, 0x2B, 0x00, 0x2B,
+  0x40, 0x55, 0x00, 0x2B, 0x00, 0x2A, 0x40, 0x57, 0x00, 0x2A, 0x00, 0x2A, 0x40, 0x57, 0x00, 0x2A,
+  0x00, 0x29, 0x40, 0x59, 0x00, 0x29, 0x00, 0x29, 0x40, 0x59, 0x00, 0x29, 0x00, 0x29, 0x40, 0x59,
+  0x00, 0x29, 0x00, 0x28, 0x40, 0x5B, 0x00, 0x28, 0x00, 0x28, 0x40, 0x5B, 0x00, 0x28, 0x00, 0x27,
+  0x40, 0x5D, 0x00, 0x27, 0x00, 0x27, 0x40, 0x5D, 0x00, 0x27, 0x00, 0x27, 0x40, 0x5D, 0x00, 0x27,
+  0x00, 0x27, 0x40, 0x5D, 0x00, 0x27, 0x00, 0x26, 0x40, 0x5F, 0x00, 0x26, 0x00, 0x26, 0x40, 0x5F,
+  0x00, 0x26, 0x00, 0x26, 0x40, 0x5F, 0x00, 0x26, 0x00, 0x26, 0x40, 0x5F, 0x00, 0x26, 0x00, 0x26,
+  0x40, 0x5F, 0x00, 0x26, 0x00, 0x25, 0x40, 0x61, 0x00, 0x25, 0x03, 0x50, 0x17, 0x0B, 0x40, 0x61,
+  0x0B, 0x50, 0x17, 0x03, 0x02, 0x50, 0x19, 0x0A, 0x40, 0x61, 0x0A, 0x50, 0x19, 0x02, 0x01, 0x50,
+  0x1B, 0x09, 0x40, 0x61, 0x09, 0x50, 0x1B, 0x01, 0x50, 0x1D, 0x08, 0x40, 0x61, 0x08, 0x50, 0x1D,
+  0x50, 0x1D, 0x08, 0x40, 0x61, 0x08, 0x50, 0x1D, 0x50, 0x1D, 0x08, 0x40, 0x61, 0x08, 0x50, 0x1D,
+  0x50, 0x1D, 0x08, 0x40, 0x61, 0x08, 0x50, 0x1D, 0x50, 0x1D, 0x08, 0x40, 0x61, 0x08, 0x50, 0x1D,
+  0x01, 0x50, 0x1B, 0x09, 0x40, 0x61, 0x09, 0x50, 0x1B, 0x01, 0x02, 0x50, 0x19, 0x0A, 0x40, 0x61,
+  0x0A, 0x50, 0x19, 0x02, 0x03, 0x55, 0x0D, 0x55, 0x0B, 0x40, 0x61, 0x0B, 0x50, 0x17, 0x03, 0x00,
+  0x25, 0x40, 0x61, 0x00, 0x25, 0x00, 0x26, 0x40, 0x5F, 0x00, 0x26, 0x00, 0x26, 0x40, 0x5F, 0x00,
+  0x26, 0x00, 0x26, 0x40, 0x5F, 0x00, 0x26, 0x00, 0x26, 0x40, 0x5F, 0x00, 0x26, 0x00, 0x26, 0x40,
+  0x5F, 0x00, 0x26, 0x00, 0x27, 0x40, 0x5D, 0x00, 0x27, 0x00, 0x27, 0x40, 0x5D, 0x00, 0x27, 0x00,
+  0x27, 0x40, 0x5D, 0x00, 0x27, 0x00, 0x27, 0x40, 0x5D, 0x00, 0x27, 0x00, 0x28, 0x40, 0x5B, 0x00,
+  0x28, 0x00, 0x28, 0x40, 0x5B, 0x00, 0x28, 0x00, 0x29, 0x40, 0x59, 0x00, 0x29, 0x00, 0x29, 0x40,
+  0x59, 0x00, 0x29, 0x00, 0x29, 0x40, 0x59, 0x00, 0x29, 0x00, 0x2A, 0x40, 0x57, 0x00, 0x2A, 0x00,
+  0x2A, 0x40, 0x57, 0x00, 0x2A, 0x00, 0x2B, 0x40, 0x55, 0x00, 0x2B, 0x00, 0x2B, 0x40, 0x55, 0x00,
+  0x2B, 0x00, 0x2C, 0x40, 0x53, 0x00, 0x2C, 0x00, 0x2D, 0x40, 0x51, 0x00, 0x2D, 0x00, 0x2D, 0x40,
+  0x51, 0x00, 0x2D, 0x00, 0x2E, 0x40, 0x4F, 0x00, 0x2E, 0x00, 0x2F, 0x40, 0x4D, 0x00, 0x2F, 0x00,
+  0x30, 0x40, 0x4B, 0x00, 0x30, 0x00, 0x30, 0x40, 0x4B, 0x00, 0x30, 0x00, 0x31, 0x40, 0x49, 0x00,
+  0x31, 0x00, 0x32, 0x40, 0x47, 0x00, 0x32, 0x00, 0x33, 0x40, 0x45, 0x00, 0x33, 0x00, 0x34, 0x40,
+  0x43, 0x00, 0x34, 0x00, 0x35, 0x40, 0x41, 0x00, 0x35, 0x00, 0x36, 0x40, 0x3F, 0x00, 0x36, 0x00,
+  0x38, 0x40, 0x3B, 0x00, 0x38, 0x00, 0x27, 0x55, 0x0D, 0x40, 0x39, 0x0D, 0x55, 0x00, 0x27, 0x00,
+  0x26, 0x57, 0x0D, 0x40, 0x37, 0x0D, 0x57, 0x00, 0x26, 0x00, 0x25, 0x59, 0x0E, 0x40, 0x33, 0x0E,
+  0x59, 0x00, 0x25, 0x00, 0x24, 0x5B, 0x0E, 0x40, 0x31, 0x0E, 0x5B, 0x00, 0x24, 0x00, 0x24, 0x5B,
+  0x00, 0x10, 0x40, 0x2D, 0x00, 0x10, 0x5B, 0x00, 0x24, 0x00, 0x23, 0x5C, 0x00, 0x12, 0x40, 0x29,
+  0x00, 0x12, 0x5C, 0x00, 0x23, 0x00, 0x22, 0x5D, 0x00, 0x15, 0x40, 0x23, 0x00, 0x15, 0x5D, 0x00,
+  0x22, 0x00, 0x21, 0x5E, 0x00, 0x17, 0x40, 0x1F, 0x00, 0x17, 0x5E, 0x00, 0x21, 0x00, 0x20, 0x5E,
+  0x00, 0x1C, 0x40, 0x17, 0x00, 0x1C, 0x5E, 0x00, 0x20, 0x00, 0x1F, 0x5E, 0x00, 0x22, 0x4D, 0x00,
+  0x22, 0x5E, 0x00, 0x1F, 0x00, 0x1E, 0x5E, 0x00, 0x53, 0x5E, 0x00, 0x1E, 0x00, 0x1D, 0x5E, 0x00,
+  0x55, 0x5E, 0x00, 0x1D, 0x00, 0x1C, 0x5E, 0x00, 0x57, 0x5E, 0x00, 0x1C, 0x00, 0x1A, 0x5F, 0x00,
+  0x59, 0x5F, 0x00, 0x1A, 0x00, 0x19, 0x5F, 0x00, 0x5B, 0x5F, 0x00, 0x19, 0x00, 0x18, 0x5F, 0x00,
+  0x5D, 0x5F, 0x00, 0x18, 0x00, 0x17, 0x5F, 0x00, 0x5F, 0x5F, 0x00, 0x17, 0x00, 0x17, 0x5E, 0x00,
+  0x61, 0x5E, 0x00, 0x17, 0x00, 0x17, 0x5D, 0x00, 0x2F, 0x55, 0x00, 0x2F, 0x5D, 0x00, 0x17, 0x00,
+  0x17, 0x5C, 0x00, 0x2F, 0x57, 0x00, 0x2F, 0x5C, 0x00, 0x17, 0x00, 0x17, 0x5B, 0x00, 0x2F, 0x59,
+  0x00, 0x2F, 0x5B, 0x00, 0x17, 0x00, 0x18, 0x59, 0x00, 0x2F, 0x5B, 0x00, 0x2F, 0x59, 0x00, 0x18,
+  0x00, 0x19, 0x57, 0x00, 0x30, 0x5B, 0x00, 0x30, 0x57, 0x00, 0x19, 0x00, 0x1A, 0x55, 0x00, 0x31,
+  0x5B, 0x00, 0x31, 0x55, 0x00, 0x1A, 0x00, 0x50, 0x5B, 0x00, 0x50, 0x00, 0x50, 0x5B, 0x00, 0x50,
+  0x00, 0x50, 0x5A, 0x00, 0x51, 0x00, 0x50, 0x5A, 0x00, 0x51, 0x00, 0x50, 0x5A, 0x00, 0x51, 0x00,
+  0x50, 0x5A, 0x00, 0x51, 0x00, 0x50, 0x5A, 0x00, 0x51, 0x00, 0x50, 0x5A, 0x00, 0x51, 0x00, 0x50,
+  0x5A, 0x00, 0x51, 0x00, 0x50, 0x5A, 0x00, 0x51, 0x00, 0x50, 0x5A, 0x00, 0x51, 0x00, 0x50, 0x5A,
+  0x00, 0x51, 0x00, 0x50, 0x5A, 0x00, 0x51, 0x00, 0x50, 0x5A, 0x00, 0x51, 0x00, 0x50, 0x5A, 0x00,
+  0x51, 0x00, 0x50, 0x5B, 0x00, 0x50, 0x00, 0x50, 0x5B, 0x00, 0x50, 0x00, 0x50, 0x5B, 0x00, 0x50,
+  0x00, 0x50, 0x5B, 0x00, 0x50, 0x00, 0x50, 0x5B, 0x00, 0x50, 0x00, 0x51, 0x59, 0x00, 0x51, 0x00,
+  0x52, 0x57, 0x00, 0x52, 0x00, 0x53, 0x55, 0x00, 0x53, 0x00, 0x2F, 0x2B, 0x00, 0x6B, 0x00, 0x2B,
+  0x20, 0x13, 0x00, 0x67, 0x00, 0x28, 0x20, 0x19, 0x00, 0x64, 0x00, 0x26, 0x20, 0x1D, 0x00, 0x62,
+  0x00, 0x24, 0x20, 0x21, 0x00, 0x60, 0x00, 0x23, 0x20, 0x23, 0x00, 0x5F, 0x00, 0x21, 0x20, 0x27,
+  0x00, 0x5D, 0x00, 0x20, 0x20, 0x29, 0x00, 0x5C, 0x00, 0x1F, 0x20, 0x2B, 0x00, 0x5B, 0x00, 0x1E,
+  0x20, 0x2D, 0x00, 0x5A, 0x00, 0x1D, 0x20, 0x2F, 0x00, 0x59, 0x00, 0x1C, 0x20, 0x31, 0x00, 0x58,
+  0x00, 0x1B, 0x20, 0x33, 0x00, 0x57, 0x00, 0x1A, 0x20, 0x35, 0x00, 0x56, 0x00, 0x1A, 0x20, 0x35,
+  0x00, 0x56, 0x00, 0x19, 0x20, 0x37, 0x00, 0x55, 0x00, 0x18, 0x20, 0x39, 0x00, 0x54, 0x00, 0x18,
+  0x20, 0x39, 0x00, 0x54, 0x00, 0x17, 0x20, 0x3B, 0x00, 0x53, 0x00, 0x17, 0x20, 0x3B, 0x00, 0x53,
+  0x00, 0x16, 0x20, 0x3D, 0x00, 0x52, 0x00, 0x16, 0x20, 0x3D, 0x00, 0x52, 0x00, 0x16, 0x20, 0x3D,
+  0x00, 0x52, 0x00, 0x15, 0x20, 0x3F, 0x00, 0x51, 0x00, 0x12, 0x20, 0x42, 0x00, 0x51, 0x0F, 0x20,
+  0x4A, 0x00, 0x4C, 0x0C, 0x20, 0x51, 0x00, 0x48, 0x0B, 0x20, 0x54, 0x00, 0x46, 0x09, 0x20, 0x58,
+  0x00, 0x44, 0x08, 0x20, 0x4E, 0x1D, 0x00, 0x42, 0x07, 0x20, 0x4A, 0x10, 0x17, 0x00, 0x3D, 0x06,
+  0x20, 0x48, 0x10, 0x1D, 0x00, 0x3A, 0x05, 0x20, 0x47, 0x10, 0x21, 0x00, 0x38, 0x04, 0x20, 0x46,
+  0x10, 0x25, 0x00, 0x36, 0x04, 0x20, 0x44, 0x10, 0x29, 0x00, 0x34, 0x03, 0x20, 0x43, 0x10, 0x2D,
+  0x00, 0x32, 0x02, 0x20, 0x43, 0x10, 0x2F, 0x00, 0x31, 0x02, 0x20, 0x41, 0x10, 0x33, 0x00, 0x2F,
+  0x02, 0x20, 0x40, 0x10, 0x35, 0x00, 0x2E, 0x01, 0x20, 0x40, 0x10, 0x37, 0x00, 0x2D, 0x01, 0x20,
+  0x3F, 0x10, 0x39, 0x00, 0x2C, 0x01, 0x20, 0x3E, 0x10, 0x3B, 0x00, 0x2B, 0x20, 0x3E, 0x10, 0x3D,
+  0x00, 0x2A, 0x20, 0x3D, 0x10, 0x3F, 0x00, 0x29, 0x20, 0x3C, 0x10, 0x41, 0x00, 0x28, 0x20, 0x3B,
+  0x10, 0x43, 0x00, 0x27, 0x20, 0x3A, 0x10, 0x45, 0x00, 0x26, 0x20, 0x3A, 0x10, 0x45, 0x00, 0x26,
+  0x20, 0x39, 0x10, 0x47, 0x00, 0x25, 0x20, 0x38, 0x10, 0x49, 0x00, 0x24, 0x20, 0x38, 0x10, 0x49,
+  0x00, 0x24, 0x01, 0x20, 0x36, 0x10, 0x4B, 0x00, 0x23, 0x01, 0x20, 0x36, 0x10, 0x4B, 0x00, 0x23,
+  0x01, 0x20, 0x35, 0x10, 0x4D, 0x00, 0x22, 0x01, 0x20, 0x35, 0x10, 0x4D, 0x00, 0x22, 0x01, 0x20,
+  0x34, 0x10, 0x4F, 0x00, 0x21, 0x20, 0x35, 0x10, 0x4F, 0x00, 0x21, 0x20, 0x34, 0x10, 0x51, 0x00,
+  0x20, 0x20, 0x34, 0x10, 0x51, 0x00, 0x20, 0x20, 0x34, 0x10, 0x51, 0x00, 0x20, 0x20, 0x33, 0x10,
+  0x53, 0x00, 0x1F, 0x20, 0x2F, 0x10, 0x57, 0x00, 0x1F, 0x20, 0x2B, 0x10, 0x61, 0x00, 0x19, 0x01,
+  0x20, 0x28, 0x10, 0x67, 0x00, 0x15, 0x01, 0x20, 0x26, 0x10, 0x6B, 0x00, 0x13, 0x02, 0x20, 0x23,
+  0x10, 0x70, 0x00, 0x10, 0x02, 0x20, 0x22, 0x10, 0x72, 0x0F, 0x03, 0x20, 0x1F, 0x10, 0x76, 0x0D,
+  0x04, 0x20, 0x1D, 0x10, 0x78, 0x0C, 0x05, 0x20, 0x1B, 0x10, 0x7A, 0x0B, 0x07, 0x20, 0x18, 0x10,
+  0x7C, 0x0A, 0x09, 0x20, 0x15, 0x10, 0x7E, 0x09, 0x00, 0x1D, 0x10, 0x80, 0x08, 0x00, 0x1D, 0x10,
+  0x81, 0x07, 0x00, 0x1C, 0x10, 0x83, 0x06, 0x00, 0x1B, 0x10, 0x85, 0x05, 0x00, 0x1B, 0x10, 0x85,
+  0x05, 0x00, 0x1A, 0x10, 0x87, 0x04, 0x00, 0x1A, 0x10, 0x88, 0x03, 0x00, 0x19, 0x10, 0x89, 0x03,
+  0x00, 0x19, 0x10, 0x89, 0x03, 0x00, 0x18, 0x10, 0x8B, 0x02, 0x00, 0x18, 0x10, 0x8B, 0x02, 0x00,
+  0x18, 0x10, 0x8C, 0x01, 0x00, 0x18, 0x10, 0x8C, 0x01, 0x00, 0x17, 0x10, 0x8D, 0x01, 0x00, 0x17,
+  0x10, 0x8D, 0x01, 0x00, 0x17, 0x10, 0x8E, 0x00, 0x17, 0x10, 0x8E, 0x00, 0x17, 0x10, 0x8E, 0x00,
+  0x17, 0x10, 0x8E, 0x00, 0x17, 0x10, 0x8E, 0x00, 0x17, 0x10, 0x8E, 0x00, 0x17, 0x10, 0x8E, 0x00,
+  0x17, 0x10, 0x8E, 0x00, 0x17, 0x10, 0x8E, 0x00, 0x18, 0x10, 0x8D, 0x00, 0x18, 0x10, 0x8D, 0x00,
+  0x18, 0x10, 0x8C, 0x01, 0x00, 0x18, 0x10, 0x8C, 0x01, 0x00, 0x19, 0x10, 0x8B, 0x01, 0x00, 0x19,
+  0x10, 0x8B, 0x01, 0x00, 0x19, 0x10, 0x8B, 0x01, 0x00, 0x19, 0x10, 0x8B, 0x01, 0x00, 0x18, 0x10,
+  0x8D, 0x00, 0x18, 0x10, 0x8D, 0x00, 0x18, 0x10, 0x8D, 0x00, 0x18, 0x10, 0x8D, 0x00, 0x18, 0x10,
+  0x8D, 0x00, 0x18, 0x10, 0x8D, 0x00, 0x18, 0x10, 0x8D, 0x00, 0x19, 0x10, 0x8B, 0x01, 0x00, 0x19,
+  0x10, 0x8B, 0x01, 0x00, 0x19, 0x10, 0x8B, 0x01, 0x00, 0x1A, 0x10, 0x89, 0x02, 0x00, 0x1A, 0x10,
+  0x89, 0x02, 0x00, 0x1B, 0x10, 0x87, 0x03, 0x00, 0x1C, 0x10, 0x85, 0x04, 0x00, 0x1D, 0x10, 0x83,
+  0x05, 0x00, 0x1E, 0x10, 0x81, 0x06, 0x00, 0x1F, 0x10, 0x7F, 0x07, 0x00, 0x21, 0x10, 0x7B, 0x09,
+  0x00, 0x24, 0x10, 0x75, 0x0C, 0x00, 0x3F, 0x1D, 0x00, 0x42, 0x00, 0x3A, 0x10, 0x17, 0x00, 0x3D,
+  0x00, 0x37, 0x10, 0x1D, 0x00, 0x3A, 0x00, 0x35, 0x10, 0x21, 0x00, 0x38, 0x00, 0x33, 0x10, 0x25,
+  0x00, 0x36, 0x00, 0x31, 0x10, 0x29, 0x00, 0x34, 0x00, 0x2F, 0x10, 0x2D, 0x00, 0x32, 0x00, 0x2E,
+  0x10, 0x2F, 0x00, 0x31, 0x00, 0x2C, 0x10, 0x33, 0x00, 0x2F, 0x00, 0x2B, 0x10, 0x35, 0x00, 0x2E,
+  0x00, 0x2A, 0x10, 0x37, 0x00, 0x2D, 0x00, 0x29, 0x10, 0x39, 0x00, 0x2C, 0x00, 0x28, 0x10, 0x3B,
+  0x00, 0x2B, 0x00, 0x27, 0x10, 0x3D, 0x00, 0x2A, 0x00, 0x26, 0x10, 0x3F, 0x00, 0x29, 0x00, 0x25,
+  0x10, 0x41, 0x00, 0x28, 0x00, 0x24, 0x10, 0x43, 0x00, 0x27, 0x00, 0x23, 0x10, 0x45, 0x00, 0x26,
+  0x00, 0x23, 0x10, 0x45, 0x00, 0x26, 0x00, 0x22, 0x10, 0x47, 0x00, 0x25, 0x00, 0x21, 0x10, 0x49,
+  0x00, 0x24, 0x00, 0x21, 0x10, 0x49, 0x00, 0x24, 0x00, 0x20, 0x10, 0x4B, 0x00, 0x23, 0x00, 0x20,
+  0x10, 0x4B, 0x00, 0x23, 0x00, 0x1F, 0x10, 0x4D, 0x00, 0x22, 0x00, 0x1F, 0x10, 0x4D, 0x00, 0x22,
+  0x00, 0x1E, 0x10, 0x4F, 0x00, 0x21, 0x00, 0x1E, 0x10, 0x4F, 0x00, 0x21, 0x00, 0x1D, 0x10, 0x51,
+  0x00, 0x20, 0x00, 0x1D, 0x10, 0x51, 0x00, 0x20, 0x00, 0x1D, 0x10, 0x51, 0x00, 0x20, 0x00, 0x1C,
+  0x10, 0x53, 0x00, 0x1F, 0x00, 0x18, 0x10, 0x57, 0x00, 0x1F, 0x00, 0x14, 0x10, 0x61, 0x00, 0x19,
+  0x00, 0x12, 0x10, 0x67, 0x00, 0x15, 0x00, 0x10, 0x10, 0x6B, 0x00, 0x13, 0x0E, 0x10, 0x70, 0x00,
+  0x10, 0x0D, 0x10, 0x72, 0x0F, 0x0B, 0x10, 0x76, 0x0D, 0x0A, 0x10, 0x78, 0x0C, 0x09, 0x10, 0x7A,
+  0x0B, 0x08, 0x10, 0x7C, 0x0A, 0x07, 0x10, 0x7E, 0x09, 0x06, 0x10, 0x80, 0x08, 0x06, 0x10, 0x81,
+  0x07, 0x05, 0x10, 0x83, 0x06, 0x04, 0x10, 0x85, 0x05, 0x04, 0x10, 0x85, 0x05, 0x03, 0x10, 0x87,
+  0x04, 0x03, 0x10, 0x88, 0x03, 0x02, 0x10, 0x89, 0x03, 0x02, 0x10, 0x89, 0x03, 0x01, 0x10, 0x8B,
+  0x02, 0x01, 0x10, 0x8B, 0x02, 0x01, 0x10, 0x8C, 0x01, 0x01, 0x10, 0x8C, 0x01, 0x10, 0x8D, 0x01,
+  0x10, 0x8D, 0x01, 0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x10,
+  0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8C, 0x01, 0x01,
+  0x10, 0x8C, 0x01, 0x02, 0x10, 0x8B, 0x01, 0x02, 0x10, 0x8B, 0x01, 0x02, 0x10, 0x8B, 0x01, 0x02,
+  0x10, 0x8B, 0x01, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01,
+  0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x02, 0x10, 0x8B, 0x01, 0x02, 0x10, 0x8B, 0x01,
+  0x02, 0x10, 0x8B, 0x01, 0x03, 0x10, 0x89, 0x02, 0x03, 0x10, 0x89, 0x02, 0x04, 0x10, 0x87, 0x03,
+  0x05, 0x10, 0x85, 0x04, 0x06, 0x10, 0x83, 0x05, 0x07, 0x10, 0x81, 0x06, 0x08, 0x10, 0x7F, 0x07,
+  0x0A, 0x10, 0x7B, 0x09, 0x0D, 0x10, 0x75, 0x0C, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E,
+  0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E,
+  0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E,
+  0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x13, 0x65, 0x00, 0x3B, 0x65,
+  0x00, 0x36, 0x00, 0x12, 0x67, 0x00, 0x39, 0x67, 0x00, 0x35, 0x00, 0x11, 0x69, 0x00, 0x37, 0x69,
+  0x00, 0x34, 0x00, 0x10, 0x6B, 0x00, 0x35, 0x6B, 0x00, 0x33, 0x0F, 0x6D, 0x00, 0x33, 0x6D, 0x00,
+  0x32, 0x0F, 0x6D, 0x00, 0x33, 0x6D, 0x00, 0x32, 0x0F, 0x6D, 0x00, 0x33, 0x6D, 0x00, 0x32, 0x0F,
+  0x6D, 0x00, 0x33, 0x6D, 0x00, 0x32, 0x0F, 0x6D, 0x00, 0x33, 0x6D, 0x00, 0x32, 0x00, 0x10, 0x6B,
+  0x00, 0x35, 0x6B, 0x00, 0x33, 0x00, 0x11, 0x69, 0x00, 0x37, 0x69, 0x00, 0x34, 0x00, 0x12, 0x67,
+  0x00, 0x39, 0x67, 0x00, 0x35, 0x00, 0x13, 0x65, 0x00, 0x3B, 0x65, 0x00, 0x36, 0x00, 0x8E, 0x00,
+  0x8E, 0x00, 0x8E, 0x00, 0x33, 0x65, 0x00, 0x3B, 0x65, 0x00, 0x16, 0x00, 0x32, 0x67, 0x00, 0x39,
+  0x67, 0x00, 0x15, 0x00, 0x31, 0x69, 0x00, 0x37, 0x69, 0x00, 0x14, 0x00, 0x30, 0x6B, 0x00, 0x35,
+  0x6B, 0x00, 0x13, 0x00, 0x2F, 0x6D, 0x00, 0x33, 0x6D, 0x00, 0x12, 0x00, 0x2F, 0x6D, 0x00, 0x33,
+  0x6D, 0x00, 0x12, 0x00, 0x2F, 0x6D, 0x00, 0x33, 0x6D, 0x00, 0x12, 0x00, 0x2F, 0x6D, 0x00, 0x33,
+  0x6D, 0x00, 0x12, 0x00, 0x2F, 0x6D, 0x00, 0x33, 0x6D, 0x00, 0x12, 0x00, 0x30, 0x6B, 0x00, 0x35,
+  0x6B, 0x00, 0x13, 0x00, 0x31, 0x69, 0x00, 0x37, 0x69, 0x00, 0x14, 0x00, 0x32, 0x67, 0x00, 0x39,
+  0x67, 0x00, 0x15, 0x00, 0x33, 0x65, 0x00, 0x3B, 0x65, 0x00, 0x16, 0x00, 0x46, 0x2D, 0x00, 0x46,
+  0x00, 0x42, 0x20, 0x15, 0x00, 0x42, 0x00, 0x3F, 0x20, 0x1B, 0x00, 0x3F, 0x00, 0x3D, 0x20, 0x1F,
+  0x00, 0x3D, 0x00, 0x3B, 0x20, 0x23, 0x00, 0x3B, 0x00, 0x39, 0x20, 0x27, 0x00, 0x39, 0x00, 0x38,
+  0x20, 0x29, 0x00, 0x38, 0x00, 0x36, 0x20, 0x2D, 0x00, 0x36, 0x00, 0x35, 0x20, 0x2F, 0x00, 0x35,
+  0x00, 0x34, 0x20, 0x31, 0x00, 0x34, 0x00, 0x33, 0x20, 0x33, 0x00, 0x33, 0x00, 0x32, 0x20, 0x35,
+  0x00, 0x32, 0x00, 0x31, 0x20, 0x37, 0x00, 0x31, 0x00, 0x30, 0x20, 0x39, 0x00, 0x30, 0x00, 0x2F,
+  0x20, 0x3B, 0x00, 0x2F, 0x00, 0x2E, 0x20, 0x3D, 0x00, 0x2E, 0x00, 0x2E, 0x20, 0x3D, 0x00, 0x2E,
+  0x00, 0x2D, 0x20, 0x3F, 0x00, 0x2D, 0x00, 0x2C, 0x20, 0x41, 0x00, 0x2C, 0x00, 0x2C, 0x20, 0x41,
+  0x00, 0x2C, 0x00, 0x2B, 0x20, 0x43, 0x00, 0x2B, 0x00, 0x2B, 0x20, 0x43, 0x00, 0x2B, 0x00, 0x2A,
+  0x20, 0x45, 0x00, 0x2A, 0x00, 0x2A, 0x20, 0x45, 0x00, 0x2A, 0x00, 0x29, 0x20, 0x47, 0x00, 0x29,
+  0x00, 0x29, 0x20, 0x47, 0x00, 0x29, 0x00, 0x29, 0x20, 0x47, 0x00, 0x29, 0x00, 0x28, 0x20, 0x49,
+  0x00, 0x28, 0x00, 0x23, 0x20, 0x4E, 0x00, 0x28, 0x00, 0x20, 0x20, 0x57, 0x00, 0x22, 0x00, 0x1D,
+  0x20, 0x5D, 0x00, 0x1F, 0x00, 0x1B, 0x20, 0x62, 0x00, 0x1C, 0x00, 0x1A, 0x20, 0x65, 0x00, 0x1A,
+  0x00, 0x19, 0x20, 0x67, 0x00, 0x19, 0x00, 0x17, 0x20, 0x6B, 0x00, 0x17, 0x00, 0x16, 0x20, 0x6D,
+  0x00, 0x16, 0x00, 0x15, 0x20, 0x6F, 0x00, 0x15, 0x00, 0x14, 0x20, 0x71, 0x00, 0x14, 0x00, 0x14,
+  0x20, 0x72, 0x00, 0x13, 0x00, 0x13, 0x20, 0x74, 0x00, 0x12, 0x00, 0x12, 0x20, 0x76, 0x00, 0x11,
+  0x00, 0x11, 0x20, 0x77, 0x00, 0x11, 0x00, 0x11, 0x20, 0x78, 0x00, 0x10, 0x00, 0x10, 0x20, 0x7A,
+  0x0F, 0x00, 0x10, 0x20, 0x7A, 0x0F, 0x00, 0x10, 0x20, 0x7B, 0x0E, 0x0F, 0x20, 0x7C, 0x0E, 0x0F,
+  0x20, 0x7C, 0x0E, 0x0F, 0x20, 0x7D, 0x0D, 0x0E, 0x20, 0x7E, 0x0D, 0x0E, 0x20, 0x7E, 0x0D, 0x0E,
+  0x20, 0x7F, 0x0C, 0x0E, 0x20, 0x7F, 0x0C, 0x0E, 0x20, 0x7F, 0x0C, 0x0E, 0x20, 0x7F, 0x0C, 0x0E,
+  0x20, 0x7F, 0x0C, 0x0E, 0x20, 0x7F, 0x0C, 0x0E, 0x20, 0x7F, 0x0C, 0x0E, 0x20, 0x7F, 0x0C, 0x0E,
+  0x20, 0x7F, 0x0C, 0x0F, 0x20, 0x7E, 0x0C, 0x0F, 0x20, 0x7E, 0x0C, 0x0F, 0x20, 0x7D, 0x0D, 0x0F,
+  0x20, 0x7E, 0x0C, 0x0F, 0x20, 0x7E, 0x0C, 0x0F, 0x20, 0x7E, 0x0C, 0x0E, 0x20, 0x80, 0x0B, 0x0E,
+  0x20, 0x80, 0x0B, 0x0E, 0x20, 0x80, 0x0B, 0x0E, 0x20, 0x80, 0x0B, 0x0E, 0x20, 0x80, 0x0B, 0x0E,
+  0x20, 0x80, 0x0B, 0x0E, 0x20, 0x80, 0x0B, 0x0F, 0x20, 0x7E, 0x0C, 0x0F, 0x20, 0x7E, 0x0C, 0x0F,
+  0x20, 0x7E, 0x0C, 0x00, 0x10, 0x20, 0x7C, 0x0D, 0x00, 0x11, 0x20, 0x7A, 0x0E, 0x00, 0x11, 0x20,
+  0x7A, 0x0E, 0x00, 0x12, 0x20, 0x78, 0x0F, 0x00, 0x13, 0x20, 0x76, 0x00, 0x10, 0x00, 0x15, 0x20,
+  0x72, 0x00, 0x12, 0x00, 0x16, 0x20, 0x70, 0x00, 0x13, 0x00, 0x19, 0x20, 0x6A, 0x00, 0x16, 0x00,
+  0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x04, 0x10, 0x91, 0x04, 0x03, 0x10, 0x93, 0x03, 0x02, 0x10, 0x95, 0x02, 0x01, 0x10, 0x97,
+  0x01, 0x10, 0x99, 0x10, 0x99, 0x10, 0x99, 0x10, 0x99, 0x10, 0x99, 0x01, 0x10, 0x97, 0x01, 0x02,
+  0x10, 0x95, 0x02, 0x03, 0x10, 0x93, 0x03, 0x04, 0x10, 0x91, 0x04, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x0E, 0x10, 0x7D, 0x0E, 0x0D, 0x10, 0x7F, 0x0D, 0x0C, 0x10, 0x81, 0x0C, 0x0B, 0x10, 0x83,
+  0x0B, 0x0A, 0x10, 0x85, 0x0A, 0x0A, 0x10, 0x85, 0x0A, 0x0A, 0x10, 0x85, 0x0A, 0x0A, 0x10, 0x85,
+  0x0A, 0x0A, 0x10, 0x85, 0x0A, 0x0B, 0x10, 0x83, 0x0B, 0x0C, 0x10, 0x81, 0x0C, 0x0D, 0x10, 0x7F,
+  0x0D, 0x0E, 0x10, 0x7D, 0x0E, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00,
+  0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x99, 0x00, 0x18, 0x10, 0x69, 0x00,
+  0x18, 0x00, 0x17, 0x10, 0x6B, 0x00, 0x17, 0x00, 0x16, 0x10, 0x6D, 0x00, 0x16, 0x00, 0x15, 0x10,
+  0x6F, 0x00, 0x15, 0x00, 0x14, 0x10, 0x71, 0x00, 0x14, 0x00, 0x14, 0x10, 0x71, 0x00, 0x14, 0x00,
+  0x14, 0x10, 0x71, 0x00, 0x14, 0x00, 0x14, 0x10, 0x71, 0x00, 0x14, 0x00, 0x14, 0x10, 0x71, 0x00,
+  0x14, 0x00, 0x15, 0x10, 0x6F, 0x00, 0x15, 0x00, 0x16, 0x10, 0x6D, 0x00, 0x16, 0x00, 0x17, 0x10,
+  0x6B, 0x00, 0x17, 0x00, 0x18, 0x10, 0x69, 0x00, 0x18, 0x00, 0x3F, 0x2D, 0x00, 0x42, 0x00, 0x3A,
+  0x20, 0x17, 0x00, 0x3D, 0x00, 0x37, 0x20, 0x1D, 0x00, 0x3A, 0x00, 0x35, 0x20, 0x21, 0x00, 0x38,
+  0x00, 0x33, 0x20, 0x25, 0x00, 0x36, 0x00, 0x31, 0x20, 0x29, 0x00, 0x34, 0x00, 0x2F, 0x20, 0x2D,
+  0x00, 0x32, 0x00, 0x2E, 0x20, 0x2F, 0x00, 0x31, 0x00, 0x2C, 0x20, 0x33, 0x00, 0x2F, 0x00, 0x2B,
+  0x20, 0x35, 0x00, 0x2E, 0x00, 0x2A, 0x20, 0x37, 0x00, 0x2D, 0x00, 0x29, 0x20, 0x39, 0x00, 0x2C,
+  0x00, 0x28, 0x20, 0x3B, 0x00, 0x2B, 0x00, 0x27, 0x20, 0x3D, 0x00, 0x2A, 0x00, 0x26, 0x20, 0x3F,
+  0x00, 0x29, 0x00, 0x25, 0x20, 0x41, 0x00, 0x28, 0x00, 0x24, 0x20, 0x43, 0x00, 0x27, 0x00, 0x23,
+  0x20, 0x45, 0x00, 0x26, 0x00, 0x23, 0x20, 0x45, 0x00, 0x26, 0x00, 0x22, 0x20, 0x47, 0x00, 0x25,
+  0x00, 0x21, 0x20, 0x49, 0x00, 0x24, 0x00, 0x21, 0x20, 0x49, 0x00, 0x24, 0x00, 0x20, 0x20, 0x4B,
+  0x00, 0x23, 0x00, 0x20, 0x20, 0x4B, 0x00, 0x23, 0x00, 0x1F, 0x20, 0x4D, 0x00, 0x22, 0x00, 0x1F,
+  0x20, 0x4D, 0x00, 0x22, 0x00, 0x1E, 0x20, 0x4F, 0x00, 0x21, 0x00, 0x1E, 0x20, 0x4F, 0x00, 0x21,
+  0x00, 0x1D, 0x20, 0x51, 0x00, 0x20, 0x00, 0x1D, 0x20, 0x51, 0x00, 0x20, 0x00, 0x1D, 0x20, 0x51,
+  0x00, 0x20, 0x00, 0x1C, 0x20, 0x53, 0x00, 0x1F, 0x00, 0x18, 0x20, 0x57, 0x00, 0x1F, 0x00, 0x14,
+  0x20, 0x61, 0x00, 0x19, 0x00, 0x12, 0x20, 0x67, 0x00, 0x15, 0x00, 0x10, 0x20, 0x6B, 0x00, 0x13,
+  0x0E, 0x20, 0x70, 0x00, 0x10, 0x0D, 0x20, 0x72, 0x0F, 0x0B, 0x20, 0x76, 0x0D, 0x0A, 0x20, 0x78,
+  0x0C, 0x09, 0x20, 0x7A, 0x0B, 0x08, 0x20, 0x7C, 0x0A, 0x07, 0x20, 0x7E, 0x09, 0x06, 0x20, 0x80,
+  0x08, 0x06, 0x20, 0x81, 0x07, 0x05, 0x20, 0x83, 0x06, 0x04, 0x20, 0x85, 0x05, 0x04, 0x20, 0x85,
+  0x05, 0x03, 0x20, 0x87, 0x04, 0x03, 0x20, 0x88, 0x03, 0x02, 0x20, 0x89, 0x03, 0x02, 0x20, 0x89,
+  0x03, 0x01, 0x20, 0x8B, 0x02, 0x01, 0x20, 0x8B, 0x02, 0x01, 0x20, 0x8C, 0x01, 0x01, 0x20, 0x8C,
+  0x01, 0x20, 0x8D, 0x01, 0x20, 0x8D, 0x01, 0x20, 0x8E, 0x20, 0x8E, 0x20, 0x8E, 0x20, 0x8E, 0x20,
+  0x8E, 0x20, 0x8E, 0x20, 0x8E, 0x20, 0x8E, 0x20, 0x8E, 0x01, 0x20, 0x8D, 0x01, 0x20, 0x8D, 0x01,
+  0x20, 0x8C, 0x01, 0x01, 0x20, 0x8C, 0x01, 0x02, 0x20, 0x8B, 0x01, 0x02, 0x20, 0x8B, 0x01, 0x02,
+  0x20, 0x8B, 0x01, 0x02, 0x20, 0x8B, 0x01, 0x01, 0x20, 0x8D, 0x01, 0x20, 0x8D, 0x01, 0x20, 0x8D,
+  0x01, 0x20, 0x8D, 0x01, 0x20, 0x8D, 0x01, 0x20, 0x8D, 0x01, 0x20, 0x8D, 0x02, 0x20, 0x8B, 0x01,
+  0x02, 0x20, 0x8B, 0x01, 0x02, 0x20, 0x8B, 0x01, 0x03, 0x20, 0x89, 0x02, 0x03, 0x20, 0x89, 0x02,
+  0x04, 0x20, 0x87, 0x03, 0x05, 0x20, 0x85, 0x04, 0x06, 0x20, 0x83, 0x05, 0x07, 0x20, 0x81, 0x06,
+  0x08, 0x20, 0x7F, 0x07, 0x0A, 0x20, 0x7B, 0x09, 0x0D, 0x20, 0x75, 0x0C, 0x00, 0x8E, 0x00, 0x8E,
+  0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E,
+  0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x14,
+  0x93, 0x00, 0x45, 0x93, 0x00, 0x2F, 0x00, 0x12, 0x97, 0x00, 0x41, 0x97, 0x00, 0x2D, 0x00, 0x12,
+  0x97, 0x00, 0x41, 0x97, 0x00, 0x2D, 0x00, 0x11, 0x99, 0x00, 0x3F, 0x99, 0x00, 0x2C, 0x00, 0x11,
+  0x99, 0x00, 0x3F, 0x99, 0x00, 0x2C, 0x00, 0x11, 0x99, 0x00, 0x3F, 0x99, 0x00, 0x2C, 0x00, 0x10,
+  0x9A, 0x00, 0x3E, 0x9A, 0x00, 0x2C, 0x00, 0x10, 0x9A, 0x00, 0x3E, 0x9A, 0x00, 0x2C, 0x00, 0x10,
+  0x99, 0x00, 0x3F, 0x99, 0x00, 0x2D, 0x0F, 0x9A, 0x00, 0x3E, 0x9A, 0x00, 0x2D, 0x0F, 0x9A, 0x00,
+  0x3E, 0x9A, 0x00, 0x2D, 0x0F, 0x99, 0x00, 0x3F, 0x99, 0x00, 0x2E, 0x0E, 0x9A, 0x00, 0x3E, 0x9A,
+  0x00, 0x2E, 0x0E, 0x9A, 0x00, 0x3E, 0x9A, 0x00, 0x2E, 0x0E, 0x99, 0x00, 0x3F, 0x99, 0x00, 0x2F,
+  0x0D, 0x9A, 0x00, 0x3E, 0x9A, 0x00, 0x2F, 0x0D, 0x9A, 0x00, 0x3E, 0x9A, 0x00, 0x2F, 0x0D, 0x99,
+  0x00, 0x3F, 0x99, 0x00, 0x30, 0x0C, 0x9A, 0x00, 0x3E, 0x9A, 0x00, 0x30, 0x0C, 0x9A, 0x00, 0x1B,
+  0x75, 0x00, 0x1E, 0x9A, 0x00, 0x1B, 0x75, 0x00, 0x10, 0x0B, 0x9A, 0x00, 0x1A, 0x79, 0x00, 0x1B,
+  0x9A, 0x00, 0x1A, 0x79, 0x0E, 0x0B, 0x9A, 0x00, 0x19, 0x7B, 0x00, 0x1A, 0x9A, 0x00, 0x19, 0x7B,
+  0x0D, 0x0B, 0x99, 0x00, 0x19, 0x7D, 0x00, 0x19, 0x99, 0x00, 0x19, 0x7D, 0x0C, 0x0A, 0x9A, 0x00,
+  0x19, 0x7D, 0x00, 0x18, 0x9A, 0x00, 0x19, 0x7D, 0x0C, 0x0A, 0x9A, 0x00, 0x18, 0x7F, 0x00, 0x17,
+  0x9A, 0x00, 0x18, 0x7F, 0x0B, 0x0A, 0x99, 0x00, 0x19, 0x7F, 0x00, 0x17, 0x99, 0x00, 0x19, 0x7F,
+  0x0B, 0x09, 0x9A, 0x00, 0x19, 0x7F, 0x00, 0x16, 0x9A, 0x00, 0x19, 0x7F, 0x0B, 0x09, 0x9A, 0x00,
+  0x19, 0x7F, 0x00, 0x16, 0x9A, 0x00, 0x19, 0x7F, 0x0B, 0x09, 0x99, 0x00, 0x1A, 0x7F, 0x00, 0x16,
+  0x99, 0x00, 0x1A, 0x7F, 0x0B, 0x08, 0x9A, 0x00, 0x1B, 0x7D, 0x00, 0x16, 0x9A, 0x00, 0x1B, 0x7D,
+  0x0C, 0x08, 0x9A, 0x00, 0x1B, 0x7D, 0x00, 0x16, 0x9A, 0x00, 0x1B, 0x7D, 0x0C, 0x08, 0x99, 0x00,
+  0x1D, 0x7B, 0x00, 0x17, 0x99, 0x00, 0x1D, 0x7B, 0x0D, 0x07, 0x9A, 0x00, 0x1E, 0x79, 0x00, 0x17,
+  0x9A, 0x00, 0x1E, 0x79, 0x0E, 0x07, 0x9A, 0x00, 0x20, 0x75, 0x00, 0x19, 0x9A, 0x00, 0x20, 0x75,
+  0x00, 0x10, 0x07, 0x99, 0x00, 0x3F, 0x99, 0x00, 0x36, 0x06, 0x9A, 0x00, 0x3E, 0x9A, 0x00, 0x36,
+  0x06, 0x9A, 0x00, 0x3E, 0x9A, 0x00, 0x36, 0x05, 0x9A, 0x00, 0x3E, 0x9A, 0x00, 0x37, 0x05, 0x9A,
+  0x00, 0x3E, 0x9A, 0x00, 0x37, 0x05, 0x99, 0x00, 0x3F, 0x99, 0x00, 0x38, 0x06, 0x97, 0x00, 0x41,
+  0x97, 0x00, 0x39, 0x06, 0x97, 0x00, 0x41, 0x97, 0x00, 0x39, 0x08, 0x93, 0x00, 0x45, 0x93, 0x00,
+  0x3B, 0x00, 0x43, 0x3D, 0x00, 0x43, 0x00, 0x3E, 0x30, 0x17, 0x00, 0x3E, 0x00, 0x3B, 0x30, 0x1D,
+  0x00, 0x3B, 0x00, 0x39, 0x30, 0x21, 0x00, 0x39, 0x00, 0x37, 0x30, 0x25, 0x00, 0x37, 0x00, 0x35,
+  0x30, 0x29, 0x00, 0x35, 0x00, 0x33, 0x30, 0x2D, 0x00, 0x33, 0x00, 0x32, 0x30, 0x2F, 0x00, 0x32,
+  0x00, 0x30, 0x30, 0x33, 0x00, 0x30, 0x00, 0x2F, 0x30, 0x35, 0x00, 0x2F, 0x00, 0x2E, 0x30, 0x37,
+  0x00, 0x2E, 0x00, 0x2D, 0x30, 0x39, 0x00, 0x2D, 0x00, 0x2C, 0x30, 0x3B, 0x00, 0x2C, 0x00, 0x2B,
+  0x30, 0x3D, 0x00, 0x2B, 0x00, 0x2A, 0x30, 0x3F, 0x00, 0x2A, 0x00, 0x29, 0x30, 0x41, 0x00, 0x29,
+  0x00, 0x28, 0x30, 0x43, 0x00, 0x28, 0x00, 0x27, 0x30, 0x45, 0x00, 0x27, 0x00, 0x27, 0x30, 0x45,
+  0x00, 0x27, 0x00, 0x26, 0x30, 0x47, 0x00, 0x26, 0x00, 0x25, 0x30, 0x49, 0x00, 0x25, 0x00, 0x25,
+  0x30, 0x49, 0x00, 0x25, 0x00, 0x24, 0x30, 0x4B, 0x00, 0x24, 0x00, 0x24, 0x30, 0x4B, 0x00, 0x24,
+  0x00, 0x23, 0x30, 0x4D, 0x00, 0x23, 0x00, 0x23, 0x30, 0x4D, 0x00, 0x23, 0x00, 0x22, 0x30, 0x4F,
+  0x00, 0x22, 0x00, 0x22, 0x30, 0x4F, 0x00, 0x22, 0x00, 0x21, 0x30, 0x51, 0x00, 0x21, 0x00, 0x21,
+  0x30, 0x51, 0x00, 0x21, 0x00, 0x21, 0x30, 0x51, 0x00, 0x21, 0x00, 0x20, 0x30, 0x53, 0x00, 0x20,
+  0x00, 0x1C, 0x30, 0x57, 0x00, 0x20, 0x00, 0x18, 0x30, 0x61, 0x00, 0x1A, 0x00, 0x16, 0x30, 0x67,
+  0x00, 0x16, 0x00, 0x14, 0x30, 0x6B, 0x00, 0x14, 0x00, 0x12, 0x30, 0x70, 0x00, 0x11, 0x00, 0x11,
+  0x30, 0x72, 0x00, 0x10, 0x0F, 0x30, 0x76, 0x0E, 0x0E, 0x30, 0x78, 0x0D, 0x0D, 0x30, 0x7A, 0x0C,
+  0x0C, 0x30, 0x7C, 0x0B, 0x0B, 0x30, 0x7E, 0x0A, 0x0A, 0x30, 0x80, 0x09, 0x0A, 0x30, 0x81, 0x08,
+  0x09, 0x30, 0x83, 0x07, 0x08, 0x30, 0x85, 0x06, 0x08, 0x30, 0x85, 0x06, 0x07, 0x30, 0x87, 0x05,
+  0x07, 0x30, 0x88, 0x04, 0x06, 0x30, 0x89, 0x04, 0x06, 0x30, 0x89, 0x04, 0x05, 0x30, 0x8B, 0x03,
+  0x05, 0x30, 0x8B, 0x03, 0x05, 0x30, 0x8C, 0x02, 0x05, 0x30, 0x8C, 0x02, 0x04, 0x30, 0x8D, 0x02,
+  0x04, 0x30, 0x8D, 0x02, 0x04, 0x30, 0x8E, 0x01, 0x04, 0x30, 0x8E, 0x01, 0x04, 0x30, 0x8E, 0x01,
+  0x04, 0x30, 0x8E, 0x01, 0x04, 0x30, 0x8E, 0x01, 0x04, 0x30, 0x8E, 0x01, 0x04, 0x30, 0x8E, 0x01,
+  0x04, 0x30, 0x8E, 0x01, 0x04, 0x30, 0x8E, 0x01, 0x05, 0x30, 0x8D, 0x01, 0x05, 0x30, 0x8D, 0x01,
+  0x05, 0x30, 0x8C, 0x02, 0x05, 0x30, 0x8C, 0x02, 0x06, 0x30, 0x8B, 0x02, 0x06, 0x30, 0x8B, 0x02,
+  0x06, 0x30, 0x8B, 0x02, 0x06, 0x30, 0x8B, 0x02, 0x05, 0x30, 0x8D, 0x01, 0x05, 0x30, 0x8D, 0x01,
+  0x05, 0x30, 0x8D, 0x01, 0x05, 0x30, 0x8D, 0x01, 0x05, 0x30, 0x8D, 0x01, 0x05, 0x30, 0x8D, 0x01,
+  0x05, 0x30, 0x8D, 0x01, 0x06, 0x30, 0x8B, 0x02, 0x06, 0x30, 0x8B, 0x02, 0x06, 0x30, 0x8B, 0x02,
+  0x07, 0x30, 0x89, 0x03, 0x07, 0x30, 0x89, 0x03, 0x08, 0x30, 0x87, 0x04, 0x09, 0x30, 0x85, 0x05,
+  0x0A, 0x30, 0x83, 0x06, 0x0B, 0x30, 0x81, 0x07, 0x0C, 0x30, 0x7F, 0x08, 0x0E, 0x30, 0x7B, 0x0A,
+  0x00, 0x11, 0x30, 0x75, 0x0D, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00,
+  0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00,
+  0x93, 0x00, 0x13, 0x65, 0x00, 0x13, 0x65, 0x00, 0x13, 0x65, 0x00, 0x13, 0x65, 0x00, 0x13, 0x65,
+  0x00, 0x13, 0x65, 0x03, 0x00, 0x12, 0x67, 0x00, 0x11, 0x67, 0x00, 0x11, 0x67, 0x00, 0x11, 0x67,
+  0x00, 0x11, 0x67, 0x00, 0x11, 0x67, 0x02, 0x00, 0x11, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69,
+  0x0F, 0x69, 0x0F, 0x69, 0x01, 0x00, 0x10, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B,
+  0x0D, 0x6B, 0x00, 0x10, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x00,
+  0x10, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x00, 0x10, 0x6B, 0x0D,
+  0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x00, 0x10, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B,
+  0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x00, 0x10, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E,
+  0x6A, 0x0E, 0x6A, 0x01, 0x00, 0x10, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E,
+  0x6A, 0x01, 0x00, 0x10, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x02,
+  0x0F, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x02, 0x0F, 0x6A, 0x0E,
+  0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x02, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69,
+  0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x03, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F,
+  0x69, 0x0F, 0x69, 0x03, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A,
+  0x03, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x03, 0x0E, 0x69,
+  0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x04, 0x0D, 0x6A, 0x0E, 0x6A, 0x0E,
+  0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x04, 0x0D, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A,
+  0x0E, 0x6A, 0x0E, 0x6A, 0x04, 0x0D, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F,
+  0x69, 0x05, 0x0D, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x05, 0x0C,
+  0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x05, 0x0C, 0x6A, 0x0E, 0x6A,
+  0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x05, 0x0C, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F,
+  0x69, 0x0F, 0x69, 0x0F, 0x69, 0x06, 0x0B, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A,
+  0x0E, 0x6A, 0x06, 0x0B, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x06,
+  0x0B, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x07, 0x0B, 0x69, 0x0F,
+  0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x07, 0x0A, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A,
+  0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x07, 0x0A, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E,
+  0x6A, 0x0E, 0x6A, 0x07, 0x0A, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69,
+  0x08, 0x09, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x08, 0x09, 0x6A,
+  0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x08, 0x09, 0x69, 0x0F, 0x69, 0x0F,
+  0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x09, 0x09, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69,
+  0x0F, 0x69, 0x0F, 0x69, 0x09, 0x08, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E,
+  0x6A, 0x09, 0x08, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x09, 0x08,
+  0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0A, 0x07, 0x6A, 0x0E, 0x6A,
+  0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0A, 0x07, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E,
+  0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0A, 0x07, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69,
+  0x0F, 0x69, 0x0B, 0x07, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0B,
+  0x06, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0B, 0x06, 0x6A, 0x0E,
+  0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0B, 0x06, 0x69, 0x0F, 0x69, 0x0F, 0x69,
+  0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0C, 0x05, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E,
+  0x6A, 0x0E, 0x6A, 0x0C, 0x05, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A,
+  0x0C, 0x05, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0D, 0x05, 0x69,
+  0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0D, 0x04, 0x6A, 0x0E, 0x6A, 0x0E,
+  0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0D, 0x04, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A,
+  0x0E, 0x6A, 0x0E, 0x6A, 0x0D, 0x04, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F,
+  0x69, 0x0E, 0x03, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x03,
+  0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x03, 0x69, 0x0F, 0x69,
+  0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x03, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F,
+  0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x02, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A, 0x0E, 0x6A,
+  0x0E, 0x6A, 0x0F, 0x01, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0F,
+  0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x00, 0x10, 0x6B, 0x0D, 0x6B,
+  0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x00, 0x10, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D,
+  0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x00, 0x10, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B,
+  0x0D, 0x6B, 0x00, 0x10, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x0D, 0x6B, 0x00,
+  0x10, 0x01, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x0F, 0x69, 0x00, 0x11, 0x02,
+  0x67, 0x00, 0x11, 0x67, 0x00, 0x11, 0x67, 0x00, 0x11, 0x67, 0x00, 0x11, 0x67, 0x00, 0x11, 0x67,
+  0x00, 0x12, 0x03, 0x65, 0x00, 0x13, 0x65, 0x00, 0x13, 0x65, 0x00, 0x13, 0x65, 0x00, 0x13, 0x65,
+  0x00, 0x13, 0x65, 0x00, 0x13, 0x00, 0x3F, 0x1D, 0x00, 0x42, 0x00, 0x3A, 0x10, 0x17, 0x00, 0x3D,
+  0x00, 0x37, 0x10, 0x1D, 0x00, 0x3A, 0x00, 0x35, 0x10, 0x21, 0x00, 0x38, 0x00, 0x33, 0x10, 0x25,
+  0x00, 0x36, 0x00, 0x31, 0x10, 0x29, 0x00, 0x34, 0x00, 0x2F, 0x10, 0x2D, 0x00, 0x32, 0x00, 0x2E,
+  0x10, 0x2F, 0x00, 0x31, 0x00, 0x2C, 0x10, 0x33, 0x00, 0x2F, 0x00, 0x2B, 0x10, 0x35, 0x00, 0x2E,
+  0x00, 0x2A, 0x10, 0x37, 0x00, 0x2D, 0x00, 0x29, 0x10, 0x39, 0x00, 0x2C, 0x00, 0x28, 0x10, 0x3B,
+  0x00, 0x2B, 0x00, 0x27, 0x10, 0x3D, 0x00, 0x2A, 0x00, 0x26, 0x10, 0x3F, 0x00, 0x29, 0x00, 0x25,
+  0x10, 0x41, 0x00, 0x28, 0x00, 0x24, 0x10, 0x43, 0x00, 0x27, 0x00, 0x23, 0x10, 0x45, 0x00, 0x26,
+  0x00, 0x23, 0x10, 0x45, 0x00, 0x26, 0x00, 0x22, 0x10, 0x47, 0x00, 0x25, 0x00, 0x21, 0x10, 0x49,
+  0x00, 0x24, 0x00, 0x21, 0x10, 0x49, 0x00, 0x24, 0x00, 0x20, 0x10, 0x4B, 0x00, 0x23, 0x00, 0x20,
+  0x10, 0x4B, 0x00, 0x23, 0x00, 0x1F, 0x10, 0x4D, 0x00, 0x22, 0x00, 0x1F, 0x10, 0x4D, 0x00, 0x22,
+  0x00, 0x1E, 0x10, 0x4F, 0x00, 0x21, 0x00, 0x1E, 0x10, 0x4F, 0x00, 0x21, 0x00, 0x1D, 0x10, 0x51,
+  0x00, 0x20, 0x00, 0x1D, 0x10, 0x51, 0x00, 0x20, 0x00, 0x1D, 0x10, 0x51, 0x00, 0x20, 0x00, 0x1C,
+  0x10, 0x53, 0x00, 0x1F, 0x00, 0x18, 0x10, 0x57, 0x00, 0x1F, 0x00, 0x14, 0x10, 0x61, 0x00, 0x19,
+  0x00, 0x12, 0x10, 0x67, 0x00, 0x15, 0x00, 0x10, 0x10, 0x6B, 0x00, 0x13, 0x0E, 0x10, 0x70, 0x00,
+  0x10, 0x0D, 0x10, 0x72, 0x0F, 0x0B, 0x10, 0x76, 0x0D, 0x0A, 0x10, 0x78, 0x0C, 0x09, 0x10, 0x7A,
+  0x0B, 0x08, 0x10, 0x7C, 0x0A, 0x07, 0x10, 0x7E, 0x09, 0x06, 0x10, 0x80, 0x08, 0x06, 0x10, 0x81,
+  0x07, 0x05, 0x10, 0x83, 0x06, 0x04, 0x10, 0x85, 0x05, 0x04, 0x10, 0x85, 0x05, 0x03, 0x10, 0x87,
+  0x04, 0x03, 0x10, 0x88, 0x03, 0x02, 0x10, 0x89, 0x03, 0x02, 0x10, 0x89, 0x03, 0x01, 0x10, 0x8B,
+  0x02, 0x01, 0x10, 0x8B, 0x02, 0x01, 0x10, 0x8C, 0x01, 0x01, 0x10, 0x8C, 0x01, 0x10, 0x8D, 0x01,
+  0x10, 0x8D, 0x01, 0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x10,
+  0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8C, 0x01, 0x01,
+  0x10, 0x8C, 0x01, 0x02, 0x10, 0x8B, 0x01, 0x02, 0x10, 0x8B, 0x01, 0x02, 0x10, 0x8B, 0x01, 0x02,
+  0x10, 0x8B, 0x01, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01,
+  0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x02, 0x10, 0x8B, 0x01, 0x02, 0x10, 0x8B, 0x01,
+  0x02, 0x10, 0x8B, 0x01, 0x03, 0x10, 0x89, 0x02, 0x03, 0x10, 0x89, 0x02, 0x04, 0x10, 0x87, 0x03,
+  0x05, 0x10, 0x85, 0x04, 0x06, 0x10, 0x83, 0x05, 0x07, 0x10, 0x81, 0x06, 0x08, 0x10, 0x7F, 0x07,
+  0x0A, 0x10, 0x7B, 0x09, 0x0D, 0x10, 0x75, 0x0C, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E,
+  0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E,
+  0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E,
+  0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x0B, 0x75, 0x00, 0x33, 0x75, 0x00, 0x33, 0x75, 0x0E, 0x09,
+  0x79, 0x00, 0x2F, 0x79, 0x00, 0x2F, 0x79, 0x0C, 0x08, 0x7B, 0x00, 0x2D, 0x7B, 0x00, 0x2D, 0x7B,
+  0x0B, 0x07, 0x7D, 0x00, 0x2B, 0x7D, 0x00, 0x2B, 0x7D, 0x0A, 0x06, 0x7F, 0x00, 0x29, 0x7F, 0x00,
+  0x29, 0x7F, 0x09, 0x06, 0x7F, 0x00, 0x29, 0x7F, 0x00, 0x29, 0x7F, 0x09, 0x05, 0x70, 0x11, 0x00,
+  0x27, 0x70, 0x11, 0x00, 0x27, 0x70, 0x11, 0x08, 0x05, 0x70, 0x11, 0x00, 0x27, 0x70, 0x11, 0x00,
+  0x27, 0x70, 0x11, 0x08, 0x05, 0x70, 0x11, 0x00, 0x27, 0x70, 0x11, 0x00, 0x27, 0x70, 0x11, 0x08,
+  0x05, 0x70, 0x11, 0x00, 0x27, 0x70, 0x11, 0x00, 0x27, 0x70, 0x11, 0x08, 0x05, 0x70, 0x11, 0x00,
+  0x27, 0x70, 0x11, 0x00, 0x27, 0x70, 0x11, 0x08, 0x06, 0x7F, 0x00, 0x29, 0x7F, 0x00, 0x29, 0x7F,
+  0x09, 0x06, 0x7F, 0x00, 0x29, 0x7F, 0x00, 0x29, 0x7F, 0x09, 0x07, 0x7D, 0x00, 0x2B, 0x7D, 0x00,
+  0x2B, 0x7D, 0x0A, 0x08, 0x7B, 0x00, 0x2D, 0x7B, 0x00, 0x2D, 0x7B, 0x0B, 0x09, 0x79, 0x00, 0x2F,
+  0x79, 0x00, 0x2F, 0x79, 0x0C, 0x0B, 0x75, 0x00, 0x33, 0x75, 0x00, 0x33, 0x75, 0x0E, 0x00, 0x8E,
+  0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x27, 0x75, 0x00, 0x33, 0x75, 0x00, 0x2A,
+  0x00, 0x25, 0x79, 0x00, 0x2F, 0x79, 0x00, 0x28, 0x00, 0x24, 0x7B, 0x00, 0x2D, 0x7B, 0x00, 0x27,
+  0x00, 0x23, 0x7D, 0x00, 0x2B, 0x7D, 0x00, 0x26, 0x00, 0x22, 0x7F, 0x00, 0x29, 0x7F, 0x00, 0x25,
+  0x00, 0x22, 0x7F, 0x00, 0x29, 0x7F, 0x00, 0x25, 0x00, 0x21, 0x70, 0x11, 0x00, 0x27, 0x70, 0x11,
+  0x00, 0x24, 0x00, 0x21, 0x70, 0x11, 0x00, 0x27, 0x70, 0x11, 0x00, 0x24, 0x00, 0x21, 0x70, 0x11,
+  0x00, 0x27, 0x70, 0x11, 0x00, 0x24, 0x00, 0x21, 0x70, 0x11, 0x00, 0x27, 0x70, 0x11, 0x00, 0x24,
+  0x00, 0x21, 0x70, 0x11, 0x00, 0x27, 0x70, 0x11, 0x00, 0x24, 0x00, 0x22, 0x7F, 0x00, 0x29, 0x7F,
+  0x00, 0x25, 0x00, 0x22, 0x7F, 0x00, 0x29, 0x7F, 0x00, 0x25, 0x00, 0x23, 0x7D, 0x00, 0x2B, 0x7D,
+  0x00, 0x26, 0x00, 0x24, 0x7B, 0x00, 0x2D, 0x7B, 0x00, 0x27, 0x00, 0x25, 0x79, 0x00, 0x2F, 0x79,
+  0x00, 0x28, 0x00, 0x27, 0x75, 0x00, 0x33, 0x75, 0x00, 0x2A, 0x00, 0x4F, 0x55, 0x00, 0x64, 0x00,
+  0x4E, 0x57, 0x00, 0x63, 0x00, 0x4D, 0x59, 0x00, 0x62, 0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00, 0x4C,
+  0x5B, 0x00, 0x61, 0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00, 0x4C, 0x5B,
+  0x00, 0x61, 0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00, 0x4C, 0x5B, 0x00,
+  0x61, 0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00, 0x4C, 0x5B, 0x00, 0x61,
+  0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00,
+  0x4C, 0x5B, 0x00, 0x61, 0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00, 0x4C,
+  0x5B, 0x00, 0x61, 0x00, 0x4C, 0x5B, 0x00, 0x61, 0x00, 0x19, 0x55, 0x00, 0x2E, 0x5B, 0x00, 0x2E,
+  0x55, 0x00, 0x2E, 0x00, 0x18, 0x57, 0x00, 0x2D, 0x5B, 0x00, 0x2D, 0x57, 0x00, 0x2D, 0x00, 0x17,
+  0x59, 0x00, 0x2C, 0x5B, 0x00, 0x2C, 0x59, 0x00, 0x2C, 0x00, 0x16, 0x5B, 0x00, 0x2B, 0x5B, 0x00,
+  0x2B, 0x5B, 0x00, 0x2B, 0x00, 0x16, 0x5B, 0x00, 0x2C, 0x59, 0x00, 0x2C, 0x5B, 0x00, 0x2B, 0x00,
+  0x16, 0x5C, 0x00, 0x2C, 0x57, 0x00, 0x2C, 0x5C, 0x00, 0x2B, 0x00, 0x16, 0x5D, 0x00, 0x2C, 0x55,
+  0x00, 0x2C, 0x5D, 0x00, 0x2B, 0x00, 0x16, 0x5E, 0x00, 0x5B, 0x5E, 0x00, 0x2B, 0x00, 0x17, 0x5E,
+  0x00, 0x59, 0x5E, 0x00, 0x2C, 0x00, 0x18, 0x5E, 0x00, 0x57, 0x5E, 0x00, 0x2D, 0x00, 0x19, 0x5E,
+  0x00, 0x55, 0x5E, 0x00, 0x2E, 0x00, 0x1B, 0x5D, 0x00, 0x53, 0x5D, 0x00, 0x30, 0x00, 0x1C, 0x5D,
+  0x00, 0x51, 0x5D, 0x00, 0x31, 0x00, 0x1D, 0x5E, 0x00, 0x4D, 0x5E, 0x00, 0x32, 0x00, 0x1E, 0x5E,
+  0x00, 0x4B, 0x5E, 0x00, 0x33, 0x00, 0x1F, 0x5E, 0x00, 0x1E, 0x4D, 0x00, 0x1E, 0x5E, 0x00, 0x34,
+  0x00, 0x20, 0x5E, 0x00, 0x18, 0x40, 0x17, 0x00, 0x18, 0x5E, 0x00, 0x35, 0x00, 0x21, 0x5D, 0x00,
+  0x15, 0x40, 0x1D, 0x00, 0x15, 0x5D, 0x00, 0x36, 0x00, 0x22, 0x5C, 0x00, 0x12, 0x40, 0x23, 0x00,
+  0x12, 0x5C, 0x00, 0x37, 0x00, 0x23, 0x5B, 0x00, 0x10, 0x40, 0x27, 0x00, 0x10, 0x5B, 0x00, 0x38,
+  0x00, 0x23, 0x5B, 0x0E, 0x40, 0x2B, 0x0E, 0x5B, 0x00, 0x38, 0x00, 0x24, 0x59, 0x0D, 0x40, 0x2F,
+  0x0D, 0x59, 0x00, 0x39, 0x00, 0x25, 0x57, 0x0D, 0x40, 0x31, 0x0D, 0x57, 0x00, 0x3A, 0x00, 0x26,
+  0x55, 0x0D, 0x40, 0x33, 0x0D, 0x55, 0x00, 0x3B, 0x00, 0x36, 0x40, 0x37, 0x00, 0x4B, 0x00, 0x35,
+  0x40, 0x39, 0x00, 0x4A, 0x00, 0x34, 0x40, 0x3B, 0x00, 0x49, 0x00, 0x33, 0x40, 0x3D, 0x00, 0x48,
+  0x00, 0x32, 0x40, 0x3F, 0x00, 0x47, 0x00, 0x31, 0x40, 0x41, 0x00, 0x46, 0x00, 0x30, 0x40, 0x43,
+  0x00, 0x45, 0x00, 0x2F, 0x40, 0x45, 0x00, 0x44, 0x00, 0x2E, 0x40, 0x47, 0x00, 0x43, 0x00, 0x2E,
+  0x40, 0x47, 0x00, 0x43, 0x00, 0x2D, 0x40, 0x49, 0x00, 0x42, 0x00, 0x2C, 0x40, 0x4B, 0x00, 0x41,
+  0x00, 0x2B, 0x40, 0x4D, 0x00, 0x40, 0x00, 0x2B, 0x40, 0x4D, 0x00, 0x40, 0x00, 0x2A, 0x40, 0x4F,
+  0x00, 0x3F, 0x00, 0x2A, 0x40, 0x4F, 0x00, 0x3F, 0x00, 0x29, 0x40, 0x51, 0x00, 0x3E, 0x00, 0x29,
+  0x40, 0x51, 0x00, 0x3E, 0x00, 0x28, 0x40, 0x53, 0x00, 0x3D, 0x00, 0x28, 0x40, 0x53, 0x00, 0x3D,
+  0x00, 0x28, 0x40, 0x53, 0x00, 0x3D, 0x00, 0x27, 0x40, 0x55, 0x00, 0x3C, 0x00, 0x27, 0x40, 0x55,
+  0x00, 0x3C, 0x00, 0x27, 0x40, 0x55, 0x00, 0x3C, 0x00, 0x26, 0x40, 0x57, 0x00, 0x3B, 0x00, 0x26,
+  0x40, 0x57, 0x00, 0x3B, 0x00, 0x26, 0x40, 0x57, 0x00, 0x3B, 0x00, 0x26, 0x40, 0x57, 0x00, 0x3B,
+  0x00, 0x26, 0x40, 0x57, 0x00, 0x3B, 0x00, 0x25, 0x40, 0x59, 0x00, 0x3A, 0x03, 0x50, 0x17, 0x0B,
+  0x40, 0x59, 0x0B, 0x50, 0x17, 0x00, 0x18, 0x02, 0x50, 0x19, 0x0A, 0x40, 0x59, 0x0A, 0x50, 0x19,
+  0x00, 0x17, 0x01, 0x50, 0x1B, 0x09, 0x40, 0x59, 0x09, 0x50, 0x1B, 0x00, 0x16, 0x50, 0x1D, 0x08,
+  0x40, 0x59, 0x08, 0x50, 0x1D, 0x00, 0x15, 0x50, 0x1D, 0x08, 0x40, 0x59, 0x08, 0x50, 0x1D, 0x00,
+  0x15, 0x50, 0x1D, 0x08, 0x40, 0x59, 0x08, 0x50, 0x1D, 0x00, 0x15, 0x50, 0x1D, 0x08, 0x40, 0x59,
+  0x08, 0x50, 0x1D, 0x00, 0x15, 0x50, 0x1D, 0x08, 0x40, 0x59, 0x08, 0x50, 0x1D, 0x00, 0x15, 0x01,
+  0x50, 0x1B, 0x09, 0x40, 0x59, 0x09, 0x50, 0x1B, 0x00, 0x16, 0x02, 0x50, 0x19, 0x0A, 0x40, 0x59,
+  0x0A, 0x50, 0x19, 0x00, 0x17, 0x03, 0x55, 0x0D, 0x55, 0x0B, 0x40, 0x59, 0x0B, 0x55, 0x0D, 0x55,
+  0x00, 0x18, 0x00, 0x25, 0x40, 0x59, 0x00, 0x3A, 0x00, 0x26, 0x40, 0x57, 0x00, 0x3B, 0x00, 0x26,
+  0x40, 0x57, 0x00, 0x3B, 0x00, 0x26, 0x40, 0x57, 0x00, 0x3B, 0x00, 0x26, 0x40, 0x57, 0x00, 0x3B,
+  0x00, 0x26, 0x40, 0x57, 0x00, 0x3B, 0x00, 0x27, 0x40, 0x55, 0x00, 0x3C, 0x00, 0x27, 0x40, 0x55,
+  0x00, 0x3C, 0x00, 0x27, 0x40, 0x55, 0x00, 0x3C, 0x00, 0x28, 0x40, 0x53, 0x00, 0x3D, 0x00, 0x28,
+  0x40, 0x53, 0x00, 0x3D, 0x00, 0x28, 0x40, 0x53, 0x00, 0x3D, 0x00, 0x29, 0x40, 0x51, 0x00, 0x3E,
+  0x00, 0x29, 0x40, 0x51, 0x00, 0x3E, 0x00, 0x2A, 0x40, 0x4F, 0x00, 0x3F, 0x00, 0x2A, 0x40, 0x4F,
+  0x00, 0x3F, 0x00, 0x2B, 0x40, 0x4D, 0x00, 0x40, 0x00, 0x2B, 0x40, 0x4D, 0x00, 0x40, 0x00, 0x2C,
+  0x40, 0x4B, 0x00, 0x41, 0x00, 0x2D, 0x40, 0x49, 0x00, 0x42, 0x00, 0x2E, 0x40, 0x47, 0x00, 0x43,
+  0x00, 0x2E, 0x40, 0x47, 0x00, 0x43, 0x00, 0x2F, 0x40, 0x45, 0x00, 0x44, 0x00, 0x30, 0x40, 0x43,
+  0x00, 0x45, 0x00, 0x31, 0x40, 0x41, 0x00, 0x46, 0x00, 0x32, 0x40, 0x3F, 0x00, 0x47, 0x00, 0x33,
+  0x40, 0x3D, 0x00, 0x48, 0x00, 0x34, 0x40, 0x3B, 0x00, 0x49, 0x00, 0x35, 0x40, 0x39, 0x00, 0x4A,
+  0x00, 0x36, 0x40, 0x37, 0x00, 0x4B, 0x00, 0x26, 0x55, 0x0D, 0x40, 0x33, 0x0D, 0x55, 0x00, 0x3B,
+  0x00, 0x25, 0x57, 0x0D, 0x40, 0x31, 0x0D, 0x57, 0x00, 0x3A, 0x00, 0x24, 0x59, 0x0D, 0x40, 0x2F,
+  0x0D, 0x59, 0x00, 0x39, 0x00, 0x23, 0x5B, 0x0E, 0x40, 0x2B, 0x0E, 0x5B, 0x00, 0x38, 0x00, 0x23,
+  0x5B, 0x00, 0x10, 0x40, 0x27, 0x00, 0x10, 0x5B, 0x00, 0x38, 0x00, 0x22, 0x5C, 0x00, 0x12, 0x40,
+  0x23, 0x00, 0x12, 0x5C, 0x0C, 0x19, 0x00, 0x22, 0x00, 0x21, 0x5D, 0x00, 0x15, 0x40, 0x1D, 0x00,
+  0x15, 0x5D, 0x08, 0x1F, 0x00, 0x1F, 0x00, 0x20, 0x5E, 0x00, 0x18, 0x40, 0x17, 0x00, 0x18, 0x5E,
+  0x04, 0x10, 0x15, 0x00, 0x1C, 0x00, 0x1F, 0x5E, 0x00, 0x1E, 0x4D, 0x00, 0x1E, 0x5E, 0x02, 0x10,
+  0x17, 0x00, 0x1B, 0x00, 0x1E, 0x5E, 0x00, 0x4B, 0x5D, 0x10, 0x1B, 0x00, 0x19, 0x00, 0x1D, 0x5E,
+  0x00, 0x4D, 0x5B, 0x10, 0x1D, 0x00, 0x18, 0x00, 0x1C, 0x5D, 0x00, 0x51, 0x58, 0x10, 0x1F, 0x00,
+  0x17, 0x00, 0x1B, 0x5D, 0x00, 0x53, 0x56, 0x10, 0x21, 0x00, 0x16, 0x00, 0x19, 0x5E, 0x00, 0x55,
+  0x54, 0x10, 0x23, 0x00, 0x15, 0x00, 0x18, 0x5E, 0x00, 0x57, 0x52, 0x10, 0x25, 0x00, 0x14, 0x00,
+  0x17, 0x5E, 0x00, 0x59, 0x51, 0x10, 0x25, 0x00, 0x14, 0x00, 0x16, 0x5E, 0x00, 0x5A, 0x10, 0x27,
+  0x00, 0x13, 0x00, 0x16, 0x5D, 0x00, 0x2C, 0x55, 0x00, 0x29, 0x10, 0x29, 0x00, 0x12, 0x00, 0x16,
+  0x5C, 0x00, 0x2C, 0x57, 0x00, 0x28, 0x10, 0x29, 0x00, 0x12, 0x00, 0x16, 0x5B, 0x00, 0x2C, 0x59,
+  0x00, 0x27, 0x10, 0x29, 0x00, 0x12, 0x00, 0x16, 0x5B, 0x00, 0x2B, 0x5B, 0x00, 0x25, 0x10, 0x2B,
+  0x00, 0x11, 0x00, 0x17, 0x59, 0x00, 0x2C, 0x5B, 0x00, 0x25, 0x10, 0x2B, 0x00, 0x11, 0x00, 0x18,
+  0x57, 0x00, 0x2D, 0x5B, 0x00, 0x22, 0x10, 0x32, 0x0D, 0x00, 0x19, 0x55, 0x00, 0x2E, 0x5B, 0x00,
+  0x1F, 0x10, 0x38, 0x0A, 0x00, 0x4C, 0x5B, 0x00, 0x1D, 0x10, 0x3C, 0x08, 0x00, 0x4C, 0x5A, 0x00,
+  0x1D, 0x10, 0x3E, 0x07, 0x00, 0x4C, 0x5A, 0x00, 0x1C, 0x10, 0x41, 0x05, 0x00, 0x4C, 0x5A, 0x00,
+  0x1B, 0x10, 0x43, 0x04, 0x00, 0x4C, 0x5A, 0x00, 0x1A, 0x10, 0x44, 0x04, 0x00, 0x4C, 0x5A, 0x00,
+  0x19, 0x10, 0x46, 0x03, 0x00, 0x4C, 0x5A, 0x00, 0x19, 0x10, 0x47, 0x02, 0x00, 0x4C, 0x5A, 0x00,
+  0x18, 0x10, 0x48, 0x02, 0x00, 0x4C, 0x5A, 0x00, 0x18, 0x10, 0x49, 0x01, 0x00, 0x4C, 0x5A, 0x00,
+  0x18, 0x10, 0x49, 0x01, 0x00, 0x4C, 0x5A, 0x00, 0x17, 0x10, 0x4A, 0x01, 0x00, 0x4C, 0x5A, 0x00,
+  0x17, 0x10, 0x4B, 0x00, 0x4C, 0x5A, 0x00, 0x17, 0x10, 0x4B, 0x00, 0x4C, 0x5A, 0x00, 0x17, 0x10,
+  0x4B, 0x00, 0x4C, 0x5B, 0x00, 0x16, 0x10, 0x4B, 0x00, 0x4C, 0x5B, 0x00, 0x16, 0x10, 0x4B, 0x00,
+  0x4C, 0x5B, 0x00, 0x16, 0x10, 0x4B, 0x00, 0x4C, 0x5B, 0x00, 0x17, 0x10, 0x4A, 0x00, 0x4C, 0x5B,
+  0x00, 0x17, 0x10, 0x49, 0x01, 0x00, 0x4D, 0x59, 0x00, 0x18, 0x10, 0x49, 0x01, 0x00, 0x4E, 0x57,
+  0x00, 0x18, 0x10, 0x4B, 0x00, 0x4F, 0x55, 0x00, 0x19, 0x10, 0x4B, 0x00, 0x6D, 0x10, 0x4B, 0x00,
+  0x6D, 0x10, 0x4B, 0x00, 0x6D, 0x10, 0x4B, 0x00, 0x6E, 0x10, 0x49, 0x01, 0x00, 0x6E, 0x10, 0x49,
+  0x01, 0x00, 0x6F, 0x10, 0x47, 0x02, 0x00, 0x70, 0x10, 0x45, 0x03, 0x00, 0x71, 0x10, 0x43, 0x04,
+  0x00, 0x73, 0x10, 0x3F, 0x06, 0x00, 0x3D, 0x55, 0x00, 0x89, 0x00, 0x3C, 0x57, 0x00, 0x88, 0x00,
+  0x3B, 0x59, 0x00, 0x87, 0x00, 0x3A, 0x5B, 0x00, 0x86, 0x00, 0x3A, 0x5B, 0x00, 0x86, 0x00, 0x3A,
+  0x5B, 0x00, 0x86, 0x00, 0x3A, 0x5B, 0x00, 0x86, 0x00, 0x3A, 0x5B, 0x00, 0x86, 0x00, 0x3A, 0x5A,
+  0x00, 0x87, 0x00, 0x3A, 0x5A, 0x00, 0x87, 0x00, 0x3A, 0x5A, 0x00, 0x87, 0x00, 0x3A, 0x5A, 0x00,
+  0x87, 0x00, 0x3A, 0x5A, 0x00, 0x87, 0x00, 0x3A, 0x5A, 0x00, 0x87, 0x00, 0x3A, 0x5A, 0x00, 0x87,
+  0x00, 0x3A, 0x5A, 0x00, 0x87, 0x00, 0x3A, 0x5A, 0x00, 0x87, 0x00, 0x14, 0x55, 0x00, 0x21, 0x5A,
+  0x00, 0x22, 0x55, 0x00, 0x60, 0x00, 0x13, 0x57, 0x00, 0x20, 0x5A, 0x00, 0x21, 0x57, 0x00, 0x5F,
+  0x00, 0x12, 0x59, 0x00, 0x1F, 0x5A, 0x00, 0x20, 0x59, 0x00, 0x5E, 0x00, 0x11, 0x5B, 0x00, 0x1E,
+  0x5A, 0x00, 0x1F, 0x5B, 0x00, 0x5D, 0x00, 0x11, 0x5B, 0x00, 0x1E, 0x5B, 0x00, 0x1E, 0x5B, 0x00,
+  0x5D, 0x00, 0x11, 0x5C, 0x00, 0x1D, 0x5B, 0x00, 0x1D, 0x5C, 0x00, 0x5D, 0x00, 0x11, 0x5D, 0x00,
+  0x1C, 0x5B, 0x00, 0x1C, 0x5D, 0x00, 0x5D, 0x00, 0x11, 0x5E, 0x00, 0x1B, 0x5B, 0x00, 0x1B, 0x5E,
+  0x00, 0x5D, 0x00, 0x12, 0x5E, 0x00, 0x1A, 0x5B, 0x00, 0x1A, 0x5E, 0x00, 0x5E, 0x00, 0x13, 0x5E,
+  0x00, 0x1A, 0x59, 0x00, 0x1A, 0x5E, 0x00, 0x5F, 0x00, 0x14, 0x5E, 0x00, 0x1A, 0x57, 0x00, 0x1A,
+  0x5E, 0x00, 0x60, 0x00, 0x16, 0x5D, 0x00, 0x1A, 0x55, 0x00, 0x1A, 0x5D, 0x00, 0x62, 0x00, 0x17,
+  0x5D, 0x00, 0x37, 0x5D, 0x00, 0x63, 0x00, 0x18, 0x5E, 0x00, 0x33, 0x5E, 0x00, 0x64, 0x00, 0x19,
+  0x5E, 0x00, 0x31, 0x5E, 0x00, 0x65, 0x00, 0x1A, 0x5E, 0x00, 0x2F, 0x5E, 0x00, 0x66, 0x00, 0x1B,
+  0x5E, 0x00, 0x2D, 0x5E, 0x00, 0x67, 0x00, 0x1C, 0x5D, 0x00, 0x2D, 0x5D, 0x00, 0x68, 0x00, 0x1D,
+  0x5C, 0x00, 0x2D, 0x5C, 0x00, 0x69, 0x00, 0x1E, 0x5B, 0x00, 0x2D, 0x5B, 0x00, 0x6A, 0x00, 0x1E,
+  0x5B, 0x00, 0x11, 0x4B, 0x00, 0x11, 0x5B, 0x00, 0x6A, 0x00, 0x1F, 0x59, 0x0F, 0x40, 0x11, 0x0F,
+  0x59, 0x00, 0x6B, 0x00, 0x20, 0x57, 0x0D, 0x40, 0x17, 0x0D, 0x57, 0x00, 0x6C, 0x00, 0x21, 0x55,
+  0x0C, 0x40, 0x1B, 0x0C, 0x55, 0x00, 0x6D, 0x00, 0x31, 0x40, 0x1D, 0x00, 0x7D, 0x00, 0x30, 0x40,
+  0x1F, 0x00, 0x7C, 0x00, 0x2E, 0x40, 0x23, 0x00, 0x7A, 0x00, 0x2D, 0x40, 0x25, 0x00, 0x79, 0x00,
+  0x2C, 0x40, 0x27, 0x00, 0x78, 0x00, 0x2B, 0x40, 0x29, 0x00, 0x77, 0x00, 0x2B, 0x40, 0x29, 0x00,
+  0x77, 0x00, 0x2A, 0x40, 0x2B, 0x00, 0x76, 0x00, 0x29, 0x40, 0x2D, 0x00, 0x75, 0x00, 0x28, 0x40,
+  0x2F, 0x00, 0x74, 0x00, 0x28, 0x40, 0x2C, 0x2B, 0x00, 0x6C, 0x00, 0x27, 0x40, 0x29, 0x20, 0x13,
+  0x00, 0x68, 0x00, 0x27, 0x40, 0x27, 0x20, 0x17, 0x00, 0x66, 0x00, 0x27, 0x40, 0x25, 0x20, 0x1B,
+  0x00, 0x64, 0x00, 0x26, 0x40, 0x24, 0x20, 0x1F, 0x00, 0x62, 0x00, 0x26, 0x40, 0x23, 0x20, 0x21,
+  0x00, 0x61, 0x00, 0x26, 0x40, 0x21, 0x20, 0x25, 0x00, 0x5F, 0x03, 0x50, 0x17, 0x0B, 0x40, 0x21,
+  0x20, 0x27, 0x5F, 0x00, 0x4F, 0x02, 0x50, 0x19, 0x0A, 0x40, 0x20, 0x20, 0x29, 0x5F, 0x00, 0x4E,
+  0x01, 0x50, 0x1B, 0x09, 0x40, 0x1F, 0x20, 0x2B, 0x5F, 0x00, 0x4D, 0x50, 0x1D, 0x08, 0x40, 0x1E,
+  0x20, 0x2D, 0x5F, 0x00, 0x4C, 0x50, 0x1D, 0x08, 0x40, 0x1D, 0x20, 0x2F, 0x5E, 0x00, 0x4C, 0x50,
+  0x1D, 0x08, 0x40, 0x1D, 0x20, 0x2F, 0x5E, 0x00, 0x4C, 0x50, 0x1D, 0x08, 0x40, 0x1C, 0x20, 0x31,
+  0x5D, 0x00, 0x4C, 0x50, 0x1D, 0x08, 0x40, 0x1B, 0x20, 0x33, 0x5C, 0x00, 0x4C, 0x01, 0x50, 0x1B,
+  0x09, 0x40, 0x1B, 0x20, 0x33, 0x5B, 0x00, 0x4D, 0x02, 0x50, 0x19, 0x0A, 0x40, 0x1A, 0x20, 0x35,
+  0x59, 0x00, 0x4E, 0x03, 0x55, 0x0D, 0x55, 0x0B, 0x40, 0x1A, 0x20, 0x35, 0x03, 0x55, 0x00, 0x4F,
+  0x00, 0x26, 0x40, 0x18, 0x20, 0x37, 0x00, 0x56, 0x00, 0x26, 0x40, 0x18, 0x20, 0x37, 0x00, 0x56,
+  0x00, 0x26, 0x40, 0x17, 0x20, 0x39, 0x00, 0x55, 0x00, 0x27, 0x40, 0x16, 0x20, 0x39, 0x00, 0x55,
+  0x00, 0x27, 0x40, 0x13, 0x20, 0x41, 0x00, 0x50, 0x00, 0x27, 0x40, 0x10, 0x20, 0x47, 0x00, 0x4D,
+  0x00, 0x28, 0x4D, 0x20, 0x4B, 0x00, 0x4B, 0x00, 0x28, 0x4B, 0x20, 0x4F, 0x00, 0x49, 0x00, 0x29,
+  0x49, 0x20, 0x51, 0x00, 0x48, 0x00, 0x2A, 0x47, 0x20, 0x4E, 0x1D, 0x00, 0x3F, 0x00, 0x2B, 0x45,
+  0x20, 0x4B, 0x10, 0x15, 0x00, 0x3B, 0x00, 0x2B, 0x44, 0x20, 0x49, 0x10, 0x1B, 0x00, 0x38, 0x00,
+  0x2C, 0x42, 0x20, 0x47, 0x10, 0x21, 0x00, 0x35, 0x00, 0x2D, 0x20, 0x46, 0x10, 0x25, 0x00, 0x33,
+  0x00, 0x2D, 0x20, 0x44, 0x10, 0x29, 0x00, 0x31, 0x00, 0x2C, 0x20, 0x44, 0x10, 0x2B, 0x00, 0x30,
+  0x00, 0x2C, 0x20, 0x42, 0x10, 0x2F, 0x00, 0x2E, 0x00, 0x21, 0x55, 0x05, 0x20, 0x42, 0x10, 0x31,
+  0x00, 0x2D, 0x00, 0x20, 0x57, 0x04, 0x20, 0x41, 0x10, 0x33, 0x00, 0x2C, 0x00, 0x1F, 0x59, 0x03,
+  0x20, 0x3F, 0x10, 0x37, 0x00, 0x2A, 0x00, 0x1E, 0x5B, 0x01, 0x20, 0x3F, 0x10, 0x39, 0x00, 0x29,
+  0x00, 0x1E, 0x5B, 0x01, 0x20, 0x3E, 0x10, 0x3B, 0x00, 0x28, 0x00, 0x1D, 0x5C, 0x01, 0x20, 0x3D,
+  0x10, 0x3D, 0x00, 0x27, 0x00, 0x1C, 0x5D, 0x01, 0x20, 0x3D, 0x10, 0x3D, 0x00, 0x27, 0x00, 0x1B,
+  0x5E, 0x01, 0x20, 0x3C, 0x10, 0x3F, 0x00, 0x26, 0x00, 0x1A, 0x5E, 0x02, 0x20, 0x3B, 0x10, 0x41,
+  0x00, 0x25, 0x00, 0x19, 0x5E, 0x03, 0x20, 0x3A, 0x10, 0x43, 0x00, 0x24, 0x00, 0x18, 0x5E, 0x04,
+  0x20, 0x3A, 0x10, 0x43, 0x00, 0x24, 0x00, 0x17, 0x5D, 0x06, 0x20, 0x39, 0x10, 0x45, 0x00, 0x23,
+  0x00, 0x16, 0x5D, 0x08, 0x20, 0x37, 0x10, 0x47, 0x00, 0x22, 0x00, 0x14, 0x5E, 0x09, 0x20, 0x37,
+  0x10, 0x47, 0x00, 0x22, 0x00, 0x13, 0x5E, 0x0A, 0x20, 0x36, 0x10, 0x49, 0x00, 0x21, 0x00, 0x12,
+  0x5E, 0x0C, 0x20, 0x35, 0x10, 0x49, 0x00, 0x21, 0x00, 0x11, 0x5E, 0x0C, 0x20, 0x35, 0x10, 0x4B,
+  0x00, 0x20, 0x00, 0x11, 0x5D, 0x0D, 0x20, 0x35, 0x10, 0x4B, 0x00, 0x20, 0x00, 0x11, 0x5C, 0x0E,
+  0x20, 0x35, 0x10, 0x4B, 0x00, 0x20, 0x00, 0x11, 0x5B, 0x0F, 0x20, 0x34, 0x10, 0x4D, 0x00, 0x1F,
+  0x00, 0x11, 0x5B, 0x0F, 0x20, 0x34, 0x10, 0x4D, 0x00, 0x1F, 0x00, 0x12, 0x59, 0x00, 0x10, 0x20,
+  0x34, 0x10, 0x4D, 0x00, 0x1F, 0x00, 0x13, 0x57, 0x00, 0x11, 0x20, 0x33, 0x10, 0x4F, 0x00, 0x1E,
+  0x00, 0x14, 0x55, 0x00, 0x13, 0x20, 0x2E, 0x10, 0x59, 0x00, 0x18, 0x00, 0x2C, 0x20, 0x2B, 0x10,
+  0x60, 0x00, 0x14, 0x00, 0x2D, 0x20, 0x27, 0x10, 0x65, 0x00, 0x12, 0x00, 0x2E, 0x20, 0x24, 0x10,
+  0x69, 0x00, 0x10, 0x00, 0x2F, 0x20, 0x22, 0x10, 0x6C, 0x0E, 0x00, 0x30, 0x20, 0x1F, 0x10, 0x6F,
+  0x0D, 0x00, 0x32, 0x20, 0x1C, 0x10, 0x72, 0x0B, 0x00, 0x3A, 0x5A, 0x09, 0x10, 0x74, 0x0A, 0x00,
+  0x3A, 0x5A, 0x08, 0x10, 0x76, 0x09, 0x00, 0x3A, 0x5A, 0x07, 0x10, 0x78, 0x08, 0x00, 0x3A, 0x5B,
+  0x05, 0x10, 0x7A, 0x07, 0x00, 0x3A, 0x5B, 0x04, 0x10, 0x7C, 0x06, 0x00, 0x3A, 0x5B, 0x04, 0x10,
+  0x7C, 0x06, 0x00, 0x3A, 0x5B, 0x03, 0x10, 0x7E, 0x05, 0x00, 0x3A, 0x5B, 0x02, 0x10, 0x80, 0x04,
+  0x00, 0x3B, 0x59, 0x03, 0x10, 0x80, 0x04, 0x00, 0x3C, 0x57, 0x03, 0x10, 0x82, 0x03, 0x00, 0x3D,
+  0x55, 0x04, 0x10, 0x82, 0x03, 0x00, 0x46, 0x10, 0x83, 0x02, 0x00, 0x45, 0x10, 0x84, 0x02, 0x00,
+  0x45, 0x10, 0x85, 0x01, 0x00, 0x45, 0x10, 0x85, 0x01, 0x00, 0x44, 0x10, 0x86, 0x01, 0x00, 0x44,
+  0x10, 0x86, 0x01, 0x00, 0x44, 0x10, 0x87, 0x00, 0x44, 0x10, 0x87, 0x00, 0x44, 0x10, 0x87, 0x00,
+  0x44, 0x10, 0x87, 0x00, 0x44, 0x10, 0x87, 0x00, 0x44, 0x10, 0x87, 0x00, 0x44, 0x10, 0x87, 0x00,
+  0x44, 0x10, 0x87, 0x00, 0x44, 0x10, 0x87, 0x00, 0x45, 0x10, 0x86, 0x00, 0x45, 0x10, 0x86, 0x00,
+  0x45, 0x10, 0x85, 0x01, 0x00, 0x46, 0x10, 0x84, 0x01, 0x00, 0x46, 0x10, 0x84, 0x01, 0x00, 0x46,
+  0x10, 0x84, 0x01, 0x00, 0x46, 0x10, 0x83, 0x02, 0x00, 0x46, 0x10, 0x83, 0x02, 0x00, 0x45, 0x10,
+  0x85, 0x01, 0x00, 0x45, 0x10, 0x85, 0x01, 0x00, 0x45, 0x10, 0x85, 0x01, 0x00, 0x45, 0x10, 0x85,
+  0x01, 0x00, 0x45, 0x10, 0x85, 0x01, 0x00, 0x45, 0x10, 0x85, 0x01, 0x00, 0x45, 0x10, 0x85, 0x01,
+  0x00, 0x46, 0x10, 0x83, 0x02, 0x00, 0x46, 0x10, 0x83, 0x02, 0x00, 0x46, 0x10, 0x83, 0x02, 0x00,
+  0x47, 0x10, 0x81, 0x03, 0x00, 0x48, 0x10, 0x7F, 0x04, 0x00, 0x48, 0x10, 0x7F, 0x04, 0x00, 0x49,
+  0x10, 0x7D, 0x05, 0x00, 0x4A, 0x10, 0x7B, 0x06, 0x00, 0x4C, 0x10, 0x77, 0x08, 0x00, 0x4D, 0x10,
+  0x75, 0x09, 0x00, 0x50, 0x10, 0x6F, 0x0C, 0x00, 0x47, 0x55, 0x00, 0x71, 0x00, 0x46, 0x57, 0x00,
+  0x70, 0x00, 0x45, 0x59, 0x00, 0x6F, 0x00, 0x44, 0x5B, 0x00, 0x6E, 0x00, 0x44, 0x5B, 0x00, 0x6E,
+  0x00, 0x44, 0x5B, 0x00, 0x6E, 0x00, 0x44, 0x5B, 0x00, 0x6E, 0x00, 0x44, 0x5B, 0x00, 0x6E, 0x00,
+  0x44, 0x5A, 0x00, 0x6F, 0x00, 0x44, 0x5A, 0x00, 0x6F, 0x00, 0x44, 0x5A, 0x00, 0x6F, 0x00, 0x44,
+  0x5A, 0x00, 0x6F, 0x00, 0x44, 0x5A, 0x00, 0x6F, 0x00, 0x44, 0x5A, 0x00, 0x6F, 0x00, 0x44, 0x5A,
+  0x00, 0x6F, 0x00, 0x44, 0x5A, 0x00, 0x6F, 0x00, 0x44, 0x5A, 0x00, 0x6F, 0x00, 0x44, 0x5A, 0x00,
+  0x6F, 0x00, 0x44, 0x5A, 0x00, 0x6F, 0x00, 0x44, 0x5A, 0x00, 0x6F, 0x00, 0x17, 0x55, 0x00, 0x28,
+  0x5A, 0x00, 0x29, 0x55, 0x00, 0x41, 0x00, 0x16, 0x57, 0x00, 0x27, 0x5B, 0x00, 0x27, 0x57, 0x00,
+  0x40, 0x00, 0x15, 0x59, 0x00, 0x26, 0x5B, 0x00, 0x26, 0x59, 0x00, 0x3F, 0x00, 0x14, 0x5B, 0x00,
+  0x25, 0x5B, 0x00, 0x25, 0x5B, 0x00, 0x3E, 0x00, 0x14, 0x5B, 0x00, 0x25, 0x5B, 0x00, 0x25, 0x5B,
+  0x00, 0x3E, 0x00, 0x14, 0x5C, 0x00, 0x24, 0x5B, 0x00, 0x24, 0x5C, 0x00, 0x3E, 0x00, 0x14, 0x5D,
+  0x00, 0x24, 0x59, 0x00, 0x24, 0x5D, 0x00, 0x3E, 0x00, 0x14, 0x5E, 0x00, 0x24, 0x57, 0x00, 0x24,
+  0x5E, 0x00, 0x3E, 0x00, 0x15, 0x5E, 0x00, 0x24, 0x55, 0x00, 0x24, 0x5E, 0x00, 0x3F, 0x00, 0x16,
+  0x5E, 0x00, 0x4B, 0x5E, 0x00, 0x40, 0x00, 0x17, 0x5E, 0x00, 0x49, 0x5E, 0x00, 0x41, 0x00, 0x18,
+  0x5E, 0x00, 0x47, 0x5E, 0x00, 0x42, 0x00, 0x19, 0x5E, 0x00, 0x45, 0x5E, 0x00, 0x43, 0x00, 0x1A,
+  0x5F, 0x00, 0x41, 0x5F, 0x00, 0x44, 0x00, 0x1B, 0x5F, 0x00, 0x3F, 0x5F, 0x00, 0x45, 0x00, 0x1C,
+  0x5F, 0x00, 0x3D, 0x5F, 0x00, 0x46, 0x00, 0x1D, 0x5F, 0x00, 0x3B, 0x5F, 0x00, 0x47, 0x00, 0x1E,
+  0x5E, 0x00, 0x18, 0x4B, 0x00, 0x18, 0x5E, 0x00, 0x48, 0x00, 0x1F, 0x5D, 0x00, 0x13, 0x40, 0x15,
+  0x00, 0x13, 0x5D, 0x00, 0x49, 0x00, 0x20, 0x5C, 0x00, 0x10, 0x40, 0x1B, 0x00, 0x10, 0x5C, 0x00,
+  0x4A, 0x00, 0x21, 0x5B, 0x0E, 0x40, 0x1F, 0x0E, 0x5B, 0x00, 0x4B, 0x00, 0x22, 0x59, 0x0D, 0x40,
+  0x23, 0x0D, 0x59, 0x00, 0x4C, 0x00, 0x23, 0x57, 0x0C, 0x40, 0x27, 0x0C, 0x57, 0x00, 0x4D, 0x00,
+  0x24, 0x55, 0x0C, 0x40, 0x29, 0x0C, 0x55, 0x00, 0x4E, 0x00, 0x34, 0x40, 0x2B, 0x00, 0x5E, 0x00,
+  0x32, 0x40, 0x2F, 0x00, 0x5C, 0x00, 0x31, 0x40, 0x31, 0x00, 0x5B, 0x00, 0x30, 0x40, 0x33, 0x00,
+  0x5A, 0x00, 0x2F, 0x40, 0x35, 0x00, 0x59, 0x00, 0x2E, 0x40, 0x37, 0x00, 0x58, 0x00, 0x2D, 0x40,
+  0x39, 0x00, 0x57, 0x00, 0x2D, 0x40, 0x39, 0x00, 0x57, 0x00, 0x2C, 0x40, 0x3B, 0x00, 0x56, 0x00,
+  0x2B, 0x40, 0x3D, 0x00, 0x55, 0x00, 0x2A, 0x40, 0x3F, 0x00, 0x54, 0x00, 0x2A, 0x40, 0x3F, 0x00,
+  0x54, 0x00, 0x29, 0x40, 0x41, 0x00, 0x53, 0x00, 0x29, 0x40, 0x41, 0x00, 0x53, 0x00, 0x28, 0x40,
+  0x43, 0x00, 0x52, 0x00, 0x28, 0x40, 0x43, 0x00, 0x52, 0x00, 0x27, 0x40, 0x45, 0x00, 0x51, 0x00,
+  0x27, 0x40, 0x45, 0x00, 0x51, 0x00, 0x27, 0x40, 0x45, 0x00, 0x51, 0x00, 0x26, 0x40, 0x47, 0x00,
+  0x50, 0x00, 0x26, 0x40, 0x47, 0x00, 0x50, 0x00, 0x26, 0x40, 0x47, 0x00, 0x50, 0x00, 0x26, 0x40,
+  0x47, 0x00, 0x50, 0x00, 0x26, 0x40, 0x47, 0x00, 0x50, 0x03, 0x50, 0x17, 0x0B, 0x40, 0x49, 0x0B,
+  0x50, 0x17, 0x00, 0x2D, 0x02, 0x50, 0x19, 0x0A, 0x40, 0x49, 0x0A, 0x50, 0x19, 0x00, 0x2C, 0x01,
+  0x50, 0x1B, 0x09, 0x40, 0x49, 0x09, 0x50, 0x1B, 0x00, 0x2B, 0x50, 0x1D, 0x08, 0x40, 0x49, 0x08,
+  0x50, 0x1D, 0x00, 0x2A, 0x50, 0x1D, 0x08, 0x40, 0x49, 0x08, 0x50, 0x1D, 0x00, 0x2A, 0x50, 0x1D,
+  0x08, 0x40, 0x49, 0x08, 0x50, 0x1D, 0x00, 0x2A, 0x50, 0x1D, 0x08, 0x40, 0x49, 0x08, 0x50, 0x1D,
+  0x00, 0x2A, 0x50, 0x1D, 0x08, 0x40, 0x49, 0x08, 0x50, 0x1D, 0x00, 0x2A, 0x01, 0x50, 0x1B, 0x09,
+  0x40, 0x49, 0x09, 0x50, 0x1B, 0x00, 0x2B, 0x02, 0x50, 0x19, 0x0A, 0x40, 0x49, 0x0A, 0x50, 0x19,
+  0x00, 0x2C, 0x03, 0x55, 0x0D, 0x55, 0x0B, 0x40, 0x49, 0x0B, 0x55, 0x0D, 0x55, 0x00, 0x2D, 0x00,
+  0x26, 0x40, 0x47, 0x00, 0x50, 0x00, 0x26, 0x40, 0x47, 0x00, 0x50, 0x00, 0x26, 0x40, 0x47, 0x00,
+  0x50, 0x00, 0x26, 0x40, 0x47, 0x08, 0x1D, 0x00, 0x3B, 0x00, 0x26, 0x40, 0x47, 0x04, 0x10, 0x15,
+  0x00, 0x37, 0x00, 0x27, 0x40, 0x45, 0x02, 0x10, 0x1B, 0x00, 0x34, 0x00, 0x27, 0x40, 0x45, 0x10,
+  0x1F, 0x00, 0x32, 0x00, 0x27, 0x40, 0x43, 0x10, 0x23, 0x00, 0x30, 0x00, 0x28, 0x40, 0x40, 0x10,
+  0x27, 0x00, 0x2E, 0x00, 0x28, 0x40, 0x3F, 0x10, 0x29, 0x00, 0x2D, 0x00, 0x29, 0x40, 0x3C, 0x10,
+  0x2D, 0x00, 0x2B, 0x00, 0x29, 0x40, 0x3B, 0x10, 0x2F, 0x00, 0x2A, 0x00, 0x2A, 0x40, 0x39, 0x10,
+  0x31, 0x00, 0x29, 0x00, 0x2A, 0x40, 0x38, 0x10, 0x33, 0x00, 0x28, 0x00, 0x2B, 0x40, 0x36, 0x10,
+  0x35, 0x00, 0x27, 0x00, 0x2C, 0x40, 0x34, 0x10, 0x37, 0x00, 0x26, 0x00, 0x2D, 0x40, 0x32, 0x10,
+  0x39, 0x00, 0x25, 0x00, 0x2D, 0x40, 0x31, 0x10, 0x3B, 0x00, 0x24, 0x00, 0x2E, 0x40, 0x2F, 0x10,
+  0x3D, 0x00, 0x23, 0x00, 0x2F, 0x40, 0x2E, 0x10, 0x3D, 0x00, 0x23, 0x00, 0x30, 0x40, 0x2C, 0x10,
+  0x3F, 0x00, 0x22, 0x00, 0x31, 0x40, 0x2A, 0x10, 0x41, 0x00, 0x21, 0x00, 0x32, 0x40, 0x29, 0x10,
+  0x41, 0x00, 0x21, 0x00, 0x34, 0x40, 0x26, 0x10, 0x43, 0x00, 0x20, 0x00, 0x24, 0x55, 0x0C, 0x40,
+  0x25, 0x10, 0x43, 0x00, 0x20, 0x00, 0x23, 0x57, 0x0C, 0x40, 0x23, 0x10, 0x45, 0x00, 0x1F, 0x00,
+  0x22, 0x59, 0x0D, 0x40, 0x21, 0x10, 0x45, 0x00, 0x1F, 0x00, 0x21, 0x5B, 0x0E, 0x40, 0x1E, 0x10,
+  0x47, 0x00, 0x1E, 0x00, 0x21, 0x5B, 0x00, 0x10, 0x40, 0x1B, 0x01, 0x10, 0x47, 0x00, 0x1E, 0x00,
+  0x20, 0x5C, 0x00, 0x13, 0x40, 0x15, 0x04, 0x10, 0x47, 0x00, 0x1E, 0x00, 0x1F, 0x5D, 0x00, 0x18,
+  0x4B, 0x08, 0x10, 0x49, 0x00, 0x1D, 0x00, 0x1E, 0x5E, 0x00, 0x26, 0x10, 0x4E, 0x00, 0x1D, 0x00,
+  0x1D, 0x5E, 0x00, 0x24, 0x10, 0x57, 0x00, 0x17, 0x00, 0x1C, 0x5E, 0x00, 0x22, 0x10, 0x5D, 0x00,
+  0x14, 0x00, 0x1B, 0x5E, 0x00, 0x21, 0x10, 0x62, 0x00, 0x11, 0x00, 0x1A, 0x5E, 0x00, 0x21, 0x10,
+  0x65, 0x0F, 0x00, 0x19, 0x5E, 0x00, 0x21, 0x10, 0x67, 0x0E, 0x00, 0x17, 0x5F, 0x00, 0x20, 0x10,
+  0x6B, 0x0C, 0x00, 0x16, 0x5F, 0x00, 0x20, 0x10, 0x6D, 0x0B, 0x00, 0x15, 0x5F, 0x00, 0x20, 0x10,
+  0x6F, 0x0A, 0x00, 0x14, 0x5F, 0x00, 0x20, 0x10, 0x71, 0x09, 0x00, 0x14, 0x5E, 0x00, 0x21, 0x10,
+  0x72, 0x08, 0x00, 0x14, 0x5D, 0x00, 0x21, 0x10, 0x74, 0x07, 0x00, 0x14, 0x5C, 0x00, 0x21, 0x10,
+  0x76, 0x06, 0x00, 0x14, 0x5B, 0x00, 0x21, 0x10, 0x77, 0x06, 0x00, 0x15, 0x59, 0x00, 0x22, 0x10,
+  0x78, 0x05, 0x00, 0x16, 0x57, 0x00, 0x22, 0x10, 0x7A, 0x04, 0x00, 0x17, 0x55, 0x00, 0x23, 0x10,
+  0x7A, 0x04, 0x00, 0x3F, 0x10, 0x7B, 0x03, 0x00, 0x3E, 0x10, 0x7C, 0x03, 0x00, 0x3E, 0x10, 0x7C,
+  0x03, 0x00, 0x3E, 0x10, 0x7D, 0x02, 0x00, 0x3D, 0x10, 0x7E, 0x02, 0x00, 0x3D, 0x10, 0x7E, 0x02,
+  0x00, 0x3D, 0x10, 0x7F, 0x01, 0x00, 0x3D, 0x10, 0x7F, 0x01, 0x00, 0x3D, 0x10, 0x7F, 0x01, 0x00,
+  0x3D, 0x10, 0x7F, 0x01, 0x00, 0x3D, 0x10, 0x7F, 0x01, 0x00, 0x3D, 0x10, 0x7F, 0x01, 0x00, 0x3D,
+  0x10, 0x7F, 0x01, 0x00, 0x3D, 0x10, 0x7F, 0x01, 0x00, 0x3D, 0x10, 0x7F, 0x01, 0x00, 0x3E, 0x10,
+  0x7E, 0x01, 0x00, 0x3E, 0x10, 0x7E, 0x01, 0x00, 0x3E, 0x10, 0x7D, 0x02, 0x00, 0x3E, 0x10, 0x7E,
+  0x01, 0x00, 0x3E, 0x10, 0x7E, 0x01, 0x00, 0x3E, 0x10, 0x7E, 0x01, 0x00, 0x3D, 0x10, 0x80, 0x00,
+  0x3D, 0x10, 0x80, 0x00, 0x3D, 0x10, 0x80, 0x00, 0x3D, 0x10, 0x80, 0x00, 0x3D, 0x10, 0x80, 0x00,
+  0x3D, 0x10, 0x80, 0x00, 0x3D, 0x10, 0x80, 0x00, 0x3E, 0x10, 0x7E, 0x01, 0x00, 0x3E, 0x10, 0x7E,
+  0x01, 0x00, 0x3E, 0x10, 0x7E, 0x01, 0x00, 0x3F, 0x10, 0x7C, 0x02, 0x00, 0x40, 0x10, 0x7A, 0x03,
+  0x00, 0x40, 0x10, 0x7A, 0x03, 0x00, 0x41, 0x10, 0x78, 0x04, 0x00, 0x42, 0x10, 0x76, 0x05, 0x00,
+  0x44, 0x10, 0x72, 0x07, 0x00, 0x45, 0x10, 0x70, 0x08, 0x00, 0x48, 0x10, 0x6A, 0x0B, 0x00, 0x43,
+  0x1D, 0x00, 0x43, 0x00, 0x3E, 0x10, 0x17, 0x00, 0x3E, 0x00, 0x3B, 0x10, 0x1D, 0x00, 0x3B, 0x00,
+  0x39, 0x10, 0x21, 0x00, 0x39, 0x00, 0x37, 0x10, 0x25, 0x00, 0x37, 0x00, 0x35, 0x10, 0x29, 0x00,
+  0x35, 0x00, 0x33, 0x10, 0x2D, 0x00, 0x33, 0x00, 0x32, 0x10, 0x2F, 0x00, 0x32, 0x00, 0x30, 0x10,
+  0x33, 0x00, 0x30, 0x00, 0x2F, 0x10, 0x35, 0x00, 0x2F, 0x00, 0x2E, 0x10, 0x37, 0x00, 0x2E, 0x00,
+  0x2D, 0x10, 0x39, 0x00, 0x2D, 0x00, 0x2C, 0x10, 0x3B, 0x00, 0x2C, 0x00, 0x2B, 0x10, 0x3D, 0x00,
+  0x2B, 0x00, 0x2A, 0x10, 0x3F, 0x00, 0x2A, 0x00, 0x29, 0x10, 0x41, 0x00, 0x29, 0x00, 0x28, 0x10,
+  0x43, 0x00, 0x28, 0x00, 0x27, 0x10, 0x45, 0x00, 0x27, 0x00, 0x27, 0x10, 0x45, 0x00, 0x27, 0x00,
+  0x26, 0x10, 0x47, 0x00, 0x26, 0x00, 0x25, 0x10, 0x49, 0x00, 0x25, 0x00, 0x25, 0x10, 0x49, 0x00,
+  0x25, 0x00, 0x24, 0x10, 0x4B, 0x00, 0x24, 0x00, 0x24, 0x10, 0x4B, 0x00, 0x24, 0x00, 0x23, 0x10,
+  0x4D, 0x00, 0x23, 0x00, 0x23, 0x10, 0x4D, 0x00, 0x23, 0x00, 0x22, 0x10, 0x4F, 0x00, 0x22, 0x00,
+  0x22, 0x10, 0x4F, 0x00, 0x22, 0x00, 0x21, 0x10, 0x51, 0x00, 0x21, 0x00, 0x21, 0x10, 0x51, 0x00,
+  0x21, 0x00, 0x21, 0x10, 0x51, 0x00, 0x21, 0x00, 0x20, 0x10, 0x53, 0x00, 0x20, 0x00, 0x1C, 0x10,
+  0x57, 0x00, 0x20, 0x00, 0x18, 0x10, 0x61, 0x00, 0x1A, 0x00, 0x16, 0x10, 0x67, 0x00, 0x16, 0x00,
+  0x14, 0x10, 0x6B, 0x00, 0x14, 0x00, 0x12, 0x10, 0x70, 0x00, 0x11, 0x00, 0x11, 0x10, 0x72, 0x00,
+  0x10, 0x0F, 0x10, 0x76, 0x0E, 0x0E, 0x10, 0x78, 0x0D, 0x0D, 0x10, 0x7A, 0x0C, 0x0C, 0x10, 0x7C,
+  0x0B, 0x0B, 0x10, 0x7E, 0x0A, 0x0A, 0x10, 0x80, 0x09, 0x0A, 0x10, 0x81, 0x08, 0x09, 0x10, 0x83,
+  0x07, 0x08, 0x10, 0x85, 0x06, 0x08, 0x10, 0x85, 0x06, 0x07, 0x10, 0x87, 0x05, 0x07, 0x10, 0x88,
+  0x04, 0x06, 0x10, 0x89, 0x04, 0x06, 0x10, 0x89, 0x04, 0x05, 0x10, 0x8B, 0x03, 0x05, 0x10, 0x8B,
+  0x03, 0x05, 0x10, 0x8C, 0x02, 0x05, 0x10, 0x8C, 0x02, 0x04, 0x10, 0x8D, 0x02, 0x04, 0x10, 0x8D,
+  0x02, 0x04, 0x10, 0x8E, 0x01, 0x04, 0x10, 0x8E, 0x01, 0x04, 0x10, 0x8E, 0x01, 0x04, 0x10, 0x8E,
+  0x01, 0x04, 0x10, 0x8E, 0x01, 0x04, 0x10, 0x8E, 0x01, 0x04, 0x10, 0x8E, 0x01, 0x04, 0x10, 0x8E,
+  0x01, 0x04, 0x10, 0x8E, 0x01, 0x05, 0x10, 0x8D, 0x01, 0x05, 0x10, 0x8D, 0x01, 0x05, 0x10, 0x8C,
+  0x02, 0x05, 0x10, 0x8C, 0x02, 0x06, 0x10, 0x8B, 0x02, 0x06, 0x10, 0x8B, 0x02, 0x06, 0x10, 0x8B,
+  0x02, 0x06, 0x10, 0x8B, 0x02, 0x05, 0x10, 0x8D, 0x01, 0x05, 0x10, 0x8D, 0x01, 0x05, 0x10, 0x8D,
+  0x01, 0x05, 0x10, 0x8D, 0x01, 0x05, 0x10, 0x8D, 0x01, 0x05, 0x10, 0x8D, 0x01, 0x05, 0x10, 0x8D,
+  0x01, 0x06, 0x10, 0x8B, 0x02, 0x06, 0x10, 0x8B, 0x02, 0x06, 0x10, 0x8B, 0x02, 0x07, 0x10, 0x89,
+  0x03, 0x07, 0x10, 0x89, 0x03, 0x08, 0x10, 0x87, 0x04, 0x09, 0x10, 0x85, 0x05, 0x0A, 0x10, 0x83,
+  0x06, 0x0B, 0x10, 0x81, 0x07, 0x0C, 0x10, 0x7F, 0x08, 0x0E, 0x10, 0x7B, 0x0A, 0x00, 0x11, 0x10,
+  0x75, 0x0D, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93,
+  0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x93, 0x00, 0x13,
+  0x65, 0x00, 0x23, 0x65, 0x00, 0x23, 0x65, 0x00, 0x23, 0x65, 0x03, 0x00, 0x12, 0x67, 0x00, 0x21,
+  0x67, 0x00, 0x21, 0x67, 0x00, 0x21, 0x67, 0x02, 0x00, 0x11, 0x69, 0x00, 0x1F, 0x69, 0x00, 0x1F,
+  0x69, 0x00, 0x1F, 0x69, 0x01, 0x00, 0x10, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D,
+  0x6B, 0x00, 0x10, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x10, 0x6B,
+  0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x10, 0x6B, 0x00, 0x1D, 0x6B, 0x00,
+  0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x10, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D,
+  0x6B, 0x0F, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x01, 0x0F, 0x6B, 0x00,
+  0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x01, 0x0F, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E,
+  0x6A, 0x00, 0x1E, 0x6A, 0x02, 0x0E, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B,
+  0x02, 0x0E, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x03, 0x0D, 0x6B, 0x00,
+  0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x03, 0x0D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D,
+  0x6B, 0x00, 0x1D, 0x6B, 0x03, 0x0D, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A,
+  0x04, 0x0C, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x04, 0x0C, 0x6A, 0x00,
+  0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x05, 0x0B, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D,
+  0x6B, 0x00, 0x1D, 0x6B, 0x05, 0x0B, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B,
+  0x05, 0x0B, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x06, 0x0A, 0x6B, 0x00,
+  0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x06, 0x0A, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E,
+  0x6A, 0x00, 0x1E, 0x6A, 0x07, 0x09, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B,
+  0x07, 0x09, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x07, 0x09, 0x6A, 0x00,
+  0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x08, 0x08, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D,
+  0x6B, 0x00, 0x1D, 0x6B, 0x08, 0x08, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A,
+  0x09, 0x07, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x09, 0x07, 0x6B, 0x00,
+  0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x09, 0x07, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E,
+  0x6A, 0x00, 0x1E, 0x6A, 0x0A, 0x06, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B,
+  0x0A, 0x06, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x0B, 0x05, 0x6B, 0x00,
+  0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x0B, 0x05, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D,
+  0x6B, 0x00, 0x1D, 0x6B, 0x0B, 0x05, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A,
+  0x0C, 0x04, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x0C, 0x04, 0x6A, 0x00,
+  0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x0D, 0x03, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D,
+  0x6B, 0x00, 0x1D, 0x6B, 0x0D, 0x03, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B,
+  0x0D, 0x03, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x00, 0x1E, 0x6A, 0x0E, 0x02, 0x6B, 0x00,
+  0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x0E, 0x01, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D,
+  0x6B, 0x00, 0x1D, 0x6B, 0x0F, 0x6C, 0x00, 0x1C, 0x6C, 0x00, 0x1C, 0x6C, 0x00, 0x1C, 0x6C, 0x0F,
+  0x6C, 0x00, 0x1C, 0x6C, 0x00, 0x1C, 0x6C, 0x00, 0x1C, 0x6C, 0x0F, 0x6B, 0x00, 0x1D, 0x6B, 0x00,
+  0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x10, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D,
+  0x6B, 0x00, 0x10, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x1D, 0x6B, 0x00, 0x10, 0x01,
+  0x69, 0x00, 0x1F, 0x69, 0x00, 0x1F, 0x69, 0x00, 0x1F, 0x69, 0x00, 0x11, 0x02, 0x67, 0x00, 0x21,
+  0x67, 0x00, 0x21, 0x67, 0x00, 0x21, 0x67, 0x00, 0x12, 0x03, 0x65, 0x00, 0x23, 0x65, 0x00, 0x23,
+  0x65, 0x00, 0x23, 0x65, 0x00, 0x13, 0x00, 0x3F, 0x1D, 0x00, 0x42, 0x00, 0x3A, 0x10, 0x17, 0x00,
+  0x3D, 0x00, 0x37, 0x10, 0x1D, 0x00, 0x3A, 0x00, 0x35, 0x10, 0x21, 0x00, 0x38, 0x00, 0x33, 0x10,
+  0x25, 0x00, 0x36, 0x00, 0x31, 0x10, 0x29, 0x00, 0x34, 0x00, 0x2F, 0x10, 0x2D, 0x00, 0x32, 0x00,
+  0x2E, 0x10, 0x2F, 0x00, 0x31, 0x00, 0x2C, 0x10, 0x33, 0x00, 0x2F, 0x00, 0x2B, 0x10, 0x35, 0x00,
+  0x2E, 0x00, 0x2A, 0x10, 0x37, 0x00, 0x2D, 0x00, 0x29, 0x10, 0x39, 0x00, 0x2C, 0x00, 0x28, 0x10,
+  0x3B, 0x00, 0x2B, 0x00, 0x27, 0x10, 0x3D, 0x00, 0x2A, 0x00, 0x26, 0x10, 0x3F, 0x00, 0x29, 0x00,
+  0x25, 0x10, 0x41, 0x00, 0x28, 0x00, 0x24, 0x10, 0x43, 0x00, 0x27, 0x00, 0x23, 0x10, 0x45, 0x00,
+  0x26, 0x00, 0x23, 0x10, 0x45, 0x00, 0x26, 0x00, 0x22, 0x10, 0x47, 0x00, 0x25, 0x00, 0x21, 0x10,
+  0x49, 0x00, 0x24, 0x00, 0x21, 0x10, 0x49, 0x00, 0x24, 0x00, 0x20, 0x10, 0x4B, 0x00, 0x23, 0x00,
+  0x20, 0x10, 0x4B, 0x00, 0x23, 0x00, 0x1F, 0x10, 0x4D, 0x00, 0x22, 0x00, 0x1F, 0x10, 0x4D, 0x00,
+  0x22, 0x00, 0x1E, 0x10, 0x4F, 0x00, 0x21, 0x00, 0x1E, 0x10, 0x4F, 0x00, 0x21, 0x00, 0x1D, 0x10,
+  0x51, 0x00, 0x20, 0x00, 0x1D, 0x10, 0x51, 0x00, 0x20, 0x00, 0x1D, 0x10, 0x51, 0x00, 0x20, 0x00,
+  0x1C, 0x10, 0x53, 0x00, 0x1F, 0x00, 0x18, 0x10, 0x57, 0x00, 0x1F, 0x00, 0x14, 0x10, 0x61, 0x00,
+  0x19, 0x00, 0x12, 0x10, 0x67, 0x00, 0x15, 0x00, 0x10, 0x10, 0x6B, 0x00, 0x13, 0x0E, 0x10, 0x70,
+  0x00, 0x10, 0x0D, 0x10, 0x72, 0x0F, 0x0B, 0x10, 0x76, 0x0D, 0x0A, 0x10, 0x78, 0x0C, 0x09, 0x10,
+  0x7A, 0x0B, 0x08, 0x10, 0x7C, 0x0A, 0x07, 0x10, 0x7E, 0x09, 0x06, 0x10, 0x80, 0x08, 0x06, 0x10,
+  0x81, 0x07, 0x05, 0x10, 0x83, 0x06, 0x04, 0x10, 0x85, 0x05, 0x04, 0x10, 0x85, 0x05, 0x03, 0x10,
+  0x87, 0x04, 0x03, 0x10, 0x88, 0x03, 0x02, 0x10, 0x89, 0x03, 0x02, 0x10, 0x89, 0x03, 0x01, 0x10,
+  0x8B, 0x02, 0x01, 0x10, 0x8B, 0x02, 0x01, 0x10, 0x8C, 0x01, 0x01, 0x10, 0x8C, 0x01, 0x10, 0x8D,
+  0x01, 0x10, 0x8D, 0x01, 0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E,
+  0x10, 0x8E, 0x10, 0x8E, 0x10, 0x8E, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8C, 0x01,
+  0x01, 0x10, 0x8C, 0x01, 0x02, 0x10, 0x8B, 0x01, 0x02, 0x10, 0x8B, 0x01, 0x02, 0x10, 0x8B, 0x01,
+  0x02, 0x10, 0x8B, 0x01, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D,
+  0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x01, 0x10, 0x8D, 0x02, 0x10, 0x8B, 0x01, 0x02, 0x10, 0x8B,
+  0x01, 0x02, 0x10, 0x8B, 0x01, 0x03, 0x10, 0x89, 0x02, 0x03, 0x10, 0x89, 0x02, 0x04, 0x10, 0x87,
+  0x03, 0x05, 0x10, 0x85, 0x04, 0x06, 0x10, 0x83, 0x05, 0x07, 0x10, 0x81, 0x06, 0x08, 0x10, 0x7F,
+  0x07, 0x0A, 0x10, 0x7B, 0x09, 0x0D, 0x10, 0x75, 0x0C, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00,
+  0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00,
+  0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x00,
+  0x8E, 0x00, 0x8E, 0x00, 0x8E, 0x08, 0x13, 0x09, 0x13, 0x00, 0x39, 0x13, 0x09, 0x13, 0x00, 0x2F,
+  0x07, 0x15, 0x07, 0x15, 0x00, 0x37, 0x15, 0x07, 0x15, 0x00, 0x2E, 0x06, 0x17, 0x05, 0x17, 0x00,
+  0x35, 0x17, 0x05, 0x17, 0x00, 0x2D, 0x06, 0x17, 0x05, 0x17, 0x00, 0x35, 0x17, 0x05, 0x17, 0x00,
+  0x2D, 0x06, 0x17, 0x05, 0x17, 0x00, 0x35, 0x17, 0x05, 0x17, 0x00, 0x2D, 0x07, 0x17, 0x03, 0x17,
+  0x00, 0x37, 0x17, 0x03, 0x17, 0x00, 0x2E, 0x08, 0x16, 0x03, 0x16, 0x00, 0x39, 0x16, 0x03, 0x16,
+  0x00, 0x2F, 0x08, 0x17, 0x01, 0x17, 0x00, 0x39, 0x17, 0x01, 0x17, 0x00, 0x2F, 0x09, 0x1D, 0x00,
+  0x3B, 0x1D, 0x00, 0x30, 0x09, 0x1D, 0x00, 0x3B, 0x1D, 0x00, 0x30, 0x02, 0x13, 0x05, 0x1B, 0x05,
+  0x13, 0x00, 0x2D, 0x13, 0x05, 0x1B, 0x05, 0x13, 0x00, 0x29, 0x01, 0x10, 0x1D, 0x00, 0x2B, 0x10,
+  0x1D, 0x00, 0x28, 0x10, 0x1F, 0x00, 0x29, 0x10, 0x1F, 0x00, 0x27, 0x10, 0x1F, 0x00, 0x29, 0x10,
+  0x1F, 0x00, 0x27, 0x10, 0x1F, 0x00, 0x29, 0x10, 0x1F, 0x00, 0x27, 0x01, 0x10, 0x1D, 0x00, 0x2B,
+  0x10, 0x1D, 0x00, 0x28, 0x02, 0x10, 0x1B, 0x00, 0x2D, 0x10, 0x1B, 0x00, 0x29, 0x0A, 0x1B, 0x00,
+  0x3D, 0x1B, 0x00, 0x31, 0x0A, 0x1B, 0x00, 0x3D, 0x1B, 0x00, 0x31, 0x09, 0x1D, 0x00, 0x3B, 0x1D,
+  0x00, 0x30, 0x08, 0x17, 0x01, 0x17, 0x00, 0x15, 0x13, 0x09, 0x13, 0x00, 0x15, 0x17, 0x01, 0x17,
+  0x00, 0x15, 0x13, 0x09, 0x13, 0x0B, 0x07, 0x18, 0x01, 0x18, 0x00, 0x13, 0x15, 0x07, 0x15, 0x00,
+  0x13, 0x18, 0x01, 0x18, 0x00, 0x13, 0x15, 0x07, 0x15, 0x0A, 0x06, 0x18, 0x03, 0x18, 0x00, 0x11,
+  0x17, 0x05, 0x17, 0x00, 0x11, 0x18, 0x03, 0x18, 0x00, 0x11, 0x17, 0x05, 0x17, 0x09, 0x06, 0x18,
+  0x03, 0x18, 0x00, 0x11, 0x17, 0x05, 0x17, 0x00, 0x11, 0x18, 0x03, 0x18, 0x00, 0x11, 0x17, 0x05,
+  0x17, 0x09, 0x06, 0x17, 0x05, 0x17, 0x00, 0x11, 0x17, 0x05, 0x17, 0x00, 0x11, 0x17, 0x05, 0x17,
+  0x00, 0x11, 0x17, 0x05, 0x17, 0x09, 0x07, 0x15, 0x07, 0x15, 0x00, 0x13, 0x17, 0x03, 0x17, 0x00,
+  0x13, 0x15, 0x07, 0x15, 0x00, 0x13, 0x17, 0x03, 0x17, 0x0A, 0x08, 0x13, 0x09, 0x13, 0x00, 0x15,
+  0x16, 0x03, 0x16, 0x00, 0x15, 0x13, 0x09, 0x13, 0x00, 0x15, 0x16, 0x03, 0x16, 0x0B, 0x00, 0x2C,
+  0x17, 0x01, 0x17, 0x00, 0x39, 0x17, 0x01, 0x17, 0x0B, 0x00, 0x2D, 0x1D, 0x00, 0x3B, 0x1D, 0x0C,
+  0x00, 0x2D, 0x1D, 0x00, 0x3B, 0x1D, 0x0C, 0x00, 0x26, 0x13, 0x05, 0x1B, 0x05, 0x13, 0x00, 0x2D,
+  0x13, 0x05, 0x1B, 0x05, 0x13, 0x05, 0x00, 0x25, 0x10, 0x1D, 0x00, 0x2B, 0x10, 0x1D, 0x04, 0x00,
+  0x24, 0x10, 0x1F, 0x00, 0x29, 0x10, 0x1F, 0x03, 0x00, 0x24, 0x10, 0x1F, 0x00, 0x29, 0x10, 0x1F,
+  0x03, 0x00, 0x24, 0x10, 0x1F, 0x00, 0x29, 0x10, 0x1F, 0x03, 0x00, 0x25, 0x10, 0x1D, 0x00, 0x2B,
+  0x10, 0x1D, 0x04, 0x00, 0x26, 0x10, 0x1B, 0x00, 0x2D, 0x10, 0x1B, 0x05, 0x00, 0x2E, 0x1B, 0x00,
+  0x3D, 0x1B, 0x0D, 0x00, 0x2E, 0x1B, 0x00, 0x3D, 0x1B, 0x0D, 0x00, 0x2D, 0x1D, 0x00, 0x3B, 0x1D,
+  0x0C, 0x00, 0x2C, 0x17, 0x01, 0x17, 0x00, 0x39, 0x17, 0x01, 0x17, 0x0B, 0x00, 0x2B, 0x18, 0x01,
+  0x18, 0x00, 0x37, 0x18, 0x01, 0x18, 0x0A, 0x00, 0x2A, 0x18, 0x03, 0x18, 0x00, 0x35, 0x18, 0x03,
+  0x18, 0x09, 0x00, 0x2A, 0x18, 0x03, 0x18, 0x00, 0x35, 0x18, 0x03, 0x18, 0x09, 0x00, 0x2A, 0x17,
+  0x05, 0x17, 0x00, 0x35, 0x17, 0x05, 0x17, 0x09, 0x00, 0x2B, 0x15, 0x07, 0x15, 0x00, 0x37, 0x15,
+  0x07, 0x15, 0x0A, 0x00, 0x2C, 0x13, 0x09, 0x13, 0x00, 0x39, 0x13, 0x09, 0x13, 0x0B, 0x00, 0x3F,
+  0x3D, 0x00, 0x42, 0x00, 0x3A, 0x30, 0x17, 0x00, 0x3D, 0x00, 0x37, 0x30, 0x1D, 0x00, 0x3A, 0x00,
+  0x35, 0x30, 0x21, 0x00, 0x38, 0x00, 0x33, 0x30, 0x25, 0x00, 0x36, 0x00, 0x31, 0x30, 0x29, 0x00,
+  0x34, 0x00, 0x2F, 0x30, 0x2D, 0x00, 0x32, 0x00, 0x2E, 0x30, 0x2F, 0x00, 0x31, 0x00, 0x2C, 0x30,
+  0x33, 0x00, 0x2F, 0x00, 0x2B, 0x30, 0x35, 0x00, 0x2E, 0x00, 0x2A, 0x30, 0x37, 0x00, 0x2D, 0x00,
+  0x29, 0x30, 0x39, 0x00, 0x2C, 0x00, 0x28, 0x30, 0x3B, 0x00, 0x2B, 0x00, 0x27, 0x30, 0x3D, 0x00,
+  0x2A, 0x00, 0x26, 0x30, 0x3F, 0x00, 0x29, 0x00, 0x25, 0x30, 0x41, 0x00, 0x28, 0x00, 0x24, 0x30,
+  0x43, 0x00, 0x27, 0x00, 0x23, 0x30, 0x45, 0x00, 0x26, 0x00, 0x23, 0x30, 0x45, 0x00, 0x26, 0x00,
+  0x22, 0x30, 0x47, 0x00, 0x25, 0x00, 0x21, 0x30, 0x49, 0x00, 0x24, 0x00, 0x21, 0x30, 0x49, 0x00,
+  0x24, 0x00, 0x20, 0x30, 0x4B, 0x00, 0x23, 0x00, 0x20, 0x30, 0x4B, 0x00, 0x23, 0x00, 0x1F, 0x30,
+  0x4D, 0x00, 0x22, 0x00, 0x1F, 0x30, 0x4D, 0x00, 0x22, 0x00, 0x1E, 0x30, 0x4F, 0x00, 0x21, 0x00,
+  0x1E, 0x30, 0x4F, 0x00, 0x21, 0x00, 0x1D, 0x30, 0x51, 0x00, 0x20, 0x00, 0x1D, 0x30, 0x51, 0x00,
+  0x20, 0x00, 0x1D, 0x30, 0x51, 0x00, 0x20, 0x00, 0x1C, 0x30, 0x53, 0x00, 0x1F, 0x00, 0x18, 0x30,
+  0x57, 0x00, 0x1F, 0x00, 0x14, 0x30, 0x61, 0x00, 0x19, 0x00, 0x12, 0x30, 0x67, 0x00, 0x15, 0x00,
+  0x10, 0x30, 0x6B, 0x00, 0x13, 0x0E, 0x30, 0x70, 0x00, 0x10, 0x0D, 0x30, 0x72, 0x0F, 0x0B, 0x30,
+  0x76, 0x0D, 0x0A, 0x30, 0x78, 0x0C, 0x09, 0x30, 0x7A, 0x0B, 0x08, 0x30, 0x7C, 0x0A, 0x07, 0x30,
+  0x7E, 0x09, 0x06, 0x30, 0x80, 0x08, 0x06, 0x30, 0x81, 0x07, 0x05, 0x30, 0x83, 0x06, 0x04, 0x30,
+  0x85, 0x05, 0x04, 0x30, 0x85, 0x05, 0x03, 0x30, 0x87, 0x04, 0x03, 0x30, 0x88, 0x03, 0x02, 0x30,
+  0x89, 0x03, 0x02, 0x30, 0x89, 0x03, 0x01, 0x30, 0x8B, 0x02, 0x01, 0x30, 0x8B, 0x02, 0x01, 0x30,
+  0x8C, 0x01, 0x01, 0x30, 0x8C, 0x01, 0x30, 0x8D, 0x01, 0x30, 0x8D, 0x01, 0x30, 0x8E, 0x30, 0x8E,
+  0x30, 0x8E, 0x30, 0x8E, 0x30, 0x8E, 0x30, 0x8E, 0x30, 0x8E, 0x30, 0x8E, 0x30, 0x8E, 0x01, 0x30,
+  0x8D, 0x01, 0x30, 0x8D, 0x01, 0x30, 0x8C, 0x01, 0x01, 0x30, 0x8C, 0x01, 0x02, 0x30, 0x8B, 0x01,
+  0x02, 0x30, 0x8B, 0x01, 0x02, 0x30, 0x8B, 0x01, 0x02, 0x30, 0x8B, 0x01, 0x01, 0x30, 0x8D, 0x01,
+  0x30, 0x8D, 0x01, 0x30, 0x8D, 0x01, 0x30, 0x8D, 0x01, 0x30, 0x8D, 0x01, 0x30, 0x8D, 0x01, 0x30,
+  0x8D, 0x02, 0x30, 0x8B, 0x01, 0x02, 0x30, 0x8B, 0x01, 0x02, 0x30, 0x8B, 0x01, 0x03, 0x30, 0x89,
+  0x02, 0x03, 0x30, 0x89, 0x02, 0x04, 0x30, 0x87, 0x03, 0x05, 0x30, 0x85, 0x04, 0x06, 0x30, 0x83,
+  0x05, 0x07, 0x30, 0x81, 0x06, 0x08, 0x30, 0x7F, 0x07, 0x0A, 0x30, 0x7B, 0x09, 0x0D, 0x30, 0x75,
+  0x0C, 0x00, 0x8E, 0x00, 0x4B, 0x81, 0x00, 0x42, 0x00, 0x4B, 0x81, 0x00, 0x42, 0x00, 0x4A, 0x82,
+  0x00, 0x42, 0x00, 0x4A, 0x82, 0x00, 0x42, 0x00, 0x49, 0x83, 0x00, 0x42, 0x00, 0x48, 0x84, 0x00,
+  0x42, 0x00, 0x48, 0x84, 0x00, 0x42, 0x00, 0x47, 0x85, 0x00, 0x42, 0x00, 0x46, 0x86, 0x00, 0x42,
+  0x00, 0x46, 0x86, 0x00, 0x42, 0x00, 0x45, 0x87, 0x00, 0x42, 0x00, 0x44, 0x87, 0x00, 0x43, 0x00,
+  0x44, 0x87, 0x00, 0x43, 0x00, 0x43, 0x88, 0x00, 0x43, 0x00, 0x43, 0x88, 0x00, 0x43, 0x00, 0x42,
+  0x89, 0x00, 0x43, 0x00, 0x41, 0x8A, 0x00, 0x43, 0x00, 0x41, 0x8A, 0x00, 0x43, 0x00, 0x40, 0x8B,
+  0x00, 0x43, 0x00, 0x3F, 0x8C, 0x00, 0x43, 0x00, 0x3F, 0x8C, 0x00, 0x43, 0x00, 0x3E, 0x8D, 0x00,
+  0x43, 0x00, 0x3D, 0x8D, 0x00, 0x44, 0x00, 0x3D, 0x8D, 0x00, 0x44, 0x00, 0x3C, 0x8E, 0x00, 0x44,
+  0x00, 0x3B, 0x8F, 0x00, 0x44, 0x00, 0x3B, 0x8F, 0x00, 0x44, 0x00, 0x3A, 0x80, 0x10, 0x00, 0x44,
+  0x00, 0x3A, 0x80, 0x10, 0x00, 0x44, 0x00, 0x39, 0x80, 0x11, 0x00, 0x44, 0x00, 0x38, 0x80, 0x12,
+  0x00, 0x44, 0x00, 0x38, 0x80, 0x12, 0x00, 0x44, 0x00, 0x37, 0x80, 0x13, 0x00, 0x44, 0x00, 0x36,
+  0x80, 0x13, 0x00, 0x45, 0x00, 0x36, 0x80, 0x13, 0x00, 0x45, 0x00, 0x35, 0x80, 0x14, 0x00, 0x45,
+  0x00, 0x34, 0x80, 0x1D, 0x00, 0x3D, 0x00, 0x34, 0x80, 0x1D, 0x00, 0x3D, 0x00, 0x33, 0x80, 0x29,
+  0x00, 0x32, 0x00, 0x33, 0x80, 0x29, 0x00, 0x32, 0x00, 0x32, 0x80, 0x29, 0x00, 0x33, 0x00, 0x31,
+  0x80, 0x2A, 0x00, 0x33, 0x00, 0x31, 0x80, 0x29, 0x00, 0x34, 0x00, 0x30, 0x80, 0x29, 0x00, 0x35,
+  0x00, 0x2F, 0x80, 0x2A, 0x00, 0x35, 0x00, 0x2F, 0x80, 0x29, 0x00, 0x36, 0x00, 0x2E, 0x80, 0x29,
+  0x00, 0x37, 0x00, 0x2D, 0x8D, 0x04, 0x80, 0x19, 0x00, 0x37, 0x00, 0x2D, 0x89, 0x08, 0x80, 0x18,
+  0x00, 0x38, 0x00, 0x2C, 0x85, 0x0D, 0x80, 0x17, 0x00, 0x39, 0x00, 0x2B, 0x81, 0x00, 0x12, 0x80,
+  0x17, 0x00, 0x39, 0x00, 0x3E, 0x80, 0x16, 0x00, 0x3A, 0x00, 0x3D, 0x80, 0x16, 0x00, 0x3B, 0x00,
+  0x3D, 0x80, 0x16, 0x00, 0x3B, 0x00, 0x3D, 0x80, 0x15, 0x00, 0x3C, 0x00, 0x3D, 0x80, 0x15, 0x00,
+  0x3C, 0x00, 0x3D, 0x80, 0x14, 0x00, 0x3D, 0x00, 0x3D, 0x80, 0x13, 0x00, 0x3E, 0x00, 0x3D, 0x80,
+  0x13, 0x00, 0x3E, 0x00, 0x3C, 0x80, 0x13, 0x00, 0x3F, 0x00, 0x3C, 0x80, 0x12, 0x00, 0x40, 0x00,
+  0x3C, 0x80, 0x12, 0x00, 0x40, 0x00, 0x3C, 0x80, 0x11, 0x00, 0x41, 0x00, 0x3C, 0x80, 0x10, 0x00,
+  0x42, 0x00, 0x3C, 0x80, 0x10, 0x00, 0x42, 0x00, 0x3C, 0x8F, 0x00, 0x43, 0x00, 0x3B, 0x8F, 0x00,
+  0x44, 0x00, 0x3B, 0x8F, 0x00, 0x44, 0x00, 0x3B, 0x8E, 0x00, 0x45, 0x00, 0x3B, 0x8E, 0x00, 0x45,
+  0x00, 0x3B, 0x8D, 0x00, 0x46, 0x00, 0x3B, 0x8C, 0x00, 0x47, 0x00, 0x3B, 0x8C, 0x00, 0x47, 0x00,
+  0x3A, 0x8C, 0x00, 0x48, 0x00, 0x3A, 0x8B, 0x00, 0x49, 0x00, 0x3A, 0x8B, 0x00, 0x49, 0x00, 0x3A,
+  0x8A, 0x00, 0x4A, 0x00, 0x3A, 0x89, 0x00, 0x4B, 0x00, 0x3A, 0x89, 0x00, 0x4B, 0x00, 0x3A, 0x88,
+  0x00, 0x4C, 0x00, 0x39, 0x88, 0x00, 0x4D, 0x00, 0x39, 0x88, 0x00, 0x4D, 0x00, 0x39, 0x87, 0x00,
+  0x4E, 0x00, 0x39, 0x87, 0x00, 0x4E, 0x00, 0x39, 0x86, 0x00, 0x4F, 0x00, 0x39, 0x85, 0x00, 0x50,
+  0x00, 0x39, 0x85, 0x00, 0x50, 0x00, 0x38, 0x85, 0x00, 0x51, 0x00, 0x38, 0x84, 0x00, 0x52, 0x00,
+  0x38, 0x84, 0x00, 0x52, 0x00, 0x38, 0x83, 0x00, 0x53, 0x00, 0x38, 0x82, 0x00, 0x54, 0x00, 0x38,
+  0x82, 0x00, 0x54, 0x00, 0x38, 0x81, 0x00, 0x55, 0x00, 0x37, 0x81, 0x00, 0x56, 0x00, 0x14, 0x51,
+  0x00, 0x14, 0x00, 0x13, 0x53, 0x00, 0x13, 0x00, 0x13, 0x53, 0x00, 0x13, 0x00, 0x13, 0x53, 0x00,
+  0x13, 0x00, 0x13, 0x53, 0x00, 0x13, 0x06, 0x51, 0x0C, 0x53, 0x0C, 0x51, 0x06, 0x05, 0x53, 0x0C,
+  0x51, 0x0C, 0x53, 0x05, 0x06, 0x53, 0x00, 0x17, 0x53, 0x06, 0x07, 0x53, 0x07, 0x47, 0x07, 0x53,
+  0x07, 0x08, 0x53, 0x04, 0x4B, 0x04, 0x53, 0x08, 0x09, 0x51, 0x03, 0x4F, 0x03, 0x51, 0x09, 0x0C,
+  0x40, 0x11, 0x0C, 0x0B, 0x40, 0x13, 0x0B, 0x0A, 0x40, 0x15, 0x0A, 0x0A, 0x40, 0x15, 0x0A, 0x09,
+  0x40, 0x17, 0x09, 0x09, 0x40, 0x17, 0x09, 0x08, 0x40, 0x19, 0x08, 0x08, 0x40, 0x19, 0x08, 0x01,
+  0x55, 0x02, 0x40, 0x19, 0x02, 0x55, 0x01, 0x57, 0x01, 0x40, 0x19, 0x01, 0x57, 0x01, 0x55, 0x02,
+  0x40, 0x19, 0x02, 0x55, 0x01, 0x08, 0x40, 0x19, 0x08, 0x08, 0x40, 0x19, 0x08, 0x09, 0x40, 0x17,
+  0x09, 0x09, 0x40, 0x17, 0x09, 0x0A, 0x40, 0x15, 0x0A, 0x0A, 0x40, 0x15, 0x0A, 0x0B, 0x40, 0x13,
+  0x0B, 0x0C, 0x40, 0x11, 0x0C, 0x09, 0x51, 0x03, 0x4F, 0x03, 0x51, 0x09, 0x08, 0x53, 0x04, 0x4B,
+  0x04, 0x53, 0x08, 0x07, 0x53, 0x07, 0x47, 0x07, 0x53, 0x07, 0x06, 0x53, 0x00, 0x17, 0x53, 0x06,
+  0x05, 0x53, 0x0C, 0x51, 0x0C, 0x53, 0x05, 0x06, 0x51, 0x0C, 0x53, 0x0C, 0x51, 0x06, 0x00, 0x13,
+  0x53, 0x00, 0x13, 0x00, 0x13, 0x53, 0x00, 0x13, 0x00, 0x13, 0x53, 0x00, 0x13, 0x00, 0x13, 0x53,
+  0x00, 0x13, 0x00, 0x14, 0x51, 0x00, 0x14, 0x0A, 0x25, 0x00, 0x1A, 0x08, 0x29, 0x00, 0x18, 0x07,
+  0x2B, 0x00, 0x17, 0x06, 0x2D, 0x00, 0x16, 0x05, 0x2F, 0x00, 0x15, 0x05, 0x2F, 0x00, 0x15, 0x04,
+  0x20, 0x13, 0x00, 0x12, 0x03, 0x20, 0x15, 0x00, 0x11, 0x02, 0x20, 0x11, 0x17, 0x0F, 0x01, 0x20,
+  0x10, 0x1B, 0x0D, 0x20, 0x10, 0x1D, 0x0C, 0x2F, 0x1F, 0x0B, 0x2E, 0x10, 0x11, 0x0A, 0x2D, 0x10,
+  0x13, 0x09, 0x2D, 0x10, 0x13, 0x09, 0x2A, 0x10, 0x17, 0x08, 0x28, 0x10, 0x1B, 0x06, 0x01, 0x26,
+  0x10, 0x1E, 0x04, 0x02, 0x24, 0x10, 0x20, 0x03, 0x06, 0x10, 0x21, 0x02, 0x05, 0x10, 0x22, 0x02,
+  0x05, 0x10, 0x23, 0x01, 0x05, 0x10, 0x23, 0x01, 0x05, 0x10, 0x23, 0x01, 0x05, 0x10, 0x23, 0x01,
+  0x05, 0x10, 0x24, 0x05, 0x10, 0x24, 0x05, 0x10, 0x24, 0x06, 0x10, 0x22, 0x01, 0x06, 0x10, 0x22,
+  0x01, 0x08, 0x10, 0x1E, 0x03, 0x0E, 0x17, 0x0F, 0x0C, 0x1B, 0x0D, 0x0B, 0x1D, 0x0C, 0x0A, 0x1F,
+  0x0B, 0x09, 0x10, 0x11, 0x0A, 0x08, 0x10, 0x13, 0x09, 0x08, 0x10, 0x13, 0x09, 0x05, 0x10, 0x17,
+  0x08, 0x03, 0x10, 0x1B, 0x06, 0x02, 0x10, 0x1E, 0x04, 0x01, 0x10, 0x20, 0x03, 0x01, 0x10, 0x21,
+  0x02, 0x10, 0x22, 0x02, 0x10, 0x23, 0x01, 0x10, 0x23, 0x01, 0x10, 0x23, 0x01, 0x10, 0x23, 0x01,
+  0x10, 0x24, 0x10, 0x24, 0x10, 0x24, 0x01, 0x10, 0x22, 0x01, 0x01, 0x10, 0x22, 0x01, 0x03, 0x10,
+  0x1E, 0x03, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x05, 0x61,
+  0x0F, 0x61, 0x0E, 0x04, 0x63, 0x0D, 0x63, 0x0D, 0x05, 0x61, 0x0F, 0x61, 0x0E, 0x0D, 0x61, 0x0F,
+  0x61, 0x06, 0x0C, 0x63, 0x0D, 0x63, 0x05, 0x0D, 0x61, 0x0F, 0x61, 0x06, 0x00, 0x10, 0x25, 0x00,
+  0x10, 0x0E, 0x29, 0x0E, 0x0C, 0x2D, 0x0C, 0x0B, 0x2F, 0x0B, 0x0B, 0x2F, 0x0B, 0x0A, 0x20, 0x11,
+  0x0A, 0x0A, 0x20, 0x14, 0x07, 0x07, 0x20, 0x19, 0x05, 0x06, 0x20, 0x1B, 0x04, 0x05, 0x20, 0x1D,
+  0x03, 0x04, 0x20, 0x1E, 0x03, 0x03, 0x20, 0x20, 0x02, 0x03, 0x20, 0x20, 0x02, 0x03, 0x20, 0x20,
+  0x02, 0x03, 0x20, 0x20, 0x02, 0x03, 0x20, 0x20, 0x02, 0x04, 0x20, 0x1E, 0x03, 0x04, 0x20, 0x1E,
+  0x03, 0x05, 0x20, 0x1C, 0x04, 0x06, 0x20, 0x1A, 0x05, 0x07, 0x20, 0x18, 0x06, 0x00, 0x25, 0x00,
+  0x25, 0x00, 0x25, 0x00, 0x25, 0x00, 0x25, 0x01, 0x10, 0x23, 0x01, 0x10, 0x25, 0x01, 0x10, 0x23,
+  0x01, 0x01, 0x10, 0x23, 0x01, 0x00, 0x25, 0x00, 0x25, 0x04, 0x10, 0x1D, 0x04, 0x03, 0x10, 0x1F,
+  0x03, 0x04, 0x10, 0x1D, 0x04, 0x00, 0x25, 0x00, 0x25, 0x06, 0x10, 0x19, 0x06, 0x06, 0x10, 0x19,
+  0x06, 0x05, 0x10, 0x1B, 0x05, 0x06, 0x10, 0x19, 0x06, 0x0E, 0x27, 0x0F, 0x0C, 0x2B, 0x0D, 0x0B,
+  0x2D, 0x0C, 0x0A, 0x2F, 0x0B, 0x09, 0x20, 0x11, 0x0A, 0x08, 0x20, 0x13, 0x09, 0x08, 0x20, 0x13,
+  0x09, 0x05, 0x20, 0x17, 0x08, 0x03, 0x20, 0x1B, 0x06, 0x02, 0x20, 0x1E, 0x04, 0x01, 0x20, 0x20,
+  0x03, 0x01, 0x20, 0x21, 0x02, 0x20, 0x22, 0x02, 0x20, 0x23, 0x01, 0x20, 0x23, 0x01, 0x20, 0x23,
+  0x01, 0x20, 0x23, 0x01, 0x20, 0x24, 0x20, 0x24, 0x20, 0x24, 0x01, 0x20, 0x22, 0x01, 0x01, 0x20,
+  0x22, 0x01, 0x03, 0x20, 0x1E, 0x03, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x05, 0x91, 0x00, 0x11,
+  0x91, 0x0C, 0x04, 0x93, 0x0F, 0x93, 0x0B, 0x05, 0x92, 0x0F, 0x93, 0x0B, 0x05, 0x92, 0x0F, 0x93,
+  0x0B, 0x04, 0x93, 0x05, 0x73, 0x06, 0x94, 0x04, 0x73, 0x04, 0x04, 0x93, 0x04, 0x75, 0x05, 0x93,
+  0x04, 0x75, 0x03, 0x04, 0x92, 0x05, 0x75, 0x05, 0x93, 0x04, 0x75, 0x03, 0x03, 0x93, 0x05, 0x75,
+  0x04, 0x94, 0x04, 0x75, 0x03, 0x03, 0x93, 0x06, 0x73, 0x05, 0x93, 0x06, 0x73, 0x04, 0x02, 0x94,
+  0x0D, 0x94, 0x0D, 0x03, 0x92, 0x0F, 0x92, 0x0E, 0x0E, 0x37, 0x0F, 0x0C, 0x3B, 0x0D, 0x0B, 0x3D,
+  0x0C, 0x0A, 0x3F, 0x0B, 0x09, 0x30, 0x11, 0x0A, 0x08, 0x30, 0x13, 0x09, 0x08, 0x30, 0x13, 0x09,
+  0x05, 0x30, 0x17, 0x08, 0x03, 0x30, 0x1B, 0x06, 0x02, 0x30, 0x1E, 0x04, 0x01, 0x30, 0x20, 0x03,
+  0x01, 0x30, 0x21, 0x02, 0x30, 0x22, 0x02, 0x30, 0x23, 0x01, 0x30, 0x23, 0x01, 0x30, 0x23, 0x01,
+  0x30, 0x23, 0x01, 0x30, 0x24, 0x30, 0x24, 0x30, 0x24, 0x01, 0x30, 0x22, 0x01, 0x01, 0x30, 0x22,
+  0x01, 0x03, 0x30, 0x1E, 0x03, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x03, 0x61, 0x01, 0x61, 0x03,
+  0x62, 0x04, 0x62, 0x04, 0x62, 0x04, 0x62, 0x03, 0x62, 0x02, 0x03, 0x64, 0x02, 0x63, 0x03, 0x63,
+  0x03, 0x63, 0x03, 0x63, 0x02, 0x63, 0x01, 0x03, 0x64, 0x02, 0x63, 0x03, 0x63, 0x03, 0x63, 0x03,
+  0x63, 0x02, 0x63, 0x01, 0x03, 0x64, 0x02, 0x63, 0x03, 0x63, 0x03, 0x63, 0x03, 0x63, 0x02, 0x63,
+  0x01, 0x03, 0x64, 0x01, 0x64, 0x02, 0x64, 0x02, 0x64, 0x02, 0x64, 0x01, 0x64, 0x01, 0x02, 0x64,
+  0x02, 0x63, 0x03, 0x63, 0x03, 0x63, 0x03, 0x63, 0x02, 0x64, 0x01, 0x02, 0x64, 0x02, 0x63, 0x03,
+  0x63, 0x03, 0x63, 0x03, 0x63, 0x02, 0x63, 0x02, 0x02, 0x64, 0x01, 0x64, 0x02, 0x64, 0x02, 0x64,
+  0x02, 0x64, 0x01, 0x64, 0x02, 0x02, 0x63, 0x02, 0x63, 0x03, 0x63, 0x03, 0x63, 0x03, 0x63, 0x02,
+  0x64, 0x02, 0x02, 0x63, 0x02, 0x63, 0x03, 0x63, 0x03, 0x63, 0x03, 0x63, 0x02, 0x64, 0x02, 0x01,
+  0x64, 0x02, 0x63, 0x03, 0x63, 0x03, 0x63, 0x03, 0x63, 0x02, 0x63, 0x03, 0x01, 0x63, 0x02, 0x63,
+  0x03, 0x63, 0x03, 0x63, 0x03, 0x63, 0x02, 0x64, 0x03, 0x01, 0x63, 0x02, 0x63, 0x03, 0x63, 0x03,
+  0x63, 0x03, 0x63, 0x02, 0x64, 0x03, 0x01, 0x63, 0x02, 0x63, 0x03, 0x63, 0x03, 0x63, 0x03, 0x63,
+  0x02, 0x64, 0x03, 0x63, 0x02, 0x63, 0x03, 0x63, 0x03, 0x63, 0x03, 0x63, 0x02, 0x64, 0x04, 0x01,
+  0x61, 0x04, 0x61, 0x05, 0x61, 0x05, 0x61, 0x05, 0x61, 0x04, 0x61, 0x06, 0x0E, 0x17, 0x0F, 0x0C,
+  0x1B, 0x0D, 0x0B, 0x1D, 0x0C, 0x0A, 0x1F, 0x0B, 0x09, 0x10, 0x11, 0x0A, 0x08, 0x10, 0x13, 0x09,
+  0x08, 0x10, 0x13, 0x09, 0x05, 0x10, 0x17, 0x08, 0x03, 0x10, 0x1B, 0x06, 0x02, 0x10, 0x1E, 0x04,
+  0x01, 0x10, 0x20, 0x03, 0x01, 0x10, 0x21, 0x02, 0x10, 0x22, 0x02, 0x10, 0x23, 0x01, 0x10, 0x23,
+  0x01, 0x10, 0x23, 0x01, 0x10, 0x23, 0x01, 0x10, 0x24, 0x10, 0x24, 0x10, 0x24, 0x01, 0x10, 0x22,
+  0x01, 0x01, 0x10, 0x22, 0x01, 0x03, 0x10, 0x1E, 0x03, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00,
+  0x24, 0x00, 0x24, 0x03, 0x73, 0x0A, 0x73, 0x0A, 0x73, 0x04, 0x02, 0x75, 0x08, 0x75, 0x08, 0x75,
+  0x03, 0x02, 0x75, 0x08, 0x75, 0x08, 0x75, 0x03, 0x02, 0x75, 0x08, 0x75, 0x08, 0x75, 0x03, 0x03,
+  0x73, 0x0A, 0x73, 0x0A, 0x73, 0x04, 0x09, 0x73, 0x0B, 0x73, 0x0A, 0x08, 0x75, 0x09, 0x75, 0x09,
+  0x08, 0x75, 0x09, 0x75, 0x09, 0x08, 0x75, 0x09, 0x75, 0x09, 0x09, 0x73, 0x0B, 0x73, 0x0A, 0x00,
+  0x13, 0x51, 0x00, 0x19, 0x00, 0x12, 0x53, 0x00, 0x18, 0x00, 0x12, 0x53, 0x00, 0x18, 0x00, 0x12,
+  0x53, 0x00, 0x18, 0x00, 0x12, 0x53, 0x00, 0x18, 0x00, 0x12, 0x53, 0x00, 0x18, 0x06, 0x52, 0x0A,
+  0x53, 0x0A, 0x52, 0x0C, 0x05, 0x54, 0x0A, 0x51, 0x0A, 0x54, 0x0B, 0x05, 0x55, 0x00, 0x13, 0x55,
+  0x0B, 0x06, 0x55, 0x05, 0x47, 0x05, 0x55, 0x0C, 0x07, 0x54, 0x03, 0x4B, 0x03, 0x54, 0x0D, 0x09,
+  0x51, 0x03, 0x4D, 0x03, 0x52, 0x0E, 0x0B, 0x40, 0x11, 0x00, 0x11, 0x0B, 0x40, 0x11, 0x00, 0x11,
+  0x0A, 0x40, 0x13, 0x00, 0x10, 0x09, 0x40, 0x15, 0x0F, 0x09, 0x40, 0x15, 0x0F, 0x08, 0x40, 0x17,
+  0x0E, 0x08, 0x40, 0x17, 0x0E, 0x01, 0x55, 0x02, 0x40, 0x17, 0x02, 0x55, 0x07, 0x57, 0x01, 0x40,
+  0x17, 0x01, 0x57, 0x06, 0x01, 0x55, 0x02, 0x40, 0x17, 0x02, 0x55, 0x07, 0x08, 0x40, 0x17, 0x0E,
+  0x08, 0x40, 0x17, 0x0E, 0x09, 0x40, 0x15, 0x0F, 0x09, 0x40, 0x15, 0x0F, 0x0A, 0x40, 0x13, 0x00,
+  0x10, 0x0B, 0x40, 0x11, 0x00, 0x11, 0x09, 0x51, 0x01, 0x40, 0x11, 0x01, 0x51, 0x0F, 0x08, 0x53,
+  0x02, 0x4D, 0x02, 0x53, 0x0E, 0x08, 0x53, 0x03, 0x4B, 0x03, 0x54, 0x15, 0x08, 0x07, 0x53, 0x06,
+  0x47, 0x06, 0x52, 0x17, 0x07, 0x05, 0x54, 0x00, 0x15, 0x19, 0x06, 0x05, 0x53, 0x0B, 0x51, 0x08,
+  0x1E, 0x03, 0x06, 0x51, 0x0B, 0x53, 0x05, 0x10, 0x12, 0x01, 0x00, 0x12, 0x53, 0x05, 0x10, 0x12,
+  0x01, 0x00, 0x12, 0x53, 0x04, 0x10, 0x14, 0x00, 0x12, 0x53, 0x04, 0x10, 0x14, 0x00, 0x12, 0x53,
+  0x04, 0x10, 0x14, 0x00, 0x13, 0x51, 0x06, 0x10, 0x13, 0x00, 0x1A, 0x10, 0x13, 0x00, 0x1B, 0x10,
+  0x11, 0x01, 0x0F, 0x51, 0x00, 0x21, 0x0D, 0x54, 0x00, 0x20, 0x0D, 0x54, 0x00, 0x20, 0x0D, 0x54,
+  0x00, 0x20, 0x05, 0x51, 0x07, 0x54, 0x07, 0x51, 0x00, 0x18, 0x04, 0x53, 0x06, 0x54, 0x06, 0x53,
+  0x00, 0x17, 0x04, 0x54, 0x07, 0x51, 0x06, 0x54, 0x00, 0x17, 0x05, 0x54, 0x0C, 0x54, 0x00, 0x18,
+  0x06, 0x54, 0x0A, 0x54, 0x00, 0x19, 0x07, 0x52, 0x04, 0x45, 0x03, 0x52, 0x00, 0x1A, 0x0C, 0x47,
+  0x00, 0x1E, 0x0B, 0x49, 0x00, 0x1D, 0x0A, 0x49, 0x25, 0x00, 0x19, 0x09, 0x48, 0x29, 0x00, 0x17,
+  0x01, 0x55, 0x03, 0x47, 0x2B, 0x52, 0x00, 0x14, 0x57, 0x02, 0x46, 0x2D, 0x52, 0x00, 0x13, 0x01,
+  0x55, 0x03, 0x46, 0x2D, 0x51, 0x00, 0x14, 0x09, 0x43, 0x20, 0x13, 0x00, 0x12, 0x0A, 0x41, 0x20,
+  0x11, 0x17, 0x0E, 0x0A, 0x20, 0x10, 0x1B, 0x0C, 0x09, 0x20, 0x10, 0x1D, 0x0B, 0x07, 0x52, 0x2F,
+  0x1F, 0x0A, 0x06, 0x53, 0x2E, 0x10, 0x11, 0x09, 0x05, 0x54, 0x2D, 0x10, 0x13, 0x08, 0x04, 0x54,
+  0x01, 0x2D, 0x10, 0x13, 0x08, 0x04, 0x53, 0x03, 0x2B, 0x10, 0x15, 0x07, 0x05, 0x51, 0x04, 0x2B,
+  0x10, 0x17, 0x05, 0x0B, 0x29, 0x10, 0x1A, 0x03, 0x0D, 0x54, 0x02, 0x10, 0x1C, 0x02, 0x0D, 0x54,
+  0x01, 0x10, 0x1E, 0x01, 0x0F, 0x51, 0x01, 0x10, 0x1F, 0x01, 0x00, 0x10, 0x10, 0x21, 0x00, 0x10,
+  0x10, 0x21, 0x00, 0x10, 0x10, 0x21, 0x00, 0x10, 0x10, 0x21, 0x00, 0x10, 0x10, 0x21, 0x00, 0x10,
+  0x10, 0x20, 0x01, 0x00, 0x10, 0x10, 0x20, 0x01, 0x00, 0x11, 0x10, 0x1E, 0x02, 0x00, 0x12, 0x10,
+  0x1C, 0x03, 0x00, 0x13, 0x10, 0x1A, 0x04, 0x00, 0x11, 0x51, 0x00, 0x1C, 0x00, 0x10, 0x53, 0x00,
+  0x1B, 0x00, 0x10, 0x53, 0x00, 0x1B, 0x00, 0x10, 0x53, 0x00, 0x1B, 0x00, 0x10, 0x53, 0x00, 0x1B,
+  0x06, 0x52, 0x08, 0x53, 0x09, 0x52, 0x00, 0x10, 0x05, 0x54, 0x08, 0x51, 0x09, 0x54, 0x0F, 0x05,
+  0x55, 0x00, 0x10, 0x55, 0x0F, 0x06, 0x55, 0x04, 0x45, 0x05, 0x55, 0x00, 0x10, 0x07, 0x54, 0x02,
+  0x49, 0x03, 0x54, 0x00, 0x11, 0x08, 0x52, 0x01, 0x4D, 0x02, 0x52, 0x00, 0x12, 0x0A, 0x4F, 0x00,
+  0x15, 0x0A, 0x4F, 0x00, 0x15, 0x09, 0x40, 0x11, 0x00, 0x14, 0x09, 0x40, 0x11, 0x00, 0x14, 0x08,
+  0x40, 0x13, 0x00, 0x13, 0x01, 0x55, 0x02, 0x40, 0x13, 0x02, 0x56, 0x0B, 0x57, 0x01, 0x40, 0x13,
+  0x01, 0x58, 0x0A, 0x01, 0x55, 0x02, 0x40, 0x13, 0x02, 0x56, 0x0B, 0x08, 0x40, 0x13, 0x15, 0x0E,
+  0x09, 0x40, 0x10, 0x19, 0x0C, 0x09, 0x4E, 0x1D, 0x0A, 0x0A, 0x4C, 0x1F, 0x09, 0x0A, 0x4C, 0x1F,
+  0x09, 0x0B, 0x4A, 0x10, 0x11, 0x08, 0x08, 0x52, 0x03, 0x48, 0x10, 0x11, 0x08, 0x07, 0x54, 0x04,
+  0x45, 0x10, 0x15, 0x05, 0x06, 0x55, 0x08, 0x10, 0x18, 0x03, 0x05, 0x55, 0x07, 0x51, 0x10, 0x1A,
+  0x02, 0x05, 0x54, 0x07, 0x51, 0x10, 0x1C, 0x01, 0x06, 0x52, 0x08, 0x10, 0x1D, 0x01, 0x0F, 0x10,
+  0x1F, 0x0F, 0x10, 0x1F, 0x0F, 0x10, 0x1F, 0x0F, 0x10, 0x1F, 0x0F, 0x10, 0x1F, 0x0F, 0x10, 0x1F,
+  0x0F, 0x10, 0x1F, 0x00, 0x10, 0x10, 0x1D, 0x01, 0x00, 0x11, 0x10, 0x1B, 0x02, 0x00, 0x24, 0x15,
+  0x05, 0x0E, 0x17, 0x0F, 0x0C, 0x1B, 0x0D, 0x0B, 0x1D, 0x0C, 0x0A, 0x1F, 0x0B, 0x09, 0x10, 0x11,
+  0x0A, 0x08, 0x10, 0x13, 0x09, 0x08, 0x10, 0x13, 0x09, 0x05, 0x10, 0x17, 0x08, 0x03, 0x10, 0x1B,
+  0x06, 0x02, 0x10, 0x1E, 0x04, 0x01, 0x10, 0x20, 0x03, 0x01, 0x10, 0x21, 0x02, 0x10, 0x22, 0x02,
+  0x10, 0x23, 0x01, 0x10, 0x23, 0x01, 0x10, 0x23, 0x01, 0x10, 0x23, 0x01, 0x10, 0x24, 0x10, 0x24,
+  0x10, 0x24, 0x01, 0x10, 0x22, 0x01, 0x01, 0x10, 0x22, 0x01, 0x03, 0x10, 0x1E, 0x03, 0x00, 0x24,
+  0x00, 0x24, 0x00, 0x24, 0x04, 0x62, 0x07, 0x62, 0x08, 0x62, 0x07, 0x62, 0x02, 0x04, 0x63, 0x06,
+  0x63, 0x07, 0x63, 0x06, 0x63, 0x01, 0x04, 0x63, 0x06, 0x63, 0x07, 0x63, 0x06, 0x63, 0x01, 0x03,
+  0x64, 0x05, 0x64, 0x06, 0x64, 0x05, 0x64, 0x01, 0x03, 0x63, 0x06, 0x63, 0x07, 0x63, 0x06, 0x63,
+  0x02, 0x02, 0x64, 0x05, 0x64, 0x06, 0x64, 0x05, 0x64, 0x02, 0x02, 0x63, 0x06, 0x63, 0x07, 0x63,
+  0x06, 0x63, 0x03, 0x02, 0x63, 0x06, 0x63, 0x07, 0x63, 0x06, 0x63, 0x03, 0x01, 0x64, 0x05, 0x64,
+  0x06, 0x64, 0x05, 0x64, 0x03, 0x01, 0x63, 0x06, 0x63, 0x07, 0x63, 0x06, 0x63, 0x04, 0x64, 0x05,
+  0x64, 0x06, 0x64, 0x05, 0x64, 0x04, 0x01, 0x62, 0x07, 0x62, 0x08, 0x62, 0x07, 0x62, 0x05, 0x0E,
+  0x17, 0x0F, 0x0C, 0x1B, 0x0D, 0x0B, 0x1D, 0x0C, 0x0A, 0x1F, 0x0B, 0x09, 0x10, 0x11, 0x0A, 0x08,
+  0x10, 0x13, 0x09, 0x08, 0x10, 0x13, 0x09, 0x05, 0x10, 0x17, 0x08, 0x03, 0x10, 0x1B, 0x06, 0x02,
+  0x10, 0x1E, 0x04, 0x01, 0x10, 0x20, 0x03, 0x01, 0x10, 0x21, 0x02, 0x10, 0x22, 0x02, 0x10, 0x23,
+  0x01, 0x10, 0x23, 0x01, 0x10, 0x23, 0x01, 0x10, 0x23, 0x01, 0x10, 0x24, 0x10, 0x24, 0x10, 0x24,
+  0x01, 0x10, 0x22, 0x01, 0x01, 0x10, 0x22, 0x01, 0x03, 0x10, 0x1E, 0x03, 0x00, 0x24, 0x00, 0x24,
+  0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x03, 0x11, 0x01, 0x11, 0x0E, 0x11, 0x02, 0x11, 0x0C, 0x03,
+  0x11, 0x01, 0x11, 0x0F, 0x12, 0x0D, 0x04, 0x11, 0x00, 0x10, 0x12, 0x0D, 0x01, 0x17, 0x0A, 0x17,
+  0x0B, 0x03, 0x11, 0x01, 0x11, 0x0F, 0x12, 0x0D, 0x03, 0x11, 0x01, 0x11, 0x05, 0x11, 0x02, 0x11,
+  0x05, 0x11, 0x02, 0x11, 0x05, 0x11, 0x01, 0x11, 0x04, 0x0C, 0x12, 0x0F, 0x11, 0x01, 0x11, 0x04,
+  0x0A, 0x17, 0x0A, 0x17, 0x02, 0x0C, 0x12, 0x00, 0x10, 0x11, 0x05, 0x0C, 0x12, 0x0F, 0x11, 0x01,
+  0x11, 0x04, 0x0B, 0x11, 0x02, 0x11, 0x0E, 0x11, 0x01, 0x11, 0x04, 0x0E, 0x37, 0x0F, 0x0C, 0x3B,
+  0x0D, 0x0B, 0x3D, 0x0C, 0x0A, 0x3F, 0x0B, 0x09, 0x30, 0x11, 0x0A, 0x08, 0x30, 0x13, 0x09, 0x08,
+  0x30, 0x13, 0x09, 0x05, 0x30, 0x17, 0x08, 0x03, 0x30, 0x1B, 0x06, 0x02, 0x30, 0x1E, 0x04, 0x01,
+  0x30, 0x20, 0x03, 0x01, 0x30, 0x21, 0x02, 0x30, 0x22, 0x02, 0x30, 0x23, 0x01, 0x30, 0x23, 0x01,
+  0x30, 0x23, 0x01, 0x30, 0x23, 0x01, 0x30, 0x24, 0x30, 0x24, 0x30, 0x24, 0x01, 0x30, 0x22, 0x01,
+  0x01, 0x30, 0x22, 0x01, 0x03, 0x3F, 0x81, 0x3E, 0x03, 0x00, 0x12, 0x81, 0x00, 0x11, 0x00, 0x11,
+  0x82, 0x00, 0x11, 0x00, 0x11, 0x82, 0x00, 0x11, 0x00, 0x10, 0x83, 0x00, 0x11, 0x00, 0x10, 0x83,
+  0x00, 0x11, 0x0F, 0x84, 0x00, 0x11, 0x0E, 0x85, 0x00, 0x11, 0x0E, 0x85, 0x00, 0x11, 0x0D, 0x87,
+  0x00, 0x10, 0x0D, 0x8A, 0x0D, 0x0C, 0x8B, 0x0D, 0x0B, 0x81, 0x04, 0x86, 0x0E, 0x00, 0x10, 0x86,
+  0x0E, 0x00, 0x10, 0x85, 0x0F, 0x00, 0x10, 0x84, 0x00, 0x10, 0x00, 0x10, 0x84, 0x00, 0x10, 0x0F,
+  0x84, 0x00, 0x11, 0x0F, 0x84, 0x00, 0x11, 0x0F, 0x83, 0x00, 0x12, 0x0F, 0x82, 0x00, 0x13, 0x0F,
+  0x82, 0x00, 0x13, 0x0F, 0x81, 0x00, 0x14, 0x0E, 0x81, 0x00, 0x15,
+};
+
+const IconBitmap ConditionsAtlasLarge[CONDITIONS_COUNT] = {
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 0, 9, 1209, 171, 171, -85, -85 }, // clear
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 1209, 9, 684, 165, 123, -80, -68 }, // cloudy
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 1893, 9, 678, 142, 148, -69, -85 }, // drizzle
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 2571, 9, 702, 153, 170, -76, -85 }, // fog
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 3273, 9, 840, 142, 154, -69, -85 }, // freezing-rain
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 4113, 9, 1380, 147, 175, -73, -89 }, // heavy-rain
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 5493, 9, 789, 142, 156, -69, -85 }, // ice-pellets
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 6282, 9, 1307, 184, 172, -93, -95 }, // mostly-clear
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 7589, 9, 1250, 203, 168, -115, -109 }, // mostly-cloudy
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 8839, 9, 1191, 189, 166, -109, -109 }, // partly-cloudy
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 10030, 9, 1096, 147, 159, -73, -85 }, // rain
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 11126, 9, 984, 142, 163, -69, -85 }, // snow
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 12110, 9, 943, 142, 190, -69, -89 }, // thunderstorm
+};
+
+const IconBitmap ConditionsAtlasSmall[CONDITIONS_COUNT] = {
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 13053, 9, 218, 41, 41, -20, -20 }, // clear
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 13271, 9, 126, 41, 31, -19, -17 }, // cloudy
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 13397, 9, 119, 36, 35, -17, -20 }, // drizzle
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 13516, 9, 141, 37, 41, -18, -20 }, // fog
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 13657, 9, 159, 36, 37, -17, -20 }, // freezing-rain
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 13816, 9, 292, 36, 42, -17, -21 }, // heavy-rain
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 14108, 9, 147, 36, 38, -17, -20 }, // ice-pellets
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 14255, 9, 243, 45, 42, -22, -23 }, // mostly-clear
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 14498, 9, 229, 49, 41, -27, -26 }, // mostly-cloudy
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 14727, 9, 218, 46, 41, -26, -26 }, // partly-cloudy
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 14945, 9, 190, 36, 38, -17, -20 }, // rain
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 15135, 9, 172, 36, 39, -17, -20 }, // snow
+  { ConditionsAtlasPalette, ConditionsAtlasRuns + 15307, 9, 176, 36, 46, -17, -21 }, // thunderstorm
+};
@@ -0,0 +1,142 @@
+// IconCloud.h - Generated by scripts/icon-compiler.py from assets/icons/cloud.png, do not edit
+#pragma once
+#include "../IconBitmap.h"
+
+// 178x130, 2 colors, 2064 bytes of runs
+const uint16_t IconCloudPalette[] PROGMEM = {
+  0xFFFF, 0x630C
+};
+
+const uint8_t IconCloudRuns[] PROGMEM = {
+  0x00, 0x4A, 0x2F, 0x00, 0x59, 0x00, 0x45, 0x25, 0x1F, 0x25, 0x00, 0x54, 0x00, 0x41, 0x24, 0x10,
+  0x19, 0x24, 0x00, 0x50, 0x00, 0x3E, 0x23, 0x10, 0x21, 0x23, 0x00, 0x4D, 0x00, 0x3C, 0x22, 0x10,
+  0x27, 0x22, 0x00, 0x4B, 0x00, 0x3A, 0x22, 0x10, 0x2B, 0x22, 0x00, 0x49, 0x00, 0x38, 0x22, 0x10,
+  0x2F, 0x22, 0x00, 0x47, 0x00, 0x36, 0x22, 0x10, 0x33, 0x22, 0x00, 0x45, 0x00, 0x34, 0x22, 0x10,
+  0x37, 0x22, 0x00, 0x43, 0x00, 0x33, 0x21, 0x10, 0x3B, 0x21, 0x00, 0x42, 0x00, 0x32, 0x21, 0x10,
+  0x3D, 0x21, 0x00, 0x41, 0x00, 0x30, 0x22, 0x10, 0x3F, 0x22, 0x00, 0x3F, 0x00, 0x2F, 0x21, 0x10,
+  0x43, 0x21, 0x00, 0x3E, 0x00, 0x2E, 0x21, 0x10, 0x45, 0x21, 0x00, 0x3D, 0x00, 0x2D, 0x21, 0x10,
+  0x47, 0x21, 0x00, 0x3C, 0x00, 0x2C, 0x21, 0x10, 0x49, 0x21, 0x00, 0x3B, 0x00, 0x2B, 0x21, 0x10,
+  0x4B, 0x21, 0x00, 0x3A, 0x00, 0x2A, 0x21, 0x10, 0x4D, 0x21, 0x00, 0x39, 0x00, 0x29, 0x21, 0x10,
+  0x4F, 0x21, 0x00, 0x38, 0x00, 0x28, 0x21, 0x10, 0x51, 0x21, 0x00, 0x37, 0x00, 0x27, 0x21, 0x10,
+  0x53, 0x21, 0x00, 0x36, 0x00, 0x26, 0x21, 0x10, 0x55, 0x21, 0x00, 0x35, 0x00, 0x26, 0x21, 0x10,
+  0x55, 0x21, 0x00, 0x35, 0x00, 0x25, 0x21, 0x10, 0x57, 0x21, 0x00, 0x34, 0x00, 0x24, 0x21, 0x10,
+  0x59, 0x21, 0x00, 0x33, 0x00, 0x23, 0x21, 0x10, 0x5B, 0x21, 0x00, 0x32, 0x00, 0x23, 0x21, 0x10,
+  0x5B, 0x21, 0x00, 0x32, 0x00, 0x22, 0x21, 0x10, 0x5D, 0x21, 0x00, 0x31, 0x00, 0x22, 0x21, 0x10,
+  0x5D, 0x21, 0x00, 0x31, 0x00, 0x21, 0x21, 0x10, 0x5F, 0x21, 0x00, 0x30, 0x00, 0x21, 0x21, 0x10,
+  0x5F, 0x21, 0x00, 0x30, 0x00, 0x20, 0x21, 0x10, 0x61, 0x21, 0x00, 0x2F, 0x00, 0x20, 0x21, 0x10,
+  0x61, 0x21, 0x00, 0x2F, 0x00, 0x1F, 0x21, 0x17, 0x2D, 0x10, 0x3B, 0x2D, 0x17, 0x21, 0x00, 0x2E,
+  0x00, 0x1F, 0x21, 0x12, 0x25, 0x1D, 0x25, 0x10, 0x31, 0x25, 0x1D, 0x25, 0x12, 0x21, 0x00, 0x2E,
+  0x00, 0x1E, 0x24, 0x10, 0x17, 0x23, 0x10, 0x2B, 0x23, 0x10, 0x17, 0x24, 0x00, 0x2D, 0x00, 0x1C,
+  0x23, 0x10, 0x1D, 0x23, 0x10, 0x25, 0x23, 0x10, 0x1D, 0x23, 0x00, 0x2B, 0x00, 0x1A, 0x22, 0x12,
+  0x21, 0x10, 0x20, 0x22, 0x10, 0x21, 0x22, 0x10, 0x20, 0x21, 0x12, 0x22, 0x00, 0x29, 0x00, 0x18,
+  0x22, 0x13, 0x21, 0x10, 0x23, 0x22, 0x10, 0x1D, 0x22, 0x10, 0x23, 0x21, 0x13, 0x22, 0x00, 0x27,
+  0x00, 0x16, 0x22, 0x15, 0x21, 0x10, 0x25, 0x22, 0x10, 0x19, 0x22, 0x10, 0x25, 0x21, 0x15, 0x22,
+  0x00, 0x25, 0x00, 0x15, 0x21, 0x17, 0x21, 0x10, 0x27, 0x21, 0x10, 0x17, 0x21, 0x10, 0x27, 0x21,
+  0x17, 0x21, 0x00, 0x24, 0x00, 0x13, 0x22, 0x18, 0x21, 0x10, 0x28, 0x22, 0x10, 0x13, 0x22, 0x10,
+  0x28, 0x21, 0x18, 0x22, 0x00, 0x22, 0x00, 0x12, 0x21, 0x19, 0x21, 0x10, 0x2B, 0x21, 0x10, 0x11,
+  0x21, 0x10, 0x2B, 0x21, 0x19, 0x21, 0x00, 0x21, 0x00, 0x11, 0x21, 0x1A, 0x21, 0x10, 0x2C, 0x21,
+  0x1F, 0x21, 0x10, 0x2C, 0x21, 0x1A, 0x21, 0x00, 0x20, 0x0F, 0x22, 0x1B, 0x21, 0x10, 0x2D, 0x22,
+  0x1B, 0x22, 0x10, 0x2D, 0x21, 0x1B, 0x22, 0x00, 0x1E, 0x0E, 0x21, 0x1D, 0x21, 0x10, 0x2F, 0x21,
+  0x19, 0x21, 0x10, 0x2F, 0x21, 0x1D, 0x21, 0x00, 0x1D, 0x0D, 0x21, 0x1E, 0x21, 0x10, 0x30, 0x21,
+  0x17, 0x21, 0x10, 0x30, 0x21, 0x1E, 0x21, 0x00, 0x1C, 0x0C, 0x21, 0x1E, 0x21, 0x10, 0x32, 0x21,
+  0x15, 0x21, 0x10, 0x32, 0x21, 0x1E, 0x21, 0x00, 0x1B, 0x0B, 0x21, 0x1F, 0x21, 0x10, 0x33, 0x21,
+  0x13, 0x21, 0x10, 0x33, 0x21, 0x1F, 0x21, 0x00, 0x1A, 0x0B, 0x21, 0x1F, 0x21, 0x10, 0x33, 0x21,
+  0x13, 0x21, 0x10, 0x33, 0x21, 0x1F, 0x21, 0x00, 0x1A, 0x0A, 0x21, 0x10, 0x10, 0x21, 0x10, 0x34,
+  0x21, 0x11, 0x21, 0x10, 0x34, 0x21, 0x10, 0x10, 0x21, 0x00, 0x19, 0x09, 0x21, 0x10, 0x11, 0x21,
+  0x10, 0x35, 0x21, 0x10, 0x35, 0x21, 0x10, 0x11, 0x21, 0x00, 0x18, 0x08, 0x21, 0x10, 0x12, 0x21,
+  0x10, 0x34, 0x21, 0x11, 0x21, 0x10, 0x34, 0x21, 0x10, 0x12, 0x21, 0x00, 0x17, 0x08, 0x21, 0x10,
+  0x12, 0x21, 0x10, 0x34, 0x21, 0x11, 0x21, 0x10, 0x34, 0x21, 0x10, 0x12, 0x21, 0x00, 0x17, 0x07,
+  0x21, 0x10, 0x13, 0x21, 0x10, 0x33, 0x21, 0x13, 0x21, 0x10, 0x33, 0x21, 0x10, 0x13, 0x21, 0x00,
+  0x16, 0x06, 0x21, 0x10, 0x14, 0x21, 0x10, 0x32, 0x21, 0x15, 0x21, 0x10, 0x32, 0x21, 0x10, 0x14,
+  0x21, 0x00, 0x15, 0x06, 0x21, 0x10, 0x14, 0x21, 0x10, 0x32, 0x21, 0x15, 0x21, 0x10, 0x32, 0x21,
+  0x10, 0x14, 0x21, 0x00, 0x15, 0x05, 0x21, 0x10, 0x15, 0x21, 0x10, 0x31, 0x21, 0x17, 0x21, 0x10,
+  0x31, 0x2C, 0x1A, 0x21, 0x00, 0x14, 0x05, 0x21, 0x10, 0x15, 0x21, 0x10, 0x31, 0x21, 0x17, 0x21,
+  0x10, 0x2D, 0x25, 0x1B, 0x25, 0x15, 0x21, 0x00, 0x14, 0x04, 0x21, 0x10, 0x16, 0x21, 0x10, 0x30,
+  0x21, 0x19, 0x21, 0x10, 0x29, 0x23, 0x14, 0x21, 0x10, 0x10, 0x23, 0x13, 0x21, 0x00, 0x13, 0x04,
+  0x21, 0x10, 0x16, 0x21, 0x10, 0x30, 0x21, 0x19, 0x21, 0x10, 0x27, 0x22, 0x17, 0x21, 0x10, 0x13,
+  0x22, 0x11, 0x21, 0x00, 0x13, 0x03, 0x21, 0x10, 0x17, 0x21, 0x10, 0x2F, 0x21, 0x1B, 0x21, 0x10,
+  0x24, 0x22, 0x19, 0x21, 0x10, 0x15, 0x23, 0x00, 0x12, 0x03, 0x21, 0x10, 0x18, 0x21, 0x10, 0x2E,
+  0x21, 0x1B, 0x21, 0x10, 0x22, 0x22, 0x1A, 0x21, 0x10, 0x18, 0x22, 0x00, 0x11, 0x03, 0x21, 0x10,
+  0x18, 0x21, 0x10, 0x2E, 0x21, 0x1B, 0x21, 0x10, 0x21, 0x21, 0x1C, 0x21, 0x10, 0x18, 0x21, 0x11,
+  0x21, 0x00, 0x10, 0x02, 0x21, 0x10, 0x19, 0x21, 0x10, 0x2D, 0x21, 0x1D, 0x21, 0x10, 0x1F, 0x21,
+  0x1D, 0x21, 0x10, 0x19, 0x21, 0x11, 0x21, 0x0F, 0x02, 0x21, 0x10, 0x19, 0x21, 0x10, 0x2D, 0x21,
+  0x1D, 0x21, 0x10, 0x1D, 0x22, 0x1E, 0x21, 0x10, 0x19, 0x21, 0x12, 0x22, 0x0D, 0x02, 0x21, 0x10,
+  0x19, 0x21, 0x10, 0x2D, 0x21, 0x1D, 0x21, 0x10, 0x1C, 0x21, 0x10, 0x10, 0x21, 0x10, 0x19, 0x21,
+  0x14, 0x21, 0x0C, 0x01, 0x21, 0x10, 0x1B, 0x21, 0x10, 0x2B, 0x21, 0x1F, 0x21, 0x10, 0x1A, 0x21,
+  0x10, 0x10, 0x21, 0x10, 0x1B, 0x21, 0x14, 0x21, 0x0B, 0x01, 0x21, 0x10, 0x1B, 0x21, 0x10, 0x2B,
+  0x21, 0x1F, 0x21, 0x10, 0x19, 0x21, 0x10, 0x11, 0x21, 0x10, 0x1B, 0x21, 0x15, 0x21, 0x0A, 0x01,
+  0x21, 0x10, 0x1B, 0x21, 0x10, 0x2B, 0x21, 0x1F, 0x21, 0x10, 0x18, 0x21, 0x10, 0x12, 0x21, 0x10,
+  0x1B, 0x21, 0x16, 0x21, 0x09, 0x01, 0x21, 0x10, 0x1B, 0x21, 0x10, 0x2B, 0x21, 0x1F, 0x21, 0x10,
+  0x17, 0x21, 0x10, 0x13, 0x21, 0x10, 0x1B, 0x21, 0x17, 0x21, 0x08, 0x01, 0x21, 0x10, 0x1C, 0x21,
+  0x10, 0x2A, 0x21, 0x1F, 0x21, 0x10, 0x17, 0x21, 0x10, 0x12, 0x21, 0x10, 0x1C, 0x21, 0x17, 0x21,
+  0x08, 0x21, 0x10, 0x1D, 0x21, 0x10, 0x29, 0x21, 0x10, 0x11, 0x21, 0x10, 0x15, 0x21, 0x10, 0x13,
+  0x21, 0x10, 0x1D, 0x21, 0x17, 0x21, 0x07, 0x21, 0x10, 0x1D, 0x21, 0x10, 0x29, 0x21, 0x10, 0x11,
+  0x21, 0x10, 0x14, 0x21, 0x10, 0x14, 0x21, 0x10, 0x1D, 0x21, 0x18, 0x21, 0x06, 0x21, 0x10, 0x1E,
+  0x21, 0x10, 0x28, 0x21, 0x10, 0x11, 0x21, 0x10, 0x13, 0x21, 0x10, 0x14, 0x21, 0x10, 0x1E, 0x21,
+  0x19, 0x21, 0x05, 0x21, 0x10, 0x1E, 0x21, 0x10, 0x28, 0x21, 0x10, 0x11, 0x21, 0x10, 0x13, 0x21,
+  0x10, 0x14, 0x21, 0x10, 0x1E, 0x21, 0x19, 0x21, 0x05, 0x21, 0x10, 0x1F, 0x21, 0x10, 0x27, 0x21,
+  0x10, 0x11, 0x21, 0x10, 0x12, 0x21, 0x10, 0x14, 0x21, 0x10, 0x1F, 0x21, 0x1A, 0x21, 0x04, 0x21,
+  0x10, 0x1F, 0x21, 0x10, 0x27, 0x21, 0x10, 0x11, 0x21, 0x10, 0x12, 0x21, 0x10, 0x14, 0x21, 0x10,
+  0x1F, 0x21, 0x1A, 0x21, 0x04, 0x21, 0x10, 0x20, 0x21, 0x10, 0x26, 0x21, 0x10, 0x11, 0x21, 0x10,
+  0x11, 0x21, 0x10, 0x14, 0x21, 0x10, 0x20, 0x21, 0x1B, 0x21, 0x03, 0x21, 0x10, 0x20, 0x21, 0x10,
+  0x26, 0x21, 0x10, 0x11, 0x21, 0x10, 0x11, 0x21, 0x10, 0x14, 0x21, 0x10, 0x20, 0x21, 0x1B, 0x21,
+  0x03, 0x21, 0x10, 0x21, 0x21, 0x10, 0x25, 0x21, 0x10, 0x11, 0x21, 0x10, 0x10, 0x21, 0x10, 0x14,
+  0x21, 0x10, 0x21, 0x21, 0x1C, 0x21, 0x02, 0x21, 0x10, 0x21, 0x21, 0x10, 0x25, 0x21, 0x10, 0x11,
+  0x21, 0x10, 0x10, 0x21, 0x10, 0x14, 0x21, 0x10, 0x21, 0x21, 0x1C, 0x21, 0x02, 0x21, 0x10, 0x22,
+  0x21, 0x10, 0x24, 0x21, 0x10, 0x11, 0x21, 0x10, 0x10, 0x21, 0x10, 0x13, 0x21, 0x10, 0x22, 0x21,
+  0x1C, 0x21, 0x02, 0x21, 0x10, 0x22, 0x21, 0x10, 0x24, 0x21, 0x10, 0x11, 0x21, 0x1F, 0x21, 0x10,
+  0x14, 0x21, 0x10, 0x22, 0x21, 0x1D, 0x21, 0x01, 0x21, 0x10, 0x23, 0x21, 0x10, 0x23, 0x21, 0x10,
+  0x11, 0x21, 0x1F, 0x21, 0x10, 0x13, 0x21, 0x10, 0x23, 0x21, 0x1D, 0x21, 0x01, 0x01, 0x21, 0x10,
+  0x23, 0x21, 0x10, 0x23, 0x21, 0x1F, 0x21, 0x10, 0x10, 0x21, 0x10, 0x12, 0x21, 0x10, 0x23, 0x21,
+  0x1E, 0x21, 0x01, 0x01, 0x21, 0x10, 0x24, 0x21, 0x10, 0x22, 0x21, 0x1F, 0x21, 0x10, 0x10, 0x21,
+  0x10, 0x11, 0x21, 0x10, 0x24, 0x21, 0x1E, 0x21, 0x01, 0x01, 0x21, 0x10, 0x24, 0x21, 0x10, 0x22,
+  0x21, 0x1F, 0x21, 0x10, 0x10, 0x21, 0x10, 0x11, 0x21, 0x10, 0x24, 0x21, 0x1E, 0x21, 0x01, 0x01,
+  0x21, 0x10, 0x25, 0x21, 0x10, 0x21, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x10, 0x11, 0x21, 0x10, 0x25,
+  0x21, 0x1F, 0x21, 0x01, 0x21, 0x10, 0x26, 0x21, 0x10, 0x20, 0x21, 0x1F, 0x21, 0x1F, 0x21, 0x10,
+  0x10, 0x21, 0x10, 0x26, 0x21, 0x1F, 0x21, 0x02, 0x21, 0x10, 0x26, 0x21, 0x10, 0x20, 0x21, 0x1D,
+  0x21, 0x10, 0x10, 0x21, 0x1F, 0x21, 0x10, 0x26, 0x21, 0x10, 0x10, 0x21, 0x02, 0x21, 0x10, 0x27,
+  0x21, 0x10, 0x1F, 0x21, 0x1D, 0x21, 0x10, 0x10, 0x21, 0x1E, 0x21, 0x10, 0x27, 0x21, 0x10, 0x10,
+  0x21, 0x02, 0x21, 0x10, 0x28, 0x21, 0x10, 0x1E, 0x21, 0x1D, 0x21, 0x10, 0x10, 0x21, 0x1D, 0x21,
+  0x10, 0x28, 0x21, 0x10, 0x10, 0x21, 0x03, 0x21, 0x10, 0x28, 0x21, 0x10, 0x1E, 0x21, 0x1B, 0x21,
+  0x10, 0x11, 0x21, 0x1C, 0x21, 0x10, 0x28, 0x21, 0x10, 0x11, 0x21, 0x03, 0x21, 0x10, 0x29, 0x21,
+  0x10, 0x1D, 0x21, 0x1B, 0x21, 0x10, 0x11, 0x21, 0x1B, 0x21, 0x10, 0x29, 0x21, 0x10, 0x11, 0x21,
+  0x03, 0x21, 0x10, 0x2A, 0x21, 0x10, 0x1C, 0x21, 0x1B, 0x21, 0x10, 0x11, 0x21, 0x1A, 0x21, 0x10,
+  0x2A, 0x21, 0x10, 0x11, 0x21, 0x04, 0x21, 0x10, 0x2A, 0x21, 0x10, 0x1C, 0x21, 0x19, 0x21, 0x10,
+  0x12, 0x21, 0x19, 0x21, 0x10, 0x2A, 0x21, 0x10, 0x12, 0x21, 0x04, 0x21, 0x10, 0x2B, 0x22, 0x10,
+  0x1A, 0x21, 0x19, 0x21, 0x10, 0x12, 0x21, 0x17, 0x22, 0x10, 0x2B, 0x21, 0x10, 0x12, 0x21, 0x05,
+  0x21, 0x10, 0x2C, 0x21, 0x10, 0x1A, 0x21, 0x17, 0x21, 0x10, 0x13, 0x21, 0x16, 0x21, 0x10, 0x2C,
+  0x21, 0x10, 0x13, 0x21, 0x05, 0x21, 0x10, 0x2D, 0x21, 0x10, 0x19, 0x21, 0x17, 0x21, 0x10, 0x14,
+  0x21, 0x14, 0x21, 0x10, 0x2D, 0x21, 0x10, 0x12, 0x21, 0x01, 0x06, 0x21, 0x10, 0x2D, 0x22, 0x10,
+  0x18, 0x21, 0x15, 0x21, 0x10, 0x15, 0x21, 0x12, 0x22, 0x10, 0x2D, 0x21, 0x10, 0x13, 0x21, 0x01,
+  0x06, 0x21, 0x10, 0x2F, 0x22, 0x10, 0x16, 0x21, 0x15, 0x21, 0x10, 0x15, 0x23, 0x10, 0x2F, 0x21,
+  0x10, 0x13, 0x21, 0x01, 0x07, 0x21, 0x10, 0x30, 0x22, 0x10, 0x15, 0x21, 0x13, 0x21, 0x10, 0x15,
+  0x22, 0x10, 0x30, 0x21, 0x10, 0x14, 0x21, 0x01, 0x08, 0x21, 0x10, 0x31, 0x22, 0x10, 0x14, 0x21,
+  0x11, 0x21, 0x10, 0x14, 0x22, 0x11, 0x21, 0x10, 0x2F, 0x21, 0x10, 0x15, 0x21, 0x01, 0x08, 0x21,
+  0x10, 0x33, 0x22, 0x10, 0x12, 0x21, 0x11, 0x21, 0x10, 0x12, 0x22, 0x14, 0x21, 0x10, 0x2E, 0x21,
+  0x10, 0x14, 0x21, 0x02, 0x09, 0x21, 0x10, 0x34, 0x23, 0x10, 0x10, 0x21, 0x10, 0x10, 0x23, 0x16,
+  0x21, 0x10, 0x2D, 0x21, 0x10, 0x15, 0x21, 0x02, 0x0A, 0x21, 0x10, 0x36, 0x24, 0x1B, 0x21, 0x11,
+  0x21, 0x1B, 0x24, 0x19, 0x21, 0x10, 0x2C, 0x21, 0x10, 0x16, 0x21, 0x02, 0x0B, 0x21, 0x10, 0x39,
+  0x25, 0x15, 0x21, 0x13, 0x21, 0x15, 0x25, 0x1E, 0x21, 0x10, 0x2A, 0x21, 0x10, 0x16, 0x21, 0x03,
+  0x0B, 0x21, 0x10, 0x3E, 0x2F, 0x10, 0x13, 0x21, 0x10, 0x2A, 0x21, 0x10, 0x16, 0x21, 0x03, 0x0C,
+  0x21, 0x10, 0x41, 0x21, 0x05, 0x21, 0x10, 0x18, 0x21, 0x10, 0x28, 0x21, 0x10, 0x16, 0x21, 0x04,
+  0x0D, 0x21, 0x10, 0x3F, 0x21, 0x07, 0x21, 0x10, 0x17, 0x21, 0x10, 0x27, 0x21, 0x10, 0x17, 0x21,
+  0x04, 0x0E, 0x21, 0x10, 0x3D, 0x21, 0x09, 0x21, 0x10, 0x17, 0x21, 0x10, 0x25, 0x21, 0x10, 0x17,
+  0x21, 0x05, 0x0F, 0x22, 0x10, 0x39, 0x22, 0x0B, 0x22, 0x10, 0x15, 0x21, 0x10, 0x23, 0x22, 0x10,
+  0x18, 0x21, 0x05, 0x00, 0x11, 0x21, 0x10, 0x37, 0x21, 0x0F, 0x21, 0x10, 0x15, 0x21, 0x10, 0x21,
+  0x21, 0x10, 0x19, 0x21, 0x06, 0x00, 0x12, 0x21, 0x10, 0x35, 0x21, 0x00, 0x11, 0x21, 0x10, 0x15,
+  0x21, 0x10, 0x1F, 0x21, 0x10, 0x19, 0x21, 0x07, 0x00, 0x13, 0x22, 0x10, 0x31, 0x22, 0x00, 0x13,
+  0x22, 0x10, 0x14, 0x21, 0x10, 0x1C, 0x22, 0x10, 0x19, 0x21, 0x08, 0x00, 0x15, 0x21, 0x10, 0x2F,
+  0x21, 0x00, 0x17, 0x21, 0x10, 0x13, 0x21, 0x10, 0x1B, 0x21, 0x10, 0x1B, 0x21, 0x08, 0x00, 0x16,
+  0x22, 0x10, 0x2B, 0x22, 0x00, 0x19, 0x22, 0x10, 0x12, 0x21, 0x10, 0x18, 0x22, 0x10, 0x1B, 0x21,
+  0x09, 0x00, 0x18, 0x22, 0x10, 0x27, 0x22, 0x00, 0x1D, 0x22, 0x10, 0x11, 0x21, 0x10, 0x15, 0x22,
+  0x10, 0x1C, 0x21, 0x0A, 0x00, 0x1A, 0x22, 0x10, 0x23, 0x22, 0x00, 0x21, 0x22, 0x10, 0x10, 0x21,
+  0x10, 0x12, 0x22, 0x10, 0x1D, 0x21, 0x0B, 0x00, 0x1C, 0x23, 0x10, 0x1D, 0x23, 0x00, 0x25, 0x23,
+  0x1E, 0x21, 0x1E, 0x23, 0x10, 0x1E, 0x21, 0x0C, 0x00, 0x1F, 0x23, 0x10, 0x17, 0x23, 0x00, 0x2B,
+  0x23, 0x1C, 0x22, 0x19, 0x23, 0x10, 0x1F, 0x22, 0x0D, 0x00, 0x22, 0x25, 0x1D, 0x25, 0x00, 0x31,
+  0x25, 0x19, 0x21, 0x13, 0x25, 0x10, 0x21, 0x21, 0x0F, 0x00, 0x27, 0x2D, 0x00, 0x3B, 0x2D, 0x10,
+  0x25, 0x21, 0x00, 0x10, 0x00, 0x7A, 0x22, 0x10, 0x23, 0x22, 0x00, 0x11, 0x00, 0x7C, 0x22, 0x10,
+  0x1F, 0x22, 0x00, 0x13, 0x00, 0x7E, 0x22, 0x10, 0x1B, 0x22, 0x00, 0x15, 0x00, 0x80, 0x23, 0x10,
+  0x15, 0x23, 0x00, 0x17, 0x00, 0x83, 0x25, 0x1B, 0x25, 0x00, 0x1A, 0x00, 0x88, 0x2B, 0x00, 0x1F,
+};
+
+const IconBitmap IconCloud = { IconCloudPalette, IconCloudRuns, 2, sizeof(IconCloudRuns), 178, 130, -81, -78 };
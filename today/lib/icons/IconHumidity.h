@@ -0,0 +1,38 @@
+// IconHumidity.h - Generated by scripts/icon-compiler.py from assets/icons/humidity.png, do not edit
+#pragma once
+#include "../IconBitmap.h"
+
+// 73x82, 2 colors, 393 bytes of runs
+const uint16_t IconHumidityPalette[] PROGMEM = {
+  0x001F, 0x841F
+};
+
+const uint8_t IconHumidityRuns[] PROGMEM = {
+  0x00, 0x24, 0x11, 0x00, 0x24, 0x00, 0x24, 0x11, 0x00, 0x24, 0x00, 0x23, 0x13, 0x00, 0x23, 0x00,
+  0x23, 0x13, 0x00, 0x23, 0x00, 0x22, 0x15, 0x00, 0x22, 0x00, 0x22, 0x15, 0x00, 0x22, 0x00, 0x21,
+  0x17, 0x00, 0x21, 0x00, 0x21, 0x17, 0x00, 0x21, 0x00, 0x20, 0x19, 0x00, 0x20, 0x00, 0x1F, 0x1B,
+  0x00, 0x1F, 0x00, 0x1A, 0x10, 0x15, 0x00, 0x1A, 0x00, 0x17, 0x10, 0x1B, 0x00, 0x17, 0x00, 0x15,
+  0x10, 0x1F, 0x00, 0x15, 0x00, 0x13, 0x10, 0x23, 0x00, 0x13, 0x00, 0x11, 0x10, 0x27, 0x00, 0x11,
+  0x00, 0x10, 0x10, 0x29, 0x00, 0x10, 0x0F, 0x10, 0x2B, 0x0F, 0x0D, 0x10, 0x2F, 0x0D, 0x0C, 0x10,
+  0x31, 0x0C, 0x0B, 0x10, 0x33, 0x0B, 0x0A, 0x10, 0x35, 0x0A, 0x09, 0x1D, 0x25, 0x10, 0x25, 0x09,
+  0x08, 0x1C, 0x29, 0x10, 0x24, 0x08, 0x08, 0x1A, 0x2D, 0x10, 0x22, 0x08, 0x07, 0x1A, 0x2F, 0x10,
+  0x22, 0x07, 0x06, 0x1B, 0x2F, 0x10, 0x23, 0x06, 0x05, 0x1B, 0x20, 0x11, 0x10, 0x23, 0x05, 0x05,
+  0x1B, 0x20, 0x11, 0x10, 0x23, 0x05, 0x04, 0x1B, 0x20, 0x13, 0x10, 0x23, 0x04, 0x04, 0x1B, 0x20,
+  0x13, 0x10, 0x23, 0x04, 0x03, 0x1C, 0x20, 0x13, 0x10, 0x24, 0x03, 0x03, 0x1C, 0x20, 0x13, 0x10,
+  0x24, 0x03, 0x02, 0x1D, 0x20, 0x13, 0x10, 0x25, 0x02, 0x02, 0x1E, 0x20, 0x11, 0x10, 0x26, 0x02,
+  0x02, 0x1E, 0x20, 0x11, 0x10, 0x26, 0x02, 0x01, 0x10, 0x10, 0x2F, 0x10, 0x28, 0x01, 0x01, 0x10,
+  0x10, 0x2F, 0x10, 0x28, 0x01, 0x01, 0x10, 0x11, 0x2D, 0x10, 0x29, 0x01, 0x01, 0x10, 0x13, 0x29,
+  0x10, 0x2B, 0x01, 0x01, 0x10, 0x15, 0x25, 0x10, 0x2D, 0x01, 0x10, 0x49, 0x10, 0x49, 0x10, 0x49,
+  0x10, 0x49, 0x10, 0x49, 0x10, 0x49, 0x10, 0x49, 0x10, 0x49, 0x10, 0x49, 0x10, 0x49, 0x10, 0x49,
+  0x01, 0x10, 0x47, 0x01, 0x01, 0x10, 0x47, 0x01, 0x01, 0x10, 0x47, 0x01, 0x01, 0x10, 0x47, 0x01,
+  0x01, 0x10, 0x47, 0x01, 0x02, 0x10, 0x45, 0x02, 0x02, 0x10, 0x45, 0x02, 0x02, 0x10, 0x45, 0x02,
+  0x03, 0x10, 0x43, 0x03, 0x03, 0x10, 0x43, 0x03, 0x04, 0x10, 0x41, 0x04, 0x04, 0x10, 0x41, 0x04,
+  0x05, 0x10, 0x3F, 0x05, 0x05, 0x10, 0x3F, 0x05, 0x06, 0x10, 0x3D, 0x06, 0x07, 0x10, 0x3B, 0x07,
+  0x08, 0x10, 0x39, 0x08, 0x08, 0x10, 0x39, 0x08, 0x09, 0x10, 0x37, 0x09, 0x0A, 0x10, 0x35, 0x0A,
+  0x0B, 0x10, 0x33, 0x0B, 0x0C, 0x10, 0x31, 0x0C, 0x0D, 0x10, 0x2F, 0x0D, 0x0F, 0x10, 0x2B, 0x0F,
+  0x00, 0x10, 0x10, 0x29, 0x00, 0x10, 0x00, 0x11, 0x10, 0x27, 0x00, 0x11, 0x00, 0x13, 0x10, 0x23,
+  0x00, 0x13, 0x00, 0x15, 0x10, 0x1F, 0x00, 0x15, 0x00, 0x17, 0x10, 0x1B, 0x00, 0x17, 0x00, 0x1A,
+  0x10, 0x15, 0x00, 0x1A, 0x00, 0x1F, 0x1B, 0x00, 0x1F,
+};
+
+const IconBitmap IconHumidity = { IconHumidityPalette, IconHumidityRuns, 2, sizeof(IconHumidityRuns), 73, 82, -36, -30 };
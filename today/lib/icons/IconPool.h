@@ -0,0 +1,96 @@
+// IconPool.h - Generated by scripts/icon-compiler.py from assets/icons/pool.png, do not edit
+#pragma once
+#include "../IconBitmap.h"
+
+// 196x119, 3 colors, 1324 bytes of runs
+const uint16_t IconPoolPalette[] PROGMEM = {
+  0xFFFF, 0x07FF, 0x4208
+};
+
+const uint8_t IconPoolRuns[] PROGMEM = {
+  0x00, 0x74, 0x39, 0x00, 0x47, 0x00, 0x71, 0x33, 0x19, 0x33, 0x00, 0x44, 0x00, 0x6F, 0x32, 0x1F,
+  0x32, 0x00, 0x42, 0x00, 0x6E, 0x31, 0x10, 0x13, 0x31, 0x00, 0x41, 0x00, 0x6D, 0x31, 0x10, 0x15,
+  0x31, 0x00, 0x40, 0x00, 0x6C, 0x31, 0x10, 0x17, 0x31, 0x00, 0x3F, 0x00, 0x6B, 0x31, 0x10, 0x19,
+  0x31, 0x00, 0x3E, 0x00, 0x6A, 0x31, 0x10, 0x1B, 0x31, 0x00, 0x3D, 0x00, 0x69, 0x31, 0x10, 0x1D,
+  0x31, 0x00, 0x3C, 0x00, 0x68, 0x31, 0x10, 0x1F, 0x31, 0x00, 0x3B, 0x00, 0x68, 0x31, 0x10, 0x1F,
+  0x31, 0x00, 0x3B, 0x00, 0x67, 0x31, 0x10, 0x21, 0x31, 0x00, 0x3A, 0x00, 0x67, 0x31, 0x10, 0x21,
+  0x31, 0x00, 0x3A, 0x00, 0x67, 0x31, 0x10, 0x21, 0x31, 0x00, 0x3A, 0x00, 0x66, 0x31, 0x10, 0x23,
+  0x31, 0x00, 0x39, 0x00, 0x66, 0x31, 0x10, 0x23, 0x31, 0x00, 0x39, 0x00, 0x66, 0x31, 0x10, 0x23,
+  0x31, 0x00, 0x39, 0x00, 0x66, 0x31, 0x10, 0x23, 0x31, 0x00, 0x39, 0x00, 0x66, 0x31, 0x10, 0x23,
+  0x31, 0x00, 0x39, 0x00, 0x66, 0x31, 0x10, 0x23, 0x31, 0x00, 0x39, 0x00, 0x66, 0x31, 0x10, 0x23,
+  0x31, 0x00, 0x39, 0x00, 0x1C, 0x15, 0x00, 0x45, 0x31, 0x10, 0x23, 0x31, 0x00, 0x39, 0x00, 0x1B,
+  0x17, 0x00, 0x44, 0x31, 0x10, 0x23, 0x31, 0x00, 0x39, 0x00, 0x1A, 0x19, 0x00, 0x44, 0x31, 0x10,
+  0x21, 0x31, 0x00, 0x3A, 0x00, 0x19, 0x1B, 0x00, 0x43, 0x31, 0x10, 0x21, 0x31, 0x00, 0x3A, 0x00,
+  0x18, 0x1D, 0x00, 0x42, 0x31, 0x10, 0x21, 0x31, 0x00, 0x3A, 0x00, 0x18, 0x1D, 0x00, 0x43, 0x31,
+  0x10, 0x1F, 0x31, 0x00, 0x3B, 0x00, 0x18, 0x1F, 0x00, 0x41, 0x31, 0x10, 0x1F, 0x31, 0x00, 0x3B,
+  0x00, 0x18, 0x1D, 0x02, 0x13, 0x00, 0x3F, 0x31, 0x10, 0x1D, 0x31, 0x00, 0x3C, 0x00, 0x18, 0x1E,
+  0x04, 0x12, 0x00, 0x3E, 0x31, 0x10, 0x1B, 0x31, 0x00, 0x3D, 0x00, 0x19, 0x1B, 0x02, 0x13, 0x03,
+  0x13, 0x00, 0x3C, 0x31, 0x10, 0x19, 0x31, 0x00, 0x3E, 0x00, 0x1A, 0x1A, 0x05, 0x13, 0x03, 0x12,
+  0x00, 0x3B, 0x31, 0x10, 0x17, 0x31, 0x00, 0x3F, 0x00, 0x1B, 0x17, 0x02, 0x14, 0x04, 0x13, 0x02,
+  0x13, 0x00, 0x39, 0x31, 0x10, 0x15, 0x31, 0x00, 0x40, 0x00, 0x1C, 0x15, 0x07, 0x14, 0x03, 0x13,
+  0x02, 0x12, 0x00, 0x38, 0x31, 0x10, 0x13, 0x31, 0x00, 0x41, 0x00, 0x2C, 0x13, 0x03, 0x13, 0x01,
+  0x13, 0x00, 0x36, 0x32, 0x1F, 0x32, 0x00, 0x42, 0x00, 0x2F, 0x14, 0x02, 0x13, 0x01, 0x12, 0x00,
+  0x36, 0x33, 0x19, 0x33, 0x00, 0x44, 0x00, 0x33, 0x14, 0x01, 0x16, 0x0D, 0x30, 0x32, 0x00, 0x47,
+  0x00, 0x37, 0x19, 0x0B, 0x31, 0x10, 0x2B, 0x31, 0x00, 0x4C, 0x00, 0x3B, 0x18, 0x08, 0x31, 0x10,
+  0x2B, 0x31, 0x00, 0x4C, 0x00, 0x3E, 0x17, 0x06, 0x31, 0x10, 0x2B, 0x31, 0x00, 0x4C, 0x00, 0x42,
+  0x16, 0x03, 0x31, 0x10, 0x2B, 0x31, 0x00, 0x4C, 0x00, 0x46, 0x14, 0x01, 0x31, 0x10, 0x2B, 0x31,
+  0x00, 0x4C, 0x00, 0x4A, 0x10, 0x2D, 0x31, 0x00, 0x1E, 0x11, 0x00, 0x2D, 0x00, 0x4B, 0x31, 0x10,
+  0x2B, 0x31, 0x00, 0x1C, 0x12, 0x00, 0x2E, 0x00, 0x4B, 0x31, 0x10, 0x2B, 0x31, 0x00, 0x1A, 0x12,
+  0x00, 0x30, 0x00, 0x4B, 0x31, 0x10, 0x2B, 0x31, 0x00, 0x19, 0x11, 0x04, 0x11, 0x00, 0x2D, 0x00,
+  0x4B, 0x31, 0x10, 0x2B, 0x31, 0x00, 0x17, 0x12, 0x03, 0x12, 0x00, 0x2E, 0x00, 0x4B, 0x31, 0x10,
+  0x2B, 0x31, 0x00, 0x15, 0x12, 0x03, 0x12, 0x00, 0x30, 0x00, 0x4B, 0x31, 0x10, 0x2B, 0x31, 0x00,
+  0x14, 0x11, 0x03, 0x12, 0x03, 0x12, 0x00, 0x2D, 0x00, 0x4B, 0x31, 0x10, 0x2B, 0x31, 0x00, 0x12,
+  0x12, 0x02, 0x12, 0x03, 0x12, 0x00, 0x2F, 0x00, 0x4B, 0x31, 0x10, 0x2B, 0x31, 0x00, 0x10, 0x12,
+  0x02, 0x12, 0x02, 0x13, 0x00, 0x31, 0x00, 0x4B, 0x31, 0x10, 0x2B, 0x31, 0x0F, 0x11, 0x02, 0x12,
+  0x02, 0x12, 0x00, 0x34, 0x00, 0x4B, 0x31, 0x10, 0x2B, 0x31, 0x0D, 0x12, 0x01, 0x12, 0x01, 0x13,
+  0x00, 0x36, 0x00, 0x4B, 0x31, 0x10, 0x2B, 0x31, 0x0B, 0x12, 0x01, 0x12, 0x01, 0x12, 0x00, 0x39,
+  0x00, 0x4B, 0x31, 0x10, 0x2B, 0x31, 0x0A, 0x11, 0x01, 0x15, 0x00, 0x3B, 0x00, 0x4B, 0x31, 0x10,
+  0x2B, 0x31, 0x08, 0x16, 0x00, 0x3E, 0x00, 0x4B, 0x31, 0x10, 0x2B, 0x31, 0x06, 0x16, 0x00, 0x40,
+  0x00, 0x4B, 0x31, 0x10, 0x2B, 0x31, 0x05, 0x14, 0x00, 0x43, 0x00, 0x4B, 0x31, 0x10, 0x2B, 0x31,
+  0x03, 0x14, 0x00, 0x45, 0x00, 0x4B, 0x30, 0x2D, 0x01, 0x13, 0x00, 0x48, 0x00, 0x78, 0x12, 0x00,
+  0x4A, 0x00, 0x79, 0x12, 0x00, 0x49, 0x00, 0x7B, 0x12, 0x00, 0x47, 0x00, 0x7C, 0x12, 0x00, 0x46,
+  0x00, 0x7D, 0x13, 0x00, 0x44, 0x00, 0x7F, 0x13, 0x00, 0x42, 0x00, 0x80, 0x13, 0x00, 0x41, 0x00,
+  0x81, 0x14, 0x00, 0x3F, 0x00, 0x83, 0x14, 0x00, 0x3D, 0x00, 0x84, 0x14, 0x00, 0x3C, 0x00, 0x85,
+  0x15, 0x00, 0x3A, 0x00, 0x87, 0x15, 0x00, 0x38, 0x00, 0x88, 0x11, 0x01, 0x11, 0x01, 0x11, 0x00,
+  0x37, 0x00, 0x89, 0x16, 0x00, 0x35, 0x00, 0x8B, 0x11, 0x01, 0x11, 0x01, 0x12, 0x00, 0x33, 0x00,
+  0x8C, 0x11, 0x01, 0x12, 0x01, 0x11, 0x00, 0x32, 0x00, 0x8D, 0x12, 0x01, 0x11, 0x01, 0x12, 0x00,
+  0x30, 0x00, 0x8F, 0x11, 0x01, 0x12, 0x01, 0x12, 0x00, 0x2E, 0x00, 0x90, 0x11, 0x02, 0x11, 0x02,
+  0x11, 0x00, 0x2D, 0x00, 0xC4, 0x00, 0xC4, 0x00, 0xC4, 0x00, 0xC4, 0x0D, 0x24, 0x00, 0x39, 0x23,
+  0x00, 0x39, 0x23, 0x00, 0x39, 0x22, 0x08, 0x2B, 0x00, 0x34, 0x29, 0x00, 0x33, 0x2A, 0x00, 0x33,
+  0x24, 0x03, 0x2A, 0x04, 0x25, 0x00, 0x2E, 0x26, 0x03, 0x26, 0x00, 0x2D, 0x26, 0x03, 0x28, 0x00,
+  0x2D, 0x24, 0x02, 0x28, 0x0B, 0x25, 0x00, 0x29, 0x26, 0x09, 0x26, 0x00, 0x27, 0x26, 0x0A, 0x28,
+  0x00, 0x27, 0x24, 0x04, 0x23, 0x00, 0x13, 0x25, 0x00, 0x23, 0x26, 0x0F, 0x26, 0x00, 0x21, 0x26,
+  0x00, 0x11, 0x27, 0x00, 0x22, 0x24, 0x06, 0x00, 0x18, 0x25, 0x00, 0x1E, 0x26, 0x00, 0x15, 0x26,
+  0x00, 0x1B, 0x26, 0x00, 0x18, 0x25, 0x00, 0x1E, 0x24, 0x08, 0x00, 0x1B, 0x25, 0x00, 0x18, 0x26,
+  0x00, 0x1B, 0x26, 0x00, 0x15, 0x26, 0x00, 0x1E, 0x25, 0x00, 0x19, 0x24, 0x0A, 0x00, 0x1D, 0x27,
+  0x00, 0x11, 0x26, 0x00, 0x21, 0x26, 0x0F, 0x26, 0x00, 0x23, 0x25, 0x00, 0x13, 0x26, 0x0C, 0x00,
+  0x20, 0x28, 0x0A, 0x26, 0x00, 0x27, 0x26, 0x09, 0x26, 0x00, 0x29, 0x25, 0x0B, 0x29, 0x0E, 0x00,
+  0x24, 0x28, 0x03, 0x26, 0x00, 0x2D, 0x26, 0x03, 0x26, 0x00, 0x2E, 0x25, 0x04, 0x2A, 0x00, 0x12,
+  0x00, 0x28, 0x2A, 0x00, 0x33, 0x29, 0x00, 0x34, 0x2B, 0x00, 0x17, 0x00, 0x2C, 0x23, 0x00, 0x39,
+  0x23, 0x00, 0x39, 0x24, 0x00, 0x1C, 0x0D, 0x24, 0x00, 0x39, 0x23, 0x00, 0x39, 0x23, 0x00, 0x39,
+  0x22, 0x08, 0x2B, 0x00, 0x34, 0x29, 0x00, 0x33, 0x2A, 0x00, 0x33, 0x24, 0x03, 0x2A, 0x04, 0x25,
+  0x00, 0x2E, 0x26, 0x03, 0x26, 0x00, 0x2D, 0x26, 0x03, 0x28, 0x00, 0x2D, 0x24, 0x02, 0x28, 0x0B,
+  0x25, 0x00, 0x29, 0x26, 0x09, 0x26, 0x00, 0x27, 0x26, 0x0A, 0x28, 0x00, 0x27, 0x24, 0x04, 0x23,
+  0x00, 0x13, 0x25, 0x00, 0x23, 0x26, 0x0F, 0x26, 0x00, 0x21, 0x26, 0x00, 0x11, 0x27, 0x00, 0x22,
+  0x24, 0x06, 0x00, 0x18, 0x25, 0x00, 0x1E, 0x26, 0x00, 0x15, 0x26, 0x00, 0x1B, 0x26, 0x00, 0x18,
+  0x25, 0x00, 0x1E, 0x24, 0x08, 0x00, 0x1B, 0x25, 0x00, 0x18, 0x26, 0x00, 0x1B, 0x26, 0x00, 0x15,
+  0x26, 0x00, 0x1E, 0x25, 0x00, 0x19, 0x24, 0x0A, 0x00, 0x1D, 0x27, 0x00, 0x11, 0x26, 0x00, 0x21,
+  0x26, 0x0F, 0x26, 0x00, 0x23, 0x25, 0x00, 0x13, 0x26, 0x0C, 0x00, 0x20, 0x28, 0x0A, 0x26, 0x00,
+  0x27, 0x26, 0x09, 0x26, 0x00, 0x29, 0x25, 0x0B, 0x29, 0x0E, 0x00, 0x24, 0x28, 0x03, 0x26, 0x00,
+  0x2D, 0x26, 0x03, 0x26, 0x00, 0x2E, 0x25, 0x04, 0x2A, 0x00, 0x12, 0x00, 0x28, 0x2A, 0x00, 0x33,
+  0x29, 0x00, 0x34, 0x2B, 0x00, 0x17, 0x00, 0x2C, 0x23, 0x00, 0x39, 0x23, 0x00, 0x39, 0x24, 0x00,
+  0x1C, 0x0D, 0x24, 0x00, 0x39, 0x23, 0x00, 0x39, 0x23, 0x00, 0x39, 0x22, 0x08, 0x2B, 0x00, 0x34,
+  0x29, 0x00, 0x33, 0x2A, 0x00, 0x33, 0x24, 0x03, 0x2A, 0x04, 0x25, 0x00, 0x2E, 0x26, 0x03, 0x26,
+  0x00, 0x2D, 0x26, 0x03, 0x28, 0x00, 0x2D, 0x24, 0x02, 0x28, 0x0B, 0x25, 0x00, 0x29, 0x26, 0x09,
+  0x26, 0x00, 0x27, 0x26, 0x0A, 0x28, 0x00, 0x27, 0x24, 0x04, 0x23, 0x00, 0x13, 0x25, 0x00, 0x23,
+  0x26, 0x0F, 0x26, 0x00, 0x21, 0x26, 0x00, 0x11, 0x27, 0x00, 0x22, 0x24, 0x06, 0x00, 0x18, 0x25,
+  0x00, 0x1E, 0x26, 0x00, 0x15, 0x26, 0x00, 0x1B, 0x26, 0x00, 0x18, 0x25, 0x00, 0x1E, 0x24, 0x08,
+  0x00, 0x1B, 0x25, 0x00, 0x18, 0x26, 0x00, 0x1B, 0x26, 0x00, 0x15, 0x26, 0x00, 0x1E, 0x25, 0x00,
+  0x19, 0x24, 0x0A, 0x00, 0x1D, 0x27, 0x00, 0x11, 0x26, 0x00, 0x21, 0x26, 0x0F, 0x26, 0x00, 0x23,
+  0x25, 0x00, 0x13, 0x26, 0x0C, 0x00, 0x20, 0x28, 0x0A, 0x26, 0x00, 0x27, 0x26, 0x09, 0x26, 0x00,
+  0x29, 0x25, 0x0B, 0x29, 0x0E, 0x00, 0x24, 0x28, 0x03, 0x26, 0x00, 0x2D, 0x26, 0x03, 0x26, 0x00,
+  0x2E, 0x25, 0x04, 0x2A, 0x00, 0x12, 0x00, 0x28, 0x2A, 0x00, 0x33, 0x29, 0x00, 0x34, 0x2B, 0x00,
+  0x17, 0x00, 0x2C, 0x23, 0x00, 0x39, 0x23, 0x00, 0x39, 0x24, 0x00, 0x1C,
+};
+
+const IconBitmap IconPool = { IconPoolPalette, IconPoolRuns, 3, sizeof(IconPoolRuns), 196, 119, -90, -48 };
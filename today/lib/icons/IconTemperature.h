@@ -0,0 +1,72 @@
+// IconTemperature.h - Generated by scripts/icon-compiler.py from assets/icons/temperature.png, do not edit
+#pragma once
+#include "../IconBitmap.h"
+
+// 49x145, 3 colors, 943 bytes of runs
+const uint16_t IconTemperaturePalette[] PROGMEM = {
+  0xFFFF, 0xF800, 0x4208
+};
+
+const uint8_t IconTemperatureRuns[] PROGMEM = {
+  0x0F, 0x30, 0x12, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10,
+  0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00,
+  0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F,
+  0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10,
+  0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31,
+  0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10,
+  0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x30, 0x11, 0x0F, 0x31, 0x10,
+  0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31,
+  0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10,
+  0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31,
+  0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10,
+  0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00,
+  0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F,
+  0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10,
+  0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31,
+  0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10,
+  0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31,
+  0x10, 0x10, 0x30, 0x11, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31,
+  0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10,
+  0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31,
+  0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10,
+  0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00,
+  0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F,
+  0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10,
+  0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31,
+  0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10,
+  0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31,
+  0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x30, 0x11, 0x0F, 0x31, 0x10, 0x10, 0x31,
+  0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10,
+  0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31,
+  0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10,
+  0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00,
+  0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F,
+  0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10,
+  0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31,
+  0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10,
+  0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31,
+  0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10,
+  0x30, 0x11, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10,
+  0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31,
+  0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10,
+  0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00,
+  0x10, 0x0F, 0x31, 0x10, 0x10, 0x31, 0x00, 0x10, 0x0E, 0x21, 0x31, 0x10, 0x10, 0x31, 0x22, 0x0E,
+  0x0C, 0x23, 0x31, 0x10, 0x10, 0x31, 0x24, 0x0C, 0x0B, 0x24, 0x31, 0x10, 0x10, 0x31, 0x25, 0x0B,
+  0x09, 0x26, 0x31, 0x10, 0x10, 0x31, 0x27, 0x09, 0x08, 0x27, 0x31, 0x10, 0x10, 0x31, 0x28, 0x08,
+  0x07, 0x28, 0x31, 0x10, 0x10, 0x31, 0x29, 0x07, 0x06, 0x29, 0x31, 0x10, 0x10, 0x31, 0x2A, 0x06,
+  0x05, 0x2A, 0x31, 0x10, 0x10, 0x31, 0x2B, 0x05, 0x05, 0x2A, 0x31, 0x10, 0x10, 0x31, 0x2B, 0x05,
+  0x04, 0x2B, 0x31, 0x10, 0x10, 0x31, 0x2C, 0x04, 0x03, 0x2C, 0x31, 0x10, 0x10, 0x31, 0x2D, 0x03,
+  0x03, 0x2C, 0x31, 0x10, 0x10, 0x31, 0x2D, 0x03, 0x02, 0x2D, 0x31, 0x10, 0x10, 0x31, 0x2E, 0x02,
+  0x02, 0x2D, 0x31, 0x10, 0x10, 0x31, 0x2E, 0x02, 0x01, 0x2E, 0x31, 0x10, 0x10, 0x31, 0x2F, 0x01,
+  0x01, 0x2E, 0x31, 0x10, 0x10, 0x31, 0x2F, 0x01, 0x01, 0x2E, 0x31, 0x10, 0x10, 0x31, 0x2F, 0x01,
+  0x01, 0x2E, 0x31, 0x10, 0x10, 0x31, 0x2F, 0x01, 0x2F, 0x31, 0x10, 0x10, 0x31, 0x20, 0x10, 0x2F,
+  0x31, 0x10, 0x10, 0x31, 0x20, 0x10, 0x2F, 0x31, 0x10, 0x10, 0x31, 0x20, 0x10, 0x2F, 0x30, 0x12,
+  0x20, 0x10, 0x20, 0x31, 0x20, 0x31, 0x20, 0x31, 0x20, 0x31, 0x20, 0x31, 0x01, 0x20, 0x2F, 0x01,
+  0x01, 0x20, 0x2F, 0x01, 0x01, 0x20, 0x2F, 0x01, 0x01, 0x20, 0x2F, 0x01, 0x02, 0x20, 0x2D, 0x02,
+  0x02, 0x20, 0x2D, 0x02, 0x03, 0x20, 0x2B, 0x03, 0x03, 0x20, 0x2B, 0x03, 0x04, 0x20, 0x29, 0x04,
+  0x05, 0x20, 0x27, 0x05, 0x05, 0x20, 0x27, 0x05, 0x06, 0x20, 0x25, 0x06, 0x07, 0x20, 0x23, 0x07,
+  0x08, 0x20, 0x21, 0x08, 0x09, 0x20, 0x1F, 0x09, 0x0B, 0x20, 0x1B, 0x0B, 0x0C, 0x20, 0x19, 0x0C,
+  0x0E, 0x20, 0x15, 0x0E, 0x00, 0x10, 0x20, 0x11, 0x00, 0x10, 0x00, 0x14, 0x29, 0x00, 0x14,
+};
+
+const IconBitmap IconTemperature = { IconTemperaturePalette, IconTemperatureRuns, 3, sizeof(IconTemperatureRuns), 49, 145, -24, -60 };
@@ -0,0 +1,121 @@
+// IconUv.h - Generated by scripts/icon-compiler.py from assets/icons/uv.png, do not edit
+#pragma once
+#include "../IconBitmap.h"
+
+// 230x229, 2 colors, 1717 bytes of runs
+const uint16_t IconUvPalette[] PROGMEM = {
+  0xFFE0, 0xFD20
+};
+
+const uint8_t IconUvRuns[] PROGMEM = {
+  0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00,
+  0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72,
+  0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22,
+  0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00,
+  0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72,
+  0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00,
+  0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72,
+  0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22,
+  0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00,
+  0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x72, 0x22, 0x00, 0x72,
+  0x00, 0x72, 0x22, 0x00, 0x72, 0x00, 0x21, 0x22, 0x00, 0x4F, 0x22, 0x00, 0x4E, 0x22, 0x00, 0x22,
+  0x00, 0x21, 0x23, 0x00, 0x4E, 0x22, 0x00, 0x4D, 0x22, 0x00, 0x23, 0x00, 0x22, 0x23, 0x00, 0x4D,
+  0x22, 0x00, 0x4C, 0x22, 0x00, 0x24, 0x00, 0x23, 0x23, 0x00, 0x4C, 0x22, 0x00, 0x4B, 0x22, 0x00,
+  0x25, 0x00, 0x24, 0x23, 0x00, 0x4B, 0x22, 0x00, 0x4A, 0x22, 0x00, 0x26, 0x00, 0x25, 0x23, 0x00,
+  0x4A, 0x22, 0x00, 0x49, 0x22, 0x00, 0x27, 0x00, 0x26, 0x23, 0x00, 0x49, 0x22, 0x00, 0x48, 0x22,
+  0x00, 0x28, 0x00, 0x27, 0x23, 0x00, 0x48, 0x22, 0x00, 0x47, 0x22, 0x00, 0x29, 0x00, 0x28, 0x23,
+  0x00, 0x47, 0x22, 0x00, 0x46, 0x22, 0x00, 0x2A, 0x00, 0x29, 0x23, 0x00, 0x46, 0x22, 0x00, 0x45,
+  0x22, 0x00, 0x2B, 0x00, 0x2A, 0x23, 0x00, 0x45, 0x22, 0x00, 0x44, 0x22, 0x00, 0x2C, 0x00, 0x2B,
+  0x23, 0x00, 0x44, 0x22, 0x00, 0x43, 0x22, 0x00, 0x2D, 0x00, 0x2C, 0x23, 0x00, 0x43, 0x22, 0x00,
+  0x42, 0x22, 0x00, 0x2E, 0x00, 0x2D, 0x23, 0x00, 0x42, 0x22, 0x00, 0x41, 0x22, 0x00, 0x2F, 0x00,
+  0x2E, 0x23, 0x00, 0x41, 0x22, 0x00, 0x40, 0x22, 0x00, 0x30, 0x00, 0x2F, 0x23, 0x00, 0x40, 0x22,
+  0x00, 0x3F, 0x22, 0x00, 0x31, 0x00, 0x30, 0x23, 0x00, 0x3F, 0x22, 0x00, 0x3E, 0x22, 0x00, 0x32,
+  0x00, 0x31, 0x23, 0x00, 0x3E, 0x22, 0x00, 0x3D, 0x22, 0x00, 0x33, 0x00, 0x32, 0x23, 0x00, 0x3D,
+  0x22, 0x00, 0x3C, 0x22, 0x00, 0x34, 0x00, 0x33, 0x23, 0x00, 0x3C, 0x22, 0x00, 0x3B, 0x22, 0x00,
+  0x35, 0x00, 0x34, 0x23, 0x00, 0x3B, 0x22, 0x00, 0x3A, 0x22, 0x00, 0x36, 0x00, 0x35, 0x23, 0x00,
+  0x3A, 0x22, 0x00, 0x39, 0x22, 0x00, 0x37, 0x00, 0x36, 0x23, 0x00, 0x39, 0x22, 0x00, 0x38, 0x22,
+  0x00, 0x38, 0x00, 0x37, 0x23, 0x00, 0x38, 0x22, 0x00, 0x37, 0x22, 0x00, 0x39, 0x00, 0x38, 0x23,
+  0x00, 0x37, 0x22, 0x00, 0x36, 0x22, 0x00, 0x3A, 0x00, 0x39, 0x23, 0x00, 0x36, 0x22, 0x00, 0x35,
+  0x22, 0x00, 0x3B, 0x00, 0x3A, 0x23, 0x00, 0x35, 0x22, 0x00, 0x34, 0x22, 0x00, 0x3C, 0x00, 0x3B,
+  0x23, 0x00, 0x34, 0x22, 0x00, 0x33, 0x22, 0x00, 0x3D, 0x00, 0x3C, 0x23, 0x00, 0x33, 0x21, 0x00,
+  0x33, 0x22, 0x00, 0x3E, 0x00, 0x3D, 0x23, 0x00, 0x65, 0x22, 0x00, 0x3F, 0x00, 0x3E, 0x23, 0x00,
+  0x63, 0x22, 0x00, 0x40, 0x00, 0x3F, 0x23, 0x00, 0x61, 0x22, 0x00, 0x41, 0x00, 0x40, 0x23, 0x00,
+  0x5F, 0x22, 0x00, 0x42, 0x00, 0x41, 0x23, 0x00, 0x5D, 0x22, 0x00, 0x43, 0x00, 0x42, 0x23, 0x00,
+  0x5B, 0x22, 0x00, 0x44, 0x00, 0x43, 0x23, 0x00, 0x59, 0x22, 0x00, 0x45, 0x00, 0x44, 0x23, 0x00,
+  0x25, 0x1D, 0x00, 0x25, 0x22, 0x00, 0x46, 0x00, 0x45, 0x23, 0x00, 0x1F, 0x10, 0x17, 0x00, 0x1F,
+  0x22, 0x00, 0x47, 0x00, 0x46, 0x23, 0x00, 0x1B, 0x10, 0x1D, 0x00, 0x1B, 0x22, 0x00, 0x48, 0x00,
+  0x47, 0x23, 0x00, 0x17, 0x10, 0x23, 0x00, 0x17, 0x22, 0x00, 0x49, 0x00, 0x48, 0x23, 0x00, 0x14,
+  0x10, 0x27, 0x00, 0x14, 0x22, 0x00, 0x4A, 0x00, 0x49, 0x23, 0x00, 0x11, 0x10, 0x2B, 0x00, 0x11,
+  0x22, 0x00, 0x4B, 0x00, 0x4A, 0x23, 0x0E, 0x10, 0x2F, 0x0E, 0x22, 0x00, 0x4C, 0x00, 0x4B, 0x21,
+  0x0E, 0x10, 0x31, 0x0D, 0x21, 0x00, 0x4D, 0x00, 0x58, 0x10, 0x35, 0x00, 0x59, 0x00, 0x57, 0x10,
+  0x37, 0x00, 0x58, 0x00, 0x56, 0x10, 0x39, 0x00, 0x57, 0x00, 0x54, 0x10, 0x3D, 0x00, 0x55, 0x00,
+  0x53, 0x10, 0x3F, 0x00, 0x54, 0x00, 0x52, 0x10, 0x41, 0x00, 0x53, 0x00, 0x51, 0x10, 0x43, 0x00,
+  0x52, 0x00, 0x50, 0x10, 0x45, 0x00, 0x51, 0x00, 0x50, 0x10, 0x45, 0x00, 0x51, 0x00, 0x4F, 0x10,
+  0x47, 0x00, 0x50, 0x00, 0x4E, 0x10, 0x49, 0x00, 0x4F, 0x00, 0x4D, 0x10, 0x4B, 0x00, 0x4E, 0x00,
+  0x4D, 0x10, 0x4B, 0x00, 0x4E, 0x00, 0x4C, 0x10, 0x4D, 0x00, 0x4D, 0x00, 0x4B, 0x10, 0x4F, 0x00,
+  0x4C, 0x00, 0x4B, 0x10, 0x4F, 0x00, 0x4C, 0x00, 0x4A, 0x10, 0x51, 0x00, 0x4B, 0x00, 0x4A, 0x10,
+  0x51, 0x00, 0x4B, 0x00, 0x49, 0x10, 0x53, 0x00, 0x4A, 0x00, 0x49, 0x10, 0x53, 0x00, 0x4A, 0x00,
+  0x48, 0x10, 0x55, 0x00, 0x49, 0x00, 0x48, 0x10, 0x55, 0x00, 0x49, 0x00, 0x48, 0x10, 0x55, 0x00,
+  0x49, 0x00, 0x47, 0x10, 0x57, 0x00, 0x48, 0x00, 0x47, 0x10, 0x57, 0x00, 0x48, 0x00, 0x47, 0x10,
+  0x57, 0x00, 0x48, 0x00, 0x46, 0x10, 0x59, 0x00, 0x47, 0x00, 0x46, 0x10, 0x59, 0x00, 0x47, 0x00,
+  0x46, 0x10, 0x59, 0x00, 0x47, 0x00, 0x46, 0x10, 0x59, 0x00, 0x47, 0x00, 0x46, 0x10, 0x59, 0x00,
+  0x47, 0x00, 0x45, 0x10, 0x5B, 0x00, 0x46, 0x00, 0x45, 0x10, 0x5B, 0x00, 0x46, 0x00, 0x45, 0x10,
+  0x5B, 0x00, 0x46, 0x00, 0x45, 0x10, 0x5B, 0x00, 0x46, 0x00, 0x45, 0x10, 0x5B, 0x00, 0x46, 0x20,
+  0x3E, 0x07, 0x10, 0x5B, 0x00, 0x46, 0x20, 0x3D, 0x08, 0x10, 0x5B, 0x08, 0x20, 0x3E, 0x00, 0x45,
+  0x10, 0x5B, 0x08, 0x20, 0x3D, 0x01, 0x00, 0x45, 0x10, 0x5B, 0x00, 0x46, 0x00, 0x45, 0x10, 0x5B,
+  0x00, 0x46, 0x00, 0x45, 0x10, 0x5B, 0x00, 0x46, 0x00, 0x45, 0x10, 0x5B, 0x00, 0x46, 0x00, 0x45,
+  0x10, 0x5B, 0x00, 0x46, 0x00, 0x46, 0x10, 0x59, 0x00, 0x47, 0x00, 0x46, 0x10, 0x59, 0x00, 0x47,
+  0x00, 0x46, 0x10, 0x59, 0x00, 0x47, 0x00, 0x46, 0x10, 0x59, 0x00, 0x47, 0x00, 0x46, 0x10, 0x59,
+  0x00, 0x47, 0x00, 0x47, 0x10, 0x57, 0x00, 0x48, 0x00, 0x47, 0x10, 0x57, 0x00, 0x48, 0x00, 0x47,
+  0x10, 0x57, 0x00, 0x48, 0x00, 0x48, 0x10, 0x55, 0x00, 0x49, 0x00, 0x48, 0x10, 0x55, 0x00, 0x49,
+  0x00, 0x48, 0x10, 0x55, 0x00, 0x49, 0x00, 0x49, 0x10, 0x53, 0x00, 0x4A, 0x00, 0x49, 0x10, 0x53,
+  0x00, 0x4A, 0x00, 0x4A, 0x10, 0x51, 0x00, 0x4B, 0x00, 0x4A, 0x10, 0x51, 0x00, 0x4B, 0x00, 0x4B,
+  0x10, 0x4F, 0x00, 0x4C, 0x00, 0x4B, 0x10, 0x4F, 0x00, 0x4C, 0x00, 0x4C, 0x10, 0x4D, 0x00, 0x4D,
+  0x00, 0x4D, 0x10, 0x4B, 0x00, 0x4E, 0x00, 0x4D, 0x10, 0x4B, 0x00, 0x4E, 0x00, 0x4E, 0x10, 0x49,
+  0x00, 0x4F, 0x00, 0x4F, 0x10, 0x47, 0x00, 0x50, 0x00, 0x50, 0x10, 0x45, 0x00, 0x51, 0x00, 0x50,
+  0x10, 0x45, 0x00, 0x51, 0x00, 0x51, 0x10, 0x43, 0x00, 0x52, 0x00, 0x52, 0x10, 0x41, 0x00, 0x53,
+  0x00, 0x53, 0x10, 0x3F, 0x00, 0x54, 0x00, 0x54, 0x10, 0x3D, 0x00, 0x55, 0x00, 0x56, 0x10, 0x39,
+  0x00, 0x57, 0x00, 0x57, 0x10, 0x37, 0x00, 0x58, 0x00, 0x58, 0x10, 0x35, 0x00, 0x59, 0x00, 0x4B,
+  0x22, 0x0D, 0x10, 0x31, 0x0D, 0x22, 0x00, 0x4C, 0x00, 0x4A, 0x22, 0x0F, 0x10, 0x2F, 0x0E, 0x23,
+  0x00, 0x4B, 0x00, 0x49, 0x22, 0x00, 0x12, 0x10, 0x2B, 0x00, 0x11, 0x23, 0x00, 0x4A, 0x00, 0x48,
+  0x22, 0x00, 0x15, 0x10, 0x27, 0x00, 0x14, 0x23, 0x00, 0x49, 0x00, 0x47, 0x22, 0x00, 0x18, 0x10,
+  0x23, 0x00, 0x17, 0x23, 0x00, 0x48, 0x00, 0x46, 0x22, 0x00, 0x1C, 0x10, 0x1D, 0x00, 0x1B, 0x23,
+  0x00, 0x47, 0x00, 0x45, 0x22, 0x00, 0x20, 0x10, 0x17, 0x00, 0x1F, 0x23, 0x00, 0x46, 0x00, 0x44,
+  0x22, 0x00, 0x26, 0x1D, 0x00, 0x25, 0x23, 0x00, 0x45, 0x00, 0x43, 0x22, 0x00, 0x5A, 0x23, 0x00,
+  0x44, 0x00, 0x42, 0x22, 0x00, 0x5C, 0x23, 0x00, 0x43, 0x00, 0x41, 0x22, 0x00, 0x5E, 0x23, 0x00,
+  0x42, 0x00, 0x40, 0x22, 0x00, 0x60, 0x23, 0x00, 0x41, 0x00, 0x3F, 0x22, 0x00, 0x62, 0x23, 0x00,
+  0x40, 0x00, 0x3E, 0x22, 0x00, 0x64, 0x23, 0x00, 0x3F, 0x00, 0x3D, 0x22, 0x00, 0x66, 0x23, 0x00,
+  0x3E, 0x00, 0x3C, 0x22, 0x00, 0x33, 0x22, 0x00, 0x33, 0x23, 0x00, 0x3D, 0x00, 0x3B, 0x22, 0x00,
+  0x34, 0x22, 0x00, 0x34, 0x23, 0x00, 0x3C, 0x00, 0x3A, 0x22, 0x00, 0x35, 0x22, 0x00, 0x35, 0x23,
+  0x00, 0x3B, 0x00, 0x39, 0x22, 0x00, 0x36, 0x22, 0x00, 0x36, 0x23, 0x00, 0x3A, 0x00, 0x38, 0x22,
+  0x00, 0x37, 0x22, 0x00, 0x37, 0x23, 0x00, 0x39, 0x00, 0x37, 0x22, 0x00, 0x38, 0x22, 0x00, 0x38,
+  0x23, 0x00, 0x38, 0x00, 0x36, 0x22, 0x00, 0x39, 0x22, 0x00, 0x39, 0x23, 0x00, 0x37, 0x00, 0x35,
+  0x22, 0x00, 0x3A, 0x22, 0x00, 0x3A, 0x23, 0x00, 0x36, 0x00, 0x34, 0x22, 0x00, 0x3B, 0x22, 0x00,
+  0x3B, 0x23, 0x00, 0x35, 0x00, 0x33, 0x22, 0x00, 0x3C, 0x22, 0x00, 0x3C, 0x23, 0x00, 0x34, 0x00,
+  0x32, 0x22, 0x00, 0x3D, 0x22, 0x00, 0x3D, 0x23, 0x00, 0x33, 0x00, 0x31, 0x22, 0x00, 0x3E, 0x22,
+  0x00, 0x3E, 0x23, 0x00, 0x32, 0x00, 0x30, 0x22, 0x00, 0x3F, 0x22, 0x00, 0x3F, 0x23, 0x00, 0x31,
+  0x00, 0x2F, 0x22, 0x00, 0x40, 0x22, 0x00, 0x40, 0x23, 0x00, 0x30, 0x00, 0x2E, 0x22, 0x00, 0x41,
+  0x22, 0x00, 0x41, 0x23, 0x00, 0x2F, 0x00, 0x2D, 0x22, 0x00, 0x42, 0x22, 0x00, 0x42, 0x23, 0x00,
+  0x2E, 0x00, 0x2C, 0x22, 0x00, 0x43, 0x22, 0x00, 0x43, 0x23, 0x00, 0x2D, 0x00, 0x2B, 0x22, 0x00,
+  0x44, 0x22, 0x00, 0x44, 0x23, 0x00, 0x2C, 0x00, 0x2A, 0x22, 0x00, 0x45, 0x22, 0x00, 0x45, 0x23,
+  0x00, 0x2B, 0x00, 0x29, 0x22, 0x00, 0x46, 0x22, 0x00, 0x46, 0x23, 0x00, 0x2A, 0x00, 0x28, 0x22,
+  0x00, 0x47, 0x22, 0x00, 0x47, 0x23, 0x00, 0x29, 0x00, 0x27, 0x22, 0x00, 0x48, 0x22, 0x00, 0x48,
+  0x23, 0x00, 0x28, 0x00, 0x26, 0x22, 0x00, 0x49, 0x22, 0x00, 0x49, 0x23, 0x00, 0x27, 0x00, 0x25,
+  0x22, 0x00, 0x4A, 0x22, 0x00, 0x4A, 0x23, 0x00, 0x26, 0x00, 0x24, 0x22, 0x00, 0x4B, 0x22, 0x00,
+  0x4B, 0x23, 0x00, 0x25, 0x00, 0x23, 0x22, 0x00, 0x4C, 0x22, 0x00, 0x4C, 0x23, 0x00, 0x24, 0x00,
+  0x22, 0x22, 0x00, 0x4D, 0x22, 0x00, 0x4D, 0x23, 0x00, 0x23, 0x00, 0x21, 0x22, 0x00, 0x4E, 0x22,
+  0x00, 0x4E, 0x23, 0x00, 0x22, 0x00, 0x21, 0x21, 0x00, 0x4F, 0x22, 0x00, 0x4F, 0x21, 0x00, 0x23,
+  0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00,
+  0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71,
+  0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22,
+  0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00,
+  0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73,
+  0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00,
+  0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71,
+  0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22,
+  0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00,
+  0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73, 0x00, 0x71, 0x22, 0x00, 0x73,
+  0x00, 0x71, 0x21, 0x00, 0x74,
+};
+
+const IconBitmap IconUv = { IconUvPalette, IconUvRuns, 2, sizeof(IconUvRuns), 230, 229, -114, -114 };
@@ -0,0 +1,27 @@
+// IconWind.h - Generated by scripts/icon-compiler.py from assets/icons/wind.png, do not edit
+#pragma once
+#include "../IconBitmap.h"
+
+// 91x64, 1 colors, 218 bytes of runs
+const uint16_t IconWindPalette[] PROGMEM = {
+  0xFFFF
+};
+
+const uint8_t IconWindRuns[] PROGMEM = {
+  0x00, 0x51, 0x11, 0x09, 0x00, 0x52, 0x11, 0x08, 0x00, 0x53, 0x11, 0x07, 0x00, 0x54, 0x11, 0x06,
+  0x00, 0x55, 0x11, 0x05, 0x00, 0x56, 0x11, 0x04, 0x00, 0x57, 0x11, 0x03, 0x00, 0x58, 0x11, 0x02,
+  0x00, 0x59, 0x11, 0x01, 0x00, 0x59, 0x12, 0x00, 0x57, 0x12, 0x02, 0x00, 0x54, 0x13, 0x04, 0x00,
+  0x52, 0x12, 0x07, 0x00, 0x4F, 0x13, 0x09, 0x00, 0x4D, 0x12, 0x0C, 0x10, 0x4D, 0x0E, 0x00, 0x5B,
+  0x00, 0x5B, 0x00, 0x5B, 0x00, 0x5B, 0x00, 0x5B, 0x00, 0x5B, 0x00, 0x5B, 0x00, 0x5B, 0x00, 0x51,
+  0x11, 0x09, 0x00, 0x52, 0x11, 0x08, 0x00, 0x53, 0x11, 0x07, 0x00, 0x54, 0x11, 0x06, 0x00, 0x55,
+  0x11, 0x05, 0x00, 0x56, 0x11, 0x04, 0x00, 0x57, 0x11, 0x03, 0x00, 0x58, 0x11, 0x02, 0x00, 0x59,
+  0x11, 0x01, 0x00, 0x59, 0x12, 0x00, 0x57, 0x12, 0x02, 0x00, 0x54, 0x13, 0x04, 0x00, 0x52, 0x12,
+  0x07, 0x00, 0x4F, 0x13, 0x09, 0x00, 0x4D, 0x12, 0x0C, 0x10, 0x4D, 0x0E, 0x00, 0x5B, 0x00, 0x5B,
+  0x00, 0x5B, 0x00, 0x5B, 0x00, 0x5B, 0x00, 0x5B, 0x00, 0x5B, 0x00, 0x5B, 0x00, 0x51, 0x11, 0x09,
+  0x00, 0x52, 0x11, 0x08, 0x00, 0x53, 0x11, 0x07, 0x00, 0x54, 0x11, 0x06, 0x00, 0x55, 0x11, 0x05,
+  0x00, 0x56, 0x11, 0x04, 0x00, 0x57, 0x11, 0x03, 0x00, 0x58, 0x11, 0x02, 0x00, 0x59, 0x11, 0x01,
+  0x00, 0x59, 0x12, 0x00, 0x57, 0x12, 0x02, 0x00, 0x54, 0x13, 0x04, 0x00, 0x52, 0x12, 0x07, 0x00,
+  0x4F, 0x13, 0x09, 0x00, 0x4D, 0x12, 0x0C, 0x10, 0x4D, 0x0E,
+};
+
+const IconBitmap IconWind = { IconWindPalette, IconWindRuns, 1, sizeof(IconWindRuns), 91, 64, -45, -45 };
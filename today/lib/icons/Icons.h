@@ -0,0 +1,9 @@
+// Icons.h - Generated by scripts/icon-compiler.py, do not edit
+#pragma once
+#include "ConditionsAtlas.h"
+#include "IconCloud.h"
+#include "IconHumidity.h"
+#include "IconPool.h"
+#include "IconTemperature.h"
+#include "IconUv.h"
+#include "IconWind.h"
@@ -1,33 +1,119 @@
 #include <SPI.h>
 #include <WiFi.h>
 #include "credentials.h"
+
+// Log how long each slide transition, present and icon draw takes, and build the slide
+// capture helpers (captureSlideFrames)
+// #define DISPLAY_DEBUG
+
 #include "lib/Logger.h"
 #include "lib/TimeManager.h"
 #include "lib/WeatherRealtime.h"
 #include "lib/WeatherForecast.h"
 #include "lib/PoolTemperature.h"
 #include "lib/Display.h"
+#include "lib/FetchScheduler.h"
+#include "lib/WarmStartCache.h"
+#include "lib/TaskScheduler.h"
+#include "lib/WeatherChannel.h"
+#include "lib/WiFiManager.h"
+
+#if defined(ARDUINO_GIGA)
+#include <mbed.h>
+#else
+#include <thread> // Host builds run the network side as a std::thread
+#endif
 
 WeatherRealtime* realtimeWeather;
 WeatherForecast* forecastWeather;
 PoolTemperature* poolTemperature;
 TimeManager* timeManager;
 
-unsigned long lastUpdate = 0;
-const unsigned long updateIntervalMs = 8 * 60 * 1000; // 8 minutes between updates (safe for 25 req/hour limit)
 const bool offlineMode = false;
 const int slideshowTimeMs = 4000;
-bool isLoading = true;
+const bool dirtyRectRendering = true;  // Diff slides in SDRAM and push only changed pixels to the panel
+#if defined(DISPLAY_DEBUG)
+const bool captureSlideFrames = false; // Dump every slide over Serial once data arrives, for scripts/frames-to-png.py
+#endif
+
+// Two sides, each running whatever scheduled work is due and sleeping until its next deadline.
+// The display side (touch, slideshow) runs in loop(); the network side (WiFi, fetches, NTP)
+// runs on its own thread, so a stalled request never holds up a frame. Fetched data reaches
+// the display side only as WeatherMessage snapshots through weatherChannel.
+TaskScheduler scheduler("Display tasks");
+TaskScheduler networkScheduler("Network tasks");
+QueueTransport<> weatherQueue;
+WeatherTransport& weatherChannel = weatherQueue;
+WeatherMessage outbox; // Network side only
+int touchTask = TaskScheduler::NO_TASK;
+int slideShowTask = TaskScheduler::NO_TASK;
+int inboxTask = TaskScheduler::NO_TASK;
+int fetchTask = TaskScheduler::NO_TASK;
+int ntpTask = TaskScheduler::NO_TASK;
+int wifiTask = TaskScheduler::NO_TASK;
+const unsigned long touchPollMs = 10;       // Touch is polled, so this bounds input latency
+const unsigned long slideShowPollMs = 500;  // While there is nothing to show; otherwise woken when a slide is due
+const unsigned long inboxPollMs = 20;       // Picking up snapshots from the network side
+const unsigned long fetchPollMs = 10;       // Advancing an in-flight request
+const unsigned long fetchIdleMs = 1000;     // Checking the budgets for the next fetch
+const unsigned long ntpIdleMs = 1000;       // Until WiFi is up; otherwise the NTP client picks its next poll
+const unsigned long wifiPollMs = 1000;      // Until the WiFi manager picks its own next poll
+const unsigned long startupDelayMs = 10000; // Splash and warm-start slides before WiFi starts
+const unsigned long statsIntervalMs = 60000;
+
+#if defined(ARDUINO_GIGA)
+// WiFi is only reachable from the M7, so the network side is a thread here rather than the
+// M4; below loop()'s priority so drawing always preempts it, with stack for TLS handshakes
+rtos::Thread networkThread(osPriorityBelowNormal, 32 * 1024, nullptr, "network");
+#endif
+
+// Joins WiFi and rejoins after drops, on the network side; fetches wait for the link
+WiFiManager wifi(WIFI_SSID, WIFI_PASSWORD);
+bool wifiOutageReported = false;
+
+// Online fetches are chosen by the quota-aware scheduler and run one at a time as
+// non-blocking requests polled from the network side's fetch task
+FetchScheduler fetchScheduler;
+FetchSource activeFetch = FetchSource::None;
+
+// Unified mode makes one forecast call serve both screens: "now" is interpolated from the
+// forecast's minutely timeline between calls, roughly halving tomorrow.io requests
+const bool unifiedFetchMode = true;
+const unsigned long derivedRealtimeIntervalMs = 60000;
+ForecastData latestForecast = {};
+unsigned long latestForecastTime = 0;
+unsigned long lastDerivedRealtimeTime = 0;
 
 // Function declarations
-bool initializeWiFiConnection();
-bool isUpdateRequired();
+void initializeScheduler();
+void startNetworkThread();
+void runNetwork();
+void runTouchTask();
+void runSlideShowTask();
+void runInboxTask();
+void applyWeatherMessage(const WeatherMessage& message);
+void runFetchTask();
+void runNtpTask();
+void runWiFiTask();
+void onWiFiEvent(WiFiEvent event);
+void sendOutbox();
+void logSchedulerStats();
+void logNetworkStats();
 void clearScreen();
-void fetchAndDisplayForecast();
-void fetchAndDisplayRealtime();
-void fetchAndDisplayPoolTemp();
+void displayForecastData(const ForecastData& forecastData);
+void displayRealtimeData(const RealtimeWeatherData& realtimeData);
+void displayPoolData(const PoolTemperatureData& poolData);
+void startFetch(FetchSource source);
+bool pollActiveFetch();
+bool finishActiveFetch();
+void pollWeatherFetch();
+void refreshDerivedRealtime(bool force);
 void initializeOfflineMode();
 void initializeSystem();
+void restoreWarmStartCache();
+#if defined(DISPLAY_DEBUG)
+void captureSlides();
+#endif
 void initializeWeatherClients();
 void updateWeatherData();
 RealtimeWeatherData loadTestRealtimeData();
@@ -35,66 +121,348 @@ ForecastData loadTestForecastData();
 
 void setup() {
   initializeSystem();
-
-  delay(10000);
+  restoreWarmStartCache();
+  initializeScheduler();
 
   if (offlineMode) {
     initializeOfflineMode();
     return;
   }
 
-  if (!initializeWiFiConnection()) {
-    delay(2000);
-    return;
-  }
-
-  initializeWeatherClients();
+  startNetworkThread();
 }
 
 void loop() {
-  if (isLoading) {
-    Logger::log("Loading phase - waiting 5 seconds...");
-    delay(5000);
-    isLoading = false;
-    Logger::log("Loading complete - starting main loop");
+  scheduler.runOnce();
+}
+
+// Display side: touch, the slideshow and the snapshots arriving from the network side
+void initializeScheduler() {
+  touchTask = scheduler.addTask("touch", runTouchTask, touchPollMs);
+  slideShowTask = scheduler.addTask("slideshow", runSlideShowTask, slideShowPollMs);
+  inboxTask = scheduler.addTask("inbox", runInboxTask, inboxPollMs);
+  int statsTask = scheduler.addTask("stats", logSchedulerStats, statsIntervalMs);
+  scheduler.wakeIn(statsTask, statsIntervalMs);
+}
+
+// Network side: WiFi joins first, while touch and the warm-start slides keep running;
+// fetches and NTP start once the link is up and the weather clients are ready
+void startNetworkThread() {
+  wifi.setEventHandler(onWiFiEvent);
+  wifiTask = networkScheduler.addTask("wifi", runWiFiTask, wifiPollMs);
+  fetchTask = networkScheduler.addTask("fetch", runFetchTask, fetchIdleMs);
+  ntpTask = networkScheduler.addTask("ntp", runNtpTask, ntpIdleMs);
+  int statsTask = networkScheduler.addTask("stats", logNetworkStats, statsIntervalMs);
+  networkScheduler.suspend(fetchTask);
+  networkScheduler.suspend(ntpTask);
+  networkScheduler.wakeIn(wifiTask, startupDelayMs);
+  networkScheduler.wakeIn(statsTask, statsIntervalMs);
+
+#if defined(ARDUINO_GIGA)
+  networkThread.start(runNetwork);
+#else
+  std::thread(runNetwork).detach();
+#endif
+}
+
+void runNetwork() {
+  for (;;) {
+    networkScheduler.runOnce();
   }
+}
 
-  // // Handle touch input for display toggle
-  Display::handleTouchToggle();
+void runTouchTask() {
+  // A tap that turns the display back on should resume the slideshow straight away
+  if (Display::handleTouchToggle()) {
+    scheduler.wakeIn(slideShowTask, 0);
+  }
+}
 
-  // // Update slideshow if weather data is available
+void runSlideShowTask() {
   Display::updateSlideShow();
 
-  // Sync with NTP periodically (every 6 hours) for accurate time
-  if (!offlineMode && timeManager != nullptr) {
-    timeManager->resyncIfNeeded();
+#if defined(DISPLAY_DEBUG)
+  if (captureSlideFrames) {
+    captureSlides();
   }
+#endif
+
+  // Spare time: draw the next slide now so its transition is only a present
+  Display::prepareNextSlide();
 
-  // // Check if it's time to update weather data periodically
-  if (isUpdateRequired()) {
-    Serial.println("Updating weather data...");
-    updateWeatherData();
-    lastUpdate = millis();
+  // Wake exactly when the next slide is due
+  unsigned long nextSlideTime;
+  if (Display::getNextSlideTime(nextSlideTime)) {
+    scheduler.wakeAt(slideShowTask, nextSlideTime);
   }
+}
 
-  delay(50);
+// Apply the snapshots the network side has sent since the last run
+void runInboxTask() {
+  static WeatherMessage message;
+  bool received = false;
+  while (weatherChannel.receive(message)) {
+    applyWeatherMessage(message);
+    received = true;
+  }
+
+  // New data versions make the prepared slide stale; let the slideshow prepare it again
+  if (received) {
+    scheduler.wakeIn(slideShowTask, 0);
+  }
+}
+
+void applyWeatherMessage(const WeatherMessage& message) {
+  switch (message.type) {
+  case WeatherMessageType::Realtime: {
+    RealtimeWeatherData realtimeData = { 0, 0, 0, 0, 0, 0, 0, false };
+    message.getRealtime(realtimeData);
+    displayRealtimeData(realtimeData);
+    break;
+  }
+  case WeatherMessageType::DerivedRealtime: {
+    RealtimeWeatherData realtimeData = { 0, 0, 0, 0, 0, 0, 0, false };
+    if (message.getRealtime(realtimeData) && realtimeData.isValid) {
+      Display::updateRealtimeData(realtimeData);
+    }
+    break;
+  }
+  case WeatherMessageType::Pool: {
+    PoolTemperatureData poolData = { "", 0.0f, 0, "", false };
+    message.getPool(poolData);
+    displayPoolData(poolData);
+    break;
+  }
+  case WeatherMessageType::Forecast: {
+    static ForecastData forecastData = {};
+    forecastData.isValid = message.getForecast(forecastData) && forecastData.isValid;
+    displayForecastData(forecastData);
+    break;
+  }
+  case WeatherMessageType::Error:
+    Display::displayError(message.getError());
+    break;
+  default:
+    break;
+  }
+}
+
+void runFetchTask() {
+  // Start the next fetch the API budgets allow, or advance the in-flight one by one bounded step
+  pollWeatherFetch();
+  refreshDerivedRealtime(false);
+  ConnectionPool::evictIdle();
+
+  // Persist the last good readings so the next boot has something to show immediately;
+  // flash writes happen here rather than on the display side
+  WarmStartCache::flushIfDue(Display::getSnapshots());
+
+  networkScheduler.wakeIn(fetchTask, activeFetch != FetchSource::None ? fetchPollMs : fetchIdleMs);
+}
+
+// Query the NTP servers and take their replies without blocking (see SntpClient). The clock
+// is read on every run, so an outage longer than a micros() wrap does not lose one.
+void runNtpTask() {
+  TimeManager::tickClock();
+  networkScheduler.wakeIn(ntpTask, wifi.isConnected() ? timeManager->pollNTP() : ntpIdleMs);
+}
+
+// Join and keep the network without blocking; the manager picks its next poll time
+void runWiFiTask() {
+  networkScheduler.wakeIn(wifiTask, wifi.poll());
+}
+
+// The first join sets up the weather clients; every join after a drop sends the fetches
+// that failed while it was down straight away instead of after their backoff
+void onWiFiEvent(WiFiEvent event) {
+  switch (event) {
+  case WiFiEvent::LinkUp:
+    wifiOutageReported = false;
+    if (realtimeWeather == nullptr) {
+      initializeWeatherClients();
+      return;
+    }
+    fetchScheduler.retryFailed();
+    networkScheduler.wakeIn(fetchTask, 0);
+    timeManager->syncSoon();
+    networkScheduler.wakeIn(ntpTask, 0);
+    break;
+  case WiFiEvent::LinkDown:
+  case WiFiEvent::AttemptFailed:
+    // Once per outage; the manager keeps retrying on its own
+    if (!wifiOutageReported) {
+      outbox.setError(event == WiFiEvent::LinkDown ? "WiFi connection lost" : "WiFi connection failed");
+      sendOutbox();
+      wifiOutageReported = true;
+    }
+    break;
+  }
+}
+
+// Hand the outbox to the display side; never waits for it
+void sendOutbox() {
+  if (!weatherChannel.send(outbox)) {
+    Logger::log("Weather channel full, snapshot dropped");
+  }
+}
+
+void logSchedulerStats() {
+  scheduler.logStats();
+}
+
+void logNetworkStats() {
+  networkScheduler.logStats();
+  wifi.logStats();
+  if (weatherQueue.getDropped() > 0) {
+    Logger::log("Weather channel: " + String(weatherQueue.getDropped()) + " snapshots dropped");
+  }
 }
 
 void updateWeatherData() {
-  if (!offlineMode && WiFi.status() != WL_CONNECTED) {
-    Logger::log("WiFi not connected - skipping weather update");
+  // Don't clear screen here as slideshow will handle display
+  Logger::log("Using test data for weather, pool and forecast...");
+  displayRealtimeData(loadTestRealtimeData());
+  displayPoolData(poolTemperature->loadTestData());
+  displayForecastData(loadTestForecastData());
+}
+
+void pollWeatherFetch() {
+  if (offlineMode || realtimeWeather == nullptr) {
     return;
   }
 
-  // Don't clear screen here as slideshow will handle display
-  fetchAndDisplayRealtime();
-  delay(10);
-  fetchAndDisplayPoolTemp();
-  delay(10);
-  // Remove forecast for now to focus on slideshow
-  // fetchAndDisplayForecast();
+  if (activeFetch == FetchSource::None) {
+    if (!wifi.isConnected()) {
+      return;
+    }
+
+    activeFetch = fetchScheduler.nextFetch(millis());
+    if (activeFetch != FetchSource::None) {
+      startFetch(activeFetch);
+    }
+    return;
+  }
+
+  if (!pollActiveFetch()) {
+    return;
+  }
+
+  bool success = finishActiveFetch();
+  fetchScheduler.recordResult(activeFetch, success, millis());
+  fetchScheduler.logBudget(millis());
+  activeFetch = FetchSource::None;
+}
+
+// Recompute the realtime values from the latest forecast once a minute and send them on
+void refreshDerivedRealtime(bool force) {
+  if (!unifiedFetchMode || !latestForecast.isValid) {
+    return;
+  }
+
+  unsigned long now = millis();
+  if (!force && now - lastDerivedRealtimeTime < derivedRealtimeIntervalMs) {
+    return;
+  }
+  lastDerivedRealtimeTime = now;
+
+  // Without NTP, count forward from the first minutely entry, which tomorrow.io
+  // aligns to the minute the forecast was generated
+  unsigned long unixTime = TimeManager::getCurrentUnixTime();
+  if (unixTime == 0 && latestForecast.minuteCount > 0) {
+    unixTime = latestForecast.minutely[0].time + (now - latestForecastTime) / 1000;
+  }
+
+  RealtimeWeatherData realtimeData = { 0, 0, 0, 0, 0, 0, 0, false };
+  if (!WeatherForecast::interpolateRealtime(latestForecast, unixTime, realtimeData)) {
+    Logger::log("Forecast timelines do not cover the current time");
+    return;
+  }
+
+  outbox.setRealtime(realtimeData, WeatherMessageType::DerivedRealtime);
+  sendOutbox();
+}
+
+void startFetch(FetchSource source) {
+  // Every attempt counts against the quota; a request that fails to start finishes
+  // on the next poll and reports invalid data
+  fetchScheduler.recordAttempt(source, millis());
+
+  switch (source) {
+  case FetchSource::Realtime:
+    Logger::log("=== Starting realtime weather fetch ===");
+    realtimeWeather->beginFetch();
+    break;
+  case FetchSource::Pool:
+    poolTemperature->beginFetch();
+    break;
+  case FetchSource::Forecast:
+    Logger::log("=== Starting forecast weather fetch ===");
+    forecastWeather->beginFetch();
+    break;
+  default:
+    break;
+  }
 }
 
+bool pollActiveFetch() {
+  switch (activeFetch) {
+  case FetchSource::Realtime:
+    return realtimeWeather->pollFetch();
+  case FetchSource::Pool:
+    return poolTemperature->pollFetch();
+  case FetchSource::Forecast:
+    return forecastWeather->pollFetch();
+  default:
+    return true;
+  }
+}
+
+// Send the finished fetch's data to the display side; true if it was valid
+bool finishActiveFetch() {
+  switch (activeFetch) {
+  case FetchSource::Realtime: {
+    RealtimeWeatherData realtimeData = realtimeWeather->getData();
+    outbox.setRealtime(realtimeData);
+    sendOutbox();
+    return realtimeData.isValid;
+  }
+  case FetchSource::Pool: {
+    PoolTemperatureData poolData = poolTemperature->getData();
+    outbox.setPool(poolData);
+    sendOutbox();
+    return poolData.isValid;
+  }
+  case FetchSource::Forecast: {
+    const ForecastData& forecastData = forecastWeather->getData();
+    outbox.setForecast(forecastData);
+    sendOutbox();
+    if (unifiedFetchMode && forecastData.isValid) {
+      latestForecast = forecastData;
+      latestForecastTime = millis();
+      refreshDerivedRealtime(true);
+    }
+    return forecastData.isValid;
+  }
+  default:
+    return false;
+  }
+}
+
+#if defined(DISPLAY_DEBUG)
+// Render each slide off-screen once, logging its cost and dumping the frame over Serial
+void captureSlides() {
+  static bool captured = false;
+  if (captured || !Display::getWeatherData().isValid) {
+    return;
+  }
+  captured = true;
+
+  FrameBuffer frame(800, 480);
+  Display::renderSlides(frame, &Serial);
+  Display::benchmarkText(frame);
+}
+#endif
+
 void clearScreen() {
   Logger::log("Clearing screen...");
   Display::clearScreen();
@@ -135,7 +503,7 @@ RealtimeWeatherData loadTestRealtimeData() {
     "location": { "lat": -37.87644194695991, "lon": 145.06346130288253 }
   })";
 
-  RealtimeWeatherData data = { 0, 0, 0, 0, 0, 0, false };
+  RealtimeWeatherData data = { 0, 0, 0, 0, 0, 0, 0, false };
 
   // Use the existing parsing function from WeatherRealtime class
   if (!realtimeWeather || !realtimeWeather->parseRealtimeJson(String(testRealtimeJson), data)) {
@@ -208,6 +576,29 @@ void initializeSystem() {
   Serial.begin(115200);
 
   Display::init();
+  if (dirtyRectRendering) {
+    Display::enableDirtyRects();
+  }
+  Display::logIcons();
+}
+
+// Show the last saved readings before WiFi and the first fetch, marked as cached
+void restoreWarmStartCache() {
+  if (offlineMode) {
+    return;
+  }
+
+  // Unified mode re-derives realtime from the forecast every minute; only fetches are saved
+  WarmStartCache::setRealtimeDerived(unifiedFetchMode);
+
+  RealtimeWeatherData realtimeData = { 0, 0, 0, 0, 0, 0, 0, false };
+  PoolTemperatureData poolData = { "", 0.0f, 0, "", false };
+  static ForecastData forecastData = {};
+
+  if (WarmStartCache::load(realtimeData, poolData, forecastData)) {
+    Display::showCachedData(realtimeData, poolData, forecastData);
+    WarmStartCache::markSaved(Display::getSnapshots());
+  }
 }
 
 void initializeOfflineMode() {
@@ -219,71 +610,28 @@ void initializeOfflineMode() {
   poolTemperature = new PoolTemperature(timeManager);
 
   updateWeatherData();
-
-  Display::updateSlideShow();
-
-  delay(1000);
-}
-
-bool initializeWiFiConnection() {
-  Logger::log("Connecting to WiFi...");
-  WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
-
-  int connectionAttempts = 0;
-  while (WiFi.status() != WL_CONNECTED && connectionAttempts < 20) {
-    delay(2000);
-    Serial.print(".");
-    connectionAttempts++;
-  }
-
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println();
-    Logger::log("WiFi connected! IP address: ", WiFi.localIP().toString());
-    Logger::log("Signal strength: " + String(WiFi.RSSI()) + " dBm");
-    return true;
-  }
-
-  Serial.println();
-  Logger::log("WiFi connection failed!");
-  Logger::log("WiFi status: ", (int)WiFi.status());
-  Display::displayError("WiFi connection failed");
-  return false;
 }
 
 void initializeWeatherClients() {
   timeManager = new TimeManager();
-  timeManager->begin();
-  timeManager->syncWithNTP(); // Initial NTP sync
+  timeManager->begin(); // The first NTP round goes out from the ntp task
 
   realtimeWeather = new WeatherRealtime(API_KEY, LOCATION);
   forecastWeather = new WeatherForecast(API_KEY, LOCATION);
   poolTemperature = new PoolTemperature(timeManager);
-  Logger::log("Fetching initial weather data...");
-  updateWeatherData();
-}
 
-bool isUpdateRequired() {
-  if (!offlineMode && WiFi.status() != WL_CONNECTED) {
-    return false;
+  if (unifiedFetchMode) {
+    // The forecast carries realtime too, so it takes the realtime call's place in the budget
+    fetchScheduler.setEnabled(FetchSource::Realtime, false);
+    fetchScheduler.setIntervals(FetchSource::Forecast, 15 * 60000UL, 30 * 60000UL);
   }
-
-  unsigned long currentTime = millis();
-  return (currentTime - lastUpdate > updateIntervalMs);
+  // Nothing has been fetched yet, so the fetch scheduler picks the first fetch right away
+  networkScheduler.resume(fetchTask);
+  networkScheduler.resume(ntpTask);
+  Logger::log("Weather clients ready, first fetch starts from the fetch task");
 }
 
-void fetchAndDisplayRealtime() {
-  Logger::log("=== Starting realtime weather fetch ===");
-  RealtimeWeatherData realtimeData;
-
-  if (offlineMode) {
-    Logger::log("Using test data for realtime weather...");
-    realtimeData = loadTestRealtimeData();
-  }
-  else {
-    Logger::log("Fetching realtime weather...");
-    realtimeData = realtimeWeather->fetchWeatherData();
-  }
-
+void displayRealtimeData(const RealtimeWeatherData& realtimeData) {
   Logger::log("Realtime data valid: ", realtimeData.isValid);
 
   if (!realtimeData.isValid) {
@@ -299,19 +647,7 @@ void fetchAndDisplayRealtime() {
   Logger::log("=== Realtime display call completed ===");
 }
 
-void fetchAndDisplayPoolTemp() {
-  Logger::log("=== Starting pool temperature fetch ===");
-  PoolTemperatureData poolData;
-
-  if (offlineMode) {
-    Logger::log("Using test data for pool temperature...");
-    poolData = poolTemperature->loadTestData();
-  }
-  else {
-    Logger::log("Fetching pool temperature...");
-    poolData = poolTemperature->fetchPoolData();
-  }
-
+void displayPoolData(const PoolTemperatureData& poolData) {
   Logger::log("Pool data valid: ", poolData.isValid);
 
   if (poolData.isValid) {
@@ -327,19 +663,7 @@ void fetchAndDisplayPoolTemp() {
   Logger::log("=== Pool temperature fetch completed ===");
 }
 
-void fetchAndDisplayForecast() {
-  Serial.println("=== Starting forecast weather fetch ===");
-  ForecastData forecastData;
-
-  if (offlineMode) {
-    Serial.println("Using test data for forecast...");
-    forecastData = loadTestForecastData();
-  }
-  else {
-    Serial.println("Fetching weather forecast...");
-    forecastData = forecastWeather->fetchForecastData();
-  }
-
+void displayForecastData(const ForecastData& forecastData) {
   Serial.print("Forecast data valid: ");
   Serial.println(forecastData.isValid ? "YES" : "NO");
 
@@ -350,7 +674,7 @@ void fetchAndDisplayForecast() {
   }
 
   Serial.println("Forecast data received successfully");
-  Serial.println("Calling Display::displayForecast...");
-  Display::displayForecast(forecastData);
+  Serial.println("Calling Display::updateForecastData...");
+  Display::updateForecastData(forecastData);
   Serial.println("=== Forecast display call completed ===");
 }